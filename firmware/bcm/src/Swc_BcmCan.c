@@ -40,11 +40,8 @@
 #include <net/if.h>
 #include <string.h>
 #include <unistd.h>
-/* cppcheck-suppress misra-c2012-21.10
- * Deviation: time.h is required for clock_gettime() in the Docker-simulated
- * BCM ECU (POSIX simulation, not safety-critical firmware). */
-#include <time.h>
 #include <sys/ioctl.h>
+#include "Sil_Time.h"
 #endif /* !BCM_CAN_USE_MOCK */
 
 /* ====================================================================
@@ -82,14 +79,8 @@ extern sint32   mock_usleep(uint32 usec);
 #define POSIX_WRITE(fd, buf, len)       write((fd), (buf), (len))
 #define POSIX_USLEEP(us)                usleep((us))
 
-static uint32 real_get_tick_ms(void)
-{
-    struct timespec ts;
-    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
-    return (uint32)((ts.tv_sec * 1000u) + (ts.tv_nsec / 1000000u));
-}
-
-#define GET_TICK_MS()  real_get_tick_ms()
+/* Virtual time: follows SIL_TIME_SCALE and the lockstep time master */
+#define GET_TICK_MS()  Sil_Time_GetTickMs()
 /* TODO:POST-BETA -- implement real E2E CRC-8 validation */
 #define E2E_CHECK(data, dlc)  TRUE
 
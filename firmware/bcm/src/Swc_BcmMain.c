@@ -24,10 +24,7 @@
  * Deviation: stdio.h is required for printf() cycle-overrun logging in
  * the Docker-simulated BCM ECU (not safety-critical firmware). */
 #include <stdio.h>
-/* cppcheck-suppress misra-c2012-21.10
- * Deviation: time.h is required for clock_gettime() in the Docker-simulated
- * BCM ECU (POSIX simulation, not safety-critical firmware). */
-#include <time.h>
+#include "Sil_Time.h"
 #endif /* !BCM_MAIN_USE_MOCK */
 
 /* ====================================================================
@@ -47,14 +44,8 @@ extern void           mock_log_overrun(uint32 duration_ms);
 
 #else /* Real implementation */
 
-static uint32 real_get_tick_ms(void)
-{
-    struct timespec ts;
-    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
-    return (uint32)((ts.tv_sec * 1000u) + (ts.tv_nsec / 1000000u));
-}
-
-#define GET_TICK_MS()  real_get_tick_ms()
+/* Virtual time: follows SIL_TIME_SCALE and the lockstep time master */
+#define GET_TICK_MS()  Sil_Time_GetTickMs()
 #define LOG_OVERRUN(duration)  (void)printf("[BCM] WARN: Cycle overrun %lu ms\n", (unsigned long)(duration))
 
 #endif /* BCM_MAIN_USE_MOCK */
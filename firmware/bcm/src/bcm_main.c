@@ -8,8 +8,9 @@
  *
  * @details  Simulated ECU running in Docker on Linux with SocketCAN.
  *           Initializes all BSW modules and SWCs, then enters a main loop
- *           with 10ms tick via usleep. Rte_MainFunction dispatches all
- *           configured runnables at their configured periods.
+ *           with a 10ms periodic tick (Sil_Time_WaitNextPeriod).
+ *           Rte_MainFunction dispatches all configured runnables at their
+ *           configured periods.
  *
  *           Handles SIGINT/SIGTERM for graceful shutdown.
  *
@@ -220,10 +221,10 @@ int main(void)
     /* ---- Step 4: Start CAN controller ---- */
     (void)Can_SetControllerMode(0u, CAN_CS_STARTED);
 
-    /* ---- Step 5: Main loop — 10ms tick via usleep ---- */
+    /* ---- Step 5: Main loop — 10ms tick (Sil_Time periodic timer) ---- */
     while (shutdown_requested == 0u) {
-        /* Sleep 10ms (10000 microseconds) */
-        Sil_Time_Sleep(10000u); /* 10ms virtual tick */
+        /* Wait for the next 10ms period (10000 microseconds) */
+        Sil_Time_WaitNextPeriod(10000u); /* 10ms virtual tick */
 
         /* RTE scheduler dispatches all configured runnables */
         Rte_MainFunction();
@@ -10,6 +10,7 @@
  * @copyright Taktflow Systems 2026
  */
 #include "Com.h"
+#include "StbM.h"
 #include "Cvc_Cfg.h"
 
 /* ==================================================================
@@ -98,6 +99,13 @@ static const Com_TxPduConfigType cvc_tx_pdu_config[] = {
 
 #define CVC_COM_TX_PDU_COUNT  (sizeof(cvc_tx_pdu_config) / sizeof(cvc_tx_pdu_config[0]))
 
+/* I-PDU groups of the TX PDUs (cvc_tx_pdu_config order), 0: none */
+static const Com_IpduGroupVector cvc_tx_pdu_groups[CVC_COM_TX_PDU_COUNT] = {
+    0u, 0u, 0u, 0u, 0u, 0u,
+    CVC_COM_IPDU_GROUP_BODY,    /* CVC_COM_TX_BODY_CMD */
+    0u,
+};
+
 /* ==================================================================
  * RX PDU Configuration Table
  * ================================================================== */
@@ -130,4 +138,6 @@ const Com_ConfigType cvc_com_config = {
     .txPduCount   = (uint8)CVC_COM_TX_PDU_COUNT,
     .rxPduConfig  = cvc_rx_pdu_config,
     .rxPduCount   = (uint8)CVC_COM_RX_PDU_COUNT,
+    .txPduGroups  = cvc_tx_pdu_groups,
+    .getRxTimeUs  = StbM_GetTimeUs,
 };
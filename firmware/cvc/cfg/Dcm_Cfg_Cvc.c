@@ -10,6 +10,7 @@
  * @copyright Taktflow Systems 2026
  */
 #include "Dcm.h"
+#include "Rte.h"
 #include "Cvc_Cfg.h"
 
 /* ==================================================================
@@ -106,6 +107,13 @@ static const Dcm_DidTableType cvc_did_table[] = {
     { 0xF191u, Dcm_ReadDid_HwVer, 3u },   /* Hardware Version       */
     { 0xF195u, Dcm_ReadDid_SwVer, 3u },   /* Software Version       */
     { 0xF010u, Dcm_ReadDid_State, 1u },   /* Vehicle State          */
+#if defined(RTE_PROFILING)
+    /* Runnable execution times, 10 runnables (Rte_Cfg_Cvc.c) */
+    { 0xF0F0u, Rte_ReadProfileSummary,
+      RTE_PROF_SUMMARY_LENGTH(10u) },        /* Runnable times min/mean/max */
+    { 0xF0F1u, Rte_ReadProfileHistogram,
+      RTE_PROF_HISTOGRAM_LENGTH(10u) },      /* Runnable time histograms    */
+#endif
 };
 
 #define CVC_DCM_DID_COUNT  (sizeof(cvc_did_table) / sizeof(cvc_did_table[0]))
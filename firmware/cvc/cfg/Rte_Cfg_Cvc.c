@@ -25,6 +25,7 @@ extern void Com_MainFunction_Tx(void);
 extern void Com_MainFunction_Rx(void);
 extern void Can_MainFunction_Read(void);
 extern void Can_MainFunction_BusOff(void);
+extern void IoHwAb_MainFunction(void);
 
 /* ==================================================================
  * Signal Configuration Table
@@ -73,23 +74,39 @@ static const Rte_SignalConfigType cvc_signal_config[CVC_SIG_COUNT] = {
 /* ==================================================================
  * Runnable Configuration Table
  * Priority: higher number = executes first within same period
+ * offsetMs: the 10 ms chain is spread over the 10 ticks of its period in
+ *           dispatch order (RX -> SWCs -> TX), so the 1 ms CAN read never
+ *           shares a tick with the whole chain
  * ================================================================== */
 
 static const Rte_RunnableConfigType cvc_runnable_config[] = {
-    /* func,                           periodMs, priority, seId */
-    { Can_MainFunction_Read,               1u,      9u,     0xFFu },  /* CAN RX first (1ms: FIFO=3, bus>3/10ms) */
-    { Com_MainFunction_Rx,                10u,      8u,     0xFFu },  /* COM RX deadline monitor */
-    { Swc_EStop_MainFunction,             10u,      7u,     2u    },  /* E-stop highest SWC prio */
-    { Swc_Pedal_MainFunction,             10u,      6u,     0u    },  /* Pedal processing        */
-    { Swc_VehicleState_MainFunction,      10u,      5u,     1u    },  /* State machine           */
-    { Swc_Heartbeat_MainFunction,         10u,      4u,     3u    },  /* Heartbeat TX/RX         */
-    { Swc_Dashboard_MainFunction,         10u,      3u,     4u    },  /* Display                 */
-    { Com_MainFunction_Tx,                10u,      2u,     0xFFu },  /* COM TX (after all SWCs) */
-    { Can_MainFunction_BusOff,            10u,      1u,     0xFFu },  /* Bus-off check           */
+    /* func,                           periodMs, priority, seId,  offsetMs */
+    { Can_MainFunction_Read,               1u,      9u,     0xFFu,  0u },  /* CAN RX first (1ms: FIFO=3, bus>3/10ms) */
+    { Com_MainFunction_Rx,                10u,      8u,     0xFFu,  0u },  /* COM RX deadline monitor */
+    { Swc_EStop_MainFunction,             10u,      7u,     2u,     1u },  /* E-stop highest SWC prio */
+    { Swc_Pedal_MainFunction,             10u,      6u,     0u,     2u },  /* Pedal processing        */
+    { Swc_VehicleState_MainFunction,      10u,      5u,     1u,     3u },  /* State machine           */
+    { Swc_Heartbeat_MainFunction,         10u,      4u,     3u,     4u },  /* Heartbeat TX/RX         */
+    { Swc_Dashboard_MainFunction,         10u,      3u,     4u,     5u },  /* Display                 */
+    { Com_MainFunction_Tx,                10u,      2u,     0xFFu,  6u },  /* COM TX (after all SWCs) */
+    { Can_MainFunction_BusOff,            10u,      1u,     0xFFu,  7u },  /* Bus-off check           */
+    { IoHwAb_MainFunction,                10u,      8u,     0xFFu,  1u },  /* Pedal SPI read, before Pedal */
 };
 
 #define CVC_RUNNABLE_COUNT  (sizeof(cvc_runnable_config) / sizeof(cvc_runnable_config[0]))
 
+/* ==================================================================
+ * Event Triggers — run a runnable at the next dispatch point on top of
+ * its period (runnable = index in the table above)
+ * ================================================================== */
+
+static const Rte_EventConfigType cvc_event_config[] = {
+    /* runnable, kind,                   source */
+    { 4u,   RTE_EVENT_DATA_CHANGED,   CVC_SIG_ESTOP_ACTIVE },  /* VehicleState after EStop */
+};
+
+#define CVC_EVENT_COUNT  (sizeof(cvc_event_config) / sizeof(cvc_event_config[0]))
+
 /* ==================================================================
  * Aggregate RTE Configuration
  * ================================================================== */
@@ -99,4 +116,6 @@ const Rte_ConfigType cvc_rte_config = {
     .signalCount    = CVC_SIG_COUNT,
     .runnableConfig = cvc_runnable_config,
     .runnableCount  = (uint8)CVC_RUNNABLE_COUNT,
+    .eventConfig    = cvc_event_config,
+    .eventCount     = (uint8)CVC_EVENT_COUNT,
 };
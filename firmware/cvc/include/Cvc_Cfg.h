@@ -53,6 +53,11 @@
 #define CVC_COM_TX_BODY_CMD        6u   /* CAN 0x350 */
 #define CVC_COM_TX_UDS_RSP         7u   /* CAN 0x7E8 */
 #define CVC_COM_TX_DTC             8u   /* CAN 0x500 — DTC broadcast */
+#define CVC_COM_TX_TIME_SYNC       9u   /* CAN 0x008 — CanTSyn SYNC/FUP */
+
+/* Com TX I-PDU groups (bit masks). Safety, heartbeat and diagnostic PDUs
+ * are in no group and always transmitted. */
+#define CVC_COM_IPDU_GROUP_BODY    0x01u  /* Body control (BCM)        */
 
 /* ====================================================================
  * Com RX PDU IDs
@@ -162,6 +167,21 @@
 
 #define CVC_RTE_PERIOD_MS         10u   /* 10ms cyclic task rate */
 
+/* ====================================================================
+ * WdgM Torque Chain Supervision (Pedal -> VehicleState)
+ *
+ * SE 5 has no runnable of its own: the checkpoints are reported by the
+ * two SWCs, so the entity has no alive supervision and is not switched
+ * off by the BswM runnable masks. Pedal runs at offset 2 and
+ * VehicleState at offset 3, so the nominal deadline is 1 ms; the limit
+ * is one period, which absorbs SIL scheduling jitter.
+ * ==================================================================== */
+
+#define CVC_WDGM_SE_TORQUE_CHAIN       5u
+#define CVC_WDGM_CP_TORQUE_WRITTEN     0u      /* Swc_Pedal: torque request written   */
+#define CVC_WDGM_CP_TORQUE_CONSUMED    1u      /* Swc_VehicleState: signals read      */
+#define CVC_WDGM_TORQUE_CHAIN_MAX_US   10000u  /* Consumed within one 10ms period     */
+
 /* ====================================================================
  * Heartbeat Constants
  * ==================================================================== */
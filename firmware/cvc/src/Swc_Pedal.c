@@ -29,6 +29,7 @@
 #include "Rte.h"
 #include "Dem.h"
 #include "Com.h"
+#include "WdgM.h"
 
 /* ==================================================================
  * Constants
@@ -477,6 +478,9 @@ void Swc_Pedal_MainFunction(void)
     (void)Rte_Write(CVC_SIG_PEDAL_FAULT, (uint32)Pedal_Fault);
     (void)Rte_Write(CVC_SIG_TORQUE_REQUEST, (uint32)torque);
 
+    /* WdgM: start of the torque chain deadline (ends in VehicleState) */
+    (void)WdgM_ReportCheckpoint(CVC_WDGM_SE_TORQUE_CHAIN, CVC_WDGM_CP_TORQUE_WRITTEN);
+
     /* ----------------------------------------------------------
      * Step 10b: Publish torque to Com -> CAN 0x101
      * ---------------------------------------------------------- */
@@ -29,6 +29,7 @@
 #include "BswM.h"
 #include "Dem.h"
 #include "Com.h"
+#include "WdgM.h"
 
 /* SIL diagnostic logging — compile with -DSIL_DIAG to enable */
 #ifdef SIL_DIAG
@@ -503,6 +504,9 @@ void Swc_VehicleState_MainFunction(void)
     (void)Rte_Read(CVC_SIG_TORQUE_REQUEST, &torque_request);
     (void)Rte_Read(CVC_SIG_PEDAL_POSITION, &pedal_position);
 
+    /* WdgM: end of the torque chain deadline (started in Swc_Pedal) */
+    (void)WdgM_ReportCheckpoint(CVC_WDGM_SE_TORQUE_CHAIN, CVC_WDGM_CP_TORQUE_CONSUMED);
+
 #ifdef SIL_DIAG
     {
         static uint16 diag_cycle = 0u;
@@ -18,6 +18,8 @@
 #include "Sil_Time.h"
 
 #ifndef PLATFORM_POSIX_TEST
+#include "Spi_Posix.h"
+#include "Gpt_Posix.h"
 #include <time.h>
 #include <unistd.h>
 #include <stdio.h>
@@ -62,12 +64,17 @@ void Main_Hw_SysTickInit(uint32 periodUs)
 }
 
 /**
- * @brief  Wait for interrupt — timerfd-accelerated sleep on POSIX
+ * @brief  Wait for interrupt — next 1ms period of the SIL loop timer on POSIX
+ * @note   The SPI transfers started in the last tick complete here, as
+ *         the SPI DMA interrupt would during the wait on target.
+ *         Expired Gpt channels are reported like the timer interrupt.
  */
 void Main_Hw_Wfi(void)
 {
 #ifndef PLATFORM_POSIX_TEST
-    Sil_Time_Sleep(1000u); /* 1ms virtual — actual duration = 1ms / SIL_TIME_SCALE */
+    Sil_Time_WaitNextPeriod(1000u); /* 1ms virtual — wall period = 1ms / SIL_TIME_SCALE */
+    Spi_Posix_Poll();
+    Gpt_Posix_Poll();
 #endif
 }
 
@@ -26,11 +26,22 @@
 #include "PduR.h"
 #include "E2E.h"
 #include "Dem.h"
+#include "NvM.h"
+#ifdef PLATFORM_STM32
+#include "Fls.h"
+#include "Fee.h"
+#endif
 #include "WdgM.h"
 #include "BswM.h"
 #include "Dcm.h"
 #include "CanTp.h"
+#include "StbM.h"
+#include "CanTSyn.h"
 #include "Rte.h"
+#ifdef PLATFORM_STM32
+#include "Os.h"
+#include "SchM.h"
+#endif
 #include "Spi.h"
 #include "Adc.h"
 #include "Pwm.h"
@@ -133,6 +144,7 @@ static const CanIf_TxPduConfigType canif_tx_config[] = {
     { 0x350u, CVC_COM_TX_BODY_CMD,       8u, 0u },  /* Body control         */
     { 0x7E8u, CVC_COM_TX_UDS_RSP,        8u, 0u },  /* UDS response         */
     { 0x500u, CVC_COM_TX_DTC,           8u, 0u },  /* DTC broadcast        */
+    { 0x008u, CVC_COM_TX_TIME_SYNC,     8u, 0u },  /* Time SYNC/FUP        */
 };
 
 /** CanIf RX PDU routing: CAN ID → Com RX PDU */
@@ -183,6 +195,27 @@ static const PduR_ConfigType cvc_pdur_config = {
     .routingCount = (uint8)(sizeof(cvc_pdur_routing) / sizeof(cvc_pdur_routing[0])),
 };
 
+/** StbM: CVC is the time master, its tick is the vehicle's global time */
+static const StbM_ConfigType stbm_config = {
+    .role                = STBM_ROLE_MASTER,
+    .getLocalTimeUs      = Main_Hw_GetTick,
+    .syncLossTimeoutUs   = 0u,
+    .jumpThresholdUs     = 0u,
+    .offsetCorrectionUs  = 0u,
+    .rateMeasureUs       = 0u,
+    .maxRateDeviationPpm = 0u,
+};
+
+/** CanTSyn: SYNC/FUP on CAN 0x008 every 100 ms */
+static const CanTSyn_ConfigType cantsyn_config = {
+    .role         = CANTSYN_ROLE_MASTER,
+    .timeDomain   = 0u,
+    .txPduId      = CVC_COM_TX_TIME_SYNC,
+    .syncPeriodMs = 100u,
+    .mainPeriodMs = 10u,
+    .fupTimeoutMs = 0u,
+};
+
 /** CanTp configuration — single channel for UDS diagnostics */
 static const CanTp_ConfigType cantp_config = {
     .rxPduId      = 0u,                    /* CanTp RX channel ID               */
@@ -191,13 +224,30 @@ static const CanTp_ConfigType cantp_config = {
     .upperRxPduId = 0u,                    /* Dcm RX PDU ID                     */
 };
 
+/** SPI jobs — both pedal sensors, read asynchronously every 10 ms */
+static const Spi_JobConfigType spi_jobs[] = {
+    { .channel = 0u, .csChannel = 0u },  /* Job 0: pedal sensor 0 */
+    { .channel = 2u, .csChannel = 1u },  /* Job 1: pedal sensor 1 */
+};
+
+static const uint8 spi_seq_pedal_jobs[] = { 0u, 1u };
+
+static const Spi_SequenceConfigType spi_sequences[] = {
+    { .jobs = spi_seq_pedal_jobs, .numJobs = 2u,
+      .notification = IoHwAb_AngleReadNotification },  /* Seq 0: pedal */
+};
+
 /** SPI driver configuration — AS5048A angle sensors (CPOL=0, CPHA=1, 16-bit) */
 static const Spi_ConfigType spi_config = {
     .clockSpeed   = 1000000u,   /* 1 MHz SPI clock              */
     .cpol         = 0u,         /* Clock idle low                */
     .cpha         = 1u,         /* Sample on trailing edge       */
     .dataWidth    = 16u,        /* 16-bit transfers              */
-    .numChannels  = 2u,         /* Ch 0: pedal, Ch 1: steering   */
+    .numChannels  = 3u,         /* Ch 0: pedal 0, Ch 1: steering, Ch 2: pedal 1 */
+    .jobs         = spi_jobs,
+    .numJobs      = 2u,
+    .sequences    = spi_sequences,
+    .numSequences = 1u,
 };
 
 /** ADC group configuration — motor current, motor temp, battery voltage */
@@ -243,6 +293,11 @@ static const IoHwAb_ConfigType iohwab_config = {
     .MotorDirAChannel     = 3u,
     .MotorDirBChannel     = 4u,
     .EStopDioChannel      = 5u,
+    .AngleAsyncSensors    = IOHWAB_ANGLE_PEDAL_0 | IOHWAB_ANGLE_PEDAL_1,
+    .AngleSpiSequence     = 0u,
+    .PedalSpiChannel1     = 2u,
+    .AngleMaxAgeUs        = 15000u,  /* 1.5 cycles of IoHwAb_MainFunction */
+    .GetTimestampUs       = Main_Hw_GetTick,
 };
 
 /** Pedal SWC configuration */
@@ -262,12 +317,34 @@ static const WdgM_SupervisedEntityConfigType wdgm_se_config[] = {
     { 2u, 1u, 1u, 3u },   /* SE 2: Swc_EStop         */
     { 3u, 1u, 3u, 3u },   /* SE 3: Swc_Heartbeat     — 1-3 checkpoints per 100ms WdgM cycle */
     { 4u, 1u, 1u, 5u },   /* SE 4: Swc_Dashboard     — more tolerant (QM) */
+    { CVC_WDGM_SE_TORQUE_CHAIN, 0u, 0u, 3u },  /* SE 5: Pedal -> VehicleState, no alive */
+};
+
+/** Torque request written by Swc_Pedal must be read by VehicleState in time */
+static const WdgM_DeadlineConfigType wdgm_deadline_config[] = {
+    { CVC_WDGM_SE_TORQUE_CHAIN, CVC_WDGM_CP_TORQUE_WRITTEN, CVC_WDGM_CP_TORQUE_CONSUMED,
+      0u, CVC_WDGM_TORQUE_CHAIN_MAX_US },
+};
+
+/** Pedal and VehicleState alternate; VehicleState may run again on the
+ *  EStop data event, also before the first pedal cycle */
+static const WdgM_TransitionConfigType wdgm_transition_config[] = {
+    { CVC_WDGM_SE_TORQUE_CHAIN, WDGM_CHECKPOINT_NONE,        CVC_WDGM_CP_TORQUE_WRITTEN  },
+    { CVC_WDGM_SE_TORQUE_CHAIN, WDGM_CHECKPOINT_NONE,        CVC_WDGM_CP_TORQUE_CONSUMED },
+    { CVC_WDGM_SE_TORQUE_CHAIN, CVC_WDGM_CP_TORQUE_WRITTEN,  CVC_WDGM_CP_TORQUE_CONSUMED },
+    { CVC_WDGM_SE_TORQUE_CHAIN, CVC_WDGM_CP_TORQUE_CONSUMED, CVC_WDGM_CP_TORQUE_WRITTEN  },
+    { CVC_WDGM_SE_TORQUE_CHAIN, CVC_WDGM_CP_TORQUE_CONSUMED, CVC_WDGM_CP_TORQUE_CONSUMED },
 };
 
 static const WdgM_ConfigType wdgm_config = {
     .seConfig      = wdgm_se_config,
     .seCount       = (uint8)(sizeof(wdgm_se_config) / sizeof(wdgm_se_config[0])),
     .wdtDioChannel = 6u,
+    .deadlineConfig   = wdgm_deadline_config,
+    .deadlineCount    = (uint8)(sizeof(wdgm_deadline_config) / sizeof(wdgm_deadline_config[0])),
+    .transitionConfig = wdgm_transition_config,
+    .transitionCount  = (uint8)(sizeof(wdgm_transition_config) / sizeof(wdgm_transition_config[0])),
+    .getTimestampUs = Main_Hw_GetTick,  /* Deadlines and violation timestamps (us) */
 };
 
 /* ==================================================================
@@ -298,11 +375,83 @@ static const BswM_ModeActionType bswm_actions[] = {
     { BSWM_SHUTDOWN,  BswM_Action_Shutdown  },
 };
 
+/* Runnables and TX I-PDU groups per mode. Runnable bits follow the rows
+ * of cvc_runnable_config (Rte_Cfg_Cvc.c). Pedal keeps running in every
+ * mode: its zero torque request is what 0x100/0x101 carry in SAFE_STOP. */
+#define CVC_RTE_ALL          0x03FFu                /* 10 runnables       */
+#define CVC_RTE_DASHBOARD    ((uint16)1u << 6u)     /* QM display         */
+
+static const BswM_ModeControlType bswm_mode_controls[BSWM_MODE_COUNT] = {
+    [BSWM_STARTUP]   = { CVC_RTE_ALL,                                CVC_COM_IPDU_GROUP_BODY },
+    [BSWM_RUN]       = { CVC_RTE_ALL,                                CVC_COM_IPDU_GROUP_BODY },
+    [BSWM_DEGRADED]  = { CVC_RTE_ALL,                                0u },
+    [BSWM_SAFE_STOP] = { CVC_RTE_ALL,                                0u },
+    [BSWM_SHUTDOWN]  = { (uint16)(CVC_RTE_ALL & ~CVC_RTE_DASHBOARD), 0u },
+};
+
 static const BswM_ConfigType bswm_config = {
     .ModeActions = bswm_actions,
     .ActionCount = (uint8)(sizeof(bswm_actions) / sizeof(bswm_actions[0])),
+    .ModeSwitchNotification = Rte_SwitchMode,   /* RTE mode-switch events */
+    .ModeControls     = bswm_mode_controls,
+    .RunnableControl  = Rte_SetRunnableMask,
+    .IpduGroupControl = Com_IpduGroupControl,
+};
+
+/* ==================================================================
+ * Dem Configuration
+ * ================================================================== */
+
+/* Freeze frame captured when a DTC is confirmed (UDS 0x19 04) */
+static const Dem_FreezeFrameSignalType dem_ff_signals[] = {
+    { CVC_SIG_VEHICLE_STATE,  0xF010u },   /* Vehicle state   */
+    { CVC_SIG_PEDAL_POSITION, 0xF011u },   /* Pedal position  */
+    { CVC_SIG_TORQUE_REQUEST, 0xF013u },   /* Torque request  */
+    { CVC_SIG_MOTOR_SPEED,    0xF017u },   /* Motor speed     */
+    { CVC_SIG_MOTOR_CURRENT,  0xF018u },   /* Motor current   */
+    { CVC_SIG_FAULT_MASK,     0xF019u },   /* Fault mask      */
+};
+
+static const Dem_ConfigType dem_config = {
+    .FreezeFrameSignals     = dem_ff_signals,
+    .FreezeFrameSignalCount = (uint8)(sizeof(dem_ff_signals) / sizeof(dem_ff_signals[0])),
+    .GetTimestampMs         = NULL_PTR,
+    .NvmWriteIntervalMs     = DEM_NVM_WRITE_INTERVAL_MS,
+    .GetFreezeFrameTimeMs   = StbM_GetTimeMs,
 };
 
+/* ==================================================================
+ * NvM Memory Stack Configuration (STM32: Fls + Fee)
+ * ================================================================== */
+
+#ifdef PLATFORM_STM32
+/* Last 32 KB of bank 2 (dual-bank mode, 2 KB pages), kept out of the
+ * linker FLASH region. Code runs from bank 1 while bank 2 is erased. */
+static const Fls_ConfigType fls_config = {
+    .baseAddress    = 0x08078000u,
+    .totalSize      = 0x8000u,
+    .pageSize       = 0x800u,
+    .maxWriteDwords = 16u,
+};
+
+/* Four 8 KB virtual pages: records are appended to one, swaps rotate */
+static const Fls_AddressType fee_pages[] = {
+    0x08078000u, 0x0807A000u, 0x0807C000u, 0x0807E000u,
+};
+
+static const Fee_BlockConfigType fee_blocks[] = {
+    { DEM_NVM_BLOCK_ID, DEM_NVM_BLOCK_SIZE },
+};
+
+static const Fee_ConfigType fee_config = {
+    .pageAddress = fee_pages,
+    .numPages    = (uint8)(sizeof(fee_pages) / sizeof(fee_pages[0])),
+    .pageSize    = 0x2000u,
+    .blocks      = fee_blocks,
+    .numBlocks   = (uint8)(sizeof(fee_blocks) / sizeof(fee_blocks[0])),
+};
+#endif
+
 /* ==================================================================
  * Self-Test Sequence (SWR-CVC-029)
  * ================================================================== */
@@ -354,6 +503,215 @@ static uint8 Main_RunSelfTest(void)
     return CVC_SELF_TEST_PASS;
 }
 
+/* ==================================================================
+ * Task Bodies
+ * STM32: Os tasks, 1ms and 10ms on one level (CAN RX, CanTp, Dcm and
+ *        the other 10ms modules never preempt each other), both
+ *        preempt 100ms.
+ * POSIX: called in turn from the main loop.
+ * ================================================================== */
+
+/**
+ * @brief  1ms task: RTE scheduler (dispatches runnables internally)
+ */
+static void Main_Task1ms(void)
+{
+    Rte_MainFunction();
+}
+
+/**
+ * @brief  10ms tasks: StbM, CanTSyn, CanTp, Dcm, BswM, Com->RTE bridge,
+ *         CAN TX schedule
+ */
+static void Main_Task10ms(void)
+{
+    StbM_MainFunction();
+    CanTSyn_MainFunction();
+    CanTp_MainFunction();
+    Dcm_MainFunction();
+    BswM_MainFunction();
+    Swc_CvcCom_BridgeRxToRte();
+    Swc_CvcCom_TransmitSchedule(Main_Hw_GetTick() / 1000u);
+}
+
+/**
+ * @brief  100ms tasks: WdgM, Dem (DTC broadcast), NvM (flush writes)
+ */
+static void Main_Task100ms(void)
+{
+    WdgM_MainFunction();
+    Dem_MainFunction();
+    NvM_MainFunction();
+}
+
+#ifdef PLATFORM_STM32
+/* ==================================================================
+ * Os Configuration — 1ms and 10ms on level 1, 100ms on level 0
+ *
+ * Can_MainFunction_Read (1ms Rte table) delivers RX indications through
+ * PduR into CanTp, Dcm and CanTSyn, whose main functions run in the
+ * 10ms task, and the SWC runnables share BswM and Det with it. Those
+ * modules have no exclusive areas, so both tasks run on one level: the
+ * 1ms task first when both are due, neither preempts the other. Only
+ * the 100ms task (Dem + NvM write) is preempted. Modules shared with
+ * it (Dem, WdgM, Can, Rte, StbM, Det) have exclusive areas.
+ * ================================================================== */
+
+#define CVC_OS_TASK_1MS      0u
+#define CVC_OS_TASK_10MS     1u
+#define CVC_OS_TASK_100MS    2u
+#define CVC_OS_TASK_COUNT    3u
+
+/* Level stacks in words: deepest task of the level plus device ISRs */
+#define CVC_OS_STACK_1MS     512u    /* 2 KB: Rte runnables, 10ms    */
+#define CVC_OS_STACK_100MS   512u    /* 2 KB: Dem + NvM              */
+
+static uint32 os_stack_1ms[CVC_OS_STACK_1MS];
+static uint32 os_stack_100ms[CVC_OS_STACK_100MS];
+
+static const Os_LevelConfigType os_levels[] = {
+    { os_stack_100ms, CVC_OS_STACK_100MS },  /* level 0: PendSV */
+    { os_stack_1ms,   CVC_OS_STACK_1MS   },  /* level 1         */
+};
+
+/* Offsets keep the 10ms and 100ms activations off the same tick. On
+ * level 1 the 1ms task is listed first, so it runs before the 10ms task
+ * on their common ticks; the 10ms task must finish well within 1ms. */
+static const Os_TaskConfigType os_tasks[CVC_OS_TASK_COUNT] = {
+    { Main_Task1ms,     1u, 0u, 1u },
+    { Main_Task10ms,   10u, 1u, 1u },
+    { Main_Task100ms, 100u, 2u, 0u },
+};
+
+static const Os_ConfigType os_config = {
+    .tasks      = os_tasks,
+    .taskCount  = CVC_OS_TASK_COUNT,
+    .levels     = os_levels,
+    .levelCount = (uint8)(sizeof(os_levels) / sizeof(os_levels[0])),
+};
+
+/* Exclusive areas: each BSW area is used from more than one task level, so
+ * it masks the Os levels only; FDCAN, DMA and SysTick keep running. The Os
+ * area is also entered from SysTick (Os_Tick), the Tmr, Spi and Adc areas
+ * from the timer, SPI DMA and ADC DMA interrupts, the Det area from all of
+ * them (all interrupts masked). */
+#define CVC_SCHM_CEIL_TASKS  14u    /* NVIC priority of Os level 1  */
+#define CVC_SCHM_CEIL_TICK   4u     /* SysTick (Os_Hw_STM32.c)      */
+
+static const SchM_AreaConfigType schm_areas[SCHM_AREA_COUNT] = {
+    { SCHM_LOCK_BASEPRI, CVC_SCHM_CEIL_TASKS },  /* Com  */
+    { SCHM_LOCK_BASEPRI, CVC_SCHM_CEIL_TASKS },  /* Rte  */
+    { SCHM_LOCK_BASEPRI, CVC_SCHM_CEIL_TASKS },  /* Dem  */
+    { SCHM_LOCK_BASEPRI, CVC_SCHM_CEIL_TASKS },  /* WdgM */
+    { SCHM_LOCK_BASEPRI, CVC_SCHM_CEIL_TASKS },  /* Can  */
+    { SCHM_LOCK_BASEPRI, CVC_SCHM_CEIL_TICK  },  /* Os   */
+    { SCHM_LOCK_GLOBAL,  0u                  },  /* Tmr  */
+    { SCHM_LOCK_BASEPRI, CVC_SCHM_CEIL_TASKS },  /* StbM */
+    { SCHM_LOCK_GLOBAL,  0u                  },  /* Spi  */
+    { SCHM_LOCK_GLOBAL,  0u                  },  /* Adc  */
+    { SCHM_LOCK_GLOBAL,  0u                  },  /* Det  */
+};
+
+static const SchM_ConfigType schm_config = {
+    .areas     = schm_areas,
+    .areaCount = SCHM_AREA_COUNT,
+};
+
+#ifdef OS_LATENCY_MEASUREMENT
+#define CVC_CPU_MHZ          170u
+#define CVC_STATS_10MS_CYCLES  500u    /* 10ms cycles per 5s print */
+
+/**
+ * @brief  Print max activation latency (us) and overruns of each task,
+ *         the stack high-water mark (bytes) of each level, and the
+ *         interrupt-masked sections and time per 10ms cycle, and the
+ *         longest hold (us) of each exclusive area
+ */
+static void Main_PrintOsStats(void)
+{
+    Os_TaskStatsType stats;
+    SchM_IrqOffStatsType irq_off;
+    SchM_AreaStatsType area;
+    uint8 id;
+
+    Dbg_Uart_Print("  Os lat/ovr:");
+    for (id = 0u; id < CVC_OS_TASK_COUNT; id++)
+    {
+        if (Os_GetTaskStats(id, &stats) == E_OK)
+        {
+            Dbg_Uart_Print(" ");
+            Dbg_PrintU32(stats.latencyMax / CVC_CPU_MHZ);
+            Dbg_Uart_Print("us/");
+            Dbg_PrintU32(stats.overruns);
+        }
+    }
+    Dbg_Uart_Print(" stack:");
+    for (id = 0u; id < os_config.levelCount; id++)
+    {
+        Dbg_Uart_Print(" ");
+        Dbg_PrintU32((uint32)Os_GetStackUsage(id));
+    }
+
+    SchM_GetIrqOffStats(&irq_off);
+    SchM_ResetIrqOffStats();
+    Dbg_Uart_Print(" irqoff/10ms:");
+    Dbg_PrintU32(irq_off.sections / CVC_STATS_10MS_CYCLES);
+    Dbg_Uart_Print("x ");
+    Dbg_PrintU32((irq_off.cycles / CVC_STATS_10MS_CYCLES) / CVC_CPU_MHZ);
+    Dbg_Uart_Print("us max ");
+    Dbg_PrintU32(irq_off.maxCycles / CVC_CPU_MHZ);
+    Dbg_Uart_Print("us area max:");
+    for (id = 0u; id < SCHM_AREA_COUNT; id++)
+    {
+        if (SchM_GetAreaStats(id, &area) == E_OK)
+        {
+            Dbg_Uart_Print(" ");
+            Dbg_PrintU32(area.maxCycles / CVC_CPU_MHZ);
+        }
+    }
+    SchM_ResetAreaStats();
+    Dbg_Uart_Print("us\r\n");
+}
+#endif /* OS_LATENCY_MEASUREMENT */
+
+/**
+ * @brief  Print the WdgM violations logged since the last print (newest
+ *         first): SE, kind (0 alive, 1 deadline, 2 logical), checkpoint,
+ *         value and time (ms)
+ */
+static void Main_PrintWdgMViolations(void)
+{
+    static uint16 printed = 0u;
+    uint16 count = WdgM_GetViolationCount();
+    WdgM_ViolationType v;
+    uint8 i;
+
+    if (count == printed)
+    {
+        return;
+    }
+
+    Dbg_Uart_Print("  WdgM viol:");
+    Dbg_PrintU32((uint32)count);
+    for (i = 0u; (i < (uint16)(count - printed)) &&
+                 (WdgM_GetViolation(i, &v) == E_OK); i++)
+    {
+        Dbg_Uart_Print(" SE");
+        Dbg_PrintU32((uint32)v.SEId);
+        Dbg_Uart_Print("/");
+        Dbg_PrintU32((uint32)v.kind);
+        Dbg_Uart_Print("/");
+        Dbg_PrintU32((uint32)v.checkpoint);
+        Dbg_Uart_Print("/");
+        Dbg_PrintU32(v.value);
+        Dbg_Uart_Print("@");
+        Dbg_PrintU32(v.timestampUs / 1000u);
+    }
+    Dbg_Uart_Print("\r\n");
+    printed = count;
+}
+#endif /* PLATFORM_STM32 */
+
 /* ==================================================================
  * Tick Counters
  * ================================================================== */
@@ -372,10 +730,11 @@ static volatile uint32 tick_us;
  */
 int main(void)
 {
+#ifndef PLATFORM_STM32
     uint32 last_1ms_us   = 0u;
     uint32 last_10ms_us  = 0u;
     uint32 last_100ms_us = 0u;
-#ifdef PLATFORM_STM32
+#else
     uint32 last_5s_us    = 0u;
 #endif
     uint8  self_test_result;
@@ -389,10 +748,17 @@ int main(void)
     DBG_LOG("CAN: FDCAN1 init OK\r\n");
     CanIf_Init(&canif_config);
     PduR_Init(&cvc_pdur_config);
+    StbM_Init(&stbm_config);
+    CanTSyn_Init(&cantsyn_config);
     CanTp_Init(&cantp_config);
     Com_Init(&cvc_com_config);
     E2E_Init();
-    Dem_Init(NULL_PTR);
+#ifdef PLATFORM_STM32
+    Fls_Init(&fls_config);
+    Fee_Init(&fee_config);
+#endif
+    NvM_Init();
+    Dem_Init(&dem_config);
     Dem_SetEcuId(0x10u);                    /* CVC ECU ID for DTC broadcasts */
     Dem_SetBroadcastPduId(CVC_COM_TX_DTC);  /* CanIf TX for CAN 0x500 */
     WdgM_Init(&wdgm_config);
@@ -404,7 +770,7 @@ int main(void)
     Dio_Init();
     IoHwAb_Init(&iohwab_config);
     Rte_Init(&cvc_rte_config);
-    DBG_LOG("BSW init: 17 modules OK\r\n");
+    DBG_LOG("BSW init: 19 modules OK\r\n");
 
     /* ---- Step 3: SWC initialization ---- */
     (void)Ssd1306_Init();
@@ -440,6 +806,16 @@ int main(void)
 
     /* ---- Step 7: Start SysTick (1ms period = 1000us) ---- */
     Main_Hw_SysTickInit(1000u);
+#ifdef PLATFORM_STM32
+    /* Os tick runs from SysTick; from here on the tasks preempt main */
+    SchM_Init(&schm_config);
+    Os_Init(&os_config);
+#ifdef OS_LATENCY_MEASUREMENT
+    Os_SetLatencyMeasurement(TRUE);
+#endif
+    Os_Start();
+    DBG_LOG("Os: 1ms/10ms/100ms tasks started\r\n");
+#endif
     DBG_LOG("SysTick: 1ms — entering main loop\r\n");
 
     /* ---- Step 8: Main loop ---- */
@@ -449,32 +825,27 @@ int main(void)
 
         tick_us = Main_Hw_GetTick();
 
-        /* 1ms task: RTE scheduler (dispatches runnables internally)
+#ifndef PLATFORM_STM32
+        /* POSIX: run the task bodies in turn
          * Main_Hw_GetTick() returns microseconds; 1ms = 1000us */
         if ((tick_us - last_1ms_us) >= 1000u)
         {
             last_1ms_us = tick_us;
-            Rte_MainFunction();
+            Main_Task1ms();
         }
 
-        /* 10ms tasks: CanTp, Dcm, BswM, Com->RTE bridge, CAN TX schedule */
         if ((tick_us - last_10ms_us) >= 10000u)
         {
             last_10ms_us = tick_us;
-            CanTp_MainFunction();
-            Dcm_MainFunction();
-            BswM_MainFunction();
-            Swc_CvcCom_BridgeRxToRte();
-            Swc_CvcCom_TransmitSchedule(tick_us / 1000u);
+            Main_Task10ms();
         }
 
-        /* 100ms tasks: WdgM, Dem (DTC broadcast) */
         if ((tick_us - last_100ms_us) >= 100000u)
         {
             last_100ms_us = tick_us;
-            WdgM_MainFunction();
-            Dem_MainFunction();
+            Main_Task100ms();
         }
+#endif
 
 #ifdef PLATFORM_STM32
         /* 5s debug task: CAN communication status print */
@@ -522,6 +893,10 @@ int main(void)
             Dbg_Uart_Print(" h12=");
             Dbg_PrintU32(g_can_rx_012_count);
             Dbg_Uart_Print("\r\n");
+            Main_PrintWdgMViolations();
+#ifdef OS_LATENCY_MEASUREMENT
+            Main_PrintOsStats();
+#endif
         }
 #endif
     }
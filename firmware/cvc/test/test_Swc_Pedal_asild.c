@@ -10,7 +10,8 @@
  * stuck detection, fault latching, torque mapping with ramp limiting,
  * and vehicle-state-dependent mode limits.
  *
- * Mocks: IoHwAb_ReadPedalAngle, Rte_Write, Rte_Read, Dem_ReportErrorStatus
+ * Mocks: IoHwAb_ReadPedalAngle, Rte_Write, Rte_Read, Dem_ReportErrorStatus,
+ *        WdgM_ReportCheckpoint
  */
 #include "unity.h"
 
@@ -77,6 +78,12 @@ typedef uint8           Std_ReturnType;
 #define DEM_EVENT_STATUS_PASSED    0u
 #define DEM_EVENT_STATUS_FAILED    1u
 
+/* WdgM torque chain supervision (from Cvc_Cfg.h) */
+typedef uint8 WdgM_SupervisedEntityIdType;
+typedef uint8 WdgM_CheckpointIdType;
+#define CVC_WDGM_SE_TORQUE_CHAIN       5u
+#define CVC_WDGM_CP_TORQUE_WRITTEN     0u
+
 /* ==================================================================
  * Swc_Pedal Config Type (mirrors header)
  * ================================================================== */
@@ -188,6 +195,25 @@ void Dem_ReportErrorStatus(uint8 EventId, uint8 EventStatus)
     }
 }
 
+/* ==================================================================
+ * Mock: WdgM_ReportCheckpoint
+ * ================================================================== */
+
+static uint8   mock_wdgm_cp_count;
+static uint8   mock_wdgm_last_se;
+static uint8   mock_wdgm_last_cp;
+static uint32  mock_wdgm_torque_at_cp;  /* Torque signal when the checkpoint came */
+
+Std_ReturnType WdgM_ReportCheckpoint(WdgM_SupervisedEntityIdType SEId,
+                                     WdgM_CheckpointIdType CheckpointId)
+{
+    mock_wdgm_cp_count++;
+    mock_wdgm_last_se      = SEId;
+    mock_wdgm_last_cp      = CheckpointId;
+    mock_wdgm_torque_at_cp = mock_rte_signals[CVC_SIG_TORQUE_REQUEST];
+    return E_OK;
+}
+
 /* ==================================================================
  * Mock: Com_SendSignal — variable declarations (function at bottom)
  * ================================================================== */
@@ -220,6 +246,12 @@ void setUp(void)
         mock_rte_signals[i] = 0u;
     }
 
+    /* Reset WdgM mock */
+    mock_wdgm_cp_count     = 0u;
+    mock_wdgm_last_se      = 0xFFu;
+    mock_wdgm_last_cp      = 0xFFu;
+    mock_wdgm_torque_at_cp = 0xFFFFFFFFu;
+
     /* Reset Com mock */
     mock_com_last_signal_id = 0u;
     mock_com_send_count     = 0u;
@@ -895,6 +927,36 @@ void test_Mode_limit_unknown_state_defaults_zero(void)
     TEST_ASSERT_EQUAL_UINT32(0u, torque);
 }
 
+/* ==================================================================
+ * SWR-BSW-020: WdgM torque chain (Pedal -> VehicleState)
+ * ================================================================== */
+
+/** @verifies SWR-BSW-020
+ *  The deadline starts once the torque request is in the RTE */
+void test_WdgM_checkpoint_after_torque_written(void)
+{
+    mock_vehicle_state = CVC_STATE_RUN;
+    run_cycles(8192u, 8192u, 10u);
+
+    TEST_ASSERT_EQUAL_UINT8(10u, mock_wdgm_cp_count);
+    TEST_ASSERT_EQUAL_UINT8(CVC_WDGM_SE_TORQUE_CHAIN, mock_wdgm_last_se);
+    TEST_ASSERT_EQUAL_UINT8(CVC_WDGM_CP_TORQUE_WRITTEN, mock_wdgm_last_cp);
+    TEST_ASSERT_EQUAL_UINT32(mock_rte_signals[CVC_SIG_TORQUE_REQUEST],
+                             mock_wdgm_torque_at_cp);
+    TEST_ASSERT_TRUE(mock_wdgm_torque_at_cp > 0u);
+}
+
+/** @verifies SWR-BSW-020
+ *  A sensor fault (zero torque) still publishes and reports the checkpoint */
+void test_WdgM_checkpoint_every_cycle_also_on_fault(void)
+{
+    mock_iohwab_result_s0 = E_NOT_OK;
+    run_cycles(8192u, 8192u, 3u);
+
+    TEST_ASSERT_EQUAL_UINT8(3u, mock_wdgm_cp_count);
+    TEST_ASSERT_EQUAL_UINT32(0u, mock_wdgm_torque_at_cp);
+}
+
 /* ==================================================================
  * Test runner
  * ================================================================== */
@@ -971,6 +1033,10 @@ int main(void)
     RUN_TEST(test_Torque_zero_in_init);
     RUN_TEST(test_Mode_limit_unknown_state_defaults_zero);
 
+    /* SWR-BSW-020: WdgM torque chain checkpoint */
+    RUN_TEST(test_WdgM_checkpoint_after_torque_written);
+    RUN_TEST(test_WdgM_checkpoint_every_cycle_also_on_fault);
+
     return UNITY_END();
 }
 
@@ -999,5 +1065,6 @@ Std_ReturnType Com_SendSignal(uint16 SignalId, const void* SignalDataPtr)
 #define RTE_H
 #define DEM_H
 #define COM_H
+#define WDGM_H
 
 #include "../src/Swc_Pedal.c"
@@ -219,6 +219,28 @@ Std_ReturnType Com_SendSignal(uint16 SignalId, const void* SignalDataPtr)
     return E_OK;
 }
 
+/* ==================================================================
+ * Mock: WdgM_ReportCheckpoint (end of the Pedal -> VehicleState chain)
+ * ================================================================== */
+
+typedef uint8 WdgM_SupervisedEntityIdType;
+typedef uint8 WdgM_CheckpointIdType;
+#define CVC_WDGM_SE_TORQUE_CHAIN       5u
+#define CVC_WDGM_CP_TORQUE_CONSUMED    1u
+
+static uint8   mock_wdgm_cp_count;
+static uint8   mock_wdgm_last_se;
+static uint8   mock_wdgm_last_cp;
+
+Std_ReturnType WdgM_ReportCheckpoint(WdgM_SupervisedEntityIdType SEId,
+                                     WdgM_CheckpointIdType CheckpointId)
+{
+    mock_wdgm_cp_count++;
+    mock_wdgm_last_se = SEId;
+    mock_wdgm_last_cp = CheckpointId;
+    return E_OK;
+}
+
 /* ==================================================================
  * Mock: Com_ReceiveSignal (confirmation read from Com shadow buffer)
  * ================================================================== */
@@ -301,6 +323,11 @@ void setUp(void)
     mock_com_last_signal_id = 0u;
     mock_com_send_count     = 0u;
 
+    /* Clear WdgM mock */
+    mock_wdgm_cp_count = 0u;
+    mock_wdgm_last_se  = 0xFFu;
+    mock_wdgm_last_cp  = 0xFFu;
+
     /* Clear Com receive mock (confirmation reads) */
     for (i = 0u; i < 32u; i++)
     {
@@ -911,6 +938,21 @@ void test_MainFunction_rte_read_failure_no_crash(void)
     TEST_ASSERT_EQUAL_UINT8(CVC_STATE_INIT, Swc_VehicleState_GetState());
 }
 
+/* ------------------------------------------------------------------
+ * SWR-BSW-020: WdgM torque chain checkpoint, every cycle
+ * ------------------------------------------------------------------ */
+
+/** @verifies SWR-BSW-020 */
+void test_MainFunction_reports_torque_chain_checkpoint(void)
+{
+    Swc_VehicleState_MainFunction();
+    Swc_VehicleState_MainFunction();
+
+    TEST_ASSERT_EQUAL_UINT8(2u, mock_wdgm_cp_count);
+    TEST_ASSERT_EQUAL_UINT8(CVC_WDGM_SE_TORQUE_CHAIN, mock_wdgm_last_se);
+    TEST_ASSERT_EQUAL_UINT8(CVC_WDGM_CP_TORQUE_CONSUMED, mock_wdgm_last_cp);
+}
+
 /* ------------------------------------------------------------------
  * SWR-CVC-010: Dual CAN timeout from RUN goes to SAFE_STOP
  * ------------------------------------------------------------------ */
@@ -1495,6 +1537,7 @@ int main(void)
 
     /* SWR-CVC-010: RTE failure and dual CAN timeout */
     RUN_TEST(test_MainFunction_rte_read_failure_no_crash);
+    RUN_TEST(test_MainFunction_reports_torque_chain_checkpoint);
     RUN_TEST(test_RUN_to_SAFE_STOP_on_dual_CAN_timeout);
 
     /* SWR-CVC-010/011: Subsystem fault state transitions */
@@ -1541,5 +1584,6 @@ int main(void)
 #define BSWM_H
 #define DEM_H
 #define COM_H
+#define WDGM_H
 
 #include "../src/Swc_VehicleState.c"
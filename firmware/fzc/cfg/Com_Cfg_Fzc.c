@@ -10,6 +10,7 @@
  * @copyright Taktflow Systems 2026
  */
 #include "Com.h"
+#include "StbM.h"
 #include "Fzc_Cfg.h"
 
 /* ==================================================================
@@ -90,6 +91,12 @@ static const Com_TxPduConfigType fzc_tx_pdu_config[] = {
 
 #define FZC_COM_TX_PDU_COUNT  (sizeof(fzc_tx_pdu_config) / sizeof(fzc_tx_pdu_config[0]))
 
+/* I-PDU groups of the TX PDUs (fzc_tx_pdu_config order), 0: none */
+static const Com_IpduGroupVector fzc_tx_pdu_groups[FZC_COM_TX_PDU_COUNT] = {
+    0u, 0u, 0u, 0u, 0u,
+    FZC_COM_IPDU_GROUP_LIDAR,   /* FZC_COM_TX_LIDAR */
+};
+
 /* ==================================================================
  * RX PDU Configuration Table
  * ================================================================== */
@@ -116,4 +123,6 @@ const Com_ConfigType fzc_com_config = {
     .txPduCount   = (uint8)FZC_COM_TX_PDU_COUNT,
     .rxPduConfig  = fzc_rx_pdu_config,
     .rxPduCount   = (uint8)FZC_COM_RX_PDU_COUNT,
+    .txPduGroups  = fzc_tx_pdu_groups,
+    .getRxTimeUs  = StbM_GetTimeUs,
 };
@@ -10,6 +10,7 @@
  * @copyright Taktflow Systems 2026
  */
 #include "Dcm.h"
+#include "Rte.h"
 #include "Fzc_Cfg.h"
 
 /* ==================================================================
@@ -208,6 +209,13 @@ static const Dcm_DidTableType fzc_did_table[] = {
     { 0xF022u, Dcm_ReadDid_BrakePos,      1u },   /* Brake Position         */
     { 0xF023u, Dcm_ReadDid_LidarDist,     2u },   /* Lidar Distance         */
     { 0xF024u, Dcm_ReadDid_LidarZone,     1u },   /* Lidar Zone             */
+#if defined(RTE_PROFILING)
+    /* Runnable execution times, 15 runnables (Rte_Cfg_Fzc.c) */
+    { 0xF0F0u, Rte_ReadProfileSummary,
+      RTE_PROF_SUMMARY_LENGTH(15u) },         /* Runnable times min/mean/max */
+    { 0xF0F1u, Rte_ReadProfileHistogram,
+      RTE_PROF_HISTOGRAM_LENGTH(15u) },       /* Runnable time histograms    */
+#endif
 };
 
 #define FZC_DCM_DID_COUNT  (sizeof(fzc_did_table) / sizeof(fzc_did_table[0]))
@@ -30,6 +30,7 @@ extern void Swc_FzcSensorFeeder_MainFunction(void);
 extern void Swc_FzcSafety_MainFunction(void);
 extern void Swc_FzcCanMonitor_Check(void);
 extern void Swc_FzcCom_TransmitSchedule(void);
+extern void IoHwAb_MainFunction(void);
 
 /* ==================================================================
  * Signal Configuration Table
@@ -80,28 +81,44 @@ static const Rte_SignalConfigType fzc_signal_config[FZC_SIG_COUNT] = {
 /* ==================================================================
  * Runnable Configuration Table
  * Priority: higher number = executes first within same period
+ * offsetMs: the 10 ms chain is spread over the 10 ticks of its period in
+ *           dispatch order (RX -> SWCs -> TX), so the 1 ms CAN read never
+ *           shares a tick with the whole chain
  * ================================================================== */
 
 static const Rte_RunnableConfigType fzc_runnable_config[] = {
-    /* func,                           periodMs, priority, seId */
-    { Can_MainFunction_Read,              10u,      14u,    0xFFu },  /* CAN RX first           */
-    { Com_MainFunction_Rx,                10u,      13u,    0xFFu },  /* COM RX deadline monitor */
-    { Swc_FzcCom_Receive,                 10u,      12u,    0xFFu },  /* Com→RTE bridge         */
-    { Swc_FzcSensorFeeder_MainFunction,   10u,      11u,    0xFFu },  /* Virtual sensor → MCAL  */
-    { Swc_Steering_MainFunction,          10u,      10u,    0u    },  /* Steering highest SWC   */
-    { Swc_Brake_MainFunction,             10u,       9u,    1u    },  /* Brake control          */
-    { Swc_Lidar_MainFunction,             10u,       8u,    2u    },  /* Lidar processing       */
-    { Swc_Heartbeat_MainFunction,         10u,       7u,    3u    },  /* Heartbeat TX           */
-    { Swc_FzcSafety_MainFunction,         10u,       6u,    4u    },  /* Safety monitor + WDG   */
-    { Swc_Buzzer_MainFunction,            10u,       5u,    5u    },  /* Buzzer                 */
-    { Swc_FzcCanMonitor_Check,            10u,       4u,    0xFFu },  /* CAN bus loss detection */
-    { Swc_FzcCom_TransmitSchedule,        10u,       3u,    0xFFu },  /* Fault/lidar TX schedule*/
-    { Com_MainFunction_Tx,                10u,       2u,    0xFFu },  /* COM TX (after all SWCs)*/
-    { Can_MainFunction_BusOff,            10u,       1u,    0xFFu },  /* Bus-off check          */
+    /* func,                           periodMs, priority, seId,  offsetMs */
+    { Can_MainFunction_Read,              10u,      14u,    0xFFu,  0u },  /* CAN RX first           */
+    { Com_MainFunction_Rx,                10u,      13u,    0xFFu,  0u },  /* COM RX deadline monitor */
+    { Swc_FzcCom_Receive,                 10u,      12u,    0xFFu,  1u },  /* Com→RTE bridge         */
+    { Swc_FzcSensorFeeder_MainFunction,   10u,      11u,    0xFFu,  1u },  /* Virtual sensor → MCAL  */
+    { Swc_Steering_MainFunction,          10u,      10u,    0u,     2u },  /* Steering highest SWC   */
+    { Swc_Brake_MainFunction,             10u,       9u,    1u,     3u },  /* Brake control          */
+    { Swc_Lidar_MainFunction,             10u,       8u,    2u,     4u },  /* Lidar processing       */
+    { Swc_Heartbeat_MainFunction,         10u,       7u,    3u,     5u },  /* Heartbeat TX           */
+    { Swc_FzcSafety_MainFunction,         10u,       6u,    4u,     6u },  /* Safety monitor + WDG   */
+    { Swc_Buzzer_MainFunction,            10u,       5u,    5u,     7u },  /* Buzzer                 */
+    { Swc_FzcCanMonitor_Check,            10u,       4u,    0xFFu,  7u },  /* CAN bus loss detection */
+    { Swc_FzcCom_TransmitSchedule,        10u,       3u,    0xFFu,  8u },  /* Fault/lidar TX schedule*/
+    { Com_MainFunction_Tx,                10u,       2u,    0xFFu,  9u },  /* COM TX (after all SWCs)*/
+    { Can_MainFunction_BusOff,            10u,       1u,    0xFFu,  9u },  /* Bus-off check          */
+    { IoHwAb_MainFunction,                10u,      11u,    0xFFu,  1u },  /* Start steering SPI read */
 };
 
 #define FZC_RUNNABLE_COUNT  (sizeof(fzc_runnable_config) / sizeof(fzc_runnable_config[0]))
 
+/* ==================================================================
+ * Event Triggers — run a runnable at the next dispatch point on top of
+ * its period (runnable = index in the table above)
+ * ================================================================== */
+
+static const Rte_EventConfigType fzc_event_config[] = {
+    /* runnable, kind,                   source */
+    { 5u,   RTE_EVENT_DATA_CHANGED,   FZC_SIG_ESTOP_ACTIVE },  /* Brake: E-stop in the RX tick */
+};
+
+#define FZC_EVENT_COUNT  (sizeof(fzc_event_config) / sizeof(fzc_event_config[0]))
+
 /* ==================================================================
  * Aggregate RTE Configuration
  * ================================================================== */
@@ -111,4 +128,6 @@ const Rte_ConfigType fzc_rte_config = {
     .signalCount    = FZC_SIG_COUNT,
     .runnableConfig = fzc_runnable_config,
     .runnableCount  = (uint8)FZC_RUNNABLE_COUNT,
+    .eventConfig    = fzc_event_config,
+    .eventCount     = (uint8)FZC_EVENT_COUNT,
 };
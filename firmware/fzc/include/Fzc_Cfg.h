@@ -55,6 +55,10 @@
 #define FZC_COM_TX_LIDAR           5u   /* CAN 0x220 */
 #define FZC_COM_TX_DTC_BROADCAST   6u   /* CAN 0x500 — DTC broadcast */
 
+/* Com TX I-PDU groups (bit masks). Safety, heartbeat and diagnostic PDUs
+ * are in no group and always transmitted. */
+#define FZC_COM_IPDU_GROUP_LIDAR   0x01u  /* Lidar obstacle warnings   */
+
 /* ====================================================================
  * Com TX Signal IDs (index into Com signal config table)
  * NOTE: These are SIGNAL IDs, not PDU IDs. Com_SendSignal() takes a
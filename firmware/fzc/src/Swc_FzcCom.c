@@ -368,7 +368,8 @@ void Swc_FzcCom_TransmitSchedule(void)
         (void)PduR_Transmit(FZC_COM_TX_MOTOR_CUTOFF, &pdu_info);
     }
 
-    /* ---- TX: 0x220 Lidar Warning (event-driven, PduR_Transmit) ---- */
+    /* ---- TX: 0x220 Lidar Warning (event-driven, PduR_Transmit) ----
+     * Held back while its I-PDU group is stopped (BswM, SAFE_STOP). */
     (void)Rte_Read(FZC_SIG_LIDAR_ZONE, &rteVal);
     /* Only broadcast obstacle warnings (WARNING/BRAKING/EMERGENCY),
      * NOT sensor FAULT — FAULT means invalid data, not an obstacle. */
@@ -376,7 +377,8 @@ void Swc_FzcCom_TransmitSchedule(void)
         && (rteVal <= (uint32)FZC_LIDAR_ZONE_EMERGENCY)) {
         FzcCom_TxPendLidarWarn = TRUE;
     }
-    if (FzcCom_TxPendLidarWarn == TRUE) {
+    if ((FzcCom_TxPendLidarWarn == TRUE) &&
+        (Com_IsTxPduStarted(FZC_COM_TX_LIDAR) == TRUE)) {
         for (i = 0u; i < 8u; i++) {
             txBuf[i] = 0u;
         }
@@ -35,12 +35,24 @@
 #include "CanIf.h"
 #include "Com.h"
 #include "PduR.h"
+#include "StbM.h"
+#include "CanTSyn.h"
 #include "E2E.h"
 #include "Dem.h"
+#include "NvM.h"
+#ifdef PLATFORM_STM32
+#include "Fls.h"
+#include "Fee.h"
+#include "Swc_FzcNvm.h"
+#endif
 #include "WdgM.h"
 #include "BswM.h"
 #include "Dcm.h"
 #include "Rte.h"
+#ifdef PLATFORM_STM32
+#include "Os.h"
+#include "SchM.h"
+#endif
 #include "IoHwAb.h"
 #include "Spi.h"
 #include "Uart.h"
@@ -153,6 +165,7 @@ static const CanIf_RxPduConfigType canif_rx_config[] = {
     { 0x102u, FZC_COM_RX_STEER_CMD,        8u, FALSE },  /* Steering command   */
     { 0x103u, FZC_COM_RX_BRAKE_CMD,        8u, FALSE },  /* Brake command      */
     { 0x600u, FZC_COM_RX_VIRT_SENSORS,     8u, FALSE },  /* Virtual sensors (SIL) */
+    { 0x008u, 0xFDu,                       8u, FALSE },  /* Time SYNC/FUP      */
 };
 
 static const CanIf_ConfigType canif_config = {
@@ -170,6 +183,7 @@ static const PduR_RoutingTableType fzc_pdur_routing[] = {
     { FZC_COM_RX_STEER_CMD,      PDUR_DEST_COM, FZC_COM_RX_STEER_CMD      },
     { FZC_COM_RX_BRAKE_CMD,      PDUR_DEST_COM, FZC_COM_RX_BRAKE_CMD      },
     { FZC_COM_RX_VIRT_SENSORS,   PDUR_DEST_COM, FZC_COM_RX_VIRT_SENSORS   },
+    { 0xFDu,                     PDUR_DEST_CANTSYN, 0u                    },
 };
 
 static const PduR_ConfigType fzc_pdur_config = {
@@ -177,6 +191,39 @@ static const PduR_ConfigType fzc_pdur_config = {
     .routingCount = (uint8)(sizeof(fzc_pdur_routing) / sizeof(fzc_pdur_routing[0])),
 };
 
+/** StbM: time slave of the CVC's global time (CanTSyn, CAN 0x008) */
+static const StbM_ConfigType stbm_config = {
+    .role                = STBM_ROLE_SLAVE,
+    .getLocalTimeUs      = Main_Hw_GetTick,
+    .syncLossTimeoutUs   = 500000u,     /* 5 missed SYNCs            */
+    .jumpThresholdUs     = 10000u,      /* Larger offsets: time leap */
+    .offsetCorrectionUs  = 100000u,     /* Slew over one SYNC period */
+    .rateMeasureUs       = 1000000u,
+    .maxRateDeviationPpm = 500u,
+};
+
+/** CanTSyn: slave of time domain 0 */
+static const CanTSyn_ConfigType cantsyn_config = {
+    .role         = CANTSYN_ROLE_SLAVE,
+    .timeDomain   = 0u,
+    .txPduId      = 0u,
+    .syncPeriodMs = 0u,
+    .mainPeriodMs = 10u,
+    .fupTimeoutMs = 50u,
+};
+
+/** SPI job and sequence — steering angle, read asynchronously every 10 ms */
+static const Spi_JobConfigType spi_jobs[] = {
+    { .channel = 0u, .csChannel = 0u },  /* Job 0: steering sensor */
+};
+
+static const uint8 spi_seq_steering_jobs[] = { 0u };
+
+static const Spi_SequenceConfigType spi_sequences[] = {
+    { .jobs = spi_seq_steering_jobs, .numJobs = 1u,
+      .notification = IoHwAb_AngleReadNotification },  /* Seq 0: steering */
+};
+
 /** SPI driver configuration — AS5048A steering angle sensor */
 static const Spi_ConfigType spi_config = {
     .clockSpeed   = 1000000u,   /* 1 MHz SPI clock              */
@@ -184,6 +231,10 @@ static const Spi_ConfigType spi_config = {
     .cpha         = 1u,         /* Sample on trailing edge       */
     .dataWidth    = 16u,        /* 16-bit transfers              */
     .numChannels  = 1u,         /* Ch 0: steering                */
+    .jobs         = spi_jobs,
+    .numJobs      = 1u,
+    .sequences    = spi_sequences,
+    .numSequences = 1u,
 };
 
 /** ADC group configuration — brake position feedback */
@@ -211,6 +262,10 @@ static const IoHwAb_ConfigType iohwab_config = {
     .EStopDioChannel      = 2u,
     .BuzzerDioChannel     = 8u,   /* PB8 buzzer output             */
     .WdiDioChannel        = 0u,   /* PB0 TPS3823 WDI pin           */
+    .AngleAsyncSensors    = IOHWAB_ANGLE_STEERING,
+    .AngleSpiSequence     = 0u,
+    .AngleMaxAgeUs        = 15000u,  /* 1.5 cycles of IoHwAb_MainFunction */
+    .GetTimestampUs       = Main_Hw_GetTick,
 };
 
 /** UART configuration for TFMini-S lidar (115200 baud, 8N1) */
@@ -268,6 +323,7 @@ static const WdgM_ConfigType wdgm_config = {
     .seConfig      = wdgm_se_config,
     .seCount       = (uint8)(sizeof(wdgm_se_config) / sizeof(wdgm_se_config[0])),
     .wdtDioChannel = 0u,   /* PB0 — TPS3823 WDI (also driven by Swc_FzcSafety) */
+    .getTimestampUs = Main_Hw_GetTick,  /* Violation timestamps (us) */
 };
 
 /* ==================================================================
@@ -295,11 +351,85 @@ static const BswM_ModeActionType bswm_actions[] = {
     { BSWM_SHUTDOWN,  BswM_Action_Shutdown  },
 };
 
+/* Runnables and TX I-PDU groups per mode. Runnable bits follow the rows
+ * of fzc_runnable_config (Rte_Cfg_Fzc.c). Lidar output only matters while
+ * driving: from SAFE_STOP on it is neither computed nor transmitted. */
+#define FZC_RTE_ALL          0x7FFFu                /* 15 runnables       */
+#define FZC_RTE_LIDAR        ((uint16)1u << 6u)
+
+static const BswM_ModeControlType bswm_mode_controls[BSWM_MODE_COUNT] = {
+    [BSWM_STARTUP]   = { FZC_RTE_ALL,                            FZC_COM_IPDU_GROUP_LIDAR },
+    [BSWM_RUN]       = { FZC_RTE_ALL,                            FZC_COM_IPDU_GROUP_LIDAR },
+    [BSWM_DEGRADED]  = { FZC_RTE_ALL,                            FZC_COM_IPDU_GROUP_LIDAR },
+    [BSWM_SAFE_STOP] = { (uint16)(FZC_RTE_ALL & ~FZC_RTE_LIDAR), 0u },
+    [BSWM_SHUTDOWN]  = { (uint16)(FZC_RTE_ALL & ~FZC_RTE_LIDAR), 0u },
+};
+
 static const BswM_ConfigType bswm_config = {
     .ModeActions = bswm_actions,
     .ActionCount = (uint8)(sizeof(bswm_actions) / sizeof(bswm_actions[0])),
+    .ModeSwitchNotification = Rte_SwitchMode,   /* RTE mode-switch events */
+    .ModeControls     = bswm_mode_controls,
+    .RunnableControl  = Rte_SetRunnableMask,
+    .IpduGroupControl = Com_IpduGroupControl,
+};
+
+/* ==================================================================
+ * Dem Configuration
+ * ================================================================== */
+
+/* Freeze frame captured when a DTC is confirmed (UDS 0x19 04) */
+static const Dem_FreezeFrameSignalType dem_ff_signals[] = {
+    { FZC_SIG_VEHICLE_STATE,  0xF025u },   /* Vehicle state    */
+    { FZC_SIG_STEER_CMD,      0xF026u },   /* Steering command */
+    { FZC_SIG_STEER_ANGLE,    0xF020u },   /* Steering angle   */
+    { FZC_SIG_BRAKE_POS,      0xF021u },   /* Brake position   */
+    { FZC_SIG_LIDAR_DIST,     0xF022u },   /* Lidar distance   */
+    { FZC_SIG_FAULT_MASK,     0xF027u },   /* Fault mask       */
+};
+
+static const Dem_ConfigType dem_config = {
+    .FreezeFrameSignals     = dem_ff_signals,
+    .FreezeFrameSignalCount = (uint8)(sizeof(dem_ff_signals) / sizeof(dem_ff_signals[0])),
+    .GetTimestampMs         = NULL_PTR,
+    .NvmWriteIntervalMs     = DEM_NVM_WRITE_INTERVAL_MS,
+    .GetFreezeFrameTimeMs   = StbM_GetTimeMs,
 };
 
+/* ==================================================================
+ * NvM Memory Stack Configuration (STM32: Fls + Fee)
+ * ================================================================== */
+
+#ifdef PLATFORM_STM32
+/* Last 32 KB of bank 2 (dual-bank mode, 2 KB pages), kept out of the
+ * linker FLASH region. Code runs from bank 1 while bank 2 is erased. */
+static const Fls_ConfigType fls_config = {
+    .baseAddress    = 0x08078000u,
+    .totalSize      = 0x8000u,
+    .pageSize       = 0x800u,
+    .maxWriteDwords = 16u,
+};
+
+/* Four 8 KB virtual pages: records are appended to one, swaps rotate */
+static const Fls_AddressType fee_pages[] = {
+    0x08078000u, 0x0807A000u, 0x0807C000u, 0x0807E000u,
+};
+
+static const Fee_BlockConfigType fee_blocks[] = {
+    { 0u, (uint16)(sizeof(Swc_FzcNvm_DtcRecord) * FZC_NVM_DTC_MAX_SLOTS) },  /* DTC slots */
+    { 1u, (uint16)sizeof(Swc_FzcNvm_CalData) },                              /* Calibration */
+    { DEM_NVM_BLOCK_ID, DEM_NVM_BLOCK_SIZE },
+};
+
+static const Fee_ConfigType fee_config = {
+    .pageAddress = fee_pages,
+    .numPages    = (uint8)(sizeof(fee_pages) / sizeof(fee_pages[0])),
+    .pageSize    = 0x2000u,
+    .blocks      = fee_blocks,
+    .numBlocks   = (uint8)(sizeof(fee_blocks) / sizeof(fee_blocks[0])),
+};
+#endif
+
 /* ==================================================================
  * Self-Test Sequence (SWR-FZC-025)
  * ================================================================== */
@@ -363,6 +493,213 @@ static uint8 Main_RunSelfTest(void)
     return FZC_SELF_TEST_PASS;
 }
 
+/* ==================================================================
+ * Task Bodies
+ * STM32: Os tasks, 1ms and 10ms on one level (CAN RX, Dcm and
+ *        the other 10ms modules never preempt each other), both
+ *        preempt 100ms.
+ * POSIX: called in turn from the main loop.
+ * ================================================================== */
+
+/**
+ * @brief  1ms task: RTE scheduler (dispatches runnables internally)
+ */
+static void Main_Task1ms(void)
+{
+    Rte_MainFunction();
+}
+
+/**
+ * @brief  10ms tasks: StbM, CanTSyn, Dcm, BswM, UART timeout monitoring
+ */
+static void Main_Task10ms(void)
+{
+    StbM_MainFunction();
+    CanTSyn_MainFunction();
+    Dcm_MainFunction();
+    BswM_MainFunction();
+    Uart_MainFunction();
+}
+
+/**
+ * @brief  100ms tasks: WdgM, Dem (DTC broadcast), NvM (flush writes)
+ */
+static void Main_Task100ms(void)
+{
+    WdgM_MainFunction();
+    Dem_MainFunction();
+    NvM_MainFunction();
+}
+
+#ifdef PLATFORM_STM32
+/* ==================================================================
+ * Os Configuration — 1ms and 10ms on level 1, 100ms on level 0
+ *
+ * Can_MainFunction_Read (1ms Rte table) delivers RX indications through
+ * PduR into Dcm and CanTSyn, whose main functions run in the 10ms task,
+ * Swc_Lidar reads the Uart buffer of Uart_MainFunction, and the SWC
+ * runnables share BswM and Det with it. Those modules have no exclusive
+ * areas, so both tasks run on one level: the 1ms task first when both
+ * are due, neither preempts the other. Only the 100ms task (Dem + NvM
+ * write) is preempted. Modules shared with it (Dem, WdgM, Can, Rte,
+ * StbM, Det) have exclusive areas.
+ * ================================================================== */
+
+#define FZC_OS_TASK_1MS      0u
+#define FZC_OS_TASK_10MS     1u
+#define FZC_OS_TASK_100MS    2u
+#define FZC_OS_TASK_COUNT    3u
+
+/* Level stacks in words: deepest task of the level plus device ISRs */
+#define FZC_OS_STACK_1MS     512u    /* 2 KB: Rte runnables, 10ms    */
+#define FZC_OS_STACK_100MS   512u    /* 2 KB: Dem + NvM              */
+
+static uint32 os_stack_1ms[FZC_OS_STACK_1MS];
+static uint32 os_stack_100ms[FZC_OS_STACK_100MS];
+
+static const Os_LevelConfigType os_levels[] = {
+    { os_stack_100ms, FZC_OS_STACK_100MS },  /* level 0: PendSV */
+    { os_stack_1ms,   FZC_OS_STACK_1MS   },  /* level 1         */
+};
+
+/* Offsets keep the 10ms and 100ms activations off the same tick. On
+ * level 1 the 1ms task is listed first, so it runs before the 10ms task
+ * on their common ticks; the 10ms task must finish well within 1ms. */
+static const Os_TaskConfigType os_tasks[FZC_OS_TASK_COUNT] = {
+    { Main_Task1ms,     1u, 0u, 1u },
+    { Main_Task10ms,   10u, 1u, 1u },
+    { Main_Task100ms, 100u, 2u, 0u },
+};
+
+static const Os_ConfigType os_config = {
+    .tasks      = os_tasks,
+    .taskCount  = FZC_OS_TASK_COUNT,
+    .levels     = os_levels,
+    .levelCount = (uint8)(sizeof(os_levels) / sizeof(os_levels[0])),
+};
+
+/* Exclusive areas: each BSW area is used from more than one task level, so
+ * it masks the Os levels only; FDCAN, DMA and SysTick keep running. The Os
+ * area is also entered from SysTick (Os_Tick), the Tmr, Spi and Adc areas
+ * from the timer, SPI DMA and ADC DMA interrupts, the Det area from all of
+ * them (all interrupts masked). */
+#define FZC_SCHM_CEIL_TASKS  14u    /* NVIC priority of Os level 1  */
+#define FZC_SCHM_CEIL_TICK   4u     /* SysTick (Os_Hw_STM32.c)      */
+
+static const SchM_AreaConfigType schm_areas[SCHM_AREA_COUNT] = {
+    { SCHM_LOCK_BASEPRI, FZC_SCHM_CEIL_TASKS },  /* Com  */
+    { SCHM_LOCK_BASEPRI, FZC_SCHM_CEIL_TASKS },  /* Rte  */
+    { SCHM_LOCK_BASEPRI, FZC_SCHM_CEIL_TASKS },  /* Dem  */
+    { SCHM_LOCK_BASEPRI, FZC_SCHM_CEIL_TASKS },  /* WdgM */
+    { SCHM_LOCK_BASEPRI, FZC_SCHM_CEIL_TASKS },  /* Can  */
+    { SCHM_LOCK_BASEPRI, FZC_SCHM_CEIL_TICK  },  /* Os   */
+    { SCHM_LOCK_GLOBAL,  0u                  },  /* Tmr  */
+    { SCHM_LOCK_BASEPRI, FZC_SCHM_CEIL_TASKS },  /* StbM */
+    { SCHM_LOCK_GLOBAL,  0u                  },  /* Spi  */
+    { SCHM_LOCK_GLOBAL,  0u                  },  /* Adc  */
+    { SCHM_LOCK_GLOBAL,  0u                  },  /* Det  */
+};
+
+static const SchM_ConfigType schm_config = {
+    .areas     = schm_areas,
+    .areaCount = SCHM_AREA_COUNT,
+};
+
+#ifdef OS_LATENCY_MEASUREMENT
+#define FZC_CPU_MHZ          170u
+#define FZC_STATS_10MS_CYCLES  500u    /* 10ms cycles per 5s print */
+
+/**
+ * @brief  Print max activation latency (us) and overruns of each task,
+ *         the stack high-water mark (bytes) of each level, and the
+ *         interrupt-masked sections and time per 10ms cycle, and the
+ *         longest hold (us) of each exclusive area
+ */
+static void Main_PrintOsStats(void)
+{
+    Os_TaskStatsType stats;
+    SchM_IrqOffStatsType irq_off;
+    SchM_AreaStatsType area;
+    uint8 id;
+
+    Dbg_Uart_Print("  Os lat/ovr:");
+    for (id = 0u; id < FZC_OS_TASK_COUNT; id++)
+    {
+        if (Os_GetTaskStats(id, &stats) == E_OK)
+        {
+            Dbg_Uart_Print(" ");
+            Dbg_PrintU32(stats.latencyMax / FZC_CPU_MHZ);
+            Dbg_Uart_Print("us/");
+            Dbg_PrintU32(stats.overruns);
+        }
+    }
+    Dbg_Uart_Print(" stack:");
+    for (id = 0u; id < os_config.levelCount; id++)
+    {
+        Dbg_Uart_Print(" ");
+        Dbg_PrintU32((uint32)Os_GetStackUsage(id));
+    }
+
+    SchM_GetIrqOffStats(&irq_off);
+    SchM_ResetIrqOffStats();
+    Dbg_Uart_Print(" irqoff/10ms:");
+    Dbg_PrintU32(irq_off.sections / FZC_STATS_10MS_CYCLES);
+    Dbg_Uart_Print("x ");
+    Dbg_PrintU32((irq_off.cycles / FZC_STATS_10MS_CYCLES) / FZC_CPU_MHZ);
+    Dbg_Uart_Print("us max ");
+    Dbg_PrintU32(irq_off.maxCycles / FZC_CPU_MHZ);
+    Dbg_Uart_Print("us area max:");
+    for (id = 0u; id < SCHM_AREA_COUNT; id++)
+    {
+        if (SchM_GetAreaStats(id, &area) == E_OK)
+        {
+            Dbg_Uart_Print(" ");
+            Dbg_PrintU32(area.maxCycles / FZC_CPU_MHZ);
+        }
+    }
+    SchM_ResetAreaStats();
+    Dbg_Uart_Print("us\r\n");
+}
+#endif /* OS_LATENCY_MEASUREMENT */
+
+/**
+ * @brief  Print the WdgM violations logged since the last print (newest
+ *         first): SE, kind (0 alive, 1 deadline, 2 logical), checkpoint,
+ *         value and time (ms)
+ */
+static void Main_PrintWdgMViolations(void)
+{
+    static uint16 printed = 0u;
+    uint16 count = WdgM_GetViolationCount();
+    WdgM_ViolationType v;
+    uint8 i;
+
+    if (count == printed)
+    {
+        return;
+    }
+
+    Dbg_Uart_Print("  WdgM viol:");
+    Dbg_PrintU32((uint32)count);
+    for (i = 0u; (i < (uint16)(count - printed)) &&
+                 (WdgM_GetViolation(i, &v) == E_OK); i++)
+    {
+        Dbg_Uart_Print(" SE");
+        Dbg_PrintU32((uint32)v.SEId);
+        Dbg_Uart_Print("/");
+        Dbg_PrintU32((uint32)v.kind);
+        Dbg_Uart_Print("/");
+        Dbg_PrintU32((uint32)v.checkpoint);
+        Dbg_Uart_Print("/");
+        Dbg_PrintU32(v.value);
+        Dbg_Uart_Print("@");
+        Dbg_PrintU32(v.timestampUs / 1000u);
+    }
+    Dbg_Uart_Print("\r\n");
+    printed = count;
+}
+#endif /* PLATFORM_STM32 */
+
 /* ==================================================================
  * Tick Counters
  * ================================================================== */
@@ -381,10 +718,11 @@ static volatile uint32 tick_us;
  */
 int main(void)
 {
+#ifndef PLATFORM_STM32
     uint32 last_1ms_us   = 0u;
     uint32 last_10ms_us  = 0u;
     uint32 last_100ms_us = 0u;
-#ifdef PLATFORM_STM32
+#else
     uint32 last_5s_us    = 0u;
 #endif
     uint8  self_test_result;
@@ -398,9 +736,16 @@ int main(void)
     DBG_LOG("CAN: FDCAN1 init OK\r\n");
     CanIf_Init(&canif_config);
     PduR_Init(&fzc_pdur_config);
+    StbM_Init(&stbm_config);
+    CanTSyn_Init(&cantsyn_config);
     Com_Init(&fzc_com_config);
     E2E_Init();
-    Dem_Init(NULL_PTR);
+#ifdef PLATFORM_STM32
+    Fls_Init(&fls_config);
+    Fee_Init(&fee_config);
+#endif
+    NvM_Init();
+    Dem_Init(&dem_config);
     Dem_SetEcuId(FZC_ECU_ID);                              /* 0x02 — FZC ECU ID */
     Dem_SetBroadcastPduId(FZC_COM_TX_DTC_BROADCAST);       /* CanIf TX for 0x500 */
 
@@ -430,7 +775,7 @@ int main(void)
     IoHwAb_Init(&iohwab_config);
     Uart_Init(&uart_config);   /* UART for TFMini-S lidar */
     Rte_Init(&fzc_rte_config);
-    DBG_LOG("BSW init: 14 modules OK\r\n");
+    DBG_LOG("BSW init: 16 modules OK\r\n");
 
     /* ---- Step 3: SWC initialization ---- */
     Swc_Steering_Init(&steering_config);
@@ -462,6 +807,16 @@ int main(void)
 
     /* ---- Step 7: Start SysTick (1ms period = 1000us) ---- */
     Main_Hw_SysTickInit(1000u);
+#ifdef PLATFORM_STM32
+    /* Os tick runs from SysTick; from here on the tasks preempt main */
+    SchM_Init(&schm_config);
+    Os_Init(&os_config);
+#ifdef OS_LATENCY_MEASUREMENT
+    Os_SetLatencyMeasurement(TRUE);
+#endif
+    Os_Start();
+    DBG_LOG("Os: 1ms/10ms/100ms tasks started\r\n");
+#endif
     DBG_LOG("SysTick: 1ms — entering main loop\r\n");
 
     /* ---- Step 8: Main loop ---- */
@@ -471,30 +826,27 @@ int main(void)
 
         tick_us = Main_Hw_GetTick();
 
-        /* 1ms task: RTE scheduler (dispatches runnables internally)
+#ifndef PLATFORM_STM32
+        /* POSIX: run the task bodies in turn
          * Main_Hw_GetTick() returns microseconds; 1ms = 1000us */
         if ((tick_us - last_1ms_us) >= 1000u)
         {
             last_1ms_us = tick_us;
-            Rte_MainFunction();
+            Main_Task1ms();
         }
 
-        /* 10ms tasks: Dcm, BswM, UART timeout monitoring */
         if ((tick_us - last_10ms_us) >= 10000u)
         {
             last_10ms_us = tick_us;
-            Dcm_MainFunction();
-            BswM_MainFunction();
-            Uart_MainFunction();
+            Main_Task10ms();
         }
 
-        /* 100ms tasks: WdgM, Dem (DTC broadcast) */
         if ((tick_us - last_100ms_us) >= 100000u)
         {
             last_100ms_us = tick_us;
-            WdgM_MainFunction();
-            Dem_MainFunction();
+            Main_Task100ms();
         }
+#endif
 
 #ifdef PLATFORM_STM32
         /* 5s debug task: CAN communication status print */
@@ -533,6 +885,10 @@ int main(void)
             Dbg_Uart_Print(" REC=");
             Dbg_PrintU32((uint32)rec);
             Dbg_Uart_Print("\r\n");
+            Main_PrintWdgMViolations();
+#ifdef OS_LATENCY_MEASUREMENT
+            Main_PrintOsStats();
+#endif
         }
 #endif
     }
@@ -244,6 +244,18 @@ Std_ReturnType PduR_Transmit(PduIdType TxPduId, const PduInfoType* PduInfoPtr)
     return E_OK;
 }
 
+/* ==================================================================
+ * Mock: Com_IsTxPduStarted (I-PDU group state)
+ * ================================================================== */
+
+static uint8 mock_com_tx_started;
+
+uint8 Com_IsTxPduStarted(PduIdType TxPduId)
+{
+    (void)TxPduId;
+    return mock_com_tx_started;
+}
+
 /* ==================================================================
  * Test Configuration
  * ================================================================== */
@@ -273,6 +285,8 @@ void setUp(void)
         }
     }
 
+    mock_com_tx_started = TRUE;
+
     mock_pdur_tx_count    = 0u;
     mock_pdur_last_pdu_id = 0xFFu;
     for (i = 0u; i < MOCK_COM_MAX_PDUS; i++) {
@@ -519,6 +533,24 @@ void test_FzcCom_transmit_motor_cutoff_sent_when_inactive(void)
     TEST_ASSERT_EQUAL_UINT8(0u, mock_pdur_tx_pdu_data[FZC_COM_TX_MOTOR_CUTOFF][2]);
 }
 
+/** @verifies SWR-FZC-027
+ *  Equivalence class: lidar warning held back while its I-PDU group is
+ *  stopped (BswM SAFE_STOP), sent once the group runs */
+void test_FzcCom_transmit_lidar_warning_follows_ipdu_group(void)
+{
+    mock_rte_signals[FZC_SIG_LIDAR_ZONE] = FZC_LIDAR_ZONE_WARNING;
+
+    mock_com_tx_started = FALSE;
+    Swc_FzcCom_TransmitSchedule();
+    TEST_ASSERT_EQUAL_UINT8(FALSE, mock_pdur_tx_sent[FZC_COM_TX_LIDAR]);
+
+    mock_com_tx_started = TRUE;
+    Swc_FzcCom_TransmitSchedule();
+    TEST_ASSERT_EQUAL_UINT8(TRUE, mock_pdur_tx_sent[FZC_COM_TX_LIDAR]);
+    TEST_ASSERT_EQUAL_UINT8(FZC_LIDAR_ZONE_WARNING,
+                            mock_pdur_tx_pdu_data[FZC_COM_TX_LIDAR][2]);
+}
+
 /* ==================================================================
  * Test runner
  * ================================================================== */
@@ -549,6 +581,7 @@ int main(void)
     /* SWR-FZC-027: Cyclic fault TX — always send */
     RUN_TEST(test_FzcCom_transmit_brake_fault_sent_when_no_fault);
     RUN_TEST(test_FzcCom_transmit_motor_cutoff_sent_when_inactive);
+    RUN_TEST(test_FzcCom_transmit_lidar_warning_follows_ipdu_group);
 
     return UNITY_END();
 }
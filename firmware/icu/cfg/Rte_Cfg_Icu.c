@@ -72,14 +72,14 @@ static const Rte_SignalConfigType icu_signal_config[ICU_SIG_COUNT] = {
  * ================================================================== */
 
 static const Rte_RunnableConfigType icu_runnable_config[] = {
-    /* func,                    periodMs, priority, seId */
-    { Can_MainFunction_Read,       10u,      7u,     0xFFu },  /* CAN RX first            */
-    { Com_MainFunction_Rx,         10u,      6u,     0xFFu },  /* COM RX unpack           */
-    { Swc_Dashboard_50ms,          50u,      5u,     0u    },  /* Dashboard (20 Hz)       */
-    { Swc_DtcDisplay_50ms,         50u,      4u,     1u    },  /* DTC display (20 Hz)     */
-    { Icu_Heartbeat_500ms,         10u,      3u,     0xFFu },  /* ICU heartbeat (~500ms)  */
-    { Com_MainFunction_Tx,         10u,      2u,     0xFFu },  /* COM TX (after all SWCs) */
-    { Can_MainFunction_BusOff,     50u,      1u,     0xFFu },  /* Bus-off check           */
+    /* func,                    periodMs, priority, seId,  offsetMs */
+    { Can_MainFunction_Read,       10u,      7u,     0xFFu,  0u },  /* CAN RX first            */
+    { Com_MainFunction_Rx,         10u,      6u,     0xFFu,  0u },  /* COM RX unpack           */
+    { Swc_Dashboard_50ms,          50u,      5u,     0u,     0u },  /* Dashboard (20 Hz)       */
+    { Swc_DtcDisplay_50ms,         50u,      4u,     1u,     0u },  /* DTC display (20 Hz)     */
+    { Icu_Heartbeat_500ms,         10u,      3u,     0xFFu,  0u },  /* ICU heartbeat (~500ms)  */
+    { Com_MainFunction_Tx,         10u,      2u,     0xFFu,  0u },  /* COM TX (after all SWCs) */
+    { Can_MainFunction_BusOff,     50u,      1u,     0xFFu,  0u },  /* Bus-off check           */
 };
 
 #define ICU_RUNNABLE_COUNT  (sizeof(icu_runnable_config) / sizeof(icu_runnable_config[0]))
@@ -242,8 +242,8 @@ int main(void)
 
     /* ---- Step 6: Main loop — 50ms tick (20 Hz) ---- */
     while (running != 0) {
-        /* Sleep 50ms (50000 microseconds) */
-        Sil_Time_Sleep(50000u); /* 50ms virtual tick */
+        /* Wait for the next 50ms period (50000 microseconds) */
+        Sil_Time_WaitNextPeriod(50000u); /* 50ms virtual tick */
 
         /* Process received CAN frames */
         Can_MainFunction_Read();
@@ -23,6 +23,7 @@
 typedef unsigned char  uint8;
 typedef unsigned short uint16;
 typedef unsigned int  uint32;
+typedef signed short   sint16;
 typedef uint8          Std_ReturnType;
 typedef uint8          boolean;
 
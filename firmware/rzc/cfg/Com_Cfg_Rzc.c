@@ -10,6 +10,7 @@
  * @copyright Taktflow Systems 2026
  */
 #include "Com.h"
+#include "StbM.h"
 #include "Rzc_Cfg.h"
 
 /* ==================================================================
@@ -119,6 +120,12 @@ static const Com_TxPduConfigType rzc_tx_pdu_config[] = {
 
 #define RZC_COM_TX_PDU_COUNT  (sizeof(rzc_tx_pdu_config) / sizeof(rzc_tx_pdu_config[0]))
 
+/* I-PDU groups of the TX PDUs (rzc_tx_pdu_config order), 0: none */
+static const Com_IpduGroupVector rzc_tx_pdu_groups[RZC_COM_TX_PDU_COUNT] = {
+    0u, 0u, 0u, 0u,
+    RZC_COM_IPDU_GROUP_BATTERY, /* RZC_COM_TX_BATTERY_STATUS */
+};
+
 /* ==================================================================
  * RX PDU Configuration Table
  * ================================================================== */
@@ -143,4 +150,6 @@ const Com_ConfigType rzc_com_config = {
     .txPduCount   = (uint8)RZC_COM_TX_PDU_COUNT,
     .rxPduConfig  = rzc_rx_pdu_config,
     .rxPduCount   = (uint8)RZC_COM_RX_PDU_COUNT,
+    .txPduGroups  = rzc_tx_pdu_groups,
+    .getRxTimeUs  = StbM_GetTimeUs,
 };
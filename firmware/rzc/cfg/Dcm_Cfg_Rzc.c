@@ -10,6 +10,7 @@
  * @copyright Taktflow Systems 2026
  */
 #include "Dcm.h"
+#include "Rte.h"
 #include "Rzc_Cfg.h"
 
 /* ==================================================================
@@ -265,6 +266,13 @@ static const Dcm_DidTableType rzc_did_table[] = {
     { 0xF034u, Dcm_ReadDid_TorqueEcho,      1u },   /* Torque Echo %          */
     { 0xF035u, Dcm_ReadDid_Derating,        1u },   /* Derating %             */
     { 0xF036u, Dcm_ReadDid_AcsZeroOffset,   2u },   /* ACS Zero Offset        */
+#if defined(RTE_PROFILING)
+    /* Runnable execution times, 14 runnables (Rte_Cfg_Rzc.c) */
+    { 0xF0F0u, Rte_ReadProfileSummary,
+      RTE_PROF_SUMMARY_LENGTH(14u) },         /* Runnable times min/mean/max */
+    { 0xF0F1u, Rte_ReadProfileHistogram,
+      RTE_PROF_HISTOGRAM_LENGTH(14u) },       /* Runnable time histograms    */
+#endif
 };
 
 #define RZC_DCM_DID_COUNT  (sizeof(rzc_did_table) / sizeof(rzc_did_table[0]))
@@ -85,28 +85,43 @@ static const Rte_SignalConfigType rzc_signal_config[RZC_SIG_COUNT] = {
 /* ==================================================================
  * Runnable Configuration Table
  * Priority: higher number = executes first within same period
+ * offsetMs: the 10 ms chain is spread over the 10 ticks of its period in
+ *           dispatch order (RX -> SWCs -> TX), so the 1 ms CAN read never
+ *           shares a tick with the whole chain
  * ================================================================== */
 
 static const Rte_RunnableConfigType rzc_runnable_config[] = {
-    /* func,                              periodMs, priority, seId */
-    { Swc_CurrentMonitor_MainFunction,       1u,     11u,     0u    },  /* Current monitor (1kHz) */
-    { Swc_Motor_MainFunction,               10u,     10u,     1u    },  /* Motor control          */
-    { Swc_Encoder_MainFunction,             10u,     10u,     2u    },  /* Encoder processing     */
-    { Can_MainFunction_Read,                 1u,      9u,     0xFFu },  /* CAN RX (1ms: FIFO=3)   */
-    { Com_MainFunction_Rx,                  10u,      8u,     0xFFu },  /* COM RX deadline monitor */
-    { Swc_RzcCom_Receive,                   10u,      7u,     0xFFu },  /* Com→RTE bridge (after CAN RX) */
-    { Swc_RzcSensorFeeder_MainFunction,     10u,      6u,     0xFFu },  /* Virtual sensor inject (SIL) */
-    { Swc_RzcCom_TransmitSchedule,          10u,      5u,     0xFFu },  /* Motor/battery TX schedule */
-    { Com_MainFunction_Tx,                  10u,      4u,     0xFFu },  /* COM TX (after all SWCs) */
-    { Swc_TempMonitor_MainFunction,        100u,      4u,     3u    },  /* Temperature monitor    */
-    { Swc_Battery_MainFunction,            100u,      4u,     4u    },  /* Battery monitor        */
-    { Swc_Heartbeat_MainFunction,           50u,      3u,     5u    },  /* Heartbeat TX/RX        */
-    { Can_MainFunction_BusOff,              10u,      2u,     0xFFu },  /* Bus-off check          */
-    { Swc_RzcSafety_MainFunction,          100u,      2u,     6u    },  /* Safety / WatchdogFeed  */
+    /* func,                              periodMs, priority, seId,  offsetMs */
+    { Swc_CurrentMonitor_MainFunction,       1u,     11u,     0u,     0u },  /* Current monitor (1kHz) */
+    { Swc_Motor_MainFunction,               10u,     10u,     1u,     0u },  /* Motor control          */
+    { Swc_Encoder_MainFunction,             10u,     10u,     2u,     1u },  /* Encoder processing     */
+    { Can_MainFunction_Read,                 1u,      9u,     0xFFu,  0u },  /* CAN RX (1ms: FIFO=3)   */
+    { Com_MainFunction_Rx,                  10u,      8u,     0xFFu,  2u },  /* COM RX deadline monitor */
+    { Swc_RzcCom_Receive,                   10u,      7u,     0xFFu,  3u },  /* Com→RTE bridge (after CAN RX) */
+    { Swc_RzcSensorFeeder_MainFunction,     10u,      6u,     0xFFu,  4u },  /* Virtual sensor inject (SIL) */
+    { Swc_RzcCom_TransmitSchedule,          10u,      5u,     0xFFu,  5u },  /* Motor/battery TX schedule */
+    { Com_MainFunction_Tx,                  10u,      4u,     0xFFu,  6u },  /* COM TX (after all SWCs) */
+    { Swc_TempMonitor_MainFunction,        100u,      4u,     3u,     9u },  /* Temperature monitor    */
+    { Swc_Battery_MainFunction,            100u,      4u,     4u,    19u },  /* Battery monitor        */
+    { Swc_Heartbeat_MainFunction,           50u,      3u,     5u,     8u },  /* Heartbeat TX/RX        */
+    { Can_MainFunction_BusOff,              10u,      2u,     0xFFu,  7u },  /* Bus-off check          */
+    { Swc_RzcSafety_MainFunction,          100u,      2u,     6u,    29u },  /* Safety / WatchdogFeed  */
 };
 
 #define RZC_RUNNABLE_COUNT  (sizeof(rzc_runnable_config) / sizeof(rzc_runnable_config[0]))
 
+/* ==================================================================
+ * Event Triggers — run a runnable at the next dispatch point on top of
+ * its period (runnable = index in the table above)
+ * ================================================================== */
+
+static const Rte_EventConfigType rzc_event_config[] = {
+    /* runnable, kind,                   source */
+    { 1u,   RTE_EVENT_DATA_CHANGED,   RZC_SIG_ESTOP_ACTIVE },  /* Motor: cut-off 1 ms after RX */
+};
+
+#define RZC_EVENT_COUNT  (sizeof(rzc_event_config) / sizeof(rzc_event_config[0]))
+
 /* ==================================================================
  * Aggregate RTE Configuration
  * ================================================================== */
@@ -116,4 +131,6 @@ const Rte_ConfigType rzc_rte_config = {
     .signalCount    = RZC_SIG_COUNT,
     .runnableConfig = rzc_runnable_config,
     .runnableCount  = (uint8)RZC_RUNNABLE_COUNT,
+    .eventConfig    = rzc_event_config,
+    .eventCount     = (uint8)RZC_EVENT_COUNT,
 };
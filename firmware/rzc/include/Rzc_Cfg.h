@@ -60,6 +60,10 @@
 #define RZC_COM_TX_BATTERY_STATUS  4u   /* CAN 0x303 */
 #define RZC_COM_TX_DTC_BROADCAST   5u   /* CAN 0x500 — DTC broadcast */
 
+/* Com TX I-PDU groups (bit masks). Safety, heartbeat and diagnostic PDUs
+ * are in no group and always transmitted. */
+#define RZC_COM_IPDU_GROUP_BATTERY 0x01u  /* Battery status            */
+
 /* ====================================================================
  * Com RX PDU IDs
  * ==================================================================== */
@@ -149,10 +153,11 @@
 /** Overcurrent threshold in milliamps */
 #define RZC_CURRENT_OC_THRESH_MA  25000u
 
-/** Overcurrent debounce: 10ms at 1kHz = 10 consecutive samples */
+/** Overcurrent debounce: 10ms at 1kHz = 10 consecutive samples
+ *  (Dem fail threshold of RZC_DTC_OVERCURRENT) */
 #define RZC_CURRENT_OC_DEBOUNCE      10u
 
-/** Recovery time: 500ms below threshold */
+/** Recovery time: 500ms below threshold (Dem pass threshold, 1 sample/ms) */
 #define RZC_CURRENT_RECOVERY_MS     500u
 
 /** Zero-cal: 64 samples averaged at startup */
@@ -212,13 +217,15 @@
 /** Stall detection: PWM > 10% but zero speed for 500ms */
 #define RZC_ENCODER_STALL_TIMEOUT_MS 500u
 
-/** Stall check period: 10ms per check = 50 checks for 500ms */
+/** Stall check period: 10ms per check = 50 checks for 500ms
+ *  (Dem fail threshold of RZC_DTC_STALL) */
 #define RZC_ENCODER_STALL_CHECKS     50u
 
 /** Direction mismatch: commanded vs encoder for 50ms */
 #define RZC_ENCODER_DIR_MISMATCH_MS  50u
 
-/** Direction mismatch check count at 10ms period */
+/** Direction mismatch check count at 10ms period
+ *  (Dem fail threshold of RZC_DTC_DIRECTION) */
 #define RZC_ENCODER_DIR_CHECKS        5u
 
 /** Grace period after direction change (stall) */
@@ -260,6 +267,11 @@
 /** Moving average window */
 #define RZC_BATT_AVG_WINDOW           4u
 
+/** RZC_DTC_BATTERY time-based debounce (Dem): disable state must persist
+ *  this long to confirm, and be gone this long to heal */
+#define RZC_BATT_DTC_FAIL_MS        300u
+#define RZC_BATT_DTC_PASS_MS       1000u
+
 /** Battery status codes */
 #define RZC_BATT_STATUS_DISABLE_LOW   0u
 #define RZC_BATT_STATUS_WARN_LOW      1u
@@ -12,7 +12,7 @@
  *           3. Threshold-based status: DISABLE_LOW / WARN_LOW / NORMAL /
  *              WARN_HIGH / DISABLE_HIGH
  *           4. Hysteresis on recovery: +500mV from threshold to clear fault
- *           5. DTC reporting on DISABLE states
+ *           5. DTC reporting: FAILED in DISABLE states, PASSED otherwise
  *           6. CAN broadcast: [voltage_hi, voltage_lo, status, alive, 0,0,0,0]
  *           7. RTE signals: RZC_SIG_BATTERY_MV, RZC_SIG_BATTERY_STATUS
  *
@@ -176,11 +176,14 @@ void Swc_Battery_MainFunction(void)
     Batt_Status = Batt_DetermineStatus(avg_voltage, Batt_Status);
 
     /* ----------------------------------------------------------
-     * Step 3: Report DTC on DISABLE states
+     * Step 3: Report DTC on DISABLE states, PASSED otherwise so
+     *         Dem can heal it (time-based debounce in Dem)
      * ---------------------------------------------------------- */
     if ((Batt_Status == RZC_BATT_STATUS_DISABLE_LOW) ||
         (Batt_Status == RZC_BATT_STATUS_DISABLE_HIGH)) {
         Dem_ReportErrorStatus(RZC_DTC_BATTERY, DEM_EVENT_STATUS_FAILED);
+    } else {
+        Dem_ReportErrorStatus(RZC_DTC_BATTERY, DEM_EVENT_STATUS_PASSED);
     }
 
     /* ----------------------------------------------------------
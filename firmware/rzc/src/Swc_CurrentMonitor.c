@@ -11,9 +11,11 @@
  * @details  Implements the RZC motor current monitoring SWC (ASIL A):
  *           1. Init: zero-cal with 64 samples, validate within 2048+-200
  *           2. 1ms cyclic: read motor current via IoHwAb, 4-sample moving avg
- *           3. Overcurrent: >25A for 10 consecutive samples -> disable motor,
- *              report DTC, set RTE flag
- *           4. Recovery: 500ms below threshold clears overcurrent
+ *           3. Overcurrent: every sample is reported to Dem, which qualifies
+ *              >25A for 10 consecutive samples (RZC Dem debounce table)
+ *              -> disable motor, set RTE flag
+ *           4. Recovery: Dem heals after 500 consecutive samples below
+ *              threshold, which clears overcurrent
  *           5. CAN broadcast every 10ms: 8-byte payload with current, direction,
  *              enable, alive counter, CRC placeholder
  *
@@ -51,13 +53,9 @@ static uint16  CM_AvgBuffer[RZC_CURRENT_AVG_WINDOW];
 static uint8   CM_AvgIndex;
 static uint8   CM_AvgCount;
 
-/** Overcurrent detection */
-static uint8   CM_OcDebounceCount;
+/** Overcurrent detection (qualified by Dem) */
 static uint8   CM_OvercurrentActive;
 
-/** Recovery */
-static uint16  CM_RecoveryCycles;
-
 
 /* ==================================================================
  * Internal: Compute moving average
@@ -114,9 +112,7 @@ void Swc_CurrentMonitor_Init(void)
     CM_ZeroCalDone       = FALSE;
     CM_AvgIndex          = 0u;
     CM_AvgCount          = 0u;
-    CM_OcDebounceCount   = 0u;
     CM_OvercurrentActive = FALSE;
-    CM_RecoveryCycles    = 0u;
 
     for (i = 0u; i < RZC_CURRENT_AVG_WINDOW; i++) {
         CM_AvgBuffer[i] = 0u;
@@ -156,6 +152,8 @@ void Swc_CurrentMonitor_MainFunction(void)
 {
     uint16 raw_mA;
     uint16 avg_mA;
+    uint8  oc_sample;
+    uint8  debouncing;
 
     /* -------------------------------------------------------
      * Guard: not initialized -> return immediately (safe)
@@ -192,58 +190,42 @@ void Swc_CurrentMonitor_MainFunction(void)
 
     /* -------------------------------------------------------
      * Step 4: Overcurrent check
-     * If average > 25000mA, increment debounce counter.
-     * If counter >= 10 -> overcurrent condition.
+     * Average above 25000mA is an overcurrent sample. While
+     * overcurrent is active, a single raw reading above threshold
+     * also counts, so it restarts recovery even if the average
+     * remains below threshold.
      * ------------------------------------------------------- */
+    oc_sample = FALSE;
     if (avg_mA > RZC_CURRENT_OC_THRESH_MA) {
-        if (CM_OvercurrentActive == FALSE) {
-            CM_OcDebounceCount++;
-            if (CM_OcDebounceCount >= RZC_CURRENT_OC_DEBOUNCE) {
-                /* Overcurrent confirmed */
-                CM_OvercurrentActive = TRUE;
-                CM_RecoveryCycles    = 0u;
-
-                /* Disable motor: set R_EN and L_EN LOW */
-                CM_DisableMotor();
-
-                /* Report DTC */
-                Dem_ReportErrorStatus((uint8)RZC_DTC_OVERCURRENT,
-                                     DEM_EVENT_STATUS_FAILED);
-            }
-        } else {
-            /* Already in overcurrent — any spike resets recovery counter */
-            CM_RecoveryCycles = 0u;
-
-            /* Keep reporting to Dem so debounce counter reaches confirm
-             * threshold (DEM_DEBOUNCE_FAIL_THRESHOLD=3). */
-            Dem_ReportErrorStatus((uint8)RZC_DTC_OVERCURRENT,
-                                 DEM_EVENT_STATUS_FAILED);
-        }
+        oc_sample = TRUE;
+    } else if ((CM_OvercurrentActive == TRUE) &&
+               (raw_mA > RZC_CURRENT_OC_THRESH_MA)) {
+        oc_sample = TRUE;
     } else {
-        /* Current is below threshold */
+        /* Below threshold */
+    }
+
+    Dem_ReportErrorStatus((uint8)RZC_DTC_OVERCURRENT,
+                          (oc_sample == TRUE) ? DEM_EVENT_STATUS_FAILED
+                                              : DEM_EVENT_STATUS_PASSED);
+
+    /* -------------------------------------------------------
+     * Step 5: Qualified result from Dem
+     * Onset after RZC_CURRENT_OC_DEBOUNCE consecutive samples,
+     * recovery after RZC_CURRENT_RECOVERY_MS consecutive samples
+     * below threshold (counter-based, jump to zero).
+     * ------------------------------------------------------- */
+    debouncing = 0u;
+    (void)Dem_GetDebouncingOfEvent((uint8)RZC_DTC_OVERCURRENT, &debouncing);
+
+    if ((debouncing & DEM_DEBOUNCE_FINALLY_DEFECTIVE) != 0u) {
         if (CM_OvercurrentActive == FALSE) {
-            /* Normal operation — reset debounce counter */
-            CM_OcDebounceCount = 0u;
-        } else {
-            /* -------------------------------------------------------
-             * Step 5: Recovery logic
-             * If current < threshold while overcurrent is active,
-             * increment recovery counter. 500 consecutive cycles
-             * below threshold clears the overcurrent condition.
-             * A single raw reading above threshold resets recovery
-             * even if the average remains below threshold.
-             * ------------------------------------------------------- */
-            if (raw_mA > RZC_CURRENT_OC_THRESH_MA) {
-                CM_RecoveryCycles = 0u;
-            } else {
-                CM_RecoveryCycles++;
-                if (CM_RecoveryCycles >= RZC_CURRENT_RECOVERY_MS) {
-                    CM_OvercurrentActive = FALSE;
-                    CM_OcDebounceCount   = 0u;
-                    CM_RecoveryCycles    = 0u;
-                }
-            }
+            /* Overcurrent confirmed: set R_EN and L_EN LOW */
+            CM_OvercurrentActive = TRUE;
+            CM_DisableMotor();
         }
+    } else {
+        CM_OvercurrentActive = FALSE;
     }
 
     /* -------------------------------------------------------
@@ -10,12 +10,15 @@
  * @details  Implements the RZC encoder SWC:
  *           1. Reads quadrature encoder count and direction via IoHwAb
  *           2. Calculates RPM from delta counts per 10ms cycle
- *           3. Stall detection: PWM > 10% but zero encoder delta for
- *              50 consecutive cycles (500ms) triggers stall fault
+ *           3. Stall detection: PWM > 10% but zero encoder delta is
+ *              reported FAILED every cycle; Dem qualifies it after 50
+ *              consecutive cycles (500ms, RZC Dem debounce table)
  *           4. Direction plausibility: commanded vs encoder direction
- *              mismatch for 5 consecutive cycles (50ms) triggers fault
- *           5. Grace periods after direction change suppress false faults
- *           6. On fault: disables motor via Dio (R_EN/L_EN LOW), reports DTC
+ *              mismatch reported every cycle, qualified after 5 (50ms)
+ *           5. Grace periods after direction change suppress the checks
+ *              (no report — the Dem counter holds)
+ *           6. On qualified fault: latches it and disables the motor via
+ *              Dio (R_EN/L_EN LOW)
  *
  *           All variables are static file-scope. No dynamic memory.
  *
@@ -49,9 +52,7 @@ static uint32  Enc_PrevCount;
 static uint16  Enc_SpeedRpm;
 static uint8   Enc_Direction;
 static uint8   Enc_PrevDirection;
-static uint8   Enc_StallCounter;
 static uint8   Enc_StallFault;
-static uint8   Enc_DirMismatchCounter;
 static uint8   Enc_DirFault;
 static uint8   Enc_StallGraceCounter;
 static uint8   Enc_DirGraceCounter;
@@ -66,6 +67,22 @@ static void Enc_DisableMotor(void)
     Dio_WriteChannel(RZC_MOTOR_L_EN_CHANNEL, 0u);
 }
 
+/* ==================================================================
+ * Internal: Report a check result, TRUE once Dem qualified the fault
+ * ================================================================== */
+
+static uint8 Enc_ReportCheck(uint8 EventId, uint8 EventStatus)
+{
+    uint8 debouncing;
+
+    Dem_ReportErrorStatus(EventId, EventStatus);
+
+    debouncing = 0u;
+    (void)Dem_GetDebouncingOfEvent(EventId, &debouncing);
+
+    return ((debouncing & DEM_DEBOUNCE_FINALLY_DEFECTIVE) != 0u) ? TRUE : FALSE;
+}
+
 /* ==================================================================
  * API: Swc_Encoder_Init
  * ================================================================== */
@@ -76,9 +93,7 @@ void Swc_Encoder_Init(void)
     Enc_SpeedRpm           = 0u;
     Enc_Direction          = RZC_DIR_STOP;
     Enc_PrevDirection      = RZC_DIR_STOP;
-    Enc_StallCounter       = 0u;
     Enc_StallFault         = 0u;
-    Enc_DirMismatchCounter = 0u;
     Enc_DirFault           = 0u;
     Enc_StallGraceCounter  = 0u;
     Enc_DirGraceCounter    = 0u;
@@ -156,21 +171,17 @@ void Swc_Encoder_MainFunction(void)
             if ((torque_echo > (uint32)RZC_ENCODER_STALL_MIN_PWM) &&
                 (delta == 0u)) {
                 /* PWM active but no movement — possible stall */
-                Enc_StallCounter++;
-
-                if (Enc_StallCounter >= RZC_ENCODER_STALL_CHECKS) {
+                if (Enc_ReportCheck(RZC_DTC_STALL, DEM_EVENT_STATUS_FAILED) == TRUE) {
                     /* Stall confirmed */
                     Enc_StallFault = 1u;
                     Enc_DisableMotor();
-                    Dem_ReportErrorStatus(RZC_DTC_STALL,
-                                          DEM_EVENT_STATUS_FAILED);
                 }
             } else if (delta > 0u) {
-                /* Movement detected — reset stall counter */
-                Enc_StallCounter = 0u;
+                /* Movement detected — Dem restarts the stall count */
+                Dem_ReportErrorStatus(RZC_DTC_STALL, DEM_EVENT_STATUS_PASSED);
             } else {
                 /* No PWM demand and no movement — intentional stop.
-                 * Do not increment stall counter. */
+                 * No report: the stall count holds. */
             }
         }
     }
@@ -185,18 +196,14 @@ void Swc_Encoder_MainFunction(void)
                 ((uint8)commanded_dir != RZC_DIR_STOP) &&
                 (delta > 0u)) {
                 /* Motor is moving in wrong direction (commanded is active) */
-                Enc_DirMismatchCounter++;
-
-                if (Enc_DirMismatchCounter >= RZC_ENCODER_DIR_CHECKS) {
+                if (Enc_ReportCheck(RZC_DTC_DIRECTION, DEM_EVENT_STATUS_FAILED) == TRUE) {
                     /* Direction mismatch confirmed */
                     Enc_DirFault = 1u;
                     Enc_DisableMotor();
-                    Dem_ReportErrorStatus(RZC_DTC_DIRECTION,
-                                          DEM_EVENT_STATUS_FAILED);
                 }
             } else {
-                /* Directions match or motor is stopped — reset counter */
-                Enc_DirMismatchCounter = 0u;
+                /* Directions match or motor is stopped */
+                Dem_ReportErrorStatus(RZC_DTC_DIRECTION, DEM_EVENT_STATUS_PASSED);
             }
         }
     }
@@ -623,8 +623,10 @@ void Swc_RzcCom_TransmitSchedule(void)
         }
 
         /* --- 0x303 Battery Status: every 20 cycles (200ms) ---
-         * Offset by 7 cycles to avoid collision with motor_temp and heartbeat. */
-        if ((RzcCom_TxScheduleCycle % 20u) == 7u)
+         * Offset by 7 cycles to avoid collision with motor_temp and heartbeat.
+         * Not sent while its I-PDU group is stopped (BswM). */
+        if (((RzcCom_TxScheduleCycle % 20u) == 7u) &&
+            (Com_IsTxPduStarted(RZC_COM_TX_BATTERY_STATUS) == TRUE))
         {
             uint32 battery_mv     = 0u;
             uint32 battery_status = 0u;
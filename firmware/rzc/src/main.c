@@ -37,12 +37,23 @@
 #include "CanIf.h"
 #include "Com.h"
 #include "PduR.h"
+#include "StbM.h"
+#include "CanTSyn.h"
 #include "E2E.h"
 #include "Dem.h"
+#include "NvM.h"
+#ifdef PLATFORM_STM32
+#include "Fls.h"
+#include "Fee.h"
+#endif
 #include "WdgM.h"
 #include "BswM.h"
 #include "Dcm.h"
 #include "Rte.h"
+#ifdef PLATFORM_STM32
+#include "Os.h"
+#include "SchM.h"
+#endif
 #include "IoHwAb.h"
 
 /* ==================================================================
@@ -155,6 +166,7 @@ static const CanIf_RxPduConfigType canif_rx_config[] = {
     { 0x001u, RZC_COM_RX_ESTOP,           8u, FALSE },  /* E-stop broadcast     */
     { 0x100u, RZC_COM_RX_VEHICLE_TORQUE,  8u, FALSE },  /* Vehicle_State+Torque */
     { 0x601u, RZC_COM_RX_VIRT_SENSORS,   8u, FALSE },  /* Virtual sensors (SIL)*/
+    { 0x008u, 0xFDu,                     8u, FALSE },  /* Time SYNC/FUP        */
 };
 
 static const CanIf_ConfigType canif_config = {
@@ -170,6 +182,7 @@ static const PduR_RoutingTableType rzc_pdur_routing[] = {
     { RZC_COM_RX_ESTOP,          PDUR_DEST_COM, RZC_COM_RX_ESTOP          },
     { RZC_COM_RX_VEHICLE_TORQUE, PDUR_DEST_COM, RZC_COM_RX_VEHICLE_TORQUE },
     { RZC_COM_RX_VIRT_SENSORS,   PDUR_DEST_COM, RZC_COM_RX_VIRT_SENSORS   },
+    { 0xFDu,                     PDUR_DEST_CANTSYN, 0u                    },
 };
 
 static const PduR_ConfigType rzc_pdur_config = {
@@ -177,11 +190,41 @@ static const PduR_ConfigType rzc_pdur_config = {
     .routingCount = (uint8)(sizeof(rzc_pdur_routing) / sizeof(rzc_pdur_routing[0])),
 };
 
-/** ADC group configuration — motor current, motor temp, battery voltage */
+/** StbM: time slave of the CVC's global time (CanTSyn, CAN 0x008) */
+static const StbM_ConfigType stbm_config = {
+    .role                = STBM_ROLE_SLAVE,
+    .getLocalTimeUs      = Main_Hw_GetTick,
+    .syncLossTimeoutUs   = 500000u,     /* 5 missed SYNCs            */
+    .jumpThresholdUs     = 10000u,      /* Larger offsets: time leap */
+    .offsetCorrectionUs  = 100000u,     /* Slew over one SYNC period */
+    .rateMeasureUs       = 1000000u,
+    .maxRateDeviationPpm = 500u,
+};
+
+/** CanTSyn: slave of time domain 0 */
+static const CanTSyn_ConfigType cantsyn_config = {
+    .role         = CANTSYN_ROLE_SLAVE,
+    .timeDomain   = 0u,
+    .txPduId      = 0u,
+    .syncPeriodMs = 0u,
+    .mainPeriodMs = 10u,
+    .fupTimeoutMs = 50u,
+};
+
+/** ADC group configuration — motor current, motor temp, battery voltage.
+ *  Timer-paced scans into the DMA double buffer, 16x hardware oversampling.
+ *  Current is scanned every 1 ms for the 1 kHz current monitor; temperature
+ *  and voltage every 10 ms, ten times faster than their 100 ms monitors */
 static const Adc_GroupConfigType adc_groups[] = {
-    { .numChannels = 1u, .triggerSource = 0u },  /* Group 0: motor current */
-    { .numChannels = 1u, .triggerSource = 0u },  /* Group 1: motor temp    */
-    { .numChannels = 1u, .triggerSource = 0u },  /* Group 2: battery volt  */
+    { .numChannels = 1u, .triggerSource = ADC_TRIGGER_TIMER,
+      .conversionMode = ADC_CONV_MODE_CONTINUOUS, .oversamplingShift = 4u,
+      .scanPeriodUs = 1000u },                                             /* Group 0: motor current */
+    { .numChannels = 1u, .triggerSource = ADC_TRIGGER_TIMER,
+      .conversionMode = ADC_CONV_MODE_CONTINUOUS, .oversamplingShift = 4u,
+      .scanPeriodUs = 10000u },                                            /* Group 1: motor temp    */
+    { .numChannels = 1u, .triggerSource = ADC_TRIGGER_TIMER,
+      .conversionMode = ADC_CONV_MODE_CONTINUOUS, .oversamplingShift = 4u,
+      .scanPeriodUs = 10000u },                                            /* Group 2: battery volt  */
 };
 
 static const Adc_ConfigType adc_config = {
@@ -222,6 +265,7 @@ static const WdgM_ConfigType wdgm_config = {
     .seConfig      = wdgm_se_config,
     .seCount       = (uint8)(sizeof(wdgm_se_config) / sizeof(wdgm_se_config[0])),
     .wdtDioChannel = RZC_SAFETY_WDI_CHANNEL,  /* PB4 — TPS3823 WDI */
+    .getTimestampUs = Main_Hw_GetTick,  /* Violation timestamps (us) */
 };
 
 /* ==================================================================
@@ -249,11 +293,121 @@ static const BswM_ModeActionType bswm_actions[] = {
     { BSWM_SHUTDOWN,  BswM_Action_Shutdown  },
 };
 
+/* Runnables and TX I-PDU groups per mode. Runnable bits follow the rows
+ * of rzc_runnable_config (Rte_Cfg_Rzc.c). All runnables feed motor or
+ * power supervision and keep running; battery status TX stops with the
+ * motor (SAFE_STOP). */
+#define RZC_RTE_ALL          0x3FFFu                /* 14 runnables       */
+
+static const BswM_ModeControlType bswm_mode_controls[BSWM_MODE_COUNT] = {
+    [BSWM_STARTUP]   = { RZC_RTE_ALL, RZC_COM_IPDU_GROUP_BATTERY },
+    [BSWM_RUN]       = { RZC_RTE_ALL, RZC_COM_IPDU_GROUP_BATTERY },
+    [BSWM_DEGRADED]  = { RZC_RTE_ALL, RZC_COM_IPDU_GROUP_BATTERY },
+    [BSWM_SAFE_STOP] = { RZC_RTE_ALL, 0u },
+    [BSWM_SHUTDOWN]  = { RZC_RTE_ALL, 0u },
+};
+
 static const BswM_ConfigType bswm_config = {
     .ModeActions = bswm_actions,
     .ActionCount = (uint8)(sizeof(bswm_actions) / sizeof(bswm_actions[0])),
+    .ModeSwitchNotification = Rte_SwitchMode,   /* RTE mode-switch events */
+    .ModeControls     = bswm_mode_controls,
+    .RunnableControl  = Rte_SetRunnableMask,
+    .IpduGroupControl = Com_IpduGroupControl,
 };
 
+/* ==================================================================
+ * Dem Configuration
+ * ================================================================== */
+
+/* Freeze frame captured when a DTC is confirmed (UDS 0x19 04) */
+static const Dem_FreezeFrameSignalType dem_ff_signals[] = {
+    { RZC_SIG_VEHICLE_STATE,  0xF037u },   /* Vehicle state    */
+    { RZC_SIG_CURRENT_MA,     0xF030u },   /* Motor current    */
+    { RZC_SIG_TEMP1_DC,       0xF031u },   /* Motor temp       */
+    { RZC_SIG_MOTOR_SPEED,    0xF032u },   /* Motor speed      */
+    { RZC_SIG_BATTERY_MV,     0xF033u },   /* Battery voltage  */
+    { RZC_SIG_TORQUE_ECHO,    0xF034u },   /* Torque echo      */
+};
+
+/* Fault confirmation for the SWC monitors, which report every sample.
+ * Counters restart on a status change (consecutive samples):
+ * overcurrent at 1 ms, encoder checks at 10 ms. */
+static const Dem_DebounceConfigType dem_debounce[] = {
+    {
+        .EventId = RZC_DTC_OVERCURRENT, .DebounceClass = DEM_DEBOUNCE_COUNTER_BASED,
+        .IncStep = 1u, .DecStep = 1u, .JumpToZero = TRUE,
+        .FailThreshold = (sint16)RZC_CURRENT_OC_DEBOUNCE,
+        .PassThreshold = -(sint16)RZC_CURRENT_RECOVERY_MS,
+    },
+    {
+        .EventId = RZC_DTC_STALL, .DebounceClass = DEM_DEBOUNCE_COUNTER_BASED,
+        .IncStep = 1u, .DecStep = 1u, .JumpToZero = TRUE,
+        .FailThreshold = (sint16)RZC_ENCODER_STALL_CHECKS, .PassThreshold = 0,
+    },
+    {
+        .EventId = RZC_DTC_DIRECTION, .DebounceClass = DEM_DEBOUNCE_COUNTER_BASED,
+        .IncStep = 1u, .DecStep = 1u, .JumpToZero = TRUE,
+        .FailThreshold = (sint16)RZC_ENCODER_DIR_CHECKS, .PassThreshold = 0,
+    },
+    {
+        .EventId = RZC_DTC_BATTERY, .DebounceClass = DEM_DEBOUNCE_TIME_BASED,
+        .FailTimeMs = RZC_BATT_DTC_FAIL_MS, .PassTimeMs = RZC_BATT_DTC_PASS_MS,
+    },
+    {
+        /* Reported once by the zero-cal at init */
+        .EventId = RZC_DTC_ZERO_CAL, .DebounceClass = DEM_DEBOUNCE_MONITOR_INTERNAL,
+    },
+};
+
+/* Dem timestamp (freeze frames, time-based debounce) in ms */
+static uint32 Main_DemTimestampMs(void)
+{
+    return Main_Hw_GetTick() / 1000u;
+}
+
+static const Dem_ConfigType dem_config = {
+    .FreezeFrameSignals     = dem_ff_signals,
+    .FreezeFrameSignalCount = (uint8)(sizeof(dem_ff_signals) / sizeof(dem_ff_signals[0])),
+    .GetTimestampMs         = Main_DemTimestampMs,
+    .NvmWriteIntervalMs     = DEM_NVM_WRITE_INTERVAL_MS,
+    .DebounceTable          = dem_debounce,
+    .DebounceTableCount     = (uint8)(sizeof(dem_debounce) / sizeof(dem_debounce[0])),
+    .GetFreezeFrameTimeMs   = StbM_GetTimeMs,
+};
+
+/* ==================================================================
+ * NvM Memory Stack Configuration (STM32: Fls + Fee)
+ * ================================================================== */
+
+#ifdef PLATFORM_STM32
+/* Last 32 KB of bank 2 (dual-bank mode, 2 KB pages), kept out of the
+ * linker FLASH region. Code runs from bank 1 while bank 2 is erased. */
+static const Fls_ConfigType fls_config = {
+    .baseAddress    = 0x08078000u,
+    .totalSize      = 0x8000u,
+    .pageSize       = 0x800u,
+    .maxWriteDwords = 16u,
+};
+
+/* Four 8 KB virtual pages: records are appended to one, swaps rotate */
+static const Fls_AddressType fee_pages[] = {
+    0x08078000u, 0x0807A000u, 0x0807C000u, 0x0807E000u,
+};
+
+static const Fee_BlockConfigType fee_blocks[] = {
+    { DEM_NVM_BLOCK_ID, DEM_NVM_BLOCK_SIZE },
+};
+
+static const Fee_ConfigType fee_config = {
+    .pageAddress = fee_pages,
+    .numPages    = (uint8)(sizeof(fee_pages) / sizeof(fee_pages[0])),
+    .pageSize    = 0x2000u,
+    .blocks      = fee_blocks,
+    .numBlocks   = (uint8)(sizeof(fee_blocks) / sizeof(fee_blocks[0])),
+};
+#endif
+
 /* ==================================================================
  * Self-Test Sequence (SWR-RZC-025)
  * ================================================================== */
@@ -322,6 +476,211 @@ static uint8 Main_RunSelfTest(void)
     return RZC_SELF_TEST_PASS;
 }
 
+/* ==================================================================
+ * Task Bodies
+ * STM32: Os tasks, 1ms and 10ms on one level (CAN RX, Dcm and
+ *        the other 10ms modules never preempt each other), both
+ *        preempt 100ms.
+ * POSIX: called in turn from the main loop.
+ * ================================================================== */
+
+/**
+ * @brief  1ms task: RTE scheduler (dispatches runnables internally)
+ */
+static void Main_Task1ms(void)
+{
+    Rte_MainFunction();
+}
+
+/**
+ * @brief  10ms tasks: StbM, CanTSyn, Dcm, BswM
+ */
+static void Main_Task10ms(void)
+{
+    StbM_MainFunction();
+    CanTSyn_MainFunction();
+    Dcm_MainFunction();
+    BswM_MainFunction();
+}
+
+/**
+ * @brief  100ms tasks: WdgM, Dem (DTC broadcast), NvM (flush writes)
+ */
+static void Main_Task100ms(void)
+{
+    WdgM_MainFunction();
+    Dem_MainFunction();
+    NvM_MainFunction();
+}
+
+#ifdef PLATFORM_STM32
+/* ==================================================================
+ * Os Configuration — 1ms and 10ms on level 1, 100ms on level 0
+ *
+ * Can_MainFunction_Read (1ms Rte table) delivers RX indications through
+ * PduR into Dcm and CanTSyn, whose main functions run in the 10ms task,
+ * and the SWC runnables share BswM and Det with it. Those modules have
+ * no exclusive areas, so both tasks run on one level: the 1ms task
+ * first when both are due, neither preempts the other. Only the 100ms
+ * task (Dem + NvM write) is preempted. Modules shared with it (Dem,
+ * WdgM, Can, Rte, StbM, Det) have exclusive areas.
+ * ================================================================== */
+
+#define RZC_OS_TASK_1MS      0u
+#define RZC_OS_TASK_10MS     1u
+#define RZC_OS_TASK_100MS    2u
+#define RZC_OS_TASK_COUNT    3u
+
+/* Level stacks in words: deepest task of the level plus device ISRs */
+#define RZC_OS_STACK_1MS     512u    /* 2 KB: Rte runnables, 10ms    */
+#define RZC_OS_STACK_100MS   512u    /* 2 KB: Dem + NvM              */
+
+static uint32 os_stack_1ms[RZC_OS_STACK_1MS];
+static uint32 os_stack_100ms[RZC_OS_STACK_100MS];
+
+static const Os_LevelConfigType os_levels[] = {
+    { os_stack_100ms, RZC_OS_STACK_100MS },  /* level 0: PendSV */
+    { os_stack_1ms,   RZC_OS_STACK_1MS   },  /* level 1         */
+};
+
+/* Offsets keep the 10ms and 100ms activations off the same tick. On
+ * level 1 the 1ms task is listed first, so it runs before the 10ms task
+ * on their common ticks; the 10ms task must finish well within 1ms. */
+static const Os_TaskConfigType os_tasks[RZC_OS_TASK_COUNT] = {
+    { Main_Task1ms,     1u, 0u, 1u },
+    { Main_Task10ms,   10u, 1u, 1u },
+    { Main_Task100ms, 100u, 2u, 0u },
+};
+
+static const Os_ConfigType os_config = {
+    .tasks      = os_tasks,
+    .taskCount  = RZC_OS_TASK_COUNT,
+    .levels     = os_levels,
+    .levelCount = (uint8)(sizeof(os_levels) / sizeof(os_levels[0])),
+};
+
+/* Exclusive areas: each BSW area is used from more than one task level, so
+ * it masks the Os levels only; FDCAN, DMA and SysTick keep running. The Os
+ * area is also entered from SysTick (Os_Tick), the Tmr, Spi and Adc areas
+ * from the timer, SPI DMA and ADC DMA interrupts, the Det area from all of
+ * them (all interrupts masked). */
+#define RZC_SCHM_CEIL_TASKS  14u    /* NVIC priority of Os level 1  */
+#define RZC_SCHM_CEIL_TICK   4u     /* SysTick (Os_Hw_STM32.c)      */
+
+static const SchM_AreaConfigType schm_areas[SCHM_AREA_COUNT] = {
+    { SCHM_LOCK_BASEPRI, RZC_SCHM_CEIL_TASKS },  /* Com  */
+    { SCHM_LOCK_BASEPRI, RZC_SCHM_CEIL_TASKS },  /* Rte  */
+    { SCHM_LOCK_BASEPRI, RZC_SCHM_CEIL_TASKS },  /* Dem  */
+    { SCHM_LOCK_BASEPRI, RZC_SCHM_CEIL_TASKS },  /* WdgM */
+    { SCHM_LOCK_BASEPRI, RZC_SCHM_CEIL_TASKS },  /* Can  */
+    { SCHM_LOCK_BASEPRI, RZC_SCHM_CEIL_TICK  },  /* Os   */
+    { SCHM_LOCK_GLOBAL,  0u                  },  /* Tmr  */
+    { SCHM_LOCK_BASEPRI, RZC_SCHM_CEIL_TASKS },  /* StbM */
+    { SCHM_LOCK_GLOBAL,  0u                  },  /* Spi  */
+    { SCHM_LOCK_GLOBAL,  0u                  },  /* Adc  */
+    { SCHM_LOCK_GLOBAL,  0u                  },  /* Det  */
+};
+
+static const SchM_ConfigType schm_config = {
+    .areas     = schm_areas,
+    .areaCount = SCHM_AREA_COUNT,
+};
+
+#ifdef OS_LATENCY_MEASUREMENT
+#define RZC_CPU_MHZ          170u
+#define RZC_STATS_10MS_CYCLES  500u    /* 10ms cycles per 5s print */
+
+/**
+ * @brief  Print max activation latency (us) and overruns of each task,
+ *         the stack high-water mark (bytes) of each level, and the
+ *         interrupt-masked sections and time per 10ms cycle, and the
+ *         longest hold (us) of each exclusive area
+ */
+static void Main_PrintOsStats(void)
+{
+    Os_TaskStatsType stats;
+    SchM_IrqOffStatsType irq_off;
+    SchM_AreaStatsType area;
+    uint8 id;
+
+    Dbg_Uart_Print("  Os lat/ovr:");
+    for (id = 0u; id < RZC_OS_TASK_COUNT; id++)
+    {
+        if (Os_GetTaskStats(id, &stats) == E_OK)
+        {
+            Dbg_Uart_Print(" ");
+            Dbg_PrintU32(stats.latencyMax / RZC_CPU_MHZ);
+            Dbg_Uart_Print("us/");
+            Dbg_PrintU32(stats.overruns);
+        }
+    }
+    Dbg_Uart_Print(" stack:");
+    for (id = 0u; id < os_config.levelCount; id++)
+    {
+        Dbg_Uart_Print(" ");
+        Dbg_PrintU32((uint32)Os_GetStackUsage(id));
+    }
+
+    SchM_GetIrqOffStats(&irq_off);
+    SchM_ResetIrqOffStats();
+    Dbg_Uart_Print(" irqoff/10ms:");
+    Dbg_PrintU32(irq_off.sections / RZC_STATS_10MS_CYCLES);
+    Dbg_Uart_Print("x ");
+    Dbg_PrintU32((irq_off.cycles / RZC_STATS_10MS_CYCLES) / RZC_CPU_MHZ);
+    Dbg_Uart_Print("us max ");
+    Dbg_PrintU32(irq_off.maxCycles / RZC_CPU_MHZ);
+    Dbg_Uart_Print("us area max:");
+    for (id = 0u; id < SCHM_AREA_COUNT; id++)
+    {
+        if (SchM_GetAreaStats(id, &area) == E_OK)
+        {
+            Dbg_Uart_Print(" ");
+            Dbg_PrintU32(area.maxCycles / RZC_CPU_MHZ);
+        }
+    }
+    SchM_ResetAreaStats();
+    Dbg_Uart_Print("us\r\n");
+}
+#endif /* OS_LATENCY_MEASUREMENT */
+
+/**
+ * @brief  Print the WdgM violations logged since the last print (newest
+ *         first): SE, kind (0 alive, 1 deadline, 2 logical), checkpoint,
+ *         value and time (ms)
+ */
+static void Main_PrintWdgMViolations(void)
+{
+    static uint16 printed = 0u;
+    uint16 count = WdgM_GetViolationCount();
+    WdgM_ViolationType v;
+    uint8 i;
+
+    if (count == printed)
+    {
+        return;
+    }
+
+    Dbg_Uart_Print("  WdgM viol:");
+    Dbg_PrintU32((uint32)count);
+    for (i = 0u; (i < (uint16)(count - printed)) &&
+                 (WdgM_GetViolation(i, &v) == E_OK); i++)
+    {
+        Dbg_Uart_Print(" SE");
+        Dbg_PrintU32((uint32)v.SEId);
+        Dbg_Uart_Print("/");
+        Dbg_PrintU32((uint32)v.kind);
+        Dbg_Uart_Print("/");
+        Dbg_PrintU32((uint32)v.checkpoint);
+        Dbg_Uart_Print("/");
+        Dbg_PrintU32(v.value);
+        Dbg_Uart_Print("@");
+        Dbg_PrintU32(v.timestampUs / 1000u);
+    }
+    Dbg_Uart_Print("\r\n");
+    printed = count;
+}
+#endif /* PLATFORM_STM32 */
+
 /* ==================================================================
  * Tick Counters
  * ================================================================== */
@@ -340,10 +699,11 @@ static volatile uint32 tick_us;
  */
 int main(void)
 {
+#ifndef PLATFORM_STM32
     uint32 last_1ms_us   = 0u;
     uint32 last_10ms_us  = 0u;
     uint32 last_100ms_us = 0u;
-#ifdef PLATFORM_STM32
+#else
     uint32 last_5s_us    = 0u;
 #endif
     uint8  self_test_result;
@@ -358,9 +718,16 @@ int main(void)
     DBG_LOG("CAN: FDCAN1 init OK\r\n");
     CanIf_Init(&canif_config);
     PduR_Init(&rzc_pdur_config);
+    StbM_Init(&stbm_config);
+    CanTSyn_Init(&cantsyn_config);
     Com_Init(&rzc_com_config);
     E2E_Init();
-    Dem_Init(NULL_PTR);
+#ifdef PLATFORM_STM32
+    Fls_Init(&fls_config);
+    Fee_Init(&fee_config);
+#endif
+    NvM_Init();
+    Dem_Init(&dem_config);
     Dem_SetEcuId(RZC_ECU_ID);                              /* 0x03 — RZC ECU ID */
     Dem_SetBroadcastPduId(RZC_COM_TX_DTC_BROADCAST);       /* CanIf TX for 0x500 */
 
@@ -382,6 +749,10 @@ int main(void)
     BswM_Init(&bswm_config);
     Dcm_Init(&rzc_dcm_config);
     Adc_Init(&adc_config);
+    /* Scans run from here on; the first completes before Swc_CurrentMonitor zero-cal */
+    (void)Adc_StartGroupConversion(RZC_MOTOR_CURRENT_ADC_GROUP);
+    (void)Adc_StartGroupConversion(RZC_MOTOR_TEMP_ADC_GROUP);
+    (void)Adc_StartGroupConversion(RZC_BATTERY_VOLTAGE_ADC_GROUP);
     IoHwAb_Init(&iohwab_config);
     Rte_Init(&rzc_rte_config);
 
@@ -432,6 +803,16 @@ int main(void)
 
     /* ---- Step 7: Start SysTick (1ms period = 1000us) ---- */
     Main_Hw_SysTickInit(1000u);
+#ifdef PLATFORM_STM32
+    /* Os tick runs from SysTick; from here on the tasks preempt main */
+    SchM_Init(&schm_config);
+    Os_Init(&os_config);
+#ifdef OS_LATENCY_MEASUREMENT
+    Os_SetLatencyMeasurement(TRUE);
+#endif
+    Os_Start();
+    DBG_LOG("Os: 1ms/10ms/100ms tasks started\r\n");
+#endif
     DBG_LOG("SysTick: 1ms — entering main loop\r\n");
 
     /* ---- Step 8: Main loop ---- */
@@ -441,29 +822,27 @@ int main(void)
 
         tick_us = Main_Hw_GetTick();
 
-        /* 1ms task: RTE scheduler (dispatches runnables internally)
+#ifndef PLATFORM_STM32
+        /* POSIX: run the task bodies in turn
          * Main_Hw_GetTick() returns microseconds; 1ms = 1000us */
         if ((tick_us - last_1ms_us) >= 1000u)
         {
             last_1ms_us = tick_us;
-            Rte_MainFunction();
+            Main_Task1ms();
         }
 
-        /* 10ms tasks: Dcm, BswM */
         if ((tick_us - last_10ms_us) >= 10000u)
         {
             last_10ms_us = tick_us;
-            Dcm_MainFunction();
-            BswM_MainFunction();
+            Main_Task10ms();
         }
 
-        /* 100ms tasks: WdgM, Dem (DTC broadcast) */
         if ((tick_us - last_100ms_us) >= 100000u)
         {
             last_100ms_us = tick_us;
-            WdgM_MainFunction();
-            Dem_MainFunction();
+            Main_Task100ms();
         }
+#endif
 
 #ifdef PLATFORM_STM32
         /* 5s debug task: CAN error counter + heartbeat alive print */
@@ -496,6 +875,10 @@ int main(void)
             Dbg_Uart_Print(" TXbusy=");
             Dbg_PrintU32(g_can_tx_busy_count);
             Dbg_Uart_Print("\r\n");
+            Main_PrintWdgMViolations();
+#ifdef OS_LATENCY_MEASUREMENT
+            Main_PrintOsStats();
+#endif
         }
 #endif
     }
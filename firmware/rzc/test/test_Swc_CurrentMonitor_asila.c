@@ -11,7 +11,7 @@
  * CAN broadcast of current data.
  *
  * Mocks: IoHwAb_ReadMotorCurrent, Rte_Read, Rte_Write, Com_SendSignal,
- *        Dem_ReportErrorStatus, Dio_WriteChannel
+ *        Dem_ReportErrorStatus, Dem_GetDebouncingOfEvent, Dio_WriteChannel
  */
 #include "unity.h"
 
@@ -66,6 +66,7 @@ typedef uint8           Com_SignalIdType;
 /* DEM event status */
 #define DEM_EVENT_STATUS_PASSED     0u
 #define DEM_EVENT_STATUS_FAILED     1u
+#define DEM_DEBOUNCE_FINALLY_DEFECTIVE 0x02u
 
 /* Current monitoring constants */
 #define RZC_CURRENT_OC_THRESH_MA  25000u
@@ -169,7 +170,8 @@ Std_ReturnType Com_SendSignal(Com_SignalIdType SignalId, const void* SignalDataP
 }
 
 /* ==================================================================
- * Mock: Dem_ReportErrorStatus
+ * Mock: Dem_ReportErrorStatus, Dem_GetDebouncingOfEvent
+ * Emulates the RZC Dem debounce table: counter-based, jump to zero
  * ================================================================== */
 
 #define MOCK_DEM_MAX_EVENTS  16u
@@ -180,6 +182,11 @@ static uint8   mock_dem_call_count;
 static uint8   mock_dem_event_reported[MOCK_DEM_MAX_EVENTS];
 static uint8   mock_dem_event_status[MOCK_DEM_MAX_EVENTS];
 
+static sint16  mock_dem_counter[MOCK_DEM_MAX_EVENTS];
+static sint16  mock_dem_fail_threshold[MOCK_DEM_MAX_EVENTS];
+static sint16  mock_dem_pass_threshold[MOCK_DEM_MAX_EVENTS];
+static uint8   mock_dem_qualified[MOCK_DEM_MAX_EVENTS];
+
 void Dem_ReportErrorStatus(uint8 EventId, uint8 EventStatus)
 {
     mock_dem_call_count++;
@@ -188,9 +195,38 @@ void Dem_ReportErrorStatus(uint8 EventId, uint8 EventStatus)
     if (EventId < MOCK_DEM_MAX_EVENTS) {
         mock_dem_event_reported[EventId] = 1u;
         mock_dem_event_status[EventId]   = EventStatus;
+        if (EventStatus == DEM_EVENT_STATUS_FAILED) {
+            if (mock_dem_counter[EventId] < 0) {
+                mock_dem_counter[EventId] = 0;
+            }
+            mock_dem_counter[EventId]++;
+            if (mock_dem_counter[EventId] >= mock_dem_fail_threshold[EventId]) {
+                mock_dem_counter[EventId]   = mock_dem_fail_threshold[EventId];
+                mock_dem_qualified[EventId] = 1u;
+            }
+        } else {
+            if (mock_dem_counter[EventId] > 0) {
+                mock_dem_counter[EventId] = 0;
+            }
+            mock_dem_counter[EventId]--;
+            if (mock_dem_counter[EventId] <= mock_dem_pass_threshold[EventId]) {
+                mock_dem_counter[EventId]   = mock_dem_pass_threshold[EventId];
+                mock_dem_qualified[EventId] = 0u;
+            }
+        }
     }
 }
 
+Std_ReturnType Dem_GetDebouncingOfEvent(uint8 EventId, uint8* DebouncingStatePtr)
+{
+    if ((EventId >= MOCK_DEM_MAX_EVENTS) || (DebouncingStatePtr == NULL_PTR)) {
+        return E_NOT_OK;
+    }
+    *DebouncingStatePtr = (mock_dem_qualified[EventId] != 0u) ?
+                          DEM_DEBOUNCE_FINALLY_DEFECTIVE : 0u;
+    return E_OK;
+}
+
 /* ==================================================================
  * Mock: Dio_WriteChannel
  * ================================================================== */
@@ -250,7 +286,13 @@ void setUp(void)
     for (i = 0u; i < MOCK_DEM_MAX_EVENTS; i++) {
         mock_dem_event_reported[i] = 0u;
         mock_dem_event_status[i]   = 0xFFu;
+        mock_dem_counter[i]        = 0;
+        mock_dem_fail_threshold[i] = 1;
+        mock_dem_pass_threshold[i] = 0;
+        mock_dem_qualified[i]      = 0u;
     }
+    mock_dem_fail_threshold[RZC_DTC_OVERCURRENT] = (sint16)RZC_CURRENT_OC_DEBOUNCE;
+    mock_dem_pass_threshold[RZC_DTC_OVERCURRENT] = -(sint16)RZC_CURRENT_RECOVERY_MS;
 
     /* Reset DIO mock */
     mock_dio_write_count = 0u;
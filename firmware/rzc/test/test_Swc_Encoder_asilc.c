@@ -11,7 +11,8 @@
  * grace period, motor disable on fault, and DTC reporting.
  *
  * Mocks: IoHwAb_ReadEncoderCount, IoHwAb_ReadEncoderDirection,
- *        Rte_Read, Rte_Write, Dem_ReportErrorStatus, Dio_WriteChannel
+ *        Rte_Read, Rte_Write, Dem_ReportErrorStatus, Dem_GetDebouncingOfEvent,
+ *        Dio_WriteChannel
  */
 #include "unity.h"
 
@@ -85,6 +86,7 @@ typedef uint8           boolean;
 /* DEM event status */
 #define DEM_EVENT_STATUS_PASSED      0u
 #define DEM_EVENT_STATUS_FAILED      1u
+#define DEM_DEBOUNCE_FINALLY_DEFECTIVE 0x02u
 
 /* Swc_Encoder API declarations */
 extern void Swc_Encoder_Init(void);
@@ -157,7 +159,8 @@ Std_ReturnType Rte_Write(uint16 SignalId, uint32 Data)
 }
 
 /* ==================================================================
- * Mock: Dem_ReportErrorStatus
+ * Mock: Dem_ReportErrorStatus, Dem_GetDebouncingOfEvent
+ * Emulates the RZC Dem debounce table: counter-based, jump to zero
  * ================================================================== */
 
 #define MOCK_DEM_MAX_EVENTS  16u
@@ -168,6 +171,11 @@ static uint8   mock_dem_call_count;
 static uint8   mock_dem_event_reported[MOCK_DEM_MAX_EVENTS];
 static uint8   mock_dem_event_status[MOCK_DEM_MAX_EVENTS];
 
+static sint16  mock_dem_counter[MOCK_DEM_MAX_EVENTS];
+static sint16  mock_dem_fail_threshold[MOCK_DEM_MAX_EVENTS];
+static sint16  mock_dem_pass_threshold[MOCK_DEM_MAX_EVENTS];
+static uint8   mock_dem_qualified[MOCK_DEM_MAX_EVENTS];
+
 void Dem_ReportErrorStatus(uint8 EventId, uint8 EventStatus)
 {
     mock_dem_call_count++;
@@ -176,9 +184,38 @@ void Dem_ReportErrorStatus(uint8 EventId, uint8 EventStatus)
     if (EventId < MOCK_DEM_MAX_EVENTS) {
         mock_dem_event_reported[EventId] = 1u;
         mock_dem_event_status[EventId]   = EventStatus;
+        if (EventStatus == DEM_EVENT_STATUS_FAILED) {
+            if (mock_dem_counter[EventId] < 0) {
+                mock_dem_counter[EventId] = 0;
+            }
+            mock_dem_counter[EventId]++;
+            if (mock_dem_counter[EventId] >= mock_dem_fail_threshold[EventId]) {
+                mock_dem_counter[EventId]   = mock_dem_fail_threshold[EventId];
+                mock_dem_qualified[EventId] = 1u;
+            }
+        } else {
+            if (mock_dem_counter[EventId] > 0) {
+                mock_dem_counter[EventId] = 0;
+            }
+            mock_dem_counter[EventId]--;
+            if (mock_dem_counter[EventId] <= mock_dem_pass_threshold[EventId]) {
+                mock_dem_counter[EventId]   = mock_dem_pass_threshold[EventId];
+                mock_dem_qualified[EventId] = 0u;
+            }
+        }
     }
 }
 
+Std_ReturnType Dem_GetDebouncingOfEvent(uint8 EventId, uint8* DebouncingStatePtr)
+{
+    if ((EventId >= MOCK_DEM_MAX_EVENTS) || (DebouncingStatePtr == NULL_PTR)) {
+        return E_NOT_OK;
+    }
+    *DebouncingStatePtr = (mock_dem_qualified[EventId] != 0u) ?
+                          DEM_DEBOUNCE_FINALLY_DEFECTIVE : 0u;
+    return E_OK;
+}
+
 /* ==================================================================
  * Mock: Dio_WriteChannel
  * ================================================================== */
@@ -231,7 +268,15 @@ void setUp(void)
     for (i = 0u; i < MOCK_DEM_MAX_EVENTS; i++) {
         mock_dem_event_reported[i] = 0u;
         mock_dem_event_status[i]   = 0xFFu;
+        mock_dem_counter[i]        = 0;
+        mock_dem_fail_threshold[i] = 1;
+        mock_dem_pass_threshold[i] = 0;
+        mock_dem_qualified[i]      = 0u;
     }
+    mock_dem_fail_threshold[RZC_DTC_STALL] = (sint16)RZC_ENCODER_STALL_CHECKS;
+    mock_dem_pass_threshold[RZC_DTC_STALL] = 0;
+    mock_dem_fail_threshold[RZC_DTC_DIRECTION] = (sint16)RZC_ENCODER_DIR_CHECKS;
+    mock_dem_pass_threshold[RZC_DTC_DIRECTION] = 0;
 
     /* Reset DIO mock */
     mock_dio_write_count = 0u;
@@ -537,7 +582,7 @@ void test_Dir_grace_period(void)
     simulate_rotation(10u, 10u);
 
     /* Should NOT trigger direction fault during grace period */
-    TEST_ASSERT_EQUAL_UINT8(0u, mock_dem_event_reported[RZC_DTC_DIRECTION]);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_dem_qualified[RZC_DTC_DIRECTION]);
 }
 
 /** @verifies SWR-RZC-012 -- MainFunction without init is safe (no crash) */
@@ -630,7 +675,7 @@ void test_Dir_mismatch_exactly_4_no_fault(void)
 
     simulate_rotation(10u, RZC_ENCODER_DIR_CHECKS - 1u);
 
-    TEST_ASSERT_EQUAL_UINT8(0u, mock_dem_event_reported[RZC_DTC_DIRECTION]);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_dem_qualified[RZC_DTC_DIRECTION]);
 }
 
 /** @verifies SWR-RZC-014
@@ -645,7 +690,7 @@ void test_Dir_stop_direction_no_fault(void)
     simulate_rotation(10u, RZC_ENCODER_DIR_CHECKS + 5u);
 
     /* STOP direction should not cause direction mismatch fault */
-    TEST_ASSERT_EQUAL_UINT8(0u, mock_dem_event_reported[RZC_DTC_DIRECTION]);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_dem_qualified[RZC_DTC_DIRECTION]);
 }
 
 /** @verifies SWR-RZC-013
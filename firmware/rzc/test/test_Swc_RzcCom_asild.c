@@ -236,6 +236,18 @@ Std_ReturnType PduR_Transmit(PduIdType TxPduId, const PduInfoType* PduInfoPtr)
     return E_OK;
 }
 
+/* ==================================================================
+ * Mock: Com_IsTxPduStarted (I-PDU group state)
+ * ================================================================== */
+
+static boolean mock_com_tx_started;
+
+boolean Com_IsTxPduStarted(PduIdType TxPduId)
+{
+    (void)TxPduId;
+    return mock_com_tx_started;
+}
+
 /* ==================================================================
  * Mock: Dem_ReportErrorStatus
  * ================================================================== */
@@ -307,6 +319,8 @@ void setUp(void)
         mock_com_last_data[i] = 0u;
     }
 
+    mock_com_tx_started = TRUE;
+
     mock_pdur_tx_count    = 0u;
     mock_pdur_last_pdu_id = 0xFFu;
     for (i = 0u; i < 8u; i++) {
@@ -518,6 +532,29 @@ void test_RzcCom_transmit_motor_data_10ms(void)
                             mock_pdur_tx_data[RZC_COM_TX_BATTERY_STATUS][2]);
 }
 
+/** @verifies SWR-RZC-027 -- Battery status not sent while its I-PDU
+ *  group is stopped (BswM SAFE_STOP) */
+void test_RzcCom_transmit_battery_follows_ipdu_group(void)
+{
+    uint8 i;
+
+    mock_rte_signals[RZC_SIG_BATTERY_MV] = 12000u;
+
+    /* One full battery period (20 cycles) with the group stopped */
+    mock_com_tx_started = FALSE;
+    for (i = 0u; i < 20u; i++) {
+        Swc_RzcCom_TransmitSchedule();
+    }
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_pdur_tx_data[RZC_COM_TX_BATTERY_STATUS][2]);
+
+    mock_com_tx_started = TRUE;
+    for (i = 0u; i < 20u; i++) {
+        Swc_RzcCom_TransmitSchedule();
+    }
+    TEST_ASSERT_EQUAL_UINT8((uint8)(12000u & 0xFFu),
+                            mock_pdur_tx_data[RZC_COM_TX_BATTERY_STATUS][2]);
+}
+
 /* ==================================================================
  * SWR-RZC-020: Rzc_E2eRxCheck CanIf Callback
  * ================================================================== */
@@ -611,6 +648,7 @@ int main(void)
 
     /* SWR-RZC-027: CAN Message Transmission */
     RUN_TEST(test_RzcCom_transmit_motor_data_10ms);
+    RUN_TEST(test_RzcCom_transmit_battery_follows_ipdu_group);
 
     /* SWR-RZC-020: Rzc_E2eRxCheck CanIf Callback */
     RUN_TEST(test_Rzc_E2eRxCheck_vehicle_torque_bad_crc);
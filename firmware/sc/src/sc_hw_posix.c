@@ -14,7 +14,13 @@
  *
  *          The DCAN1 mailbox→CAN ID mapping enables the SC to receive
  *          CAN frames from vcan0 via SocketCAN, filtered to match the
- *          6 mailboxes defined in sc_cfg.h.
+ *          6 mailboxes defined in sc_cfg.h. CAN_INTERFACE=shm:<name> puts
+ *          the SC on the shared memory bus of the SIL (Sil_CanBus.c), like
+ *          the BSW ECUs.
+ *
+ *          The 10 ms RTI tick is the SIL periodic timer (Sil_Time.c), so the
+ *          SC follows SIL_TIME_SCALE and the lockstep time master like the
+ *          other ECUs instead of polling the wall clock.
  *
  * @safety_req N/A — SIL simulation only, not for production
  * @copyright Taktflow Systems 2026
@@ -33,7 +39,6 @@
 #include <fcntl.h>
 #include <string.h>
 #include <stdlib.h>
-#include <time.h>
 #include <stdio.h>
 #endif
 
@@ -46,14 +51,30 @@ static uint8 gio_pin_state[2u][8u];
 static uint8 gio_pin_dir[2u][8u];
 
 /** RTI tick tracking */
+static boolean rti_running = FALSE;
+
 #ifndef PLATFORM_POSIX_TEST
-static struct timespec rti_last_tick;
+#define RTI_PERIOD_US   10000u      /* 10 ms */
+
+#define DCAN_BITRATE    500000u     /* DCAN1, see sc_cfg.h */
+
+/* Sil_Time.h and Sil_CanBus.h are not included: their Platform_Types.h
+ * clashes with sc_types.h */
+extern void Sil_Time_Init(void);
+extern void Sil_Time_WaitNextPeriod(uint32 period_us);
+extern unsigned long long Sil_Time_GetSharedUs(void);
+extern Std_ReturnType Sil_CanBus_Open(const char* name, uint32 bitrate,
+                                      unsigned long long (*nowFn)(void));
+extern Std_ReturnType Sil_CanBus_Transmit(uint32 id, const uint8* data, uint8 dlc);
+extern boolean Sil_CanBus_Receive(uint32* id, uint8* data, uint8* dlc);
 #endif
-static boolean rti_running = FALSE;
 
 /** SocketCAN file descriptor for DCAN1 simulation */
 static int dcan_fd = -1;
 
+/** DCAN1 is on the shared memory bus instead of SocketCAN */
+static boolean dcan_shm = FALSE;
+
 /** DCAN init tracking */
 static boolean dcan_initialized = FALSE;
 
@@ -107,12 +128,12 @@ void gioInit(void)
 }
 
 /**
- * @brief  Initialize RTI timer for 10ms tick — record start time
+ * @brief  Initialize RTI timer for 10ms tick — set up the SIL time base
  */
 void rtiInit(void)
 {
 #ifndef PLATFORM_POSIX_TEST
-    clock_gettime(CLOCK_MONOTONIC, &rti_last_tick);
+    Sil_Time_Init();
 #endif
 }
 
@@ -122,14 +143,11 @@ void rtiInit(void)
 void rtiStartCounter(void)
 {
     rti_running = TRUE;
-#ifndef PLATFORM_POSIX_TEST
-    clock_gettime(CLOCK_MONOTONIC, &rti_last_tick);
-#endif
 }
 
 /**
- * @brief  Check if RTI tick flag is set (10ms elapsed)
- * @return TRUE if 10ms has elapsed since last clear
+ * @brief  Wait for the RTI tick (10ms after the previous one)
+ * @return TRUE once the tick is due, FALSE while the counter is stopped
  */
 boolean rtiIsTickPending(void)
 {
@@ -138,29 +156,19 @@ boolean rtiIsTickPending(void)
     }
 
 #ifndef PLATFORM_POSIX_TEST
-    struct timespec now;
-    clock_gettime(CLOCK_MONOTONIC, &now);
-
-    uint32 elapsed_us = (uint32)(
-        ((now.tv_sec - rti_last_tick.tv_sec) * 1000000u) +
-        ((now.tv_nsec - rti_last_tick.tv_nsec) / 1000u)
-    );
-
-    if (elapsed_us >= 10000u) {  /* 10ms = 10000us */
-        return TRUE;
-    }
+    /* Blocks until the next deadline: the main loop does not spin */
+    Sil_Time_WaitNextPeriod(RTI_PERIOD_US);
 #endif
 
-    return FALSE;
+    return TRUE;
 }
 
 /**
- * @brief  Clear RTI tick flag — update last-tick timestamp
+ * @brief  Clear RTI tick flag — start a new CAN RX tick
  */
 void rtiClearTick(void)
 {
 #ifndef PLATFORM_POSIX_TEST
-    clock_gettime(CLOCK_MONOTONIC, &rti_last_tick);
     /* Reset per-tick CAN RX buffer so next SC_CAN_Receive() drains fresh */
     rx_drained = FALSE;
 #endif
@@ -216,7 +224,7 @@ uint8 gioGetBit(uint8 port, uint8 pin)
 static void sc_posix_can_init(void)
 {
 #ifndef PLATFORM_POSIX_TEST
-    if (dcan_fd >= 0) {
+    if ((dcan_fd >= 0) || (dcan_shm == TRUE)) {
         return; /* Already initialized */
     }
 
@@ -225,6 +233,13 @@ static void sc_posix_can_init(void)
         iface = "vcan0";
     }
 
+    if (strncmp(iface, "shm:", 4u) == 0) {
+        if (Sil_CanBus_Open(&iface[4], DCAN_BITRATE, Sil_Time_GetSharedUs) == E_OK) {
+            dcan_shm = TRUE;
+        }
+        return;
+    }
+
     int fd = socket(PF_CAN, SOCK_RAW, CAN_RAW);
     if (fd < 0) {
         return;
@@ -310,7 +325,7 @@ void dcan1_setup_mailboxes(void)
 boolean dcan1_get_mailbox_data(uint8 mbIndex, uint8* data, uint8* dlc)
 {
 #ifndef PLATFORM_POSIX_TEST
-    if (dcan_fd < 0) {
+    if ((dcan_fd < 0) && (dcan_shm == FALSE)) {
         return FALSE;
     }
     if (mbIndex >= 6u) {
@@ -334,9 +349,20 @@ boolean dcan1_get_mailbox_data(uint8 mbIndex, uint8* data, uint8* dlc)
 
         while (max_reads > 0) {
             max_reads--;
-            ssize_t nbytes = recv(dcan_fd, &frame, sizeof(frame), MSG_DONTWAIT);
-            if (nbytes <= 0) {
-                break;
+            if (dcan_shm == TRUE) {
+                uint32 shm_id;
+                uint8  shm_dlc;
+
+                if (Sil_CanBus_Receive(&shm_id, frame.data, &shm_dlc) == FALSE) {
+                    break;
+                }
+                frame.can_id  = shm_id;
+                frame.can_dlc = shm_dlc;
+            } else {
+                ssize_t nbytes = recv(dcan_fd, &frame, sizeof(frame), MSG_DONTWAIT);
+                if (nbytes <= 0) {
+                    break;
+                }
             }
 
             uint32 rx_id = frame.can_id & 0x7FFu;
@@ -399,15 +425,19 @@ void sc_posix_can_send(uint32 can_id, const uint8 *data, uint8 dlc)
     struct can_frame frame;
     uint8 i;
 
-    if (dcan_fd < 0) {
+    if ((dcan_fd < 0) && (dcan_shm == FALSE)) {
         sc_posix_can_init();
-        if (dcan_fd < 0) {
+        if ((dcan_fd < 0) && (dcan_shm == FALSE)) {
             return;
         }
     }
     if ((data == NULL) || (dlc > 8u)) {
         return;
     }
+    if (dcan_shm == TRUE) {
+        (void)Sil_CanBus_Transmit(can_id & 0x7FFu, data, dlc);
+        return;
+    }
 
     memset(&frame, 0, sizeof(frame));
     frame.can_id  = can_id & 0x7FFu;
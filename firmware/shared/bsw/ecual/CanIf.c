@@ -11,11 +11,19 @@
  */
 #include "CanIf.h"
 #include "Det.h"
+#include "Bsw_Instance.h"
 
-/* ---- Internal State ---- */
+/* ---- Internal State (one set per BSW instance, see Bsw_Instance.h) ---- */
 
-static const CanIf_ConfigType* canif_config = NULL_PTR;
-static boolean canif_initialized = FALSE;
+typedef struct {
+    const CanIf_ConfigType* canif_config;
+    boolean canif_initialized;
+} CanIf_ContextType;
+
+BSW_INSTANCE_STATE(CanIf_ContextType, canif_ctx);
+
+#define canif_config      (BSW_INSTANCE(canif_ctx).canif_config)
+#define canif_initialized (BSW_INSTANCE(canif_ctx).canif_initialized)
 
 /* ---- API Implementation ---- */
 
@@ -0,0 +1,737 @@
+/**
+ * @file    Fee.c
+ * @brief   Flash EEPROM Emulation implementation
+ * @date    2026-03-10
+ *
+ * @safety_req SWR-BSW-031
+ * @traces_to  TSR-050
+ *
+ * @details Fee_Init rebuilds a RAM index (block -> record offset in the
+ *          active page) by scanning the pages once. Fee_MainFunction then
+ *          runs a small state machine, starting at most one Fls job per
+ *          call and waiting for it on later calls:
+ *
+ *            IDLE --pending write, fits--> WRITE --> IDLE
+ *            IDLE --pending write, page full--> [SWAP_ERASE] --> SWAP_HEADER
+ *                 --> SWAP_COPY (one block per job) --> SWAP_ACTIVATE --> IDLE
+ *            IDLE --nothing queued, page marked for erase--> ERASE --> IDLE
+ *
+ *          The old page stays valid until the new one is activated, so a
+ *          reset at any point of the swap loses nothing: Fee_Init picks the
+ *          ACTIVE page with the highest sequence number and schedules all
+ *          other non-blank pages for erase.
+ *
+ * @standard AUTOSAR_SWS_FlashEEPROMEmulation, ISO 26262 Part 6
+ * @copyright Taktflow Systems 2026
+ */
+#include "Fee.h"
+#include "Det.h"
+
+/* ---- Layout Constants ---- */
+
+#define FEE_PAGE_MAGIC      0x50454546u     /* "FEEP" */
+#define FEE_ACTIVE_MARK     0x56544341u     /* "ACTV" */
+#define FEE_RECORD_MAGIC    0x5EC0u
+#define FEE_COMMIT_MAGIC    0xC0DEC0DEu
+
+#define FEE_CRC16_INIT      0xFFFFu
+#define FEE_CRC16_POLY      0x1021u         /* CRC-16/CCITT-FALSE */
+
+#define FEE_NO_RECORD       0u              /* Records start at offset 16 */
+#define FEE_STATE_DWORD     8u              /* Offset of page state dword */
+
+#define FEE_ALIGN(len)      (((len) + (FLS_DWORD_SIZE - 1u)) & ~(FLS_DWORD_SIZE - 1u))
+#define FEE_RECORD_SIZE(len) (FEE_RECORD_OVERHEAD + FEE_ALIGN((Fls_LengthType)(len)))
+
+/* ---- Internal Types ---- */
+
+typedef enum {
+    FEE_STATE_IDLE          = 0u,
+    FEE_STATE_WRITE         = 1u,
+    FEE_STATE_SWAP_ERASE    = 2u,
+    FEE_STATE_SWAP_HEADER   = 3u,
+    FEE_STATE_SWAP_COPY     = 4u,
+    FEE_STATE_SWAP_ACTIVATE = 5u,
+    FEE_STATE_ERASE         = 6u
+} Fee_StateType;
+
+typedef enum {
+    FEE_PAGE_ERASED    = 0u,
+    FEE_PAGE_RECEIVING = 1u,    /* Swap target, not yet activated */
+    FEE_PAGE_ACTIVE    = 2u,
+    FEE_PAGE_INVALID   = 3u
+} Fee_PageStateType;
+
+/* ---- Internal State ---- */
+
+static const Fee_ConfigType* fee_cfg = NULL_PTR;
+static boolean               fee_initialized = FALSE;
+static MemIf_JobResultType   fee_result = MEMIF_JOB_OK;
+static Fee_StateType         fee_state = FEE_STATE_IDLE;
+
+static boolean         fee_have_active;
+static uint8           fee_active_page;
+static uint32          fee_active_seq;
+static Fls_LengthType  fee_write_offset;                /* Next free record slot */
+static Fls_LengthType  fee_index[FEE_MAX_BLOCKS];       /* Latest record offset  */
+static const uint8*    fee_pending[FEE_MAX_BLOCKS];     /* Queued write data     */
+static uint8           fee_erase_mask;                  /* Pages to erase (bits) */
+
+/* Job in flight */
+static uint8           fee_job_block;
+static Fls_LengthType  fee_job_size;
+static uint8           fee_job_page;                    /* Swap target / erase   */
+static uint32          fee_swap_seq;
+static Fls_LengthType  fee_swap_offset;
+static Fls_LengthType  fee_swap_index[FEE_MAX_BLOCKS];
+static const uint8*    fee_swap_src[FEE_MAX_BLOCKS];    /* Pending data consumed
+                                                           by the swap copy     */
+
+/* Fls reads the source during the job, so these must be static */
+static uint8 fee_buf[FEE_MAX_BLOCK_SIZE + FEE_RECORD_OVERHEAD];
+static uint8 fee_dword_buf[FLS_DWORD_SIZE];
+
+/* ---- Private Helpers ---- */
+
+static uint32 Fee_GetU32(const uint8* Buf)
+{
+    return (uint32)Buf[0] | ((uint32)Buf[1] << 8u) |
+           ((uint32)Buf[2] << 16u) | ((uint32)Buf[3] << 24u);
+}
+
+static void Fee_PutU32(uint8* Buf, uint32 Value)
+{
+    Buf[0] = (uint8)(Value & 0xFFu);
+    Buf[1] = (uint8)((Value >> 8u) & 0xFFu);
+    Buf[2] = (uint8)((Value >> 16u) & 0xFFu);
+    Buf[3] = (uint8)((Value >> 24u) & 0xFFu);
+}
+
+static uint16 Fee_Crc16(const uint8* Data, uint16 Length)
+{
+    uint16 crc = FEE_CRC16_INIT;
+    uint16 i;
+    uint8  bit;
+
+    for (i = 0u; i < Length; i++) {
+        crc ^= (uint16)((uint16)Data[i] << 8u);
+        for (bit = 0u; bit < 8u; bit++) {
+            if ((crc & 0x8000u) != 0u) {
+                crc = (uint16)((uint16)(crc << 1u) ^ FEE_CRC16_POLY);
+            } else {
+                crc = (uint16)(crc << 1u);
+            }
+        }
+    }
+    return crc;
+}
+
+static uint8 Fee_FindBlock(uint16 BlockNumber)
+{
+    uint8 i;
+
+    for (i = 0u; i < fee_cfg->numBlocks; i++) {
+        if (fee_cfg->blocks[i].blockNumber == BlockNumber) {
+            return i;
+        }
+    }
+    return FEE_MAX_BLOCKS;
+}
+
+static boolean Fee_IsErased(const uint8* Buf, Fls_LengthType Length)
+{
+    Fls_LengthType i;
+
+    for (i = 0u; i < Length; i++) {
+        if (Buf[i] != FLS_ERASED_BYTE) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/** Blank check of a whole virtual page (catches an interrupted erase) */
+static boolean Fee_IsPageBlank(uint8 Page)
+{
+    Fls_AddressType base = fee_cfg->pageAddress[Page];
+    Fls_LengthType  off;
+
+    for (off = 0u; off < fee_cfg->pageSize; off += FEE_MAX_BLOCK_SIZE) {
+        Fls_LengthType chunk = fee_cfg->pageSize - off;
+        if (chunk > FEE_MAX_BLOCK_SIZE) {
+            chunk = FEE_MAX_BLOCK_SIZE;
+        }
+        if ((Fls_Read(base + off, fee_buf, chunk) != E_OK) ||
+            (Fee_IsErased(fee_buf, chunk) == FALSE)) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static Fee_PageStateType Fee_GetPageState(uint8 Page, uint32* SeqPtr)
+{
+    uint8 hdr[FEE_PAGE_HEADER_SIZE];
+
+    if (Fls_Read(fee_cfg->pageAddress[Page], hdr, FEE_PAGE_HEADER_SIZE) != E_OK) {
+        return FEE_PAGE_INVALID;
+    }
+    if (Fee_IsErased(hdr, FEE_PAGE_HEADER_SIZE) == TRUE) {
+        return FEE_PAGE_ERASED;
+    }
+    if (Fee_GetU32(&hdr[0]) != FEE_PAGE_MAGIC) {
+        return FEE_PAGE_INVALID;
+    }
+
+    *SeqPtr = Fee_GetU32(&hdr[4]);
+
+    if (Fee_IsErased(&hdr[FEE_STATE_DWORD], FLS_DWORD_SIZE) == TRUE) {
+        return FEE_PAGE_RECEIVING;
+    }
+    if ((Fee_GetU32(&hdr[8]) == FEE_ACTIVE_MARK) &&
+        (Fee_GetU32(&hdr[12]) == ~FEE_ACTIVE_MARK)) {
+        return FEE_PAGE_ACTIVE;
+    }
+    return FEE_PAGE_INVALID;
+}
+
+/**
+ * @brief  Walk the records of the active page, index the latest committed
+ *         record of each block and find the first free slot
+ */
+static void Fee_ScanActivePage(void)
+{
+    Fls_AddressType base = fee_cfg->pageAddress[fee_active_page];
+    Fls_LengthType  off  = FEE_PAGE_HEADER_SIZE;
+
+    while ((off + FEE_RECORD_OVERHEAD) <= fee_cfg->pageSize) {
+        uint8  hdr[FLS_DWORD_SIZE];
+        uint16 blockNumber;
+        uint16 len;
+        Fls_LengthType size;
+        Fls_LengthType dataSize;
+        uint8* commit;
+        uint16 crc;
+        uint8  blk;
+
+        if (Fls_Read(base + off, hdr, FLS_DWORD_SIZE) != E_OK) {
+            off = fee_cfg->pageSize;
+            break;
+        }
+        if (Fee_IsErased(hdr, FLS_DWORD_SIZE) == TRUE) {
+            break;  /* First free slot */
+        }
+
+        blockNumber = (uint16)((uint16)hdr[0] | (uint16)((uint16)hdr[1] << 8u));
+        len         = (uint16)((uint16)hdr[2] | (uint16)((uint16)hdr[3] << 8u));
+        size        = FEE_RECORD_SIZE(len);
+
+        /* A damaged record header hides where the next record starts:
+         * treat the page as full so the next write moves to a fresh page. */
+        if (((uint16)((uint16)hdr[4] | (uint16)((uint16)hdr[5] << 8u)) != FEE_RECORD_MAGIC) ||
+            ((uint16)((uint16)hdr[6] | (uint16)((uint16)hdr[7] << 8u)) != (uint16)(~blockNumber)) ||
+            (len > FEE_MAX_BLOCK_SIZE) ||
+            ((off + size) > fee_cfg->pageSize)) {
+            off = fee_cfg->pageSize;
+            break;
+        }
+
+        /* Data + commit dword; an uncommitted (torn) record is skipped */
+        dataSize = FEE_ALIGN((Fls_LengthType)len);
+        if (Fls_Read(base + off + FLS_DWORD_SIZE, fee_buf,
+                     dataSize + FLS_DWORD_SIZE) == E_OK) {
+            commit = &fee_buf[dataSize];
+            crc    = Fee_Crc16(fee_buf, len);
+            blk    = Fee_FindBlock(blockNumber);
+
+            if ((Fee_GetU32(&commit[0]) == ((uint32)crc | ((uint32)(uint16)(~crc) << 16u))) &&
+                (Fee_GetU32(&commit[4]) == FEE_COMMIT_MAGIC) &&
+                (blk < FEE_MAX_BLOCKS) &&
+                (fee_cfg->blocks[blk].blockSize == len)) {
+                fee_index[blk] = off;
+            }
+        }
+
+        off += size;
+    }
+
+    fee_write_offset = off;
+}
+
+/**
+ * @brief  Frame the block data already at fee_buf[8] into a record
+ * @return Record size in bytes
+ */
+static Fls_LengthType Fee_FrameRecord(uint8 Blk)
+{
+    uint16 blockNumber = fee_cfg->blocks[Blk].blockNumber;
+    uint16 len         = fee_cfg->blocks[Blk].blockSize;
+    Fls_LengthType dataSize = FEE_ALIGN((Fls_LengthType)len);
+    Fls_LengthType i;
+    uint16 crc;
+
+    Fee_PutU32(&fee_buf[0], (uint32)blockNumber | ((uint32)len << 16u));
+    Fee_PutU32(&fee_buf[4], (uint32)FEE_RECORD_MAGIC |
+                            ((uint32)(uint16)(~blockNumber) << 16u));
+
+    for (i = (Fls_LengthType)len; i < dataSize; i++) {
+        fee_buf[FLS_DWORD_SIZE + i] = FLS_ERASED_BYTE;
+    }
+
+    crc = Fee_Crc16(&fee_buf[FLS_DWORD_SIZE], len);
+    Fee_PutU32(&fee_buf[FLS_DWORD_SIZE + dataSize],
+               (uint32)crc | ((uint32)(uint16)(~crc) << 16u));
+    Fee_PutU32(&fee_buf[FLS_DWORD_SIZE + dataSize + 4u], FEE_COMMIT_MAGIC);
+
+    return FEE_RECORD_SIZE(len);
+}
+
+static void Fee_LoadFromRam(uint8 Blk, const uint8* Src)
+{
+    uint16 i;
+
+    for (i = 0u; i < fee_cfg->blocks[Blk].blockSize; i++) {
+        fee_buf[FLS_DWORD_SIZE + i] = Src[i];
+    }
+}
+
+static boolean Fee_WritePending(void)
+{
+    uint8 i;
+
+    for (i = 0u; i < fee_cfg->numBlocks; i++) {
+        if (fee_pending[i] != NULL_PTR) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/** Give the target page up; it is erased and the swap retried later */
+static void Fee_AbortSwap(void)
+{
+    uint8 i;
+
+    for (i = 0u; i < fee_cfg->numBlocks; i++) {
+        if ((fee_swap_src[i] != NULL_PTR) && (fee_pending[i] == NULL_PTR)) {
+            fee_pending[i] = fee_swap_src[i];
+        }
+    }
+    fee_erase_mask |= (uint8)(1u << fee_job_page);
+    fee_result = MEMIF_JOB_FAILED;
+    fee_state  = FEE_STATE_IDLE;
+    Det_ReportRuntimeError(DET_MODULE_FEE, 0u, FEE_API_MAIN_FUNCTION,
+                           DET_E_PARAM_VALUE);
+}
+
+static void Fee_StartSwapHeader(void)
+{
+    fee_swap_seq = (fee_have_active == TRUE) ? (fee_active_seq + 1u) : 1u;
+    Fee_PutU32(&fee_dword_buf[0], FEE_PAGE_MAGIC);
+    Fee_PutU32(&fee_dword_buf[4], fee_swap_seq);
+
+    if (Fls_Write(fee_cfg->pageAddress[fee_job_page], fee_dword_buf,
+                  FLS_DWORD_SIZE) != E_OK) {
+        Fee_AbortSwap();
+        return;
+    }
+    fee_state = FEE_STATE_SWAP_HEADER;
+}
+
+static void Fee_StartSwap(void)
+{
+    uint8 i;
+
+    fee_job_page = (fee_have_active == TRUE) ?
+                   (uint8)((fee_active_page + 1u) % fee_cfg->numPages) : 0u;
+
+    for (i = 0u; i < FEE_MAX_BLOCKS; i++) {
+        fee_swap_index[i] = FEE_NO_RECORD;
+        fee_swap_src[i]   = NULL_PTR;
+    }
+
+    if ((fee_erase_mask & (uint8)(1u << fee_job_page)) != 0u) {
+        if (Fls_Erase(fee_cfg->pageAddress[fee_job_page], fee_cfg->pageSize) != E_OK) {
+            Fee_AbortSwap();
+            return;
+        }
+        fee_state = FEE_STATE_SWAP_ERASE;
+        return;
+    }
+
+    Fee_StartSwapHeader();
+}
+
+/**
+ * @brief  Copy the next block into the swap target, or activate the page
+ *         when all blocks are done. Queued data is newer than the flash
+ *         copy, so it is taken directly and its queue entry consumed.
+ */
+static void Fee_SwapCopyNext(void)
+{
+    Fls_AddressType target = fee_cfg->pageAddress[fee_job_page];
+
+    while (fee_job_block < fee_cfg->numBlocks) {
+        uint8 blk = fee_job_block;
+
+        if (fee_pending[blk] != NULL_PTR) {
+            Fee_LoadFromRam(blk, fee_pending[blk]);
+            fee_swap_src[blk] = fee_pending[blk];
+            fee_pending[blk]  = NULL_PTR;
+        } else if (fee_index[blk] != FEE_NO_RECORD) {
+            if (Fls_Read(fee_cfg->pageAddress[fee_active_page] + fee_index[blk] +
+                         FLS_DWORD_SIZE, &fee_buf[FLS_DWORD_SIZE],
+                         fee_cfg->blocks[blk].blockSize) != E_OK) {
+                Fee_AbortSwap();
+                return;
+            }
+        } else {
+            fee_job_block++;
+            continue;
+        }
+
+        fee_job_size = Fee_FrameRecord(blk);
+        if (Fls_Write(target + fee_swap_offset, fee_buf, fee_job_size) != E_OK) {
+            Fee_AbortSwap();
+            return;
+        }
+        fee_state = FEE_STATE_SWAP_COPY;
+        return;
+    }
+
+    Fee_PutU32(&fee_dword_buf[0], FEE_ACTIVE_MARK);
+    Fee_PutU32(&fee_dword_buf[4], ~FEE_ACTIVE_MARK);
+    if (Fls_Write(target + FEE_STATE_DWORD, fee_dword_buf, FLS_DWORD_SIZE) != E_OK) {
+        Fee_AbortSwap();
+        return;
+    }
+    fee_state = FEE_STATE_SWAP_ACTIVATE;
+}
+
+static void Fee_FinishSwap(void)
+{
+    uint8 i;
+
+    if (fee_have_active == TRUE) {
+        fee_erase_mask |= (uint8)(1u << fee_active_page);
+    }
+    fee_have_active  = TRUE;
+    fee_active_page  = fee_job_page;
+    fee_active_seq   = fee_swap_seq;
+    fee_write_offset = fee_swap_offset;
+    for (i = 0u; i < FEE_MAX_BLOCKS; i++) {
+        fee_index[i] = fee_swap_index[i];
+    }
+    fee_result = MEMIF_JOB_OK;
+    fee_state  = FEE_STATE_IDLE;
+}
+
+/** Start the next job from IDLE: queued writes first, then erases */
+static void Fee_StartNext(void)
+{
+    uint8 blk;
+    uint8 page;
+
+    for (blk = 0u; blk < fee_cfg->numBlocks; blk++) {
+        if (fee_pending[blk] != NULL_PTR) {
+            break;
+        }
+    }
+
+    if (blk < fee_cfg->numBlocks) {
+        Fls_LengthType size = FEE_RECORD_SIZE(fee_cfg->blocks[blk].blockSize);
+
+        if ((fee_write_offset + size) > fee_cfg->pageSize) {
+            Fee_StartSwap();
+            return;
+        }
+
+        Fee_LoadFromRam(blk, fee_pending[blk]);
+        fee_job_size = Fee_FrameRecord(blk);
+        if (Fls_Write(fee_cfg->pageAddress[fee_active_page] + fee_write_offset,
+                      fee_buf, fee_job_size) != E_OK) {
+            return;  /* Fls not ready — retry on the next call */
+        }
+        fee_pending[blk] = NULL_PTR;
+        fee_job_block    = blk;
+        fee_state        = FEE_STATE_WRITE;
+        return;
+    }
+
+    /* Nothing queued: erase a retired page. Started only now because the
+     * flash cannot suspend an erase for a write that arrives meanwhile. */
+    for (page = 0u; page < fee_cfg->numPages; page++) {
+        if ((fee_erase_mask & (uint8)(1u << page)) != 0u) {
+            if (Fls_Erase(fee_cfg->pageAddress[page], fee_cfg->pageSize) == E_OK) {
+                fee_job_page = page;
+                fee_state    = FEE_STATE_ERASE;
+            }
+            return;
+        }
+    }
+}
+
+/* ---- API Implementation ---- */
+
+void Fee_Init(const Fee_ConfigType* ConfigPtr)
+{
+    Fls_LengthType total = FEE_PAGE_HEADER_SIZE;
+    uint8  i;
+    uint32 seq = 0u;
+    uint32 bestSeq = 0u;
+
+    fee_initialized = FALSE;
+
+    if ((ConfigPtr == NULL_PTR) || (ConfigPtr->pageAddress == NULL_PTR) ||
+        (ConfigPtr->blocks == NULL_PTR)) {
+        Det_ReportError(DET_MODULE_FEE, 0u, FEE_API_INIT, DET_E_PARAM_POINTER);
+        return;
+    }
+
+    if ((ConfigPtr->numPages < FEE_MIN_PAGES) || (ConfigPtr->numPages > FEE_MAX_PAGES) ||
+        (ConfigPtr->numBlocks > FEE_MAX_BLOCKS)) {
+        Det_ReportError(DET_MODULE_FEE, 0u, FEE_API_INIT, DET_E_PARAM_VALUE);
+        return;
+    }
+
+    for (i = 0u; i < ConfigPtr->numBlocks; i++) {
+        if ((ConfigPtr->blocks[i].blockSize == 0u) ||
+            (ConfigPtr->blocks[i].blockSize > FEE_MAX_BLOCK_SIZE)) {
+            Det_ReportError(DET_MODULE_FEE, 0u, FEE_API_INIT, DET_E_PARAM_VALUE);
+            return;
+        }
+        total += FEE_RECORD_SIZE(ConfigPtr->blocks[i].blockSize);
+    }
+
+    /* A swap must always be able to hold one copy of every block */
+    if (total > ConfigPtr->pageSize) {
+        Det_ReportError(DET_MODULE_FEE, 0u, FEE_API_INIT, DET_E_PARAM_VALUE);
+        return;
+    }
+
+    fee_cfg          = ConfigPtr;
+    fee_state        = FEE_STATE_IDLE;
+    fee_result       = MEMIF_JOB_OK;
+    fee_have_active  = FALSE;
+    fee_active_page  = 0u;
+    fee_active_seq   = 0u;
+    fee_erase_mask   = 0u;
+    for (i = 0u; i < FEE_MAX_BLOCKS; i++) {
+        fee_index[i]   = FEE_NO_RECORD;
+        fee_pending[i] = NULL_PTR;
+    }
+
+    for (i = 0u; i < fee_cfg->numPages; i++) {
+        switch (Fee_GetPageState(i, &seq)) {
+        case FEE_PAGE_ACTIVE:
+            if ((fee_have_active == FALSE) || (seq > bestSeq)) {
+                if (fee_have_active == TRUE) {
+                    fee_erase_mask |= (uint8)(1u << fee_active_page);
+                }
+                fee_have_active = TRUE;
+                fee_active_page = i;
+                bestSeq = seq;
+            } else {
+                fee_erase_mask |= (uint8)(1u << i);
+            }
+            break;
+        case FEE_PAGE_ERASED:
+            if (Fee_IsPageBlank(i) == FALSE) {
+                fee_erase_mask |= (uint8)(1u << i);
+            }
+            break;
+        default:    /* Interrupted swap target or foreign data */
+            fee_erase_mask |= (uint8)(1u << i);
+            break;
+        }
+    }
+
+    if (fee_have_active == TRUE) {
+        fee_active_seq = bestSeq;
+        Fee_ScanActivePage();
+    } else {
+        /* Unformatted: the first write formats a page through a swap */
+        fee_write_offset = fee_cfg->pageSize;
+    }
+
+    fee_initialized = TRUE;
+}
+
+Std_ReturnType Fee_Read(uint16 BlockNumber, uint16 BlockOffset,
+                        uint8* DataBufferPtr, uint16 Length)
+{
+    uint8 blk;
+
+    if (fee_initialized == FALSE) {
+        Det_ReportError(DET_MODULE_FEE, 0u, FEE_API_READ, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if (DataBufferPtr == NULL_PTR) {
+        Det_ReportError(DET_MODULE_FEE, 0u, FEE_API_READ, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    blk = Fee_FindBlock(BlockNumber);
+    if ((blk >= FEE_MAX_BLOCKS) ||
+        (((uint32)BlockOffset + (uint32)Length) > (uint32)fee_cfg->blocks[blk].blockSize)) {
+        Det_ReportError(DET_MODULE_FEE, 0u, FEE_API_READ, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    if (fee_index[blk] == FEE_NO_RECORD) {
+        fee_result = MEMIF_BLOCK_INCONSISTENT;
+        return E_NOT_OK;
+    }
+
+    if (Fls_Read(fee_cfg->pageAddress[fee_active_page] + fee_index[blk] +
+                 FLS_DWORD_SIZE + BlockOffset, DataBufferPtr, Length) != E_OK) {
+        fee_result = MEMIF_JOB_FAILED;
+        return E_NOT_OK;
+    }
+
+    fee_result = MEMIF_JOB_OK;
+    return E_OK;
+}
+
+Std_ReturnType Fee_Write(uint16 BlockNumber, const uint8* DataBufferPtr)
+{
+    uint8 blk;
+
+    if (fee_initialized == FALSE) {
+        Det_ReportError(DET_MODULE_FEE, 0u, FEE_API_WRITE, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if (DataBufferPtr == NULL_PTR) {
+        Det_ReportError(DET_MODULE_FEE, 0u, FEE_API_WRITE, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    blk = Fee_FindBlock(BlockNumber);
+    if (blk >= FEE_MAX_BLOCKS) {
+        Det_ReportError(DET_MODULE_FEE, 0u, FEE_API_WRITE, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    fee_pending[blk] = DataBufferPtr;
+    fee_result = MEMIF_JOB_PENDING;
+
+    return E_OK;
+}
+
+MemIf_StatusType Fee_GetStatus(void)
+{
+    if (fee_initialized == FALSE) {
+        return MEMIF_UNINIT;
+    }
+    if (((fee_state != FEE_STATE_IDLE) && (fee_state != FEE_STATE_ERASE)) ||
+        (Fee_WritePending() == TRUE)) {
+        return MEMIF_BUSY;
+    }
+    if ((fee_state == FEE_STATE_ERASE) || (fee_erase_mask != 0u)) {
+        return MEMIF_BUSY_INTERNAL;
+    }
+    return MEMIF_IDLE;
+}
+
+MemIf_JobResultType Fee_GetJobResult(void)
+{
+    return fee_result;
+}
+
+uint16 Fee_GetBlockSize(uint16 BlockNumber)
+{
+    uint8 blk;
+
+    if (fee_initialized == FALSE) {
+        return 0u;
+    }
+    blk = Fee_FindBlock(BlockNumber);
+    return (blk < FEE_MAX_BLOCKS) ? fee_cfg->blocks[blk].blockSize : 0u;
+}
+
+void Fee_MainFunction(void)
+{
+    boolean flsOk;
+
+    if (fee_initialized == FALSE) {
+        return;
+    }
+
+    /* One Fls job at a time; Fls_MainFunction advances it */
+    if (Fls_GetStatus() == MEMIF_BUSY) {
+        return;
+    }
+
+    flsOk = (Fls_GetJobResult() == MEMIF_JOB_OK) ? TRUE : FALSE;
+
+    switch (fee_state) {
+    case FEE_STATE_WRITE:
+        if (flsOk == TRUE) {
+            fee_index[fee_job_block] = fee_write_offset;
+            fee_write_offset += fee_job_size;
+            fee_result = MEMIF_JOB_OK;
+        } else {
+            /* Tail of the page is unusable: the next write swaps */
+            fee_write_offset = fee_cfg->pageSize;
+            fee_result = MEMIF_JOB_FAILED;
+            Det_ReportRuntimeError(DET_MODULE_FEE, 0u, FEE_API_MAIN_FUNCTION,
+                                   DET_E_PARAM_VALUE);
+        }
+        fee_state = FEE_STATE_IDLE;
+        Fee_StartNext();
+        break;
+
+    case FEE_STATE_SWAP_ERASE:
+        if (flsOk == FALSE) {
+            Fee_AbortSwap();
+            break;
+        }
+        fee_erase_mask &= (uint8)~(uint8)(1u << fee_job_page);
+        Fee_StartSwapHeader();
+        break;
+
+    case FEE_STATE_SWAP_HEADER:
+        if (flsOk == FALSE) {
+            Fee_AbortSwap();
+            break;
+        }
+        fee_swap_offset = FEE_PAGE_HEADER_SIZE;
+        fee_job_block   = 0u;
+        Fee_SwapCopyNext();
+        break;
+
+    case FEE_STATE_SWAP_COPY:
+        if (flsOk == FALSE) {
+            Fee_AbortSwap();
+            break;
+        }
+        fee_swap_index[fee_job_block] = fee_swap_offset;
+        fee_swap_offset += fee_job_size;
+        fee_job_block++;
+        Fee_SwapCopyNext();
+        break;
+
+    case FEE_STATE_SWAP_ACTIVATE:
+        if (flsOk == FALSE) {
+            Fee_AbortSwap();
+            break;
+        }
+        Fee_FinishSwap();
+        Fee_StartNext();
+        break;
+
+    case FEE_STATE_ERASE:
+        if (flsOk == TRUE) {
+            fee_erase_mask &= (uint8)~(uint8)(1u << fee_job_page);
+        }
+        fee_state = FEE_STATE_IDLE;
+        Fee_StartNext();
+        break;
+
+    default:    /* FEE_STATE_IDLE */
+        Fee_StartNext();
+        break;
+    }
+}
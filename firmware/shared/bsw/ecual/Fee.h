@@ -0,0 +1,132 @@
+/**
+ * @file    Fee.h
+ * @brief   Flash EEPROM Emulation — NvM blocks on top of the Fls driver
+ * @date    2026-03-10
+ *
+ * @safety_req SWR-BSW-031
+ * @traces_to  TSR-050
+ *
+ * @details  Blocks are stored as append-only records in one ACTIVE virtual
+ *           page out of a ring of numPages (>= 2). When a record does not
+ *           fit any more, the latest copy of every block is moved to the
+ *           next page in the ring (page swap / garbage collection), the
+ *           new page is activated and the old one is erased in the
+ *           background. Rotating through the ring spreads erase cycles
+ *           evenly over all pages (wear leveling).
+ *
+ *           Page layout (offsets in bytes):
+ *             0   header dword:   FEE_PAGE_MAGIC | sequence number
+ *             8   state dword:    erased = RECEIVING, FEE_ACTIVE_MARK = ACTIVE
+ *             16  records...
+ *
+ *           Record layout (all parts double-word aligned):
+ *             header dword:  blockNumber | length | FEE_RECORD_MAGIC | ~blockNumber
+ *             data:          length bytes, padded with 0xFF
+ *             commit dword:  CRC-16 | ~CRC-16 | FEE_COMMIT_MAGIC
+ *           The commit dword is programmed last, so a record torn by a
+ *           reset is recognised and skipped at the next Fee_Init.
+ *
+ *           Writes are queued per block and serviced by Fee_MainFunction
+ *           one Fls job at a time; a second write of the same block before
+ *           it was serviced only refreshes the queued data. The STM32G4 has
+ *           no erase-suspend, so erases of old pages are deferred while any
+ *           write is queued, and reads never touch the page being erased.
+ *
+ * @standard AUTOSAR_SWS_FlashEEPROMEmulation, ISO 26262 Part 6
+ * @copyright Taktflow Systems 2026
+ */
+#ifndef FEE_H
+#define FEE_H
+
+#include "Std_Types.h"
+#include "MemIf_Types.h"
+#include "Fls.h"
+
+/* ---- Constants ---- */
+
+#define FEE_MAX_BLOCKS          8u
+#define FEE_MAX_BLOCK_SIZE      512u    /**< Largest block (staging buffer)  */
+#define FEE_MAX_PAGES           4u
+#define FEE_MIN_PAGES           2u
+
+#define FEE_PAGE_HEADER_SIZE    16u
+#define FEE_RECORD_OVERHEAD     16u     /**< Record header + commit dword    */
+
+/* ---- Configuration Types ---- */
+
+/** One Fee block */
+typedef struct {
+    uint16  blockNumber;    /**< Block number used by NvM (NvM block ID)  */
+    uint16  blockSize;      /**< Data length in bytes                     */
+} Fee_BlockConfigType;
+
+/** Fee module configuration */
+typedef struct {
+    const Fls_AddressType*      pageAddress;    /**< Start of each virtual page  */
+    uint8                       numPages;       /**< FEE_MIN_PAGES..FEE_MAX_PAGES */
+    Fls_LengthType              pageSize;       /**< Virtual page size (multiple
+                                                     of the Fls erase page)      */
+    const Fee_BlockConfigType*  blocks;
+    uint8                       numBlocks;
+} Fee_ConfigType;
+
+/* ---- API Functions ---- */
+
+/**
+ * @brief  Initialize Fee: scan the pages, rebuild the block index
+ * @param  ConfigPtr  Configuration (must not be NULL). The latest copy of
+ *                    every block must fit one page together with the page
+ *                    header.
+ * @note   Fls_Init must have been called. Runs synchronously; any page
+ *         erase it finds necessary is only scheduled.
+ */
+void Fee_Init(const Fee_ConfigType* ConfigPtr);
+
+/**
+ * @brief  Read (part of) a block from its latest valid record
+ * @param  BlockNumber    Configured block number
+ * @param  BlockOffset    Offset within the block
+ * @param  DataBufferPtr  Destination
+ * @param  Length         Bytes to read (BlockOffset + Length <= block size)
+ * @return E_OK if read; E_NOT_OK if the block was never written
+ *         (job result MEMIF_BLOCK_INCONSISTENT) or on a parameter error
+ * @note   Synchronous: flash is memory-mapped, no job is needed.
+ */
+Std_ReturnType Fee_Read(uint16 BlockNumber, uint16 BlockOffset,
+                        uint8* DataBufferPtr, uint16 Length);
+
+/**
+ * @brief  Queue a write of a whole block
+ * @param  BlockNumber    Configured block number
+ * @param  DataBufferPtr  Block data; must stay valid until the write is
+ *                        serviced (it is read when the record is built)
+ * @return E_OK if queued, E_NOT_OK on a parameter error
+ */
+Std_ReturnType Fee_Write(uint16 BlockNumber, const uint8* DataBufferPtr);
+
+/**
+ * @brief  Get module status
+ * @return MEMIF_BUSY while writes are queued or a swap is running,
+ *         MEMIF_BUSY_INTERNAL while only a background erase is running
+ */
+MemIf_StatusType Fee_GetStatus(void);
+
+/**
+ * @brief  Get result of the last read or write
+ */
+MemIf_JobResultType Fee_GetJobResult(void);
+
+/**
+ * @brief  Get the configured size of a block
+ * @return Size in bytes, 0 if the block is not configured
+ */
+uint16 Fee_GetBlockSize(uint16 BlockNumber);
+
+/**
+ * @brief  Service queued writes, page swap and background erase
+ * @note   Call cyclically, before Fls_MainFunction. Does nothing while the
+ *         Fls driver is busy.
+ */
+void Fee_MainFunction(void);
+
+#endif /* FEE_H */
@@ -13,22 +13,44 @@
  * @copyright Taktflow Systems 2026
  */
 #include "IoHwAb.h"
+#include "Spi.h"
+#include "SchM.h"
 #include "Det.h"
+#include "Bsw_Instance.h"
 
-/* ---- Internal State ---- */
+/* ---- Internal State (one set per BSW instance, see Bsw_Instance.h) ---- */
 
-static const IoHwAb_ConfigType* iohwab_config = NULL_PTR;
-static boolean                  iohwab_initialized = FALSE;
+typedef struct {
+    const IoHwAb_ConfigType* iohwab_config;
+    boolean                  iohwab_initialized;
+
+    /* Angle cache of the asynchronous read (SCHM_AREA_SPI) */
+    uint16 iohwab_angle[IOHWAB_ANGLE_COUNT];
+    uint8  iohwab_angle_valid;      /* IOHWAB_ANGLE_* */
+    uint32 iohwab_angle_time_us;
 
 #ifdef PLATFORM_POSIX
-static uint32 iohwab_enc_count_inject = 0u;
-static uint8  iohwab_enc_dir_inject   = 0u;  /* IOHWAB_MOTOR_FORWARD */
+    uint32 iohwab_enc_count_inject;
+    uint8  iohwab_enc_dir_inject;  /* IOHWAB_MOTOR_FORWARD */
 #endif
 
 #ifdef PLATFORM_HIL
-static boolean iohwab_hil_active[IOHWAB_HIL_CH_COUNT];
-static uint32 iohwab_hil_value[IOHWAB_HIL_CH_COUNT];
+    boolean iohwab_hil_active[IOHWAB_HIL_CH_COUNT];
+    uint32 iohwab_hil_value[IOHWAB_HIL_CH_COUNT];
 #endif
+} IoHwAb_ContextType;
+
+BSW_INSTANCE_STATE(IoHwAb_ContextType, iohwab_ctx);
+
+#define iohwab_config           (BSW_INSTANCE(iohwab_ctx).iohwab_config)
+#define iohwab_initialized      (BSW_INSTANCE(iohwab_ctx).iohwab_initialized)
+#define iohwab_angle            (BSW_INSTANCE(iohwab_ctx).iohwab_angle)
+#define iohwab_angle_valid      (BSW_INSTANCE(iohwab_ctx).iohwab_angle_valid)
+#define iohwab_angle_time_us    (BSW_INSTANCE(iohwab_ctx).iohwab_angle_time_us)
+#define iohwab_enc_count_inject (BSW_INSTANCE(iohwab_ctx).iohwab_enc_count_inject)
+#define iohwab_enc_dir_inject   (BSW_INSTANCE(iohwab_ctx).iohwab_enc_dir_inject)
+#define iohwab_hil_active       (BSW_INSTANCE(iohwab_ctx).iohwab_hil_active)
+#define iohwab_hil_value        (BSW_INSTANCE(iohwab_ctx).iohwab_hil_value)
 
 /* ---- Private Helpers ---- */
 
@@ -88,11 +110,60 @@ static Std_ReturnType iohwab_read_spi_angle(uint8 spiChannel,
     return E_OK;
 }
 
+/**
+ * @brief  SPI channel of an angle sensor in the asynchronous sequence
+ * @param  Index  Bit position of its IOHWAB_ANGLE_* flag
+ */
+static uint8 iohwab_angle_channel(uint8 Index)
+{
+    if (Index == 0u) {
+        return iohwab_config->PedalSpiChannel;
+    }
+    if (Index == 1u) {
+        return iohwab_config->PedalSpiChannel1;
+    }
+    return iohwab_config->SteeringSpiChannel;
+}
+
+/**
+ * @brief  Return a cached angle of the asynchronous read
+ * @param  Index  Bit position of the sensor's IOHWAB_ANGLE_* flag
+ * @param  angle  Output: 14-bit raw angle
+ * @return E_OK, E_NOT_OK if the last sequence failed or the sample is
+ *         older than AngleMaxAgeUs
+ */
+static Std_ReturnType iohwab_read_cached_angle(uint8 Index, uint16* angle)
+{
+    uint16 value;
+    uint8  valid;
+    uint32 time_us;
+
+    SchM_Enter(SCHM_AREA_SPI);
+    value   = iohwab_angle[Index];
+    valid   = iohwab_angle_valid;
+    time_us = iohwab_angle_time_us;
+    SchM_Exit(SCHM_AREA_SPI);
+
+    if ((valid & (uint8)(1u << Index)) == 0u) {
+        return E_NOT_OK;
+    }
+
+    /* Sequence overdue (not started, or its end was lost) */
+    if ((iohwab_config->GetTimestampUs() - time_us) > iohwab_config->AngleMaxAgeUs) {
+        return E_NOT_OK;
+    }
+
+    *angle = value;
+    return E_OK;
+}
+
 /**
  * @brief  Read a single ADC group and return raw value
  * @param  adcGroup     ADC group ID
  * @param  rawValue     Output: raw ADC reading
  * @return E_OK on success, E_NOT_OK on ADC failure
+ * @note   Continuous group: the start only restarts a stopped scan, and the
+ *         read returns the last (oversampled) scan without waiting.
  */
 static Std_ReturnType iohwab_read_adc(uint8 adcGroup, uint16* rawValue)
 {
@@ -118,10 +189,71 @@ void IoHwAb_Init(const IoHwAb_ConfigType* ConfigPtr)
         return;
     }
 
+    if ((ConfigPtr->AngleAsyncSensors != 0u) && (ConfigPtr->GetTimestampUs == NULL_PTR)) {
+        Det_ReportError(DET_MODULE_IOHWAB, 0u, IOHWAB_API_INIT, DET_E_PARAM_VALUE);
+        iohwab_initialized = FALSE;
+        iohwab_config = NULL_PTR;
+        return;
+    }
+
+    SchM_Enter(SCHM_AREA_SPI);
+    iohwab_angle_valid   = 0u;
+    iohwab_angle_time_us = 0u;
+    SchM_Exit(SCHM_AREA_SPI);
+
     iohwab_config = ConfigPtr;
     iohwab_initialized = TRUE;
 }
 
+void IoHwAb_MainFunction(void)
+{
+    if ((iohwab_initialized == FALSE) || (iohwab_config == NULL_PTR) ||
+        (iohwab_config->AngleAsyncSensors == 0u)) {
+        return;
+    }
+
+    (void)Spi_AsyncTransmit(iohwab_config->AngleSpiSequence);
+}
+
+void IoHwAb_AngleReadNotification(void)
+{
+    uint16 rx_data[SPI_IB_SIZE];
+    uint16 angle[IOHWAB_ANGLE_COUNT];
+    uint8  valid = 0u;
+    uint8  bit;
+    uint8  i;
+    uint32 now;
+
+    if ((iohwab_initialized == FALSE) || (iohwab_config == NULL_PTR) ||
+        (iohwab_config->AngleAsyncSensors == 0u)) {
+        return;
+    }
+
+    if (Spi_GetSequenceResult(iohwab_config->AngleSpiSequence) == SPI_SEQ_OK) {
+        for (i = 0u; i < IOHWAB_ANGLE_COUNT; i++) {
+            bit = (uint8)(1u << i);
+            angle[i] = 0u;
+            if (((iohwab_config->AngleAsyncSensors & bit) != 0u) &&
+                (Spi_ReadIB(iohwab_angle_channel(i), rx_data) == E_OK)) {
+                /* AS5048A: 14-bit angle in bits [13:0] of first word */
+                angle[i] = rx_data[0] & 0x3FFFu;
+                valid |= bit;
+            }
+        }
+    }
+    now = iohwab_config->GetTimestampUs();
+
+    SchM_Enter(SCHM_AREA_SPI);
+    for (i = 0u; i < IOHWAB_ANGLE_COUNT; i++) {
+        if ((valid & (uint8)(1u << i)) != 0u) {
+            iohwab_angle[i] = angle[i];
+        }
+    }
+    iohwab_angle_valid   = valid;
+    iohwab_angle_time_us = now;
+    SchM_Exit(SCHM_AREA_SPI);
+}
+
 Std_ReturnType IoHwAb_ReadPedalAngle(uint8 SensorId, uint16* Angle)
 {
     uint8 cs_channel;
@@ -159,6 +291,10 @@ Std_ReturnType IoHwAb_ReadPedalAngle(uint8 SensorId, uint16* Angle)
         cs_channel = iohwab_config->PedalCsChannel1;
     }
 
+    if ((iohwab_config->AngleAsyncSensors & (uint8)(1u << SensorId)) != 0u) {
+        return iohwab_read_cached_angle(SensorId, Angle);
+    }
+
     return iohwab_read_spi_angle(iohwab_config->PedalSpiChannel,
                                   iohwab_config->PedalSpiSequence,
                                   cs_channel,
@@ -184,6 +320,10 @@ Std_ReturnType IoHwAb_ReadSteeringAngle(uint16* Angle)
     }
 #endif
 
+    if ((iohwab_config->AngleAsyncSensors & IOHWAB_ANGLE_STEERING) != 0u) {
+        return iohwab_read_cached_angle(2u, Angle);
+    }
+
     return iohwab_read_spi_angle(iohwab_config->SteeringSpiChannel,
                                   iohwab_config->SteeringSpiSequence,
                                   iohwab_config->SteeringCsChannel,
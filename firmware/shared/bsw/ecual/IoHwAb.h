@@ -28,6 +28,15 @@
 #define IOHWAB_ADC_MAX_RAW     4095u  /**< 12-bit ADC max value              */
 #define IOHWAB_VREF_MV         3300u  /**< ADC reference voltage in mV       */
 
+/** Angle sensors read by the asynchronous SPI sequence (AngleAsyncSensors) */
+#define IOHWAB_ANGLE_PEDAL_0   0x01u
+#define IOHWAB_ANGLE_PEDAL_1   0x02u
+#define IOHWAB_ANGLE_STEERING  0x04u
+#define IOHWAB_ANGLE_COUNT     3u
+
+/** Time source of the angle samples, in microseconds */
+typedef uint32 (*IoHwAb_TimestampFuncType)(void);
+
 /* ---- Configuration Type ---- */
 
 /**
@@ -76,6 +85,18 @@ typedef struct {
     uint8   EncoderTimCh;          /**< Timer channel for encoder mode     */
     uint8   MotorREnChannel;       /**< DIO for BTS7960 R_EN              */
     uint8   MotorLEnChannel;       /**< DIO for BTS7960 L_EN              */
+
+    /* Asynchronous angle read: IoHwAb_MainFunction starts the SPI sequence,
+     * IoHwAb_AngleReadNotification (its end notification) caches the
+     * angles, the Read functions return the cached samples */
+    uint8   AngleAsyncSensors;      /**< IOHWAB_ANGLE_* read by the sequence;
+                                         0: synchronous reads only         */
+    uint8   AngleSpiSequence;       /**< Spi_AsyncTransmit sequence        */
+    uint8   PedalSpiChannel1;       /**< SPI channel of pedal sensor 1 in the
+                                         sequence (sensor 0: PedalSpiChannel) */
+    uint32  AngleMaxAgeUs;          /**< Older samples are not returned    */
+    IoHwAb_TimestampFuncType GetTimestampUs; /**< Sample time (required if
+                                         AngleAsyncSensors != 0)          */
 } IoHwAb_ConfigType;
 
 /* ---- External MCAL Dependencies ---- */
@@ -106,11 +127,30 @@ extern uint8 Dio_FlipChannel(uint8 ChannelId);
  */
 void IoHwAb_Init(const IoHwAb_ConfigType* ConfigPtr);
 
+/**
+ * @brief  Start the asynchronous angle sensor read (AngleSpiSequence)
+ * @note   Call once per SWC cycle, early enough for the sequence to end
+ *         before the SWCs read the angles. A sequence still pending from
+ *         the last call is not restarted; its old samples age out.
+ */
+void IoHwAb_MainFunction(void);
+
+/**
+ * @brief  End notification of AngleSpiSequence: cache and timestamp the
+ *         angles of AngleAsyncSensors
+ * @note   Configure as the sequence's Spi notification. STM32: runs in
+ *         the SPI DMA interrupt. A failed sequence invalidates the cache.
+ */
+void IoHwAb_AngleReadNotification(void);
+
 /**
  * @brief  Read pedal angle sensor via SPI (AS5048A, 14-bit)
  * @param  SensorId  Sensor index 0 or 1 (dual redundant)
  * @param  Angle     Output: raw 14-bit angle value (0..16383)
  * @return E_OK on success, E_NOT_OK on null pointer / SPI failure / invalid ID
+ * @note   A sensor in AngleAsyncSensors returns the cached sample, or
+ *         E_NOT_OK if the last sequence failed or the sample is older
+ *         than AngleMaxAgeUs.
  */
 Std_ReturnType IoHwAb_ReadPedalAngle(uint8 SensorId, uint16* Angle);
 
@@ -118,6 +158,8 @@ Std_ReturnType IoHwAb_ReadPedalAngle(uint8 SensorId, uint16* Angle);
  * @brief  Read steering angle sensor via SPI (AS5048A, 14-bit)
  * @param  Angle     Output: raw 14-bit angle value (0..16383)
  * @return E_OK on success, E_NOT_OK on null pointer / SPI failure
+ * @note   Cached sample if IOHWAB_ANGLE_STEERING is in AngleAsyncSensors,
+ *         as for IoHwAb_ReadPedalAngle.
  */
 Std_ReturnType IoHwAb_ReadSteeringAngle(uint16* Angle);
 
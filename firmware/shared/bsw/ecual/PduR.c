@@ -11,11 +11,19 @@
  */
 #include "PduR.h"
 #include "Det.h"
+#include "Bsw_Instance.h"
 
-/* ---- Internal State ---- */
+/* ---- Internal State (one set per BSW instance, see Bsw_Instance.h) ---- */
 
-static const PduR_ConfigType* pdur_config = NULL_PTR;
-static boolean pdur_initialized = FALSE;
+typedef struct {
+    const PduR_ConfigType* pdur_config;
+    boolean pdur_initialized;
+} PduR_ContextType;
+
+BSW_INSTANCE_STATE(PduR_ContextType, pdur_ctx);
+
+#define pdur_config      (BSW_INSTANCE(pdur_ctx).pdur_config)
+#define pdur_initialized (BSW_INSTANCE(pdur_ctx).pdur_initialized)
 
 /* ---- API Implementation ---- */
 
@@ -66,6 +74,12 @@ void PduR_CanIfRxIndication(PduIdType RxPduId, const PduInfoType* PduInfoPtr)
                 break;
 #endif
 
+#ifdef CANTSYN_ENABLED
+            case PDUR_DEST_CANTSYN:
+                CanTSyn_RxIndication(upper_id, PduInfoPtr);
+                break;
+#endif
+
             default:
                 /* Unknown destination — discard */
                 break;
@@ -24,6 +24,9 @@ typedef enum {
 #ifdef CANTP_ENABLED
     , PDUR_DEST_CANTP = 2u    /**< Route through ISO-TP transport layer */
 #endif
+#ifdef CANTSYN_ENABLED
+    , PDUR_DEST_CANTSYN = 3u  /**< Time synchronization (SYNC/FUP)       */
+#endif
 } PduR_DestType;
 
 /** Single routing table entry */
@@ -39,12 +42,15 @@ typedef struct {
     uint8                         routingCount;
 } PduR_ConfigType;
 
-/* ---- Upper-layer callbacks (provided by Com, Dcm, CanTp) ---- */
+/* ---- Upper-layer callbacks (provided by Com, Dcm, CanTp, CanTSyn) ---- */
 extern void Com_RxIndication(PduIdType RxPduId, const PduInfoType* PduInfoPtr);
 extern void Dcm_RxIndication(PduIdType RxPduId, const PduInfoType* PduInfoPtr);
 #ifdef CANTP_ENABLED
 extern void CanTp_RxIndication(PduIdType RxPduId, const PduInfoType* PduInfoPtr);
 #endif
+#ifdef CANTSYN_ENABLED
+extern void CanTSyn_RxIndication(PduIdType RxPduId, const PduInfoType* PduInfoPtr);
+#endif
 
 /* ---- Lower-layer interface (provided by CanIf) ---- */
 extern Std_ReturnType CanIf_Transmit(PduIdType TxPduId, const PduInfoType* PduInfoPtr);
@@ -0,0 +1,79 @@
+/**
+ * @file    Bsw_Instance.h
+ * @brief   Optional multi-instance BSW — per-ECU module state
+ * @date    2026-03-21
+ *
+ * @details By default (BSW_INSTANCE_COUNT 1) every BSW module keeps one set
+ *          of state, as on the target. Built with -DBSW_INSTANCE_COUNT=N
+ *          (N > 1, POSIX/SIL only), the instance-aware modules keep N sets
+ *          and every API works on the set of the current instance, chosen
+ *          with Bsw_SetInstance(). One host process can then step several
+ *          ECU stacks back to back, switching the instance before each one.
+ *
+ *          A module puts its former file-scope statics in one state struct
+ *          and defines it with BSW_INSTANCE_STATE. BSW_INSTANCE selects the
+ *          set of the current instance (or the only set), so the module
+ *          code keeps accessing its state by the old names through macros:
+ *
+ *              typedef struct {
+ *                  boolean com_initialized;
+ *              } Com_StateType;
+ *              BSW_INSTANCE_STATE(Com_StateType, com_state);
+ *              #define com_initialized  (BSW_INSTANCE(com_state).com_initialized)
+ *
+ *          State sets start zeroed: a module whose state needs another
+ *          start value sets it in its Init function.
+ *
+ *          The instance is switched only between steps of the host loop.
+ *          Interrupts and SIL threads that call into a module (Can_Posix
+ *          reader, SchM areas) would run on whatever instance is current,
+ *          so the multi-instance build is for single-threaded hosts.
+ *
+ * @note    Instance-aware: BswM, CanIf, CanTp, CanTSyn, Com, Dcm, Dem, Det,
+ *          IoHwAb, PduR, Rte, StbM, WdgM.
+ *
+ * @safety_req N/A — SIL simulation only; target builds use one instance
+ * @standard AUTOSAR_SWS_BSWGeneral (multiple BSW instances per ECU)
+ * @copyright Taktflow Systems 2026
+ */
+#ifndef BSW_INSTANCE_H
+#define BSW_INSTANCE_H
+
+#include "Std_Types.h"
+
+#ifndef BSW_INSTANCE_COUNT
+#define BSW_INSTANCE_COUNT      1u
+#endif
+
+/** Current instance — use Bsw_SetInstance() to change it */
+extern uint8 Bsw_CurrentInstance;
+
+#if (BSW_INSTANCE_COUNT > 1u)
+
+#define BSW_INSTANCE_STATE(type, name)  static type name[BSW_INSTANCE_COUNT]
+#define BSW_INSTANCE(name)              ((name)[Bsw_CurrentInstance])
+
+#else
+
+#define BSW_INSTANCE_STATE(type, name)  static type name
+#define BSW_INSTANCE(name)              (name)
+
+#endif
+
+typedef char bsw_instance_count_check[
+    ((BSW_INSTANCE_COUNT >= 1u) && (BSW_INSTANCE_COUNT <= 255u)) ? 1 : -1];
+
+/**
+ * @brief  Select the instance the BSW APIs work on
+ * @param  InstanceId  0 .. BSW_INSTANCE_COUNT - 1
+ * @return E_OK, E_NOT_OK if InstanceId is out of range (instance unchanged)
+ */
+Std_ReturnType Bsw_SetInstance(uint8 InstanceId);
+
+/**
+ * @brief  Get the instance the BSW APIs work on
+ * @return Current instance (always 0 in a single-instance build)
+ */
+uint8 Bsw_GetInstance(void);
+
+#endif /* BSW_INSTANCE_H */
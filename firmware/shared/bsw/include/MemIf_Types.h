@@ -0,0 +1,32 @@
+/**
+ * @file    MemIf_Types.h
+ * @brief   AUTOSAR memory stack type definitions
+ * @details Status and job result types shared by NvM, Fee and Fls.
+ *
+ * @copyright Taktflow Systems 2026
+ * @project   Taktflow Embedded — Zonal Vehicle Platform
+ * @standard  AUTOSAR R22-11, ISO 26262 Part 6
+ */
+#ifndef MEMIF_TYPES_H
+#define MEMIF_TYPES_H
+
+#include "Std_Types.h"
+
+/* Module status */
+typedef enum {
+    MEMIF_UNINIT = 0x00U,
+    MEMIF_IDLE   = 0x01U,
+    MEMIF_BUSY   = 0x02U,
+    MEMIF_BUSY_INTERNAL = 0x03U          /* Idle for callers, internal erase running */
+} MemIf_StatusType;
+
+/* Result of the last (or current) job */
+typedef enum {
+    MEMIF_JOB_OK              = 0x00U,
+    MEMIF_JOB_FAILED          = 0x01U,
+    MEMIF_JOB_PENDING         = 0x02U,
+    MEMIF_BLOCK_INCONSISTENT  = 0x03U,   /* Block never written or corrupt */
+    MEMIF_BLOCK_INVALID       = 0x04U    /* Block not configured           */
+} MemIf_JobResultType;
+
+#endif /* MEMIF_TYPES_H */
@@ -18,6 +18,8 @@ typedef unsigned int        uint32;
 typedef signed char         sint8;
 typedef signed short        sint16;
 typedef signed int          sint32;
+typedef unsigned long long  uint64;
+typedef signed long long    sint64;
 typedef float               float32;
 typedef double              float64;
 
@@ -0,0 +1,98 @@
+/**
+ * @file    Sil_CanBus.h
+ * @brief   SIL virtual CAN bus in POSIX shared memory
+ * @date    2026-03-20
+ *
+ * @details Alternative to the kernel vcan0 driver for SIL processes on one
+ *          host (or containers with ipc: host): frames go through a
+ *          broadcast ring in shared memory (Sil_CanShm.h) with no syscall
+ *          per frame. Can_Posix.c uses it when CAN_INTERFACE=shm:<name>;
+ *          sil_can_bridge connects it to a SocketCAN interface for tools
+ *          that still need vcan0.
+ *
+ *          Delivery follows a discrete bus model on the shared bus time
+ *          (Sil_Time_GetSharedUs):
+ *          - Frames requested within one bus tick (SIL_CAN_TICK_US, default
+ *            1000 us) contend together at the end of the tick and win the
+ *            bus in arbitration order: lowest CAN ID first, then request
+ *            order. A frame is seen by the other nodes one tick after its
+ *            request at the earliest, in the same order on every node.
+ *          - With SIL_CAN_BIT_TIMING=1 (read by the node that creates the
+ *            bus), a frame also occupies the bus for its worst-case stuffed
+ *            length at the bitrate of that node (e.g. 270 us for 8 bytes at
+ *            500 kbit/s) and frames queue behind it.
+ *          Every node computes the model from the same ring, so no process
+ *          owns the bus. A node does not receive its own frames, but times
+ *          them: the worst response time it observed is in its stats and
+ *          printed at exit, to set against the worst case computed offline
+ *          by tools/can_timing.
+ *
+ * @note    SIL simulation only — not compiled for STM32/TMS570 targets.
+ *
+ * @safety_req N/A — SIL simulation only, not for production
+ * @copyright Taktflow Systems 2026
+ */
+
+#ifndef SIL_CANBUS_H
+#define SIL_CANBUS_H
+
+#include "Std_Types.h"
+
+/** Bus time source in microseconds, the same in every process of the run */
+typedef uint64 (*Sil_CanBus_NowFnType)(void);
+
+/** Node accounting since Sil_CanBus_Open */
+typedef struct {
+    uint32  txFrames;       /**< Frames put on the bus                        */
+    uint32  rxFrames;       /**< Frames delivered to this node                */
+    uint32  lostFrames;     /**< Overwritten in the ring before this node read
+                                 them (node too slow for SIL_CAN_RING_SIZE)   */
+    uint32  maxBacklog;     /**< Most frames waiting for arbitration at once  */
+    uint32  maxResponseUs;  /**< Worst response time of a frame of this node:
+                                 request to end of its transmission (us)      */
+    uint32  maxResponseId;  /**< CAN ID of the frame with maxResponseUs       */
+} Sil_CanBus_StatsType;
+
+/**
+ * @brief  Join the bus, creating its shared memory segment if needed
+ * @param  name     Segment name (without '/'), e.g. "taktflow_can"
+ * @param  bitrate  Bitrate of this node in bit/s; used by the timing model
+ *                  if this node creates the bus with SIL_CAN_BIT_TIMING=1
+ * @param  nowFn    Bus time source (Sil_Time_GetSharedUs in ECUs)
+ * @return E_OK, or E_NOT_OK if the segment cannot be created or used
+ * @note   Waits up to 10 s for a segment being created by another node.
+ *         Reading starts at the current end of the ring.
+ */
+Std_ReturnType Sil_CanBus_Open(const char* name, uint32 bitrate,
+                               Sil_CanBus_NowFnType nowFn);
+
+/**
+ * @brief  Leave the bus and unmap the segment (the segment stays)
+ */
+void Sil_CanBus_Close(void);
+
+/**
+ * @brief  Request transmission of a standard or extended data frame
+ * @param  id    CAN identifier
+ * @param  data  Payload (dlc bytes)
+ * @param  dlc   0..8 (larger values are cut to 8)
+ * @return E_OK, E_NOT_OK if the bus is not open or data is NULL
+ */
+Std_ReturnType Sil_CanBus_Transmit(uint32 id, const uint8* data, uint8 dlc);
+
+/**
+ * @brief  Non-blocking receive of the next frame the bus model delivered
+ * @param  id    Output: CAN identifier
+ * @param  data  Output: payload (min 8 bytes)
+ * @param  dlc   Output: data length
+ * @return TRUE if a frame was received, FALSE otherwise
+ */
+boolean Sil_CanBus_Receive(uint32* id, uint8* data, uint8* dlc);
+
+/**
+ * @brief  Get the node accounting
+ * @param  stats  Destination (ignored if NULL)
+ */
+void Sil_CanBus_GetStats(Sil_CanBus_StatsType* stats);
+
+#endif /* SIL_CANBUS_H */
@@ -1,16 +1,25 @@
 /**
  * @file    Sil_Time.h
- * @brief   SIL time acceleration via Linux timerfd
+ * @brief   SIL time acceleration and periodic main loop timer
  * @date    2026-03-08
  *
  * @details Provides accelerated timing for SIL (Software-in-the-Loop) builds.
  *          Reads SIL_TIME_SCALE environment variable at init (default 1 = real-time).
- *          Uses timerfd_create(CLOCK_MONOTONIC) for precise periodic sleeps.
  *
  *          Scale factor N means: ECU virtual time runs N× faster than wall clock.
  *          - Sil_Time_Sleep(10000) with scale=10 → sleeps 1000 us wall clock
  *          - Sil_Time_GetTickUs() with scale=10 → returns elapsed_us * 10
  *
+ *          Main loops use Sil_Time_WaitNextPeriod: one periodic timer per
+ *          process on absolute CLOCK_MONOTONIC deadlines, so the loop
+ *          period does not stretch by the execution time of its body.
+ *
+ *          Lockstep mode (SIL_TIME_MASTER, SIL_TIME_SLOT set): all processes
+ *          share the virtual clock of a time master (sil_time_master), which
+ *          advances it only when every participant has finished its tick.
+ *          Runs are reproducible and as fast as the host allows; the wait
+ *          functions block until the master grants the next turn.
+ *
  * @note    SIL simulation only — not compiled for STM32/TMS570 targets.
  *          Guarded by PLATFORM_POSIX and excluded from PLATFORM_POSIX_TEST.
  *
@@ -23,42 +32,94 @@
 
 #include "Platform_Types.h"
 
+/** Periodic timer accounting since the first Sil_Time_WaitNextPeriod */
+typedef struct {
+    uint32  periods;        /**< Completed waits                              */
+    uint32  overruns;       /**< Waits entered after their deadline (the loop
+                                 body took longer than one period)            */
+    uint32  missed;         /**< Periods skipped to catch up after overruns   */
+    uint32  maxLateUs;      /**< Longest wake-up after a deadline, wall us
+                                 (lockstep: virtual us of tick rounding)      */
+} Sil_Time_StatsType;
+
 #if defined(PLATFORM_POSIX) && !defined(PLATFORM_POSIX_TEST)
 
 /**
  * @brief  Initialize time acceleration subsystem
  * @note   Reads SIL_TIME_SCALE env var. Call once at startup before any sleep.
  *         Thread-safe: uses internal guard against double-init.
+ *         In lockstep mode, attaches to the time master (waiting up to 10 s
+ *         for it to start) and returns within the first turn; exits the
+ *         process if the master cannot be used.
  */
 void Sil_Time_Init(void);
 
 /**
  * @brief  Accelerated sleep — sleeps for period_us / scale wall-clock microseconds
  * @param  period_us  Desired virtual sleep duration in microseconds
- * @note   Uses timerfd for sub-millisecond precision when scale > 1.
- *         Falls back to usleep if timerfd unavailable.
+ * @note   Relative: the time until the call is not compensated. Periodic
+ *         loops use Sil_Time_WaitNextPeriod.
  */
 void Sil_Time_Sleep(uint32 period_us);
 
+/**
+ * @brief  Sleep until the next deadline of the periodic main loop timer
+ * @param  period_us  Virtual loop period in microseconds
+ * @note   The first call (or a call with another period) starts the timer
+ *         one period from now. Each later call sleeps until the previous
+ *         deadline + one period (clock_nanosleep TIMER_ABSTIME). A call that
+ *         comes after its deadline returns at once and counts an overrun;
+ *         whole periods already passed are skipped and counted as missed,
+ *         so the loop does not run in a burst to catch up.
+ */
+void Sil_Time_WaitNextPeriod(uint32 period_us);
+
+/**
+ * @brief  Get the periodic timer accounting
+ * @param  stats  Destination (ignored if NULL)
+ */
+void Sil_Time_GetStats(Sil_Time_StatsType* stats);
+
 /**
  * @brief  Get virtual elapsed time since Sil_Time_Init in microseconds
  * @return Virtual elapsed microseconds (wall_elapsed × scale). Wraps at uint32 max.
+ * @note   Lockstep mode: the master's clock, the same in every participant.
  */
 uint32 Sil_Time_GetTickUs(void);
 
+/**
+ * @brief  Get virtual elapsed time since Sil_Time_Init in milliseconds
+ * @return Virtual elapsed milliseconds. Wraps at uint32 max (49 days).
+ */
+uint32 Sil_Time_GetTickMs(void);
+
+/**
+ * @brief  Get the time base shared by all SIL processes on the host
+ * @return CLOCK_MONOTONIC in microseconds × scale, or in lockstep mode the
+ *         master's virtual clock (then equal to Sil_Time_GetTickUs, unwrapped)
+ * @note   For timestamps compared across processes, e.g. the shared memory
+ *         CAN bus (Sil_CanBus.h); not relative to Sil_Time_Init.
+ */
+uint64 Sil_Time_GetSharedUs(void);
+
 /**
  * @brief  Get the active time scale factor
- * @return Scale factor (1 = real-time, 10 = 10× acceleration)
+ * @return Scale factor (1 = real-time, 10 = 10× acceleration), 0 in
+ *         lockstep mode (virtual time is not tied to the wall clock)
  */
 uint32 Sil_Time_GetScale(void);
 
 #else
 
 /* No-op stubs for unit tests and non-POSIX builds */
-#define Sil_Time_Init()          ((void)0)
-#define Sil_Time_Sleep(us)       ((void)0)
-#define Sil_Time_GetTickUs()     (0u)
-#define Sil_Time_GetScale()      (1u)
+#define Sil_Time_Init()             ((void)0)
+#define Sil_Time_Sleep(us)          ((void)0)
+#define Sil_Time_WaitNextPeriod(us) ((void)0)
+#define Sil_Time_GetStats(stats)    ((void)0)
+#define Sil_Time_GetTickUs()        (0u)
+#define Sil_Time_GetTickMs()        (0u)
+#define Sil_Time_GetSharedUs()      (0u)
+#define Sil_Time_GetScale()         (1u)
 
 #endif /* PLATFORM_POSIX && !PLATFORM_POSIX_TEST */
 
@@ -7,6 +7,10 @@
  *          abstracted through Adc_Hw_* functions (implemented per platform).
  *          Supports 12-bit right-aligned conversion, group-based operation.
  *
+ *          Continuous groups: the DMA double buffer and the index of its
+ *          last complete half are shared with the DMA interrupt and
+ *          protected by SCHM_AREA_ADC.
+ *
  * @safety_req SWR-BSW-007
  * @traces_to  SYS-049, TSR-006, TSR-008
  *
@@ -14,6 +18,7 @@
  * @copyright Taktflow Systems 2026
  */
 #include "Adc.h"
+#include "SchM.h"
 #include "Det.h"
 
 /* ---- Internal State ---- */
@@ -24,6 +29,59 @@ static uint8          adc_num_groups = 0u;
 /** Stored group configuration (pointer to caller-provided config) */
 static const Adc_GroupConfigType* adc_groups = NULL_PTR;
 
+#define ADC_NO_HALF  0xFFu
+
+/** Continuous groups: DMA double buffer (half 0, half 1) and scan state */
+static uint16  adc_dma_buf[ADC_MAX_GROUPS][2u * ADC_MAX_CHANNELS_PER_GROUP];
+static boolean adc_scan_running[ADC_MAX_GROUPS];
+static uint8   adc_scan_half[ADC_MAX_GROUPS];   /**< Last complete half */
+
+/* ---- Private Helpers ---- */
+
+/**
+ * @brief  Check the continuous-scan settings of the group table
+ * @return E_OK if every group has a valid mode, oversampling and, when
+ *         continuous, a timer-paced scan period
+ */
+static Std_ReturnType adc_check_groups(const Adc_ConfigType* ConfigPtr)
+{
+    for (uint8 g = 0u; g < ConfigPtr->numGroups; g++) {
+        const Adc_GroupConfigType* grp = &ConfigPtr->groups[g];
+
+        if (grp->conversionMode == ADC_CONV_MODE_CONTINUOUS) {
+            if ((grp->numChannels == 0u) ||
+                (grp->numChannels > ADC_MAX_CHANNELS_PER_GROUP) ||
+                (grp->oversamplingShift > ADC_MAX_OVERSAMPLING_SHIFT)) {
+                return E_NOT_OK;
+            }
+            if ((grp->triggerSource != ADC_TRIGGER_TIMER) ||
+                (grp->scanPeriodUs < ADC_MIN_SCAN_PERIOD_US)) {
+                return E_NOT_OK;   /* Free-running scan: Adc_Isr storm */
+            }
+        } else if ((grp->conversionMode != ADC_CONV_MODE_ONESHOT) ||
+                   (grp->oversamplingShift != 0u)) {
+            return E_NOT_OK;   /* Oversampling only with the continuous scan */
+        } else {
+            /* One-shot group */
+        }
+    }
+    return E_OK;
+}
+
+/**
+ * @brief  Stop all continuous scans
+ */
+static void adc_stop_scans(void)
+{
+    for (uint8 g = 0u; g < ADC_MAX_GROUPS; g++) {
+        if (adc_scan_running[g] == TRUE) {
+            Adc_Hw_StopContinuous(g);
+        }
+        adc_scan_running[g] = FALSE;
+        adc_scan_half[g] = ADC_NO_HALF;
+    }
+}
+
 /* ---- API Implementation ---- */
 
 void Adc_Init(const Adc_ConfigType* ConfigPtr)
@@ -46,6 +104,14 @@ void Adc_Init(const Adc_ConfigType* ConfigPtr)
         return;
     }
 
+    if (adc_check_groups(ConfigPtr) != E_OK) {
+        Det_ReportError(DET_MODULE_ADC, 0u, ADC_API_INIT, DET_E_PARAM_VALUE);
+        adc_status = ADC_UNINIT;
+        return;
+    }
+
+    adc_stop_scans();
+
     if (Adc_Hw_Init() != E_OK) {
         adc_status = ADC_UNINIT;
         return;
@@ -58,6 +124,7 @@ void Adc_Init(const Adc_ConfigType* ConfigPtr)
 
 void Adc_DeInit(void)
 {
+    adc_stop_scans();
     adc_status = ADC_UNINIT;
     adc_num_groups = 0u;
     adc_groups = NULL_PTR;
@@ -80,6 +147,28 @@ Std_ReturnType Adc_StartGroupConversion(uint8 Group)
         return E_NOT_OK;
     }
 
+    if (adc_groups[Group].conversionMode == ADC_CONV_MODE_CONTINUOUS) {
+        if (adc_scan_running[Group] == TRUE) {
+            return E_OK;
+        }
+        SchM_Enter(SCHM_AREA_ADC);
+        adc_scan_half[Group] = ADC_NO_HALF;
+        adc_scan_running[Group] = TRUE;
+        SchM_Exit(SCHM_AREA_ADC);
+
+        if (Adc_Hw_StartContinuous(Group, adc_dma_buf[Group],
+                                   adc_groups[Group].numChannels,
+                                   adc_groups[Group].oversamplingShift,
+                                   adc_groups[Group].scanPeriodUs) != E_OK) {
+            SchM_Enter(SCHM_AREA_ADC);
+            adc_scan_running[Group] = FALSE;
+            adc_scan_half[Group] = ADC_NO_HALF;
+            SchM_Exit(SCHM_AREA_ADC);
+            return E_NOT_OK;
+        }
+        return E_OK;
+    }
+
     adc_status = ADC_BUSY;
 
     Std_ReturnType ret = Adc_Hw_StartConversion(Group);
@@ -112,6 +201,24 @@ Std_ReturnType Adc_ReadGroup(uint8 Group, uint16* DataBufferPtr)
         return E_NOT_OK;
     }
 
+    if (adc_groups[Group].conversionMode == ADC_CONV_MODE_CONTINUOUS) {
+        Std_ReturnType ret = E_NOT_OK;
+
+        SchM_Enter(SCHM_AREA_ADC);
+        uint8 half = adc_scan_half[Group];
+        if ((adc_scan_running[Group] == TRUE) && (half != ADC_NO_HALF)) {
+            uint8 n = adc_groups[Group].numChannels;
+            const uint16* src = &adc_dma_buf[Group][half * n];
+            for (uint8 i = 0u; i < n; i++) {
+                DataBufferPtr[i] = src[i];
+            }
+            ret = E_OK;
+        }
+        SchM_Exit(SCHM_AREA_ADC);
+
+        return ret;
+    }
+
     uint8 numCh = adc_groups[Group].numChannels;
     if (numCh > ADC_MAX_CHANNELS_PER_GROUP) {
         numCh = ADC_MAX_CHANNELS_PER_GROUP;
@@ -125,3 +232,41 @@ Std_ReturnType Adc_ReadGroup(uint8 Group, uint16* DataBufferPtr)
     adc_status = ADC_IDLE;
     return E_OK;
 }
+
+Std_ReturnType Adc_StopGroupConversion(uint8 Group)
+{
+    if (adc_status == ADC_UNINIT) {
+        Det_ReportError(DET_MODULE_ADC, 0u, ADC_API_STOP_GROUP_CONVERSION, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if ((Group >= adc_num_groups) ||
+        (adc_groups[Group].conversionMode != ADC_CONV_MODE_CONTINUOUS)) {
+        Det_ReportError(DET_MODULE_ADC, 0u, ADC_API_STOP_GROUP_CONVERSION, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    if (adc_scan_running[Group] == TRUE) {
+        Adc_Hw_StopContinuous(Group);
+    }
+
+    SchM_Enter(SCHM_AREA_ADC);
+    adc_scan_running[Group] = FALSE;
+    adc_scan_half[Group] = ADC_NO_HALF;
+    SchM_Exit(SCHM_AREA_ADC);
+
+    return E_OK;
+}
+
+void Adc_Isr(uint8 Group, uint8 Half)
+{
+    if ((Group >= ADC_MAX_GROUPS) || (Half > 1u)) {
+        return;
+    }
+
+    SchM_Enter(SCHM_AREA_ADC);
+    if (adc_scan_running[Group] == TRUE) {
+        adc_scan_half[Group] = Half;
+    }
+    SchM_Exit(SCHM_AREA_ADC);
+}
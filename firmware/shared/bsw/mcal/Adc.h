@@ -3,6 +3,23 @@
  * @brief   ADC MCAL driver — AUTOSAR-like ADC interface
  * @date    2026-02-21
  *
+ * @details One-shot groups convert once per Adc_StartGroupConversion and
+ *          are read with Adc_ReadGroup.
+ *
+ *          Continuous groups scan their channels without software trigger,
+ *          one scan per scanPeriodUs, started by a hardware timer trigger.
+ *          DMA writes the results into a circular double buffer owned by
+ *          the driver: while one half is filled, the other holds the last
+ *          complete scan. The DMA half/full transfer interrupts call
+ *          Adc_Isr, and Adc_ReadGroup returns the last complete half at
+ *          once. With hardware oversampling (STM32G4 ROVSE) each result is
+ *          the mean of 2^oversamplingShift conversions, still 12-bit.
+ *
+ *          The timer bounds the Adc_Isr rate to one per scan period. A
+ *          free-running scan of a short group would interrupt every few
+ *          microseconds, each time inside SCHM_AREA_ADC; Adc_Init rejects
+ *          it, as well as periods below ADC_MIN_SCAN_PERIOD_US.
+ *
  * @safety_req SWR-BSW-007: ADC Driver for Analog Sensing
  * @traces_to  SYS-049, TSR-006, TSR-008
  *
@@ -18,6 +35,16 @@
 
 #define ADC_MAX_GROUPS              4u    /**< Max channel groups           */
 #define ADC_MAX_CHANNELS_PER_GROUP  8u    /**< Max channels in one group    */
+#define ADC_MAX_OVERSAMPLING_SHIFT  8u    /**< Up to 256x oversampling      */
+
+#define ADC_CONV_MODE_ONESHOT       0u    /**< Convert once per start       */
+#define ADC_CONV_MODE_CONTINUOUS    1u    /**< Scan into the DMA double buffer */
+
+#define ADC_TRIGGER_SW              0u    /**< Started by software          */
+#define ADC_TRIGGER_TIMER           1u    /**< Started by a timer TRGO      */
+
+#define ADC_MIN_SCAN_PERIOD_US      100u  /**< Continuous groups: at most
+                                               10k Adc_Isr/s per group   */
 
 /* ---- Types ---- */
 
@@ -32,7 +59,12 @@ typedef enum {
 /** ADC channel group configuration */
 typedef struct {
     uint8   numChannels;     /**< Number of channels in this group  */
-    uint8   triggerSource;   /**< 0=SW triggered, 1=timer triggered */
+    uint8   triggerSource;   /**< ADC_TRIGGER_* (continuous: TIMER) */
+    uint8   conversionMode;  /**< ADC_CONV_MODE_*                   */
+    uint8   oversamplingShift; /**< Continuous groups: 2^n conversions
+                                    averaged per result (0: off)     */
+    uint16  scanPeriodUs;    /**< Continuous groups: timer period of
+                                  the scan (>= ADC_MIN_SCAN_PERIOD_US) */
 } Adc_GroupConfigType;
 
 /** ADC driver configuration */
@@ -52,6 +84,19 @@ extern Std_ReturnType Adc_Hw_ReadResult(uint8 Group, uint16* ResultBuffer,
                                          uint8 NumChannels);
 extern uint8          Adc_Hw_GetStatus(uint8 Group);
 
+/**
+ * Start the continuous scan of a group in circular DMA mode, one scan
+ * every ScanPeriodUs started by the timer trigger. DmaBuffer holds
+ * 2 * NumChannels results: half 0, then half 1. The backend calls
+ * Adc_Isr(Group, 0u) when half 0 is complete and Adc_Isr(Group, 1u) when
+ * half 1 is; it may do so before returning.
+ */
+extern Std_ReturnType Adc_Hw_StartContinuous(uint8 Group, uint16* DmaBuffer,
+                                             uint8 NumChannels,
+                                             uint8 OversamplingShift,
+                                             uint16 ScanPeriodUs);
+extern void           Adc_Hw_StopContinuous(uint8 Group);
+
 /* ---- API Functions ---- */
 
 /**
@@ -75,15 +120,35 @@ Adc_StatusType Adc_GetStatus(void);
  * @brief  Start conversion for a channel group
  * @param  Group  Group index (0..ADC_MAX_GROUPS-1)
  * @return E_OK on success, E_NOT_OK on invalid params or not initialized
+ * @note   Continuous group: starts the scan; E_OK without restart if it
+ *         is already running. Does not change Adc_GetStatus.
  */
 Std_ReturnType Adc_StartGroupConversion(uint8 Group);
 
+/**
+ * @brief  Stop the scan of a continuous group
+ * @param  Group  Group index (0..ADC_MAX_GROUPS-1)
+ * @return E_OK on success, E_NOT_OK on invalid params, one-shot group or
+ *         not initialized
+ */
+Std_ReturnType Adc_StopGroupConversion(uint8 Group);
+
 /**
  * @brief  Read conversion results for a group
  * @param  Group          Group index (0..ADC_MAX_GROUPS-1)
  * @param  DataBufferPtr  Pointer to result buffer (must not be NULL)
  * @return E_OK on success, E_NOT_OK on invalid params or not initialized
+ * @note   Continuous group: the last complete scan, without waiting;
+ *         E_NOT_OK if the scan is stopped or no scan has completed yet.
  */
 Std_ReturnType Adc_ReadGroup(uint8 Group, uint16* DataBufferPtr);
 
+/**
+ * @brief  DMA half/full transfer interrupt of a continuous group
+ * @param  Group  Group index
+ * @param  Half   Completed half of the double buffer (0 or 1)
+ * @note   Called by the Adc_Hw backend; ignored for a stopped group.
+ */
+void Adc_Isr(uint8 Group, uint8 Half);
+
 #endif /* ADC_H */
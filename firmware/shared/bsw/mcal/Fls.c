@@ -0,0 +1,287 @@
+/**
+ * @file    Fls.c
+ * @brief   Flash MCAL driver implementation
+ * @date    2026-03-10
+ *
+ * @details Platform-independent job handling. Hardware access is abstracted
+ *          through Fls_Hw_* functions (STM32 FLASH registers on target, a
+ *          RAM-backed NOR simulator on the host).
+ *
+ *          Erase job:  one page at a time — start, then poll Fls_Hw_IsBusy
+ *                      on later calls (a 2 KB page erase takes ~20 ms).
+ *          Write job:  up to maxWriteDwords double-words per call; each one
+ *                      is polled for a bounded number of iterations before
+ *                      the next is started, so per-call time is bounded by
+ *                      the budget and never includes an erase.
+ *
+ * @safety_req SWR-BSW-031
+ * @traces_to  TSR-050
+ *
+ * @standard AUTOSAR_SWS_FlashDriver, ISO 26262 Part 6
+ * @copyright Taktflow Systems 2026
+ */
+#include "Fls.h"
+#include "Det.h"
+
+/* Busy polls allowed per double-word before yielding to the next call */
+#define FLS_PROGRAM_POLL_MAX    2000u
+
+/* ---- Internal State ---- */
+
+typedef enum {
+    FLS_JOB_NONE  = 0u,
+    FLS_JOB_ERASE = 1u,
+    FLS_JOB_WRITE = 2u
+} Fls_JobType;
+
+static const Fls_ConfigType* fls_cfg = NULL_PTR;
+static MemIf_StatusType      fls_status = MEMIF_UNINIT;
+static MemIf_JobResultType   fls_result = MEMIF_JOB_OK;
+
+static Fls_JobType     fls_job;
+static Fls_AddressType fls_job_addr;      /* Next page / double-word address */
+static Fls_LengthType  fls_job_remaining; /* Bytes left (incl. current op)   */
+static const uint8*    fls_job_src;
+static boolean         fls_hw_started;    /* An erase/program is in flight   */
+
+/* ---- Private Helpers ---- */
+
+static boolean Fls_InRange(Fls_AddressType Address, Fls_LengthType Length)
+{
+    if (Address < fls_cfg->baseAddress) {
+        return FALSE;
+    }
+    if ((Address - fls_cfg->baseAddress) > fls_cfg->totalSize) {
+        return FALSE;
+    }
+    return (Length <= (fls_cfg->totalSize - (Address - fls_cfg->baseAddress))) ? TRUE : FALSE;
+}
+
+static void Fls_FinishJob(MemIf_JobResultType Result)
+{
+    fls_job        = FLS_JOB_NONE;
+    fls_hw_started = FALSE;
+    fls_result     = Result;
+    fls_status     = MEMIF_IDLE;
+}
+
+/* Pack up to 8 source bytes little-endian, padding with erased bytes */
+static void Fls_PackDword(const uint8* Src, Fls_LengthType Avail,
+                          uint32* WordLo, uint32* WordHi)
+{
+    uint8  bytes[FLS_DWORD_SIZE];
+    uint8  i;
+
+    for (i = 0u; i < FLS_DWORD_SIZE; i++) {
+        bytes[i] = (i < Avail) ? Src[i] : FLS_ERASED_BYTE;
+    }
+
+    *WordLo = (uint32)bytes[0] | ((uint32)bytes[1] << 8u) |
+              ((uint32)bytes[2] << 16u) | ((uint32)bytes[3] << 24u);
+    *WordHi = (uint32)bytes[4] | ((uint32)bytes[5] << 8u) |
+              ((uint32)bytes[6] << 16u) | ((uint32)bytes[7] << 24u);
+}
+
+/* ---- API Implementation ---- */
+
+void Fls_Init(const Fls_ConfigType* ConfigPtr)
+{
+    if (ConfigPtr == NULL_PTR) {
+        Det_ReportError(DET_MODULE_FLS, 0u, FLS_API_INIT, DET_E_PARAM_POINTER);
+        fls_status = MEMIF_UNINIT;
+        return;
+    }
+
+    if ((ConfigPtr->pageSize == 0u) ||
+        ((ConfigPtr->pageSize % FLS_DWORD_SIZE) != 0u) ||
+        ((ConfigPtr->totalSize % ConfigPtr->pageSize) != 0u) ||
+        (ConfigPtr->maxWriteDwords == 0u)) {
+        Det_ReportError(DET_MODULE_FLS, 0u, FLS_API_INIT, DET_E_PARAM_VALUE);
+        fls_status = MEMIF_UNINIT;
+        return;
+    }
+
+    if (Fls_Hw_Init() != E_OK) {
+        fls_status = MEMIF_UNINIT;
+        return;
+    }
+
+    fls_cfg = ConfigPtr;
+    fls_job = FLS_JOB_NONE;
+    fls_hw_started = FALSE;
+    fls_result = MEMIF_JOB_OK;
+    fls_status = MEMIF_IDLE;
+}
+
+Std_ReturnType Fls_Erase(Fls_AddressType TargetAddress, Fls_LengthType Length)
+{
+    if (fls_status == MEMIF_UNINIT) {
+        Det_ReportError(DET_MODULE_FLS, 0u, FLS_API_ERASE, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if ((Length == 0u) || (Fls_InRange(TargetAddress, Length) == FALSE) ||
+        (((TargetAddress - fls_cfg->baseAddress) % fls_cfg->pageSize) != 0u) ||
+        ((Length % fls_cfg->pageSize) != 0u)) {
+        Det_ReportError(DET_MODULE_FLS, 0u, FLS_API_ERASE, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    if (fls_status == MEMIF_BUSY) {
+        return E_NOT_OK;
+    }
+
+    fls_job           = FLS_JOB_ERASE;
+    fls_job_addr      = TargetAddress;
+    fls_job_remaining = Length;
+    fls_hw_started    = FALSE;
+    fls_result        = MEMIF_JOB_PENDING;
+    fls_status        = MEMIF_BUSY;
+
+    return E_OK;
+}
+
+Std_ReturnType Fls_Write(Fls_AddressType TargetAddress,
+                         const uint8* SourceAddressPtr, Fls_LengthType Length)
+{
+    if (fls_status == MEMIF_UNINIT) {
+        Det_ReportError(DET_MODULE_FLS, 0u, FLS_API_WRITE, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if (SourceAddressPtr == NULL_PTR) {
+        Det_ReportError(DET_MODULE_FLS, 0u, FLS_API_WRITE, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    if ((Length == 0u) || (Fls_InRange(TargetAddress, Length) == FALSE) ||
+        (((TargetAddress - fls_cfg->baseAddress) % FLS_DWORD_SIZE) != 0u)) {
+        Det_ReportError(DET_MODULE_FLS, 0u, FLS_API_WRITE, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    if (fls_status == MEMIF_BUSY) {
+        return E_NOT_OK;
+    }
+
+    fls_job           = FLS_JOB_WRITE;
+    fls_job_addr      = TargetAddress;
+    fls_job_remaining = Length;
+    fls_job_src       = SourceAddressPtr;
+    fls_hw_started    = FALSE;
+    fls_result        = MEMIF_JOB_PENDING;
+    fls_status        = MEMIF_BUSY;
+
+    return E_OK;
+}
+
+Std_ReturnType Fls_Read(Fls_AddressType SourceAddress,
+                        uint8* TargetAddressPtr, Fls_LengthType Length)
+{
+    if (fls_status == MEMIF_UNINIT) {
+        Det_ReportError(DET_MODULE_FLS, 0u, FLS_API_READ, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if (TargetAddressPtr == NULL_PTR) {
+        Det_ReportError(DET_MODULE_FLS, 0u, FLS_API_READ, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    if (Fls_InRange(SourceAddress, Length) == FALSE) {
+        Det_ReportError(DET_MODULE_FLS, 0u, FLS_API_READ, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    /* No erase-suspend on STM32G4: a read of the page under erase would
+     * stall the bus for the rest of the erase. Refuse it instead. */
+    if ((fls_job == FLS_JOB_ERASE) && (fls_hw_started == TRUE) &&
+        (SourceAddress < (fls_job_addr + fls_cfg->pageSize)) &&
+        ((SourceAddress + Length) > fls_job_addr)) {
+        return E_NOT_OK;
+    }
+
+    Fls_Hw_Read(SourceAddress, TargetAddressPtr, Length);
+
+    return E_OK;
+}
+
+MemIf_StatusType Fls_GetStatus(void)
+{
+    return fls_status;
+}
+
+MemIf_JobResultType Fls_GetJobResult(void)
+{
+    return fls_result;
+}
+
+void Fls_MainFunction(void)
+{
+    uint16 budget;
+    uint32 lo;
+    uint32 hi;
+    Fls_LengthType step;
+
+    if ((fls_status != MEMIF_BUSY) || (fls_job == FLS_JOB_NONE)) {
+        return;
+    }
+
+    budget = fls_cfg->maxWriteDwords;
+
+    for (;;) {
+        /* A double-word program takes ~85 us: poll it briefly while there is
+         * budget left. An erase (or an overrun) is polled on the next call. */
+        if (fls_hw_started == TRUE) {
+            if ((fls_job == FLS_JOB_WRITE) && (budget > 0u)) {
+                uint16 spin = 0u;
+                while ((Fls_Hw_IsBusy() == TRUE) && (spin < FLS_PROGRAM_POLL_MAX)) {
+                    spin++;
+                }
+            }
+            if (Fls_Hw_IsBusy() == TRUE) {
+                return;
+            }
+            fls_hw_started = FALSE;
+
+            if (Fls_Hw_GetResult() != E_OK) {
+                Det_ReportRuntimeError(DET_MODULE_FLS, 0u, FLS_API_MAIN_FUNCTION,
+                                       DET_E_PARAM_VALUE);
+                Fls_FinishJob(MEMIF_JOB_FAILED);
+                return;
+            }
+
+            step = (fls_job == FLS_JOB_ERASE) ? fls_cfg->pageSize : FLS_DWORD_SIZE;
+            if (fls_job_remaining <= step) {
+                Fls_FinishJob(MEMIF_JOB_OK);
+                return;
+            }
+            fls_job_remaining -= step;
+            fls_job_addr      += step;
+            if (fls_job == FLS_JOB_WRITE) {
+                fls_job_src = &fls_job_src[FLS_DWORD_SIZE];
+            }
+        }
+
+        if (fls_job == FLS_JOB_ERASE) {
+            if (Fls_Hw_StartErase(fls_job_addr) != E_OK) {
+                Fls_FinishJob(MEMIF_JOB_FAILED);
+                return;
+            }
+            fls_hw_started = TRUE;
+            return;  /* Erase takes milliseconds — poll on next call */
+        }
+
+        if (budget == 0u) {
+            return;
+        }
+        budget--;
+
+        Fls_PackDword(fls_job_src, fls_job_remaining, &lo, &hi);
+        if (Fls_Hw_StartProgram(fls_job_addr, lo, hi) != E_OK) {
+            Fls_FinishJob(MEMIF_JOB_FAILED);
+            return;
+        }
+        fls_hw_started = TRUE;
+    }
+}
@@ -0,0 +1,108 @@
+/**
+ * @file    Fls.h
+ * @brief   Flash MCAL driver — non-blocking erase / double-word program
+ * @date    2026-03-10
+ *
+ * @safety_req SWR-BSW-031
+ * @traces_to  TSR-050
+ *
+ * @details  Erase and write are jobs: the API call only validates and
+ *           queues them, Fls_MainFunction advances them. Writes are split
+ *           into 64-bit double-words (STM32G4 programming unit); at most
+ *           maxWriteDwords are programmed per call, so per-call time is
+ *           bounded. Page erases are started and then polled, never waited
+ *           on. Reads are synchronous (flash is memory-mapped) and refuse
+ *           the page that is currently being erased.
+ *
+ * @standard AUTOSAR_SWS_FlashDriver, ISO 26262 Part 6
+ * @copyright Taktflow Systems 2026
+ */
+#ifndef FLS_H
+#define FLS_H
+
+#include "Std_Types.h"
+#include "MemIf_Types.h"
+
+/* ---- Constants ---- */
+
+#define FLS_DWORD_SIZE      8u      /**< Programming unit in bytes       */
+#define FLS_ERASED_BYTE     0xFFu   /**< Value of an erased flash byte   */
+
+/* ---- Types ---- */
+
+typedef uint32 Fls_AddressType;
+typedef uint32 Fls_LengthType;
+
+/** Flash driver configuration */
+typedef struct {
+    Fls_AddressType baseAddress;    /**< First byte of the managed area       */
+    Fls_LengthType  totalSize;      /**< Size of the managed area in bytes    */
+    Fls_LengthType  pageSize;       /**< Erase granularity in bytes           */
+    uint16          maxWriteDwords; /**< Double-words per Fls_MainFunction    */
+} Fls_ConfigType;
+
+/* ---- Hardware Abstraction (implemented per platform) ----
+ * STM32: mcal/target/Fls_Hw_STM32.c
+ * Host:  mcal/posix/Fls_Posix.c (flash simulator with wear statistics)
+ */
+extern Std_ReturnType Fls_Hw_Init(void);
+extern Std_ReturnType Fls_Hw_StartErase(Fls_AddressType PageAddress);
+extern Std_ReturnType Fls_Hw_StartProgram(Fls_AddressType Address,
+                                          uint32 WordLo, uint32 WordHi);
+extern boolean        Fls_Hw_IsBusy(void);
+extern Std_ReturnType Fls_Hw_GetResult(void);
+extern void           Fls_Hw_Read(Fls_AddressType Address, uint8* DstPtr,
+                                  Fls_LengthType Length);
+
+/* ---- API Functions ---- */
+
+/**
+ * @brief  Initialize flash driver and hardware
+ * @param  ConfigPtr  Configuration (must not be NULL, page size a multiple
+ *                    of FLS_DWORD_SIZE)
+ */
+void Fls_Init(const Fls_ConfigType* ConfigPtr);
+
+/**
+ * @brief  Queue an erase of one or more whole pages
+ * @param  TargetAddress  Page-aligned start address
+ * @param  Length         Multiple of the page size
+ * @return E_OK if accepted, E_NOT_OK if busy, uninitialised or misaligned
+ */
+Std_ReturnType Fls_Erase(Fls_AddressType TargetAddress, Fls_LengthType Length);
+
+/**
+ * @brief  Queue a write job
+ * @param  TargetAddress     Double-word aligned start address
+ * @param  SourceAddressPtr  Data; must stay valid until the job finishes
+ * @param  Length            Bytes; a partial last double-word is padded
+ *                           with FLS_ERASED_BYTE
+ * @return E_OK if accepted, E_NOT_OK if busy, uninitialised or misaligned
+ */
+Std_ReturnType Fls_Write(Fls_AddressType TargetAddress,
+                         const uint8* SourceAddressPtr, Fls_LengthType Length);
+
+/**
+ * @brief  Read flash synchronously
+ * @return E_OK, or E_NOT_OK if out of range or the range overlaps the page
+ *         currently being erased
+ */
+Std_ReturnType Fls_Read(Fls_AddressType SourceAddress,
+                        uint8* TargetAddressPtr, Fls_LengthType Length);
+
+/**
+ * @brief  Get driver status (MEMIF_BUSY while a job is queued or running)
+ */
+MemIf_StatusType Fls_GetStatus(void);
+
+/**
+ * @brief  Get result of the last job
+ */
+MemIf_JobResultType Fls_GetJobResult(void);
+
+/**
+ * @brief  Advance the current job — call cyclically
+ */
+void Fls_MainFunction(void);
+
+#endif /* FLS_H */
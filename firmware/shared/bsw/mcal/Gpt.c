@@ -6,7 +6,9 @@
  * @details Platform-independent GPT driver logic. Hardware access is
  *          abstracted through Gpt_Hw_* functions (implemented per platform).
  *          Provides microsecond-resolution timing for timeouts, WCET
- *          measurement, and periodic scheduling.
+ *          measurement, and periodic scheduling. The backend reports
+ *          channel expiry through Gpt_Isr, which calls the channel
+ *          notification (AUTOSAR GptNotification) if enabled.
  *
  * @safety_req SWR-BSW-010
  * @traces_to  SYS-053, TSR-046, TSR-047
@@ -22,6 +24,8 @@
 static Gpt_StatusType gpt_status = GPT_UNINIT;
 static uint8          gpt_num_channels = 0u;
 static boolean        gpt_ch_running[GPT_MAX_CHANNELS];
+static boolean        gpt_ch_notify[GPT_MAX_CHANNELS];
+static const Gpt_ChannelConfigType* gpt_ch_config = NULL_PTR;
 
 /* ---- API Implementation ---- */
 
@@ -51,10 +55,12 @@ void Gpt_Init(const Gpt_ConfigType* ConfigPtr)
     }
 
     gpt_num_channels = ConfigPtr->numChannels;
+    gpt_ch_config    = ConfigPtr->channels;
 
-    /* Mark all channels as stopped */
+    /* Mark all channels as stopped, notifications disabled */
     for (uint8 ch = 0u; ch < GPT_MAX_CHANNELS; ch++) {
         gpt_ch_running[ch] = FALSE;
+        gpt_ch_notify[ch]  = FALSE;
     }
 
     gpt_status = GPT_INITIALIZED;
@@ -70,8 +76,13 @@ void Gpt_DeInit(void)
         }
     }
 
+    for (uint8 ch = 0u; ch < GPT_MAX_CHANNELS; ch++) {
+        gpt_ch_notify[ch] = FALSE;
+    }
+
     gpt_status = GPT_UNINIT;
     gpt_num_channels = 0u;
+    gpt_ch_config = NULL_PTR;
 }
 
 Gpt_StatusType Gpt_GetStatus(void)
@@ -140,3 +151,53 @@ uint32 Gpt_GetTimeElapsed(uint8 Channel)
 
     return Gpt_Hw_GetCounter(Channel);
 }
+
+Std_ReturnType Gpt_EnableNotification(uint8 Channel)
+{
+    if (gpt_status != GPT_INITIALIZED) {
+        Det_ReportError(DET_MODULE_GPT, 0u, GPT_API_ENABLE_NOTIFICATION, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if ((Channel >= gpt_num_channels) || (gpt_ch_config[Channel].notification == NULL_PTR)) {
+        Det_ReportError(DET_MODULE_GPT, 0u, GPT_API_ENABLE_NOTIFICATION, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    gpt_ch_notify[Channel] = TRUE;
+    return E_OK;
+}
+
+Std_ReturnType Gpt_DisableNotification(uint8 Channel)
+{
+    if (gpt_status != GPT_INITIALIZED) {
+        Det_ReportError(DET_MODULE_GPT, 0u, GPT_API_DISABLE_NOTIFICATION, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if (Channel >= gpt_num_channels) {
+        Det_ReportError(DET_MODULE_GPT, 0u, GPT_API_DISABLE_NOTIFICATION, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    gpt_ch_notify[Channel] = FALSE;
+    return E_OK;
+}
+
+void Gpt_Isr(uint8 Channel)
+{
+    /* Spurious or late interrupt (stopped / de-initialized): ignore */
+    if ((gpt_status != GPT_INITIALIZED) || (Channel >= gpt_num_channels) ||
+        (gpt_ch_running[Channel] == FALSE)) {
+        return;
+    }
+
+    if (gpt_ch_config[Channel].mode == GPT_MODE_ONESHOT) {
+        (void)Gpt_Hw_StopTimer(Channel);
+        gpt_ch_running[Channel] = FALSE;
+    }
+
+    if (gpt_ch_notify[Channel] == TRUE) {
+        gpt_ch_config[Channel].notification();
+    }
+}
@@ -32,11 +32,15 @@ typedef enum {
     GPT_MODE_CONTINUOUS = 1u    /**< Timer auto-reloads (free-running) */
 } Gpt_ModeType;
 
+/** Channel notification, called from the timer interrupt on expiry */
+typedef void (*Gpt_NotificationType)(void);
+
 /** GPT channel configuration */
 typedef struct {
     uint16       prescaler;   /**< Timer prescaler value               */
     uint32       period;      /**< Timer period (in ticks)             */
     Gpt_ModeType mode;        /**< One-shot or continuous              */
+    Gpt_NotificationType notification; /**< NULL: none                 */
 } Gpt_ChannelConfigType;
 
 /** GPT driver configuration */
@@ -46,7 +50,8 @@ typedef struct {
 } Gpt_ConfigType;
 
 /* ---- Hardware Abstraction (implemented per platform) ----
- * STM32: mcal/Gpt_Hw_STM32.c
+ * STM32: mcal/Gpt_Hw_STM32.c (TIMx update interrupt -> Gpt_Isr)
+ * POSIX: mcal/posix/Gpt_Posix.c (Gpt_Posix_Poll -> Gpt_Isr)
  * Test:  Mocked in test/test_Gpt.c
  */
 extern Std_ReturnType Gpt_Hw_Init(void);
@@ -54,6 +59,15 @@ extern Std_ReturnType Gpt_Hw_StartTimer(uint8 Channel, uint32 Value);
 extern Std_ReturnType Gpt_Hw_StopTimer(uint8 Channel);
 extern uint32         Gpt_Hw_GetCounter(uint8 Channel);
 
+/**
+ * @brief  Channel expiry, called by the platform backend from the timer
+ *         interrupt when a started channel reaches its target value
+ * @param  Channel  Channel index
+ * @note   A one-shot channel is stopped (Gpt_Hw_StopTimer); the channel
+ *         notification is called if enabled (Gpt_EnableNotification).
+ */
+void Gpt_Isr(uint8 Channel);
+
 /* ---- API Functions ---- */
 
 /**
@@ -95,4 +109,19 @@ Std_ReturnType Gpt_StopTimer(uint8 Channel);
  */
 uint32 Gpt_GetTimeElapsed(uint8 Channel);
 
+/**
+ * @brief  Enable the expiry notification of a channel
+ * @param  Channel  Channel index (0..GPT_MAX_CHANNELS-1)
+ * @return E_OK on success, E_NOT_OK on invalid params, no notification
+ *         configured or not initialized
+ */
+Std_ReturnType Gpt_EnableNotification(uint8 Channel);
+
+/**
+ * @brief  Disable the expiry notification of a channel
+ * @param  Channel  Channel index (0..GPT_MAX_CHANNELS-1)
+ * @return E_OK on success, E_NOT_OK on invalid params or not initialized
+ */
+Std_ReturnType Gpt_DisableNotification(uint8 Channel);
+
 #endif /* GPT_H */
@@ -7,6 +7,12 @@
  *          abstracted through Spi_Hw_* functions (implemented per platform).
  *          Supports AS5048A angle sensors via CPOL=0, CPHA=1, 16-bit.
  *
+ *          Asynchronous sequences wait in a FIFO of SPI_MAX_SEQUENCES
+ *          entries; a sequence is queued at most once (pending sequences
+ *          are rejected), so the FIFO cannot overflow. One job is on the
+ *          bus at a time. The queue is shared with the SPI interrupt and
+ *          protected by SCHM_AREA_SPI; notifications run outside of it.
+ *
  * @safety_req SWR-BSW-006
  * @traces_to  SYS-047, TSR-001, TSR-010
  *
@@ -14,6 +20,8 @@
  * @copyright Taktflow Systems 2026
  */
 #include "Spi.h"
+#include "Dio.h"
+#include "SchM.h"
 #include "Det.h"
 
 /* ---- Internal State ---- */
@@ -28,6 +36,165 @@ static uint8  spi_tx_len[SPI_MAX_CHANNELS];
 /** Internal receive buffers (one per channel) */
 static uint16 spi_rx_buf[SPI_MAX_CHANNELS][SPI_IB_SIZE];
 
+/** Asynchronous transmission */
+static const Spi_ConfigType* spi_config = NULL_PTR;
+static Spi_JobResultType spi_job_result[SPI_MAX_JOBS];
+static Spi_SeqResultType spi_seq_result[SPI_MAX_SEQUENCES];
+static uint8   spi_queue[SPI_MAX_SEQUENCES];    /**< Waiting sequences (FIFO) */
+static uint8   spi_queue_head  = 0u;
+static uint8   spi_queue_count = 0u;
+static boolean spi_async_busy  = FALSE;         /**< A sequence is active     */
+static uint8   spi_active_seq  = 0u;
+static uint8   spi_active_pos  = 0u;            /**< Job index in the sequence */
+
+/* ---- Private Helpers ---- */
+
+/**
+ * @brief  Check the job and sequence tables of a configuration
+ * @return E_OK if every job and sequence refers to valid IDs
+ */
+static Std_ReturnType spi_check_async_config(const Spi_ConfigType* ConfigPtr)
+{
+    if ((ConfigPtr->numJobs > SPI_MAX_JOBS) ||
+        (ConfigPtr->numSequences > SPI_MAX_SEQUENCES) ||
+        ((ConfigPtr->numJobs > 0u) && (ConfigPtr->jobs == NULL_PTR)) ||
+        ((ConfigPtr->numSequences > 0u) && (ConfigPtr->sequences == NULL_PTR))) {
+        return E_NOT_OK;
+    }
+
+    for (uint8 j = 0u; j < ConfigPtr->numJobs; j++) {
+        if (ConfigPtr->jobs[j].channel >= ConfigPtr->numChannels) {
+            return E_NOT_OK;
+        }
+    }
+
+    for (uint8 q = 0u; q < ConfigPtr->numSequences; q++) {
+        const Spi_SequenceConfigType* seq = &ConfigPtr->sequences[q];
+
+        if ((seq->jobs == NULL_PTR) || (seq->numJobs == 0u) ||
+            (seq->numJobs > SPI_MAX_JOBS)) {
+            return E_NOT_OK;
+        }
+        for (uint8 j = 0u; j < seq->numJobs; j++) {
+            if (seq->jobs[j] >= ConfigPtr->numJobs) {
+                return E_NOT_OK;
+            }
+        }
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief  Make the next queued sequence active, or go idle (area held)
+ */
+static void spi_next_sequence(void)
+{
+    if (spi_queue_count == 0u) {
+        spi_async_busy = FALSE;
+        spi_status = SPI_IDLE;
+        return;
+    }
+
+    spi_active_seq = spi_queue[spi_queue_head];
+    spi_active_pos = 0u;
+    spi_queue_head = (uint8)((spi_queue_head + 1u) % SPI_MAX_SEQUENCES);
+    spi_queue_count--;
+}
+
+/**
+ * @brief  Select the chip and start the active job (area held)
+ * @return E_OK if the transfer was started
+ */
+static Std_ReturnType spi_start_job(void)
+{
+    uint8 job = spi_config->sequences[spi_active_seq].jobs[spi_active_pos];
+    const Spi_JobConfigType* cfg = &spi_config->jobs[job];
+    uint8 len = spi_tx_len[cfg->channel];
+
+    if (len == 0u) {
+        len = 1u; /* Default: transmit at least one word */
+    }
+
+    spi_job_result[job] = SPI_JOB_PENDING;
+    Dio_WriteChannel(cfg->csChannel, STD_LOW);
+
+    if (Spi_Hw_AsyncTransmit(cfg->channel, spi_tx_buf[cfg->channel],
+                             spi_rx_buf[cfg->channel], len) != E_OK) {
+        Dio_WriteChannel(cfg->csChannel, STD_HIGH);
+        return E_NOT_OK;
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief  End the active job; a failed or last job ends its sequence
+ *         (area held)
+ * @param  Result  Transfer result of the job
+ * @param  Ended   Out: TRUE if the sequence has ended
+ * @return Notification of the ended sequence (may be NULL), else NULL
+ */
+static Spi_NotificationType spi_end_job(Std_ReturnType Result, boolean* Ended)
+{
+    const Spi_SequenceConfigType* seq = &spi_config->sequences[spi_active_seq];
+    uint8 job = seq->jobs[spi_active_pos];
+
+    Dio_WriteChannel(spi_config->jobs[job].csChannel, STD_HIGH);
+    spi_job_result[job] = (Result == E_OK) ? SPI_JOB_OK : SPI_JOB_FAILED;
+    spi_active_pos++;
+
+    if ((Result == E_OK) && (spi_active_pos < seq->numJobs)) {
+        *Ended = FALSE;
+        return NULL_PTR;
+    }
+
+    /* Jobs after a failed one are not transmitted */
+    for (; spi_active_pos < seq->numJobs; spi_active_pos++) {
+        spi_job_result[seq->jobs[spi_active_pos]] = SPI_JOB_FAILED;
+    }
+    spi_seq_result[spi_active_seq] = (Result == E_OK) ? SPI_SEQ_OK : SPI_SEQ_FAILED;
+    spi_next_sequence();
+
+    *Ended = TRUE;
+    return seq->notification;
+}
+
+/**
+ * @brief  Start the active job; end the sequences whose job cannot be
+ *         started (area held)
+ * @param  Notify  Out: notifications of the ended sequences
+ * @return Number of entries written to Notify
+ * @note   At most SPI_MAX_SEQUENCES sequences are pending, and each ends
+ *         once, so Notify needs no more entries than that.
+ */
+static uint8 spi_run(Spi_NotificationType* Notify)
+{
+    uint8   count = 0u;
+    boolean ended;
+    Spi_NotificationType n;
+
+    while ((spi_async_busy == TRUE) && (spi_start_job() != E_OK)) {
+        n = spi_end_job(E_NOT_OK, &ended);
+        if ((ended == TRUE) && (n != NULL_PTR)) {
+            Notify[count] = n;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief  Call the notifications of ended sequences (area not held)
+ */
+static void spi_notify(const Spi_NotificationType* Notify, uint8 Count)
+{
+    for (uint8 i = 0u; i < Count; i++) {
+        Notify[i]();
+    }
+}
+
 /* ---- API Implementation ---- */
 
 void Spi_Init(const Spi_ConfigType* ConfigPtr)
@@ -44,12 +211,29 @@ void Spi_Init(const Spi_ConfigType* ConfigPtr)
         return;
     }
 
+    if (spi_check_async_config(ConfigPtr) != E_OK) {
+        Det_ReportError(DET_MODULE_SPI, 0u, SPI_API_INIT, DET_E_PARAM_VALUE);
+        spi_status = SPI_UNINIT;
+        return;
+    }
+
     if (Spi_Hw_Init() != E_OK) {
         spi_status = SPI_UNINIT;
         return;
     }
 
     spi_num_channels = ConfigPtr->numChannels;
+    spi_config = ConfigPtr;
+
+    for (uint8 j = 0u; j < SPI_MAX_JOBS; j++) {
+        spi_job_result[j] = SPI_JOB_OK;
+    }
+    for (uint8 q = 0u; q < SPI_MAX_SEQUENCES; q++) {
+        spi_seq_result[q] = SPI_SEQ_OK;
+    }
+    spi_queue_head  = 0u;
+    spi_queue_count = 0u;
+    spi_async_busy  = FALSE;
 
     /* Clear internal buffers */
     for (uint8 ch = 0u; ch < SPI_MAX_CHANNELS; ch++) {
@@ -67,6 +251,9 @@ void Spi_DeInit(void)
 {
     spi_status = SPI_UNINIT;
     spi_num_channels = 0u;
+    spi_config = NULL_PTR;
+    spi_queue_count = 0u;
+    spi_async_busy = FALSE;
 }
 
 Spi_StatusType Spi_GetStatus(void)
@@ -137,6 +324,11 @@ Std_ReturnType Spi_SyncTransmit(uint8 Sequence)
         return E_NOT_OK;
     }
 
+    /* One bus: no synchronous transfer between queued jobs */
+    if (spi_async_busy == TRUE) {
+        return E_NOT_OK;
+    }
+
     spi_status = SPI_BUSY;
 
     uint8 len = spi_tx_len[channel];
@@ -155,3 +347,105 @@ Std_ReturnType Spi_SyncTransmit(uint8 Sequence)
 
     return E_OK;
 }
+
+Std_ReturnType Spi_AsyncTransmit(uint8 Sequence)
+{
+    Spi_NotificationType notify[SPI_MAX_SEQUENCES];
+    uint8   count = 0u;
+    const Spi_SequenceConfigType* seq;
+
+    if (spi_status == SPI_UNINIT) {
+        Det_ReportError(DET_MODULE_SPI, 0u, SPI_API_ASYNC_TRANSMIT, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if (Sequence >= spi_config->numSequences) {
+        Det_ReportError(DET_MODULE_SPI, 0u, SPI_API_ASYNC_TRANSMIT, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    seq = &spi_config->sequences[Sequence];
+
+    SchM_Enter(SCHM_AREA_SPI);
+
+    if (spi_seq_result[Sequence] == SPI_SEQ_PENDING) {
+        SchM_Exit(SCHM_AREA_SPI);
+        return E_NOT_OK;
+    }
+
+    spi_seq_result[Sequence] = SPI_SEQ_PENDING;
+    for (uint8 j = 0u; j < seq->numJobs; j++) {
+        spi_job_result[seq->jobs[j]] = SPI_JOB_QUEUED;
+    }
+
+    spi_queue[(spi_queue_head + spi_queue_count) % SPI_MAX_SEQUENCES] = Sequence;
+    spi_queue_count++;
+
+    if (spi_async_busy == FALSE) {
+        spi_async_busy = TRUE;
+        spi_status = SPI_BUSY;
+        spi_next_sequence();
+        count = spi_run(notify);
+    }
+
+    SchM_Exit(SCHM_AREA_SPI);
+
+    spi_notify(notify, count);
+    return E_OK;
+}
+
+void Spi_Isr(Std_ReturnType Result)
+{
+    Spi_NotificationType notify[SPI_MAX_SEQUENCES];
+    uint8   count = 0u;
+    boolean ended;
+    Spi_NotificationType n;
+
+    SchM_Enter(SCHM_AREA_SPI);
+
+    if (spi_async_busy == FALSE) {
+        SchM_Exit(SCHM_AREA_SPI);   /* No job on the bus: spurious */
+        return;
+    }
+
+    n = spi_end_job(Result, &ended);
+    if ((ended == TRUE) && (n != NULL_PTR)) {
+        notify[count] = n;
+        count++;
+    }
+    count += spi_run(&notify[count]);
+
+    SchM_Exit(SCHM_AREA_SPI);
+
+    spi_notify(notify, count);
+}
+
+Spi_JobResultType Spi_GetJobResult(uint8 Job)
+{
+    if (spi_status == SPI_UNINIT) {
+        Det_ReportError(DET_MODULE_SPI, 0u, SPI_API_GET_JOB_RESULT, DET_E_UNINIT);
+        return SPI_JOB_FAILED;
+    }
+
+    if (Job >= spi_config->numJobs) {
+        Det_ReportError(DET_MODULE_SPI, 0u, SPI_API_GET_JOB_RESULT, DET_E_PARAM_VALUE);
+        return SPI_JOB_FAILED;
+    }
+
+    return spi_job_result[Job];
+}
+
+Spi_SeqResultType Spi_GetSequenceResult(uint8 Sequence)
+{
+    if (spi_status == SPI_UNINIT) {
+        Det_ReportError(DET_MODULE_SPI, 0u, SPI_API_GET_SEQUENCE_RESULT, DET_E_UNINIT);
+        return SPI_SEQ_FAILED;
+    }
+
+    if (Sequence >= spi_config->numSequences) {
+        Det_ReportError(DET_MODULE_SPI, 0u, SPI_API_GET_SEQUENCE_RESULT, DET_E_PARAM_VALUE);
+        return SPI_SEQ_FAILED;
+    }
+
+    return spi_seq_result[Sequence];
+}
@@ -3,6 +3,15 @@
  * @brief   SPI MCAL driver — AUTOSAR-like SPI master interface
  * @date    2026-02-21
  *
+ * @details Synchronous transfers (Spi_SyncTransmit) block until the word is
+ *          clocked out. Asynchronous transfers run as sequences of jobs:
+ *          a job is one chip select and one channel's internal buffer, a
+ *          sequence is a list of jobs transmitted back to back. Sequences
+ *          requested with Spi_AsyncTransmit are queued in FIFO order; the
+ *          platform transfers a job (STM32: DMA) and reports its end with
+ *          Spi_Isr, which starts the next job. When the last job of a
+ *          sequence ends, the sequence end notification is called.
+ *
  * @safety_req SWR-BSW-006: SPI Driver for AS5048A Sensors
  * @traces_to  SYS-047, TSR-001, TSR-010
  *
@@ -18,6 +27,8 @@
 
 #define SPI_MAX_CHANNELS    4u    /**< Max SPI channels (CS lines)      */
 #define SPI_IB_SIZE         4u    /**< Internal buffer depth per channel */
+#define SPI_MAX_JOBS        8u    /**< Max configured jobs              */
+#define SPI_MAX_SEQUENCES   4u    /**< Max configured sequences         */
 
 /* ---- Types ---- */
 
@@ -28,6 +39,37 @@ typedef enum {
     SPI_BUSY   = 2u
 } Spi_StatusType;
 
+/** Result of the last transmission of a job */
+typedef enum {
+    SPI_JOB_OK      = 0u,
+    SPI_JOB_PENDING = 1u,   /**< Being transferred                */
+    SPI_JOB_FAILED  = 2u,
+    SPI_JOB_QUEUED  = 3u    /**< Its sequence is waiting          */
+} Spi_JobResultType;
+
+/** Result of the last transmission of a sequence */
+typedef enum {
+    SPI_SEQ_OK      = 0u,
+    SPI_SEQ_PENDING = 1u,   /**< Queued or being transferred      */
+    SPI_SEQ_FAILED  = 2u    /**< A job failed, later jobs skipped */
+} Spi_SeqResultType;
+
+/** Sequence end notification (STM32: called from the SPI DMA interrupt) */
+typedef void (*Spi_NotificationType)(void);
+
+/** SPI job: one channel's internal buffer under one chip select */
+typedef struct {
+    uint8   channel;        /**< Channel (internal buffer)        */
+    uint8   csChannel;      /**< DIO chip select, active low      */
+} Spi_JobConfigType;
+
+/** SPI sequence: jobs transmitted back to back */
+typedef struct {
+    const uint8*         jobs;          /**< Job IDs in transfer order */
+    uint8                numJobs;       /**< 1..SPI_MAX_JOBS           */
+    Spi_NotificationType notification;  /**< NULL: none                */
+} Spi_SequenceConfigType;
+
 /** SPI driver configuration */
 typedef struct {
     uint32  clockSpeed;     /**< SPI clock in Hz (e.g. 1000000)   */
@@ -35,17 +77,34 @@ typedef struct {
     uint8   cpha;           /**< Clock phase (0 or 1)             */
     uint8   dataWidth;      /**< Data width in bits (8 or 16)     */
     uint8   numChannels;    /**< Number of active channels        */
+    const Spi_JobConfigType*      jobs;         /**< NULL: no async  */
+    uint8                         numJobs;
+    const Spi_SequenceConfigType* sequences;
+    uint8                         numSequences;
 } Spi_ConfigType;
 
 /* ---- Hardware Abstraction (implemented per platform) ----
- * STM32: mcal/Spi_Hw_STM32.c
+ * STM32: mcal/Spi_Hw_STM32.c (DMA RX complete / error interrupt -> Spi_Isr)
+ * POSIX: mcal/posix/Spi_Posix.c (Spi_Posix_Poll -> Spi_Isr)
  * Test:  Mocked in test/test_Spi.c
  */
 extern Std_ReturnType Spi_Hw_Init(void);
 extern Std_ReturnType Spi_Hw_Transmit(uint8 Channel, const uint16* TxBuf,
                                        uint16* RxBuf, uint8 Length);
+extern Std_ReturnType Spi_Hw_AsyncTransmit(uint8 Channel, const uint16* TxBuf,
+                                            uint16* RxBuf, uint8 Length);
 extern uint8          Spi_Hw_GetStatus(void);
 
+/**
+ * @brief  End of the transfer started by Spi_Hw_AsyncTransmit, called by
+ *         the platform backend from the transfer complete interrupt
+ * @param  Result  E_OK, or E_NOT_OK on a transfer error
+ * @note   Releases the chip select, starts the next job, and calls the
+ *         sequence end notification when a sequence is complete. A backend
+ *         without DMA may call it from within Spi_Hw_AsyncTransmit.
+ */
+void Spi_Isr(Std_ReturnType Result);
+
 /* ---- API Functions ---- */
 
 /**
@@ -84,8 +143,33 @@ Std_ReturnType Spi_ReadIB(uint8 Channel, uint16* DataBufferPointer);
 /**
  * @brief  Execute synchronous SPI transmit for a sequence (channel)
  * @param  Sequence  Sequence ID (maps to channel index)
- * @return E_OK on success, E_NOT_OK on error or timeout
+ * @return E_OK on success, E_NOT_OK on error, timeout, or while
+ *         asynchronous sequences are pending
  */
 Std_ReturnType Spi_SyncTransmit(uint8 Sequence);
 
+/**
+ * @brief  Queue a configured sequence for asynchronous transmission
+ * @param  Sequence  Sequence ID (0..numSequences-1)
+ * @return E_OK if queued; E_NOT_OK on invalid params, not initialized, or
+ *         if the sequence is still pending
+ * @note   Jobs transmit the channel's internal buffer (Spi_WriteIB) and
+ *         receive into it (Spi_ReadIB once the sequence has ended).
+ */
+Std_ReturnType Spi_AsyncTransmit(uint8 Sequence);
+
+/**
+ * @brief  Get the result of the last transmission of a job
+ * @param  Job  Job ID (0..numJobs-1)
+ * @return Spi_JobResultType; SPI_JOB_FAILED on invalid params
+ */
+Spi_JobResultType Spi_GetJobResult(uint8 Job);
+
+/**
+ * @brief  Get the result of the last transmission of a sequence
+ * @param  Sequence  Sequence ID (0..numSequences-1)
+ * @return Spi_SeqResultType; SPI_SEQ_FAILED on invalid params
+ */
+Spi_SeqResultType Spi_GetSequenceResult(uint8 Sequence);
+
 #endif /* SPI_H */
@@ -7,6 +7,18 @@
  *          No real ADC hardware — values can be set externally for
  *          simulation/testing of simulated ECUs in Docker containers.
  *
+ *          Continuous groups are scanned at Adc_Posix_Poll into
+ *          alternating halves of the DMA buffer, one scan per elapsed
+ *          scan period (the timer trigger on target); the poll runs every
+ *          ADC_POSIX_POLL_PERIOD_US.
+ *
+ *          Each channel converts a cyclic sequence of injected samples,
+ *          one sample per conversion (Adc_Posix_InjectSamples; a single
+ *          Adc_Posix_InjectValue is a sequence of one). Oversampling is
+ *          modelled as on the STM32G4: a result is the sum of
+ *          2^OversamplingShift conversions shifted right by the same
+ *          amount (truncated mean).
+ *
  * @safety_req SWR-BSW-007: ADC Driver for Analog Sensing
  * @traces_to  SYS-049, TSR-006, TSR-008
  *
@@ -15,15 +27,66 @@
 
 #include "Platform_Types.h"
 #include "Std_Types.h"
+#include "Adc.h"
+#include "Adc_Posix.h"
 
 /* ---- Module state ---- */
 
 #define ADC_POSIX_MAX_GROUPS    16u
 #define ADC_POSIX_MAX_CHANNELS  8u
+#define ADC_POSIX_POLL_PERIOD_US 1000u   /**< Main_Hw_Wfi tick */
 
-static uint16 adc_values[ADC_POSIX_MAX_GROUPS][ADC_POSIX_MAX_CHANNELS];
+static uint16 adc_values[ADC_POSIX_MAX_GROUPS][ADC_POSIX_MAX_CHANNELS][ADC_POSIX_MAX_SAMPLES];
+static uint8  adc_sample_count[ADC_POSIX_MAX_GROUPS][ADC_POSIX_MAX_CHANNELS];
+static uint8  adc_sample_pos[ADC_POSIX_MAX_GROUPS][ADC_POSIX_MAX_CHANNELS];
 static uint8  adc_status[ADC_POSIX_MAX_GROUPS]; /* 0=idle, 3=completed */
 
+/* Continuous scans (circular DMA stand-in) */
+static uint16* adc_dma_buf[ADC_POSIX_MAX_GROUPS];
+static uint8   adc_dma_channels[ADC_POSIX_MAX_GROUPS];
+static uint8   adc_dma_next_half[ADC_POSIX_MAX_GROUPS];
+static uint8   adc_dma_ovs_shift[ADC_POSIX_MAX_GROUPS];
+static uint16  adc_dma_period_us[ADC_POSIX_MAX_GROUPS];
+static uint32  adc_dma_elapsed_us[ADC_POSIX_MAX_GROUPS]; /**< Since last scan */
+
+/**
+ * @brief  One conversion of a channel: the next sample of its sequence
+ */
+static uint16 adc_posix_convert(uint8 Group, uint8 Channel)
+{
+    uint8 pos = adc_sample_pos[Group][Channel];
+
+    if (adc_sample_count[Group][Channel] > 1u) {
+        adc_sample_pos[Group][Channel] =
+            (uint8)((pos + 1u) % adc_sample_count[Group][Channel]);
+    }
+    return adc_values[Group][Channel][pos];
+}
+
+/**
+ * @brief  Write one scan of a continuous group into its next half
+ */
+static void adc_posix_scan(uint8 Group)
+{
+    uint8 n = adc_dma_channels[Group];
+    uint8 half = adc_dma_next_half[Group];
+    uint8 shift = adc_dma_ovs_shift[Group];
+    uint16* dst = &adc_dma_buf[Group][half * n];
+    uint32 sum;
+    uint16 k;
+    uint8 c;
+
+    for (c = 0u; c < n; c++) {
+        sum = 0u;
+        for (k = 0u; k < (uint16)(1u << shift); k++) {
+            sum += adc_posix_convert(Group, c);
+        }
+        dst[c] = (uint16)(sum >> shift);
+    }
+    adc_dma_next_half[Group] = (uint8)(half ^ 1u);
+    Adc_Isr(Group, half);
+}
+
 /* ---- Public helper for simulation ---- */
 
 /**
@@ -34,8 +97,28 @@ static uint8  adc_status[ADC_POSIX_MAX_GROUPS]; /* 0=idle, 3=completed */
  */
 void Adc_Posix_InjectValue(uint8 Group, uint8 Channel, uint16 Value)
 {
-    if ((Group < ADC_POSIX_MAX_GROUPS) && (Channel < ADC_POSIX_MAX_CHANNELS)) {
-        adc_values[Group][Channel] = Value;
+    Adc_Posix_InjectSamples(Group, Channel, &Value, 1u);
+}
+
+/**
+ * @brief  Inject a cyclic sequence of samples, one per conversion
+ * @param  Group    Group index
+ * @param  Channel  Channel within group
+ * @param  Samples  Sample values
+ * @param  Count    Number of samples, 1..ADC_POSIX_MAX_SAMPLES
+ */
+void Adc_Posix_InjectSamples(uint8 Group, uint8 Channel,
+                             const uint16* Samples, uint8 Count)
+{
+    uint8 i;
+
+    if ((Group < ADC_POSIX_MAX_GROUPS) && (Channel < ADC_POSIX_MAX_CHANNELS) &&
+        (Samples != NULL_PTR) && (Count > 0u) && (Count <= ADC_POSIX_MAX_SAMPLES)) {
+        for (i = 0u; i < Count; i++) {
+            adc_values[Group][Channel][i] = Samples[i];
+        }
+        adc_sample_count[Group][Channel] = Count;
+        adc_sample_pos[Group][Channel] = 0u;
     }
 }
 
@@ -50,8 +133,11 @@ Std_ReturnType Adc_Hw_Init(void)
     uint8 g, c;
     for (g = 0u; g < ADC_POSIX_MAX_GROUPS; g++) {
         adc_status[g] = 0u;
+        adc_dma_buf[g] = NULL_PTR;
         for (c = 0u; c < ADC_POSIX_MAX_CHANNELS; c++) {
-            adc_values[g][c] = 0u;
+            adc_values[g][c][0] = 0u;
+            adc_sample_count[g][c] = 1u;
+            adc_sample_pos[g][c] = 0u;
         }
     }
     return E_OK;
@@ -94,7 +180,7 @@ Std_ReturnType Adc_Hw_ReadResult(uint8 Group, uint16* ResultBuffer,
 
     uint8 c;
     for (c = 0u; c < NumChannels; c++) {
-        ResultBuffer[c] = adc_values[Group][c];
+        ResultBuffer[c] = adc_posix_convert(Group, c);
     }
 
     adc_status[Group] = 0u; /* Back to idle */
@@ -113,3 +199,63 @@ uint8 Adc_Hw_GetStatus(uint8 Group)
     }
     return adc_status[Group];
 }
+
+/**
+ * @brief  Start the continuous scan of a group (POSIX: first scan now,
+ *         the next ones at Adc_Posix_Poll)
+ * @param  Group              Group index
+ * @param  DmaBuffer          Double buffer, 2 * NumChannels results
+ * @param  NumChannels        Channels per scan
+ * @param  OversamplingShift  2^n conversions per result
+ * @param  ScanPeriodUs       Time between scans
+ * @return E_OK on success, E_NOT_OK on invalid params
+ */
+Std_ReturnType Adc_Hw_StartContinuous(uint8 Group, uint16* DmaBuffer,
+                                      uint8 NumChannels,
+                                      uint8 OversamplingShift,
+                                      uint16 ScanPeriodUs)
+{
+    if ((Group >= ADC_POSIX_MAX_GROUPS) || (DmaBuffer == NULL_PTR) ||
+        (NumChannels == 0u) || (NumChannels > ADC_POSIX_MAX_CHANNELS) ||
+        (OversamplingShift > ADC_MAX_OVERSAMPLING_SHIFT) ||
+        (ScanPeriodUs == 0u)) {
+        return E_NOT_OK;
+    }
+
+    adc_dma_buf[Group] = DmaBuffer;
+    adc_dma_channels[Group] = NumChannels;
+    adc_dma_next_half[Group] = 0u;
+    adc_dma_ovs_shift[Group] = OversamplingShift;
+    adc_dma_period_us[Group] = ScanPeriodUs;
+    adc_dma_elapsed_us[Group] = 0u;
+
+    /* The ADC completes its first scan microseconds after the start */
+    adc_posix_scan(Group);
+    return E_OK;
+}
+
+/**
+ * @brief  Stop the continuous scan of a group
+ * @param  Group  Group index
+ */
+void Adc_Hw_StopContinuous(uint8 Group)
+{
+    if (Group < ADC_POSIX_MAX_GROUPS) {
+        adc_dma_buf[Group] = NULL_PTR;
+    }
+}
+
+void Adc_Posix_Poll(void)
+{
+    uint8 g;
+
+    for (g = 0u; g < ADC_POSIX_MAX_GROUPS; g++) {
+        if (adc_dma_buf[g] != NULL_PTR) {
+            adc_dma_elapsed_us[g] += ADC_POSIX_POLL_PERIOD_US;
+            while (adc_dma_elapsed_us[g] >= adc_dma_period_us[g]) {
+                adc_dma_elapsed_us[g] -= adc_dma_period_us[g];
+                adc_posix_scan(g);
+            }
+        }
+    }
+}
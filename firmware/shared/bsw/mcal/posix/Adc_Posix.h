@@ -0,0 +1,55 @@
+/**
+ * @file    Adc_Posix.h
+ * @brief   POSIX ADC backend — injectable simulated conversions
+ * @date    2026-03-25
+ *
+ * @details Implements Adc_Hw_* extern functions from Adc.h. The scans of
+ *          continuous groups are polled (Adc_Posix_Poll) instead of
+ *          written by circular DMA; hardware oversampling is modelled.
+ *
+ * @safety_req SWR-BSW-007: ADC Driver for Analog Sensing
+ * @traces_to  SYS-049, TSR-006, TSR-008
+ *
+ * @copyright Taktflow Systems 2026
+ */
+#ifndef ADC_POSIX_H
+#define ADC_POSIX_H
+
+#include "Std_Types.h"
+
+/** Length of an injected sample sequence (Adc_Posix_InjectSamples) */
+#define ADC_POSIX_MAX_SAMPLES   16u
+
+/**
+ * @brief  Complete the scans due in every running continuous group: for
+ *         each scan period elapsed since the last one, write the injected
+ *         values into the next half of its DMA buffer and report it to
+ *         Adc_Isr (stands in for the DMA half/full interrupts)
+ * @note   Called by the ECU's Main_Hw_Wfi, i.e. once per 1 ms SIL tick:
+ *         a 1 ms group scans every call, a 10 ms group every tenth.
+ */
+void Adc_Posix_Poll(void);
+
+/**
+ * @brief  Inject a simulated ADC value (for testing/simulation)
+ * @param  Group    Group index
+ * @param  Channel  Channel within group
+ * @param  Value    ADC raw value to inject
+ */
+void Adc_Posix_InjectValue(uint8 Group, uint8 Channel, uint16 Value);
+
+/**
+ * @brief  Inject a cyclic sequence of samples, one per conversion, e.g.
+ *         noise around a level to exercise hardware oversampling
+ * @param  Group    Group index
+ * @param  Channel  Channel within group
+ * @param  Samples  Sample values
+ * @param  Count    Number of samples, 1..ADC_POSIX_MAX_SAMPLES (others
+ *                  are ignored)
+ * @note   An oversampled result averages the next 2^OversamplingShift
+ *         samples of the sequence.
+ */
+void Adc_Posix_InjectSamples(uint8 Group, uint8 Channel,
+                             const uint16* Samples, uint8 Count);
+
+#endif /* ADC_POSIX_H */
@@ -7,8 +7,13 @@
  *          communication for simulated ECUs. Binds to the interface specified
  *          by CAN_INTERFACE env var (default: "vcan0").
  *
- *          All socket syscalls go through function pointer indirection to
- *          enable unit testing with mock syscalls.
+ *          CAN_INTERFACE=shm:<name> selects the shared memory bus of the
+ *          SIL instead (Sil_CanBus.h): no syscall per frame, frames ordered
+ *          by arbitration ID within a bus tick, optional bit timing. Tools
+ *          that need vcan0 reach it through sil_can_bridge.
+ *
+ *          All socket syscalls and the shared memory bus go through function
+ *          pointer indirection to enable unit testing with mocks.
  *
  * @safety_req SWR-BSW-001: CAN initialization
  * @safety_req SWR-BSW-002: CAN transmit
@@ -38,6 +43,8 @@
 #include <stdlib.h>
 #include <errno.h>
 #include <stdio.h>
+#include "Sil_CanBus.h"
+#include "Sil_Time.h"
 
 /* Use real syscalls */
 #define CAN_POSIX_SOCKET_FN     socket
@@ -49,33 +56,52 @@
 #define CAN_POSIX_SETSOCKOPT_FN setsockopt
 #define CAN_POSIX_FCNTL_FN      fcntl
 #define CAN_POSIX_GETENV_FN     getenv
+
+/* Shared memory bus (CAN_INTERFACE=shm:<name>) */
+#define CAN_POSIX_SHM_OPEN_FN     Sil_CanBus_Open
+#define CAN_POSIX_SHM_CLOSE_FN    Sil_CanBus_Close
+#define CAN_POSIX_SHM_TRANSMIT_FN Sil_CanBus_Transmit
+#define CAN_POSIX_SHM_RECEIVE_FN  Sil_CanBus_Receive
+#define CAN_POSIX_SHM_NOW_FN      Sil_Time_GetSharedUs
 #endif /* CAN_POSIX_SOCKET_FN */
 
 /* ---- Module state ---- */
 
 static int     can_posix_fd      = -1;     /**< SocketCAN file descriptor */
 static boolean can_posix_bus_off = FALSE;  /**< Bus-off flag              */
+static boolean can_posix_shm     = FALSE;  /**< On the shared memory bus  */
 
 /* ---- Default CAN interface ---- */
 
 #define CAN_POSIX_DEFAULT_IFACE "vcan0"
+#define CAN_POSIX_SHM_PREFIX    "shm:"
+#define CAN_POSIX_SHM_PREFIX_LEN 4u
 
 /* ---- Can_Hw_* implementations ---- */
 
 /**
  * @brief  Initialize SocketCAN — create RAW socket, bind to interface
- * @param  baudrate  Baudrate (informational for vcan, real for physical CAN)
+ * @param  baudrate  Baudrate (informational for vcan, bit timing model of
+ *                   the shared memory bus, real for physical CAN)
  * @return E_OK on success, E_NOT_OK on failure
  */
 Std_ReturnType Can_Hw_Init(uint32 baudrate)
 {
-    (void)baudrate; /* vcan ignores baudrate */
-
     const char* iface = CAN_POSIX_GETENV_FN("CAN_INTERFACE");
     if (iface == NULL_PTR) {
         iface = CAN_POSIX_DEFAULT_IFACE;
     }
 
+    /* Shared memory bus: starts at the end of its ring, no stale frames */
+    if (strncmp(iface, CAN_POSIX_SHM_PREFIX, CAN_POSIX_SHM_PREFIX_LEN) == 0) {
+        can_posix_fd      = -1;
+        can_posix_bus_off = FALSE;
+        can_posix_shm     = (CAN_POSIX_SHM_OPEN_FN(&iface[CAN_POSIX_SHM_PREFIX_LEN],
+                                                   baudrate, CAN_POSIX_SHM_NOW_FN) == E_OK)
+                            ? TRUE : FALSE;
+        return (can_posix_shm == TRUE) ? E_OK : E_NOT_OK;
+    }
+
     /* Create RAW CAN socket */
     int fd = CAN_POSIX_SOCKET_FN(PF_CAN, SOCK_RAW, CAN_RAW);
     if (fd < 0) {
@@ -153,10 +179,14 @@ void Can_Hw_Start(void)
 }
 
 /**
- * @brief  Stop CAN — close the socket
+ * @brief  Stop CAN — close the socket or leave the shared memory bus
  */
 void Can_Hw_Stop(void)
 {
+    if (can_posix_shm == TRUE) {
+        CAN_POSIX_SHM_CLOSE_FN();
+        can_posix_shm = FALSE;
+    }
     if (can_posix_fd >= 0) {
         CAN_POSIX_CLOSE_FN(can_posix_fd);
         can_posix_fd = -1;
@@ -172,15 +202,18 @@ void Can_Hw_Stop(void)
  */
 Std_ReturnType Can_Hw_Transmit(Can_IdType id, const uint8* data, uint8 dlc)
 {
-    if (can_posix_fd < 0) {
-        return E_NOT_OK;
-    }
     if (data == NULL_PTR) {
         return E_NOT_OK;
     }
     if (dlc > 8u) {
         dlc = 8u;
     }
+    if (can_posix_shm == TRUE) {
+        return CAN_POSIX_SHM_TRANSMIT_FN((uint32)id, data, dlc);
+    }
+    if (can_posix_fd < 0) {
+        return E_NOT_OK;
+    }
 
     struct can_frame frame;
     memset(&frame, 0, sizeof(frame));
@@ -208,10 +241,19 @@ Std_ReturnType Can_Hw_Transmit(Can_IdType id, const uint8* data, uint8 dlc)
  */
 boolean Can_Hw_Receive(Can_IdType* id, uint8* data, uint8* dlc)
 {
-    if (can_posix_fd < 0) {
+    if ((id == NULL_PTR) || (data == NULL_PTR) || (dlc == NULL_PTR)) {
         return FALSE;
     }
-    if ((id == NULL_PTR) || (data == NULL_PTR) || (dlc == NULL_PTR)) {
+    if (can_posix_shm == TRUE) {
+        uint32 rx_id;
+
+        if (CAN_POSIX_SHM_RECEIVE_FN(&rx_id, data, dlc) == FALSE) {
+            return FALSE;
+        }
+        *id = (Can_IdType)rx_id;
+        return TRUE;
+    }
+    if (can_posix_fd < 0) {
         return FALSE;
     }
 
@@ -264,7 +306,7 @@ void Can_Hw_GetErrorCounters(uint8* tec, uint8* rec)
 
 /**
  * @brief  Get the SocketCAN file descriptor
- * @return Socket fd, or -1 if not initialized
+ * @return Socket fd, or -1 if not initialized or on the shared memory bus
  */
 int Can_Posix_GetFd(void)
 {
@@ -5,7 +5,8 @@
  *
  * @details Implements Can_Hw_* extern functions from Can.h using Linux
  *          SocketCAN. Used by simulated ECUs (BCM, ICU, TCU) running
- *          in Docker containers on vcan0.
+ *          in Docker containers on vcan0, or on the SIL shared memory bus
+ *          with CAN_INTERFACE=shm:<name> (Sil_CanBus.h).
  *
  * @safety_req SWR-BSW-001, SWR-BSW-002, SWR-BSW-003
  * @traces_to  TSR-022, TSR-023, TSR-024
@@ -20,7 +21,7 @@
 
 /**
  * @brief  Get the SocketCAN file descriptor (for advanced usage/diagnostics)
- * @return Socket fd, or -1 if not initialized
+ * @return Socket fd, or -1 if not initialized or on the shared memory bus
  */
 int Can_Posix_GetFd(void);
 
@@ -0,0 +1,205 @@
+/**
+ * @file    Fls_Posix.c
+ * @brief   Host flash simulator — implements Fls_Hw_* externs from Fls.h
+ * @date    2026-03-10
+ *
+ * @details RAM-backed model of the STM32G474 flash used by Fee. Keeps
+ *          per-page erase counters and operation counts so wear leveling
+ *          and GC behaviour can be checked in unit tests.
+ *
+ * @safety_req SWR-BSW-031
+ * @traces_to  TSR-050
+ *
+ * @copyright Taktflow Systems 2026
+ */
+
+#include "Platform_Types.h"
+#include "Std_Types.h"
+#include "Fls_Posix.h"
+
+/* ---- Module state ---- */
+
+static uint8             fls_sim_mem[FLS_SIM_SIZE];
+static Fls_Sim_StatsType fls_sim_stats;
+static uint32            fls_sim_erase_polls;
+static uint32            fls_sim_program_polls;
+static uint32            fls_sim_busy_remaining;
+static Std_ReturnType    fls_sim_result = E_OK;
+
+/* ---- Private helpers ---- */
+
+static boolean Fls_Sim_InRange(Fls_AddressType Address, uint32 Length)
+{
+    if (Address < FLS_SIM_BASE_ADDRESS) {
+        return FALSE;
+    }
+    if ((Address - FLS_SIM_BASE_ADDRESS) > FLS_SIM_SIZE) {
+        return FALSE;
+    }
+    return (Length <= (FLS_SIM_SIZE - (Address - FLS_SIM_BASE_ADDRESS))) ? TRUE : FALSE;
+}
+
+/* ---- Simulator control API ---- */
+
+void Fls_Sim_Reset(void)
+{
+    uint32 i;
+
+    for (i = 0u; i < FLS_SIM_SIZE; i++) {
+        fls_sim_mem[i] = FLS_ERASED_BYTE;
+    }
+    for (i = 0u; i < FLS_SIM_NUM_PAGES; i++) {
+        fls_sim_stats.pageEraseCount[i] = 0u;
+    }
+    fls_sim_stats.programCount      = 0u;
+    fls_sim_stats.programErrors     = 0u;
+    fls_sim_stats.eraseCount        = 0u;
+    fls_sim_stats.maxPageEraseCount = 0u;
+    fls_sim_stats.busyCycles        = 0u;
+    fls_sim_stats.bytesRead         = 0u;
+    fls_sim_busy_remaining = 0u;
+    fls_sim_result         = E_OK;
+}
+
+void Fls_Sim_SetLatency(uint32 ErasePolls, uint32 ProgramPolls)
+{
+    fls_sim_erase_polls   = ErasePolls;
+    fls_sim_program_polls = ProgramPolls;
+}
+
+void Fls_Sim_GetStats(Fls_Sim_StatsType* StatsPtr)
+{
+    if (StatsPtr != NULL_PTR) {
+        *StatsPtr = fls_sim_stats;
+    }
+}
+
+void Fls_Sim_PokeByte(Fls_AddressType Address, uint8 Value)
+{
+    if (Fls_Sim_InRange(Address, 1u) == TRUE) {
+        fls_sim_mem[Address - FLS_SIM_BASE_ADDRESS] = Value;
+    }
+}
+
+/* ---- Fls_Hw_* implementations ---- */
+
+/**
+ * @brief  Initialize flash hardware (simulator: flash content is retained)
+ * @return E_OK always
+ */
+Std_ReturnType Fls_Hw_Init(void)
+{
+    fls_sim_busy_remaining = 0u;
+    fls_sim_result         = E_OK;
+    return E_OK;
+}
+
+/**
+ * @brief  Erase the page containing PageAddress
+ * @return E_OK if started, E_NOT_OK if busy or out of range
+ */
+Std_ReturnType Fls_Hw_StartErase(Fls_AddressType PageAddress)
+{
+    uint32 page;
+    uint32 i;
+
+    if ((fls_sim_busy_remaining != 0u) ||
+        (Fls_Sim_InRange(PageAddress, 1u) == FALSE)) {
+        return E_NOT_OK;
+    }
+
+    page = (PageAddress - FLS_SIM_BASE_ADDRESS) / FLS_SIM_PAGE_SIZE;
+    for (i = 0u; i < FLS_SIM_PAGE_SIZE; i++) {
+        fls_sim_mem[(page * FLS_SIM_PAGE_SIZE) + i] = FLS_ERASED_BYTE;
+    }
+
+    fls_sim_stats.eraseCount++;
+    fls_sim_stats.pageEraseCount[page]++;
+    if (fls_sim_stats.pageEraseCount[page] > fls_sim_stats.maxPageEraseCount) {
+        fls_sim_stats.maxPageEraseCount = fls_sim_stats.pageEraseCount[page];
+    }
+
+    fls_sim_result         = E_OK;
+    fls_sim_busy_remaining = fls_sim_erase_polls;
+    return E_OK;
+}
+
+/**
+ * @brief  Program one double-word (NOR: target must be erased or data zero)
+ * @return E_OK if started, E_NOT_OK if busy, misaligned or out of range
+ */
+Std_ReturnType Fls_Hw_StartProgram(Fls_AddressType Address,
+                                   uint32 WordLo, uint32 WordHi)
+{
+    uint32  off;
+    uint8   i;
+    boolean erased = TRUE;
+
+    if ((fls_sim_busy_remaining != 0u) ||
+        (Fls_Sim_InRange(Address, FLS_DWORD_SIZE) == FALSE) ||
+        (((Address - FLS_SIM_BASE_ADDRESS) % FLS_DWORD_SIZE) != 0u)) {
+        return E_NOT_OK;
+    }
+
+    off = Address - FLS_SIM_BASE_ADDRESS;
+    for (i = 0u; i < FLS_DWORD_SIZE; i++) {
+        if (fls_sim_mem[off + i] != FLS_ERASED_BYTE) {
+            erased = FALSE;
+        }
+    }
+
+    fls_sim_busy_remaining = fls_sim_program_polls;
+
+    if ((erased == FALSE) && ((WordLo != 0u) || (WordHi != 0u))) {
+        fls_sim_stats.programErrors++;
+        fls_sim_result = E_NOT_OK;   /* PROGERR */
+        return E_OK;
+    }
+
+    for (i = 0u; i < 4u; i++) {
+        fls_sim_mem[off + i]      = (uint8)((WordLo >> (8u * i)) & 0xFFu);
+        fls_sim_mem[off + 4u + i] = (uint8)((WordHi >> (8u * i)) & 0xFFu);
+    }
+    fls_sim_stats.programCount++;
+    fls_sim_result = E_OK;
+    return E_OK;
+}
+
+/**
+ * @brief  Busy flag — counts down the configured latency per poll
+ */
+boolean Fls_Hw_IsBusy(void)
+{
+    if (fls_sim_busy_remaining == 0u) {
+        return FALSE;
+    }
+    fls_sim_busy_remaining--;
+    fls_sim_stats.busyCycles++;
+    return TRUE;
+}
+
+/**
+ * @brief  Error status of the last finished operation
+ */
+Std_ReturnType Fls_Hw_GetResult(void)
+{
+    return fls_sim_result;
+}
+
+/**
+ * @brief  Read simulated flash (out-of-range bytes read as erased)
+ */
+void Fls_Hw_Read(Fls_AddressType Address, uint8* DstPtr, Fls_LengthType Length)
+{
+    uint32 i;
+
+    if (DstPtr == NULL_PTR) {
+        return;
+    }
+    for (i = 0u; i < Length; i++) {
+        DstPtr[i] = (Fls_Sim_InRange(Address + i, 1u) == TRUE)
+                    ? fls_sim_mem[(Address + i) - FLS_SIM_BASE_ADDRESS]
+                    : FLS_ERASED_BYTE;
+    }
+    fls_sim_stats.bytesRead += Length;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file    Fls_Posix.h
+ * @brief   Host flash simulator for the Fls MCAL driver
+ * @date    2026-03-10
+ *
+ * @details Implements the Fls_Hw_* externs from Fls.h over a RAM array
+ *          with STM32G4 NOR semantics: erase sets a 2 KB page to 0xFF,
+ *          a double-word can only be programmed while erased (or to all
+ *          zeros), otherwise the operation fails with a programming error.
+ *          Erase/program latency is modelled in Fls_Hw_IsBusy polls so the
+ *          non-blocking job handling in Fls and Fee is exercised on the host.
+ *
+ * @safety_req SWR-BSW-031
+ * @traces_to  TSR-050
+ *
+ * @copyright Taktflow Systems 2026
+ */
+#ifndef FLS_POSIX_H
+#define FLS_POSIX_H
+
+#include "Std_Types.h"
+#include "Fls.h"
+
+/* ---- Simulated device (mirrors the tail of STM32G474 bank 2) ---- */
+
+#define FLS_SIM_BASE_ADDRESS    0x08078000u
+#define FLS_SIM_PAGE_SIZE       0x800u      /**< 2 KB (dual-bank mode) */
+#define FLS_SIM_NUM_PAGES       16u
+#define FLS_SIM_SIZE            (FLS_SIM_PAGE_SIZE * FLS_SIM_NUM_PAGES)
+
+/** Wear and timing statistics since the last Fls_Sim_Reset */
+typedef struct {
+    uint32  programCount;                       /**< Double-words programmed  */
+    uint32  programErrors;                      /**< Program over non-erased  */
+    uint32  eraseCount;                         /**< Page erases (all pages)  */
+    uint32  pageEraseCount[FLS_SIM_NUM_PAGES];  /**< Erase cycles per page    */
+    uint32  maxPageEraseCount;                  /**< Most-worn page           */
+    uint32  busyCycles;                         /**< IsBusy polls seen busy   */
+    uint32  bytesRead;                          /**< Bytes via Fls_Hw_Read    */
+} Fls_Sim_StatsType;
+
+/**
+ * @brief  Factory-fresh device: all bytes erased, statistics cleared
+ * @note   Fls_Hw_Init does NOT clear memory, so a driver re-init models
+ *         a reset with retained flash content.
+ */
+void Fls_Sim_Reset(void);
+
+/**
+ * @brief  Set operation latency in Fls_Hw_IsBusy polls (0 = immediate)
+ */
+void Fls_Sim_SetLatency(uint32 ErasePolls, uint32 ProgramPolls);
+
+/**
+ * @brief  Copy out the current statistics
+ */
+void Fls_Sim_GetStats(Fls_Sim_StatsType* StatsPtr);
+
+/**
+ * @brief  Overwrite one byte directly (fault injection: torn write, bit rot)
+ */
+void Fls_Sim_PokeByte(Fls_AddressType Address, uint8 Value);
+
+#endif /* FLS_POSIX_H */
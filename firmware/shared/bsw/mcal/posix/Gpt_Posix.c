@@ -11,6 +11,12 @@
  *          mechanism is in the ECU main.c (usleep or timerfd). This module
  *          provides the Gpt_Hw_* interface for BSW compatibility.
  *
+ *          There is no timer interrupt: Gpt_Posix_Poll stands in for it.
+ *          Called from the SIL loop (Main_Hw_Wfi, every 1ms tick), it
+ *          reports every period a channel completed since the last poll
+ *          to Gpt_Isr, so channel notifications run with the latency of
+ *          the polling but none is lost.
+ *
  * @safety_req SWR-BSW-010: GPT Driver for Timing
  * @traces_to  SYS-053, TSR-046, TSR-047
  *
@@ -19,6 +25,8 @@
 
 #include "Platform_Types.h"
 #include "Std_Types.h"
+#include "Gpt.h"
+#include "Gpt_Posix.h"
 
 #ifndef PLATFORM_POSIX_TEST
 #include <time.h>
@@ -124,3 +132,31 @@ uint32 Gpt_Hw_GetCounter(uint8 Channel)
     return gpt_channels[Channel].mock_counter;
 #endif
 }
+
+#ifndef PLATFORM_POSIX_TEST
+void Gpt_Posix_Poll(void)
+{
+    uint8 i;
+
+    for (i = 0u; i < GPT_POSIX_MAX_CHANNELS; i++) {
+        Gpt_Posix_ChannelType* ch = &gpt_channels[i];
+
+        /* One expiry per elapsed period: after a late poll the backlog is
+         * caught up at once. Gpt_Isr stops a one-shot channel, and a
+         * notification may stop or restart the channel. */
+        while ((ch->running == TRUE) && (ch->target_us != 0u) &&
+               (Gpt_Hw_GetCounter(i) >= ch->target_us)) {
+            /* Next period from the previous target, not from now: a late
+             * poll does not make a continuous channel drift */
+            ch->start_time.tv_nsec += (long)(ch->target_us % 1000000u) * 1000L;
+            ch->start_time.tv_sec  += (time_t)(ch->target_us / 1000000u);
+            if (ch->start_time.tv_nsec >= 1000000000L) {
+                ch->start_time.tv_nsec -= 1000000000L;
+                ch->start_time.tv_sec++;
+            }
+
+            Gpt_Isr(i);
+        }
+    }
+}
+#endif
@@ -0,0 +1,27 @@
+/**
+ * @file    Gpt_Posix.h
+ * @brief   POSIX timer backend for GPT MCAL driver
+ * @date    2026-03-22
+ *
+ * @details Implements Gpt_Hw_* extern functions from Gpt.h on
+ *          CLOCK_MONOTONIC. Channel expiry is polled (Gpt_Posix_Poll)
+ *          instead of raised by a timer interrupt.
+ *
+ * @safety_req SWR-BSW-010: GPT Driver for Timing
+ * @traces_to  SYS-053, TSR-046, TSR-047
+ *
+ * @copyright Taktflow Systems 2026
+ */
+#ifndef GPT_POSIX_H
+#define GPT_POSIX_H
+
+#include "Std_Types.h"
+
+/**
+ * @brief  Report expired channels to Gpt_Isr (stands in for the timer ISR)
+ * @note   A channel that expired several periods ago is reported once per
+ *         elapsed period, so a late call catches up instead of drifting.
+ */
+void Gpt_Posix_Poll(void);
+
+#endif /* GPT_POSIX_H */
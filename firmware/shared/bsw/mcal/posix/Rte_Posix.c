@@ -0,0 +1,123 @@
+/**
+ * @file    Rte_Posix.c
+ * @brief   POSIX profiling backend — implements Rte_Hw_* externs from Rte.h
+ * @date    2026-03-16
+ *
+ * @details Only built into RTE_PROFILING builds (Makefile.posix debug).
+ *          Profiling cycles are nanoseconds of CLOCK_MONOTONIC (vDSO, no
+ *          system call), so RTE_PROF_CYCLES_PER_US is 1000. The 32-bit
+ *          value wraps every 4.3 s; only differences are used.
+ *
+ *          The statistics are printed to stdout when the simulated ECU
+ *          exits: atexit() for a normal exit, and SIGINT/SIGTERM handlers
+ *          for docker stop / Ctrl-C, installed only if the ECU main did
+ *          not install its own (those return from main, so atexit runs).
+ *          The handler prints from signal context: the ECU main loop is
+ *          single-threaded and never resumes, which is acceptable for a
+ *          debug-only build.
+ *
+ * @safety_req SWR-BSW-026, SWR-BSW-027
+ * @traces_to  TSR-046, TSR-047
+ *
+ * @copyright Taktflow Systems 2026
+ */
+#include "Rte.h"
+
+#if defined(RTE_PROFILING)
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* ---- Module state ---- */
+
+static boolean rte_posix_dump_registered = FALSE;
+
+/* ---- Private Functions ---- */
+
+static unsigned long Rte_Posix_Us(uint64 Ns)
+{
+    return (unsigned long)(Ns / RTE_PROF_CYCLES_PER_US);
+}
+
+/**
+ * @brief  Print the tick load and the statistics of every runnable
+ */
+static void Rte_Posix_Dump(void)
+{
+    Rte_TickProfileType tick;
+    Rte_ProfileType     prof;
+    uint8 i;
+    uint8 b;
+
+    if (Rte_GetTickProfile(&tick) != E_OK) {
+        return;
+    }
+
+    (void)printf("[RTE] profile: %lu ticks, tick mean %lu us, max %lu us\n",
+                 (unsigned long)tick.ticks,
+                 (tick.ticks > 0u) ? Rte_Posix_Us(tick.totalCycles / tick.ticks) : 0uL,
+                 Rte_Posix_Us(tick.maxCycles));
+    (void)printf("[RTE]  #    count   min us  mean us   max us  hist <2,<4,..,<128,>=128 us\n");
+
+    for (i = 0u; Rte_GetRunnableProfile(i, &prof) == E_OK; i++) {
+        (void)printf("[RTE] %2u %8lu %8lu %8lu %8lu ",
+                     (unsigned)i, (unsigned long)prof.count,
+                     Rte_Posix_Us(prof.minCycles),
+                     (prof.count > 0u) ? Rte_Posix_Us(prof.totalCycles / prof.count) : 0uL,
+                     Rte_Posix_Us(prof.maxCycles));
+        for (b = 0u; b < RTE_PROF_HIST_BINS; b++) {
+            (void)printf(" %lu", (unsigned long)prof.hist[b]);
+        }
+        (void)printf("\n");
+    }
+    (void)fflush(stdout);
+}
+
+static void Rte_Posix_SignalHandler(int Sig)
+{
+    (void)signal(Sig, SIG_DFL);
+    Rte_Posix_Dump();
+    (void)raise(Sig);
+}
+
+/**
+ * @brief  Install the exit dump handler for a signal unless one is set
+ */
+static void Rte_Posix_HookSignal(int Sig)
+{
+    struct sigaction old;
+
+    if ((sigaction(Sig, NULL, &old) == 0) && (old.sa_handler == SIG_DFL)) {
+        (void)signal(Sig, Rte_Posix_SignalHandler);
+    }
+}
+
+/* ---- Rte_Hw_* implementations ---- */
+
+/**
+ * @brief  Register the exit dump (once per process)
+ */
+void Rte_Hw_ProfileStart(void)
+{
+    if (rte_posix_dump_registered == FALSE) {
+        rte_posix_dump_registered = TRUE;
+        (void)atexit(Rte_Posix_Dump);
+        Rte_Posix_HookSignal(SIGINT);
+        Rte_Posix_HookSignal(SIGTERM);
+    }
+}
+
+/**
+ * @brief  Monotonic time in nanoseconds (wrapping)
+ */
+uint32 Rte_Hw_GetCycles(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint32)ts.tv_sec * 1000000000u) + (uint32)ts.tv_nsec;
+}
+
+#endif /* RTE_PROFILING */
@@ -0,0 +1,210 @@
+/**
+ * @file    SchM_Posix.c
+ * @brief   POSIX exclusive areas — implements the SchM.h area API for SIL
+ * @date    2026-03-18
+ *
+ * @details Each exclusive area is a recursive pthread mutex, so BSW state
+ *          stays consistent when SIL I/O (CAN RX, Gpt, UDP sensor
+ *          injection) runs on threads of its own. glibc mutexes are futex
+ *          based: an uncontended enter/exit is one atomic operation each,
+ *          without a system call. Recursive, because an area may be entered
+ *          again by its holder (e.g. the Rte profile dump from a signal
+ *          handler on the main thread).
+ *
+ *          SCHM_LOCK_GLOBAL and SCHM_LOCK_BASEPRI both take the mutex of
+ *          the area: there is no interrupt priority to mask on a host.
+ *          SCHM_LOCK_FLAG takes no lock; all users of such an area must run
+ *          on the same thread.
+ *
+ *          ThreadSanitizer (Makefile.posix TSAN=1) intercepts the pthread
+ *          calls, so no annotations are needed: the happens-before edges of
+ *          every area come from the mutex itself.
+ *
+ *          Per area, the outermost enter/exit pairs are counted and, with
+ *          SCHM_IRQ_OFF_MEASUREMENT, the longest hold is measured in
+ *          nanoseconds of CLOCK_MONOTONIC.
+ *
+ *          Unit tests build SchM.c instead (mock IRQ / BASEPRI state).
+ *
+ * @safety_req SWR-BSW-041
+ * @traces_to  TSR-022, TSR-023
+ *
+ * @copyright Taktflow Systems 2026
+ */
+#include "SchM.h"
+
+#if defined(PLATFORM_POSIX) && !defined(UNIT_TEST)
+
+#include "Det.h"
+
+#include <pthread.h>
+#include <time.h>
+
+/* ---- Module state ---- */
+
+/** Lock of every area until SchM_Init */
+static const SchM_AreaConfigType schm_area_default = { SCHM_LOCK_GLOBAL, 0u };
+
+static const SchM_AreaConfigType* schm_areas = NULL_PTR;
+
+static pthread_once_t  schm_posix_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t schm_posix_mutex[SCHM_AREA_COUNT];
+
+/* Only written by the holder of the area */
+static uint8              schm_area_depth[SCHM_AREA_COUNT];
+static uint32             schm_area_entered[SCHM_AREA_COUNT]; /**< ns */
+static SchM_AreaStatsType schm_area_stats[SCHM_AREA_COUNT];
+
+/* ---- Private Functions ---- */
+
+static void SchM_Posix_CreateMutexes(void)
+{
+    pthread_mutexattr_t attr;
+    uint8 i;
+
+    (void)pthread_mutexattr_init(&attr);
+    (void)pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+
+    for (i = 0u; i < SCHM_AREA_COUNT; i++) {
+        (void)pthread_mutex_init(&schm_posix_mutex[i], &attr);
+    }
+
+    (void)pthread_mutexattr_destroy(&attr);
+}
+
+static uint32 SchM_Posix_GetNs(void)
+{
+#if defined(SCHM_IRQ_OFF_MEASUREMENT)
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint32)ts.tv_sec * 1000000000u) + (uint32)ts.tv_nsec;
+#else
+    return 0u;
+#endif
+}
+
+static boolean SchM_Posix_IsLocked(SchM_AreaType Area)
+{
+    const SchM_AreaConfigType* cfg =
+        (schm_areas != NULL_PTR) ? &schm_areas[Area] : &schm_area_default;
+
+    return (cfg->lock != SCHM_LOCK_FLAG) ? TRUE : FALSE;
+}
+
+/**
+ * @brief  Take the mutex of an area without counting it (statistics access)
+ */
+static void SchM_Posix_Lock(SchM_AreaType Area)
+{
+    (void)pthread_once(&schm_posix_once, SchM_Posix_CreateMutexes);
+
+    if (SchM_Posix_IsLocked(Area) == TRUE) {
+        (void)pthread_mutex_lock(&schm_posix_mutex[Area]);
+    }
+}
+
+static void SchM_Posix_Unlock(SchM_AreaType Area)
+{
+    if (SchM_Posix_IsLocked(Area) == TRUE) {
+        (void)pthread_mutex_unlock(&schm_posix_mutex[Area]);
+    }
+}
+
+/* ---- API Implementation ---- */
+
+void SchM_Init(const SchM_ConfigType* ConfigPtr)
+{
+    uint8 i;
+
+    (void)pthread_once(&schm_posix_once, SchM_Posix_CreateMutexes);
+
+    if (ConfigPtr == NULL_PTR) {
+        schm_areas = NULL_PTR;
+        return;
+    }
+
+    if ((ConfigPtr->areas == NULL_PTR) || (ConfigPtr->areaCount != SCHM_AREA_COUNT)) {
+        Det_ReportError(DET_MODULE_SCHM, 0u, SCHM_API_INIT, DET_E_PARAM_POINTER);
+        return;
+    }
+
+    /* The ceiling is not used here, but a configuration shared with the
+     * target must still be valid there */
+    for (i = 0u; i < SCHM_AREA_COUNT; i++) {
+        const SchM_AreaConfigType* a = &ConfigPtr->areas[i];
+
+        if ((a->lock > SCHM_LOCK_FLAG) ||
+            ((a->lock == SCHM_LOCK_BASEPRI) && (a->ceiling == 0u))) {
+            Det_ReportError(DET_MODULE_SCHM, 0u, SCHM_API_INIT, DET_E_PARAM_VALUE);
+            return;
+        }
+    }
+
+    schm_areas = ConfigPtr->areas;
+}
+
+void SchM_Enter(SchM_AreaType Area)
+{
+    if (Area >= SCHM_AREA_COUNT) {
+        return;
+    }
+
+    SchM_Posix_Lock(Area);
+
+    if (schm_area_depth[Area] == 0u) {
+        schm_area_stats[Area].entries++;
+        schm_area_entered[Area] = SchM_Posix_GetNs();
+    }
+    schm_area_depth[Area]++;
+}
+
+void SchM_Exit(SchM_AreaType Area)
+{
+    if (Area >= SCHM_AREA_COUNT) {
+        return;
+    }
+
+    /* Only the holder may leave; a stray exit must not unlock */
+    if (schm_area_depth[Area] == 0u) {
+        return;
+    }
+
+    schm_area_depth[Area]--;
+    if (schm_area_depth[Area] == 0u) {
+        uint32 held = SchM_Posix_GetNs() - schm_area_entered[Area];
+
+        if (held > schm_area_stats[Area].maxCycles) {
+            schm_area_stats[Area].maxCycles = held;
+        }
+    }
+
+    SchM_Posix_Unlock(Area);
+}
+
+Std_ReturnType SchM_GetAreaStats(SchM_AreaType Area, SchM_AreaStatsType* StatsPtr)
+{
+    if ((Area >= SCHM_AREA_COUNT) || (StatsPtr == NULL_PTR)) {
+        return E_NOT_OK;
+    }
+
+    SchM_Posix_Lock(Area);
+    *StatsPtr = schm_area_stats[Area];
+    SchM_Posix_Unlock(Area);
+
+    return E_OK;
+}
+
+void SchM_ResetAreaStats(void)
+{
+    uint8 i;
+
+    for (i = 0u; i < SCHM_AREA_COUNT; i++) {
+        SchM_Posix_Lock(i);
+        schm_area_stats[i].entries   = 0u;
+        schm_area_stats[i].maxCycles = 0u;
+        SchM_Posix_Unlock(i);
+    }
+}
+
+#endif /* PLATFORM_POSIX && !UNIT_TEST */
@@ -4,8 +4,12 @@
  * @date    2026-02-23
  *
  * @details Simulates AS5048A angle sensors for SIL.  Channel-aware defaults:
- *          - Channel 0 (pedal):    dead-zone oscillation 200-800 (torque = 0)
- *          - Channel 1+ (steering): center oscillation 8191 ±40 (0° angle)
+ *          - Channel 0 and 2 (pedal): dead-zone oscillation 200-800 (torque = 0)
+ *          - Channel 1, 3 (steering): center oscillation 8191 ±40 (0° angle)
+ *
+ *          Asynchronous transfers (Spi_Hw_AsyncTransmit) are only recorded;
+ *          Spi_Posix_Poll stands in for the DMA complete interrupt and runs
+ *          them, so a sequence ends at the next poll, not within the call.
  *
  *          When SPI_PEDAL_UDP_PORT env var is set (CVC container only),
  *          accepts UDP packets to override the pedal angle for fault
@@ -20,6 +24,8 @@
 
 #include "Platform_Types.h"
 #include "Std_Types.h"
+#include "Spi.h"
+#include "Spi_Posix.h"
 
 /* ---- POSIX headers for UDP pedal override ---- */
 #include <sys/socket.h>
@@ -35,6 +41,9 @@
 #define SPI_OVERRIDE_STEP   11u      /**< Oscillation step — must be >= stuckThreshold (10) */
 #define SPI_OVERRIDE_RANGE  40u      /**< Max offset from target angle       */
 
+/** Second pedal channel: CVC pedal sensor 1 in the asynchronous sequence */
+#define SPI_PEDAL2_CHANNEL  2u
+
 /* ---- Default dead-zone oscillation state (Channel 0 / pedal sensors) ---- */
 
 /**
@@ -73,6 +82,14 @@ static uint16 spi_steer_osc_offset = 0u;
 /** Oscillation direction */
 static uint8  spi_steer_osc_up    = 1u;
 
+/* ---- Asynchronous transfer in progress (one job on the bus) ---- */
+
+static boolean       spi_async_pending = FALSE;
+static uint8         spi_async_channel;
+static const uint16* spi_async_tx;
+static uint16*       spi_async_rx;
+static uint8         spi_async_len;
+
 /* ---- UDP pedal override state ---- */
 
 static int    spi_udp_fd          = -1;      /**< UDP socket fd (-1=disabled)*/
@@ -272,9 +289,9 @@ Std_ReturnType Spi_Hw_Transmit(uint8 Channel, const uint16* TxBuf,
                 }
             }
         }
-        else if (Channel == 0u)
+        else if ((Channel == 0u) || (Channel == SPI_PEDAL2_CHANNEL))
         {
-            /* Channel 0 (pedal): dead-zone oscillation (200-800).
+            /* Channel 0/2 (pedal): dead-zone oscillation (200-800).
              * Maps to pedal position < 67 → torque = 0, vehicle stays still. */
             RxBuf[0] = spi_sim_angle & 0x3FFFu;
 
@@ -331,6 +348,48 @@ Std_ReturnType Spi_Hw_Transmit(uint8 Channel, const uint16* TxBuf,
     return E_OK;
 }
 
+/**
+ * @brief  Start an asynchronous transfer (POSIX: runs at Spi_Posix_Poll)
+ * @param  Channel  SPI channel
+ * @param  TxBuf    Transmit buffer
+ * @param  RxBuf    Receive buffer — filled at Spi_Posix_Poll
+ * @param  Length   Transfer length in words
+ * @return E_OK, E_NOT_OK if a transfer is already in progress
+ */
+Std_ReturnType Spi_Hw_AsyncTransmit(uint8 Channel, const uint16* TxBuf,
+                                     uint16* RxBuf, uint8 Length)
+{
+    if (spi_async_pending == TRUE)
+    {
+        return E_NOT_OK;
+    }
+
+    spi_async_channel = Channel;
+    spi_async_tx      = TxBuf;
+    spi_async_rx      = RxBuf;
+    spi_async_len     = Length;
+    spi_async_pending = TRUE;
+
+    return E_OK;
+}
+
+void Spi_Posix_Poll(void)
+{
+    uint8 guard;
+    Std_ReturnType ret;
+
+    /* Spi_Isr starts the next job of the sequence: a 16-bit AS5048A job
+     * takes ~20 us at 1 MHz, so a whole sequence ends within one poll */
+    for (guard = 0u; (spi_async_pending == TRUE) &&
+                     (guard < (SPI_MAX_JOBS * SPI_MAX_SEQUENCES)); guard++)
+    {
+        spi_async_pending = FALSE;
+        ret = Spi_Hw_Transmit(spi_async_channel, spi_async_tx,
+                              spi_async_rx, spi_async_len);
+        Spi_Isr(ret);
+    }
+}
+
 /**
  * @brief  Get SPI status (POSIX: always idle)
  * @return SPI_IDLE (1)
@@ -0,0 +1,33 @@
+/**
+ * @file    Spi_Posix.h
+ * @brief   POSIX SPI backend — simulated AS5048A sensors
+ * @date    2026-03-24
+ *
+ * @details Implements Spi_Hw_* extern functions from Spi.h. The end of an
+ *          asynchronous transfer is polled (Spi_Posix_Poll) instead of
+ *          raised by the SPI DMA interrupt.
+ *
+ * @safety_req SWR-BSW-006: SPI Driver
+ * @traces_to  SYS-047, TSR-001, TSR-010
+ *
+ * @copyright Taktflow Systems 2026
+ */
+#ifndef SPI_POSIX_H
+#define SPI_POSIX_H
+
+#include "Std_Types.h"
+
+/**
+ * @brief  Run the transfers started by Spi_Hw_AsyncTransmit and report
+ *         their end to Spi_Isr (stands in for the DMA interrupt)
+ * @note   Called by the ECU's Main_Hw_Wfi, i.e. once per 1 ms SIL tick.
+ */
+void Spi_Posix_Poll(void);
+
+/**
+ * @brief  Inject a steering angle value for the SIL sensor feedback loop
+ * @param  angle  14-bit raw angle (0..16383), or 0xFFFF to clear injection
+ */
+void Spi_Posix_InjectAngle(uint16 angle);
+
+#endif /* SPI_POSIX_H */
@@ -7,6 +7,10 @@
  *          E_OK / minimal defaults. Replace with real STM32 HAL calls in
  *          Phase F2/F3 when hardware is available.
  *
+ *          Continuous groups: the stub completes one zero scan at start
+ *          and none after, so Adc_ReadGroup keeps returning 0 as the
+ *          one-shot stub does.
+ *
  * @safety_req SWR-BSW-007: ADC Driver for Analog Sensing
  * @copyright Taktflow Systems 2026
  */
@@ -71,3 +75,51 @@ uint8 Adc_Hw_GetStatus(uint8 Group)
     (void)Group; /* TODO:HARDWARE — read ADC SR register EOC flag */
     return 1u; /* ADC_IDLE */
 }
+
+/**
+ * @brief  Start the continuous scan of a group (STM32 stub: one zero scan)
+ * @param  Group              Group index
+ * @param  DmaBuffer          Double buffer, 2 * NumChannels results
+ * @param  NumChannels        Channels per scan
+ * @param  OversamplingShift  2^n conversions averaged per result
+ * @param  ScanPeriodUs       Timer period between scans
+ * @return E_OK always
+ */
+Std_ReturnType Adc_Hw_StartContinuous(uint8 Group, uint16* DmaBuffer,
+                                      uint8 NumChannels,
+                                      uint8 OversamplingShift,
+                                      uint16 ScanPeriodUs)
+{
+    uint8 i;
+
+    /* TODO:HARDWARE — timer-triggered scan, circular DMA:
+     *   trigger:      CFGR.CONT = 0, EXTEN = rising, EXTSEL = TIMx_TRGO;
+     *                 TIMx ARR = ScanPeriodUs at 1 MHz, MMS = update,
+     *                 one scan per timer update (not free-running, so
+     *                 the half/full interrupts come once per period)
+     *   oversampling: CFGR2.ROVSE = (shift > 0), OVSR = shift - 1,
+     *                 OVSS = shift (result stays 12-bit)
+     *   HAL_ADC_Start_DMA(&hadc, DmaBuffer, 2 * NumChannels)
+     *   HAL_ADC_ConvHalfCpltCallback -> Adc_Isr(Group, 0u)
+     *   HAL_ADC_ConvCpltCallback     -> Adc_Isr(Group, 1u) */
+    (void)OversamplingShift;
+    (void)ScanPeriodUs;
+
+    if (DmaBuffer != NULL_PTR) {
+        for (i = 0u; i < NumChannels; i++) {
+            DmaBuffer[i] = 0u;
+        }
+    }
+    Adc_Isr(Group, 0u);
+
+    return E_OK;
+}
+
+/**
+ * @brief  Stop the continuous scan of a group (STM32 stub: no-op)
+ * @param  Group  Group index
+ */
+void Adc_Hw_StopContinuous(uint8 Group)
+{
+    (void)Group; /* TODO:HARDWARE — stop TIMx, HAL_ADC_Stop_DMA */
+}
@@ -0,0 +1,185 @@
+/**
+ * @file    Fls_Hw_STM32.c
+ * @brief   STM32G4 embedded flash backend for the Fls MCAL driver
+ * @date    2026-03-10
+ *
+ * @details Register-level, non-blocking: StartErase/StartProgram only set
+ *          up the FLASH controller and return; Fls_MainFunction polls
+ *          Fls_Hw_IsBusy. Assumes dual-bank mode (DBANK=1, 2 KB pages);
+ *          the Fee area lives in bank 2 so code fetched from bank 1 keeps
+ *          running during an erase (read-while-write between banks).
+ *
+ *          Programming unit is one 64-bit double-word (two 32-bit stores).
+ *
+ * @safety_req SWR-BSW-031
+ * @traces_to  TSR-050
+ *
+ * @copyright Taktflow Systems 2026
+ */
+
+#include "Platform_Types.h"
+#include "Std_Types.h"
+#include "Fls.h"
+#include "stm32g4xx_hal.h"
+
+/* ==================================================================
+ * Constants
+ * ================================================================== */
+
+#define FLS_HW_BANK2_BASE       0x08040000u
+#define FLS_HW_PAGE_SIZE        0x800u
+
+#define FLS_HW_SR_ERRORS        (FLASH_SR_OPERR | FLASH_SR_PROGERR | FLASH_SR_WRPERR | \
+                                 FLASH_SR_PGAERR | FLASH_SR_SIZERR | FLASH_SR_PGSERR | \
+                                 FLASH_SR_MISERR | FLASH_SR_FASTERR)
+
+/* ==================================================================
+ * Static State
+ * ================================================================== */
+
+static uint32 fls_hw_last_sr;   /* SR error bits of the last finished op */
+
+/* ==================================================================
+ * Static Helpers
+ * ================================================================== */
+
+/** Erased pages may still be cached — reset the data cache after erase */
+static void Fls_Hw_FlushDataCache(void)
+{
+    if ((FLASH->ACR & FLASH_ACR_DCEN) != 0u)
+    {
+        FLASH->ACR &= ~FLASH_ACR_DCEN;
+        FLASH->ACR |= FLASH_ACR_DCRST;
+        FLASH->ACR &= ~FLASH_ACR_DCRST;
+        FLASH->ACR |= FLASH_ACR_DCEN;
+    }
+}
+
+/* ==================================================================
+ * Fls_Hw_* implementations
+ * ================================================================== */
+
+/**
+ * @brief  Unlock the FLASH control register and clear stale error flags
+ * @return E_OK on success, E_NOT_OK if the controller stays locked
+ */
+Std_ReturnType Fls_Hw_Init(void)
+{
+    if ((FLASH->CR & FLASH_CR_LOCK) != 0u)
+    {
+        FLASH->KEYR = FLASH_KEY1;
+        FLASH->KEYR = FLASH_KEY2;
+    }
+
+    FLASH->SR = FLS_HW_SR_ERRORS | FLASH_SR_EOP;   /* write-1-to-clear */
+    fls_hw_last_sr = 0u;
+
+    return ((FLASH->CR & FLASH_CR_LOCK) == 0u) ? E_OK : E_NOT_OK;
+}
+
+/**
+ * @brief  Start erase of the 2 KB page containing PageAddress
+ * @return E_OK if started, E_NOT_OK if the controller is busy
+ */
+Std_ReturnType Fls_Hw_StartErase(Fls_AddressType PageAddress)
+{
+    uint32 page;
+    uint32 cr;
+
+    if ((FLASH->SR & FLASH_SR_BSY) != 0u)
+    {
+        return E_NOT_OK;
+    }
+
+    FLASH->SR = FLS_HW_SR_ERRORS;
+
+    if (PageAddress >= FLS_HW_BANK2_BASE)
+    {
+        page = (PageAddress - FLS_HW_BANK2_BASE) / FLS_HW_PAGE_SIZE;
+        cr   = FLASH_CR_BKER;
+    }
+    else
+    {
+        page = (PageAddress - FLASH_BASE) / FLS_HW_PAGE_SIZE;
+        cr   = 0u;
+    }
+
+    FLASH->CR &= ~(FLASH_CR_PNB | FLASH_CR_BKER | FLASH_CR_PG);
+    FLASH->CR |= cr | FLASH_CR_PER | ((page << FLASH_CR_PNB_Pos) & FLASH_CR_PNB);
+    FLASH->CR |= FLASH_CR_STRT;
+
+    return E_OK;
+}
+
+/**
+ * @brief  Start programming one double-word at Address
+ * @return E_OK if started, E_NOT_OK if the controller is busy
+ */
+Std_ReturnType Fls_Hw_StartProgram(Fls_AddressType Address,
+                                   uint32 WordLo, uint32 WordHi)
+{
+    if ((FLASH->SR & FLASH_SR_BSY) != 0u)
+    {
+        return E_NOT_OK;
+    }
+
+    FLASH->SR = FLS_HW_SR_ERRORS;
+    FLASH->CR &= ~FLASH_CR_PER;
+    FLASH->CR |= FLASH_CR_PG;
+
+    /* Both words must be written back to back; the second store starts
+     * the programming of the double-word. */
+    *(volatile uint32*)Address = WordLo;
+    __ISB();
+    *(volatile uint32*)(Address + 4u) = WordHi;
+
+    return E_OK;
+}
+
+/**
+ * @brief  Poll the controller; on completion latch errors and clear PG/PER
+ * @return TRUE while an erase/program is in progress
+ */
+boolean Fls_Hw_IsBusy(void)
+{
+    if ((FLASH->SR & FLASH_SR_BSY) != 0u)
+    {
+        return TRUE;
+    }
+
+    if ((FLASH->CR & (FLASH_CR_PG | FLASH_CR_PER)) != 0u)
+    {
+        fls_hw_last_sr = FLASH->SR & FLS_HW_SR_ERRORS;
+        if ((FLASH->CR & FLASH_CR_PER) != 0u)
+        {
+            Fls_Hw_FlushDataCache();
+        }
+        FLASH->CR &= ~(FLASH_CR_PG | FLASH_CR_PER | FLASH_CR_PNB | FLASH_CR_BKER);
+        FLASH->SR = FLS_HW_SR_ERRORS | FLASH_SR_EOP;
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief  Error status of the last finished operation
+ * @return E_OK if no SR error flag was set
+ */
+Std_ReturnType Fls_Hw_GetResult(void)
+{
+    return (fls_hw_last_sr == 0u) ? E_OK : E_NOT_OK;
+}
+
+/**
+ * @brief  Read memory-mapped flash
+ */
+void Fls_Hw_Read(Fls_AddressType Address, uint8* DstPtr, Fls_LengthType Length)
+{
+    const volatile uint8* src = (const volatile uint8*)Address;
+    Fls_LengthType i;
+
+    for (i = 0u; i < Length; i++)
+    {
+        DstPtr[i] = src[i];
+    }
+}
@@ -6,7 +6,8 @@
  * @details Stub implementation for initial STM32 build. All functions return
  *          E_OK / minimal defaults. Replace with real STM32 HAL calls (TIM
  *          in input capture / timebase mode) in Phase F2/F3 when hardware
- *          is available.
+ *          is available. The TIMx update interrupt handler must then
+ *          call Gpt_Isr(channel) so channel notifications run.
  *
  * @safety_req SWR-BSW-010: GPT Driver for Timing
  * @copyright Taktflow Systems 2026
@@ -0,0 +1,196 @@
+/**
+ * @file    Os_Hw_STM32.c
+ * @brief   STM32G4 hardware backend for Os — level vectors, tick, cycles
+ * @date    2026-03-14
+ *
+ * @details Each Os priority level is a software-triggered exception:
+ *
+ *             level 0   PendSV          NVIC priority 15 (lowest)
+ *             level 1   CORDIC_IRQn     NVIC priority 14
+ *             level 2   FMAC_IRQn       NVIC priority 13
+ *             level 3   RNG_IRQn        NVIC priority 12
+ *             tick      SysTick         NVIC priority OS_HW_PRIO_TICK
+ *
+ *          CORDIC, FMAC and RNG are not used by the zone ECUs; only their
+ *          interrupt lines are used, pended from software through
+ *          NVIC->STIR. Priorities 0..OS_HW_PRIO_TICK-1 stay free for
+ *          device interrupts (CAN, DMA) that must preempt every task.
+ *
+ *          The handler of a level switches SP to the stack of the level
+ *          before calling Os_DispatchLevel; its own exception frame stays
+ *          on the interrupted stack. A level is never active twice, so one
+ *          stack per level is enough. Whatever preempts a level pushes its
+ *          exception frame (up to 104 bytes with FPU context) onto the
+ *          stack of that level, and device ISRs run on it entirely: size
+ *          each level stack for its deepest task plus the deepest device
+ *          ISR and one frame.
+ *
+ *          The SysTick handler generated by CubeMX calls HAL_IncTick (weak
+ *          in the HAL), which is overridden here to also call Os_Tick.
+ *          PendSV_Handler must not be generated by CubeMX (.ioc).
+ *
+ *          Activation latency is measured with the DWT cycle counter
+ *          (170 MHz core clock: 5.9 ns per cycle).
+ *
+ * @safety_req SWR-BSW-043
+ * @traces_to  TSR-046, TSR-047
+ *
+ * @standard OSEK/VDX OS 2.2.3, ISO 26262 Part 6
+ * @copyright Taktflow Systems 2026
+ */
+#include "Os.h"
+#include "stm32g4xx_hal.h"
+
+/* ---- Constants ---- */
+
+#define OS_HW_PRIO_LOWEST   15u     /**< NVIC priority of level 0 (PendSV)  */
+#define OS_HW_PRIO_TICK     4u      /**< SysTick: above all task levels     */
+
+/* ---- Internal State ---- */
+
+/** Interrupt line of levels 1..OS_MAX_LEVELS-1 (level 0 is PendSV) */
+static const IRQn_Type os_hw_level_irq[OS_MAX_LEVELS] = {
+    PendSV_IRQn, CORDIC_IRQn, FMAC_IRQn, RNG_IRQn
+};
+
+/** Initial SP of each level (top of its stack, 8-byte aligned) */
+static uint32 os_hw_stack_top[OS_MAX_LEVELS];
+static uint8  os_hw_level_count = 0u;
+
+/* ---- Private Functions ---- */
+
+/**
+ * @brief  Call Os_DispatchLevel(Level) with SP set to StackTop
+ * @note   AAPCS: r0 = Level, r1 = StackTop. r4 keeps the interrupted SP
+ *         across the call.
+ */
+void Os_Hw_DispatchOnStack(uint32 Level, uint32 StackTop);
+
+__asm__ (
+    "   .section .text.Os_Hw_DispatchOnStack, \"ax\", %progbits  \n"
+    "   .thumb                                                  \n"
+    "   .thumb_func                                             \n"
+    "   .type   Os_Hw_DispatchOnStack, %function                \n"
+    "Os_Hw_DispatchOnStack:                                     \n"
+    "   push    {r4, lr}                                        \n"
+    "   mov     r4, sp                                          \n"
+    "   mov     sp, r1                                          \n"
+    "   bl      Os_DispatchLevel                                \n"
+    "   mov     sp, r4                                          \n"
+    "   pop     {r4, pc}                                        \n"
+    "   .size   Os_Hw_DispatchOnStack, . - Os_Hw_DispatchOnStack \n"
+);
+
+static void Os_Hw_LevelHandler(uint8 Level)
+{
+    if (Level < os_hw_level_count)
+    {
+        Os_Hw_DispatchOnStack((uint32)Level, os_hw_stack_top[Level]);
+    }
+}
+
+/* ---- Os_Hw_* Implementation ---- */
+
+/**
+ * @brief  Record the level stacks, set level and tick priorities, start
+ *         the cycle counter
+ */
+void Os_Hw_Init(const Os_LevelConfigType* Levels, uint8 LevelCount)
+{
+    uint8 lvl;
+
+    os_hw_level_count = LevelCount;
+    for (lvl = 0u; lvl < LevelCount; lvl++)
+    {
+        uint32 top = (uint32)&Levels[lvl].stack[Levels[lvl].stackWords];
+        os_hw_stack_top[lvl] = top & ~7u;
+
+        NVIC_SetPriority(os_hw_level_irq[lvl], OS_HW_PRIO_LOWEST - lvl);
+        if (lvl > 0u)
+        {
+            NVIC_ClearPendingIRQ(os_hw_level_irq[lvl]);
+        }
+    }
+
+    /* Re-arms SysTick at 1 ms with the tick priority (stored in uwTickPrio
+     * so later clock reconfigurations keep it) */
+    (void)HAL_InitTick(OS_HW_PRIO_TICK);
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0u;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief  Enable the level interrupt lines
+ */
+void Os_Hw_Start(void)
+{
+    uint8 lvl;
+
+    for (lvl = 1u; lvl < os_hw_level_count; lvl++)
+    {
+        NVIC_EnableIRQ(os_hw_level_irq[lvl]);
+    }
+}
+
+/**
+ * @brief  Pend the exception of a level
+ */
+void Os_Hw_TriggerLevel(uint8 Level)
+{
+    if (Level == 0u)
+    {
+        SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+    }
+    else if (Level < os_hw_level_count)
+    {
+        NVIC->STIR = (uint32)os_hw_level_irq[Level];
+    }
+    else
+    {
+        /* Not configured: Os_Init rejects tasks on such levels */
+    }
+    __DSB();
+    __ISB();
+}
+
+/**
+ * @brief  Core cycle counter
+ */
+uint32 Os_Hw_GetCycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+/* ---- Exception Handlers ---- */
+
+void PendSV_Handler(void)
+{
+    Os_Hw_LevelHandler(0u);
+}
+
+void CORDIC_IRQHandler(void)
+{
+    Os_Hw_LevelHandler(1u);
+}
+
+void FMAC_IRQHandler(void)
+{
+    Os_Hw_LevelHandler(2u);
+}
+
+void RNG_IRQHandler(void)
+{
+    Os_Hw_LevelHandler(3u);
+}
+
+/**
+ * @brief  HAL tick (called from SysTick_Handler) — also the Os tick
+ * @note   Overrides the weak HAL implementation.
+ */
+void HAL_IncTick(void)
+{
+    uwTick += (uint32)uwTickFreq;
+    Os_Tick();
+}
@@ -0,0 +1,45 @@
+/**
+ * @file    Rte_Hw_STM32.c
+ * @brief   STM32G4 profiling backend for Rte — DWT cycle counter
+ * @date    2026-03-16
+ *
+ * @details Only built into RTE_PROFILING builds (Makefile.stm32 debug).
+ *          Profiling cycles are core clock cycles (170 MHz,
+ *          RTE_PROF_CYCLES_PER_US). The counter is shared with the Os
+ *          latency measurement and SchM; enabling it again is harmless.
+ *
+ *          Results are read over UDS (DIDs 0xF0F0 / 0xF0F1 in the ECU
+ *          Dcm configuration).
+ *
+ * @safety_req SWR-BSW-026, SWR-BSW-027
+ * @traces_to  TSR-046, TSR-047
+ *
+ * @standard AUTOSAR_SWS_RTE, ISO 26262 Part 6
+ * @copyright Taktflow Systems 2026
+ */
+#include "Rte.h"
+
+#if defined(RTE_PROFILING)
+
+#include "stm32g4xx_hal.h"
+
+/* ---- Rte_Hw_* Implementation ---- */
+
+/**
+ * @brief  Start the DWT cycle counter
+ */
+void Rte_Hw_ProfileStart(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief  Core cycle counter
+ */
+uint32 Rte_Hw_GetCycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+#endif /* RTE_PROFILING */
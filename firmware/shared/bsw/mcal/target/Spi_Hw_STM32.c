@@ -5,7 +5,15 @@
  *
  * @details Stub implementation for initial STM32 build. All functions return
  *          E_OK / minimal defaults. Replace with real STM32 HAL calls in
- *          Phase F2/F3 when hardware is available.
+ *          Phase F2/F3 when hardware is available. Asynchronous transfers
+ *          then run on DMA (HAL_SPI_TransmitReceive_DMA); the DMA RX
+ *          complete and SPI error interrupts must call Spi_Isr.
+ *
+ *          Until then a transfer ends within Spi_Hw_AsyncTransmit: on
+ *          target, Spi_AsyncTransmit runs the whole sequence before it
+ *          returns, in the caller's runnable, exactly as a synchronous
+ *          transfer would. The asynchronous queue gains nothing on STM32
+ *          before the DMA streams are in place.
  *
  * @safety_req SWR-BSW-006: SPI Driver for AS5048A Sensors
  * @copyright Taktflow Systems 2026
@@ -45,6 +53,23 @@ Std_ReturnType Spi_Hw_Transmit(uint8 Channel, const uint16* TxBuf,
     return E_OK;
 }
 
+/**
+ * @brief  Start an asynchronous SPI transfer (STM32 stub: ends at once)
+ * @param  Channel  SPI channel (chip select index)
+ * @param  TxBuf    Transmit buffer
+ * @param  RxBuf    Receive buffer
+ * @param  Length   Transfer length in words
+ * @return E_OK always
+ */
+Std_ReturnType Spi_Hw_AsyncTransmit(uint8 Channel, const uint16* TxBuf,
+                                     uint16* RxBuf, uint8 Length)
+{
+    /* TODO:HARDWARE — start DMA RX/TX streams, end reported by the DMA
+     * RX complete interrupt: Spi_Isr(E_OK), SPI error: Spi_Isr(E_NOT_OK) */
+    Spi_Isr(Spi_Hw_Transmit(Channel, TxBuf, RxBuf, Length));
+    return E_OK;
+}
+
 /**
  * @brief  Get SPI peripheral status (STM32 stub: always idle)
  * @return SPI_IDLE (1u)
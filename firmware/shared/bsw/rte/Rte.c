@@ -12,91 +12,487 @@
 #include "Rte.h"
 #include "SchM.h"
 #include "Det.h"
+#include "Bsw_Instance.h"
+
+/* ---- Internal State (one set per BSW instance, see Bsw_Instance.h) ---- */
+
+#if defined(UNIT_TEST)
+static void (*rte_test_read_group_hook)(void) = NULL_PTR;
+#endif
+
+typedef struct {
+    /** Signal buffer — statically allocated, no dynamic memory (ASIL D) */
+    volatile uint32 rte_signal_buffer[RTE_MAX_SIGNALS];
+
+    /** Write sequence counter: odd while a write is in progress. Writers
+     *  change it only inside the Rte exclusive area, so writes never nest and
+     *  a reader is never preempted by half a write it could wait for.
+     *  Accessed only through __atomic builtins (release/acquire ordering,
+     *  DMB on Cortex-M), see Rte_SeqWriteBegin and Rte_ReadGroup. */
+    uint32 rte_seq;
+
+    /** Module configuration pointer */
+    const Rte_ConfigType* rte_config;
+
+    /** Module initialization flag */
+    boolean rte_initialized;
+
+    /** Internal tick counter (1 ms resolution) */
+    uint32 rte_tick_counter;
+
+    /** Dispatch order: runnable index per position (priority descending,
+     *  configuration order for equal priority) and position bit per runnable.
+     *  All per-tick sets below are position masks, so walking a mask from
+     *  bit 0 up runs its runnables in priority order. */
+    uint8  rte_order[RTE_MAX_RUNNABLES];
+    uint16 rte_order_bit[RTE_MAX_RUNNABLES];
+
+    /** Distinct per-tick due sets (position masks) */
+    uint16 rte_sched_pattern[RTE_SCHED_MAX_PATTERNS];
+
+    /** Pattern index per tick slot of the hyperperiod */
+    uint8 rte_sched_slot_pattern[RTE_SCHED_MAX_HYPERPERIOD];
+
+    /** Hyperperiod in ticks (0: no table, due sets computed per tick) and
+     *  current slot (rte_tick_counter % hyperperiod) */
+    uint16 rte_sched_hyperperiod;
+    uint16 rte_sched_slot;
+
+    /** Runnables triggered by each signal / mode (position masks) */
+    uint16 rte_ev_data_received[RTE_MAX_SIGNALS];
+    uint16 rte_ev_data_changed[RTE_MAX_SIGNALS];
+    uint16 rte_ev_mode_switch[RTE_MAX_MODES];
+
+    /** Activated, not yet dispatched runnables (position mask): at most one
+     *  pending activation per runnable, later ones are merged into it.
+     *  Set in the Rte exclusive area, read lock-free by the dispatcher. */
+    volatile uint16 rte_event_pending;
+
+    /** Runnables enabled in the current ECU mode (position mask). Disabled
+     *  runnables are neither dispatched nor activated by events. */
+    uint16 rte_runnable_enabled;
+
+#if defined(RTE_PROFILING)
+    /** Execution-time statistics per runnable (configuration index) and per
+     *  tick. Written by the dispatcher only; readers copy them in the Rte
+     *  exclusive area (the dispatcher runs at the highest task level). */
+    Rte_ProfileType     rte_prof_runnable[RTE_MAX_RUNNABLES];
+    Rte_TickProfileType rte_prof_tick;
+#endif
+} Rte_ContextType;
+
+BSW_INSTANCE_STATE(Rte_ContextType, rte_ctx);
+
+#define rte_signal_buffer      (BSW_INSTANCE(rte_ctx).rte_signal_buffer)
+#define rte_seq                (BSW_INSTANCE(rte_ctx).rte_seq)
+#define rte_config             (BSW_INSTANCE(rte_ctx).rte_config)
+#define rte_initialized        (BSW_INSTANCE(rte_ctx).rte_initialized)
+#define rte_tick_counter       (BSW_INSTANCE(rte_ctx).rte_tick_counter)
+#define rte_order              (BSW_INSTANCE(rte_ctx).rte_order)
+#define rte_order_bit          (BSW_INSTANCE(rte_ctx).rte_order_bit)
+#define rte_sched_pattern      (BSW_INSTANCE(rte_ctx).rte_sched_pattern)
+#define rte_sched_slot_pattern (BSW_INSTANCE(rte_ctx).rte_sched_slot_pattern)
+#define rte_sched_hyperperiod  (BSW_INSTANCE(rte_ctx).rte_sched_hyperperiod)
+#define rte_sched_slot         (BSW_INSTANCE(rte_ctx).rte_sched_slot)
+#define rte_ev_data_received   (BSW_INSTANCE(rte_ctx).rte_ev_data_received)
+#define rte_ev_data_changed    (BSW_INSTANCE(rte_ctx).rte_ev_data_changed)
+#define rte_ev_mode_switch     (BSW_INSTANCE(rte_ctx).rte_ev_mode_switch)
+#define rte_event_pending      (BSW_INSTANCE(rte_ctx).rte_event_pending)
+#define rte_runnable_enabled   (BSW_INSTANCE(rte_ctx).rte_runnable_enabled)
+#define rte_prof_runnable      (BSW_INSTANCE(rte_ctx).rte_prof_runnable)
+#define rte_prof_tick          (BSW_INSTANCE(rte_ctx).rte_prof_tick)
+
+/* Compile-time check: the due set of a tick is kept in a uint16 mask */
+typedef char rte_sched_mask_check[(RTE_MAX_RUNNABLES <= 16u) ? 1 : -1];
 
-/* ---- Internal State ---- */
+/* ---- Internal Helpers ---- */
+
+/**
+ * @brief  Validate the arguments of Rte_ReadGroup / Rte_WriteGroup
+ */
+static Std_ReturnType Rte_CheckGroup(const Rte_SignalIdType* SignalIds,
+                                     const volatile void* DataPtr,
+                                     uint8 Count, uint8 ApiId)
+{
+    uint8 i;
 
-/** Signal buffer — statically allocated, no dynamic memory (ASIL D) */
-static uint32 rte_signal_buffer[RTE_MAX_SIGNALS];
+    if (rte_initialized == FALSE) {
+        Det_ReportError(DET_MODULE_RTE, 0u, ApiId, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
 
-/** Module configuration pointer */
-static const Rte_ConfigType* rte_config = NULL_PTR;
+    if ((SignalIds == NULL_PTR) || (DataPtr == NULL_PTR)) {
+        Det_ReportError(DET_MODULE_RTE, 0u, ApiId, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
 
-/** Module initialization flag */
-static boolean rte_initialized = FALSE;
+    if ((Count == 0u) || (Count > RTE_MAX_SIGNALS)) {
+        Det_ReportError(DET_MODULE_RTE, 0u, ApiId, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
 
-/** Internal tick counter (1 ms resolution) */
-static uint32 rte_tick_counter = 0u;
+    for (i = 0u; i < Count; i++) {
+        if ((SignalIds[i] >= rte_config->signalCount) ||
+            (SignalIds[i] >= RTE_MAX_SIGNALS)) {
+            Det_ReportError(DET_MODULE_RTE, 0u, ApiId, DET_E_PARAM_VALUE);
+            return E_NOT_OK;
+        }
+    }
 
-/* ---- Internal Helpers ---- */
+    return E_OK;
+}
+
+static void Rte_CopyGroup(const Rte_SignalIdType* SignalIds,
+                          uint32* DataPtr, uint8 Count)
+{
+    uint8 i;
+
+    for (i = 0u; i < Count; i++) {
+        DataPtr[i] = rte_signal_buffer[SignalIds[i]];
+    }
+}
+
+/**
+ * @brief  Open a seqlock write: make the counter odd before any data store
+ * @note   Caller holds the Rte exclusive area (single writer)
+ */
+static void Rte_SeqWriteBegin(void)
+{
+    uint32 seq = __atomic_load_n(&rte_seq, __ATOMIC_RELAXED);
+
+    __atomic_store_n(&rte_seq, seq + 1u, __ATOMIC_RELAXED);
+    /* The odd value is visible before the data stores that follow */
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
 
 /**
- * @brief  Execute all runnables due at the current tick in priority order
- * @param  tick  Current tick value (1 ms resolution)
- * @note   Uses a visited bitmap to ensure each runnable fires exactly once.
- *         Priority order: highest numeric value first (selection sort).
- *         After execution, sends WdgM checkpoint per unique SE ID.
- *         O(n^2) on runnable count but n <= 16, bounded and deterministic.
+ * @brief  Close a seqlock write: publish the data with the even counter
+ * @note   Caller holds the Rte exclusive area (single writer)
  */
-static void Rte_DispatchRunnables(uint32 tick)
+static void Rte_SeqWriteEnd(void)
+{
+    uint32 seq = __atomic_load_n(&rte_seq, __ATOMIC_RELAXED);
+
+    __atomic_store_n(&rte_seq, seq + 1u, __ATOMIC_RELEASE);
+}
+
+static uint32 Rte_Gcd(uint32 a, uint32 b)
+{
+    uint32 t;
+
+    while (b != 0u) {
+        t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/**
+ * @brief  Compute the dispatch order of all runnables
+ * @note   Highest priority first, equal priority in configuration order.
+ */
+static void Rte_BuildOrder(const Rte_ConfigType* Cfg)
 {
     uint8 i;
-    boolean visited[RTE_MAX_RUNNABLES];
-    boolean se_checkpointed[RTE_MAX_RUNNABLES];
+    uint8 pos;
+    uint16 remaining = 0u;
 
-    for (i = 0u; i < RTE_MAX_RUNNABLES; i++) {
-        visited[i] = FALSE;
-        se_checkpointed[i] = FALSE;
+    for (i = 0u; i < Cfg->runnableCount; i++) {
+        remaining |= (uint16)(1u << i);
     }
 
-    /* Select highest-priority eligible runnable each pass */
-    for (uint8 pass = 0u; pass < rte_config->runnableCount; pass++) {
-        uint8 best_idx = 0xFFu;
-        uint8 best_priority = 0u;
+    for (pos = 0u; pos < Cfg->runnableCount; pos++) {
+        uint8 best_idx = 0u;
         boolean found = FALSE;
 
-        for (i = 0u; i < rte_config->runnableCount; i++) {
-            if (visited[i] == TRUE) {
+        for (i = 0u; i < Cfg->runnableCount; i++) {
+            if (((remaining >> i) & 1u) == 0u) {
                 continue;
             }
+            if ((found == FALSE) ||
+                (Cfg->runnableConfig[i].priority > Cfg->runnableConfig[best_idx].priority)) {
+                best_idx = i;
+                found = TRUE;
+            }
+        }
+        remaining &= (uint16)(~(1u << best_idx));
 
-            const Rte_RunnableConfigType* r = &rte_config->runnableConfig[i];
+        rte_order[pos] = best_idx;
+        rte_order_bit[best_idx] = (uint16)(1u << pos);
+    }
+}
 
-            /* Skip null function pointers (defensive) */
-            if (r->func == NULL_PTR) {
-                visited[i] = TRUE;
-                continue;
+/**
+ * @brief  Register the event triggers of the configuration
+ * @return E_OK, or E_NOT_OK for an event on an unknown or NULL runnable,
+ *         an unknown kind, or a source signal / mode out of range
+ */
+static Std_ReturnType Rte_BuildEvents(const Rte_ConfigType* Cfg)
+{
+    uint8 i;
+    uint8 m;
+
+    for (i = 0u; i < RTE_MAX_SIGNALS; i++) {
+        rte_ev_data_received[i] = 0u;
+        rte_ev_data_changed[i]  = 0u;
+    }
+    for (m = 0u; m < RTE_MAX_MODES; m++) {
+        rte_ev_mode_switch[m] = 0u;
+    }
+
+    if (Cfg->eventCount == 0u) {
+        return E_OK;
+    }
+    if (Cfg->eventConfig == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    for (i = 0u; i < Cfg->eventCount; i++) {
+        const Rte_EventConfigType* ev = &Cfg->eventConfig[i];
+        uint16 bit;
+
+        if ((ev->runnable >= Cfg->runnableCount) ||
+            (Cfg->runnableConfig[ev->runnable].func == NULL_PTR)) {
+            return E_NOT_OK;
+        }
+        bit = rte_order_bit[ev->runnable];
+
+        switch (ev->kind) {
+        case RTE_EVENT_DATA_RECEIVED:
+        case RTE_EVENT_DATA_CHANGED:
+            if ((ev->source >= Cfg->signalCount) || (ev->source >= RTE_MAX_SIGNALS)) {
+                return E_NOT_OK;
+            }
+            if (ev->kind == RTE_EVENT_DATA_RECEIVED) {
+                rte_ev_data_received[ev->source] |= bit;
+            } else {
+                rte_ev_data_changed[ev->source] |= bit;
             }
+            break;
+
+        case RTE_EVENT_MODE_SWITCH:
+            if (ev->source == RTE_EVENT_ANY_MODE) {
+                for (m = 0u; m < RTE_MAX_MODES; m++) {
+                    rte_ev_mode_switch[m] |= bit;
+                }
+            } else if (ev->source < RTE_MAX_MODES) {
+                rte_ev_mode_switch[ev->source] |= bit;
+            } else {
+                return E_NOT_OK;
+            }
+            break;
 
-            /* Skip if not due this tick (period must be > 0) */
-            if ((r->periodMs == 0u) || ((tick % r->periodMs) != 0u)) {
-                visited[i] = TRUE;
-                continue;
+        default:
+            return E_NOT_OK;
+        }
+    }
+
+    return E_OK;
+}
+
+/**
+ * @brief  Activate the runnables triggered by a write of SignalId
+ * @note   Call inside the Rte exclusive area.
+ */
+static void Rte_RaiseDataEvents(Rte_SignalIdType SignalId, boolean Changed)
+{
+    uint16 triggered = rte_ev_data_received[SignalId];
+
+    if (Changed == TRUE) {
+        triggered |= rte_ev_data_changed[SignalId];
+    }
+    triggered &= rte_runnable_enabled;
+    if (triggered != 0u) {
+        rte_event_pending |= triggered;
+    }
+}
+
+/**
+ * @brief  Runnables due at a tick (position mask), from the periods
+ * @note   Runnables with a NULL function or period 0 are never due.
+ */
+static uint16 Rte_DueAt(const Rte_ConfigType* Cfg, uint32 Tick)
+{
+    uint8 i;
+    uint16 due = 0u;
+    const Rte_RunnableConfigType* r;
+
+    for (i = 0u; i < Cfg->runnableCount; i++) {
+        r = &Cfg->runnableConfig[i];
+        if ((r->func != NULL_PTR) && (r->periodMs != 0u) &&
+            ((Tick % r->periodMs) == r->offsetMs)) {
+            due |= rte_order_bit[i];
+        }
+    }
+    return due;
+}
+
+/**
+ * @brief  Precompute the schedule table for the hyperperiod
+ * @return E_OK, or E_NOT_OK if an offset is not below its period
+ * @note   Slot s holds the runnables due at every tick t with
+ *         t % hyperperiod == s. If the hyperperiod or the number of
+ *         distinct due sets exceeds RTE_SCHED_MAX_HYPERPERIOD /
+ *         RTE_SCHED_MAX_PATTERNS, no table is kept (hyperperiod 0) and
+ *         Rte_DispatchRunnables evaluates the periods every tick instead.
+ */
+static Std_ReturnType Rte_BuildSchedule(const Rte_ConfigType* Cfg)
+{
+    uint8 i;
+    uint8 p;
+    uint8 pattern_count = 0u;
+    uint16 slot;
+    uint16 due;
+    uint32 hyper = 1u;
+    const Rte_RunnableConfigType* r;
+
+    for (i = 0u; i < Cfg->runnableCount; i++) {
+        r = &Cfg->runnableConfig[i];
+        if ((r->func != NULL_PTR) && (r->periodMs != 0u) &&
+            (r->offsetMs >= r->periodMs)) {
+            return E_NOT_OK;
+        }
+    }
+
+    for (i = 0u; (i < Cfg->runnableCount) && (hyper != 0u); i++) {
+        r = &Cfg->runnableConfig[i];
+        if ((r->func != NULL_PTR) && (r->periodMs != 0u)) {
+            hyper = (hyper / Rte_Gcd(hyper, r->periodMs)) * r->periodMs;
+            if (hyper > RTE_SCHED_MAX_HYPERPERIOD) {
+                hyper = 0u;     /* Too long for the table */
             }
+        }
+    }
 
-            /* Select highest priority among candidates */
-            if ((found == FALSE) || (r->priority > best_priority)) {
-                best_idx = i;
-                best_priority = r->priority;
-                found = TRUE;
+    for (slot = 0u; slot < (uint16)hyper; slot++) {
+        due = Rte_DueAt(Cfg, slot);
+
+        for (p = 0u; p < pattern_count; p++) {
+            if (rte_sched_pattern[p] == due) {
+                break;
             }
         }
+        if (p == pattern_count) {
+            if (pattern_count >= RTE_SCHED_MAX_PATTERNS) {
+                hyper = 0u;     /* Too many distinct due sets */
+                break;
+            }
+            rte_sched_pattern[p] = due;
+            pattern_count++;
+        }
+        rte_sched_slot_pattern[slot] = p;
+    }
 
-        if (found == FALSE) {
-            break;  /* No more eligible runnables */
+    rte_sched_hyperperiod = (uint16)hyper;
+    rte_sched_slot = 0u;
+    return E_OK;
+}
+
+#if defined(RTE_PROFILING)
+/**
+ * @brief  Add one execution of a runnable to its statistics
+ */
+static void Rte_ProfileRecord(uint8 RunnableIdx, uint32 Cycles)
+{
+    Rte_ProfileType* p = &rte_prof_runnable[RunnableIdx];
+    uint32 limit = 2u * RTE_PROF_CYCLES_PER_US;
+    uint8  bin = 0u;
+
+    if ((p->count == 0u) || (Cycles < p->minCycles)) {
+        p->minCycles = Cycles;
+    }
+    if (Cycles > p->maxCycles) {
+        p->maxCycles = Cycles;
+    }
+    p->count++;
+    p->totalCycles += Cycles;
+
+    while ((bin < (RTE_PROF_HIST_BINS - 1u)) && (Cycles >= limit)) {
+        limit <<= 1u;
+        bin++;
+    }
+    p->hist[bin]++;
+}
+
+/**
+ * @brief  Cycles to microseconds, saturated to 16 bits
+ */
+static uint16 Rte_ProfileToUs(uint64 Cycles)
+{
+    uint64 us = Cycles / RTE_PROF_CYCLES_PER_US;
+
+    return (us > 0xFFFFu) ? 0xFFFFu : (uint16)us;
+}
+
+static void Rte_PutU16(uint8* Data, uint16 Value)
+{
+    Data[0] = (uint8)(Value >> 8u);
+    Data[1] = (uint8)(Value & 0xFFu);
+}
+#endif
+
+/**
+ * @brief  Execute the runnables of the current schedule slot and the
+ *         pending event-triggered runnables
+ * @note   Walks the precomputed due set of the slot (computed from the
+ *         periods when there is no table) merged with the pending
+ *         activations in dispatch order. An activation raised during the
+ *         walk still runs in this tick if its runnable comes later in the
+ *         order, otherwise in the next tick. The first runnable of each
+ *         supervised entity gets the WdgM checkpoint.
+ */
+static void Rte_DispatchRunnables(void)
+{
+    uint16 due = (rte_sched_hyperperiod != 0u) ?
+                 rte_sched_pattern[rte_sched_slot_pattern[rte_sched_slot]] :
+                 Rte_DueAt(rte_config, rte_tick_counter);
+    uint16 se_done = 0u;
+    uint8  pos = 0u;
+    const Rte_RunnableConfigType* r;
+#if defined(RTE_PROFILING)
+    uint32 start;
+#endif
+
+    due &= rte_runnable_enabled;
+
+    while (pos < rte_config->runnableCount) {
+        uint16 pending = rte_event_pending;
+        uint16 live = (uint16)((due | pending) >> pos);
+        uint16 bit;
+
+        if (live == 0u) {
+            break;
+        }
+        while ((live & 1u) == 0u) {
+            live >>= 1u;
+            pos++;
         }
+        bit = (uint16)(1u << pos);
 
-        /* Execute the highest-priority runnable */
-        visited[best_idx] = TRUE;
-        rte_config->runnableConfig[best_idx].func();
+        if ((pending & bit) != 0u) {
+            SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0();
+            rte_event_pending &= (uint16)(~bit);
+            SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0();
+        }
+
+        r = &rte_config->runnableConfig[rte_order[pos]];
+#if defined(RTE_PROFILING)
+        start = Rte_Hw_GetCycles();
+        r->func();
+        Rte_ProfileRecord(rte_order[pos], Rte_Hw_GetCycles() - start);
+#else
+        r->func();
+#endif
 
         /* WdgM checkpoint per unique SE ID */
-        uint8 se = rte_config->runnableConfig[best_idx].seId;
-        if (se < RTE_MAX_RUNNABLES) {
-            if (se_checkpointed[se] == FALSE) {
-                (void)WdgM_CheckpointReached(se);
-                se_checkpointed[se] = TRUE;
-            }
+        if ((r->seId < RTE_MAX_RUNNABLES) &&
+            (((se_done >> r->seId) & 1u) == 0u)) {
+            se_done |= (uint16)(1u << r->seId);
+            (void)WdgM_CheckpointReached(r->seId);
         }
+
+        pos++;
     }
 }
 
@@ -106,8 +502,8 @@ static void Rte_DispatchRunnables(uint32 tick)
  * @brief  Initialize the RTE module
  * @param  ConfigPtr  Pointer to RTE configuration
  * @note   If ConfigPtr is NULL or counts exceed static limits, the module
- *         enters a failed state. All signal buffers are zeroed, then set
- *         to configured initial values.
+ *         enters a failed state. Builds the schedule table, then zeroes all
+ *         signal buffers and sets them to configured initial values.
  */
 void Rte_Init(const Rte_ConfigType* ConfigPtr)
 {
@@ -135,6 +531,22 @@ void Rte_Init(const Rte_ConfigType* ConfigPtr)
         return;
     }
 
+    Rte_BuildOrder(ConfigPtr);
+
+    if (Rte_BuildEvents(ConfigPtr) != E_OK) {
+        Det_ReportError(DET_MODULE_RTE, 0u, RTE_API_INIT, DET_E_PARAM_VALUE);
+        rte_initialized = FALSE;
+        rte_config = NULL_PTR;
+        return;
+    }
+
+    if (Rte_BuildSchedule(ConfigPtr) != E_OK) {
+        Det_ReportError(DET_MODULE_RTE, 0u, RTE_API_INIT, DET_E_PARAM_VALUE);
+        rte_initialized = FALSE;
+        rte_config = NULL_PTR;
+        return;
+    }
+
     rte_config = ConfigPtr;
 
     /* Zero all signal buffers first */
@@ -151,7 +563,14 @@ void Rte_Init(const Rte_ConfigType* ConfigPtr)
     }
 
     rte_tick_counter = 0u;
+    rte_event_pending = 0u;
+    rte_runnable_enabled = (uint16)((1uL << rte_config->runnableCount) - 1uL);
     rte_initialized = TRUE;
+
+#if defined(RTE_PROFILING)
+    Rte_ResetProfile();
+    Rte_Hw_ProfileStart();
+#endif
 }
 
 /**
@@ -162,6 +581,8 @@ void Rte_Init(const Rte_ConfigType* ConfigPtr)
  */
 Std_ReturnType Rte_Write(Rte_SignalIdType SignalId, uint32 Data)
 {
+    boolean changed;
+
     if (rte_initialized == FALSE) {
         Det_ReportError(DET_MODULE_RTE, 0u, RTE_API_WRITE, DET_E_UNINIT);
         return E_NOT_OK;
@@ -175,7 +596,11 @@ Std_ReturnType Rte_Write(Rte_SignalIdType SignalId, uint32 Data)
     }
 
     SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0();
+    changed = (rte_signal_buffer[SignalId] != Data) ? TRUE : FALSE;
+    Rte_SeqWriteBegin();
     rte_signal_buffer[SignalId] = Data;
+    Rte_SeqWriteEnd();
+    Rte_RaiseDataEvents(SignalId, changed);
     SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0();
 
     return E_OK;
@@ -206,26 +631,337 @@ Std_ReturnType Rte_Read(Rte_SignalIdType SignalId, uint32* DataPtr)
         return E_NOT_OK;
     }
 
-    SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0();
+    /* Single aligned word: atomic, no exclusive area needed */
     *DataPtr = rte_signal_buffer[SignalId];
+
+    return E_OK;
+}
+
+/**
+ * @brief  Read several signals as one consistent snapshot (lock-free)
+ * @param  SignalIds  Signal identifiers
+ * @param  DataPtr    Destination, one value per signal
+ * @param  Count      Number of signals
+ * @return E_OK on success, E_NOT_OK on any invalid argument
+ */
+Std_ReturnType Rte_ReadGroup(const Rte_SignalIdType* SignalIds,
+                             uint32* DataPtr, uint8 Count)
+{
+    uint8 attempt;
+
+    if (Rte_CheckGroup(SignalIds, DataPtr, Count, RTE_API_READ_GROUP) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    for (attempt = 0u; attempt < RTE_SEQ_MAX_RETRIES; attempt++) {
+        uint32 seq = __atomic_load_n(&rte_seq, __ATOMIC_ACQUIRE);
+
+        if ((seq & 1u) == 0u) {
+            Rte_CopyGroup(SignalIds, DataPtr, Count);
+#if defined(UNIT_TEST)
+            if (rte_test_read_group_hook != NULL_PTR) {
+                rte_test_read_group_hook();
+            }
+#endif
+            /* The copy completes before the counter is checked again */
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if (__atomic_load_n(&rte_seq, __ATOMIC_RELAXED) == seq) {
+                return E_OK;
+            }
+        }
+    }
+
+    /* Writers kept preempting the copy: take it with writers locked out */
+    SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0();
+    Rte_CopyGroup(SignalIds, DataPtr, Count);
     SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0();
 
     return E_OK;
 }
 
+/**
+ * @brief  Write several signals as one update
+ * @param  SignalIds  Signal identifiers
+ * @param  Data       Values, one per signal
+ * @param  Count      Number of signals
+ * @return E_OK on success, E_NOT_OK on any invalid argument
+ */
+Std_ReturnType Rte_WriteGroup(const Rte_SignalIdType* SignalIds,
+                              const uint32* Data, uint8 Count)
+{
+    uint8 i;
+
+    if (Rte_CheckGroup(SignalIds, Data, Count, RTE_API_WRITE_GROUP) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0();
+    Rte_SeqWriteBegin();
+    for (i = 0u; i < Count; i++) {
+        boolean changed = (rte_signal_buffer[SignalIds[i]] != Data[i]) ? TRUE : FALSE;
+
+        rte_signal_buffer[SignalIds[i]] = Data[i];
+        Rte_RaiseDataEvents(SignalIds[i], changed);
+    }
+    Rte_SeqWriteEnd();
+    SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0();
+
+    return E_OK;
+}
+
+/**
+ * @brief  Mode switch notification — activate the mode-switch runnables
+ * @param  Mode  Mode entered (< RTE_MAX_MODES)
+ */
+void Rte_SwitchMode(uint8 Mode)
+{
+    if (rte_initialized == FALSE) {
+        Det_ReportError(DET_MODULE_RTE, 0u, RTE_API_SWITCH_MODE, DET_E_UNINIT);
+        return;
+    }
+
+    if (Mode >= RTE_MAX_MODES) {
+        Det_ReportError(DET_MODULE_RTE, 0u, RTE_API_SWITCH_MODE, DET_E_PARAM_VALUE);
+        return;
+    }
+
+    SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0();
+    rte_event_pending |= (uint16)(rte_ev_mode_switch[Mode] & rte_runnable_enabled);
+    SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0();
+}
+
+/**
+ * @brief  Select the runnables executed in the current ECU mode
+ * @param  Mask  Bit n enables runnable n of runnableConfig
+ * @note   Converts the mask to dispatch positions once, so the dispatcher
+ *         only ANDs it into the due set. Pending activations of disabled
+ *         runnables are dropped. Supervised entities whose runnables are
+ *         all disabled are deactivated in WdgM, the others (re)activated.
+ */
+void Rte_SetRunnableMask(uint16 Mask)
+{
+    uint16 enabled = 0u;
+    uint16 se_used = 0u;
+    uint16 se_enabled = 0u;
+    uint8  i;
+
+    if (rte_initialized == FALSE) {
+        Det_ReportError(DET_MODULE_RTE, 0u, RTE_API_SET_RUNNABLE_MASK, DET_E_UNINIT);
+        return;
+    }
+
+    for (i = 0u; i < rte_config->runnableCount; i++) {
+        uint8 se_id = rte_config->runnableConfig[i].seId;
+        boolean on = (((Mask >> i) & 1u) != 0u) ? TRUE : FALSE;
+
+        if (on == TRUE) {
+            enabled |= rte_order_bit[i];
+        }
+        if (se_id < RTE_MAX_RUNNABLES) {
+            se_used |= (uint16)(1u << se_id);
+            if (on == TRUE) {
+                se_enabled |= (uint16)(1u << se_id);
+            }
+        }
+    }
+
+    SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0();
+    rte_runnable_enabled = enabled;
+    rte_event_pending &= enabled;
+    SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0();
+
+    for (i = 0u; i < RTE_MAX_RUNNABLES; i++) {
+        if (((se_used >> i) & 1u) != 0u) {
+            (void)WdgM_SetEntityActive(i, (((se_enabled >> i) & 1u) != 0u) ? TRUE : FALSE);
+        }
+    }
+}
+
 /**
  * @brief  RTE main function — call every 1 ms from system tick
- * @note   Increments tick counter and dispatches due runnables in
- *         priority order. Does nothing if module is not initialized.
+ * @note   Increments tick counter and dispatches due and event-activated
+ *         runnables in priority order. Does nothing if module is not
+ *         initialized.
  */
 void Rte_MainFunction(void)
 {
+#if defined(RTE_PROFILING)
+    uint32 start;
+    uint32 cycles;
+#endif
+
     if ((rte_initialized == FALSE) || (rte_config == NULL_PTR)) {
         return;
     }
 
+#if defined(RTE_PROFILING)
+    start = Rte_Hw_GetCycles();
+#endif
+
     rte_tick_counter++;
+    rte_sched_slot++;
+    if (rte_sched_slot >= rte_sched_hyperperiod) {
+        rte_sched_slot = 0u;
+    }
 
     /* Dispatch runnables whose period divides the current tick */
-    Rte_DispatchRunnables(rte_tick_counter);
+    Rte_DispatchRunnables();
+
+#if defined(RTE_PROFILING)
+    cycles = Rte_Hw_GetCycles() - start;
+    rte_prof_tick.ticks++;
+    rte_prof_tick.lastCycles = cycles;
+    if (cycles > rte_prof_tick.maxCycles) {
+        rte_prof_tick.maxCycles = cycles;
+    }
+    rte_prof_tick.totalCycles += cycles;
+#endif
+}
+
+#if defined(RTE_PROFILING)
+Std_ReturnType Rte_GetRunnableProfile(uint8 RunnableIdx, Rte_ProfileType* ProfilePtr)
+{
+    if (rte_initialized == FALSE) {
+        Det_ReportError(DET_MODULE_RTE, 0u, RTE_API_GET_PROFILE, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if (ProfilePtr == NULL_PTR) {
+        Det_ReportError(DET_MODULE_RTE, 0u, RTE_API_GET_PROFILE, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    if (RunnableIdx >= rte_config->runnableCount) {
+        Det_ReportError(DET_MODULE_RTE, 0u, RTE_API_GET_PROFILE, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0();
+    *ProfilePtr = rte_prof_runnable[RunnableIdx];
+    SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0();
+
+    return E_OK;
+}
+
+Std_ReturnType Rte_GetTickProfile(Rte_TickProfileType* ProfilePtr)
+{
+    if (rte_initialized == FALSE) {
+        Det_ReportError(DET_MODULE_RTE, 0u, RTE_API_GET_PROFILE, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if (ProfilePtr == NULL_PTR) {
+        Det_ReportError(DET_MODULE_RTE, 0u, RTE_API_GET_PROFILE, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0();
+    *ProfilePtr = rte_prof_tick;
+    SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0();
+
+    return E_OK;
+}
+
+void Rte_ResetProfile(void)
+{
+    uint8 i;
+    uint8 b;
+
+    SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0();
+    for (i = 0u; i < RTE_MAX_RUNNABLES; i++) {
+        rte_prof_runnable[i].count       = 0u;
+        rte_prof_runnable[i].minCycles   = 0u;
+        rte_prof_runnable[i].maxCycles   = 0u;
+        rte_prof_runnable[i].totalCycles = 0u;
+        for (b = 0u; b < RTE_PROF_HIST_BINS; b++) {
+            rte_prof_runnable[i].hist[b] = 0u;
+        }
+    }
+    rte_prof_tick.ticks       = 0u;
+    rte_prof_tick.lastCycles  = 0u;
+    rte_prof_tick.maxCycles   = 0u;
+    rte_prof_tick.totalCycles = 0u;
+    SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0();
+}
+
+Std_ReturnType Rte_ReadProfileSummary(uint8* Data, uint8 Length)
+{
+    Rte_TickProfileType tick;
+    Rte_ProfileType     prof;
+    uint8 i;
+    uint8 n;
+
+    if ((Data == NULL_PTR) || (rte_initialized == FALSE)) {
+        return E_NOT_OK;
+    }
+
+    n = rte_config->runnableCount;
+    if (Length < RTE_PROF_SUMMARY_LENGTH(n)) {
+        return E_NOT_OK;
+    }
+
+    for (i = 0u; i < Length; i++) {
+        Data[i] = 0u;
+    }
+
+    (void)Rte_GetTickProfile(&tick);
+    if (tick.ticks > 0u) {
+        Rte_PutU16(&Data[0], Rte_ProfileToUs(tick.totalCycles / tick.ticks));
+    }
+    Rte_PutU16(&Data[2], Rte_ProfileToUs(tick.maxCycles));
+
+    for (i = 0u; i < n; i++) {
+        uint8* rec = &Data[4u + (i * 6u)];
+
+        (void)Rte_GetRunnableProfile(i, &prof);
+        Rte_PutU16(&rec[0], Rte_ProfileToUs(prof.minCycles));
+        if (prof.count > 0u) {
+            Rte_PutU16(&rec[2], Rte_ProfileToUs(prof.totalCycles / prof.count));
+        }
+        Rte_PutU16(&rec[4], Rte_ProfileToUs(prof.maxCycles));
+    }
+
+    return E_OK;
+}
+
+Std_ReturnType Rte_ReadProfileHistogram(uint8* Data, uint8 Length)
+{
+    Rte_ProfileType prof;
+    uint8 i;
+    uint8 b;
+    uint8 n;
+
+    if ((Data == NULL_PTR) || (rte_initialized == FALSE)) {
+        return E_NOT_OK;
+    }
+
+    n = rte_config->runnableCount;
+    if (Length < RTE_PROF_HISTOGRAM_LENGTH(n)) {
+        return E_NOT_OK;
+    }
+
+    for (i = 0u; i < Length; i++) {
+        Data[i] = 0u;
+    }
+
+    for (i = 0u; i < n; i++) {
+        (void)Rte_GetRunnableProfile(i, &prof);
+        if (prof.count == 0u) {
+            continue;
+        }
+        for (b = 0u; b < RTE_PROF_HIST_BINS; b++) {
+            Data[(i * RTE_PROF_HIST_BINS) + b] =
+                (uint8)(((uint64)prof.hist[b] * 100u) / prof.count);
+        }
+    }
+
+    return E_OK;
+}
+#endif /* RTE_PROFILING */
+
+#if defined(UNIT_TEST)
+void Rte_Test_SetReadGroupHook(void (*Hook)(void))
+{
+    rte_test_read_group_hook = Hook;
 }
+#endif
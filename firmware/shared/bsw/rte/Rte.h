@@ -20,6 +20,42 @@
 #define RTE_MAX_SIGNALS     48u  /**< Max number of RTE signals */
 #define RTE_MAX_RUNNABLES   16u  /**< Max number of scheduled runnables */
 
+/* Schedule table built by Rte_Init: one entry per tick of the hyperperiod
+ * (LCM of all runnable periods), each pointing to one of the distinct
+ * priority-ordered runnable lists. A table beyond these limits is not an
+ * error: the runnables due are then computed from the periods every tick */
+#define RTE_SCHED_MAX_HYPERPERIOD   1000u  /**< Max LCM of periods in ms      */
+#define RTE_SCHED_MAX_PATTERNS      16u    /**< Max distinct per-tick lists   */
+
+/* Event-triggered runnables */
+#define RTE_MAX_MODES               8u     /**< Modes known to Rte_SwitchMode  */
+#define RTE_EVENT_ANY_MODE          0xFFu  /**< Mode-switch event source: any  */
+
+#define RTE_EVENT_DATA_RECEIVED     0u     /**< Every write of the signal      */
+#define RTE_EVENT_DATA_CHANGED      1u     /**< Write that changes the value   */
+#define RTE_EVENT_MODE_SWITCH       2u     /**< Rte_SwitchMode to the mode     */
+
+/* Signal buffer consistency: writers bump a sequence counter around every
+ * update (odd while writing) inside the Rte exclusive area; readers do not
+ * mask interrupts but retry when the counter moved during their copy */
+#define RTE_SEQ_MAX_RETRIES         4u     /**< Lock-free group read attempts
+                                                before the locked fallback  */
+
+/* Execution-time profiling (RTE_PROFILING builds): per-runnable histogram
+ * bin k counts executions shorter than 2^(k+1) us, the last bin the rest */
+#define RTE_PROF_HIST_BINS          8u
+
+#if defined(PLATFORM_STM32)
+#define RTE_PROF_CYCLES_PER_US      170u   /**< DWT CYCCNT, 170 MHz core   */
+#else
+#define RTE_PROF_CYCLES_PER_US      1000u  /**< POSIX / test: nanoseconds  */
+#endif
+
+/** UDS DID data lengths for n runnables (Rte_ReadProfileSummary /
+ *  Rte_ReadProfileHistogram) */
+#define RTE_PROF_SUMMARY_LENGTH(n)      (4u + ((n) * 6u))
+#define RTE_PROF_HISTOGRAM_LENGTH(n)    ((n) * RTE_PROF_HIST_BINS)
+
 /* ---- Well-Known Signal IDs ---- */
 
 #define RTE_SIG_TORQUE_REQUEST    0u
@@ -52,24 +88,71 @@ typedef struct {
     uint16                  periodMs;   /**< Execution period in ms */
     uint8                   priority;   /**< Priority (higher = runs first) */
     uint8                   seId;       /**< Supervised entity ID for WdgM */
+    uint16                  offsetMs;   /**< Phase offset in ms (< periodMs):
+                                             fires when tick % periodMs ==
+                                             offsetMs. Spreads runnables of
+                                             one period over several ticks */
 } Rte_RunnableConfigType;
 
+/** Event trigger of a runnable (in addition to or instead of periodMs) */
+typedef struct {
+    uint8                   runnable;   /**< Index into runnableConfig */
+    uint8                   kind;       /**< RTE_EVENT_* */
+    uint16                  source;     /**< Signal ID (data events) or mode
+                                             (RTE_EVENT_ANY_MODE for all) */
+} Rte_EventConfigType;
+
 /** RTE module configuration */
 typedef struct {
     const Rte_SignalConfigType*     signalConfig;   /**< Signal config array */
     uint8                           signalCount;    /**< Number of signals */
     const Rte_RunnableConfigType*   runnableConfig; /**< Runnable config array */
     uint8                           runnableCount;  /**< Number of runnables */
+    const Rte_EventConfigType*      eventConfig;    /**< Event triggers (NULL if none) */
+    uint8                           eventCount;     /**< Number of event triggers */
 } Rte_ConfigType;
 
+#if defined(RTE_PROFILING)
+/** Execution time of one runnable since Rte_Init / Rte_ResetProfile,
+ *  in profiling cycles (RTE_PROF_CYCLES_PER_US) */
+typedef struct {
+    uint32  count;                      /**< Executions measured            */
+    uint32  minCycles;
+    uint32  maxCycles;
+    uint64  totalCycles;                /**< Sum, mean = totalCycles / count */
+    uint32  hist[RTE_PROF_HIST_BINS];   /**< Log-scale histogram, see
+                                             RTE_PROF_HIST_BINS             */
+} Rte_ProfileType;
+
+/** Time spent in Rte_MainFunction per 1 ms tick */
+typedef struct {
+    uint32  ticks;                      /**< Ticks measured                 */
+    uint32  lastCycles;
+    uint32  maxCycles;
+    uint64  totalCycles;                /**< Mean load = totalCycles / ticks
+                                             per 1000 us                    */
+} Rte_TickProfileType;
+
+/* ---- Hardware Abstraction (implemented per platform) ----
+ * STM32: mcal/target/Rte_Hw_STM32.c (DWT cycle counter)
+ * POSIX: mcal/posix/Rte_Posix.c (clock_gettime, dump on exit)
+ * Test:  Mocked in test/test_Rte_asild.c
+ */
+extern void   Rte_Hw_ProfileStart(void);
+extern uint32 Rte_Hw_GetCycles(void);
+#endif /* RTE_PROFILING */
+
 /* ---- API Functions ---- */
 
 /**
  * @brief  Initialize the RTE module
  * @param  ConfigPtr  Pointer to RTE configuration (must not be NULL)
- * @note   Sets all signal buffers to their configured initial values.
- *         If ConfigPtr is NULL, the module enters a failed state where
- *         all API calls return E_NOT_OK.
+ * @note   Sets all signal buffers to their configured initial values
+ *         and builds the runnable schedule table (when the periods fit
+ *         RTE_SCHED_MAX_HYPERPERIOD / RTE_SCHED_MAX_PATTERNS). If ConfigPtr
+ *         is NULL, a runnable has offsetMs >= periodMs, or an event trigger
+ *         is invalid, the module enters a failed state where all API calls
+ *         return E_NOT_OK.
  */
 void Rte_Init(const Rte_ConfigType* ConfigPtr);
 
@@ -87,17 +170,137 @@ Std_ReturnType Rte_Write(Rte_SignalIdType SignalId, uint32 Data);
  * @param  DataPtr   Pointer to receive the signal value (must not be NULL)
  * @return E_OK on success, E_NOT_OK if not initialized, SignalId invalid,
  *         or DataPtr is NULL
+ * @note   Lock-free: a 32-bit aligned load is atomic.
  */
 Std_ReturnType Rte_Read(Rte_SignalIdType SignalId, uint32* DataPtr);
 
+/**
+ * @brief  Read several signals as one consistent snapshot
+ * @param  SignalIds  Signal identifiers (each must be < signalCount)
+ * @param  DataPtr    Receives the values, DataPtr[i] for SignalIds[i]
+ * @param  Count      Number of signals (1..RTE_MAX_SIGNALS)
+ * @return E_OK on success, E_NOT_OK if not initialized, a pointer is NULL,
+ *         Count is 0 or too large, or any SignalId is invalid (nothing is
+ *         read then)
+ * @note   Lock-free: the values are copied without masking interrupts and
+ *         the copy is repeated if a write completed meanwhile. After
+ *         RTE_SEQ_MAX_RETRIES disturbed attempts the copy is made in the
+ *         Rte exclusive area.
+ */
+Std_ReturnType Rte_ReadGroup(const Rte_SignalIdType* SignalIds,
+                             uint32* DataPtr, uint8 Count);
+
+/**
+ * @brief  Write several signals as one update
+ * @param  SignalIds  Signal identifiers (each must be < signalCount)
+ * @param  Data       Values, Data[i] for SignalIds[i]
+ * @param  Count      Number of signals (1..RTE_MAX_SIGNALS)
+ * @return E_OK on success, E_NOT_OK if not initialized, a pointer is NULL,
+ *         Count is 0 or too large, or any SignalId is invalid (nothing is
+ *         written then)
+ * @note   Rte_ReadGroup never returns a mix of values from before and
+ *         after this call.
+ */
+Std_ReturnType Rte_WriteGroup(const Rte_SignalIdType* SignalIds,
+                              const uint32* Data, uint8 Count);
+
+/**
+ * @brief  Mode switch notification (e.g. from BswM on a mode transition)
+ * @param  Mode  Mode entered (< RTE_MAX_MODES)
+ * @note   Activates the runnables with an RTE_EVENT_MODE_SWITCH trigger on
+ *         Mode; they run at the next dispatch point.
+ */
+void Rte_SwitchMode(uint8 Mode);
+
+/**
+ * @brief  Enable a subset of the runnables (e.g. from BswM per ECU mode)
+ * @param  Mask  Bit n enables runnableConfig[n]; all are enabled by
+ *               Rte_Init. Bits beyond runnableCount are ignored.
+ * @note   Disabled runnables are skipped by Rte_MainFunction at no extra
+ *         cost per runnable and ignore their event triggers. The WdgM
+ *         supervision of an entity is suspended while all its runnables
+ *         are disabled (WdgM_SetEntityActive).
+ */
+void Rte_SetRunnableMask(uint16 Mask);
+
 /**
  * @brief  RTE main function — call every 1 ms from system tick
  * @note   Increments internal tick counter and fires runnables whose
- *         period divides the current tick. Runnables at the same period
- *         execute in priority order (highest first). After each period
- *         group fires, WdgM_CheckpointReached is called for each
- *         supervised entity that had a runnable execute.
+ *         period divides the current tick minus their offset, together
+ *         with the event-activated runnables, in priority order (highest
+ *         first; equal priority in configuration order). After the first
+ *         runnable of a supervised entity has executed in a tick,
+ *         WdgM_CheckpointReached is called for that entity. The order is
+ *         taken from the schedule table built at Rte_Init, so a tick costs
+ *         one table lookup plus the due runnables.
+ *
+ *         Event triggers (Rte_EventConfigType): a write of the source
+ *         signal (Rte_Write / Rte_WriteGroup, e.g. from a Com RX bridge)
+ *         or Rte_SwitchMode activates the runnable. A runnable has at most
+ *         one pending activation (further ones are merged), so the queue
+ *         is bounded by RTE_MAX_RUNNABLES. Pending runnables run at the
+ *         next dispatch point in priority order with the due ones: in the
+ *         current tick if the dispatcher has not passed their priority yet,
+ *         else in the next tick. A runnable both due and pending runs once.
  */
 void Rte_MainFunction(void);
 
+/* ---- Profiling API (RTE_PROFILING builds only, compiled out otherwise) ---- */
+#if defined(RTE_PROFILING)
+
+/**
+ * @brief  Execution-time statistics of one runnable
+ * @param  RunnableIdx  Index into runnableConfig
+ * @param  ProfilePtr   Destination (must not be NULL)
+ * @return E_OK on success; E_NOT_OK if not initialized, an argument is
+ *         invalid
+ * @note   Every dispatched runnable is timed with the
+ *         platform cycle counter. On STM32 the 1 ms dispatcher runs at the
+ *         highest Os level, so the figures include device ISRs only.
+ */
+Std_ReturnType Rte_GetRunnableProfile(uint8 RunnableIdx, Rte_ProfileType* ProfilePtr);
+
+/**
+ * @brief  Time spent per tick in Rte_MainFunction (all runnables plus
+ *         dispatch overhead)
+ * @return E_OK on success; E_NOT_OK if not initialized or ProfilePtr is
+ *         NULL
+ */
+Std_ReturnType Rte_GetTickProfile(Rte_TickProfileType* ProfilePtr);
+
+/**
+ * @brief  Clear all execution-time statistics
+ */
+void Rte_ResetProfile(void);
+
+/**
+ * @brief  UDS DID read callback (Dcm_DidReadFuncType): profile summary
+ * @param  Data    Output buffer
+ * @param  Length  Buffer length, >= RTE_PROF_SUMMARY_LENGTH(runnableCount)
+ * @return E_OK on success, E_NOT_OK if Length is too short (NRC)
+ * @note   Layout, big-endian uint16 in us saturated at 0xFFFF:
+ *         mean and max tick time, then min, mean and max execution time of
+ *         each runnable in configuration order. Unused bytes are zero.
+ */
+Std_ReturnType Rte_ReadProfileSummary(uint8* Data, uint8 Length);
+
+/**
+ * @brief  UDS DID read callback (Dcm_DidReadFuncType): histograms
+ * @param  Data    Output buffer
+ * @param  Length  Buffer length, >= RTE_PROF_HISTOGRAM_LENGTH(runnableCount)
+ * @return E_OK on success, E_NOT_OK if Length is too short (NRC)
+ * @note   RTE_PROF_HIST_BINS bytes per runnable in configuration order:
+ *         share of its executions in each bin, in percent (rounded down).
+ */
+Std_ReturnType Rte_ReadProfileHistogram(uint8* Data, uint8 Length);
+
+#endif /* RTE_PROFILING */
+
+/* ---- Test Helpers ---- */
+#if defined(UNIT_TEST)
+/** Hook called by Rte_ReadGroup between the copy and the sequence check
+ *  (simulates a preempting writer), NULL_PTR to remove */
+void Rte_Test_SetReadGroupHook(void (*Hook)(void));
+#endif
+
 #endif /* RTE_H */
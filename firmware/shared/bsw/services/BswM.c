@@ -13,17 +13,30 @@
  * by BswM_MainFunction. Safety-critical transitions (to SAFE_STOP)
  * are always allowed from any operational state.
  *
+ * On entering a mode, its mode-control entry selects the runnables that
+ * keep executing and the Com I-PDU groups that keep transmitting, so
+ * degraded modes shed CPU and bus load.
+ *
  * @standard AUTOSAR_SWS_BSWModeManager, ISO 26262 Part 6
  * @copyright Taktflow Systems 2026
  */
 #include "BswM.h"
 #include "Det.h"
+#include "Bsw_Instance.h"
+
+/* ---- Internal State (one set per BSW instance, see Bsw_Instance.h) ---- */
+
+typedef struct {
+    const BswM_ConfigType*  bswm_config;
+    boolean                 bswm_initialized;
+    BswM_ModeType           bswm_current_mode;
+} BswM_ContextType;
 
-/* ---- Internal State ---- */
+BSW_INSTANCE_STATE(BswM_ContextType, bswm_ctx);
 
-static const BswM_ConfigType*  bswm_config = NULL_PTR;
-static boolean                 bswm_initialized = FALSE;
-static BswM_ModeType           bswm_current_mode;
+#define bswm_config       (BSW_INSTANCE(bswm_ctx).bswm_config)
+#define bswm_initialized  (BSW_INSTANCE(bswm_ctx).bswm_initialized)
+#define bswm_current_mode (BSW_INSTANCE(bswm_ctx).bswm_current_mode)
 
 /* ---- Private Helpers ---- */
 
@@ -65,6 +78,27 @@ static boolean bswm_is_transition_valid(BswM_ModeType current, BswM_ModeType req
     return TRUE;
 }
 
+/**
+ * @brief  Apply the mode-control entry of a mode
+ */
+static void bswm_apply_mode_controls(BswM_ModeType mode)
+{
+    const BswM_ModeControlType* ctrl;
+
+    if (bswm_config->ModeControls == NULL_PTR) {
+        return;
+    }
+
+    ctrl = &bswm_config->ModeControls[mode];
+
+    if (bswm_config->RunnableControl != NULL_PTR) {
+        bswm_config->RunnableControl(ctrl->RunnableMask);
+    }
+    if (bswm_config->IpduGroupControl != NULL_PTR) {
+        bswm_config->IpduGroupControl(ctrl->IpduGroups);
+    }
+}
+
 /* ---- API Implementation ---- */
 
 void BswM_Init(const BswM_ConfigType* ConfigPtr)
@@ -122,7 +156,15 @@ Std_ReturnType BswM_RequestMode(BswM_RequesterIdType RequesterId,
         return E_NOT_OK;
     }
 
-    bswm_current_mode = RequestedMode;
+    if (RequestedMode != bswm_current_mode) {
+        bswm_current_mode = RequestedMode;
+
+        bswm_apply_mode_controls(RequestedMode);
+
+        if (bswm_config->ModeSwitchNotification != NULL_PTR) {
+            bswm_config->ModeSwitchNotification((uint8)RequestedMode);
+        }
+    }
 
     return E_OK;
 }
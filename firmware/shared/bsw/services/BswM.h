@@ -17,6 +17,7 @@
 /* ---- Constants ---- */
 
 #define BSWM_MAX_MODE_ACTIONS   8u  /**< Max mode-action table entries */
+#define BSWM_MODE_COUNT         5u  /**< Entries of the mode-control table */
 
 /* ---- Types ---- */
 
@@ -34,6 +35,21 @@ typedef uint8 BswM_RequesterIdType;
 /** Mode action callback function pointer */
 typedef void (*BswM_ActionFuncType)(void);
 
+/** Mode switch notification (e.g. Rte_SwitchMode) */
+typedef void (*BswM_ModeSwitchFuncType)(uint8 Mode);
+
+/** Runnable set control (e.g. Rte_SetRunnableMask) */
+typedef void (*BswM_RunnableControlFuncType)(uint16 RunnableMask);
+
+/** I-PDU group control (e.g. Com_IpduGroupControl) */
+typedef void (*BswM_IpduGroupControlFuncType)(uint8 IpduGroups);
+
+/** Per-mode selection of runnables and TX I-PDU groups */
+typedef struct {
+    uint16  RunnableMask;   /**< Enabled runnables, bit n = Rte runnable n */
+    uint8   IpduGroups;     /**< Started Com I-PDU groups, bit n = group n */
+} BswM_ModeControlType;
+
 /** Mode-action mapping entry (compile-time) */
 typedef struct {
     BswM_ModeType       Mode;       /**< Mode that triggers this action     */
@@ -44,6 +60,17 @@ typedef struct {
 typedef struct {
     const BswM_ModeActionType*  ModeActions;    /**< Mode-action table      */
     uint8                       ActionCount;    /**< Number of entries       */
+    BswM_ModeSwitchFuncType     ModeSwitchNotification; /**< Called with the
+                                                     new mode on every mode
+                                                     change (NULL: none)    */
+    const BswM_ModeControlType* ModeControls;   /**< BSWM_MODE_COUNT entries,
+                                                     indexed by mode, applied
+                                                     on entering the mode
+                                                     (NULL: none)           */
+    BswM_RunnableControlFuncType  RunnableControl;  /**< Receives RunnableMask
+                                                     (NULL: not controlled) */
+    BswM_IpduGroupControlFuncType IpduGroupControl; /**< Receives IpduGroups
+                                                     (NULL: not controlled) */
 } BswM_ConfigType;
 
 /* ---- API Functions ---- */
@@ -67,6 +94,10 @@ void BswM_MainFunction(void);
  * @return E_OK if transition valid, E_NOT_OK if invalid or not initialized
  * @note   Only forward transitions allowed (STARTUP->RUN->DEGRADED->SAFE_STOP->SHUTDOWN)
  *         Exception: RUN->SAFE_STOP is always allowed (safety override)
+ *         On a change of mode the ModeControls entry of the new mode is
+ *         applied (RunnableControl, IpduGroupControl), then the change is
+ *         reported to ModeSwitchNotification. STARTUP is the state at
+ *         BswM_Init, before Rte and Com run: its entry is never applied.
  */
 Std_ReturnType BswM_RequestMode(BswM_RequesterIdType RequesterId,
                                  BswM_ModeType RequestedMode);
@@ -0,0 +1,36 @@
+/**
+ * @file    Bsw_Instance.c
+ * @brief   Optional multi-instance BSW — current instance selection
+ * @date    2026-03-21
+ *
+ * @details See Bsw_Instance.h. In a single-instance build only instance 0
+ *          exists and the modules do not read Bsw_CurrentInstance.
+ *
+ * @safety_req N/A — SIL simulation only; target builds use one instance
+ * @standard AUTOSAR_SWS_BSWGeneral
+ * @copyright Taktflow Systems 2026
+ */
+#include "Bsw_Instance.h"
+#include "Det.h"
+
+/* ---- Internal State ---- */
+
+uint8 Bsw_CurrentInstance = 0u;
+
+/* ---- API Implementation ---- */
+
+Std_ReturnType Bsw_SetInstance(uint8 InstanceId)
+{
+    if (InstanceId >= BSW_INSTANCE_COUNT) {
+        Det_ReportError(DET_MODULE_BSW, 0u, BSW_API_SET_INSTANCE, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    Bsw_CurrentInstance = InstanceId;
+    return E_OK;
+}
+
+uint8 Bsw_GetInstance(void)
+{
+    return Bsw_CurrentInstance;
+}
@@ -0,0 +1,273 @@
+/**
+ * @file    CanTSyn.c
+ * @brief   Time Synchronization over CAN implementation
+ * @date    2026-03-23
+ *
+ * @details Master: a SYNC is due every syncPeriodMs; if its transmit request
+ *          fails it is retried at the next call. The FUP is prepared when
+ *          the SYNC is sent and transmitted at the next call, so a slave
+ *          polling its CAN RX has seen the SYNC before the FUP arrives.
+ *
+ *          Slave: a SYNC is kept (seconds, sequence counter, ingress time)
+ *          until the FUP with the same sequence counter arrives, a newer
+ *          SYNC replaces it, or fupTimeoutMs passes.
+ *
+ * @safety_req SWR-BSW-046
+ * @traces_to  SYS-053, TSR-046
+ *
+ * @standard AUTOSAR_SWS_TimeSyncOverCAN, ISO 26262 Part 6
+ * @copyright Taktflow Systems 2026
+ */
+#include "CanTSyn.h"
+#include "StbM.h"
+#include "PduR.h"
+#include "SchM.h"
+#include "Det.h"
+#include "Bsw_Instance.h"
+
+/* ---- Constants ---- */
+
+#define CANTSYN_US_PER_S        1000000uL
+#define CANTSYN_NS_PER_S        1000000000uL
+#define CANTSYN_NS_PER_US       1000uL
+#define CANTSYN_SEQ_MASK        0x0Fu
+#define CANTSYN_OVS_MASK        0x03u
+
+/* ---- Internal State (one set per BSW instance, see Bsw_Instance.h) ---- */
+
+typedef struct {
+    const CanTSyn_ConfigType* cts_config;
+
+    /* Master */
+    uint16  cts_sync_elapsed_ms;    /**< Since the last SYNC was sent        */
+    uint8   cts_tx_seq;             /**< Sequence counter of the next SYNC   */
+    boolean cts_fup_pending;
+    uint8   cts_fup[CANTSYN_PDU_LENGTH];
+
+    /* Slave */
+    boolean cts_sync_valid;         /**< SYNC received, waiting for its FUP  */
+    uint8   cts_sync_seq;
+    uint32  cts_sync_sec;
+    uint32  cts_sync_local;         /**< StbM local time at SYNC ingress     */
+    uint16  cts_sync_age_ms;
+} CanTSyn_ContextType;
+
+BSW_INSTANCE_STATE(CanTSyn_ContextType, cts_ctx);
+
+#define cts_config              (BSW_INSTANCE(cts_ctx).cts_config)
+#define cts_sync_elapsed_ms     (BSW_INSTANCE(cts_ctx).cts_sync_elapsed_ms)
+#define cts_tx_seq              (BSW_INSTANCE(cts_ctx).cts_tx_seq)
+#define cts_fup_pending         (BSW_INSTANCE(cts_ctx).cts_fup_pending)
+#define cts_fup                 (BSW_INSTANCE(cts_ctx).cts_fup)
+#define cts_sync_valid          (BSW_INSTANCE(cts_ctx).cts_sync_valid)
+#define cts_sync_seq            (BSW_INSTANCE(cts_ctx).cts_sync_seq)
+#define cts_sync_sec            (BSW_INSTANCE(cts_ctx).cts_sync_sec)
+#define cts_sync_local          (BSW_INSTANCE(cts_ctx).cts_sync_local)
+#define cts_sync_age_ms         (BSW_INSTANCE(cts_ctx).cts_sync_age_ms)
+
+/* ---- Private Helpers ---- */
+
+static void cantsyn_put_u32(uint8* Dst, uint32 Value)
+{
+    Dst[0] = (uint8)(Value >> 24u);
+    Dst[1] = (uint8)(Value >> 16u);
+    Dst[2] = (uint8)(Value >> 8u);
+    Dst[3] = (uint8)Value;
+}
+
+static uint32 cantsyn_get_u32(const uint8* Src)
+{
+    return ((uint32)Src[0] << 24u) | ((uint32)Src[1] << 16u) |
+           ((uint32)Src[2] << 8u)  |  (uint32)Src[3];
+}
+
+static void cantsyn_header(uint8* Pdu, uint8 Type, uint8 Seq)
+{
+    uint8 i;
+
+    for (i = 0u; i < CANTSYN_PDU_LENGTH; i++) {
+        Pdu[i] = 0u;
+    }
+    Pdu[0] = Type;
+    Pdu[2] = (uint8)((uint8)(cts_config->timeDomain << 4u) | (Seq & CANTSYN_SEQ_MASK));
+}
+
+/**
+ * @brief  Master: send a SYNC with the seconds of T0 and prepare its FUP
+ * @return E_OK if the SYNC was sent
+ */
+static Std_ReturnType cantsyn_send_sync(void)
+{
+    StbM_TimeStampType      t0;
+    StbM_TimeStampType      t1;
+    StbM_TimeBaseStatusType status;
+    uint8       sync[CANTSYN_PDU_LENGTH];
+    PduInfoType pdu = { sync, CANTSYN_PDU_LENGTH };
+    uint32      sec;
+    uint32      ns;
+
+    if ((StbM_GetCurrentTime(&t0, &status) != E_OK) ||
+        ((status & STBM_STATUS_GLOBAL_TIME_BASE) == 0u)) {
+        return E_NOT_OK;
+    }
+
+    sec = (uint32)(t0 / CANTSYN_US_PER_S);
+    cantsyn_header(sync, CANTSYN_TYPE_SYNC, cts_tx_seq);
+    cantsyn_put_u32(&sync[4], sec);
+
+    if (PduR_Transmit(cts_config->txPduId, &pdu) != E_OK) {
+        return E_NOT_OK;
+    }
+
+    /* Egress: T0 plus the time the transmit request took */
+    if (StbM_GetCurrentTime(&t1, &status) != E_OK) {
+        t1 = t0;
+    }
+    ns = (uint32)(t0 % CANTSYN_US_PER_S) * CANTSYN_NS_PER_US;
+    t1 = ((t1 - t0) * CANTSYN_NS_PER_US) + ns;
+
+    cantsyn_header(cts_fup, CANTSYN_TYPE_FUP, cts_tx_seq);
+    cts_fup[3] = (uint8)((t1 / CANTSYN_NS_PER_S) & CANTSYN_OVS_MASK);
+    cantsyn_put_u32(&cts_fup[4], (uint32)(t1 % CANTSYN_NS_PER_S));
+    /* More than 3 s in the transmit request cannot be told: no FUP */
+    cts_fup_pending = ((t1 / CANTSYN_NS_PER_S) <= CANTSYN_OVS_MASK) ? TRUE : FALSE;
+
+    cts_tx_seq = (uint8)((cts_tx_seq + 1u) & CANTSYN_SEQ_MASK);
+    return E_OK;
+}
+
+static void cantsyn_master_main(void)
+{
+    PduInfoType pdu;
+
+    if (cts_fup_pending == TRUE) {
+        pdu.SduDataPtr = cts_fup;
+        pdu.SduLength  = CANTSYN_PDU_LENGTH;
+        (void)PduR_Transmit(cts_config->txPduId, &pdu);   /* Lost: slave drops the SYNC */
+        cts_fup_pending = FALSE;
+    }
+
+    if (cts_sync_elapsed_ms < cts_config->syncPeriodMs) {
+        cts_sync_elapsed_ms += cts_config->mainPeriodMs;
+    }
+    if (cts_sync_elapsed_ms >= cts_config->syncPeriodMs) {
+        if (cantsyn_send_sync() == E_OK) {
+            cts_sync_elapsed_ms = 0u;
+        }
+    }
+}
+
+/* ---- API Implementation ---- */
+
+void CanTSyn_Init(const CanTSyn_ConfigType* ConfigPtr)
+{
+    if (ConfigPtr == NULL_PTR) {
+        Det_ReportError(DET_MODULE_CANTSYN, 0u, CANTSYN_API_INIT, DET_E_PARAM_POINTER);
+        return;
+    }
+
+    if (((ConfigPtr->role != CANTSYN_ROLE_MASTER) && (ConfigPtr->role != CANTSYN_ROLE_SLAVE)) ||
+        (ConfigPtr->timeDomain > CANTSYN_MAX_TIME_DOMAIN) ||
+        (ConfigPtr->mainPeriodMs == 0u) ||
+        ((ConfigPtr->role == CANTSYN_ROLE_MASTER) && (ConfigPtr->syncPeriodMs == 0u)) ||
+        ((ConfigPtr->role == CANTSYN_ROLE_SLAVE) && (ConfigPtr->fupTimeoutMs == 0u))) {
+        Det_ReportError(DET_MODULE_CANTSYN, 0u, CANTSYN_API_INIT, DET_E_PARAM_VALUE);
+        return;
+    }
+
+    SchM_Enter(SCHM_AREA_STBM);
+
+    /* Master: the first SYNC is due at once */
+    cts_sync_elapsed_ms = ConfigPtr->syncPeriodMs;
+    cts_tx_seq          = 0u;
+    cts_fup_pending     = FALSE;
+    cts_sync_valid      = FALSE;
+    cts_sync_seq        = 0u;
+    cts_sync_sec        = 0u;
+    cts_sync_local      = 0u;
+    cts_sync_age_ms     = 0u;
+
+    cts_config = ConfigPtr;
+
+    SchM_Exit(SCHM_AREA_STBM);
+}
+
+void CanTSyn_RxIndication(PduIdType RxPduId, const PduInfoType* PduInfoPtr)
+{
+    const uint8*       data;
+    uint8              seq;
+    uint32             ns;
+    StbM_TimeStampType global = 0u;
+    uint32             local  = 0u;
+    boolean            complete = FALSE;
+
+    (void)RxPduId;
+
+    if (cts_config == NULL_PTR) {
+        Det_ReportError(DET_MODULE_CANTSYN, 0u, CANTSYN_API_RX_INDICATION, DET_E_UNINIT);
+        return;
+    }
+
+    if ((PduInfoPtr == NULL_PTR) || (PduInfoPtr->SduDataPtr == NULL_PTR)) {
+        Det_ReportError(DET_MODULE_CANTSYN, 0u, CANTSYN_API_RX_INDICATION, DET_E_PARAM_POINTER);
+        return;
+    }
+
+    data = PduInfoPtr->SduDataPtr;
+    if ((cts_config->role != CANTSYN_ROLE_SLAVE) ||
+        (PduInfoPtr->SduLength < CANTSYN_PDU_LENGTH) ||
+        ((data[2] >> 4u) != cts_config->timeDomain)) {
+        return;
+    }
+    seq = data[2] & CANTSYN_SEQ_MASK;
+
+    SchM_Enter(SCHM_AREA_STBM);
+
+    if (data[0] == CANTSYN_TYPE_SYNC) {
+        cts_sync_local  = StbM_GetLocalTimeUs();
+        cts_sync_sec    = cantsyn_get_u32(&data[4]);
+        cts_sync_seq    = seq;
+        cts_sync_age_ms = 0u;
+        cts_sync_valid  = TRUE;
+    } else if ((data[0] == CANTSYN_TYPE_FUP) && (cts_sync_valid == TRUE) &&
+               (seq == cts_sync_seq)) {
+        ns = cantsyn_get_u32(&data[4]);
+        if (ns < CANTSYN_NS_PER_S) {
+            global = (((StbM_TimeStampType)cts_sync_sec +
+                       (StbM_TimeStampType)(data[3] & CANTSYN_OVS_MASK)) * CANTSYN_US_PER_S) +
+                     (StbM_TimeStampType)(ns / CANTSYN_NS_PER_US);
+            local    = cts_sync_local;
+            complete = TRUE;
+        }
+        cts_sync_valid = FALSE;
+    } else {
+        /* Other type, or FUP without its SYNC — discard */
+    }
+
+    SchM_Exit(SCHM_AREA_STBM);
+
+    if (complete == TRUE) {
+        (void)StbM_BusSetGlobalTime(global, local);
+    }
+}
+
+void CanTSyn_MainFunction(void)
+{
+    if (cts_config == NULL_PTR) {
+        return;
+    }
+
+    if (cts_config->role == CANTSYN_ROLE_MASTER) {
+        cantsyn_master_main();
+        return;
+    }
+
+    SchM_Enter(SCHM_AREA_STBM);
+    if (cts_sync_valid == TRUE) {
+        cts_sync_age_ms += cts_config->mainPeriodMs;
+        if (cts_sync_age_ms >= cts_config->fupTimeoutMs) {
+            cts_sync_valid = FALSE;         /* FUP lost */
+        }
+    }
+    SchM_Exit(SCHM_AREA_STBM);
+}
@@ -0,0 +1,94 @@
+/**
+ * @file    CanTSyn.h
+ * @brief   Time Synchronization over CAN — SYNC/FUP messages of StbM's time
+ * @date    2026-03-23
+ *
+ * @details Two-step protocol (AUTOSAR CanTSyn, messages without CRC):
+ *          - The time master sends a SYNC message with the seconds of its
+ *            global time T0, read just before the transmit request.
+ *          - After the request it reads its time again (t1) and sends a
+ *            follow-up (FUP) with the nanoseconds of T0 plus t1 - T0. The
+ *            FUP therefore holds the master's time when the SYNC left, not
+ *            when it was requested.
+ *          - A time slave reads its local clock when the SYNC arrives and
+ *            gives the master's time from the matching FUP to StbM as
+ *            valid at that moment (StbM_BusSetGlobalTime).
+ *
+ *          Both messages use one CAN ID per time domain. Frame layout:
+ *
+ *              Byte 0    Type: 0x10 SYNC, 0x18 FUP
+ *              Byte 1    Reserved (0)
+ *              Byte 2    Time domain (bits 7..4), sequence counter (3..0)
+ *              Byte 3    SYNC: reserved; FUP: overflow seconds (bits 1..0)
+ *              Byte 4-7  SYNC: seconds; FUP: nanoseconds (big-endian)
+ *
+ *          The precision is bounded by the timestamps: the slave's ingress
+ *          time is taken when Can_MainFunction_Read delivers the SYNC, and
+ *          the master's egress time when the frame is handed to the CAN
+ *          controller. Keep the SYNC's CAN ID high-priority and RX polling
+ *          fast on slaves.
+ *
+ * @safety_req SWR-BSW-046
+ * @traces_to  SYS-053, TSR-046
+ *
+ * @standard AUTOSAR_SWS_TimeSyncOverCAN, ISO 26262 Part 6
+ * @copyright Taktflow Systems 2026
+ */
+#ifndef CANTSYN_H
+#define CANTSYN_H
+
+#include "Std_Types.h"
+#include "ComStack_Types.h"
+
+/* ---- Constants ---- */
+
+#define CANTSYN_PDU_LENGTH      8u
+
+#define CANTSYN_TYPE_SYNC       0x10u   /**< SYNC message, not CRC secured */
+#define CANTSYN_TYPE_FUP        0x18u   /**< FUP message, not CRC secured  */
+
+#define CANTSYN_MAX_TIME_DOMAIN 15u
+
+/* ---- Types ---- */
+
+typedef enum {
+    CANTSYN_ROLE_MASTER = 0u,   /**< Sends SYNC/FUP of StbM's time     */
+    CANTSYN_ROLE_SLAVE  = 1u    /**< Receives them, sets StbM's time   */
+} CanTSyn_RoleType;
+
+/** CanTSyn configuration (one time domain) */
+typedef struct {
+    CanTSyn_RoleType role;
+    uint8       timeDomain;     /**< 0..CANTSYN_MAX_TIME_DOMAIN            */
+    PduIdType   txPduId;        /**< Master: TX PDU of SYNC and FUP        */
+    uint16      syncPeriodMs;   /**< Master: time between SYNCs (> 0)      */
+    uint16      mainPeriodMs;   /**< Call period of CanTSyn_MainFunction   */
+    uint16      fupTimeoutMs;   /**< Slave: SYNC dropped if its FUP is not
+                                     received within this time (> 0)       */
+} CanTSyn_ConfigType;
+
+/* ---- API Functions ---- */
+
+/**
+ * @brief  Initialize CanTSyn (master: first SYNC at the next main function)
+ * @param  ConfigPtr  Configuration (must not be NULL)
+ * @note   Call after StbM_Init and PduR_Init.
+ */
+void CanTSyn_Init(const CanTSyn_ConfigType* ConfigPtr);
+
+/**
+ * @brief  Receive a SYNC or FUP message — PduR destination PDUR_DEST_CANTSYN
+ * @param  RxPduId     Upper PDU ID of the route (unused, one time domain)
+ * @param  PduInfoPtr  Received frame
+ * @note   Messages of other time domains, of other types and on a master
+ *         are ignored.
+ */
+void CanTSyn_RxIndication(PduIdType RxPduId, const PduInfoType* PduInfoPtr);
+
+/**
+ * @brief  Master: send SYNC and FUP messages. Slave: FUP timeout.
+ * @note   Call every mainPeriodMs. The FUP follows its SYNC one call later.
+ */
+void CanTSyn_MainFunction(void);
+
+#endif /* CANTSYN_H */
@@ -15,14 +15,23 @@
  */
 #include "CanTp.h"
 #include "Det.h"
+#include "Bsw_Instance.h"
 
 #include <string.h>  /* memcpy, memset */
 
-/* ---- Internal State ---- */
+/* ---- Internal State (one set per BSW instance, see Bsw_Instance.h) ---- */
 
-static CanTp_ChannelType cantp_channel;
-static const CanTp_ConfigType* cantp_config = NULL_PTR;
-static boolean cantp_initialized = FALSE;
+typedef struct {
+    CanTp_ChannelType cantp_channel;
+    const CanTp_ConfigType* cantp_config;
+    boolean cantp_initialized;
+} CanTp_ContextType;
+
+BSW_INSTANCE_STATE(CanTp_ContextType, cantp_ctx);
+
+#define cantp_channel     (BSW_INSTANCE(cantp_ctx).cantp_channel)
+#define cantp_config      (BSW_INSTANCE(cantp_ctx).cantp_config)
+#define cantp_initialized (BSW_INSTANCE(cantp_ctx).cantp_initialized)
 
 /* ---- Forward Declarations ---- */
 
@@ -12,21 +12,43 @@
 #include "Com.h"
 #include "SchM.h"
 #include "Det.h"
+#include "Bsw_Instance.h"
 
-/* ---- Internal State ---- */
+/* ---- Internal State (one set per BSW instance, see Bsw_Instance.h) ---- */
 
-static const Com_ConfigType*  com_config = NULL_PTR;
-static boolean                com_initialized = FALSE;
+typedef struct {
+    const Com_ConfigType*  com_config;
+    boolean                com_initialized;
 
-/* TX PDU buffers */
-static uint8  com_tx_pdu_buf[COM_MAX_PDUS][COM_PDU_SIZE];
-static boolean com_tx_pending[COM_MAX_PDUS];
+    /* Started I-PDU groups */
+    Com_IpduGroupVector    com_ipdu_groups_started;
 
-/* RX PDU buffers */
-static uint8  com_rx_pdu_buf[COM_MAX_PDUS][COM_PDU_SIZE];
+    /* TX PDU buffers */
+    uint8   com_tx_pdu_buf[COM_MAX_PDUS][COM_PDU_SIZE];
+    boolean com_tx_pending[COM_MAX_PDUS];
 
-/* RX deadline monitoring: cycles since last Com_RxIndication per PDU */
-static uint16 com_rx_timeout_cnt[COM_MAX_PDUS];
+    /* RX PDU buffers */
+    uint8   com_rx_pdu_buf[COM_MAX_PDUS][COM_PDU_SIZE];
+
+    /* RX deadline monitoring: cycles since last Com_RxIndication per PDU */
+    uint16  com_rx_timeout_cnt[COM_MAX_PDUS];
+
+    /* Receive time of the last Com_RxIndication per PDU (getRxTimeUs) */
+    uint32  com_rx_time_us[COM_MAX_PDUS];
+    boolean com_rx_received[COM_MAX_PDUS];
+} Com_ContextType;
+
+BSW_INSTANCE_STATE(Com_ContextType, com_ctx);
+
+#define com_config              (BSW_INSTANCE(com_ctx).com_config)
+#define com_initialized         (BSW_INSTANCE(com_ctx).com_initialized)
+#define com_ipdu_groups_started (BSW_INSTANCE(com_ctx).com_ipdu_groups_started)
+#define com_tx_pdu_buf          (BSW_INSTANCE(com_ctx).com_tx_pdu_buf)
+#define com_tx_pending          (BSW_INSTANCE(com_ctx).com_tx_pending)
+#define com_rx_pdu_buf          (BSW_INSTANCE(com_ctx).com_rx_pdu_buf)
+#define com_rx_timeout_cnt      (BSW_INSTANCE(com_ctx).com_rx_timeout_cnt)
+#define com_rx_time_us          (BSW_INSTANCE(com_ctx).com_rx_time_us)
+#define com_rx_received         (BSW_INSTANCE(com_ctx).com_rx_received)
 
 /* RX deadline monitoring period: 10ms per cycle (matches RTE scheduler) */
 #define COM_RX_CYCLE_MS   10u
@@ -38,6 +60,20 @@ static uint8 com_get_byte_offset(uint8 bitPosition)
     return bitPosition / 8u;
 }
 
+/* TX PDU at index TxIndex of txPduConfig stopped by its I-PDU groups */
+static boolean com_tx_pdu_stopped(uint8 TxIndex)
+{
+    Com_IpduGroupVector groups;
+
+    if (com_config->txPduGroups == NULL_PTR) {
+        return FALSE;
+    }
+
+    groups = com_config->txPduGroups[TxIndex];
+
+    return ((groups != 0u) && ((groups & com_ipdu_groups_started) == 0u)) ? TRUE : FALSE;
+}
+
 /* ---- API Implementation ---- */
 
 void Com_Init(const Com_ConfigType* ConfigPtr)
@@ -62,8 +98,11 @@ void Com_Init(const Com_ConfigType* ConfigPtr)
         }
         com_tx_pending[i] = FALSE;
         com_rx_timeout_cnt[i] = 0u;
+        com_rx_time_us[i] = 0u;
+        com_rx_received[i] = FALSE;
     }
 
+    com_ipdu_groups_started = (Com_IpduGroupVector)0xFFu;
     com_initialized = TRUE;
 }
 
@@ -172,6 +211,7 @@ Std_ReturnType Com_ReceiveSignal(Com_SignalIdType SignalId, void* SignalDataPtr)
 void Com_RxIndication(PduIdType ComRxPduId, const PduInfoType* PduInfoPtr)
 {
     uint8 i;
+    uint32 rx_time = 0u;
 
     if ((com_initialized == FALSE) || (com_config == NULL_PTR)) {
         Det_ReportError(DET_MODULE_COM, 0u, COM_API_RX_INDICATION, DET_E_UNINIT);
@@ -193,10 +233,17 @@ void Com_RxIndication(PduIdType ComRxPduId, const PduInfoType* PduInfoPtr)
         return;
     }
 
+    /* Receive time, read outside the area (the time source locks its own) */
+    if (com_config->getRxTimeUs != NULL_PTR) {
+        rx_time = com_config->getRxTimeUs();
+    }
+
     SchM_Enter_Com_COM_EXCLUSIVE_AREA_0();
 
     /* Reset RX deadline counter — fresh data arrived */
     com_rx_timeout_cnt[ComRxPduId] = 0u;
+    com_rx_time_us[ComRxPduId] = rx_time;
+    com_rx_received[ComRxPduId] = TRUE;
 
     /* Store received PDU data */
     for (i = 0u; (i < PduInfoPtr->SduLength) && (i < COM_PDU_SIZE); i++) {
@@ -233,10 +280,14 @@ void Com_MainFunction_Tx(void)
         return;
     }
 
-    /* Transmit all pending TX PDUs */
+    /* Transmit all pending TX PDUs of started groups */
     for (i = 0u; i < com_config->txPduCount; i++) {
         PduIdType pdu_id = com_config->txPduConfig[i].PduId;
 
+        if (com_tx_pdu_stopped(i) == TRUE) {
+            continue;
+        }
+
         SchM_Enter_Com_COM_EXCLUSIVE_AREA_0();
         if ((pdu_id < COM_MAX_PDUS) && (com_tx_pending[pdu_id] == TRUE)) {
             PduInfoType pdu_info;
@@ -314,3 +365,59 @@ void Com_MainFunction_Rx(void)
         SchM_Exit_Com_COM_EXCLUSIVE_AREA_0();
     }
 }
+
+void Com_IpduGroupControl(Com_IpduGroupVector GroupVector)
+{
+    if ((com_initialized == FALSE) || (com_config == NULL_PTR)) {
+        Det_ReportError(DET_MODULE_COM, 0u, COM_API_IPDU_GROUP_CONTROL, DET_E_UNINIT);
+        return;
+    }
+
+    com_ipdu_groups_started = GroupVector;
+}
+
+boolean Com_IsTxPduStarted(PduIdType TxPduId)
+{
+    uint8 i;
+
+    if ((com_initialized == FALSE) || (com_config == NULL_PTR)) {
+        return FALSE;
+    }
+
+    for (i = 0u; i < com_config->txPduCount; i++) {
+        if (com_config->txPduConfig[i].PduId == TxPduId) {
+            return (com_tx_pdu_stopped(i) == TRUE) ? FALSE : TRUE;
+        }
+    }
+
+    return TRUE;
+}
+
+Std_ReturnType Com_GetRxPduTime(PduIdType ComRxPduId, uint32* TimeUsPtr)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((com_initialized == FALSE) || (com_config == NULL_PTR)) {
+        Det_ReportError(DET_MODULE_COM, 0u, COM_API_GET_RX_PDU_TIME, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if (TimeUsPtr == NULL_PTR) {
+        Det_ReportError(DET_MODULE_COM, 0u, COM_API_GET_RX_PDU_TIME, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    if (ComRxPduId >= COM_MAX_PDUS) {
+        Det_ReportError(DET_MODULE_COM, 0u, COM_API_GET_RX_PDU_TIME, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    SchM_Enter_Com_COM_EXCLUSIVE_AREA_0();
+    if ((com_config->getRxTimeUs != NULL_PTR) && (com_rx_received[ComRxPduId] == TRUE)) {
+        *TimeUsPtr = com_rx_time_us[ComRxPduId];
+        ret = E_OK;
+    }
+    SchM_Exit_Com_COM_EXCLUSIVE_AREA_0();
+
+    return ret;
+}
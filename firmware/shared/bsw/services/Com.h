@@ -20,11 +20,15 @@
 #define COM_MAX_PDUS     16u
 #define COM_MAX_SIGNALS  32u
 #define COM_PDU_SIZE      8u  /**< CAN 2.0B fixed 8 bytes */
+#define COM_MAX_IPDU_GROUPS 8u  /**< Bits of Com_IpduGroupVector */
 
 /* ---- Types ---- */
 
 typedef uint8 Com_SignalIdType;
 
+/** Set of I-PDU groups, bit n = group n */
+typedef uint8 Com_IpduGroupVector;
+
 typedef enum {
     COM_UINT8  = 0u,
     COM_UINT16 = 1u,
@@ -56,6 +60,9 @@ typedef struct {
     uint16     TimeoutMs;           /**< RX timeout in ms          */
 } Com_RxPduConfigType;
 
+/** Time source of RX PDU receive times, microseconds */
+typedef uint32 (*Com_TimestampFuncType)(void);
+
 /** Com module configuration */
 typedef struct {
     const Com_SignalConfigType*  signalConfig;
@@ -64,6 +71,13 @@ typedef struct {
     uint8                        txPduCount;
     const Com_RxPduConfigType*   rxPduConfig;
     uint8                        rxPduCount;
+    const Com_IpduGroupVector*   txPduGroups;   /**< Groups of each TX PDU
+                                                     (txPduConfig order),
+                                                     NULL: no groups     */
+    Com_TimestampFuncType        getRxTimeUs;   /**< Receive time of RX PDUs,
+                                                     e.g. StbM_GetTimeUs
+                                                     (time shared by all
+                                                     ECUs); NULL: none   */
 } Com_ConfigType;
 
 /* ---- External dependencies ---- */
@@ -78,4 +92,31 @@ void           Com_RxIndication(PduIdType ComRxPduId, const PduInfoType* PduInfo
 void           Com_MainFunction_Tx(void);
 void           Com_MainFunction_Rx(void);
 
+/**
+ * @brief  Start the given I-PDU groups and stop all others
+ * @param  GroupVector  Groups to start (all are started by Com_Init)
+ * @note   A TX PDU is transmitted while at least one of its groups is
+ *         started; a PDU in no group is always transmitted. Signals of a
+ *         stopped PDU are still buffered and go out once it is restarted.
+ */
+void           Com_IpduGroupControl(Com_IpduGroupVector GroupVector);
+
+/**
+ * @brief  Whether a TX PDU may be transmitted (I-PDU group state)
+ * @return TRUE if the PDU is in no group or in a started group, or is not
+ *         configured; FALSE if all its groups are stopped or Com is not
+ *         initialized
+ * @note   For SWCs that send a PDU directly through PduR_Transmit.
+ */
+boolean        Com_IsTxPduStarted(PduIdType TxPduId);
+
+/**
+ * @brief  Receive time of the last reception of an RX PDU
+ * @param  ComRxPduId  RX PDU
+ * @param  TimeUsPtr   Output: getRxTimeUs at Com_RxIndication
+ * @return E_OK, E_NOT_OK if not initialized, no getRxTimeUs configured,
+ *         invalid PDU or not received since Com_Init
+ */
+Std_ReturnType Com_GetRxPduTime(PduIdType ComRxPduId, uint32* TimeUsPtr);
+
 #endif /* COM_H */
@@ -9,6 +9,7 @@
  * Implements UDS diagnostic services for physical ECUs:
  * - 0x10 DiagnosticSessionControl (Default + Extended sessions)
  * - 0x11 ECUReset (hard + soft reset via BswM)
+ * - 0x19 ReadDTCInformation (0x01, 0x02, 0x04, 0x06 from the Dem event memory)
  * - 0x22 ReadDataByIdentifier (configurable DID table)
  * - 0x27 SecurityAccess (seed-key challenge, XOR placeholder)
  * - 0x3E TesterPresent (with suppress-positive-response support)
@@ -19,40 +20,63 @@
  * @copyright Taktflow Systems 2026
  */
 #include "Dcm.h"
+#include "Dem.h"
 #include "Det.h"
+#include "Bsw_Instance.h"
 
 #include <string.h>  /* memcpy */
 
-/* ---- Internal State ---- */
+/* SecurityAccess XOR secret (placeholder — real crypto for STM32 later) */
+static const uint8 dcm_security_secret[DCM_SECURITY_SEED_LEN] = {
+    0x5Au, 0xA5u, 0x3Cu, 0xC3u
+};
 
-static const Dcm_ConfigType*  dcm_config = NULL_PTR;
-static boolean                dcm_initialized = FALSE;
+/* Pseudo-random seed start value (simple LCG for SIL — NOT cryptographically secure) */
+#define DCM_PRNG_SEED   0x12345678u
 
-/* Request buffer */
-static uint8          dcm_rx_buf[DCM_TX_BUF_SIZE];
-static PduLengthType  dcm_rx_len;
-static boolean        dcm_request_pending;
+/* ---- Internal State (one set per BSW instance, see Bsw_Instance.h) ---- */
 
-/* Response buffer */
-static uint8   dcm_tx_buf[DCM_TX_BUF_SIZE];
+typedef struct {
+    const Dcm_ConfigType*  dcm_config;
+    boolean                dcm_initialized;
 
-/* Session state */
-static Dcm_SessionType dcm_current_session;
-static uint16          dcm_s3_timer_ms;
+    /* Request buffer */
+    uint8          dcm_rx_buf[DCM_TX_BUF_SIZE];
+    PduLengthType  dcm_rx_len;
+    boolean        dcm_request_pending;
 
-/* SecurityAccess state */
-static boolean dcm_security_unlocked;
-static uint8   dcm_security_seed[DCM_SECURITY_SEED_LEN];
-static boolean dcm_seed_active;
-static uint8   dcm_security_fail_count;
+    /* Response buffer */
+    uint8   dcm_tx_buf[DCM_TX_BUF_SIZE];
 
-/* SecurityAccess XOR secret (placeholder — real crypto for STM32 later) */
-static const uint8 dcm_security_secret[DCM_SECURITY_SEED_LEN] = {
-    0x5Au, 0xA5u, 0x3Cu, 0xC3u
-};
+    /* Session state */
+    Dcm_SessionType dcm_current_session;
+    uint16          dcm_s3_timer_ms;
 
-/* Pseudo-random seed state (simple LCG for SIL — NOT cryptographically secure) */
-static uint32 dcm_prng_state = 0x12345678u;
+    /* SecurityAccess state */
+    boolean dcm_security_unlocked;
+    uint8   dcm_security_seed[DCM_SECURITY_SEED_LEN];
+    boolean dcm_seed_active;
+    uint8   dcm_security_fail_count;
+
+    /* Pseudo-random seed state, DCM_PRNG_SEED from the first Dcm_Init */
+    uint32  dcm_prng_state;
+} Dcm_ContextType;
+
+BSW_INSTANCE_STATE(Dcm_ContextType, dcm_ctx);
+
+#define dcm_config              (BSW_INSTANCE(dcm_ctx).dcm_config)
+#define dcm_initialized         (BSW_INSTANCE(dcm_ctx).dcm_initialized)
+#define dcm_rx_buf              (BSW_INSTANCE(dcm_ctx).dcm_rx_buf)
+#define dcm_rx_len              (BSW_INSTANCE(dcm_ctx).dcm_rx_len)
+#define dcm_request_pending     (BSW_INSTANCE(dcm_ctx).dcm_request_pending)
+#define dcm_tx_buf              (BSW_INSTANCE(dcm_ctx).dcm_tx_buf)
+#define dcm_current_session     (BSW_INSTANCE(dcm_ctx).dcm_current_session)
+#define dcm_s3_timer_ms         (BSW_INSTANCE(dcm_ctx).dcm_s3_timer_ms)
+#define dcm_security_unlocked   (BSW_INSTANCE(dcm_ctx).dcm_security_unlocked)
+#define dcm_security_seed       (BSW_INSTANCE(dcm_ctx).dcm_security_seed)
+#define dcm_seed_active         (BSW_INSTANCE(dcm_ctx).dcm_seed_active)
+#define dcm_security_fail_count (BSW_INSTANCE(dcm_ctx).dcm_security_fail_count)
+#define dcm_prng_state          (BSW_INSTANCE(dcm_ctx).dcm_prng_state)
 
 /* ---- Forward Declarations ---- */
 
@@ -63,6 +87,7 @@ static void dcm_process_request(const uint8* data, PduLengthType length);
 static void dcm_handle_session_control(const uint8* data, PduLengthType length);
 static void dcm_handle_ecu_reset(const uint8* data, PduLengthType length);
 static void dcm_handle_read_did(const uint8* data, PduLengthType length);
+static void dcm_handle_read_dtc_info(const uint8* data, PduLengthType length);
 static void dcm_handle_security_access(const uint8* data, PduLengthType length);
 static void dcm_handle_tester_present(const uint8* data, PduLengthType length);
 
@@ -218,6 +243,99 @@ static void dcm_handle_read_did(const uint8* data, PduLengthType length)
     dcm_send_nrc(DCM_SID_READ_DID, DCM_NRC_REQUEST_OUT_OF_RANGE);
 }
 
+static void dcm_handle_read_dtc_info(const uint8* data, PduLengthType length)
+{
+    uint8 sub_function;
+    uint32 dtc;
+    uint8 status;
+    uint16 count;
+    uint16 record_len;
+    PduLengthType pos;
+    Std_ReturnType ret;
+
+    if (length < 2u) {
+        dcm_send_nrc(DCM_SID_READ_DTC_INFO, DCM_NRC_INCORRECT_MSG_LENGTH);
+        return;
+    }
+
+    sub_function = data[1];
+    dcm_tx_buf[0] = DCM_SID_READ_DTC_INFO + DCM_POSITIVE_RESPONSE_OFFSET;
+    dcm_tx_buf[1] = sub_function;
+
+    switch (sub_function) {
+    case DCM_RDTC_NUM_BY_STATUS_MASK:
+        if (length < 3u) {
+            dcm_send_nrc(DCM_SID_READ_DTC_INFO, DCM_NRC_INCORRECT_MSG_LENGTH);
+            return;
+        }
+        Dem_SetDTCFilter(data[2]);
+        count = Dem_GetNumberOfFilteredDTC();
+        dcm_tx_buf[2] = DEM_STATUS_AVAILABILITY_MASK;
+        dcm_tx_buf[3] = DCM_DTC_FORMAT_ISO14229_1;
+        dcm_tx_buf[4] = (uint8)(count >> 8u);
+        dcm_tx_buf[5] = (uint8)(count & 0xFFu);
+        dcm_send_response(dcm_tx_buf, 6u);
+        break;
+
+    case DCM_RDTC_DTC_BY_STATUS_MASK:
+        if (length < 3u) {
+            dcm_send_nrc(DCM_SID_READ_DTC_INFO, DCM_NRC_INCORRECT_MSG_LENGTH);
+            return;
+        }
+        Dem_SetDTCFilter(data[2]);
+        dcm_tx_buf[2] = DEM_STATUS_AVAILABILITY_MASK;
+        pos = 3u;
+        while (Dem_GetNextFilteredDTC(&dtc, &status) == E_OK) {
+            if ((pos + 4u) > DCM_TX_BUF_SIZE) {
+                dcm_send_nrc(DCM_SID_READ_DTC_INFO, DCM_NRC_RESPONSE_TOO_LONG);
+                return;
+            }
+            dcm_tx_buf[pos]      = (uint8)((dtc >> 16u) & 0xFFu);
+            dcm_tx_buf[pos + 1u] = (uint8)((dtc >> 8u) & 0xFFu);
+            dcm_tx_buf[pos + 2u] = (uint8)(dtc & 0xFFu);
+            dcm_tx_buf[pos + 3u] = status;
+            pos += 4u;
+        }
+        dcm_send_response(dcm_tx_buf, pos);
+        break;
+
+    case DCM_RDTC_SNAPSHOT_BY_DTC:
+    case DCM_RDTC_EXT_DATA_BY_DTC:
+        /* 0x19 sub DTC(3) recordNumber */
+        if (length < 6u) {
+            dcm_send_nrc(DCM_SID_READ_DTC_INFO, DCM_NRC_INCORRECT_MSG_LENGTH);
+            return;
+        }
+        dtc = ((uint32)data[2] << 16u) | ((uint32)data[3] << 8u) | (uint32)data[4];
+        if (Dem_GetStatusOfDTC(dtc, &status) != E_OK) {
+            dcm_send_nrc(DCM_SID_READ_DTC_INFO, DCM_NRC_REQUEST_OUT_OF_RANGE);
+            return;
+        }
+
+        record_len = (uint16)(DCM_TX_BUF_SIZE - 6u);
+        if (sub_function == DCM_RDTC_SNAPSHOT_BY_DTC) {
+            ret = Dem_GetFreezeFrameDataByDTC(dtc, data[5], &dcm_tx_buf[6], &record_len);
+        } else {
+            ret = Dem_GetExtendedDataRecordByDTC(dtc, data[5], &dcm_tx_buf[6], &record_len);
+        }
+        if (ret != E_OK) {
+            dcm_send_nrc(DCM_SID_READ_DTC_INFO, DCM_NRC_REQUEST_OUT_OF_RANGE);
+            return;
+        }
+
+        dcm_tx_buf[2] = data[2];
+        dcm_tx_buf[3] = data[3];
+        dcm_tx_buf[4] = data[4];
+        dcm_tx_buf[5] = status;
+        dcm_send_response(dcm_tx_buf, (PduLengthType)(6u + record_len));
+        break;
+
+    default:
+        dcm_send_nrc(DCM_SID_READ_DTC_INFO, DCM_NRC_SUBFUNCTION_NOT_SUPPORTED);
+        break;
+    }
+}
+
 static void dcm_handle_security_access(const uint8* data, PduLengthType length)
 {
     uint8 sub_function;
@@ -361,6 +479,10 @@ static void dcm_process_request(const uint8* data, PduLengthType length)
         dcm_handle_read_did(data, length);
         break;
 
+    case DCM_SID_READ_DTC_INFO:
+        dcm_handle_read_dtc_info(data, length);
+        break;
+
     case DCM_SID_SECURITY_ACCESS:
         dcm_handle_security_access(data, length);
         break;
@@ -402,6 +524,11 @@ void Dcm_Init(const Dcm_ConfigType* ConfigPtr)
     dcm_security_fail_count = 0u;
     (void)memset(dcm_security_seed, 0, sizeof(dcm_security_seed));
 
+    /* Seed sequence runs on across re-init, as before multi-instance */
+    if (dcm_prng_state == 0u) {
+        dcm_prng_state = DCM_PRNG_SEED;
+    }
+
     dcm_initialized = TRUE;
 }
 
@@ -25,6 +25,7 @@
 /* UDS Service IDs */
 #define DCM_SID_SESSION_CTRL    0x10u
 #define DCM_SID_ECU_RESET       0x11u
+#define DCM_SID_READ_DTC_INFO   0x19u
 #define DCM_SID_READ_DID        0x22u
 #define DCM_SID_SECURITY_ACCESS 0x27u
 #define DCM_SID_TESTER_PRESENT  0x3Eu
@@ -33,6 +34,7 @@
 #define DCM_NRC_SERVICE_NOT_SUPPORTED          0x11u
 #define DCM_NRC_SUBFUNCTION_NOT_SUPPORTED      0x12u
 #define DCM_NRC_INCORRECT_MSG_LENGTH           0x13u
+#define DCM_NRC_RESPONSE_TOO_LONG              0x14u
 #define DCM_NRC_REQUEST_OUT_OF_RANGE           0x31u
 #define DCM_NRC_SECURITY_ACCESS_DENIED         0x33u
 #define DCM_NRC_INVALID_KEY                    0x35u
@@ -84,6 +86,13 @@ typedef struct {
 #define DCM_RESET_HARD          0x01u /**< Hard reset                       */
 #define DCM_RESET_SOFT          0x03u /**< Soft reset                       */
 
+/* ReadDTCInformation sub-functions */
+#define DCM_RDTC_NUM_BY_STATUS_MASK     0x01u /**< reportNumberOfDTCByStatusMask */
+#define DCM_RDTC_DTC_BY_STATUS_MASK     0x02u /**< reportDTCByStatusMask         */
+#define DCM_RDTC_SNAPSHOT_BY_DTC        0x04u /**< reportDTCSnapshotRecordByDTCNumber */
+#define DCM_RDTC_EXT_DATA_BY_DTC        0x06u /**< reportDTCExtDataRecordByDTCNumber  */
+#define DCM_DTC_FORMAT_ISO14229_1       0x01u /**< DTCFormatIdentifier           */
+
 /* ---- External Dependencies ---- */
 
 extern Std_ReturnType PduR_DcmTransmit(PduIdType TxPduId, const PduInfoType* PduInfoPtr);
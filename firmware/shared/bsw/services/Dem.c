@@ -6,29 +6,44 @@
  * @safety_req SWR-BSW-017, SWR-BSW-018
  * @traces_to  TSR-038, TSR-039
  *
+ * @details  Each event is debounced per its Dem_DebounceConfigType entry
+ *           (counter-based, time-based or monitor-internal), resolved once
+ *           at Dem_Init into a per-event pointer: a report costs one table
+ *           lookup. Events without an entry use the default counter class.
+ *
+ *           On confirmation an event gets an entry in the event memory
+ *           (DEM_EVENT_MEMORY_SIZE entries) holding a freeze frame: a
+ *           timestamp and the configured Rte signals, read at that moment.
+ *           When the memory is full the oldest passive entry is displaced;
+ *           active (testFailed) entries are never displaced. Occurrence
+ *           counters and the event memory form the NvM block image, written
+ *           from Dem_MainFunction at most once per NvmWriteIntervalMs.
+ *
  * @standard AUTOSAR_SWS_DiagnosticEventManager, ISO 26262 Part 6
  * @copyright Taktflow Systems 2026
  */
 #include "Dem.h"
 #include "SchM.h"
 #include "Det.h"
+#include "Bsw_Instance.h"
 #include "ComStack_Types.h"
 #include "NvM.h"
 
+#include <string.h>
+
 #ifdef PLATFORM_POSIX
 #include <stdio.h>
-#include <string.h>
 #endif
 
 /* ---- Forward declaration for PduR_Transmit (avoids circular include) ---- */
 extern Std_ReturnType PduR_Transmit(PduIdType TxPduId,
                                      const PduInfoType* PduInfoPtr);
 
-/* ---- NvM block ID for DTC persistence ---- */
-#define DEM_NVM_BLOCK_ID            1u
+/* ---- Forward declaration for Rte_Read (freeze-frame capture) ---- */
+extern Std_ReturnType Rte_Read(uint16 SignalId, uint32* DataPtr);
 
 /* ---- DTC-to-UDS code mapping (configurable per ECU via Dem_SetDtcCode) ---- */
-static uint32 dem_dtc_codes[DEM_MAX_EVENTS] = {
+static const uint32 dem_dtc_codes_default[DEM_MAX_EVENTS] = {
     0xC00100u, /* 0:  Pedal plausibility */
     0xC00200u, /* 1:  Pedal sensor 1 fail */
     0xC00300u, /* 2:  Pedal sensor 2 fail */
@@ -50,62 +65,536 @@ static uint32 dem_dtc_codes[DEM_MAX_EVENTS] = {
     0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u  /* 18-31: reserved */
 };
 
-/* Track which DTCs have been broadcast (avoid re-broadcasting same DTC) */
-static uint8 dem_broadcast_sent[DEM_MAX_EVENTS];
+/* Broadcast queue of newly confirmed events. Producers push under the Dem
+ * exclusive area; Dem_MainFunction is the only consumer and finds an empty
+ * queue (head == tail) without taking the lock. dem_queued[] keeps every
+ * event in the queue at most once, so DEM_MAX_EVENTS slots never overflow. */
+#define DEM_QUEUE_SIZE          DEM_MAX_EVENTS
+#define DEM_QUEUE_MASK          (DEM_QUEUE_SIZE - 1u)
 
-/* ---- Internal State ---- */
+/* Compile-time check: free-running uint8 indices need a power-of-two size */
+typedef char dem_queue_size_check[((DEM_QUEUE_SIZE & DEM_QUEUE_MASK) == 0u) ? 1 : -1];
+
+/* ---- Event status ---- */
 
 typedef struct {
-    sint16  debounceCounter;
+    sint16  debounceCounter;    /* Counter-based class                  */
     uint8   statusByte;
-    uint32  occurrenceCounter;
+    uint8   debounceState;      /* DEM_DEBOUNCE_* bits                  */
+    uint32  debounceStartMs;    /* Time-based: start of the running phase */
 } Dem_EventDataType;
 
-static Dem_EventDataType dem_events[DEM_MAX_EVENTS];
+/* ---- Debounce configuration ---- */
+
+/* Default class: FAILED sets testFailed at once, confirmation after three
+ * reports, testFailed clears when the counter is back at zero */
+static const Dem_DebounceConfigType dem_debounce_default = {
+    0u,                             /* EventId (unused)  */
+    DEM_DEBOUNCE_COUNTER_BASED,     /* DebounceClass     */
+    1u,                             /* IncStep           */
+    1u,                             /* DecStep           */
+    FALSE,                          /* JumpToZero        */
+    DEM_DEBOUNCE_FAIL_THRESHOLD,    /* FailThreshold     */
+    DEM_DEBOUNCE_PASS_THRESHOLD,    /* PassThreshold     */
+    0u,                             /* FailTimeMs        */
+    0u                              /* PassTimeMs        */
+};
+
+/* ---- Event memory / NvM image ---- */
+
+#define DEM_NVM_MAGIC           0x44454D31u     /* "DEM1" — image layout v1 */
+#define DEM_MEMORY_ENTRY_FREE   0xFFu
+
+/** Event memory entry: one confirmed DTC with its freeze frame */
+typedef struct {
+    Dem_EventIdType eventId;        /* DEM_MEMORY_ENTRY_FREE if unused      */
+    uint8           reserved[3];
+    uint32          sequence;       /* Storage order, lowest = oldest       */
+    uint32          timestamp;      /* ms at confirmation                   */
+    uint32          ffData[DEM_MAX_FF_SIGNALS];
+} Dem_MemoryEntryType;
+
+/** NvM block image — everything Dem keeps across power cycles */
+typedef struct {
+    uint32              magic;
+    uint32              occurrenceCounter[DEM_MAX_EVENTS];
+    Dem_MemoryEntryType memory[DEM_EVENT_MEMORY_SIZE];
+} Dem_NvmImageType;
+
+/* Compile-time check: the image is the NvM block (DEM_NVM_BLOCK_SIZE) */
+typedef char dem_nvm_block_size_check[(sizeof(Dem_NvmImageType) == DEM_NVM_BLOCK_SIZE) ? 1 : -1];
+
+/* ---- Internal State (one set per BSW instance, see Bsw_Instance.h) ---- */
+
+typedef struct {
+    /* DTC-to-UDS code mapping, dem_dtc_codes_default until changed */
+    uint32  dem_dtc_codes[DEM_MAX_EVENTS];
+    boolean dem_dtc_codes_loaded;
+
+    /* Track which DTCs have been broadcast (avoid re-broadcasting same DTC) */
+    uint8   dem_broadcast_sent[DEM_MAX_EVENTS];
+
+    /* Broadcast queue (see DEM_QUEUE_SIZE) */
+    Dem_EventIdType dem_queue[DEM_QUEUE_SIZE];
+    volatile uint8  dem_queue_head;     /* Free-running, written by producers */
+    volatile uint8  dem_queue_tail;     /* Free-running, written by consumer  */
+    uint8           dem_queued[DEM_MAX_EVENTS];
+
+    Dem_EventDataType dem_events[DEM_MAX_EVENTS];
+
+    /* Debounce parameters per event, resolved from the config table at init */
+    const Dem_DebounceConfigType* dem_debounce[DEM_MAX_EVENTS];
+
+    Dem_NvmImageType dem_nvm;
+
+    /* Snapshot handed to NvM_WriteBlock. Fee reads it when the write is
+     * serviced, so it must not change while Dem keeps updating dem_nvm. */
+    Dem_NvmImageType dem_nvm_wr;
+
+    const Dem_ConfigType* dem_config;
+    uint8   dem_ff_count;           /* Configured freeze-frame signals   */
+    uint8   dem_time_based_count;   /* Events using the time-based class */
+    uint32  dem_time_ms;            /* Dem_MainFunction tick timestamp   */
+    uint32  dem_memory_seq;         /* Next event memory sequence number */
+    boolean dem_memory_overflow;
+
+    /* NvM write coalescing */
+    boolean dem_nvm_dirty;
+    uint16  dem_nvm_interval_ms;
+    uint16  dem_nvm_elapsed_ms;
+
+    /* DTC filter (Dem_SetDTCFilter / Dem_GetNextFilteredDTC) */
+    uint8   dem_filter_mask;
+    uint8   dem_filter_index;
+
+    /* ECU source ID for DTC broadcast (set via Dem_SetEcuId, default 0x00) */
+    uint8   dem_ecu_id;
+
+    /* CanIf TX PDU ID for DTC broadcast (set via Dem_SetBroadcastPduId) */
+    PduIdType dem_broadcast_pdu_id;
+} Dem_ContextType;
+
+BSW_INSTANCE_STATE(Dem_ContextType, dem_ctx);
+
+#define dem_dtc_codes        (BSW_INSTANCE(dem_ctx).dem_dtc_codes)
+#define dem_dtc_codes_loaded (BSW_INSTANCE(dem_ctx).dem_dtc_codes_loaded)
+#define dem_broadcast_sent   (BSW_INSTANCE(dem_ctx).dem_broadcast_sent)
+#define dem_queue            (BSW_INSTANCE(dem_ctx).dem_queue)
+#define dem_queue_head       (BSW_INSTANCE(dem_ctx).dem_queue_head)
+#define dem_queue_tail       (BSW_INSTANCE(dem_ctx).dem_queue_tail)
+#define dem_queued           (BSW_INSTANCE(dem_ctx).dem_queued)
+#define dem_events           (BSW_INSTANCE(dem_ctx).dem_events)
+#define dem_debounce         (BSW_INSTANCE(dem_ctx).dem_debounce)
+#define dem_nvm              (BSW_INSTANCE(dem_ctx).dem_nvm)
+#define dem_nvm_wr           (BSW_INSTANCE(dem_ctx).dem_nvm_wr)
+#define dem_config           (BSW_INSTANCE(dem_ctx).dem_config)
+#define dem_ff_count         (BSW_INSTANCE(dem_ctx).dem_ff_count)
+#define dem_time_based_count (BSW_INSTANCE(dem_ctx).dem_time_based_count)
+#define dem_time_ms          (BSW_INSTANCE(dem_ctx).dem_time_ms)
+#define dem_memory_seq       (BSW_INSTANCE(dem_ctx).dem_memory_seq)
+#define dem_memory_overflow  (BSW_INSTANCE(dem_ctx).dem_memory_overflow)
+#define dem_nvm_dirty        (BSW_INSTANCE(dem_ctx).dem_nvm_dirty)
+#define dem_nvm_interval_ms  (BSW_INSTANCE(dem_ctx).dem_nvm_interval_ms)
+#define dem_nvm_elapsed_ms   (BSW_INSTANCE(dem_ctx).dem_nvm_elapsed_ms)
+#define dem_filter_mask      (BSW_INSTANCE(dem_ctx).dem_filter_mask)
+#define dem_filter_index     (BSW_INSTANCE(dem_ctx).dem_filter_index)
+#define dem_ecu_id           (BSW_INSTANCE(dem_ctx).dem_ecu_id)
+#define dem_broadcast_pdu_id (BSW_INSTANCE(dem_ctx).dem_broadcast_pdu_id)
+
+/* ---- Private Helpers ---- */
+
+/** Start from the default DTC codes once; Dem_SetDtcCode changes survive re-init */
+static void dem_load_dtc_codes(void)
+{
+    if (dem_dtc_codes_loaded == FALSE) {
+        (void)memcpy(dem_dtc_codes, dem_dtc_codes_default, sizeof(dem_dtc_codes));
+        dem_dtc_codes_loaded = TRUE;
+    }
+}
+
+static uint32 dem_now_ms(void)
+{
+    if ((dem_config != NULL_PTR) && (dem_config->GetTimestampMs != NULL_PTR)) {
+        return dem_config->GetTimestampMs();
+    }
+    return dem_time_ms;
+}
+
+/** Freeze-frame timestamp: may differ from the debounce clock */
+static uint32 dem_ff_time_ms(void)
+{
+    if ((dem_config != NULL_PTR) && (dem_config->GetFreezeFrameTimeMs != NULL_PTR)) {
+        return dem_config->GetFreezeFrameTimeMs();
+    }
+    return dem_now_ms();
+}
+
+static boolean dem_debounce_config_valid(const Dem_DebounceConfigType* Cfg)
+{
+    if (Cfg->EventId >= DEM_MAX_EVENTS) {
+        return FALSE;
+    }
+    if (Cfg->DebounceClass == DEM_DEBOUNCE_COUNTER_BASED) {
+        return ((Cfg->IncStep > 0u) && (Cfg->DecStep > 0u) &&
+                (Cfg->FailThreshold > 0) && (Cfg->PassThreshold <= 0)) ? TRUE : FALSE;
+    }
+    return ((Cfg->DebounceClass == DEM_DEBOUNCE_TIME_BASED) ||
+            (Cfg->DebounceClass == DEM_DEBOUNCE_MONITOR_INTERNAL)) ? TRUE : FALSE;
+}
+
+static void dem_memory_clear(void)
+{
+    uint8 i;
+
+    for (i = 0u; i < DEM_EVENT_MEMORY_SIZE; i++) {
+        dem_nvm.memory[i].eventId = DEM_MEMORY_ENTRY_FREE;
+    }
+    dem_memory_seq      = 0u;
+    dem_memory_overflow = FALSE;
+}
+
+/** Event memory slot of EventId, DEM_EVENT_MEMORY_SIZE if not stored */
+static uint8 dem_memory_find(Dem_EventIdType EventId)
+{
+    uint8 i;
+
+    for (i = 0u; i < DEM_EVENT_MEMORY_SIZE; i++) {
+        if (dem_nvm.memory[i].eventId == EventId) {
+            break;
+        }
+    }
+    return i;
+}
+
+/**
+ * Slot for a new entry: a free one, else the oldest passive entry (event
+ * no longer testFailed). Active entries are never displaced; returns
+ * DEM_EVENT_MEMORY_SIZE if all entries are active.
+ */
+static uint8 dem_memory_select_slot(void)
+{
+    uint8 i;
+    uint8 slot = DEM_EVENT_MEMORY_SIZE;
+    const Dem_MemoryEntryType* entry;
+
+    for (i = 0u; i < DEM_EVENT_MEMORY_SIZE; i++) {
+        entry = &dem_nvm.memory[i];
+        if (entry->eventId == DEM_MEMORY_ENTRY_FREE) {
+            return i;
+        }
+        if (((dem_events[entry->eventId].statusByte & DEM_STATUS_TEST_FAILED) == 0u) &&
+            ((slot == DEM_EVENT_MEMORY_SIZE) ||
+             (entry->sequence < dem_nvm.memory[slot].sequence))) {
+            slot = i;
+        }
+    }
+    return slot;
+}
+
+/** Store EventId with a freeze frame captured now. Caller holds the lock. */
+static void dem_memory_store(Dem_EventIdType EventId)
+{
+    uint8 slot;
+    uint8 i;
+    uint32 value;
+    Dem_MemoryEntryType* entry;
+
+    slot = dem_memory_select_slot();
+    if (slot >= DEM_EVENT_MEMORY_SIZE) {
+        dem_memory_overflow = TRUE;
+        return;
+    }
+
+    entry = &dem_nvm.memory[slot];
+    if (entry->eventId != DEM_MEMORY_ENTRY_FREE) {
+        /* Displaced event is no longer a stored DTC */
+        dem_events[entry->eventId].statusByte &=
+            (uint8)(~(DEM_STATUS_PENDING_DTC | DEM_STATUS_CONFIRMED_DTC));
+        dem_broadcast_sent[entry->eventId] = 0u;
+        dem_memory_overflow = TRUE;
+    }
+
+    entry->eventId  = EventId;
+    entry->sequence = dem_memory_seq;
+    dem_memory_seq++;
+
+    entry->timestamp = dem_ff_time_ms();
+
+    for (i = 0u; i < DEM_MAX_FF_SIGNALS; i++) {
+        value = 0u;
+        if (i < dem_ff_count) {
+            if (Rte_Read(dem_config->FreezeFrameSignals[i].SignalId, &value) != E_OK) {
+                value = 0u;
+            }
+        }
+        entry->ffData[i] = value;
+    }
+}
+
+/** Queue EventId for broadcast unless already queued. Caller holds the lock. */
+static void dem_queue_push(Dem_EventIdType EventId)
+{
+    if (dem_queued[EventId] == 0u) {
+        dem_queued[EventId] = 1u;
+        dem_queue[dem_queue_head & DEM_QUEUE_MASK] = EventId;
+        dem_queue_head++;
+    }
+}
+
+/**
+ * Event qualified failed: confirm, store with freeze frame on the first
+ * confirmation, count the occurrence. Caller holds the lock.
+ */
+static void dem_qualify_failed(Dem_EventIdType EventId)
+{
+    Dem_EventDataType* ev = &dem_events[EventId];
+
+    if ((ev->debounceState & DEM_DEBOUNCE_FINALLY_DEFECTIVE) != 0u) {
+        ev->debounceState = DEM_DEBOUNCE_FINALLY_DEFECTIVE;  /* Healing aborted */
+        return;
+    }
+    ev->debounceState = DEM_DEBOUNCE_FINALLY_DEFECTIVE;
 
-/* ECU source ID for DTC broadcast (set via Dem_SetEcuId, default 0x00) */
-static uint8 dem_ecu_id;
+    if ((ev->statusByte & DEM_STATUS_CONFIRMED_DTC) == 0u) {
+        /* Freeze frame at the moment of confirmation */
+        dem_memory_store(EventId);
+    }
+    ev->statusByte |= DEM_STATUS_CONFIRMED_DTC;
+    dem_nvm.occurrenceCounter[EventId]++;
+    dem_nvm_dirty = TRUE;
+    if (dem_broadcast_sent[EventId] == 0u) {
+        dem_queue_push(EventId);
+    }
+#ifdef PLATFORM_POSIX
+    (void)fprintf(stderr, "[DEM] DTC confirmed: event=%u debounce=%d status=0x%02X dtc=0x%06X\n",
+            EventId, ev->debounceCounter, ev->statusByte, (unsigned)dem_dtc_codes[EventId]);
+#endif
+}
+
+/** Event qualified passed (healed). Caller holds the lock. */
+static void dem_qualify_passed(Dem_EventIdType EventId)
+{
+    dem_events[EventId].debounceState = 0u;
+    dem_events[EventId].statusByte &= (uint8)(~DEM_STATUS_TEST_FAILED);
+}
+
+/** Time-based class: qualify once the running phase lasted long enough */
+static void dem_debounce_time_check(Dem_EventIdType EventId, uint32 NowMs)
+{
+    const Dem_DebounceConfigType* cfg = dem_debounce[EventId];
+    const Dem_EventDataType* ev = &dem_events[EventId];
+    uint32 elapsed = NowMs - ev->debounceStartMs;
 
-/* CanIf TX PDU ID for DTC broadcast (set via Dem_SetBroadcastPduId) */
-static PduIdType dem_broadcast_pdu_id;
+    if ((ev->debounceState & DEM_DEBOUNCE_TEMPORARILY_HEALED) != 0u) {
+        if (elapsed >= (uint32)cfg->PassTimeMs) {
+            dem_qualify_passed(EventId);
+        }
+    } else if ((ev->debounceState & DEM_DEBOUNCE_TEMPORARILY_DEFECTIVE) != 0u) {
+        if (elapsed >= (uint32)cfg->FailTimeMs) {
+            dem_qualify_failed(EventId);
+        }
+    } else {
+        /* Qualified, nothing running */
+    }
+}
+
+static void dem_debounce_counter(Dem_EventIdType EventId,
+                                 Dem_EventStatusType EventStatus)
+{
+    const Dem_DebounceConfigType* cfg = dem_debounce[EventId];
+    Dem_EventDataType* ev = &dem_events[EventId];
+    sint32 counter = (sint32)ev->debounceCounter;
+
+    if (EventStatus == DEM_EVENT_STATUS_FAILED) {
+        if ((cfg->JumpToZero == TRUE) && (counter < 0)) {
+            counter = 0;
+        }
+        counter += (sint32)cfg->IncStep;
+        if (counter >= (sint32)cfg->FailThreshold) {
+            ev->debounceCounter = cfg->FailThreshold;
+            dem_qualify_failed(EventId);
+        } else {
+            ev->debounceCounter = (sint16)counter;
+            ev->debounceState = (uint8)((ev->debounceState & DEM_DEBOUNCE_FINALLY_DEFECTIVE) |
+                                        DEM_DEBOUNCE_TEMPORARILY_DEFECTIVE);
+        }
+    } else {
+        if ((cfg->JumpToZero == TRUE) && (counter > 0)) {
+            counter = 0;
+        }
+        counter -= (sint32)cfg->DecStep;
+
+        /* testFailed clears when the counter is back at zero */
+        if (counter <= 0) {
+            ev->statusByte &= (uint8)(~DEM_STATUS_TEST_FAILED);
+        }
+        if (counter <= (sint32)cfg->PassThreshold) {
+            ev->debounceCounter = cfg->PassThreshold;
+            dem_qualify_passed(EventId);
+        } else {
+            ev->debounceCounter = (sint16)counter;
+            ev->debounceState = (uint8)((ev->debounceState & DEM_DEBOUNCE_FINALLY_DEFECTIVE) |
+                                        DEM_DEBOUNCE_TEMPORARILY_HEALED);
+        }
+    }
+}
+
+static void dem_debounce_time(Dem_EventIdType EventId,
+                              Dem_EventStatusType EventStatus)
+{
+    Dem_EventDataType* ev = &dem_events[EventId];
+    uint32 now = dem_now_ms();
+
+    if (EventStatus == DEM_EVENT_STATUS_FAILED) {
+        if ((ev->debounceState & DEM_DEBOUNCE_FINALLY_DEFECTIVE) != 0u) {
+            ev->debounceState = DEM_DEBOUNCE_FINALLY_DEFECTIVE;  /* Healing aborted */
+        } else if ((ev->debounceState & DEM_DEBOUNCE_TEMPORARILY_DEFECTIVE) == 0u) {
+            ev->debounceState   = DEM_DEBOUNCE_TEMPORARILY_DEFECTIVE;
+            ev->debounceStartMs = now;
+        } else {
+            /* Failure timer already running */
+        }
+    } else {
+        ev->statusByte &= (uint8)(~DEM_STATUS_TEST_FAILED);
+        if ((ev->debounceState & DEM_DEBOUNCE_FINALLY_DEFECTIVE) == 0u) {
+            ev->debounceState = 0u;     /* Not qualified failed: cancel timer */
+        } else if ((ev->debounceState & DEM_DEBOUNCE_TEMPORARILY_HEALED) == 0u) {
+            ev->debounceState   = DEM_DEBOUNCE_FINALLY_DEFECTIVE |
+                                  DEM_DEBOUNCE_TEMPORARILY_HEALED;
+            ev->debounceStartMs = now;
+        } else {
+            /* Healing timer already running */
+        }
+    }
+
+    dem_debounce_time_check(EventId, now);
+}
+
+/** Event ID of a configured DTC code, DEM_MAX_EVENTS if unknown */
+static uint8 dem_find_event(uint32 Dtc)
+{
+    uint8 i;
+
+    if (Dtc == 0u) {
+        return DEM_MAX_EVENTS;
+    }
+    for (i = 0u; i < DEM_MAX_EVENTS; i++) {
+        if (dem_dtc_codes[i] == Dtc) {
+            break;
+        }
+    }
+    return i;
+}
+
+static void dem_put_u32(uint8* Dst, uint32 Value)
+{
+    Dst[0] = (uint8)((Value >> 24u) & 0xFFu);
+    Dst[1] = (uint8)((Value >> 16u) & 0xFFu);
+    Dst[2] = (uint8)((Value >> 8u) & 0xFFu);
+    Dst[3] = (uint8)(Value & 0xFFu);
+}
 
 /* ---- API Implementation ---- */
 
-void Dem_Init(const void* ConfigPtr)
+void Dem_Init(const Dem_ConfigType* ConfigPtr)
 {
     uint8 i;
-    (void)ConfigPtr;
+    Dem_EventIdType ev_id;
+
+    dem_load_dtc_codes();
 
     for (i = 0u; i < DEM_MAX_EVENTS; i++) {
-        dem_events[i].debounceCounter   = 0;
-        dem_events[i].statusByte        = 0u;
-        dem_events[i].occurrenceCounter = 0u;
-        dem_broadcast_sent[i]           = 0u;
+        dem_events[i].debounceCounter = 0;
+        dem_events[i].statusByte      = 0u;
+        dem_events[i].debounceState   = 0u;
+        dem_events[i].debounceStartMs = 0u;
+        dem_broadcast_sent[i]         = 0u;
+        dem_queued[i]                 = 0u;
+        dem_debounce[i]               = &dem_debounce_default;
     }
+    dem_queue_head = 0u;
+    dem_queue_tail = 0u;
     dem_ecu_id = 0u;
     dem_broadcast_pdu_id = 0xFFFFu;  /* Unconfigured sentinel */
 
-    /* Restore occurrence counters from NvM (persistence across power cycles).
-     * POSIX: NVM_BLOCK_SIZE (1024) exceeds sizeof(dem_events) (~224 bytes).
-     * Direct read overflows 800 bytes into adjacent BSS statics, corrupting
+    dem_config   = ConfigPtr;
+    dem_ff_count = 0u;
+    dem_nvm_interval_ms = DEM_NVM_WRITE_INTERVAL_MS;
+    if (ConfigPtr != NULL_PTR) {
+        if (ConfigPtr->FreezeFrameSignals != NULL_PTR) {
+            dem_ff_count = ConfigPtr->FreezeFrameSignalCount;
+        }
+        if (dem_ff_count > DEM_MAX_FF_SIGNALS) {
+            Det_ReportError(DET_MODULE_DEM, 0u, DEM_API_INIT, DET_E_PARAM_VALUE);
+            dem_ff_count = DEM_MAX_FF_SIGNALS;
+        }
+        if (ConfigPtr->NvmWriteIntervalMs != 0u) {
+            dem_nvm_interval_ms = ConfigPtr->NvmWriteIntervalMs;
+        }
+        if (ConfigPtr->DebounceTable != NULL_PTR) {
+            for (i = 0u; i < ConfigPtr->DebounceTableCount; i++) {
+                if (dem_debounce_config_valid(&ConfigPtr->DebounceTable[i]) == FALSE) {
+                    Det_ReportError(DET_MODULE_DEM, 0u, DEM_API_INIT, DET_E_PARAM_VALUE);
+                    continue;   /* Event keeps the default class */
+                }
+                dem_debounce[ConfigPtr->DebounceTable[i].EventId] = &ConfigPtr->DebounceTable[i];
+            }
+        }
+    }
+
+    dem_time_based_count = 0u;
+    for (i = 0u; i < DEM_MAX_EVENTS; i++) {
+        if (dem_debounce[i]->DebounceClass == DEM_DEBOUNCE_TIME_BASED) {
+            dem_time_based_count++;
+        }
+    }
+
+    dem_time_ms        = 0u;
+    dem_nvm_dirty      = FALSE;
+    dem_nvm_elapsed_ms = dem_nvm_interval_ms;  /* First write goes out at once */
+    dem_filter_mask    = 0u;
+    dem_filter_index   = DEM_MAX_EVENTS;
+
+    /* Restore occurrence counters and event memory from NvM (persistence
+     * across power cycles).
+     * POSIX: NVM_BLOCK_SIZE (1024) exceeds sizeof(dem_nvm).
+     * Direct read overflows into adjacent BSS statics, corrupting
      * Com shadow buffers and RTE signals across compilation units.
      * Fix: read into a properly-sized temp buffer, copy only valid data.
-     * Target: NvM_ReadBlock is a no-op stub — direct read is safe. */
+     * Target: Fee reads exactly the configured DEM_NVM_BLOCK_SIZE bytes. */
+    (void)memset(&dem_nvm, 0, sizeof(dem_nvm));
 #ifdef PLATFORM_POSIX
     {
         uint8 nvm_tmp[NVM_BLOCK_SIZE];
         (void)memset(nvm_tmp, 0u, sizeof(nvm_tmp));
         (void)NvM_ReadBlock(DEM_NVM_BLOCK_ID, (void*)nvm_tmp);
-        (void)memcpy(dem_events, nvm_tmp, sizeof(dem_events));
+        (void)memcpy(&dem_nvm, nvm_tmp, sizeof(dem_nvm));
     }
 #else
-    (void)NvM_ReadBlock(DEM_NVM_BLOCK_ID, (void*)dem_events);
+    (void)NvM_ReadBlock(DEM_NVM_BLOCK_ID, (void*)&dem_nvm);
 #endif
 
-    for (i = 0u; i < DEM_MAX_EVENTS; i++) {
-        dem_events[i].debounceCounter = 0;
-        dem_events[i].statusByte      = 0u;
-        /* occurrenceCounter preserved from NvM */
+    if (dem_nvm.magic != DEM_NVM_MAGIC) {
+        /* Never written, or an older layout: start empty */
+        (void)memset(&dem_nvm, 0, sizeof(dem_nvm));
+        dem_nvm.magic = DEM_NVM_MAGIC;
+        dem_memory_clear();
+    } else {
+        dem_memory_seq      = 0u;
+        dem_memory_overflow = FALSE;
+        for (i = 0u; i < DEM_EVENT_MEMORY_SIZE; i++) {
+            ev_id = dem_nvm.memory[i].eventId;
+            if (ev_id >= DEM_MAX_EVENTS) {
+                dem_nvm.memory[i].eventId = DEM_MEMORY_ENTRY_FREE;
+                continue;
+            }
+            /* Stored DTCs stay confirmed; already broadcast before reset */
+            dem_events[ev_id].statusByte = DEM_STATUS_CONFIRMED_DTC;
+            dem_broadcast_sent[ev_id]    = 1u;
+            if (dem_nvm.memory[i].sequence >= dem_memory_seq) {
+                dem_memory_seq = dem_nvm.memory[i].sequence + 1u;
+            }
+        }
     }
 }
 
@@ -119,42 +608,26 @@ void Dem_ReportErrorStatus(Dem_EventIdType EventId,
 
     SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0();
 
-    Dem_EventDataType* ev = &dem_events[EventId];
-
     if (EventStatus == DEM_EVENT_STATUS_FAILED) {
-        /* Increment debounce counter toward fail threshold */
-        if (ev->debounceCounter < DEM_DEBOUNCE_FAIL_THRESHOLD) {
-            ev->debounceCounter++;
-        }
-
         /* Set testFailed and pendingDTC on first failure (AUTOSAR DEM) */
-        ev->statusByte |= DEM_STATUS_TEST_FAILED;
-        ev->statusByte |= DEM_STATUS_PENDING_DTC;
-
-        /* Confirm DTC when threshold reached */
-        if (ev->debounceCounter >= DEM_DEBOUNCE_FAIL_THRESHOLD) {
-            ev->statusByte |= DEM_STATUS_CONFIRMED_DTC;
-            ev->occurrenceCounter++;
-#ifdef PLATFORM_POSIX
-            (void)fprintf(stderr, "[DEM] DTC confirmed: event=%u debounce=%d status=0x%02X dtc=0x%06X\n",
-                    EventId, ev->debounceCounter, ev->statusByte, (unsigned)dem_dtc_codes[EventId]);
-#endif
-        }
-    } else {
-        /* Decrement debounce counter toward pass threshold */
-        if (ev->debounceCounter > DEM_DEBOUNCE_PASS_THRESHOLD) {
-            ev->debounceCounter--;
-        }
-
-        /* Clear testFailed when counter reaches zero (healed) */
-        if (ev->debounceCounter <= 0) {
-            ev->statusByte &= (uint8)(~DEM_STATUS_TEST_FAILED);
-        }
+        dem_events[EventId].statusByte |= DEM_STATUS_TEST_FAILED;
+        dem_events[EventId].statusByte |= DEM_STATUS_PENDING_DTC;
+    }
 
-        /* Clamp at pass threshold */
-        if (ev->debounceCounter <= DEM_DEBOUNCE_PASS_THRESHOLD) {
-            ev->debounceCounter = DEM_DEBOUNCE_PASS_THRESHOLD;
+    switch (dem_debounce[EventId]->DebounceClass) {
+    case DEM_DEBOUNCE_TIME_BASED:
+        dem_debounce_time(EventId, EventStatus);
+        break;
+    case DEM_DEBOUNCE_MONITOR_INTERNAL:
+        if (EventStatus == DEM_EVENT_STATUS_FAILED) {
+            dem_qualify_failed(EventId);
+        } else {
+            dem_qualify_passed(EventId);
         }
+        break;
+    default:
+        dem_debounce_counter(EventId, EventStatus);
+        break;
     }
 
     SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
@@ -179,6 +652,26 @@ Std_ReturnType Dem_GetEventStatus(Dem_EventIdType EventId, uint8* StatusPtr)
     return E_OK;
 }
 
+Std_ReturnType Dem_GetDebouncingOfEvent(Dem_EventIdType EventId,
+                                        Dem_DebouncingStateType* DebouncingStatePtr)
+{
+    if (EventId >= DEM_MAX_EVENTS) {
+        Det_ReportError(DET_MODULE_DEM, 0u, DEM_API_GET_DEBOUNCING, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    if (DebouncingStatePtr == NULL_PTR) {
+        Det_ReportError(DET_MODULE_DEM, 0u, DEM_API_GET_DEBOUNCING, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0();
+    *DebouncingStatePtr = dem_events[EventId].debounceState;
+    SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
+
+    return E_OK;
+}
+
 Std_ReturnType Dem_GetOccurrenceCounter(Dem_EventIdType EventId, uint32* CountPtr)
 {
     if (EventId >= DEM_MAX_EVENTS) {
@@ -192,7 +685,7 @@ Std_ReturnType Dem_GetOccurrenceCounter(Dem_EventIdType EventId, uint32* CountPt
     }
 
     SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0();
-    *CountPtr = dem_events[EventId].occurrenceCounter;
+    *CountPtr = dem_nvm.occurrenceCounter[EventId];
     SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
 
     return E_OK;
@@ -204,11 +697,14 @@ Std_ReturnType Dem_ClearAllDTCs(void)
 
     SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0();
     for (i = 0u; i < DEM_MAX_EVENTS; i++) {
-        dem_events[i].debounceCounter   = 0;
-        dem_events[i].statusByte        = 0u;
-        dem_events[i].occurrenceCounter = 0u;
-        dem_broadcast_sent[i]           = 0u;
+        dem_events[i].debounceCounter = 0;
+        dem_events[i].statusByte      = 0u;
+        dem_events[i].debounceState   = 0u;
+        dem_nvm.occurrenceCounter[i]  = 0u;
+        dem_broadcast_sent[i]         = 0u;
     }
+    dem_memory_clear();
+    dem_nvm_dirty = TRUE;
     SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
 
     return E_OK;
@@ -230,6 +726,7 @@ void Dem_SetDtcCode(Dem_EventIdType EventId, uint32 DtcCode)
         return;
     }
 
+    dem_load_dtc_codes();
     dem_dtc_codes[EventId] = DtcCode;
 }
 
@@ -248,6 +745,15 @@ void Dem_SetBroadcastPduId(PduIdType TxPduId)
  *   Byte 5:   Occurrence counter (low byte)
  *   Byte 6-7: Reserved (0x00)
  *
+ * Time-based events are qualified first, so a fault that persisted
+ * without further reports is confirmed and broadcast in the same cycle.
+ * Only events in the broadcast queue are visited: an idle cycle enters
+ * no critical section for the broadcast, and a burst (e.g. the fault
+ * storm of an E-stop) goes out within one cycle. A frame the CAN stack
+ * refuses stays queued and is retried next cycle.
+ * Afterwards the NvM block is written if it changed, at most once per
+ * NvmWriteIntervalMs: a burst of confirmations costs one flash record.
+ *
  * @safety_req SWR-BSW-017, SWR-BSW-018
  * ================================================================== */
 
@@ -256,68 +762,270 @@ void Dem_MainFunction(void)
     uint8 i;
     uint8 pdu_data[8];
     PduInfoType pdu_info;
+    Dem_EventIdType ev_id;
     uint32 dtc_code;
+    uint32 now;
+    boolean send;
+    boolean nvm_write = FALSE;
 
     pdu_info.SduDataPtr = pdu_data;
     pdu_info.SduLength  = 8u;
 
-    for (i = 0u; i < DEM_MAX_EVENTS; i++) {
+    dem_time_ms += DEM_MAIN_CYCLE_MS;
+
+    if (dem_time_based_count > 0u) {
         SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0();
+        now = dem_now_ms();
+        for (i = 0u; i < DEM_MAX_EVENTS; i++) {
+            if (dem_debounce[i]->DebounceClass == DEM_DEBOUNCE_TIME_BASED) {
+                dem_debounce_time_check(i, now);
+            }
+        }
+        SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
+    }
 
-        /* Only broadcast newly confirmed DTCs that haven't been sent yet */
-        if (((dem_events[i].statusByte & DEM_STATUS_CONFIRMED_DTC) != 0u) &&
-            (dem_broadcast_sent[i] == 0u))
-        {
-            dtc_code = dem_dtc_codes[i];
+    while (dem_queue_tail != dem_queue_head) {
+        send = FALSE;
 
-            if (dtc_code == 0u) {
-                SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
-                continue;  /* Skip unmapped event IDs */
-            }
+        SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0();
+        ev_id    = dem_queue[dem_queue_tail & DEM_QUEUE_MASK];
+        dtc_code = dem_dtc_codes[ev_id];
 
+        /* Still confirmed (not cleared or displaced meanwhile), not yet
+         * sent, and mapped to a DTC number */
+        if (((dem_events[ev_id].statusByte & DEM_STATUS_CONFIRMED_DTC) != 0u) &&
+            (dem_broadcast_sent[ev_id] == 0u) && (dtc_code != 0u))
+        {
             /* Pack DTC_Broadcast frame */
             pdu_data[0] = (uint8)((dtc_code >> 16u) & 0xFFu);  /* DTC high */
             pdu_data[1] = (uint8)((dtc_code >> 8u) & 0xFFu);   /* DTC mid */
             pdu_data[2] = (uint8)(dtc_code & 0xFFu);            /* DTC low */
-            pdu_data[3] = dem_events[i].statusByte;              /* Status */
+            pdu_data[3] = dem_events[ev_id].statusByte;          /* Status */
             pdu_data[4] = dem_ecu_id;                               /* ECU source */
-            pdu_data[5] = (uint8)(dem_events[i].occurrenceCounter & 0xFFu);
+            pdu_data[5] = (uint8)(dem_nvm.occurrenceCounter[ev_id] & 0xFFu);
             pdu_data[6] = 0x00u;
             pdu_data[7] = 0x00u;
 
             /* Mark as broadcast — don't re-send until cleared */
-            dem_broadcast_sent[i] = 1u;
+            dem_broadcast_sent[ev_id] = 1u;
+            send = TRUE;
+        }
 
-            SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
+        dem_queued[ev_id] = 0u;
+        dem_queue_tail++;
+        SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
 
-            /* Transmit via PduR -> CanIf -> CAN 0x500 (outside critical section).
-             * Guard: skip if broadcast PDU ID not configured (zone controller
-             * called Dem_Init but not Dem_SetBroadcastPduId yet). */
-            if (dem_broadcast_pdu_id != 0xFFFFu)
-            {
+        /* Transmit via PduR -> CanIf -> CAN 0x500 (outside critical section).
+         * Guard: skip if broadcast PDU ID not configured (zone controller
+         * called Dem_Init but not Dem_SetBroadcastPduId yet). */
+        if ((send == TRUE) && (dem_broadcast_pdu_id != 0xFFFFu))
+        {
 #ifdef PLATFORM_POSIX
-                (void)fprintf(stderr, "[DEM] Broadcasting DTC=0x%06X pdu=%u ecu=%u\n",
-                        (unsigned)dtc_code, (unsigned)dem_broadcast_pdu_id, (unsigned)dem_ecu_id);
+            (void)fprintf(stderr, "[DEM] Broadcasting DTC=0x%06X pdu=%u ecu=%u\n",
+                    (unsigned)dtc_code, (unsigned)dem_broadcast_pdu_id, (unsigned)dem_ecu_id);
 #endif
-                (void)PduR_Transmit(dem_broadcast_pdu_id, &pdu_info);
+            if (PduR_Transmit(dem_broadcast_pdu_id, &pdu_info) != E_OK) {
+                /* TX path full: requeue, retry the rest next cycle */
+                SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0();
+                if (dem_broadcast_sent[ev_id] == 1u) {
+                    dem_broadcast_sent[ev_id] = 0u;
+                    dem_queue_push(ev_id);
+                }
+                SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
+                break;
             }
+        }
+    }
 
-            /* Persist to NvM (outside critical section).
-             * POSIX: use temp buffer to avoid writing 800 bytes of adjacent
-             * BSS into the NvM file (NVM_BLOCK_SIZE > sizeof(dem_events)). */
+    /* Coalesced NvM write (copy taken under the lock, written outside) */
+    if (dem_nvm_elapsed_ms < dem_nvm_interval_ms) {
+        dem_nvm_elapsed_ms += (uint16)DEM_MAIN_CYCLE_MS;
+    }
+    if ((dem_nvm_dirty == TRUE) && (dem_nvm_elapsed_ms >= dem_nvm_interval_ms)) {
+        SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0();
+        dem_nvm_wr         = dem_nvm;
+        dem_nvm_dirty      = FALSE;
+        dem_nvm_elapsed_ms = 0u;
+        nvm_write          = TRUE;
+        SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
+    }
+
+    if (nvm_write == TRUE) {
+        /* POSIX: use temp buffer to avoid writing adjacent BSS into the
+         * NvM image (NVM_BLOCK_SIZE > sizeof(dem_nvm_wr)). */
 #ifdef PLATFORM_POSIX
-            {
-                uint8 nvm_wr[NVM_BLOCK_SIZE];
-                (void)memset(nvm_wr, 0u, sizeof(nvm_wr));
-                (void)memcpy(nvm_wr, dem_events, sizeof(dem_events));
-                (void)NvM_WriteBlock(DEM_NVM_BLOCK_ID, (const void*)nvm_wr);
-            }
+        uint8 nvm_tmp[NVM_BLOCK_SIZE];
+        (void)memset(nvm_tmp, 0u, sizeof(nvm_tmp));
+        (void)memcpy(nvm_tmp, &dem_nvm_wr, sizeof(dem_nvm_wr));
+        (void)NvM_WriteBlock(DEM_NVM_BLOCK_ID, (const void*)nvm_tmp);
 #else
-            (void)NvM_WriteBlock(DEM_NVM_BLOCK_ID,
-                                  (const void*)dem_events);
+        (void)NvM_WriteBlock(DEM_NVM_BLOCK_ID, (const void*)&dem_nvm_wr);
 #endif
-        } else {
-            SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
+    }
+}
+
+/* ==================================================================
+ * API: Event memory access for Dcm ReadDTCInformation (0x19)
+ * ================================================================== */
+
+void Dem_SetDTCFilter(uint8 StatusMask)
+{
+    dem_filter_mask  = StatusMask & DEM_STATUS_AVAILABILITY_MASK;
+    dem_filter_index = 0u;
+}
+
+uint16 Dem_GetNumberOfFilteredDTC(void)
+{
+    uint8 i;
+    uint16 count = 0u;
+
+    SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0();
+    for (i = 0u; i < DEM_MAX_EVENTS; i++) {
+        if ((dem_dtc_codes[i] != 0u) &&
+            ((dem_events[i].statusByte & dem_filter_mask) != 0u)) {
+            count++;
+        }
+    }
+    SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
+
+    return count;
+}
+
+Std_ReturnType Dem_GetNextFilteredDTC(uint32* DtcPtr, uint8* StatusPtr)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 status;
+
+    if ((DtcPtr == NULL_PTR) || (StatusPtr == NULL_PTR)) {
+        Det_ReportError(DET_MODULE_DEM, 0u, DEM_API_GET_DTC_DATA, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0();
+    while (dem_filter_index < DEM_MAX_EVENTS) {
+        status = dem_events[dem_filter_index].statusByte;
+        if ((dem_dtc_codes[dem_filter_index] != 0u) &&
+            ((status & dem_filter_mask) != 0u)) {
+            *DtcPtr    = dem_dtc_codes[dem_filter_index];
+            *StatusPtr = status & DEM_STATUS_AVAILABILITY_MASK;
+            ret = E_OK;
+        }
+        dem_filter_index++;
+        if (ret == E_OK) {
+            break;
         }
     }
+    SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
+
+    return ret;
+}
+
+Std_ReturnType Dem_GetStatusOfDTC(uint32 Dtc, uint8* StatusPtr)
+{
+    uint8 ev_id;
+
+    if (StatusPtr == NULL_PTR) {
+        Det_ReportError(DET_MODULE_DEM, 0u, DEM_API_GET_DTC_DATA, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    ev_id = dem_find_event(Dtc);
+    if (ev_id >= DEM_MAX_EVENTS) {
+        return E_NOT_OK;
+    }
+
+    SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0();
+    *StatusPtr = dem_events[ev_id].statusByte & DEM_STATUS_AVAILABILITY_MASK;
+    SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
+
+    return E_OK;
+}
+
+Std_ReturnType Dem_GetFreezeFrameDataByDTC(uint32 Dtc, uint8 RecordNumber,
+                                           uint8* DestBuffer, uint16* BufSize)
+{
+    uint8 ev_id;
+    uint8 slot;
+    uint8 i;
+    uint16 need;
+    uint16 pos;
+    const Dem_MemoryEntryType* entry;
+
+    if ((DestBuffer == NULL_PTR) || (BufSize == NULL_PTR)) {
+        Det_ReportError(DET_MODULE_DEM, 0u, DEM_API_GET_DTC_DATA, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    ev_id = dem_find_event(Dtc);
+    if ((ev_id >= DEM_MAX_EVENTS) ||
+        ((RecordNumber != DEM_FF_RECORD_NUMBER) && (RecordNumber != DEM_RECORD_ALL))) {
+        return E_NOT_OK;
+    }
+
+    /* recordNumber, count, then DID + 4-byte value per identifier */
+    need = (uint16)(2u + (6u * (1u + (uint16)dem_ff_count)));
+
+    SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0();
+    slot = dem_memory_find(ev_id);
+    if (slot >= DEM_EVENT_MEMORY_SIZE) {
+        SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
+        *BufSize = 0u;
+        return E_OK;
+    }
+    if (*BufSize < need) {
+        SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
+        return E_NOT_OK;
+    }
+
+    entry = &dem_nvm.memory[slot];
+    DestBuffer[0] = DEM_FF_RECORD_NUMBER;
+    DestBuffer[1] = (uint8)(1u + dem_ff_count);
+    DestBuffer[2] = (uint8)(DEM_FF_DID_TIMESTAMP >> 8u);
+    DestBuffer[3] = (uint8)(DEM_FF_DID_TIMESTAMP & 0xFFu);
+    dem_put_u32(&DestBuffer[4], entry->timestamp);
+    pos = 8u;
+    for (i = 0u; i < dem_ff_count; i++) {
+        DestBuffer[pos]      = (uint8)(dem_config->FreezeFrameSignals[i].Did >> 8u);
+        DestBuffer[pos + 1u] = (uint8)(dem_config->FreezeFrameSignals[i].Did & 0xFFu);
+        dem_put_u32(&DestBuffer[pos + 2u], entry->ffData[i]);
+        pos += 6u;
+    }
+    SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
+
+    *BufSize = pos;
+    return E_OK;
+}
+
+Std_ReturnType Dem_GetExtendedDataRecordByDTC(uint32 Dtc, uint8 RecordNumber,
+                                              uint8* DestBuffer, uint16* BufSize)
+{
+    uint8 ev_id;
+    uint32 occurrence;
+
+    if ((DestBuffer == NULL_PTR) || (BufSize == NULL_PTR)) {
+        Det_ReportError(DET_MODULE_DEM, 0u, DEM_API_GET_DTC_DATA, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    ev_id = dem_find_event(Dtc);
+    if ((ev_id >= DEM_MAX_EVENTS) ||
+        ((RecordNumber != DEM_EXT_RECORD_OCCURRENCE) && (RecordNumber != DEM_RECORD_ALL)) ||
+        (*BufSize < 2u)) {
+        return E_NOT_OK;
+    }
+
+    SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0();
+    occurrence = dem_nvm.occurrenceCounter[ev_id];
+    SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
+
+    DestBuffer[0] = DEM_EXT_RECORD_OCCURRENCE;
+    DestBuffer[1] = (occurrence > 0xFFu) ? 0xFFu : (uint8)occurrence;
+    *BufSize = 2u;
+
+    return E_OK;
+}
+
+boolean Dem_GetEventMemoryOverflow(void)
+{
+    return dem_memory_overflow;
 }
@@ -18,13 +18,45 @@
 /* ---- Constants ---- */
 
 #define DEM_MAX_EVENTS          32u
+
+/* Default debounce class (events without a Dem_DebounceConfigType entry):
+ * counter-based, step 1, confirmed at +3, counter floor -3 */
 #define DEM_DEBOUNCE_FAIL_THRESHOLD   3
 #define DEM_DEBOUNCE_PASS_THRESHOLD   (-3)
 
+/* Debouncing state (Dem_GetDebouncingOfEvent) */
+#define DEM_DEBOUNCE_TEMPORARILY_DEFECTIVE  0x01u /**< Failing, not qualified yet  */
+#define DEM_DEBOUNCE_FINALLY_DEFECTIVE      0x02u /**< Qualified failed            */
+#define DEM_DEBOUNCE_TEMPORARILY_HEALED     0x04u /**< Passing, not qualified yet  */
+
+#define DEM_MAIN_CYCLE_MS       100u  /**< Dem_MainFunction call period    */
+
+/* Event memory: confirmed DTCs with their freeze frame */
+#define DEM_EVENT_MEMORY_SIZE   8u    /**< Stored DTC entries               */
+#define DEM_MAX_FF_SIGNALS      6u    /**< Rte signals per freeze frame     */
+#define DEM_FF_RECORD_NUMBER    0x01u /**< Only snapshot record (first occurrence) */
+#define DEM_FF_DID_TIMESTAMP    0xF0FFu /**< DID of the capture timestamp (ms) */
+#define DEM_EXT_RECORD_OCCURRENCE 0x01u /**< Extended data: occurrence counter */
+#define DEM_RECORD_ALL          0xFFu /**< UDS "all records" record number  */
+
+/* NvM write coalescing: at most one Dem block write per interval */
+#define DEM_NVM_WRITE_INTERVAL_MS   1000u
+
+/* NvM block for DTC persistence. Blocks 0/1 belong to FZC NvM (DTC slots,
+ * calibration). Block length must match the Fee config on target.
+ * Image: magic, occurrence counters, event memory. */
+#define DEM_NVM_BLOCK_ID        2u
+#define DEM_MEMORY_ENTRY_SIZE   (12u + (DEM_MAX_FF_SIGNALS * 4u))
+#define DEM_NVM_BLOCK_SIZE      (4u + (DEM_MAX_EVENTS * 4u) + \
+                                 (DEM_EVENT_MEMORY_SIZE * DEM_MEMORY_ENTRY_SIZE))
+
 /* DTC Status Bits (ISO 14229) */
 #define DEM_STATUS_TEST_FAILED          0x01u
 #define DEM_STATUS_PENDING_DTC          0x04u
 #define DEM_STATUS_CONFIRMED_DTC        0x08u
+#define DEM_STATUS_AVAILABILITY_MASK    (DEM_STATUS_TEST_FAILED | \
+                                         DEM_STATUS_PENDING_DTC | \
+                                         DEM_STATUS_CONFIRMED_DTC)
 
 /* ---- Types ---- */
 
@@ -35,20 +67,106 @@ typedef enum {
     DEM_EVENT_STATUS_FAILED = 1u
 } Dem_EventStatusType;
 
+/** Timestamp source for freeze frames and time-based debouncing (ms) */
+typedef uint32 (*Dem_TimestampFuncType)(void);
+
+typedef uint8  Dem_DebouncingStateType;
+
+typedef enum {
+    DEM_DEBOUNCE_COUNTER_BASED   = 0u, /**< Counter stepped per report        */
+    DEM_DEBOUNCE_TIME_BASED      = 1u, /**< Status must persist for a time    */
+    DEM_DEBOUNCE_MONITOR_INTERNAL = 2u /**< Monitor reports qualified results */
+} Dem_DebounceClassType;
+
+/**
+ * Debounce parameters of one event.
+ *
+ * Counter-based: FAILED adds IncStep, PASSED subtracts DecStep; the
+ * counter is clamped to [PassThreshold, FailThreshold]. The event
+ * qualifies failed at FailThreshold and healed at PassThreshold. With
+ * JumpToZero the counter restarts from 0 whenever the reported status
+ * changes direction ("n consecutive reports").
+ * Time-based: the event qualifies failed once FAILED has been reported
+ * without a PASSED in between for FailTimeMs, healed likewise after
+ * PassTimeMs. Qualification is also checked in Dem_MainFunction, so
+ * the monitor need not keep reporting.
+ * Monitor-internal: every report is final.
+ */
+typedef struct {
+    Dem_EventIdType         EventId;
+    Dem_DebounceClassType   DebounceClass;
+    uint8                   IncStep;        /**< Counter: > 0              */
+    uint8                   DecStep;        /**< Counter: > 0              */
+    boolean                 JumpToZero;     /**< Counter                   */
+    sint16                  FailThreshold;  /**< Counter: > 0              */
+    sint16                  PassThreshold;  /**< Counter: <= 0             */
+    uint16                  FailTimeMs;     /**< Time                      */
+    uint16                  PassTimeMs;     /**< Time                      */
+} Dem_DebounceConfigType;
+
+/** One freeze-frame signal: Rte signal captured at confirmation */
+typedef struct {
+    uint16  SignalId;       /**< Rte signal ID                            */
+    uint16  Did;            /**< DID reported in ReadDTCInformation 0x04  */
+} Dem_FreezeFrameSignalType;
+
+/** Dem module configuration */
+typedef struct {
+    const Dem_FreezeFrameSignalType* FreezeFrameSignals; /**< May be NULL */
+    uint8                   FreezeFrameSignalCount;  /**< <= DEM_MAX_FF_SIGNALS */
+    Dem_TimestampFuncType   GetTimestampMs;     /**< NULL: Dem_MainFunction tick */
+    uint16                  NvmWriteIntervalMs; /**< 0: DEM_NVM_WRITE_INTERVAL_MS */
+    const Dem_DebounceConfigType* DebounceTable; /**< May be NULL            */
+    uint8                   DebounceTableCount;
+    Dem_TimestampFuncType   GetFreezeFrameTimeMs; /**< Freeze-frame timestamp,
+                                                       e.g. StbM_GetTimeMs (time
+                                                       shared by all ECUs);
+                                                       NULL: GetTimestampMs  */
+} Dem_ConfigType;
+
 /* ---- API Functions ---- */
 
-void           Dem_Init(const void* ConfigPtr);
+/**
+ * @brief  Initialize Dem, restore occurrence counters and event memory
+ * @param  ConfigPtr  Freeze-frame, debounce and NvM configuration, NULL
+ *                    for defaults (no freeze-frame signals, Dem tick
+ *                    timestamp, default debounce class for all events)
+ */
+void           Dem_Init(const Dem_ConfigType* ConfigPtr);
+
+/**
+ * @brief  Report a monitor result, debounced per the event's class
+ *
+ * Every FAILED report sets testFailed and pendingDTC; qualification as
+ * failed confirms the DTC, stores it in the event memory and counts an
+ * occurrence.
+ */
 void           Dem_ReportErrorStatus(Dem_EventIdType EventId,
                                      Dem_EventStatusType EventStatus);
 Std_ReturnType Dem_GetEventStatus(Dem_EventIdType EventId, uint8* StatusPtr);
+
+/**
+ * @brief  Debouncing state of an event (DEM_DEBOUNCE_* bits)
+ *
+ * Lets a SWC react to the qualified result instead of debouncing itself.
+ * Unlike confirmedDTC, which is restored from NvM, the state starts from
+ * zero at every Dem_Init.
+ *
+ * @return E_OK on success, E_NOT_OK for an invalid EventId or NULL pointer
+ */
+Std_ReturnType Dem_GetDebouncingOfEvent(Dem_EventIdType EventId,
+                                        Dem_DebouncingStateType* DebouncingStatePtr);
 Std_ReturnType Dem_GetOccurrenceCounter(Dem_EventIdType EventId, uint32* CountPtr);
 Std_ReturnType Dem_ClearAllDTCs(void);
 
 /**
  * @brief  Periodic DTC broadcast function
  *
- * Scans for newly confirmed DTCs and broadcasts them via Com on CAN 0x500.
- * Call from the 100ms periodic task. Reusable across all ECUs.
+ * Broadcasts the DTCs confirmed since the last call via Com on CAN 0x500
+ * (taken from a queue filled at confirmation; a frame refused by the CAN
+ * stack is retried next call), then writes the Dem NvM block if it
+ * changed and the last write is at least NvmWriteIntervalMs ago. Call
+ * from the 100ms periodic task. Reusable across all ECUs.
  */
 void           Dem_MainFunction(void);
 
@@ -75,4 +193,63 @@ void           Dem_SetBroadcastPduId(PduIdType TxPduId);
  */
 void           Dem_SetDtcCode(Dem_EventIdType EventId, uint32 DtcCode);
 
+/* ---- Event memory access (Dcm ReadDTCInformation) ---- */
+
+/**
+ * @brief  Select DTCs for Dem_GetNextFilteredDTC
+ * @param  StatusMask  DTCs match if (status & StatusMask) != 0
+ */
+void           Dem_SetDTCFilter(uint8 StatusMask);
+
+/**
+ * @brief  Number of DTCs matching the current filter
+ */
+uint16         Dem_GetNumberOfFilteredDTC(void);
+
+/**
+ * @brief  Next DTC matching the current filter
+ * @return E_OK if DtcPtr/StatusPtr were filled, E_NOT_OK when no DTC is left
+ */
+Std_ReturnType Dem_GetNextFilteredDTC(uint32* DtcPtr, uint8* StatusPtr);
+
+/**
+ * @brief  Status byte of a DTC
+ * @return E_OK if the DTC is configured, E_NOT_OK otherwise
+ */
+Std_ReturnType Dem_GetStatusOfDTC(uint32 Dtc, uint8* StatusPtr);
+
+/**
+ * @brief  Snapshot record of a DTC in UDS format
+ *
+ * Writes recordNumber, number of identifiers, then DID (2 bytes) and value
+ * (4 bytes, big endian) for the timestamp and every configured signal.
+ *
+ * @param  Dtc           UDS DTC code
+ * @param  RecordNumber  DEM_FF_RECORD_NUMBER or DEM_RECORD_ALL
+ * @param  DestBuffer    Output
+ * @param  BufSize       In: buffer size, out: bytes written (0 if the DTC
+ *                       has no entry in the event memory)
+ * @return E_NOT_OK for an unknown DTC or record number, or a short buffer
+ */
+Std_ReturnType Dem_GetFreezeFrameDataByDTC(uint32 Dtc, uint8 RecordNumber,
+                                           uint8* DestBuffer, uint16* BufSize);
+
+/**
+ * @brief  Extended data record of a DTC in UDS format
+ *
+ * Record DEM_EXT_RECORD_OCCURRENCE: recordNumber, occurrence counter
+ * (1 byte, saturated at 0xFF).
+ *
+ * @param  BufSize  In: buffer size, out: bytes written
+ * @return E_NOT_OK for an unknown DTC or record number, or a short buffer
+ */
+Std_ReturnType Dem_GetExtendedDataRecordByDTC(uint32 Dtc, uint8 RecordNumber,
+                                              uint8* DestBuffer, uint16* BufSize);
+
+/**
+ * @brief  TRUE if a confirmed DTC could not be stored since the last clear
+ *         (event memory full of active entries)
+ */
+boolean        Dem_GetEventMemoryOverflow(void);
+
 #endif /* DEM_H */
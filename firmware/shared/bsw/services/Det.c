@@ -6,6 +6,9 @@
  * @details Ring buffer stores the last DET_LOG_SIZE errors. In POSIX/SIL
  *          builds, every error is also printed to stderr via fprintf
  *          (Docker stdout is fully buffered — stderr is line-buffered).
+ *          Errors are reported from every Os level and from ISRs, so the
+ *          log is updated in SCHM_AREA_DET; the print and the callback
+ *          run outside it.
  *
  * @safety_req SWR-BSW-040
  * @traces_to  TSR-022, TSR-038
@@ -14,20 +17,33 @@
  * @copyright Taktflow Systems 2026
  */
 #include "Det.h"
+#include "SchM.h"
+#include "Bsw_Instance.h"
 
 #if defined(PLATFORM_POSIX) && !defined(UNIT_TEST)
 /* cppcheck-suppress misra-c2012-21.6 ; SIL_DIAG stderr output only */
 #include <stdio.h>
 #endif
 
-/* ---- Internal State ---- */
+/* ---- Internal State (one set per BSW instance, see Bsw_Instance.h) ---- */
 
-static Det_ErrorEntryType det_log[DET_LOG_SIZE];
-static uint8              det_log_head;     /**< Next write position    */
-static uint8              det_log_count;    /**< Entries in buffer      */
-static uint16             det_error_count;  /**< Total errors reported  */
-static boolean            det_initialized;
-static Det_CallbackType   det_callback;
+typedef struct {
+    Det_ErrorEntryType det_log[DET_LOG_SIZE];
+    uint8              det_log_head;     /**< Next write position    */
+    uint8              det_log_count;    /**< Entries in buffer      */
+    uint16             det_error_count;  /**< Total errors reported  */
+    boolean            det_initialized;
+    Det_CallbackType   det_callback;
+} Det_ContextType;
+
+BSW_INSTANCE_STATE(Det_ContextType, det_ctx);
+
+#define det_log         (BSW_INSTANCE(det_ctx).det_log)
+#define det_log_head    (BSW_INSTANCE(det_ctx).det_log_head)
+#define det_log_count   (BSW_INSTANCE(det_ctx).det_log_count)
+#define det_error_count (BSW_INSTANCE(det_ctx).det_error_count)
+#define det_initialized (BSW_INSTANCE(det_ctx).det_initialized)
+#define det_callback    (BSW_INSTANCE(det_ctx).det_callback)
 
 /* ---- Module Name Lookup (for SIL_DIAG output) ---- */
 
@@ -54,6 +70,12 @@ static const char* det_module_name(uint16 id)
     case DET_MODULE_UART:   return "Uart";
     case DET_MODULE_NVM:    return "NvM";
     case DET_MODULE_CANTP:  return "CanTp";
+    case DET_MODULE_FLS:    return "Fls";
+    case DET_MODULE_FEE:    return "Fee";
+    case DET_MODULE_BSW:    return "Bsw";
+    case DET_MODULE_TMR:    return "Tmr";
+    case DET_MODULE_STBM:   return "StbM";
+    case DET_MODULE_CANTSYN: return "CanTSyn";
     default:                return "Unknown";
     }
 }
@@ -97,6 +119,7 @@ void Det_ReportError(uint16 ModuleId, uint8 InstanceId,
     }
 
     /* Store in ring buffer */
+    SchM_Enter(SCHM_AREA_DET);
     det_log[det_log_head].ModuleId   = ModuleId;
     det_log[det_log_head].InstanceId = InstanceId;
     det_log[det_log_head].ApiId      = ApiId;
@@ -112,6 +135,7 @@ void Det_ReportError(uint16 ModuleId, uint8 InstanceId,
     if (det_error_count < 0xFFFFu) {
         det_error_count++;
     }
+    SchM_Exit(SCHM_AREA_DET);
 
     /* SIL_DIAG output (POSIX only, not in unit tests) */
 #if defined(PLATFORM_POSIX) && !defined(UNIT_TEST)
@@ -46,6 +46,14 @@
 #define DET_MODULE_UART         0x11u
 #define DET_MODULE_NVM          0x12u
 #define DET_MODULE_CANTP        0x13u
+#define DET_MODULE_FLS          0x14u
+#define DET_MODULE_FEE          0x15u
+#define DET_MODULE_OS           0x16u
+#define DET_MODULE_SCHM         0x17u
+#define DET_MODULE_BSW          0x18u   /**< Bsw_Instance */
+#define DET_MODULE_TMR          0x19u
+#define DET_MODULE_STBM         0x1Au
+#define DET_MODULE_CANTSYN      0x1Bu
 
 /* ---- API IDs per Module ----
  * Convention: <MODULE>_API_<FUNCTION> = sequential per module
@@ -77,6 +85,8 @@
 #define COM_API_RECEIVE_SIGNAL          0x02u
 #define COM_API_RX_INDICATION           0x03u
 #define COM_API_MAIN_FUNCTION_TX        0x04u
+#define COM_API_IPDU_GROUP_CONTROL      0x05u
+#define COM_API_GET_RX_PDU_TIME         0x06u
 
 /* Dcm API IDs */
 #define DCM_API_INIT                    0x00u
@@ -88,12 +98,17 @@
 #define DEM_API_REPORT_ERROR_STATUS     0x01u
 #define DEM_API_MAIN_FUNCTION           0x02u
 #define DEM_API_SET_ECU_ID              0x03u
+#define DEM_API_GET_DTC_DATA            0x04u
+#define DEM_API_GET_DEBOUNCING          0x05u
 
 /* WdgM API IDs */
 #define WDGM_API_INIT                   0x00u
 #define WDGM_API_CHECKPOINT_REACHED     0x01u
 #define WDGM_API_MAIN_FUNCTION          0x02u
 #define WDGM_API_GET_SE_STATUS          0x03u
+#define WDGM_API_SET_ENTITY_ACTIVE      0x04u
+#define WDGM_API_REPORT_CHECKPOINT      0x05u
+#define WDGM_API_GET_VIOLATION          0x06u
 
 /* BswM API IDs */
 #define BSWM_API_INIT                   0x00u
@@ -109,17 +124,25 @@
 #define RTE_API_WRITE                   0x01u
 #define RTE_API_READ                    0x02u
 #define RTE_API_MAIN_FUNCTION           0x03u
+#define RTE_API_READ_GROUP              0x04u
+#define RTE_API_WRITE_GROUP             0x05u
+#define RTE_API_SWITCH_MODE             0x06u
+#define RTE_API_SET_RUNNABLE_MASK       0x07u
+#define RTE_API_GET_PROFILE             0x08u
 
 /* Spi API IDs */
 #define SPI_API_INIT                    0x00u
 #define SPI_API_WRITE_IB                0x01u
 #define SPI_API_READ_IB                 0x02u
 #define SPI_API_ASYNC_TRANSMIT          0x03u
+#define SPI_API_GET_JOB_RESULT          0x04u
+#define SPI_API_GET_SEQUENCE_RESULT     0x05u
 
 /* Adc API IDs */
 #define ADC_API_INIT                    0x00u
 #define ADC_API_START_GROUP_CONVERSION  0x01u
 #define ADC_API_READ_GROUP              0x02u
+#define ADC_API_STOP_GROUP_CONVERSION   0x03u
 
 /* Dio API IDs */
 #define DIO_API_INIT                    0x00u
@@ -131,6 +154,8 @@
 #define GPT_API_START_TIMER             0x01u
 #define GPT_API_STOP_TIMER              0x02u
 #define GPT_API_GET_TIME_ELAPSED        0x03u
+#define GPT_API_ENABLE_NOTIFICATION     0x04u
+#define GPT_API_DISABLE_NOTIFICATION    0x05u
 
 /* Pwm API IDs */
 #define PWM_API_INIT                    0x00u
@@ -153,6 +178,48 @@
 #define NVM_API_WRITE_BLOCK             0x02u
 #define NVM_API_MAIN_FUNCTION           0x03u
 
+/* Fls API IDs */
+#define FLS_API_INIT                    0x00u
+#define FLS_API_ERASE                   0x01u
+#define FLS_API_WRITE                   0x02u
+#define FLS_API_READ                    0x03u
+#define FLS_API_MAIN_FUNCTION           0x04u
+
+/* Fee API IDs */
+#define FEE_API_INIT                    0x00u
+#define FEE_API_READ                    0x01u
+#define FEE_API_WRITE                   0x02u
+#define FEE_API_MAIN_FUNCTION           0x03u
+
+/* Os API IDs */
+#define OS_API_INIT                     0x00u
+#define OS_API_START                    0x01u
+#define OS_API_ACTIVATE_TASK            0x02u
+#define OS_API_DISPATCH_LEVEL           0x03u
+#define OS_API_SET_LATENCY_MEASUREMENT  0x04u
+#define OS_API_GET_TASK_STATS           0x05u
+
+/* SchM API IDs */
+#define SCHM_API_INIT                   0x00u
+
+/* Bsw_Instance API IDs */
+#define BSW_API_SET_INSTANCE            0x00u
+
+/* Tmr API IDs */
+#define TMR_API_INIT                    0x00u
+#define TMR_API_START                   0x01u
+#define TMR_API_CANCEL                  0x02u
+#define TMR_API_GET_REMAINING           0x03u
+
+/* StbM API IDs */
+#define STBM_API_INIT                   0x00u
+#define STBM_API_GET_CURRENT_TIME       0x01u
+#define STBM_API_BUS_SET_GLOBAL_TIME    0x02u
+
+/* CanTSyn API IDs */
+#define CANTSYN_API_INIT                0x00u
+#define CANTSYN_API_RX_INDICATION       0x01u
+
 /* ---- Ring Buffer Configuration ---- */
 
 #define DET_LOG_SIZE    32u  /**< Ring buffer capacity (entries) */
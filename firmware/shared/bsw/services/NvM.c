@@ -7,8 +7,14 @@
  * @traces_to  TSR-050
  *
  * @details  Dual-mode implementation:
- *           - POSIX builds (SIL/MIL): file-backed storage in /tmp/nvm_block_{id}.bin
- *           - Target builds: no-op stub (real flash driver to be integrated)
+ *           - POSIX builds (SIL/MIL): one preallocated image file per ECU,
+ *             mapped with mmap. A header with a block-offset table precedes
+ *             NVM_MAX_BLOCKS fixed-size blocks. Reads and writes are memcpy;
+ *             writes only widen a dirty range, which NvM_MainFunction
+ *             flushes with one ranged msync per cycle.
+ *           - Target builds: blocks kept by Fee (ecual/Fee.c) as append-only
+ *             records in STM32 flash pages; writes are queued and carried
+ *             out by NvM_MainFunction without blocking.
  *
  *           Reusable across all ECUs. Block size fixed at NVM_BLOCK_SIZE bytes.
  *
@@ -16,126 +22,292 @@
  * @copyright Taktflow Systems 2026
  */
 
+/* mmap/msync/ftruncate are POSIX, not C99 — request them before any include */
+#if (defined(__unix__) || defined(__linux__)) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "NvM.h"
 #include "Det.h"
 
-/* ---- POSIX file-backed implementation (SIL / MIL / PIL host) ---- */
+/* ---- POSIX memory-mapped image implementation (SIL / MIL / PIL host) ---- */
 #if defined(__unix__) || defined(__linux__) || defined(__APPLE__) || \
     defined(__POSIX__) || defined(POSIX_BUILD)
 
 #include <unistd.h>
 #include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/mman.h>
+
+#define NVM_IMAGE_MAGIC         0x494D564Eu   /* "NVMI" little-endian */
+#define NVM_IMAGE_VERSION       1u
+#define NVM_IMAGE_DATA_OFFSET   128u          /* Header padded to 128 bytes */
+#define NVM_IMAGE_SIZE          (NVM_IMAGE_DATA_OFFSET + \
+                                 (NVM_MAX_BLOCKS * NVM_BLOCK_SIZE))
+#define NVM_PATH_MAX            128u
+#define NVM_DEFAULT_PATH        "/tmp/nvm_image.img"
+
+/** Block-offset table entry (persisted in the image header) */
+typedef struct {
+    uint32  offset;     /**< Byte offset of block data within the image */
+    uint32  written;    /**< 1 once the block has been written          */
+} NvM_BlockEntryType;
+
+/** Image header — first NVM_IMAGE_DATA_OFFSET bytes of the image file */
+typedef struct {
+    uint32              magic;
+    uint16              version;
+    uint16              blockCount;
+    uint32              blockSize;
+    NvM_BlockEntryType  blocks[NVM_MAX_BLOCKS];
+} NvM_ImageHeaderType;
 
-#define NVM_PATH_PREFIX     "/tmp/nvm_block_"
-#define NVM_PATH_SUFFIX     ".bin"
-#define NVM_PATH_MAX        64u
+/* ---- Internal State ---- */
 
-/* Convert BlockId to decimal string, return number of chars written */
-static uint8 NvM_U16ToStr(uint16 val, char* buf, uint8 maxLen)
+static uint8*               nvm_image;        /* NULL until mapped       */
+static NvM_ImageHeaderType* nvm_header;
+static uint8                nvm_initialized;
+static uint32               nvm_dirty_lo;     /* Dirty byte range [lo, hi) */
+static uint32               nvm_dirty_hi;
+
+/* Image path: $NVM_IMAGE_PATH, else /tmp/nvm_<ECU_NAME>.img */
+static void NvM_BuildPath(char* path)
 {
-    char tmp[6];    /* max 65535 = 5 digits + NUL */
-    uint8 i = 0u;
-    uint8 j;
+    const char* env = getenv("NVM_IMAGE_PATH");
+    int n;
 
-    if (val == 0u) {
-        if (maxLen > 0u) { buf[0] = '0'; }
-        return 1u;
+    if ((env != NULL) && (env[0] != '\0')) {
+        n = snprintf(path, NVM_PATH_MAX, "%s", env);
+    } else {
+        env = getenv("ECU_NAME");
+        if ((env != NULL) && (env[0] != '\0')) {
+            n = snprintf(path, NVM_PATH_MAX, "/tmp/nvm_%s.img", env);
+        } else {
+            n = snprintf(path, NVM_PATH_MAX, "%s", NVM_DEFAULT_PATH);
+        }
     }
-    while ((val > 0u) && (i < 5u)) {
-        tmp[i] = (char)((uint8)'0' + (uint8)(val % 10u));
-        val /= 10u;
-        i++;
+
+    if ((n < 0) || ((uint32)n >= NVM_PATH_MAX)) {
+        (void)snprintf(path, NVM_PATH_MAX, "%s", NVM_DEFAULT_PATH);
     }
-    /* Reverse into buf */
-    for (j = 0u; j < i; j++) {
-        if (j < maxLen) { buf[j] = tmp[(i - 1u) - j]; }
+}
+
+/* Write a fresh header + block-offset table (image content is zeroed) */
+static void NvM_FormatImage(void)
+{
+    uint16 i;
+
+    (void)memset(nvm_image, 0, (size_t)NVM_IMAGE_SIZE);
+    nvm_header->magic      = NVM_IMAGE_MAGIC;
+    nvm_header->version    = (uint16)NVM_IMAGE_VERSION;
+    nvm_header->blockCount = (uint16)NVM_MAX_BLOCKS;
+    nvm_header->blockSize  = NVM_BLOCK_SIZE;
+    for (i = 0u; i < NVM_MAX_BLOCKS; i++) {
+        nvm_header->blocks[i].offset  = NVM_IMAGE_DATA_OFFSET +
+                                        ((uint32)i * NVM_BLOCK_SIZE);
+        nvm_header->blocks[i].written = 0u;
     }
-    return i;
+    nvm_dirty_lo = 0u;
+    nvm_dirty_hi = NVM_IMAGE_SIZE;
 }
 
-static void NvM_BuildPath(NvM_BlockIdType BlockId, char* path)
+static void NvM_MarkDirty(uint32 lo, uint32 hi)
 {
-    uint8 pos = 0u;
-    uint8 n;
-    const char* prefix = NVM_PATH_PREFIX;
-    const char* suffix = NVM_PATH_SUFFIX;
-
-    while (*prefix != '\0') { path[pos] = *prefix; pos++; prefix++; }
-    n = NvM_U16ToStr((uint16)BlockId, &path[pos], (uint8)(NVM_PATH_MAX - pos));
-    pos += n;
-    while (*suffix != '\0') { path[pos] = *suffix; pos++; suffix++; }
-    path[pos] = '\0';
+    if (nvm_dirty_hi <= nvm_dirty_lo) {
+        nvm_dirty_lo = lo;
+        nvm_dirty_hi = hi;
+    } else {
+        if (lo < nvm_dirty_lo) { nvm_dirty_lo = lo; }
+        if (hi > nvm_dirty_hi) { nvm_dirty_hi = hi; }
+    }
 }
 
-Std_ReturnType NvM_ReadBlock(NvM_BlockIdType BlockId, void* NvM_DstPtr)
+void NvM_Init(void)
 {
     char path[NVM_PATH_MAX];
     int fd;
-    ssize_t n;
+    void* map;
+
+    if (nvm_image != NULL_PTR) {
+        (void)munmap((void*)nvm_image, (size_t)NVM_IMAGE_SIZE);
+        nvm_image  = NULL_PTR;
+        nvm_header = NULL_PTR;
+    }
+    nvm_initialized = 1u;
+    nvm_dirty_lo    = 0u;
+    nvm_dirty_hi    = 0u;
 
+    NvM_BuildPath(path);
+
+    fd = open(path, O_RDWR | O_CREAT, 420);  /* 0644 decimal */
+    if (fd < 0) {
+        Det_ReportRuntimeError(DET_MODULE_NVM, 0u, NVM_API_INIT, DET_E_UNINIT);
+        return;
+    }
+
+    /* Preallocate the full image (no-op if already the right size) */
+    if (ftruncate(fd, (off_t)NVM_IMAGE_SIZE) != 0) {
+        (void)close(fd);
+        Det_ReportRuntimeError(DET_MODULE_NVM, 0u, NVM_API_INIT, DET_E_UNINIT);
+        return;
+    }
+
+    map = mmap(NULL, (size_t)NVM_IMAGE_SIZE, PROT_READ | PROT_WRITE,
+               MAP_SHARED, fd, 0);
+    (void)close(fd);  /* Mapping keeps the file referenced */
+    if (map == MAP_FAILED) {
+        Det_ReportRuntimeError(DET_MODULE_NVM, 0u, NVM_API_INIT, DET_E_UNINIT);
+        return;
+    }
+
+    nvm_image  = (uint8*)map;
+    nvm_header = (NvM_ImageHeaderType*)map;
+
+    /* New file (all zero) or layout change: start from an empty image */
+    if ((nvm_header->magic      != NVM_IMAGE_MAGIC) ||
+        (nvm_header->version    != (uint16)NVM_IMAGE_VERSION) ||
+        (nvm_header->blockCount != (uint16)NVM_MAX_BLOCKS) ||
+        (nvm_header->blockSize  != NVM_BLOCK_SIZE)) {
+        NvM_FormatImage();
+    }
+}
+
+Std_ReturnType NvM_ReadBlock(NvM_BlockIdType BlockId, void* NvM_DstPtr)
+{
     if (NvM_DstPtr == NULL_PTR) {
         Det_ReportError(DET_MODULE_NVM, 0u, NVM_API_READ_BLOCK, DET_E_PARAM_POINTER);
         return E_NOT_OK;
     }
 
-    NvM_BuildPath(BlockId, path);
+    if (BlockId >= NVM_MAX_BLOCKS) {
+        Det_ReportError(DET_MODULE_NVM, 0u, NVM_API_READ_BLOCK, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
 
-    fd = open(path, O_RDONLY);
-    if (fd < 0) {
-        /* File not found — first boot, no stored data */
+    if (nvm_initialized == 0u) {
+        NvM_Init();
+    }
+
+    if (nvm_image == NULL_PTR) {
+        /* No backing image — behave as first boot, no stored data */
         return E_OK;
     }
 
-    n = read(fd, NvM_DstPtr, (size_t)NVM_BLOCK_SIZE);
-    (void)close(fd);
-    (void)n;
+    if (nvm_header->blocks[BlockId].written != 0u) {
+        (void)memcpy(NvM_DstPtr, &nvm_image[nvm_header->blocks[BlockId].offset],
+                     (size_t)NVM_BLOCK_SIZE);
+    }
 
     return E_OK;
 }
 
 Std_ReturnType NvM_WriteBlock(NvM_BlockIdType BlockId, const void* NvM_SrcPtr)
 {
-    char path[NVM_PATH_MAX];
-    int fd;
-    ssize_t n;
+    uint32 offset;
 
     if (NvM_SrcPtr == NULL_PTR) {
         Det_ReportError(DET_MODULE_NVM, 0u, NVM_API_WRITE_BLOCK, DET_E_PARAM_POINTER);
         return E_NOT_OK;
     }
 
-    NvM_BuildPath(BlockId, path);
+    if (BlockId >= NVM_MAX_BLOCKS) {
+        Det_ReportError(DET_MODULE_NVM, 0u, NVM_API_WRITE_BLOCK, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
 
-    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 420);  /* 0644 decimal */
-    if (fd < 0) {
+    if (nvm_initialized == 0u) {
+        NvM_Init();
+    }
+
+    if (nvm_image == NULL_PTR) {
         return E_NOT_OK;
     }
 
-    n = write(fd, NvM_SrcPtr, (size_t)NVM_BLOCK_SIZE);
-    (void)fsync(fd);
-    (void)close(fd);
-    (void)n;
+    offset = nvm_header->blocks[BlockId].offset;
+    (void)memcpy(&nvm_image[offset], NvM_SrcPtr, (size_t)NVM_BLOCK_SIZE);
+    NvM_MarkDirty(offset, offset + NVM_BLOCK_SIZE);
+
+    if (nvm_header->blocks[BlockId].written == 0u) {
+        nvm_header->blocks[BlockId].written = 1u;
+        NvM_MarkDirty(0u, (uint32)sizeof(NvM_ImageHeaderType));
+    }
 
     return E_OK;
 }
 
-/* ---- Target stub (real flash driver integration point) ---- */
+void NvM_MainFunction(void)
+{
+    long   page;
+    uint32 lo;
+
+    if ((nvm_image == NULL_PTR) || (nvm_dirty_hi <= nvm_dirty_lo)) {
+        return;
+    }
+
+    /* msync needs a page-aligned start address */
+    page = sysconf(_SC_PAGESIZE);
+    if (page <= 0) {
+        page = 4096;
+    }
+    lo = nvm_dirty_lo - (nvm_dirty_lo % (uint32)page);
+
+    if (msync((void*)&nvm_image[lo], (size_t)(nvm_dirty_hi - lo), MS_SYNC) != 0) {
+        Det_ReportRuntimeError(DET_MODULE_NVM, 0u, NVM_API_MAIN_FUNCTION, DET_E_PARAM_VALUE);
+    }
+
+    nvm_dirty_lo = 0u;
+    nvm_dirty_hi = 0u;
+}
+
+/* ---- Target implementation: blocks stored by Fee in emulated EEPROM ---- */
 #else
 
+#include "Fee.h"
+
+void NvM_Init(void)
+{
+    /* Fls_Init and Fee_Init (ECU-specific page/block config) run before
+     * NvM_Init in main; the block index is already rebuilt by then. */
+}
+
 Std_ReturnType NvM_ReadBlock(NvM_BlockIdType BlockId, void* NvM_DstPtr)
 {
-    (void)BlockId;
-    (void)NvM_DstPtr;
-    /* TODO:HARDWARE — integrate with flash/EEPROM driver */
+    uint16 size;
+
+    if (NvM_DstPtr == NULL_PTR) {
+        Det_ReportError(DET_MODULE_NVM, 0u, NVM_API_READ_BLOCK, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    size = Fee_GetBlockSize(BlockId);
+    if (size == 0u) {
+        Det_ReportError(DET_MODULE_NVM, 0u, NVM_API_READ_BLOCK, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    /* Never written (or only torn records): keep the RAM defaults */
+    (void)Fee_Read(BlockId, 0u, (uint8*)NvM_DstPtr, size);
+
     return E_OK;
 }
 
 Std_ReturnType NvM_WriteBlock(NvM_BlockIdType BlockId, const void* NvM_SrcPtr)
 {
-    (void)BlockId;
-    (void)NvM_SrcPtr;
-    /* TODO:HARDWARE — integrate with flash/EEPROM driver */
-    return E_OK;
+    if (NvM_SrcPtr == NULL_PTR) {
+        Det_ReportError(DET_MODULE_NVM, 0u, NVM_API_WRITE_BLOCK, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    /* Queued only: the RAM mirror is read when Fee builds the record */
+    return Fee_Write(BlockId, (const uint8*)NvM_SrcPtr);
+}
+
+void NvM_MainFunction(void)
+{
+    Fee_MainFunction();
+    Fls_MainFunction();
 }
 
 #endif
@@ -11,7 +11,12 @@
  *           Block ID selects the NVM dataset; data is copied to/from
  *           the caller-provided RAM mirror.
  *
- *           SIL implementation: no-op (returns E_OK, no persistent storage).
+ *           SIL implementation: one memory-mapped image file per ECU with
+ *           a block-offset table. Reads and writes are memcpy; dirty
+ *           ranges are flushed with msync from NvM_MainFunction.
+ *
+ *           Target implementation: block ID = Fee block number; the block
+ *           length is taken from the Fee block configuration of the ECU.
  *
  * @standard AUTOSAR_SWS_NVRAMManager, ISO 26262 Part 6
  * @copyright Taktflow Systems 2026
@@ -24,6 +29,7 @@
 /* ---- Constants ---- */
 
 #define NVM_BLOCK_SIZE  1024u   /**< Max bytes per NvM block */
+#define NVM_MAX_BLOCKS  8u      /**< Block IDs 0 .. NVM_MAX_BLOCKS-1 */
 
 /* ---- Types ---- */
 
@@ -31,11 +37,22 @@ typedef uint16 NvM_BlockIdType;
 
 /* ---- API Functions ---- */
 
+/**
+ * @brief  Initialize NvM — map the NV image and build the block table
+ *
+ * @details POSIX: opens (or creates) the per-ECU image file and maps it
+ *          into memory. Path is $NVM_IMAGE_PATH, else /tmp/nvm_$ECU_NAME.img.
+ *          Read/Write call this lazily if the ECU did not.
+ */
+void NvM_Init(void);
+
 /**
  * @brief  Read an NVM block into RAM mirror
  * @param  BlockId   NVM block identifier
  * @param  NvM_DstPtr Destination RAM buffer
  * @return E_OK on success, E_NOT_OK on failure
+ *
+ * @note   A block that was never written leaves the RAM mirror untouched.
  */
 Std_ReturnType NvM_ReadBlock(NvM_BlockIdType BlockId, void* NvM_DstPtr);
 
@@ -47,4 +64,13 @@ Std_ReturnType NvM_ReadBlock(NvM_BlockIdType BlockId, void* NvM_DstPtr);
  */
 Std_ReturnType NvM_WriteBlock(NvM_BlockIdType BlockId, const void* NvM_SrcPtr);
 
+/**
+ * @brief  Periodic NvM function — flush blocks written since last call
+ *
+ * Call from the 100ms task after Dem_MainFunction so all writes of one
+ * cycle are committed with a single ranged msync. On target it advances
+ * the queued Fee writes and the Fls job instead.
+ */
+void NvM_MainFunction(void);
+
 #endif /* NVM_H */
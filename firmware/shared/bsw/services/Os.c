@@ -0,0 +1,346 @@
+/**
+ * @file    Os.c
+ * @brief   Os — preemptive fixed-priority basic tasks (OSEK BCC1-like)
+ * @date    2026-03-14
+ *
+ * @details Platform-independent task bookkeeping. Preemption is done by
+ *          the interrupt controller: Os_ActivateTask marks the task ready
+ *          and pends the vector of its level (Os_Hw_TriggerLevel); the
+ *          vector calls Os_DispatchLevel, which runs the ready tasks of
+ *          the level in configuration order.
+ *
+ *          Task states: SUSPENDED -> READY (activated) -> RUNNING ->
+ *          SUSPENDED. State changes are made in the Os exclusive area, the
+ *          task bodies run outside it.
+ *
+ * @safety_req SWR-BSW-043
+ * @traces_to  TSR-046, TSR-047
+ *
+ * @standard OSEK/VDX OS 2.2.3 (basic tasks), ISO 26262 Part 6
+ * @copyright Taktflow Systems 2026
+ */
+#include "Os.h"
+#include "Det.h"
+#include "SchM.h"
+
+/* ---- Internal Types ---- */
+
+typedef enum {
+    OS_TASK_SUSPENDED = 0u,
+    OS_TASK_READY     = 1u,
+    OS_TASK_RUNNING   = 2u
+} Os_TaskStateType;
+
+/* ---- Internal State ---- */
+
+static const Os_ConfigType* os_config = NULL_PTR;
+static boolean              os_initialized = FALSE;
+static boolean              os_started = FALSE;
+static boolean              os_measure_latency = FALSE;
+
+static volatile Os_TaskStateType os_state[OS_MAX_TASKS];
+static uint16               os_countdown[OS_MAX_TASKS]; /**< Ticks to next activation */
+static Os_TaskStatsType     os_stats[OS_MAX_TASKS];
+static uint32               os_activated_at[OS_MAX_TASKS]; /**< Cycles    */
+static boolean              os_stamped[OS_MAX_TASKS];
+
+static volatile Os_TaskType os_running[OS_MAX_LEVELS];
+
+/* ---- Private Functions ---- */
+
+static Std_ReturnType Os_CheckConfig(const Os_ConfigType* ConfigPtr)
+{
+    uint8 i;
+
+    if ((ConfigPtr->tasks == NULL_PTR) || (ConfigPtr->levels == NULL_PTR)) {
+        Det_ReportError(DET_MODULE_OS, 0u, OS_API_INIT, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    if ((ConfigPtr->taskCount == 0u) || (ConfigPtr->taskCount > OS_MAX_TASKS) ||
+        (ConfigPtr->levelCount == 0u) || (ConfigPtr->levelCount > OS_MAX_LEVELS)) {
+        Det_ReportError(DET_MODULE_OS, 0u, OS_API_INIT, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    for (i = 0u; i < ConfigPtr->levelCount; i++) {
+        if (ConfigPtr->levels[i].stack == NULL_PTR) {
+            Det_ReportError(DET_MODULE_OS, 0u, OS_API_INIT, DET_E_PARAM_POINTER);
+            return E_NOT_OK;
+        }
+        if (ConfigPtr->levels[i].stackWords == 0u) {
+            Det_ReportError(DET_MODULE_OS, 0u, OS_API_INIT, DET_E_PARAM_VALUE);
+            return E_NOT_OK;
+        }
+    }
+
+    for (i = 0u; i < ConfigPtr->taskCount; i++) {
+        const Os_TaskConfigType* t = &ConfigPtr->tasks[i];
+
+        if (t->func == NULL_PTR) {
+            Det_ReportError(DET_MODULE_OS, 0u, OS_API_INIT, DET_E_PARAM_POINTER);
+            return E_NOT_OK;
+        }
+        if ((t->level >= ConfigPtr->levelCount) ||
+            ((t->periodMs > 0u) && (t->offsetMs >= t->periodMs))) {
+            Det_ReportError(DET_MODULE_OS, 0u, OS_API_INIT, DET_E_PARAM_VALUE);
+            return E_NOT_OK;
+        }
+    }
+
+    return E_OK;
+}
+
+/* ---- API Implementation ---- */
+
+void Os_Init(const Os_ConfigType* ConfigPtr)
+{
+    uint8  i;
+    uint16 w;
+
+    os_initialized = FALSE;
+    os_started     = FALSE;
+    os_config      = NULL_PTR;
+
+    if (ConfigPtr == NULL_PTR) {
+        Det_ReportError(DET_MODULE_OS, 0u, OS_API_INIT, DET_E_PARAM_POINTER);
+        return;
+    }
+
+    if (Os_CheckConfig(ConfigPtr) != E_OK) {
+        return;
+    }
+
+    for (i = 0u; i < ConfigPtr->taskCount; i++) {
+        os_state[i]        = OS_TASK_SUSPENDED;
+        os_countdown[i]    = ConfigPtr->tasks[i].offsetMs;
+        os_stats[i].activations = 0u;
+        os_stats[i].overruns    = 0u;
+        os_stats[i].latencyLast = 0u;
+        os_stats[i].latencyMax  = 0u;
+        os_activated_at[i] = 0u;
+        os_stamped[i]      = FALSE;
+    }
+
+    for (i = 0u; i < OS_MAX_LEVELS; i++) {
+        os_running[i] = OS_TASK_NONE;
+    }
+
+    /* Fill the level stacks for the high-water mark */
+    for (i = 0u; i < ConfigPtr->levelCount; i++) {
+        for (w = 0u; w < ConfigPtr->levels[i].stackWords; w++) {
+            ConfigPtr->levels[i].stack[w] = OS_STACK_FILL;
+        }
+    }
+
+    os_measure_latency = FALSE;
+    os_config = ConfigPtr;
+
+    Os_Hw_Init(ConfigPtr->levels, ConfigPtr->levelCount);
+
+    os_initialized = TRUE;
+}
+
+void Os_Start(void)
+{
+    if (os_initialized == FALSE) {
+        Det_ReportError(DET_MODULE_OS, 0u, OS_API_START, DET_E_UNINIT);
+        return;
+    }
+
+    Os_Hw_Start();
+    os_started = TRUE;
+}
+
+void Os_Tick(void)
+{
+    uint8 i;
+
+    if (os_started == FALSE) {
+        return;
+    }
+
+    for (i = 0u; i < os_config->taskCount; i++) {
+        const Os_TaskConfigType* t = &os_config->tasks[i];
+
+        if (t->periodMs == 0u) {
+            continue;
+        }
+
+        if (os_countdown[i] == 0u) {
+            os_countdown[i] = (uint16)(t->periodMs - OS_TICK_MS);
+            (void)Os_ActivateTask(i);
+        } else {
+            os_countdown[i]--;
+        }
+    }
+}
+
+Std_ReturnType Os_ActivateTask(Os_TaskType TaskId)
+{
+    if (os_initialized == FALSE) {
+        Det_ReportError(DET_MODULE_OS, 0u, OS_API_ACTIVATE_TASK, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if (TaskId >= os_config->taskCount) {
+        Det_ReportError(DET_MODULE_OS, 0u, OS_API_ACTIVATE_TASK, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    SchM_Enter_Os_OS_EXCLUSIVE_AREA_0();
+
+    if (os_state[TaskId] != OS_TASK_SUSPENDED) {
+        os_stats[TaskId].overruns++;
+        SchM_Exit_Os_OS_EXCLUSIVE_AREA_0();
+        return E_NOT_OK;
+    }
+
+    os_state[TaskId] = OS_TASK_READY;
+    os_stats[TaskId].activations++;
+    if (os_measure_latency == TRUE) {
+        os_activated_at[TaskId] = Os_Hw_GetCycles();
+        os_stamped[TaskId]      = TRUE;
+    }
+
+    /* Pended inside the area: the level runs once the area is left,
+     * right away if it is above the caller */
+    Os_Hw_TriggerLevel(os_config->tasks[TaskId].level);
+
+    SchM_Exit_Os_OS_EXCLUSIVE_AREA_0();
+
+    return E_OK;
+}
+
+void Os_DispatchLevel(uint8 Level)
+{
+    if (os_initialized == FALSE) {
+        Det_ReportError(DET_MODULE_OS, 0u, OS_API_DISPATCH_LEVEL, DET_E_UNINIT);
+        return;
+    }
+
+    if (Level >= os_config->levelCount) {
+        Det_ReportError(DET_MODULE_OS, 0u, OS_API_DISPATCH_LEVEL, DET_E_PARAM_VALUE);
+        return;
+    }
+
+    for (;;) {
+        Os_TaskType task = OS_TASK_NONE;
+        uint8 i;
+
+        SchM_Enter_Os_OS_EXCLUSIVE_AREA_0();
+
+        /* First ready task of the level in configuration order */
+        for (i = 0u; i < os_config->taskCount; i++) {
+            if ((os_config->tasks[i].level == Level) &&
+                (os_state[i] == OS_TASK_READY)) {
+                task = i;
+                break;
+            }
+        }
+
+        if (task == OS_TASK_NONE) {
+            SchM_Exit_Os_OS_EXCLUSIVE_AREA_0();
+            break;
+        }
+
+        os_state[task] = OS_TASK_RUNNING;
+        os_running[Level] = task;
+
+        if ((os_measure_latency == TRUE) && (os_stamped[task] == TRUE)) {
+            uint32 latency = Os_Hw_GetCycles() - os_activated_at[task];
+
+            os_stats[task].latencyLast = latency;
+            if (latency > os_stats[task].latencyMax) {
+                os_stats[task].latencyMax = latency;
+            }
+            os_stamped[task] = FALSE;
+        }
+
+        SchM_Exit_Os_OS_EXCLUSIVE_AREA_0();
+
+        os_config->tasks[task].func();
+
+        SchM_Enter_Os_OS_EXCLUSIVE_AREA_0();
+        os_state[task] = OS_TASK_SUSPENDED;
+        os_running[Level] = OS_TASK_NONE;
+        SchM_Exit_Os_OS_EXCLUSIVE_AREA_0();
+    }
+}
+
+Os_TaskType Os_GetRunningTask(void)
+{
+    uint8 lvl;
+
+    if (os_initialized == FALSE) {
+        return OS_TASK_NONE;
+    }
+
+    for (lvl = os_config->levelCount; lvl > 0u; lvl--) {
+        if (os_running[lvl - 1u] != OS_TASK_NONE) {
+            return os_running[lvl - 1u];
+        }
+    }
+
+    return OS_TASK_NONE;
+}
+
+void Os_SetLatencyMeasurement(boolean Enable)
+{
+    uint8 i;
+
+    if (os_initialized == FALSE) {
+        Det_ReportError(DET_MODULE_OS, 0u, OS_API_SET_LATENCY_MEASUREMENT, DET_E_UNINIT);
+        return;
+    }
+
+    SchM_Enter_Os_OS_EXCLUSIVE_AREA_0();
+
+    if ((Enable == TRUE) && (os_measure_latency == FALSE)) {
+        for (i = 0u; i < os_config->taskCount; i++) {
+            os_stats[i].latencyLast = 0u;
+            os_stats[i].latencyMax  = 0u;
+            os_stamped[i] = FALSE;
+        }
+    }
+    os_measure_latency = Enable;
+
+    SchM_Exit_Os_OS_EXCLUSIVE_AREA_0();
+}
+
+Std_ReturnType Os_GetTaskStats(Os_TaskType TaskId, Os_TaskStatsType* StatsPtr)
+{
+    if (StatsPtr == NULL_PTR) {
+        Det_ReportError(DET_MODULE_OS, 0u, OS_API_GET_TASK_STATS, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    if ((os_initialized == FALSE) || (TaskId >= os_config->taskCount)) {
+        Det_ReportError(DET_MODULE_OS, 0u, OS_API_GET_TASK_STATS, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    SchM_Enter_Os_OS_EXCLUSIVE_AREA_0();
+    *StatsPtr = os_stats[TaskId];
+    SchM_Exit_Os_OS_EXCLUSIVE_AREA_0();
+
+    return E_OK;
+}
+
+uint16 Os_GetStackUsage(uint8 Level)
+{
+    const Os_LevelConfigType* lvl;
+    uint16 unused = 0u;
+
+    if ((os_initialized == FALSE) || (Level >= os_config->levelCount)) {
+        return 0u;
+    }
+
+    /* Stacks grow down: count untouched words from the bottom */
+    lvl = &os_config->levels[Level];
+    while ((unused < lvl->stackWords) && (lvl->stack[unused] == OS_STACK_FILL)) {
+        unused++;
+    }
+
+    return (uint16)((uint16)(lvl->stackWords - unused) * 4u);
+}
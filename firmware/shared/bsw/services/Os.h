@@ -0,0 +1,155 @@
+/**
+ * @file    Os.h
+ * @brief   Os — preemptive fixed-priority basic tasks (OSEK BCC1-like)
+ * @date    2026-03-14
+ *
+ * @details Tasks are run-to-completion functions grouped into priority
+ *          levels. Each level is one software-triggered interrupt vector
+ *          at its own NVIC priority, so a task of a higher level preempts
+ *          any task of a lower level, while tasks of the same level run
+ *          one after the other in configuration order. The background
+ *          (main) loop is below all levels.
+ *
+ *          Because a level never preempts itself, all tasks of a level
+ *          share one stack (Os_LevelConfigType.stack): the stack of a
+ *          level only needs to hold the deepest task of that level, not
+ *          the sum of its tasks.
+ *
+ *          Periodic tasks are activated from Os_Tick (1 ms). An activation
+ *          while the task is still pending or running is lost and counted
+ *          as an overrun (BCC1: one activation per task).
+ *
+ *          Latency measurement mode timestamps every activation and
+ *          records the delay until the task starts (hardware cycle
+ *          counter), per task last and maximum.
+ *
+ *          Shared data between levels must be protected with the SchM
+ *          exclusive areas, which mask all task levels.
+ *
+ * @safety_req SWR-BSW-043
+ * @traces_to  TSR-046, TSR-047
+ *
+ * @standard OSEK/VDX OS 2.2.3 (basic tasks), ISO 26262 Part 6
+ * @copyright Taktflow Systems 2026
+ */
+#ifndef OS_H
+#define OS_H
+
+#include "Std_Types.h"
+
+/* ---- Constants ---- */
+
+#define OS_MAX_TASKS            8u
+#define OS_MAX_LEVELS           4u      /**< Priority levels (interrupt vectors) */
+#define OS_TICK_MS              1u      /**< Os_Tick period                  */
+#define OS_STACK_FILL           0xA5A5A5A5u /**< Unused stack word pattern   */
+#define OS_TASK_NONE            0xFFu   /**< Os_GetRunningTask: background   */
+
+/* ---- Types ---- */
+
+typedef uint8 Os_TaskType;
+
+typedef void (*Os_TaskFuncType)(void);
+
+/** One basic task */
+typedef struct {
+    Os_TaskFuncType func;
+    uint16          periodMs;   /**< 0: activated by Os_ActivateTask only   */
+    uint16          offsetMs;   /**< First activation tick, < periodMs      */
+    uint8           level;      /**< Priority level, 0 = lowest             */
+} Os_TaskConfigType;
+
+/** One priority level */
+typedef struct {
+    uint32*         stack;      /**< Stack shared by the tasks of the level,
+                                     8-byte aligned                         */
+    uint16          stackWords; /**< Stack size in 32-bit words             */
+} Os_LevelConfigType;
+
+/** Os configuration */
+typedef struct {
+    const Os_TaskConfigType*    tasks;
+    uint8                       taskCount;  /**< <= OS_MAX_TASKS            */
+    const Os_LevelConfigType*   levels;
+    uint8                       levelCount; /**< <= OS_MAX_LEVELS, every
+                                                 task level below it        */
+} Os_ConfigType;
+
+/** Run-time statistics of one task */
+typedef struct {
+    uint32  activations;    /**< Accepted activations                       */
+    uint32  overruns;       /**< Activations lost (task still pending)      */
+    uint32  latencyLast;    /**< Activation to start, cycles (measurement)  */
+    uint32  latencyMax;     /**< Maximum since the measurement was enabled  */
+} Os_TaskStatsType;
+
+/* ---- Hardware Abstraction (implemented per platform) ----
+ * STM32: mcal/target/Os_Hw_STM32.c
+ * Test:  Mocked in test/test_Os_asild.c
+ */
+extern void   Os_Hw_Init(const Os_LevelConfigType* Levels, uint8 LevelCount);
+extern void   Os_Hw_Start(void);
+extern void   Os_Hw_TriggerLevel(uint8 Level);
+extern uint32 Os_Hw_GetCycles(void);
+
+/* ---- API Functions ---- */
+
+/**
+ * @brief  Initialize Os: validate the task table, fill the level stacks
+ * @param  ConfigPtr  Configuration (must not be NULL)
+ * @note   No task is activated before Os_Start.
+ */
+void Os_Init(const Os_ConfigType* ConfigPtr);
+
+/**
+ * @brief  Start tick-driven task activation and enable the level vectors
+ */
+void Os_Start(void);
+
+/**
+ * @brief  1 ms system tick: activate the periodic tasks that are due
+ * @note   Call from the SysTick interrupt, which must have a higher
+ *         priority than every task level.
+ */
+void Os_Tick(void);
+
+/**
+ * @brief  Activate a task
+ * @return E_OK if activated; E_NOT_OK if the task is still pending or
+ *         running (overrun) or on a parameter error
+ */
+Std_ReturnType Os_ActivateTask(Os_TaskType TaskId);
+
+/**
+ * @brief  Run the pending tasks of a level until none is left
+ * @note   Called by the interrupt vector of the level (Os_Hw), on the
+ *         stack of the level.
+ */
+void Os_DispatchLevel(uint8 Level);
+
+/**
+ * @brief  Task currently executing (highest level), OS_TASK_NONE in the
+ *         background loop
+ */
+Os_TaskType Os_GetRunningTask(void);
+
+/**
+ * @brief  Enable or disable the activation latency measurement
+ * @note   Enabling clears the latency statistics of all tasks.
+ */
+void Os_SetLatencyMeasurement(boolean Enable);
+
+/**
+ * @brief  Run-time statistics of a task
+ * @return E_OK on success, E_NOT_OK for an invalid TaskId or NULL pointer
+ */
+Std_ReturnType Os_GetTaskStats(Os_TaskType TaskId, Os_TaskStatsType* StatsPtr);
+
+/**
+ * @brief  Stack high-water mark of a level in bytes
+ * @return Bytes of the level stack that have been written, 0 for an
+ *         invalid level
+ */
+uint16 Os_GetStackUsage(uint8 Level);
+
+#endif /* OS_H */
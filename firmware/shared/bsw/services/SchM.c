@@ -3,11 +3,27 @@
  * @brief   Schedule Manager implementation — STM32 critical sections
  * @date    2026-03-03
  *
- * @details On STM32, critical sections disable/enable interrupts using
- *          CMSIS __disable_irq() / __enable_irq() with a nesting counter
- *          so nested enter/exit pairs work correctly.
+ * @details Each module has its own exclusive area, locked as set by
+ *          SchM_Init:
  *
- *          On POSIX/SIL, all functions are no-op macros in SchM.h —
+ *          - SCHM_LOCK_BASEPRI: BASEPRI is raised to the ceiling of the
+ *            area (BASEPRI_MAX: never lowered by a nested area) and the
+ *            value found at the outermost entry is restored on exit. Only
+ *            the users of the area and everything less urgent are held
+ *            off; FDCAN, DMA and SysTick above the ceiling keep running.
+ *          - SCHM_LOCK_GLOBAL: __disable_irq() / __enable_irq() with a
+ *            nesting counter, the lock of every area before SchM_Init.
+ *          - SCHM_LOCK_FLAG: nothing is masked. Only valid when all users
+ *            of the area run on one Os level and never preempt each other;
+ *            the area is still counted and timed.
+ *
+ *          Per area, the outermost enter/exit pairs are counted and, with
+ *          SCHM_IRQ_OFF_MEASUREMENT, the longest hold is taken from the DWT
+ *          cycle counter. Independently, the outermost sections that mask
+ *          interrupts (PRIMASK or BASEPRI) are counted and timed, to
+ *          measure how long interrupts stay masked per scheduling cycle.
+ *
+ *          On POSIX/SIL, the areas are pthread mutexes (SchM_Posix.c) —
  *          this file is only compiled for STM32 targets or unit tests.
  *
  * @safety_req SWR-BSW-041
@@ -19,32 +35,260 @@
 #include "SchM.h"
 
 /* Only compile the implementation for STM32 or unit test builds.
- * POSIX/SIL uses no-op macros defined in SchM.h. */
+ * POSIX/SIL uses mcal/posix/SchM_Posix.c. */
 #if !defined(PLATFORM_POSIX) || defined(UNIT_TEST)
 
-/* CMSIS intrinsics for __disable_irq() / __enable_irq() on STM32 */
+#include "Det.h"
+
+/* CMSIS intrinsics for __disable_irq() / __set_BASEPRI() on STM32 */
 #if defined(PLATFORM_STM32)
 #include "stm32g4xx.h"
 #endif
 
+/* ---- Constants ---- */
+
+#define SCHM_PRIO_LOWEST    15u     /**< STM32G4: 4 NVIC priority bits */
+
 /* ---- Internal State ---- */
 
-static uint8 schm_nesting_depth = 0u;
+/** Lock of every area until SchM_Init */
+static const SchM_AreaConfigType schm_area_default = { SCHM_LOCK_GLOBAL, 0u };
+
+static const SchM_AreaConfigType* schm_areas = NULL_PTR;
+
+static uint8 schm_nesting_depth = 0u;   /**< Held sections masking IRQs */
+static uint8 schm_primask_depth = 0u;   /**< Held SCHM_LOCK_GLOBAL sections */
+
+static SchM_IrqOffStatsType schm_irq_off_stats;
+static uint32 schm_enter_cycles = 0u;
+
+static uint8              schm_area_depth[SCHM_AREA_COUNT];
+static uint32             schm_area_saved[SCHM_AREA_COUNT];   /**< BASEPRI */
+static uint32             schm_area_entered[SCHM_AREA_COUNT]; /**< Cycles  */
+static SchM_AreaStatsType schm_area_stats[SCHM_AREA_COUNT];
 
 /* ---- Hardware Abstraction ---- */
 
 #if defined(UNIT_TEST)
-/* Unit test: track IRQ state for verification */
+/* Unit test: track IRQ state, BASEPRI (as a priority) and a cycle counter */
 static boolean schm_irq_disabled = FALSE;
+static uint8   schm_test_basepri = 0u;
+static uint32  schm_test_cycles  = 0u;
 
 boolean SchM_Test_IsIrqDisabled(void)
 {
     return schm_irq_disabled;
 }
+
+uint8 SchM_Test_GetBasePri(void)
+{
+    return schm_test_basepri;
+}
+
+void SchM_Test_AdvanceCycles(uint32 Cycles)
+{
+    schm_test_cycles += Cycles;
+}
+#endif
+
+static uint32 SchM_Hw_GetCycles(void)
+{
+#if defined(UNIT_TEST)
+    return schm_test_cycles;
+#elif defined(SCHM_IRQ_OFF_MEASUREMENT)
+    return DWT->CYCCNT;
+#else
+    return 0u;
+#endif
+}
+
+/**
+ * @brief  Mask priorities Ceiling..lowest unless already masked further
+ * @return BASEPRI before the call
+ */
+static uint32 SchM_Hw_RaiseBasePri(uint8 Ceiling)
+{
+#if defined(UNIT_TEST)
+    uint32 prev = schm_test_basepri;
+
+    if ((schm_test_basepri == 0u) || (Ceiling < schm_test_basepri)) {
+        schm_test_basepri = Ceiling;
+    }
+    return prev;
+#else
+    uint32 prev = __get_BASEPRI();
+
+    __set_BASEPRI_MAX((uint32)Ceiling << (8u - __NVIC_PRIO_BITS));
+    return prev;
+#endif
+}
+
+static void SchM_Hw_RestoreBasePri(uint32 Prev)
+{
+#if defined(UNIT_TEST)
+    schm_test_basepri = (uint8)Prev;
+#else
+    __set_BASEPRI(Prev);
+#endif
+}
+
+/**
+ * @brief  Mask all interrupts for a statistics copy (not counted)
+ * @return PRIMASK before the call
+ */
+static uint32 SchM_Hw_SuspendAll(void)
+{
+#if defined(UNIT_TEST)
+    return 0u;
+#else
+    uint32 primask = __get_PRIMASK();
+
+    __disable_irq();
+    return primask;
+#endif
+}
+
+static void SchM_Hw_ResumeAll(uint32 Primask)
+{
+#if defined(UNIT_TEST)
+    (void)Primask;
+#else
+    __set_PRIMASK(Primask);
 #endif
+}
+
+/* ---- Private Functions ---- */
+
+static const SchM_AreaConfigType* SchM_AreaConfig(SchM_AreaType Area)
+{
+    return (schm_areas != NULL_PTR) ? &schm_areas[Area] : &schm_area_default;
+}
+
+/**
+ * @brief  Count a section that masks interrupts (called once masked)
+ * @note   A higher-priority ISR entering an area in between sees the
+ *         depth already raised and is accounted to this section.
+ */
+static void SchM_MaskEnter(void)
+{
+    schm_nesting_depth++;
+
+    if (schm_nesting_depth == 1u) {
+        schm_irq_off_stats.sections++;
+        schm_enter_cycles = SchM_Hw_GetCycles();
+    }
+}
+
+/**
+ * @brief  End a section that masks interrupts (called while still masked)
+ */
+static void SchM_MaskExit(void)
+{
+    if (schm_nesting_depth == 1u) {
+        uint32 cycles = SchM_Hw_GetCycles() - schm_enter_cycles;
+
+        schm_irq_off_stats.cycles += cycles;
+        if (cycles > schm_irq_off_stats.maxCycles) {
+            schm_irq_off_stats.maxCycles = cycles;
+        }
+    }
+
+    if (schm_nesting_depth > 0u) {
+        schm_nesting_depth--;
+    }
+}
 
 /* ---- API Implementation ---- */
 
+void SchM_Init(const SchM_ConfigType* ConfigPtr)
+{
+    uint8 i;
+
+    if (ConfigPtr == NULL_PTR) {
+        schm_areas = NULL_PTR;
+        return;
+    }
+
+    if ((ConfigPtr->areas == NULL_PTR) || (ConfigPtr->areaCount != SCHM_AREA_COUNT)) {
+        Det_ReportError(DET_MODULE_SCHM, 0u, SCHM_API_INIT, DET_E_PARAM_POINTER);
+        return;
+    }
+
+    for (i = 0u; i < SCHM_AREA_COUNT; i++) {
+        const SchM_AreaConfigType* a = &ConfigPtr->areas[i];
+
+        if ((a->lock > SCHM_LOCK_FLAG) ||
+            ((a->lock == SCHM_LOCK_BASEPRI) &&
+             ((a->ceiling == 0u) || (a->ceiling > SCHM_PRIO_LOWEST)))) {
+            Det_ReportError(DET_MODULE_SCHM, 0u, SCHM_API_INIT, DET_E_PARAM_VALUE);
+            return;
+        }
+    }
+
+    schm_areas = ConfigPtr->areas;
+}
+
+void SchM_Enter(SchM_AreaType Area)
+{
+    const SchM_AreaConfigType* cfg;
+
+    if (Area >= SCHM_AREA_COUNT) {
+        return;
+    }
+
+    cfg = SchM_AreaConfig(Area);
+
+    if (cfg->lock == SCHM_LOCK_BASEPRI) {
+        uint32 prev = SchM_Hw_RaiseBasePri(cfg->ceiling);
+
+        if (schm_area_depth[Area] == 0u) {
+            schm_area_saved[Area] = prev;
+        }
+        SchM_MaskEnter();
+    } else if (cfg->lock == SCHM_LOCK_GLOBAL) {
+        SchM_Enter_Exclusive();
+    } else {
+        /* SCHM_LOCK_FLAG: no other user can run now */
+    }
+
+    if (schm_area_depth[Area] == 0u) {
+        schm_area_stats[Area].entries++;
+        schm_area_entered[Area] = SchM_Hw_GetCycles();
+    }
+    schm_area_depth[Area]++;
+}
+
+void SchM_Exit(SchM_AreaType Area)
+{
+    const SchM_AreaConfigType* cfg;
+
+    if ((Area >= SCHM_AREA_COUNT) || (schm_area_depth[Area] == 0u)) {
+        return;
+    }
+
+    cfg = SchM_AreaConfig(Area);
+
+    schm_area_depth[Area]--;
+    if (schm_area_depth[Area] == 0u) {
+        uint32 held = SchM_Hw_GetCycles() - schm_area_entered[Area];
+
+        if (held > schm_area_stats[Area].maxCycles) {
+            schm_area_stats[Area].maxCycles = held;
+        }
+    }
+
+    if (cfg->lock == SCHM_LOCK_BASEPRI) {
+        SchM_MaskExit();
+        if (schm_area_depth[Area] == 0u) {
+            SchM_Hw_RestoreBasePri(schm_area_saved[Area]);
+        }
+    } else if (cfg->lock == SCHM_LOCK_GLOBAL) {
+        SchM_Exit_Exclusive();
+    } else {
+        /* SCHM_LOCK_FLAG: nothing to release */
+    }
+}
+
 void SchM_Enter_Exclusive(void)
 {
 #if !defined(UNIT_TEST)
@@ -53,16 +297,20 @@ void SchM_Enter_Exclusive(void)
     schm_irq_disabled = TRUE;
 #endif
 
-    schm_nesting_depth++;
+    schm_primask_depth++;
+    SchM_MaskEnter();
 }
 
 void SchM_Exit_Exclusive(void)
 {
-    if (schm_nesting_depth > 0u) {
-        schm_nesting_depth--;
+    if (schm_primask_depth == 0u) {
+        return;
     }
 
-    if (schm_nesting_depth == 0u) {
+    SchM_MaskExit();
+    schm_primask_depth--;
+
+    if (schm_primask_depth == 0u) {
 #if !defined(UNIT_TEST)
         __enable_irq();
 #else
@@ -76,4 +324,55 @@ uint8 SchM_GetNestingDepth(void)
     return schm_nesting_depth;
 }
 
+void SchM_GetIrqOffStats(SchM_IrqOffStatsType* StatsPtr)
+{
+    uint32 primask;
+
+    if (StatsPtr == NULL_PTR) {
+        return;
+    }
+
+    /* Masked directly, not via SchM_Enter_Exclusive: not counted itself */
+    primask = SchM_Hw_SuspendAll();
+    *StatsPtr = schm_irq_off_stats;
+    SchM_Hw_ResumeAll(primask);
+}
+
+void SchM_ResetIrqOffStats(void)
+{
+    uint32 primask = SchM_Hw_SuspendAll();
+
+    schm_irq_off_stats.sections  = 0u;
+    schm_irq_off_stats.cycles    = 0u;
+    schm_irq_off_stats.maxCycles = 0u;
+    SchM_Hw_ResumeAll(primask);
+}
+
+Std_ReturnType SchM_GetAreaStats(SchM_AreaType Area, SchM_AreaStatsType* StatsPtr)
+{
+    uint32 primask;
+
+    if ((Area >= SCHM_AREA_COUNT) || (StatsPtr == NULL_PTR)) {
+        return E_NOT_OK;
+    }
+
+    primask = SchM_Hw_SuspendAll();
+    *StatsPtr = schm_area_stats[Area];
+    SchM_Hw_ResumeAll(primask);
+
+    return E_OK;
+}
+
+void SchM_ResetAreaStats(void)
+{
+    uint32 primask = SchM_Hw_SuspendAll();
+    uint8 i;
+
+    for (i = 0u; i < SCHM_AREA_COUNT; i++) {
+        schm_area_stats[i].entries   = 0u;
+        schm_area_stats[i].maxCycles = 0u;
+    }
+    SchM_Hw_ResumeAll(primask);
+}
+
 #endif /* !PLATFORM_POSIX || UNIT_TEST */
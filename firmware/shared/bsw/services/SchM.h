@@ -4,9 +4,11 @@
  * @date    2026-03-03
  *
  * @details Provides per-module exclusive area enter/exit macros.
- *          - POSIX/SIL (non-test): empty macros (cooperative = no preemption)
- *          - STM32:     __disable_irq() / __enable_irq() with nesting counter
- *          - UNIT_TEST: real implementation with mock IRQ state
+ *          - POSIX/SIL: one recursive pthread mutex per area (SchM_Posix.c),
+ *                       so SIL I/O may run on threads of its own
+ *          - STM32:     per-area lock (SchM_Init): BASEPRI up to a priority
+ *                       ceiling, PRIMASK, or an unmasked flag area
+ *          - UNIT_TEST: real implementation with mock IRQ / BASEPRI state
  *
  * @safety_req SWR-BSW-041: Critical section protection for shared state
  * @traces_to  TSR-022, TSR-023
@@ -19,34 +21,119 @@
 
 #include "Std_Types.h"
 
-/* ====================================================================
- * POSIX/SIL non-test build — no-op macros (cooperative, no ISR risk)
- * Unit tests and STM32 use the real nesting implementation.
- * ==================================================================== */
+/* ---- Exclusive Areas ---- */
+
+typedef uint8 SchM_AreaType;
+
+#define SCHM_AREA_COM       0u
+#define SCHM_AREA_RTE       1u
+#define SCHM_AREA_DEM       2u
+#define SCHM_AREA_WDGM      3u
+#define SCHM_AREA_CAN       4u
+#define SCHM_AREA_OS        5u
+#define SCHM_AREA_TMR       6u
+#define SCHM_AREA_STBM      7u      /**< StbM and CanTSyn */
+#define SCHM_AREA_SPI       8u      /**< Spi job queue, IoHwAb angle cache */
+#define SCHM_AREA_ADC       9u      /**< Adc DMA double buffer state */
+#define SCHM_AREA_DET       10u     /**< Det error log (every level and ISR) */
+#define SCHM_AREA_COUNT     11u
+
+/** How an exclusive area is protected */
+typedef enum {
+    SCHM_LOCK_GLOBAL  = 0u,  /**< PRIMASK: all interrupts masked (default);
+                                  POSIX: the mutex of the area             */
+    SCHM_LOCK_BASEPRI = 1u,  /**< BASEPRI: priorities ceiling..lowest masked;
+                                  POSIX: the mutex of the area             */
+    SCHM_LOCK_FLAG    = 2u   /**< Nothing masked: every user of the area runs
+                                  on the same Os level (never preempted by
+                                  another user; POSIX: the same thread);
+                                  bookkeeping only                         */
+} SchM_LockType;
+
+/** Lock of one exclusive area */
+typedef struct {
+    SchM_LockType lock;
+    uint8         ceiling;  /**< SCHM_LOCK_BASEPRI: NVIC priority of the most
+                                 urgent user (1..15, 0 = highest); the area
+                                 masks it and everything less urgent        */
+} SchM_AreaConfigType;
+
+/** SchM configuration: one entry per area, indexed by SCHM_AREA_* */
+typedef struct {
+    const SchM_AreaConfigType*  areas;
+    uint8                       areaCount;  /**< Must be SCHM_AREA_COUNT */
+} SchM_ConfigType;
+
+/** Hold time of one exclusive area since the last SchM_ResetAreaStats */
+typedef struct {
+    uint32  entries;    /**< Outermost enter/exit pairs of the area        */
+    uint32  maxCycles;  /**< Longest hold, cycles (SCHM_IRQ_OFF_MEASUREMENT
+                             builds, else 0; POSIX: nanoseconds)            */
+} SchM_AreaStatsType;
 
-#if defined(PLATFORM_POSIX) && !defined(UNIT_TEST)
+/**
+ * @brief  Set the lock of every exclusive area
+ * @param  ConfigPtr  Area configuration (NULL: all areas SCHM_LOCK_GLOBAL)
+ * @note   Call while no area is held (before Os_Init). Until then every area
+ *         is SCHM_LOCK_GLOBAL.
+ */
+void SchM_Init(const SchM_ConfigType* ConfigPtr);
+
+/**
+ * @brief  Enter an exclusive area (nesting-safe)
+ * @param  Area  SCHM_AREA_* (others ignored)
+ * @note   Areas held together must be left in reverse order of entry.
+ */
+void SchM_Enter(SchM_AreaType Area);
+
+/**
+ * @brief  Exit an exclusive area (lock released when its nesting reaches 0)
+ * @param  Area  SCHM_AREA_* (others ignored)
+ */
+void SchM_Exit(SchM_AreaType Area);
 
-/* Com exclusive areas */
-#define SchM_Enter_Com_COM_EXCLUSIVE_AREA_0()   ((void)0)
-#define SchM_Exit_Com_COM_EXCLUSIVE_AREA_0()    ((void)0)
+/**
+ * @brief  Get the hold-time statistics of an exclusive area
+ * @param  Area      SCHM_AREA_*
+ * @param  StatsPtr  Destination
+ * @return E_OK, or E_NOT_OK for an invalid area or NULL pointer
+ */
+Std_ReturnType SchM_GetAreaStats(SchM_AreaType Area, SchM_AreaStatsType* StatsPtr);
 
-/* Rte exclusive areas */
-#define SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0()   ((void)0)
-#define SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0()    ((void)0)
+/**
+ * @brief  Clear the hold-time statistics of all areas
+ */
+void SchM_ResetAreaStats(void);
 
-/* Dem exclusive areas */
-#define SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0()   ((void)0)
-#define SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0()    ((void)0)
+/* Each module has its own area, locked as configured by SchM_Init */
+#define SchM_Enter_Com_COM_EXCLUSIVE_AREA_0()    SchM_Enter(SCHM_AREA_COM)
+#define SchM_Exit_Com_COM_EXCLUSIVE_AREA_0()     SchM_Exit(SCHM_AREA_COM)
 
-/* WdgM exclusive areas */
-#define SchM_Enter_WdgM_WDGM_EXCLUSIVE_AREA_0() ((void)0)
-#define SchM_Exit_WdgM_WDGM_EXCLUSIVE_AREA_0()  ((void)0)
+#define SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0()    SchM_Enter(SCHM_AREA_RTE)
+#define SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0()     SchM_Exit(SCHM_AREA_RTE)
 
-/* Can exclusive areas */
-#define SchM_Enter_Can_CAN_EXCLUSIVE_AREA_0()   ((void)0)
-#define SchM_Exit_Can_CAN_EXCLUSIVE_AREA_0()    ((void)0)
+#define SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0()    SchM_Enter(SCHM_AREA_DEM)
+#define SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0()     SchM_Exit(SCHM_AREA_DEM)
 
-#else /* STM32 or UNIT_TEST */
+#define SchM_Enter_WdgM_WDGM_EXCLUSIVE_AREA_0() SchM_Enter(SCHM_AREA_WDGM)
+#define SchM_Exit_WdgM_WDGM_EXCLUSIVE_AREA_0()  SchM_Exit(SCHM_AREA_WDGM)
+
+#define SchM_Enter_Can_CAN_EXCLUSIVE_AREA_0()    SchM_Enter(SCHM_AREA_CAN)
+#define SchM_Exit_Can_CAN_EXCLUSIVE_AREA_0()     SchM_Exit(SCHM_AREA_CAN)
+
+#define SchM_Enter_Os_OS_EXCLUSIVE_AREA_0()      SchM_Enter(SCHM_AREA_OS)
+#define SchM_Exit_Os_OS_EXCLUSIVE_AREA_0()       SchM_Exit(SCHM_AREA_OS)
+
+/* ---- Interrupt Masking (STM32 / unit test) ---- */
+#if !defined(PLATFORM_POSIX) || defined(UNIT_TEST)
+
+/** Interrupt-masked time since the last SchM_ResetIrqOffStats */
+typedef struct {
+    uint32  sections;   /**< Outermost enter/exit pairs                     */
+    uint32  cycles;     /**< Total core cycles with interrupts masked
+                             (SCHM_IRQ_OFF_MEASUREMENT builds, else 0)      */
+    uint32  maxCycles;  /**< Longest single section, cycles                 */
+} SchM_IrqOffStatsType;
 
 /**
  * @brief  Enter critical section (disable interrupts, nesting-safe)
@@ -60,31 +147,29 @@ void SchM_Exit_Exclusive(void);
 
 /**
  * @brief  Get current nesting depth (for testing/diagnostics)
- * @return Current nesting counter value
+ * @return Number of held sections that mask interrupts (PRIMASK or BASEPRI)
  */
 uint8 SchM_GetNestingDepth(void);
 
-/* All modules use the same underlying enter/exit */
-#define SchM_Enter_Com_COM_EXCLUSIVE_AREA_0()    SchM_Enter_Exclusive()
-#define SchM_Exit_Com_COM_EXCLUSIVE_AREA_0()     SchM_Exit_Exclusive()
-
-#define SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0()    SchM_Enter_Exclusive()
-#define SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0()     SchM_Exit_Exclusive()
-
-#define SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0()    SchM_Enter_Exclusive()
-#define SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0()     SchM_Exit_Exclusive()
-
-#define SchM_Enter_WdgM_WDGM_EXCLUSIVE_AREA_0() SchM_Enter_Exclusive()
-#define SchM_Exit_WdgM_WDGM_EXCLUSIVE_AREA_0()  SchM_Exit_Exclusive()
+/**
+ * @brief  Get the interrupt-masked time statistics
+ * @param  StatsPtr  Destination (ignored if NULL)
+ * @note   Cycle figures need the DWT cycle counter running (Os_Hw_Init).
+ */
+void SchM_GetIrqOffStats(SchM_IrqOffStatsType* StatsPtr);
 
-#define SchM_Enter_Can_CAN_EXCLUSIVE_AREA_0()    SchM_Enter_Exclusive()
-#define SchM_Exit_Can_CAN_EXCLUSIVE_AREA_0()     SchM_Exit_Exclusive()
+/**
+ * @brief  Clear the interrupt-masked time statistics
+ */
+void SchM_ResetIrqOffStats(void);
 
-#endif /* PLATFORM_POSIX && !UNIT_TEST */
+#endif /* !PLATFORM_POSIX || UNIT_TEST */
 
 /* ---- Test Helpers ---- */
 #if defined(UNIT_TEST)
 boolean SchM_Test_IsIrqDisabled(void);
+uint8   SchM_Test_GetBasePri(void);
+void    SchM_Test_AdvanceCycles(uint32 Cycles);
 #endif
 
 #endif /* SCHM_H */
@@ -0,0 +1,442 @@
+/**
+ * @file    StbM.c
+ * @brief   Synchronized Time-Base Manager implementation
+ * @date    2026-03-23
+ *
+ * @details The global time is a piecewise linear function of the local
+ *          clock N, from a reference point (refLocal, refGlobal):
+ *
+ *              d         = N - refLocal
+ *              Global(N) = refGlobal + d + d * ratePpb / 1e9
+ *                          + slew * min(d, slewDur) / slewDur
+ *
+ *          Every correction first moves the reference point to the current
+ *          local time (rebase), so the global time stays continuous. The
+ *          reference point is also moved before d gets large enough to lose
+ *          precision or wrap (StbM_MainFunction).
+ *
+ *          At a sync, the master's time G valid at local time L is carried
+ *          forward to now with the current rate, and compared with Global(N):
+ *          the difference is the offset. The rate is measured from the raw
+ *          (G, L) pairs, so it does not depend on the corrections applied.
+ *
+ * @safety_req SWR-BSW-045
+ * @traces_to  SYS-053, TSR-046
+ *
+ * @standard AUTOSAR_SWS_SynchronizedTimeBaseManager, ISO 26262 Part 6
+ * @copyright Taktflow Systems 2026
+ */
+#include "StbM.h"
+#include "SchM.h"
+#include "Det.h"
+#include "Bsw_Instance.h"
+
+#if defined(PLATFORM_POSIX) && !defined(UNIT_TEST)
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+/* ---- Constants ---- */
+
+#define STBM_PPB                1000000000LL
+#define STBM_REBASE_US          0x40000000uL    /**< Rebase before d gets this big */
+#define STBM_RATE_PLAUSIBLE_PPB 10000000LL      /**< 1 %: measurement discarded    */
+
+/* ---- Internal State (one set per BSW instance, see Bsw_Instance.h) ---- */
+
+typedef struct {
+    const StbM_ConfigType*  stbm_config;
+    StbM_TimeBaseStatusType stbm_status;
+
+    /* Global(N) reference point and corrections */
+    uint32              stbm_ref_local;
+    StbM_TimeStampType  stbm_ref_global;
+    sint32              stbm_rate_ppb;
+    sint32              stbm_slew_us;       /**< Offset still to be slewed   */
+    uint32              stbm_slew_dur_us;   /**< Time left to slew it in     */
+
+    /* Sync loss supervision */
+    uint32              stbm_last_sync_local;
+
+    /* Rate measurement window start (raw master time and ingress time) */
+    boolean             stbm_win_valid;
+    StbM_TimeStampType  stbm_win_global;
+    uint32              stbm_win_local;
+
+    StbM_SyncStatsType  stbm_stats;
+} StbM_ContextType;
+
+BSW_INSTANCE_STATE(StbM_ContextType, stbm_ctx);
+
+#define stbm_config             (BSW_INSTANCE(stbm_ctx).stbm_config)
+#define stbm_status             (BSW_INSTANCE(stbm_ctx).stbm_status)
+#define stbm_ref_local          (BSW_INSTANCE(stbm_ctx).stbm_ref_local)
+#define stbm_ref_global         (BSW_INSTANCE(stbm_ctx).stbm_ref_global)
+#define stbm_rate_ppb           (BSW_INSTANCE(stbm_ctx).stbm_rate_ppb)
+#define stbm_slew_us            (BSW_INSTANCE(stbm_ctx).stbm_slew_us)
+#define stbm_slew_dur_us        (BSW_INSTANCE(stbm_ctx).stbm_slew_dur_us)
+#define stbm_last_sync_local    (BSW_INSTANCE(stbm_ctx).stbm_last_sync_local)
+#define stbm_win_valid          (BSW_INSTANCE(stbm_ctx).stbm_win_valid)
+#define stbm_win_global         (BSW_INSTANCE(stbm_ctx).stbm_win_global)
+#define stbm_win_local          (BSW_INSTANCE(stbm_ctx).stbm_win_local)
+#define stbm_stats              (BSW_INSTANCE(stbm_ctx).stbm_stats)
+
+#if defined(PLATFORM_POSIX) && !defined(UNIT_TEST)
+static boolean stbm_report_registered = FALSE;
+#endif
+
+/* ---- Private Functions (call inside the exclusive area) ---- */
+
+/**
+ * @brief  Global time at local time Now (Now not before stbm_ref_local)
+ */
+static StbM_TimeStampType StbM_GlobalAt(uint32 Now)
+{
+    uint32 d    = Now - stbm_ref_local;
+    sint64 corr = ((sint64)d * (sint64)stbm_rate_ppb) / STBM_PPB;
+
+    if (stbm_slew_dur_us != 0u) {
+        uint32 elapsed = (d < stbm_slew_dur_us) ? d : stbm_slew_dur_us;
+
+        corr += ((sint64)stbm_slew_us * (sint64)elapsed) / (sint64)stbm_slew_dur_us;
+    }
+
+    return (StbM_TimeStampType)((sint64)stbm_ref_global + (sint64)d + corr);
+}
+
+/**
+ * @brief  Move the reference point to local time Now, keeping Global(N)
+ */
+static void StbM_Rebase(uint32 Now)
+{
+    uint32 d = Now - stbm_ref_local;
+
+    stbm_ref_global = StbM_GlobalAt(Now);
+
+    if (stbm_slew_dur_us != 0u) {
+        uint32 elapsed = (d < stbm_slew_dur_us) ? d : stbm_slew_dur_us;
+
+        stbm_slew_us -= (sint32)(((sint64)stbm_slew_us * (sint64)elapsed) /
+                                 (sint64)stbm_slew_dur_us);
+        stbm_slew_dur_us -= elapsed;
+        if (stbm_slew_dur_us == 0u) {
+            stbm_slew_us = 0;
+        }
+    }
+
+    stbm_ref_local = Now;
+}
+
+/**
+ * @brief  Take a new rate measurement from the master time G at local time L
+ */
+static void StbM_MeasureRate(StbM_TimeStampType G, uint32 L)
+{
+    uint32 dl;
+    sint64 ppb;
+    sint64 limit;
+
+    if (stbm_win_valid == FALSE) {
+        stbm_win_valid  = TRUE;
+        stbm_win_global = G;
+        stbm_win_local  = L;
+        return;
+    }
+
+    dl = L - stbm_win_local;
+    if (dl < stbm_config->rateMeasureUs) {
+        return;
+    }
+
+    ppb = (((sint64)(G - stbm_win_global) - (sint64)dl) * STBM_PPB) / (sint64)dl;
+    if ((ppb <= STBM_RATE_PLAUSIBLE_PPB) && (ppb >= -STBM_RATE_PLAUSIBLE_PPB)) {
+        limit = (sint64)stbm_config->maxRateDeviationPpm * 1000;
+        if (ppb > limit) {
+            ppb = limit;
+        } else if (ppb < -limit) {
+            ppb = -limit;
+        } else {
+            /* Within the limit */
+        }
+        stbm_rate_ppb = (sint32)ppb;
+        stbm_stats.rateCorrectionPpb = stbm_rate_ppb;
+    }
+
+    stbm_win_global = G;
+    stbm_win_local  = L;
+}
+
+/* ---- SIL precision report ---- */
+
+#if defined(PLATFORM_POSIX) && !defined(UNIT_TEST)
+static void StbM_PrintStats(void)
+{
+    uint8 saved = Bsw_GetInstance();
+    uint8 i;
+
+    for (i = 0u; i < (uint8)BSW_INSTANCE_COUNT; i++) {
+        (void)Bsw_SetInstance(i);
+        if ((stbm_config != NULL_PTR) && (stbm_config->role == STBM_ROLE_SLAVE)) {
+            (void)fprintf(stderr,
+                "[StbM] %lu syncs, %lu time leaps, precision %lu us "
+                "(last offset %ld us), rate correction %ld ppb\n",
+                (unsigned long)stbm_stats.syncs, (unsigned long)stbm_stats.jumps,
+                (unsigned long)stbm_stats.maxAbsOffsetUs, (long)stbm_stats.lastOffsetUs,
+                (long)stbm_stats.rateCorrectionPpb);
+        }
+    }
+    (void)Bsw_SetInstance(saved);
+}
+#endif
+
+/* ---- API Implementation ---- */
+
+void StbM_Init(const StbM_ConfigType* ConfigPtr)
+{
+    if ((ConfigPtr == NULL_PTR) || (ConfigPtr->getLocalTimeUs == NULL_PTR)) {
+        Det_ReportError(DET_MODULE_STBM, 0u, STBM_API_INIT, DET_E_PARAM_POINTER);
+        return;
+    }
+
+    /* Slew of less than 2x the offset could run the global time backwards */
+    if (((ConfigPtr->role != STBM_ROLE_MASTER) && (ConfigPtr->role != STBM_ROLE_SLAVE)) ||
+        ((ConfigPtr->offsetCorrectionUs != 0u) &&
+         (ConfigPtr->jumpThresholdUs > (ConfigPtr->offsetCorrectionUs / 2u))) ||
+        (ConfigPtr->maxRateDeviationPpm > STBM_MAX_RATE_DEVIATION_PPM)) {
+        Det_ReportError(DET_MODULE_STBM, 0u, STBM_API_INIT, DET_E_PARAM_VALUE);
+        return;
+    }
+
+    SchM_Enter(SCHM_AREA_STBM);
+
+    stbm_ref_local       = ConfigPtr->getLocalTimeUs();
+    stbm_ref_global      = 0u;
+    stbm_rate_ppb        = 0;
+    stbm_slew_us         = 0;
+    stbm_slew_dur_us     = 0u;
+    stbm_last_sync_local = stbm_ref_local;
+    stbm_win_valid       = FALSE;
+    stbm_win_global      = 0u;
+    stbm_win_local       = 0u;
+
+    stbm_stats.syncs             = 0u;
+    stbm_stats.jumps             = 0u;
+    stbm_stats.lastOffsetUs      = 0;
+    stbm_stats.maxAbsOffsetUs    = 0u;
+    stbm_stats.rateCorrectionPpb = 0;
+
+    /* The master's local clock is the global time */
+    stbm_status = (ConfigPtr->role == STBM_ROLE_MASTER) ? STBM_STATUS_GLOBAL_TIME_BASE : 0u;
+
+    stbm_config = ConfigPtr;
+
+    SchM_Exit(SCHM_AREA_STBM);
+
+#if defined(PLATFORM_POSIX) && !defined(UNIT_TEST)
+    if ((ConfigPtr->role == STBM_ROLE_SLAVE) && (stbm_report_registered == FALSE)) {
+        stbm_report_registered = TRUE;
+        (void)atexit(StbM_PrintStats);
+    }
+#endif
+}
+
+Std_ReturnType StbM_GetCurrentTime(StbM_TimeStampType* TimeStampPtr,
+                                   StbM_TimeBaseStatusType* StatusPtr)
+{
+    if (stbm_config == NULL_PTR) {
+        Det_ReportError(DET_MODULE_STBM, 0u, STBM_API_GET_CURRENT_TIME, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if ((TimeStampPtr == NULL_PTR) || (StatusPtr == NULL_PTR)) {
+        Det_ReportError(DET_MODULE_STBM, 0u, STBM_API_GET_CURRENT_TIME, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    SchM_Enter(SCHM_AREA_STBM);
+    *TimeStampPtr = StbM_GlobalAt(stbm_config->getLocalTimeUs());
+    *StatusPtr    = stbm_status;
+    SchM_Exit(SCHM_AREA_STBM);
+
+    return E_OK;
+}
+
+uint32 StbM_GetTimeUs(void)
+{
+    StbM_TimeStampType now;
+
+    if (stbm_config == NULL_PTR) {
+        return 0u;
+    }
+
+    SchM_Enter(SCHM_AREA_STBM);
+    now = StbM_GlobalAt(stbm_config->getLocalTimeUs());
+    SchM_Exit(SCHM_AREA_STBM);
+
+    return (uint32)now;
+}
+
+uint32 StbM_GetTimeMs(void)
+{
+    StbM_TimeStampType now;
+
+    if (stbm_config == NULL_PTR) {
+        return 0u;
+    }
+
+    SchM_Enter(SCHM_AREA_STBM);
+    now = StbM_GlobalAt(stbm_config->getLocalTimeUs());
+    SchM_Exit(SCHM_AREA_STBM);
+
+    return (uint32)(now / 1000u);
+}
+
+uint32 StbM_GetLocalTimeUs(void)
+{
+    if (stbm_config == NULL_PTR) {
+        return 0u;
+    }
+
+    return stbm_config->getLocalTimeUs();
+}
+
+StbM_TimeBaseStatusType StbM_GetTimeBaseStatus(void)
+{
+    if (stbm_config == NULL_PTR) {
+        return 0u;
+    }
+
+    return stbm_status;
+}
+
+Std_ReturnType StbM_BusSetGlobalTime(StbM_TimeStampType GlobalTime, uint32 LocalTimeUs)
+{
+    StbM_TimeStampType master = GlobalTime;
+    uint32  now;
+    uint32  age;
+    sint64  offset;
+    uint32  abs_offset;
+    boolean first;
+#if defined(PLATFORM_POSIX) && !defined(UNIT_TEST)
+    boolean report;
+#endif
+
+    if (stbm_config == NULL_PTR) {
+        Det_ReportError(DET_MODULE_STBM, 0u, STBM_API_BUS_SET_GLOBAL_TIME, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if (stbm_config->role != STBM_ROLE_SLAVE) {
+        Det_ReportError(DET_MODULE_STBM, 0u, STBM_API_BUS_SET_GLOBAL_TIME, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    SchM_Enter(SCHM_AREA_STBM);
+
+    now = stbm_config->getLocalTimeUs();
+    StbM_Rebase(now);
+
+    /* Master time carried forward from the ingress time to now */
+    age = now - LocalTimeUs;
+    if (age >= 0x80000000uL) {
+        age = 0u;                       /* Ingress time after now: not plausible */
+    }
+    GlobalTime += (StbM_TimeStampType)((sint64)age +
+                                       (((sint64)age * (sint64)stbm_rate_ppb) / STBM_PPB));
+
+    offset     = (sint64)GlobalTime - (sint64)stbm_ref_global;
+    abs_offset = (offset < 0) ? (uint32)(-offset) : (uint32)offset;
+    if ((offset > 0x7FFFFFFFLL) || (offset < -0x7FFFFFFFLL)) {
+        abs_offset = 0xFFFFFFFFuL;
+    }
+    first = ((stbm_status & STBM_STATUS_GLOBAL_TIME_BASE) == 0u) ? TRUE : FALSE;
+
+    stbm_status &= (StbM_TimeBaseStatusType)~(STBM_STATUS_TIMEOUT |
+                                              STBM_STATUS_TIMELEAP_FUTURE |
+                                              STBM_STATUS_TIMELEAP_PAST);
+
+    if ((first == TRUE) || (abs_offset >= stbm_config->jumpThresholdUs)) {
+        /* Time leap: take the master's time at once */
+        stbm_ref_global  = GlobalTime;
+        stbm_slew_us     = 0;
+        stbm_slew_dur_us = 0u;
+        stbm_win_valid   = FALSE;
+        stbm_stats.jumps++;
+        if (first == FALSE) {
+            stbm_status |= (offset > 0) ? STBM_STATUS_TIMELEAP_FUTURE : STBM_STATUS_TIMELEAP_PAST;
+        }
+    } else if (stbm_config->offsetCorrectionUs == 0u) {
+        stbm_ref_global = GlobalTime;
+    } else {
+        /* Small offset: slew it in, replacing what is left of the last one */
+        stbm_slew_us     = (sint32)offset;
+        stbm_slew_dur_us = stbm_config->offsetCorrectionUs;
+    }
+
+    if (stbm_config->rateMeasureUs != 0u) {
+        StbM_MeasureRate(master, LocalTimeUs);
+    }
+
+    stbm_stats.syncs++;
+    stbm_stats.lastOffsetUs = (offset > 0x7FFFFFFFLL)  ? 0x7FFFFFFF :
+                              (offset < -0x7FFFFFFFLL) ? -0x7FFFFFFF : (sint32)offset;
+    if ((first == FALSE) && (abs_offset > stbm_stats.maxAbsOffsetUs)) {
+        stbm_stats.maxAbsOffsetUs = abs_offset;
+    }
+
+    stbm_status |= STBM_STATUS_GLOBAL_TIME_BASE;
+    stbm_last_sync_local = now;
+
+#if defined(PLATFORM_POSIX) && !defined(UNIT_TEST)
+    report = first;
+#endif
+
+    SchM_Exit(SCHM_AREA_STBM);
+
+#if defined(PLATFORM_POSIX) && !defined(UNIT_TEST)
+    if (report == TRUE) {
+        (void)fprintf(stderr, "[StbM] Synchronized to the time master (offset %ld us)\n",
+                      (long)stbm_stats.lastOffsetUs);
+    }
+#endif
+
+    return E_OK;
+}
+
+void StbM_GetSyncStats(StbM_SyncStatsType* StatsPtr)
+{
+    if (StatsPtr == NULL_PTR) {
+        return;
+    }
+
+    SchM_Enter(SCHM_AREA_STBM);
+    *StatsPtr = stbm_stats;
+    SchM_Exit(SCHM_AREA_STBM);
+}
+
+void StbM_MainFunction(void)
+{
+    uint32 now;
+
+    if (stbm_config == NULL_PTR) {
+        return;
+    }
+
+    SchM_Enter(SCHM_AREA_STBM);
+
+    now = stbm_config->getLocalTimeUs();
+
+    if ((stbm_config->role == STBM_ROLE_SLAVE) &&
+        (stbm_config->syncLossTimeoutUs != 0u) &&
+        ((stbm_status & (STBM_STATUS_GLOBAL_TIME_BASE | STBM_STATUS_TIMEOUT)) ==
+         STBM_STATUS_GLOBAL_TIME_BASE) &&
+        ((now - stbm_last_sync_local) > stbm_config->syncLossTimeoutUs)) {
+        stbm_status |= STBM_STATUS_TIMEOUT;   /* Free-running on the last rate */
+    }
+
+    if ((now - stbm_ref_local) >= STBM_REBASE_US) {
+        StbM_Rebase(now);
+    }
+
+    SchM_Exit(SCHM_AREA_STBM);
+}
@@ -0,0 +1,150 @@
+/**
+ * @file    StbM.h
+ * @brief   Synchronized Time-Base Manager — global time shared by all ECUs
+ * @date    2026-03-23
+ *
+ * @details One time base (time domain 0) per ECU. The time master's global
+ *          time is its own local clock. A time slave gets the master's time
+ *          from CanTSyn (StbM_BusSetGlobalTime) and corrects its local
+ *          clock for offset and rate:
+ *          - Offsets of jumpThresholdUs and more (and the first sync) are
+ *            corrected at once (time leap).
+ *          - Smaller offsets are slewed over offsetCorrectionUs, so the
+ *            global time never runs backwards.
+ *          - The rate is measured between syncs rateMeasureUs apart and
+ *            applied within +/- maxRateDeviationPpm.
+ *
+ *          Global time is microseconds since StbM_Init of the master. It
+ *          is for correlating events across ECUs (freeze frames, Com RX
+ *          times); deadline and debounce supervision keep the local clock,
+ *          which never jumps.
+ *
+ * @safety_req SWR-BSW-045
+ * @traces_to  SYS-053, TSR-046
+ *
+ * @standard AUTOSAR_SWS_SynchronizedTimeBaseManager, ISO 26262 Part 6
+ * @copyright Taktflow Systems 2026
+ */
+#ifndef STBM_H
+#define STBM_H
+
+#include "Std_Types.h"
+
+/* ---- Constants ---- */
+
+/* Time base status bits (AUTOSAR StbM_TimeBaseStatusType) */
+#define STBM_STATUS_TIMEOUT           0x01u /**< No sync within syncLossTimeoutUs */
+#define STBM_STATUS_GLOBAL_TIME_BASE  0x08u /**< Synchronized (master: always)    */
+#define STBM_STATUS_TIMELEAP_FUTURE   0x10u /**< Last correction jumped forward   */
+#define STBM_STATUS_TIMELEAP_PAST     0x20u /**< Last correction jumped backward  */
+
+#define STBM_MAX_RATE_DEVIATION_PPM   10000u /**< Limit of maxRateDeviationPpm */
+
+/* ---- Types ---- */
+
+/** Global time in microseconds */
+typedef uint64 StbM_TimeStampType;
+
+typedef uint8 StbM_TimeBaseStatusType;
+
+/** Free-running local clock in microseconds (wraps at 2^32) */
+typedef uint32 (*StbM_LocalTimeFuncType)(void);
+
+typedef enum {
+    STBM_ROLE_MASTER = 0u,
+    STBM_ROLE_SLAVE  = 1u
+} StbM_RoleType;
+
+/** Time base configuration (the slave fields are ignored by a master) */
+typedef struct {
+    StbM_RoleType           role;
+    StbM_LocalTimeFuncType  getLocalTimeUs;      /**< Must not be NULL        */
+    uint32                  syncLossTimeoutUs;   /**< TIMEOUT after no sync for
+                                                      this long, 0: never     */
+    uint32                  jumpThresholdUs;     /**< Offsets from here on are
+                                                      corrected at once       */
+    uint32                  offsetCorrectionUs;  /**< Slew time of smaller
+                                                      offsets (0: at once);
+                                                      >= 2 * jumpThresholdUs  */
+    uint32                  rateMeasureUs;       /**< Rate measurement window,
+                                                      0: no rate correction   */
+    uint16                  maxRateDeviationPpm; /**< Rate correction limit   */
+} StbM_ConfigType;
+
+/** Synchronization accounting of a slave since StbM_Init */
+typedef struct {
+    uint32  syncs;              /**< Master times received                    */
+    uint32  jumps;              /**< Offsets corrected at once (incl. first)  */
+    sint32  lastOffsetUs;       /**< Master minus own global time at the last
+                                     sync                                     */
+    uint32  maxAbsOffsetUs;     /**< Largest |offset| at a sync after the
+                                     first: the precision achieved            */
+    sint32  rateCorrectionPpb;  /**< Applied rate correction                  */
+} StbM_SyncStatsType;
+
+/* ---- API Functions ---- */
+
+/**
+ * @brief  Initialize the time base: global time 0 now, not synchronized
+ *         (a master is synchronized at once)
+ * @param  ConfigPtr  Configuration (must not be NULL)
+ */
+void StbM_Init(const StbM_ConfigType* ConfigPtr);
+
+/**
+ * @brief  Get the current global time
+ * @param  TimeStampPtr  Output: global time (us)
+ * @param  StatusPtr     Output: STBM_STATUS_* bits
+ * @return E_OK, E_NOT_OK if not initialized or a NULL pointer
+ * @note   Before the first sync a slave returns its local time since
+ *         StbM_Init, without STBM_STATUS_GLOBAL_TIME_BASE.
+ */
+Std_ReturnType StbM_GetCurrentTime(StbM_TimeStampType* TimeStampPtr,
+                                   StbM_TimeBaseStatusType* StatusPtr);
+
+/**
+ * @brief  Global time in microseconds, low 32 bits (0 if not initialized)
+ * @note   Timestamp hook, e.g. Com_ConfigType.getRxTimeUs
+ */
+uint32 StbM_GetTimeUs(void);
+
+/**
+ * @brief  Global time in milliseconds, low 32 bits (0 if not initialized)
+ * @note   Timestamp hook, e.g. Dem_ConfigType.GetFreezeFrameTimeMs
+ */
+uint32 StbM_GetTimeMs(void);
+
+/**
+ * @brief  Local clock of the time base (for ingress timestamps)
+ * @return Microseconds of getLocalTimeUs, 0 if not initialized
+ */
+uint32 StbM_GetLocalTimeUs(void);
+
+/**
+ * @brief  Status of the time base
+ * @return STBM_STATUS_* bits, 0 if not initialized
+ */
+StbM_TimeBaseStatusType StbM_GetTimeBaseStatus(void);
+
+/**
+ * @brief  Set the master's time as received by a time slave (CanTSyn)
+ * @param  GlobalTime   Master's global time (us) at LocalTimeUs
+ * @param  LocalTimeUs  Local clock when the time was valid (ingress time
+ *                      of the SYNC message)
+ * @return E_OK, E_NOT_OK if not initialized or not a slave
+ */
+Std_ReturnType StbM_BusSetGlobalTime(StbM_TimeStampType GlobalTime, uint32 LocalTimeUs);
+
+/**
+ * @brief  Get the synchronization accounting
+ * @param  StatsPtr  Destination (ignored if NULL)
+ */
+void StbM_GetSyncStats(StbM_SyncStatsType* StatsPtr);
+
+/**
+ * @brief  Sync loss supervision and local clock wrap handling
+ * @note   Call at least once per hour of local clock (e.g. every 10 ms).
+ */
+void StbM_MainFunction(void);
+
+#endif /* STBM_H */
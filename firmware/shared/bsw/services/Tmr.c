@@ -0,0 +1,408 @@
+/**
+ * @file    Tmr.c
+ * @brief   Timer service implementation — hierarchical timer wheel
+ * @date    2026-03-22
+ *
+ * @details Running timers hang in doubly linked lists (timer indices), one
+ *          per wheel slot. Level L has 64 slots of 64^L ticks: a timer due
+ *          in d ticks goes to the lowest level whose slots still resolve d,
+ *          at the slot of its absolute expiry tick. Start and cancel only
+ *          link or unlink one timer.
+ *
+ *          Per tick, the level-0 slot of the new time is due. When the
+ *          level-0 index wraps to 0, the current slot of level 1 is
+ *          cascaded (its timers are re-linked, now landing on level 0),
+ *          and so on up while the index of a level wraps too (Varghese and
+ *          Lauck, scheme 7). A timer is cascaded at most once per level.
+ *
+ *          Due timers move to an expired list; the callbacks are then run
+ *          one by one outside the exclusive area, so a callback may start
+ *          or cancel any timer. A periodic timer is re-linked before its
+ *          callback, from its previous expiry (no drift).
+ *
+ *          The Gpt channel runs only while a timer runs: it is started by
+ *          the first Tmr_Start and stopped by the tick that finds no timer.
+ *
+ * @safety_req SWR-BSW-044
+ * @traces_to  SYS-053, TSR-046
+ *
+ * @standard AUTOSAR_SWS_GPTDriver (GptNotification), ISO 26262 Part 6
+ * @copyright Taktflow Systems 2026
+ */
+#include "Tmr.h"
+#include "Gpt.h"
+#include "SchM.h"
+#include "Det.h"
+
+/* ---- Constants ---- */
+
+#define TMR_SLOTS           (1u << TMR_WHEEL_BITS)
+#define TMR_SLOT_MASK       (TMR_SLOTS - 1u)
+#define TMR_LIST_EXPIRED    (TMR_WHEEL_LEVELS * TMR_SLOTS)  /**< Due, callback pending */
+#define TMR_LIST_COUNT      (TMR_LIST_EXPIRED + 1u)
+#define TMR_LIST_NONE       0xFFFFu                         /**< Timer stopped */
+#define TMR_NONE            0xFFu                           /**< End of list   */
+
+typedef char tmr_max_timers_check[(TMR_MAX_TIMERS < TMR_NONE) ? 1 : -1];
+typedef char tmr_list_count_check[(TMR_LIST_COUNT < TMR_LIST_NONE) ? 1 : -1];
+
+/* ---- Internal Types ---- */
+
+typedef struct {
+    uint32  expires;    /**< Absolute tick of the next expiry    */
+    uint32  period;     /**< Ticks between expiries, 0: one-shot */
+    uint16  list;       /**< Slot or expired list, or TMR_LIST_NONE */
+    uint8   next;
+    uint8   prev;
+} Tmr_TimerType;
+
+/* ---- Internal State ---- */
+
+static const Tmr_ConfigType* tmr_config = NULL_PTR;
+
+static Tmr_TimerType tmr_timers[TMR_MAX_TIMERS];
+static uint8         tmr_head[TMR_LIST_COUNT];
+
+static uint32  tmr_now;             /**< Ticks processed                  */
+static uint32  tmr_pending;         /**< Ticks counted, not yet processed */
+static uint8   tmr_active;          /**< Running timers                   */
+static boolean tmr_gpt_running;
+
+/* ---- Private Functions (call inside the exclusive area) ---- */
+
+static void Tmr_Link(uint8 Id, uint16 List)
+{
+    Tmr_TimerType* t = &tmr_timers[Id];
+
+    t->list = List;
+    t->prev = TMR_NONE;
+    t->next = tmr_head[List];
+    if (t->next != TMR_NONE) {
+        tmr_timers[t->next].prev = Id;
+    }
+    tmr_head[List] = Id;
+}
+
+static void Tmr_Unlink(uint8 Id)
+{
+    Tmr_TimerType* t = &tmr_timers[Id];
+
+    if (t->prev != TMR_NONE) {
+        tmr_timers[t->prev].next = t->next;
+    } else {
+        tmr_head[t->list] = t->next;
+    }
+    if (t->next != TMR_NONE) {
+        tmr_timers[t->next].prev = t->prev;
+    }
+    t->list = TMR_LIST_NONE;
+}
+
+/**
+ * @brief  Wheel slot of a timer expiring at tick Expires (1..TMR_MAX_TICKS
+ *         after now, or now itself while cascading)
+ */
+static uint16 Tmr_SlotOf(uint32 Expires)
+{
+    uint32 delta = Expires - tmr_now;
+    uint8  level = 0u;
+
+    while ((level < (TMR_WHEEL_LEVELS - 1u)) &&
+           (delta >= (1uL << (TMR_WHEEL_BITS * (level + 1u))))) {
+        level++;
+    }
+
+    return (uint16)((level * TMR_SLOTS) +
+                    ((Expires >> (TMR_WHEEL_BITS * level)) & TMR_SLOT_MASK));
+}
+
+/**
+ * @brief  Re-link the timers of the current slot of a level
+ * @return Index of that slot (0: the next level is due as well)
+ */
+static uint32 Tmr_Cascade(uint8 Level)
+{
+    uint32 slot = (tmr_now >> (TMR_WHEEL_BITS * Level)) & TMR_SLOT_MASK;
+    uint16 list = (uint16)((Level * TMR_SLOTS) + slot);
+    uint8  id   = tmr_head[list];
+
+    tmr_head[list] = TMR_NONE;
+    while (id != TMR_NONE) {
+        uint8 next = tmr_timers[id].next;
+
+        Tmr_Link(id, Tmr_SlotOf(tmr_timers[id].expires));
+        id = next;
+    }
+
+    return slot;
+}
+
+/**
+ * @brief  Advance one tick and move the due timers to the expired list
+ */
+static void Tmr_Advance(void)
+{
+    uint16 list;
+    uint8  id;
+
+    tmr_now++;
+
+    if ((tmr_now & TMR_SLOT_MASK) == 0u) {
+        for (uint8 level = 1u; level < TMR_WHEEL_LEVELS; level++) {
+            if (Tmr_Cascade(level) != 0u) {
+                break;
+            }
+        }
+    }
+
+    list = (uint16)(tmr_now & TMR_SLOT_MASK);
+    id   = tmr_head[list];
+    tmr_head[list] = TMR_NONE;
+    while (id != TMR_NONE) {
+        uint8 next = tmr_timers[id].next;
+
+        Tmr_Link(id, TMR_LIST_EXPIRED);
+        id = next;
+    }
+}
+
+/* ---- Private Functions ---- */
+
+/**
+ * @brief  Process one tick: advance, run the due callbacks, stop the Gpt
+ *         channel if no timer is left
+ * @return FALSE if TMR_DISPATCH_TASK and no tick was pending (nothing done)
+ */
+static boolean Tmr_ProcessTick(void)
+{
+    SchM_Enter(SCHM_AREA_TMR);
+    if (tmr_config->dispatch == TMR_DISPATCH_TASK) {
+        if (tmr_pending == 0u) {
+            SchM_Exit(SCHM_AREA_TMR);
+            return FALSE;
+        }
+        tmr_pending--;                  /* now + pending stays the same */
+    }
+    Tmr_Advance();
+    SchM_Exit(SCHM_AREA_TMR);
+
+    for (;;) {
+        uint8 id;
+
+        SchM_Enter(SCHM_AREA_TMR);
+        id = tmr_head[TMR_LIST_EXPIRED];
+        if (id == TMR_NONE) {
+            break;                      /* Left with the area held */
+        }
+        Tmr_Unlink(id);
+        if (tmr_timers[id].period != 0u) {
+            tmr_timers[id].expires += tmr_timers[id].period;
+            Tmr_Link(id, Tmr_SlotOf(tmr_timers[id].expires));
+        } else {
+            tmr_active--;
+        }
+        SchM_Exit(SCHM_AREA_TMR);
+
+        tmr_config->timers[id].callback(id);
+    }
+
+    if ((tmr_active == 0u) && (tmr_gpt_running == TRUE)) {
+        (void)Gpt_StopTimer(tmr_config->gptChannel);
+        tmr_gpt_running = FALSE;
+        tmr_pending = 0u;
+    }
+    SchM_Exit(SCHM_AREA_TMR);
+
+    return TRUE;
+}
+
+/**
+ * @brief  Microseconds to ticks, rounded up
+ */
+static uint32 Tmr_UsToTicks(uint32 Us)
+{
+    return (Us / tmr_config->tickUs) + (((Us % tmr_config->tickUs) != 0u) ? 1u : 0u);
+}
+
+/* ---- API Implementation ---- */
+
+void Tmr_Init(const Tmr_ConfigType* ConfigPtr)
+{
+    uint16 i;
+
+    if ((ConfigPtr == NULL_PTR) || (ConfigPtr->timers == NULL_PTR)) {
+        Det_ReportError(DET_MODULE_TMR, 0u, TMR_API_INIT, DET_E_PARAM_POINTER);
+        return;
+    }
+
+    if ((ConfigPtr->timerCount > TMR_MAX_TIMERS) || (ConfigPtr->tickUs == 0u) ||
+        ((ConfigPtr->dispatch != TMR_DISPATCH_ISR) &&
+         (ConfigPtr->dispatch != TMR_DISPATCH_TASK))) {
+        Det_ReportError(DET_MODULE_TMR, 0u, TMR_API_INIT, DET_E_PARAM_VALUE);
+        return;
+    }
+
+    for (i = 0u; i < ConfigPtr->timerCount; i++) {
+        if (ConfigPtr->timers[i].callback == NULL_PTR) {
+            Det_ReportError(DET_MODULE_TMR, 0u, TMR_API_INIT, DET_E_PARAM_POINTER);
+            return;
+        }
+    }
+
+    if ((tmr_config != NULL_PTR) && (tmr_gpt_running == TRUE)) {
+        (void)Gpt_StopTimer(tmr_config->gptChannel);
+    }
+    tmr_config = NULL_PTR;
+
+    if (Gpt_EnableNotification(ConfigPtr->gptChannel) != E_OK) {
+        Det_ReportError(DET_MODULE_TMR, 0u, TMR_API_INIT, DET_E_PARAM_VALUE);
+        return;
+    }
+
+    for (i = 0u; i < TMR_LIST_COUNT; i++) {
+        tmr_head[i] = TMR_NONE;
+    }
+    for (i = 0u; i < TMR_MAX_TIMERS; i++) {
+        tmr_timers[i].list = TMR_LIST_NONE;
+    }
+    tmr_now         = 0u;
+    tmr_pending     = 0u;
+    tmr_active      = 0u;
+    tmr_gpt_running = FALSE;
+
+    tmr_config = ConfigPtr;
+}
+
+Std_ReturnType Tmr_Start(Tmr_TimerIdType TimerId, uint32 DelayUs, uint32 PeriodUs)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 delay;
+    uint32 period;
+
+    if (tmr_config == NULL_PTR) {
+        Det_ReportError(DET_MODULE_TMR, 0u, TMR_API_START, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if (TimerId >= tmr_config->timerCount) {
+        Det_ReportError(DET_MODULE_TMR, 0u, TMR_API_START, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    delay  = Tmr_UsToTicks(DelayUs);
+    period = Tmr_UsToTicks(PeriodUs);
+    if ((delay == 0u) || (delay > TMR_MAX_TICKS) || (period > TMR_MAX_TICKS)) {
+        Det_ReportError(DET_MODULE_TMR, 0u, TMR_API_START, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    SchM_Enter(SCHM_AREA_TMR);
+
+    if (tmr_gpt_running == FALSE) {
+        /* First timer: the wheel starts at the next tick, in phase */
+        if (Gpt_StartTimer(tmr_config->gptChannel, tmr_config->tickUs) == E_OK) {
+            tmr_gpt_running = TRUE;
+        } else {
+            ret = E_NOT_OK;
+        }
+    } else {
+        delay++;                        /* The tick in progress is partial */
+    }
+
+    if (ret == E_OK) {
+        if (tmr_timers[TimerId].list != TMR_LIST_NONE) {
+            Tmr_Unlink(TimerId);        /* Restart */
+        } else {
+            tmr_active++;
+        }
+        tmr_timers[TimerId].expires = tmr_now + tmr_pending + delay;
+        tmr_timers[TimerId].period  = period;
+        Tmr_Link(TimerId, Tmr_SlotOf(tmr_timers[TimerId].expires));
+    }
+
+    SchM_Exit(SCHM_AREA_TMR);
+    return ret;
+}
+
+Std_ReturnType Tmr_Cancel(Tmr_TimerIdType TimerId)
+{
+    if (tmr_config == NULL_PTR) {
+        Det_ReportError(DET_MODULE_TMR, 0u, TMR_API_CANCEL, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if (TimerId >= tmr_config->timerCount) {
+        Det_ReportError(DET_MODULE_TMR, 0u, TMR_API_CANCEL, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    /* The Gpt channel is stopped by the next tick if no timer is left */
+    SchM_Enter(SCHM_AREA_TMR);
+    if (tmr_timers[TimerId].list != TMR_LIST_NONE) {
+        Tmr_Unlink(TimerId);
+        tmr_active--;
+    }
+    SchM_Exit(SCHM_AREA_TMR);
+
+    return E_OK;
+}
+
+boolean Tmr_IsRunning(Tmr_TimerIdType TimerId)
+{
+    if ((tmr_config == NULL_PTR) || (TimerId >= tmr_config->timerCount)) {
+        return FALSE;
+    }
+
+    return (tmr_timers[TimerId].list != TMR_LIST_NONE) ? TRUE : FALSE;
+}
+
+uint32 Tmr_GetRemainingUs(Tmr_TimerIdType TimerId)
+{
+    uint32 remaining = 0u;
+
+    if (tmr_config == NULL_PTR) {
+        Det_ReportError(DET_MODULE_TMR, 0u, TMR_API_GET_REMAINING, DET_E_UNINIT);
+        return 0u;
+    }
+
+    if (TimerId >= tmr_config->timerCount) {
+        Det_ReportError(DET_MODULE_TMR, 0u, TMR_API_GET_REMAINING, DET_E_PARAM_VALUE);
+        return 0u;
+    }
+
+    SchM_Enter(SCHM_AREA_TMR);
+    if ((tmr_timers[TimerId].list != TMR_LIST_NONE) &&
+        (tmr_timers[TimerId].list != TMR_LIST_EXPIRED)) {
+        remaining = (tmr_timers[TimerId].expires - (tmr_now + tmr_pending)) *
+                    tmr_config->tickUs;
+    }
+    SchM_Exit(SCHM_AREA_TMR);
+
+    return remaining;
+}
+
+void Tmr_Tick(void)
+{
+    if (tmr_config == NULL_PTR) {
+        return;
+    }
+
+    if (tmr_config->dispatch == TMR_DISPATCH_ISR) {
+        (void)Tmr_ProcessTick();
+    } else {
+        SchM_Enter(SCHM_AREA_TMR);
+        tmr_pending++;
+        SchM_Exit(SCHM_AREA_TMR);
+    }
+}
+
+void Tmr_MainFunction(void)
+{
+    if ((tmr_config == NULL_PTR) || (tmr_config->dispatch != TMR_DISPATCH_TASK)) {
+        return;
+    }
+
+    while (Tmr_ProcessTick() == TRUE) {
+        /* One counted tick per pass */
+    }
+}
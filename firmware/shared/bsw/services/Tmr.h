@@ -0,0 +1,124 @@
+/**
+ * @file    Tmr.h
+ * @brief   Timer service — one-shot and periodic expiry callbacks on a
+ *          Gpt-driven hierarchical timer wheel
+ * @date    2026-03-22
+ *
+ * @details Replaces per-module timeout counters decremented in 10 ms main
+ *          functions. A module starts a configured timer with a delay in
+ *          microseconds and gets its callback when it expires. Start and
+ *          cancel are O(1); a timer costs nothing while it is not running,
+ *          and with no timer running the Gpt channel is stopped.
+ *
+ *          The wheel advances one tick per expiry of its Gpt channel
+ *          (continuous, counting microseconds, notification = Tmr_Tick).
+ *          Callbacks run in the timer interrupt (TMR_DISPATCH_ISR) or in
+ *          Tmr_MainFunction, called from a high-priority task
+ *          (TMR_DISPATCH_TASK).
+ *
+ * @safety_req SWR-BSW-044
+ * @traces_to  SYS-053, TSR-046
+ *
+ * @standard AUTOSAR_SWS_GPTDriver (GptNotification), ISO 26262 Part 6
+ * @copyright Taktflow Systems 2026
+ */
+#ifndef TMR_H
+#define TMR_H
+
+#include "Std_Types.h"
+
+/* ---- Constants ---- */
+
+#define TMR_MAX_TIMERS      32u     /**< Max configured timers             */
+
+#define TMR_WHEEL_BITS      6u      /**< 64 slots per level                */
+#define TMR_WHEEL_LEVELS    4u      /**< 64^4 ticks = 2^24 range           */
+
+/** Longest delay or period, in ticks (e.g. 27 min at 100 us per tick) */
+#define TMR_MAX_TICKS       ((1uL << (TMR_WHEEL_BITS * TMR_WHEEL_LEVELS)) - 1uL)
+
+/* ---- Types ---- */
+
+typedef uint8 Tmr_TimerIdType;
+
+/** Expiry callback; may start or cancel any timer, including its own */
+typedef void (*Tmr_CallbackType)(Tmr_TimerIdType TimerId);
+
+/** Where expiry callbacks run */
+typedef enum {
+    TMR_DISPATCH_ISR  = 0u,     /**< In Tmr_Tick (timer interrupt)         */
+    TMR_DISPATCH_TASK = 1u      /**< In Tmr_MainFunction                   */
+} Tmr_DispatchType;
+
+/** Timer configuration */
+typedef struct {
+    Tmr_CallbackType callback;  /**< Must not be NULL                      */
+} Tmr_TimerConfigType;
+
+/** Timer service configuration */
+typedef struct {
+    uint8                       gptChannel; /**< Continuous, notification
+                                                 Tmr_Tick, microsecond
+                                                 counting                 */
+    uint32                      tickUs;     /**< Wheel resolution (> 0)    */
+    Tmr_DispatchType            dispatch;
+    uint8                       timerCount; /**< <= TMR_MAX_TIMERS         */
+    const Tmr_TimerConfigType*  timers;     /**< Indexed by Tmr_TimerIdType */
+} Tmr_ConfigType;
+
+/* ---- API Functions ---- */
+
+/**
+ * @brief  Initialize the timer service, all timers stopped
+ * @param  ConfigPtr  Configuration (must not be NULL)
+ * @note   Call after Gpt_Init.
+ */
+void Tmr_Init(const Tmr_ConfigType* ConfigPtr);
+
+/**
+ * @brief  Start (or restart) a timer
+ * @param  TimerId   Configured timer
+ * @param  DelayUs   Time to the first expiry (> 0)
+ * @param  PeriodUs  Time between later expiries, 0 for a one-shot timer
+ * @return E_OK, or E_NOT_OK if not initialized, invalid timer or a time
+ *         of 0 or above TMR_MAX_TICKS ticks (timer unchanged)
+ * @note   Times are rounded up to whole ticks. The first expiry comes no
+ *         earlier than DelayUs after the call and less than two ticks later
+ *         (the tick in progress is not counted); later ones PeriodUs apart.
+ */
+Std_ReturnType Tmr_Start(Tmr_TimerIdType TimerId, uint32 DelayUs, uint32 PeriodUs);
+
+/**
+ * @brief  Stop a timer (no effect if it is not running)
+ * @param  TimerId  Configured timer
+ * @return E_OK, or E_NOT_OK if not initialized or invalid timer
+ */
+Std_ReturnType Tmr_Cancel(Tmr_TimerIdType TimerId);
+
+/**
+ * @brief  Check whether a timer is running
+ * @param  TimerId  Configured timer
+ * @return TRUE if started and not yet expired (one-shot) or cancelled
+ */
+boolean Tmr_IsRunning(Tmr_TimerIdType TimerId);
+
+/**
+ * @brief  Get the time to the next expiry of a timer
+ * @param  TimerId  Configured timer
+ * @return Microseconds (multiple of tickUs), 0 if the timer is not running
+ */
+uint32 Tmr_GetRemainingUs(Tmr_TimerIdType TimerId);
+
+/**
+ * @brief  Advance the wheel by one tick — Gpt notification of the channel
+ * @note   TMR_DISPATCH_ISR: runs the expired callbacks. TMR_DISPATCH_TASK:
+ *         only counts the tick for Tmr_MainFunction.
+ */
+void Tmr_Tick(void);
+
+/**
+ * @brief  Process the ticks counted by Tmr_Tick (TMR_DISPATCH_TASK only)
+ */
+void Tmr_MainFunction(void);
+
+#endif /* TMR_H */
@@ -12,24 +12,229 @@
 #include "WdgM.h"
 #include "SchM.h"
 #include "Det.h"
+#include "Bsw_Instance.h"
 
-/* ---- Internal State ---- */
+/* ---- Internal State (one set per BSW instance, see Bsw_Instance.h) ---- */
 
 typedef struct {
     uint16                  aliveCounter;
     WdgM_LocalStatusType    localStatus;
     uint8                   failedCycleCount;
+    WdgM_CheckpointIdType   lastCheckpoint; /**< Logical: NONE outside graph */
+    boolean                 logical;        /**< Has transitions */
+    boolean                 violated;       /**< Deadline/logical this cycle */
 } WdgM_SeStateType;
 
-static const WdgM_ConfigType*  wdgm_config = NULL_PTR;
-static WdgM_SeStateType        wdgm_se_state[WDGM_MAX_SE];
-static boolean                 wdgm_initialized = FALSE;
-static WdgM_GlobalStatusType   wdgm_global_status = WDGM_GLOBAL_STATUS_FAILED;
+typedef struct {
+    const WdgM_ConfigType*  wdgm_config;
+    WdgM_SeStateType        wdgm_se_state[WDGM_MAX_SE];
+    boolean                 wdgm_initialized;
+    WdgM_GlobalStatusType   wdgm_global_status;   /**< FAILED until Init */
+
+    uint32                  wdgm_deadline_start[WDGM_MAX_DEADLINES];
+    boolean                 wdgm_deadline_armed[WDGM_MAX_DEADLINES];
+
+    WdgM_ViolationType      wdgm_violation_log[WDGM_VIOLATION_LOG];
+    uint8                   wdgm_violation_next;   /**< Next slot */
+    uint16                  wdgm_violation_count;
+} WdgM_ContextType;
+
+BSW_INSTANCE_STATE(WdgM_ContextType, wdgm_ctx);
+
+#define wdgm_config          (BSW_INSTANCE(wdgm_ctx).wdgm_config)
+#define wdgm_se_state        (BSW_INSTANCE(wdgm_ctx).wdgm_se_state)
+#define wdgm_initialized     (BSW_INSTANCE(wdgm_ctx).wdgm_initialized)
+#define wdgm_global_status   (BSW_INSTANCE(wdgm_ctx).wdgm_global_status)
+#define wdgm_deadline_start  (BSW_INSTANCE(wdgm_ctx).wdgm_deadline_start)
+#define wdgm_deadline_armed  (BSW_INSTANCE(wdgm_ctx).wdgm_deadline_armed)
+#define wdgm_violation_log   (BSW_INSTANCE(wdgm_ctx).wdgm_violation_log)
+#define wdgm_violation_next  (BSW_INSTANCE(wdgm_ctx).wdgm_violation_next)
+#define wdgm_violation_count (BSW_INSTANCE(wdgm_ctx).wdgm_violation_count)
 
 /* Dem event ID for watchdog expiry */
 #define DEM_EVENT_WDGM_EXPIRED  15u
 #define DEM_EVENT_STATUS_FAILED_VAL 1u
 
+/* ---- Private Functions ---- */
+
+static Std_ReturnType WdgM_CheckConfig(const WdgM_ConfigType* ConfigPtr)
+{
+    uint8 i;
+
+    if (((ConfigPtr->deadlineCount > 0u) && (ConfigPtr->deadlineConfig == NULL_PTR)) ||
+        ((ConfigPtr->transitionCount > 0u) && (ConfigPtr->transitionConfig == NULL_PTR))) {
+        Det_ReportError(DET_MODULE_WDGM, 0u, WDGM_API_INIT, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    if ((ConfigPtr->seCount > WDGM_MAX_SE) ||
+        (ConfigPtr->deadlineCount > WDGM_MAX_DEADLINES)) {
+        Det_ReportError(DET_MODULE_WDGM, 0u, WDGM_API_INIT, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    for (i = 0u; i < ConfigPtr->deadlineCount; i++) {
+        const WdgM_DeadlineConfigType* d = &ConfigPtr->deadlineConfig[i];
+
+        if ((d->SEId >= ConfigPtr->seCount) || (d->MinUs > d->MaxUs)) {
+            Det_ReportError(DET_MODULE_WDGM, 0u, WDGM_API_INIT, DET_E_PARAM_VALUE);
+            return E_NOT_OK;
+        }
+    }
+
+    for (i = 0u; i < ConfigPtr->transitionCount; i++) {
+        if (ConfigPtr->transitionConfig[i].SEId >= ConfigPtr->seCount) {
+            Det_ReportError(DET_MODULE_WDGM, 0u, WDGM_API_INIT, DET_E_PARAM_VALUE);
+            return E_NOT_OK;
+        }
+    }
+
+    return E_OK;
+}
+
+static uint32 WdgM_Now(void)
+{
+    return (wdgm_config->getTimestampUs != NULL_PTR) ? wdgm_config->getTimestampUs() : 0u;
+}
+
+/**
+ * @brief  Log a violation (caller holds the WdgM area)
+ */
+static void WdgM_LogViolation(WdgM_SupervisedEntityIdType SEId,
+                              WdgM_ViolationKindType Kind,
+                              WdgM_CheckpointIdType Checkpoint,
+                              uint32 Value, uint32 Now)
+{
+    WdgM_ViolationType* v = &wdgm_violation_log[wdgm_violation_next];
+
+    v->timestampUs = Now;
+    v->value       = Value;
+    v->SEId        = SEId;
+    v->kind        = Kind;
+    v->checkpoint  = Checkpoint;
+
+    wdgm_violation_next = (uint8)((wdgm_violation_next + 1u) % WDGM_VIOLATION_LOG);
+    if (wdgm_violation_count < 0xFFFFu) {
+        wdgm_violation_count++;
+    }
+}
+
+static boolean WdgM_IsTransition(WdgM_SupervisedEntityIdType SEId,
+                                 WdgM_CheckpointIdType From,
+                                 WdgM_CheckpointIdType To)
+{
+    uint8 i;
+
+    for (i = 0u; i < wdgm_config->transitionCount; i++) {
+        const WdgM_TransitionConfigType* t = &wdgm_config->transitionConfig[i];
+
+        if ((t->SEId == SEId) && (t->From == From) && (t->To == To)) {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief  Logical supervision of a reported checkpoint (caller holds the area)
+ * @note   After a violation the graph continues from the reached checkpoint,
+ *         so one wrong step is one violation.
+ */
+static void WdgM_CheckLogical(WdgM_SupervisedEntityIdType SEId,
+                              WdgM_CheckpointIdType Checkpoint, uint32 Now)
+{
+    WdgM_SeStateType* se = &wdgm_se_state[SEId];
+
+    if (se->logical == FALSE) {
+        return;
+    }
+
+    if (WdgM_IsTransition(SEId, se->lastCheckpoint, Checkpoint) == FALSE) {
+        WdgM_LogViolation(SEId, WDGM_VIOLATION_LOGICAL, Checkpoint,
+                          se->lastCheckpoint, Now);
+        se->violated = TRUE;
+    }
+
+    se->lastCheckpoint =
+        (WdgM_IsTransition(SEId, Checkpoint, WDGM_CHECKPOINT_NONE) == TRUE) ?
+        WDGM_CHECKPOINT_NONE : Checkpoint;
+}
+
+/**
+ * @brief  Deadline supervision of a reported checkpoint (caller holds the area)
+ * @note   The end is checked before the start, so StartCp == EndCp
+ *         supervises the period of one checkpoint.
+ */
+static void WdgM_CheckDeadlines(WdgM_SupervisedEntityIdType SEId,
+                                WdgM_CheckpointIdType Checkpoint, uint32 Now)
+{
+    uint8 i;
+
+    for (i = 0u; i < wdgm_config->deadlineCount; i++) {
+        const WdgM_DeadlineConfigType* d = &wdgm_config->deadlineConfig[i];
+
+        if (d->SEId != SEId) {
+            continue;
+        }
+
+        if ((Checkpoint == d->EndCp) && (wdgm_deadline_armed[i] == TRUE)) {
+            uint32 elapsed = Now - wdgm_deadline_start[i];
+
+            wdgm_deadline_armed[i] = FALSE;
+            if ((elapsed < d->MinUs) || (elapsed > d->MaxUs)) {
+                WdgM_LogViolation(SEId, WDGM_VIOLATION_DEADLINE, Checkpoint,
+                                  elapsed, Now);
+                wdgm_se_state[SEId].violated = TRUE;
+            }
+        }
+
+        if (Checkpoint == d->StartCp) {
+            wdgm_deadline_start[i] = Now;
+            wdgm_deadline_armed[i] = TRUE;
+        }
+    }
+}
+
+/**
+ * @brief  Flag the started deadlines of an entity whose end is overdue
+ *         (caller holds the area)
+ */
+static void WdgM_CheckOverdue(WdgM_SupervisedEntityIdType SEId, uint32 Now)
+{
+    uint8 i;
+
+    for (i = 0u; i < wdgm_config->deadlineCount; i++) {
+        const WdgM_DeadlineConfigType* d = &wdgm_config->deadlineConfig[i];
+
+        if ((d->SEId == SEId) && (wdgm_deadline_armed[i] == TRUE) &&
+            ((Now - wdgm_deadline_start[i]) > d->MaxUs)) {
+            wdgm_deadline_armed[i] = FALSE;
+            WdgM_LogViolation(SEId, WDGM_VIOLATION_DEADLINE, d->EndCp,
+                              Now - wdgm_deadline_start[i], Now);
+            wdgm_se_state[SEId].violated = TRUE;
+        }
+    }
+}
+
+/**
+ * @brief  Restart deadline and logical supervision of an entity
+ *         (caller holds the area)
+ */
+static void WdgM_ResetSupervision(WdgM_SupervisedEntityIdType SEId)
+{
+    uint8 i;
+
+    wdgm_se_state[SEId].lastCheckpoint = WDGM_CHECKPOINT_NONE;
+    wdgm_se_state[SEId].violated       = FALSE;
+
+    for (i = 0u; i < wdgm_config->deadlineCount; i++) {
+        if (wdgm_config->deadlineConfig[i].SEId == SEId) {
+            wdgm_deadline_armed[i] = FALSE;
+        }
+    }
+}
+
 /* ---- API Implementation ---- */
 
 void WdgM_Init(const WdgM_ConfigType* ConfigPtr)
@@ -43,14 +248,35 @@ void WdgM_Init(const WdgM_ConfigType* ConfigPtr)
         return;
     }
 
+    if (WdgM_CheckConfig(ConfigPtr) != E_OK) {
+        wdgm_initialized = FALSE;
+        wdgm_global_status = WDGM_GLOBAL_STATUS_FAILED;
+        return;
+    }
+
     wdgm_config = ConfigPtr;
 
     for (i = 0u; i < WDGM_MAX_SE; i++) {
         wdgm_se_state[i].aliveCounter    = 0u;
         wdgm_se_state[i].localStatus     = WDGM_LOCAL_STATUS_OK;
         wdgm_se_state[i].failedCycleCount = 0u;
+        wdgm_se_state[i].lastCheckpoint  = WDGM_CHECKPOINT_NONE;
+        wdgm_se_state[i].logical         = FALSE;
+        wdgm_se_state[i].violated        = FALSE;
+    }
+
+    for (i = 0u; i < ConfigPtr->transitionCount; i++) {
+        wdgm_se_state[ConfigPtr->transitionConfig[i].SEId].logical = TRUE;
+    }
+
+    for (i = 0u; i < WDGM_MAX_DEADLINES; i++) {
+        wdgm_deadline_start[i] = 0u;
+        wdgm_deadline_armed[i] = FALSE;
     }
 
+    wdgm_violation_next  = 0u;
+    wdgm_violation_count = 0u;
+
     wdgm_global_status = WDGM_GLOBAL_STATUS_OK;
     wdgm_initialized = TRUE;
 }
@@ -85,11 +311,20 @@ void WdgM_MainFunction(void)
 
     for (i = 0u; i < wdgm_config->seCount; i++) {
         const WdgM_SupervisedEntityConfigType* se_cfg = &wdgm_config->seConfig[i];
+        boolean alive_ok;
+        uint32  now;
 
         SchM_Enter_WdgM_WDGM_EXCLUSIVE_AREA_0();
 
         WdgM_SeStateType* se = &wdgm_se_state[i];
 
+        /* Deactivated: not supervised this cycle */
+        if (se->localStatus == WDGM_LOCAL_STATUS_DEACTIVATED) {
+            se->aliveCounter = 0u;
+            SchM_Exit_WdgM_WDGM_EXCLUSIVE_AREA_0();
+            continue;
+        }
+
         /* Skip already expired entities */
         if (se->localStatus == WDGM_LOCAL_STATUS_EXPIRED) {
             SchM_Exit_WdgM_WDGM_EXCLUSIVE_AREA_0();
@@ -97,12 +332,24 @@ void WdgM_MainFunction(void)
             continue;
         }
 
+        now = WdgM_Now();
+        if (wdgm_config->getTimestampUs != NULL_PTR) {
+            WdgM_CheckOverdue(i, now);
+        }
+
         /* Check alive counter against expected range */
-        if ((se->aliveCounter < se_cfg->ExpectedAliveMin) ||
-            (se->aliveCounter > se_cfg->ExpectedAliveMax)) {
+        alive_ok = ((se->aliveCounter >= se_cfg->ExpectedAliveMin) &&
+                    (se->aliveCounter <= se_cfg->ExpectedAliveMax)) ? TRUE : FALSE;
+        if (alive_ok == FALSE) {
+            WdgM_LogViolation(i, WDGM_VIOLATION_ALIVE, WDGM_CHECKPOINT_NONE,
+                              se->aliveCounter, now);
+        }
+
+        if ((alive_ok == FALSE) || (se->violated == TRUE)) {
             /* Failed this cycle */
             se->localStatus = WDGM_LOCAL_STATUS_FAILED;
             se->failedCycleCount++;
+            se->violated = FALSE;
 
             if (se->failedCycleCount > se_cfg->FailedRefCycleTol) {
                 se->localStatus = WDGM_LOCAL_STATUS_EXPIRED;
@@ -162,5 +409,103 @@ Std_ReturnType WdgM_GetLocalStatus(WdgM_SupervisedEntityIdType SEId,
 
 WdgM_GlobalStatusType WdgM_GetGlobalStatus(void)
 {
+    if (wdgm_initialized == FALSE) {
+        return WDGM_GLOBAL_STATUS_FAILED;
+    }
     return wdgm_global_status;
 }
+
+Std_ReturnType WdgM_SetEntityActive(WdgM_SupervisedEntityIdType SEId,
+                                    boolean Active)
+{
+    Std_ReturnType ret = E_OK;
+
+    if ((wdgm_initialized == FALSE) || (wdgm_config == NULL_PTR)) {
+        Det_ReportError(DET_MODULE_WDGM, 0u, WDGM_API_SET_ENTITY_ACTIVE, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if (SEId >= wdgm_config->seCount) {
+        Det_ReportError(DET_MODULE_WDGM, 0u, WDGM_API_SET_ENTITY_ACTIVE, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    SchM_Enter_WdgM_WDGM_EXCLUSIVE_AREA_0();
+
+    if (wdgm_se_state[SEId].localStatus == WDGM_LOCAL_STATUS_EXPIRED) {
+        ret = E_NOT_OK;
+    } else if (Active == FALSE) {
+        wdgm_se_state[SEId].localStatus = WDGM_LOCAL_STATUS_DEACTIVATED;
+    } else if (wdgm_se_state[SEId].localStatus == WDGM_LOCAL_STATUS_DEACTIVATED) {
+        wdgm_se_state[SEId].localStatus      = WDGM_LOCAL_STATUS_OK;
+        wdgm_se_state[SEId].aliveCounter     = 0u;
+        wdgm_se_state[SEId].failedCycleCount = 0u;
+        WdgM_ResetSupervision(SEId);
+    } else {
+        /* Already active */
+    }
+
+    SchM_Exit_WdgM_WDGM_EXCLUSIVE_AREA_0();
+
+    return ret;
+}
+
+Std_ReturnType WdgM_ReportCheckpoint(WdgM_SupervisedEntityIdType SEId,
+                                     WdgM_CheckpointIdType CheckpointId)
+{
+    uint32 now;
+
+    if ((wdgm_initialized == FALSE) || (wdgm_config == NULL_PTR)) {
+        Det_ReportError(DET_MODULE_WDGM, 0u, WDGM_API_REPORT_CHECKPOINT, DET_E_UNINIT);
+        return E_NOT_OK;
+    }
+
+    if ((SEId >= wdgm_config->seCount) || (CheckpointId == WDGM_CHECKPOINT_NONE)) {
+        Det_ReportError(DET_MODULE_WDGM, 0u, WDGM_API_REPORT_CHECKPOINT, DET_E_PARAM_VALUE);
+        return E_NOT_OK;
+    }
+
+    SchM_Enter_WdgM_WDGM_EXCLUSIVE_AREA_0();
+
+    if ((wdgm_se_state[SEId].localStatus != WDGM_LOCAL_STATUS_DEACTIVATED) &&
+        (wdgm_se_state[SEId].localStatus != WDGM_LOCAL_STATUS_EXPIRED)) {
+        now = WdgM_Now();
+        WdgM_CheckLogical(SEId, CheckpointId, now);
+        if (wdgm_config->getTimestampUs != NULL_PTR) {
+            WdgM_CheckDeadlines(SEId, CheckpointId, now);
+        }
+    }
+
+    SchM_Exit_WdgM_WDGM_EXCLUSIVE_AREA_0();
+
+    return E_OK;
+}
+
+Std_ReturnType WdgM_GetViolation(uint8 Index, WdgM_ViolationType* ViolationPtr)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if (ViolationPtr == NULL_PTR) {
+        Det_ReportError(DET_MODULE_WDGM, 0u, WDGM_API_GET_VIOLATION, DET_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+
+    SchM_Enter_WdgM_WDGM_EXCLUSIVE_AREA_0();
+
+    if ((Index < WDGM_VIOLATION_LOG) && (Index < wdgm_violation_count)) {
+        uint8 slot = (uint8)((wdgm_violation_next + (WDGM_VIOLATION_LOG - 1u) - Index) %
+                             WDGM_VIOLATION_LOG);
+
+        *ViolationPtr = wdgm_violation_log[slot];
+        ret = E_OK;
+    }
+
+    SchM_Exit_WdgM_WDGM_EXCLUSIVE_AREA_0();
+
+    return ret;
+}
+
+uint16 WdgM_GetViolationCount(void)
+{
+    return wdgm_violation_count;
+}
@@ -1,8 +1,24 @@
 /**
  * @file    WdgM.h
- * @brief   Watchdog Manager — alive supervision and watchdog gating
+ * @brief   Watchdog Manager — alive, deadline and logical supervision
  * @date    2026-02-21
  *
+ * @details Three supervisions per entity, evaluated every WdgM_MainFunction
+ *          (supervision cycle):
+ *          - Alive: WdgM_CheckpointReached calls per cycle within
+ *            ExpectedAliveMin..ExpectedAliveMax.
+ *          - Deadline: time from a start to an end checkpoint within
+ *            MinUs..MaxUs, on the clock of getTimestampUs. An end that is
+ *            still missing MaxUs after the start is a violation as well.
+ *          - Logical: every checkpoint reported with WdgM_ReportCheckpoint
+ *            must follow the previous one along a configured transition.
+ *
+ *          A cycle with any violation is a failed cycle; FailedRefCycleTol
+ *          failed cycles in a row are tolerated before the entity EXPIRES
+ *          and the watchdog is no longer fed. Each violation is logged with
+ *          its timestamp (WdgM_GetViolation), so timing degradation is
+ *          visible while it is still tolerated.
+ *
  * @safety_req SWR-BSW-019, SWR-BSW-020
  * @traces_to  TSR-046, TSR-047
  *
@@ -18,16 +34,26 @@
 
 /* ---- Constants ---- */
 
-#define WDGM_MAX_SE     8u  /**< Max supervised entities */
+#define WDGM_MAX_SE         8u  /**< Max supervised entities */
+#define WDGM_MAX_DEADLINES  8u  /**< Max deadline supervisions */
+#define WDGM_VIOLATION_LOG  8u  /**< Violations kept (newest first) */
+
+/** Transition end: graph entry (from) or graph exit (to) */
+#define WDGM_CHECKPOINT_NONE    0xFFu
 
 /* ---- Types ---- */
 
 typedef uint8 WdgM_SupervisedEntityIdType;
+typedef uint8 WdgM_CheckpointIdType;
+
+/** Deadline supervision clock (us, wrapping) */
+typedef uint32 (*WdgM_TimestampFuncType)(void);
 
 typedef enum {
     WDGM_LOCAL_STATUS_OK      = 0u,
     WDGM_LOCAL_STATUS_FAILED  = 1u,
-    WDGM_LOCAL_STATUS_EXPIRED = 2u
+    WDGM_LOCAL_STATUS_EXPIRED = 2u,
+    WDGM_LOCAL_STATUS_DEACTIVATED = 3u  /**< Not supervised (WdgM_SetEntityActive) */
 } WdgM_LocalStatusType;
 
 typedef enum {
@@ -43,11 +69,55 @@ typedef struct {
     uint8   FailedRefCycleTol;  /**< Tolerated failed cycles before EXPIRED */
 } WdgM_SupervisedEntityConfigType;
 
+/** Deadline supervision of one checkpoint pair of an entity */
+typedef struct {
+    WdgM_SupervisedEntityIdType SEId;
+    WdgM_CheckpointIdType       StartCp;
+    WdgM_CheckpointIdType       EndCp;
+    uint32  MinUs;              /**< Earliest allowed end after start */
+    uint32  MaxUs;              /**< Latest allowed end after start */
+} WdgM_DeadlineConfigType;
+
+/**
+ * Logical supervision: allowed transition between two checkpoints of an
+ * entity. From = WDGM_CHECKPOINT_NONE marks an initial checkpoint (graph
+ * entry), To = WDGM_CHECKPOINT_NONE a final one (the graph is left and the
+ * next checkpoint must be initial again). Entities without transitions are
+ * not logically supervised.
+ */
+typedef struct {
+    WdgM_SupervisedEntityIdType SEId;
+    WdgM_CheckpointIdType       From;
+    WdgM_CheckpointIdType       To;
+} WdgM_TransitionConfigType;
+
+typedef enum {
+    WDGM_VIOLATION_ALIVE    = 0u,   /**< value: alive indications in cycle */
+    WDGM_VIOLATION_DEADLINE = 1u,   /**< value: start to end (or now), us  */
+    WDGM_VIOLATION_LOGICAL  = 2u    /**< value: previous checkpoint        */
+} WdgM_ViolationKindType;
+
+/** One logged supervision violation */
+typedef struct {
+    uint32                      timestampUs;    /**< getTimestampUs, 0 if none */
+    uint32                      value;          /**< See WdgM_ViolationKindType */
+    WdgM_SupervisedEntityIdType SEId;
+    WdgM_ViolationKindType      kind;
+    WdgM_CheckpointIdType       checkpoint;     /**< Deadline: end, logical:
+                                                     reached; alive: NONE   */
+} WdgM_ViolationType;
+
 /** WdgM module configuration */
 typedef struct {
     const WdgM_SupervisedEntityConfigType* seConfig;
     uint8   seCount;
     uint8   wdtDioChannel;      /**< DIO channel for external watchdog */
+    const WdgM_DeadlineConfigType*   deadlineConfig;    /**< NULL: none */
+    uint8   deadlineCount;      /**< <= WDGM_MAX_DEADLINES */
+    const WdgM_TransitionConfigType* transitionConfig;  /**< NULL: none */
+    uint8   transitionCount;
+    WdgM_TimestampFuncType getTimestampUs;  /**< NULL: deadlines unchecked,
+                                                 violations not timestamped */
 } WdgM_ConfigType;
 
 /* ---- API Functions ---- */
@@ -59,4 +129,39 @@ Std_ReturnType WdgM_GetLocalStatus(WdgM_SupervisedEntityIdType SEId,
                                     WdgM_LocalStatusType* StatusPtr);
 WdgM_GlobalStatusType WdgM_GetGlobalStatus(void);
 
+/**
+ * @brief  Activate or deactivate the supervision of an entity
+ * @return E_OK on success, E_NOT_OK if not initialized, SEId is invalid or
+ *         the entity is EXPIRED (an expired entity stays expired)
+ * @note   A deactivated entity is skipped by WdgM_MainFunction and does not
+ *         hold back the watchdog feed (e.g. its runnable is disabled in the
+ *         current ECU mode). Reactivation starts a fresh supervision cycle.
+ */
+Std_ReturnType WdgM_SetEntityActive(WdgM_SupervisedEntityIdType SEId,
+                                    boolean Active);
+
+/**
+ * @brief  Report a checkpoint for deadline and logical supervision
+ * @param  SEId          Supervised entity
+ * @param  CheckpointId  Checkpoint reached (not WDGM_CHECKPOINT_NONE)
+ * @return E_OK, or E_NOT_OK if not initialized or a parameter is invalid
+ * @note   Not an alive indication (WdgM_CheckpointReached). Ignored while
+ *         the entity is deactivated or expired.
+ */
+Std_ReturnType WdgM_ReportCheckpoint(WdgM_SupervisedEntityIdType SEId,
+                                     WdgM_CheckpointIdType CheckpointId);
+
+/**
+ * @brief  Read a logged violation
+ * @param  Index         0 = newest, up to WDGM_VIOLATION_LOG - 1
+ * @param  ViolationPtr  Destination
+ * @return E_OK, or E_NOT_OK if fewer violations are logged or NULL pointer
+ */
+Std_ReturnType WdgM_GetViolation(uint8 Index, WdgM_ViolationType* ViolationPtr);
+
+/**
+ * @brief  Violations since WdgM_Init (saturating)
+ */
+uint16 WdgM_GetViolationCount(void);
+
 #endif /* WDGM_H */
@@ -0,0 +1,277 @@
+/**
+ * @file    Sil_CanBridge.c
+ * @brief   Bridge between the shared memory CAN bus and a SocketCAN interface
+ * @date    2026-03-20
+ *
+ * @details Stand-alone tool (build/sil_can_bridge), not linked into an ECU.
+ *          Joins the shared memory bus (Sil_CanBus.h) as one more node and
+ *          copies every frame the bus delivers to a SocketCAN interface, and
+ *          every frame from the interface onto the bus. The ECUs run on the
+ *          shared memory bus; the plant simulator, the CAN gateway, candump
+ *          and the other tools keep using vcan0.
+ *
+ *          Usage: sil_can_bridge [-b bus] [-i iface] [-r bitrate]
+ *            -b  bus segment name (default taktflow_can)
+ *            -i  SocketCAN interface (default $CAN_INTERFACE or vcan0)
+ *            -r  bitrate of the bridge node in bit/s (default 500000)
+ *
+ *          Bus time: the lockstep master's clock when SIL_TIME_MASTER is
+ *          set (read only: the bridge is not a participant and frames from
+ *          the interface join the bus whenever they arrive), else
+ *          Sil_Time_GetSharedUs. SIGINT/SIGTERM or the end of the lockstep
+ *          run stop the bridge.
+ *
+ * @note    SIL simulation only — not compiled for STM32/TMS570 targets.
+ *
+ * @safety_req N/A — SIL simulation only, not for production
+ * @copyright Taktflow Systems 2026
+ */
+
+#include "Sil_CanBus.h"
+#include "Sil_Time.h"
+#include "Sil_TimeShm.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+
+#define BRIDGE_POLL_MS          1       /* Bus side is polled at this rate */
+#define BRIDGE_ATTACH_RETRIES   1000u   /* x 10 ms: wait for the master    */
+#define BRIDGE_ATTACH_RETRY_NS  10000000u
+
+/* ================================================================== */
+
+static volatile sig_atomic_t bridge_stop = 0;
+
+/** Lockstep: the master's segment, read only (NULL: free running) */
+static const Sil_TimeShmType* bridge_master = NULL;
+
+static uint32 bridge_to_iface = 0u;
+static uint32 bridge_to_bus   = 0u;
+
+/* ================================================================== */
+
+static void Bridge_SignalHandler(int sig)
+{
+    (void)sig;
+    bridge_stop = 1;
+}
+
+static uint64 Bridge_MasterNowUs(void)
+{
+    return (uint64)bridge_master->nowUs;
+}
+
+static void Bridge_Nap(void)
+{
+    struct timespec req = { 0, BRIDGE_ATTACH_RETRY_NS };
+
+    (void)nanosleep(&req, NULL);
+}
+
+/**
+ * @brief  Map the lockstep master's segment read only
+ */
+static const Sil_TimeShmType* Bridge_MapMaster(const char* name)
+{
+    char path[64];
+    struct stat st;
+    const Sil_TimeShmType* shm;
+    uint32 tries;
+    int fd = -1;
+
+    (void)snprintf(path, sizeof(path), "/%s", name);
+
+    for (tries = 0u; tries < BRIDGE_ATTACH_RETRIES; tries++) {
+        if (fd < 0) {
+            fd = shm_open(path, O_RDONLY, 0);
+        }
+        if ((fd >= 0) && (fstat(fd, &st) == 0) &&
+            ((size_t)st.st_size >= sizeof(Sil_TimeShmType))) {
+            break;
+        }
+        Bridge_Nap();
+    }
+    if (tries == BRIDGE_ATTACH_RETRIES) {
+        (void)fprintf(stderr, "[sil_can_bridge] ERROR: time master %s not found\n", path);
+        return NULL;
+    }
+
+    shm = (const Sil_TimeShmType*)mmap(NULL, sizeof(Sil_TimeShmType), PROT_READ,
+                                       MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (shm == (const Sil_TimeShmType*)MAP_FAILED) {
+        return NULL;
+    }
+
+    for (tries = 0u; (tries < BRIDGE_ATTACH_RETRIES) &&
+         (__atomic_load_n(&shm->magic, __ATOMIC_ACQUIRE) != SIL_TIME_SHM_MAGIC); tries++) {
+        Bridge_Nap();
+    }
+    if ((shm->magic != SIL_TIME_SHM_MAGIC) || (shm->version != SIL_TIME_SHM_VERSION)) {
+        (void)fprintf(stderr, "[sil_can_bridge] ERROR: time master %s: bad segment\n", path);
+        return NULL;
+    }
+    return shm;
+}
+
+/**
+ * @brief  Open a non-blocking RAW socket on the interface
+ * @return Socket fd, -1 on error
+ */
+static int Bridge_OpenIface(const char* iface)
+{
+    struct sockaddr_can addr;
+    struct ifreq ifr;
+    int fd = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+
+    if (fd < 0) {
+        (void)fprintf(stderr, "[sil_can_bridge] ERROR: socket: %s\n", strerror(errno));
+        return -1;
+    }
+
+    (void)memset(&ifr, 0, sizeof(ifr));
+    (void)strncpy(ifr.ifr_name, iface, sizeof(ifr.ifr_name) - 1u);
+    (void)memset(&addr, 0, sizeof(addr));
+
+    if (ioctl(fd, SIOCGIFINDEX, &ifr) < 0) {
+        (void)fprintf(stderr, "[sil_can_bridge] ERROR: %s: %s\n", iface, strerror(errno));
+        (void)close(fd);
+        return -1;
+    }
+    addr.can_family  = AF_CAN;
+    addr.can_ifindex = ifr.ifr_ifindex;
+
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        (void)fprintf(stderr, "[sil_can_bridge] ERROR: bind %s: %s\n", iface, strerror(errno));
+        (void)close(fd);
+        return -1;
+    }
+
+    /* Own frames are not looped back to this socket (CAN_RAW default):
+     * what the bridge writes to the interface never comes back to the bus */
+    (void)fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    return fd;
+}
+
+/** Interface → bus; error and remote frames are not bridged */
+static void Bridge_IfaceToBus(int fd)
+{
+    struct can_frame frame;
+
+    while (recv(fd, &frame, sizeof(frame), MSG_DONTWAIT) == (ssize_t)sizeof(frame)) {
+        uint32 id;
+
+        if ((frame.can_id & (CAN_ERR_FLAG | CAN_RTR_FLAG)) != 0u) {
+            continue;
+        }
+        id = ((frame.can_id & CAN_EFF_FLAG) != 0u) ? (frame.can_id & CAN_EFF_MASK)
+                                                   : (frame.can_id & CAN_SFF_MASK);
+        if (Sil_CanBus_Transmit(id, frame.data, frame.can_dlc) == E_OK) {
+            bridge_to_bus++;
+        }
+    }
+}
+
+/** Bus → interface; identifiers above 0x7FF go out as extended frames */
+static void Bridge_BusToIface(int fd)
+{
+    struct can_frame frame;
+    uint32 id;
+    uint8 dlc;
+
+    (void)memset(&frame, 0, sizeof(frame));
+    while (Sil_CanBus_Receive(&id, frame.data, &dlc) == TRUE) {
+        frame.can_id  = (id > CAN_SFF_MASK) ? (id | CAN_EFF_FLAG) : id;
+        frame.can_dlc = dlc;
+        if (write(fd, &frame, sizeof(frame)) == (ssize_t)sizeof(frame)) {
+            bridge_to_iface++;
+        }
+    }
+}
+
+/* ================================================================== */
+
+int main(int argc, char *argv[])
+{
+    const char* bus   = "taktflow_can";
+    const char* iface = getenv("CAN_INTERFACE");
+    const char* master = getenv("SIL_TIME_MASTER");
+    uint32 bitrate = 500000u;
+    Sil_CanBus_NowFnType now_fn = Sil_Time_GetSharedUs;
+    struct sigaction sa;
+    struct pollfd pfd;
+    int opt;
+    int fd;
+
+    if ((iface == NULL) || (iface[0] == '\0') || (strncmp(iface, "shm:", 4u) == 0)) {
+        iface = "vcan0";
+    }
+
+    while ((opt = getopt(argc, argv, "b:i:r:")) != -1) {
+        switch (opt) {
+        case 'b': bus     = optarg; break;
+        case 'i': iface   = optarg; break;
+        case 'r': bitrate = (uint32)strtoul(optarg, NULL, 10); break;
+        default:
+            (void)fprintf(stderr, "usage: %s [-b bus] [-i iface] [-r bitrate]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    (void)memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = Bridge_SignalHandler;
+    (void)sigaction(SIGINT, &sa, NULL);
+    (void)sigaction(SIGTERM, &sa, NULL);
+
+    if ((master != NULL) && (master[0] != '\0')) {
+        bridge_master = Bridge_MapMaster(master);
+        if (bridge_master == NULL) {
+            return EXIT_FAILURE;
+        }
+        now_fn = Bridge_MasterNowUs;
+    }
+
+    fd = Bridge_OpenIface(iface);
+    if (fd < 0) {
+        return EXIT_FAILURE;
+    }
+    if (Sil_CanBus_Open(bus, bitrate, now_fn) != E_OK) {
+        (void)close(fd);
+        return EXIT_FAILURE;
+    }
+    (void)fprintf(stderr, "[sil_can_bridge] Bridging shm:%s <-> %s\n", bus, iface);
+
+    pfd.fd     = fd;
+    pfd.events = POLLIN;
+
+    while (bridge_stop == 0) {
+        if ((bridge_master != NULL) &&
+            (__atomic_load_n(&bridge_master->running, __ATOMIC_ACQUIRE) == 0u)) {
+            break;
+        }
+        if (poll(&pfd, 1u, BRIDGE_POLL_MS) > 0) {
+            Bridge_IfaceToBus(fd);
+        }
+        Bridge_BusToIface(fd);
+    }
+
+    (void)fprintf(stderr, "[sil_can_bridge] %lu frames to %s, %lu to the bus\n",
+                  (unsigned long)bridge_to_iface, iface, (unsigned long)bridge_to_bus);
+    Sil_CanBus_Close();
+    (void)close(fd);
+    return EXIT_SUCCESS;
+}
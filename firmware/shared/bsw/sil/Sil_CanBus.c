@@ -0,0 +1,528 @@
+/**
+ * @file    Sil_CanBus.c
+ * @brief   SIL virtual CAN bus in POSIX shared memory
+ * @date    2026-03-20
+ *
+ * @details Each node keeps a cursor into the broadcast ring of Sil_CanShm.h
+ *          and moves the frames it has not seen yet into a local list of
+ *          contenders. The bus model then runs on that list, identically in
+ *          every node:
+ *
+ *          - A frame requested at bus time t joins arbitration at the end
+ *            of its tick, rel = (t / tick + 1) * tick. At that point every
+ *            frame of the tick has been published (lockstep: always; free
+ *            running: unless a writer is preempted inside Sil_CanBus_Transmit).
+ *          - When the bus is idle at start = max(busFree, earliest rel), the
+ *            frame with the lowest (ID, ring position) among those with
+ *            rel <= start wins; it is decided only once no frame still to
+ *            come could have rel <= start.
+ *          - The winner ends at start + its duration (0 without bit timing)
+ *            and is delivered once the bus time reaches its end.
+ *
+ *          busFree is per node, from the frames that node has seen: a node
+ *          that joins while the bus is busy can differ for the first frames
+ *          until the bus goes idle.
+ *
+ *          A node that reads slowly is held back, not fed partial ticks: a
+ *          full receive queue stops arbitration, full contenders stop the
+ *          pull (the bus model then only runs up to the last tick pulled
+ *          completely) and the frames wait in the ring. Frames are lost
+ *          only when the ring laps the node.
+ *
+ * @safety_req N/A — SIL simulation only, not for production
+ * @copyright Taktflow Systems 2026
+ */
+
+#include "Sil_CanBus.h"
+
+#if defined(PLATFORM_POSIX) && !defined(PLATFORM_POSIX_TEST)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "Sil_CanShm.h"
+
+#define SIL_CAN_PENDING_MAX     512u    /* Frames awaiting arbitration      */
+#define SIL_CAN_RXQ_SIZE        512u    /* Frames delivered, not yet read   */
+#define SIL_CAN_TICK_US_DEFAULT 1000u
+#define SIL_CAN_TICK_US_MAX     1000000u
+
+#define SIL_CAN_OPEN_RETRIES    1000u   /* x 10 ms: wait for the creator    */
+#define SIL_CAN_OPEN_RETRY_NS   10000000u
+
+#define SIL_CAN_RING_MASK       ((uint64)SIL_CAN_RING_SIZE - 1u)
+
+/* ================================================================== */
+
+/** A frame of the ring, waiting for arbitration */
+typedef struct {
+    uint64  pos;            /* Ring position: order of the requests */
+    uint64  relUs;          /* Joins arbitration at this bus time   */
+    uint64  txUs;           /* Requested at this bus time           */
+    uint32  id;
+    uint16  node;
+    uint8   dlc;
+    uint8   data[8];
+} Sil_CanBus_PendingType;
+
+typedef struct {
+    uint32  id;
+    uint8   dlc;
+    uint8   data[8];
+} Sil_CanBus_RxType;
+
+static Sil_CanShmType*      bus_shm = NULL;
+static char                 bus_path[64];
+static Sil_CanBus_NowFnType bus_now;
+static uint16               bus_node;
+static uint32               bus_bitrate;        /* 0 = no bit timing */
+static uint64               bus_tick_us;
+static uint64               bus_cursor;         /* Next ring position to read */
+static uint64               bus_free_us;        /* Bus idle from (model)      */
+static uint64               bus_pulled_rel;     /* relUs of the last frame pulled */
+static boolean              bus_stats_registered = FALSE;
+
+static Sil_CanBus_PendingType bus_pending[SIL_CAN_PENDING_MAX];
+static uint32                 bus_pending_count;
+
+static Sil_CanBus_RxType    bus_rxq[SIL_CAN_RXQ_SIZE];
+static uint32               bus_rxq_head;
+static uint32               bus_rxq_count;
+
+static Sil_CanBus_StatsType bus_stats;
+
+/* ================================================================== */
+
+static void Sil_CanBus_PrintStats(void)
+{
+    if ((bus_stats.txFrames == 0u) && (bus_stats.rxFrames == 0u)) {
+        return;
+    }
+
+    (void)fprintf(stderr,
+        "[Sil_CanBus] %s node %u: %lu tx, %lu rx, %lu lost, max backlog %lu, "
+        "worst response %lu us (0x%03lX)\n",
+        bus_path, (unsigned)bus_node,
+        (unsigned long)bus_stats.txFrames, (unsigned long)bus_stats.rxFrames,
+        (unsigned long)bus_stats.lostFrames, (unsigned long)bus_stats.maxBacklog,
+        (unsigned long)bus_stats.maxResponseUs, (unsigned long)bus_stats.maxResponseId);
+}
+
+static void Sil_CanBus_Nap(void)
+{
+    struct timespec req = { 0, SIL_CAN_OPEN_RETRY_NS };
+
+    (void)clock_nanosleep(CLOCK_MONOTONIC, 0, &req, NULL);
+}
+
+static uint32 Sil_CanBus_EnvU32(const char* name, uint32 def, uint32 max)
+{
+    const char* env = getenv(name);
+    char* end = NULL;
+    unsigned long val;
+
+    if ((env == NULL) || (env[0] == '\0')) {
+        return def;
+    }
+    val = strtoul(env, &end, 10);
+    if ((end == env) || (*end != '\0') || (val > max)) {
+        (void)fprintf(stderr, "[Sil_CanBus] WARNING: %s=%s out of range [0..%lu], using %lu\n",
+                      name, env, (unsigned long)max, (unsigned long)def);
+        return def;
+    }
+    return (uint32)val;
+}
+
+/**
+ * @brief  Worst-case time on the bus of a data frame incl. 3-bit IFS
+ * @note   Standard ID: 47 + 8n bits plus up to (34 + 8n - 1) / 4 stuff
+ *         bits (Davis et al.); extended ID: 67 + 8n plus (54 + 8n - 1) / 4.
+ */
+static uint64 Sil_CanBus_FrameUs(uint32 id, uint8 dlc)
+{
+    uint32 bits;
+
+    if (bus_bitrate == 0u) {
+        return 0u;
+    }
+
+    if (id > 0x7FFu) {
+        bits = 67u + (8u * dlc) + ((54u + (8u * dlc) - 1u) / 4u);
+    } else {
+        bits = 47u + (8u * dlc) + ((34u + (8u * dlc) - 1u) / 4u);
+    }
+    return (((uint64)bits * 1000000u) + bus_bitrate - 1u) / bus_bitrate;
+}
+
+/**
+ * @brief  Create the segment; FALSE if another node was first
+ */
+static boolean Sil_CanBus_Create(uint32 bitrate, Sil_CanShmType** shm)
+{
+    int fd = shm_open(bus_path, O_RDWR | O_CREAT | O_EXCL, 0666);
+    Sil_CanShmType* s;
+
+    if (fd < 0) {
+        *shm = NULL;
+        return FALSE;
+    }
+
+    /* umask must not keep the other containers' users out */
+    if ((ftruncate(fd, (off_t)sizeof(Sil_CanShmType)) != 0) || (fchmod(fd, 0666) != 0)) {
+        (void)close(fd);
+        (void)shm_unlink(bus_path);
+        *shm = NULL;
+        return TRUE;
+    }
+
+    s = (Sil_CanShmType*)mmap(NULL, sizeof(Sil_CanShmType), PROT_READ | PROT_WRITE,
+                              MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (s == (Sil_CanShmType*)MAP_FAILED) {
+        (void)shm_unlink(bus_path);
+        *shm = NULL;
+        return TRUE;
+    }
+
+    /* ftruncate zero-fills: the ring is empty, all seq = 0 */
+    s->version  = SIL_CAN_SHM_VERSION;
+    s->ringSize = SIL_CAN_RING_SIZE;
+    s->bitrate  = (Sil_CanBus_EnvU32("SIL_CAN_BIT_TIMING", 0u, 1u) != 0u) ? bitrate : 0u;
+    s->tickUs   = Sil_CanBus_EnvU32("SIL_CAN_TICK_US", SIL_CAN_TICK_US_DEFAULT,
+                                    SIL_CAN_TICK_US_MAX);
+    if (s->tickUs == 0u) {
+        s->tickUs = 1u;
+    }
+    __atomic_store_n(&s->magic, SIL_CAN_SHM_MAGIC, __ATOMIC_RELEASE);
+
+    (void)fprintf(stderr, "[Sil_CanBus] Created %s: tick %lu us, bit timing %s\n",
+                  bus_path, (unsigned long)s->tickUs,
+                  (s->bitrate != 0u) ? "on" : "off");
+    *shm = s;
+    return TRUE;
+}
+
+/**
+ * @brief  Map the segment of another node, waiting until it is ready
+ */
+static Sil_CanShmType* Sil_CanBus_Attach(void)
+{
+    struct stat st;
+    Sil_CanShmType* s;
+    uint32 tries;
+    int fd = -1;
+
+    for (tries = 0u; tries < SIL_CAN_OPEN_RETRIES; tries++) {
+        if (fd < 0) {
+            fd = shm_open(bus_path, O_RDWR, 0);
+        }
+        if ((fd >= 0) && (fstat(fd, &st) == 0) &&
+            ((size_t)st.st_size >= sizeof(Sil_CanShmType))) {
+            break;
+        }
+        Sil_CanBus_Nap();
+    }
+    if (tries == SIL_CAN_OPEN_RETRIES) {
+        if (fd >= 0) {
+            (void)close(fd);
+        }
+        return NULL;
+    }
+
+    s = (Sil_CanShmType*)mmap(NULL, sizeof(Sil_CanShmType), PROT_READ | PROT_WRITE,
+                              MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (s == (Sil_CanShmType*)MAP_FAILED) {
+        return NULL;
+    }
+
+    for (tries = 0u; (tries < SIL_CAN_OPEN_RETRIES) &&
+         (__atomic_load_n(&s->magic, __ATOMIC_ACQUIRE) != SIL_CAN_SHM_MAGIC); tries++) {
+        Sil_CanBus_Nap();
+    }
+    return s;
+}
+
+/**
+ * @brief  Move the newly published frames of the ring to the contenders
+ */
+static void Sil_CanBus_Pull(void)
+{
+    uint64 head = __atomic_load_n(&bus_shm->head, __ATOMIC_ACQUIRE);
+
+    while ((bus_cursor < head) && (bus_pending_count < SIL_CAN_PENDING_MAX)) {
+        const Sil_CanShmFrameType* e = &bus_shm->ring[bus_cursor & SIL_CAN_RING_MASK];
+        uint64 want = bus_cursor + 1u;
+        uint64 seq  = __atomic_load_n(&e->seq, __ATOMIC_ACQUIRE);
+
+        if (seq == want) {
+            Sil_CanBus_PendingType f;
+
+            f.pos   = bus_cursor;
+            f.relUs = ((e->txUs / bus_tick_us) + 1u) * bus_tick_us;
+            f.txUs  = e->txUs;
+            f.id    = e->id;
+            f.node  = e->node;
+            f.dlc   = (e->dlc > 8u) ? 8u : e->dlc;
+            (void)memcpy(f.data, e->data, sizeof(f.data));
+
+            /* Seqlock read: the entry must not have been reused meanwhile */
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            seq = __atomic_load_n(&e->seq, __ATOMIC_RELAXED);
+            if (seq == want) {
+                bus_pending[bus_pending_count] = f;
+                bus_pending_count++;
+                if (bus_pending_count > bus_stats.maxBacklog) {
+                    bus_stats.maxBacklog = bus_pending_count;
+                }
+                bus_pulled_rel = f.relUs;
+                bus_cursor++;
+                continue;
+            }
+        }
+
+        if (seq > want) {
+            /* Lapped: continue at the oldest entry still in the ring */
+            uint64 oldest = head - (uint64)SIL_CAN_RING_SIZE;
+
+            if (oldest <= bus_cursor) {
+                oldest = bus_cursor + 1u;
+            }
+            bus_stats.lostFrames += (uint32)(oldest - bus_cursor);
+            bus_cursor = oldest;
+        } else if ((head - bus_cursor) > ((uint64)SIL_CAN_RING_SIZE / 2u)) {
+            /* Writer died between reserving and publishing: skip it */
+            bus_stats.lostFrames++;
+            bus_cursor++;
+        } else {
+            break;      /* Not published yet: keep the ring order */
+        }
+    }
+}
+
+/**
+ * @brief  Run the bus model up to bus time now, queue what this node receives
+ */
+static void Sil_CanBus_Arbitrate(uint64 now)
+{
+    uint64 closed = (now / bus_tick_us) * bus_tick_us;   /* Current tick start */
+
+    /* Pull stopped early: the tick of the last frame pulled may go on in the
+     * ring (unless it is the only one left to arbitrate) */
+    if ((bus_cursor < __atomic_load_n(&bus_shm->head, __ATOMIC_ACQUIRE)) &&
+        (bus_pulled_rel < (closed + bus_tick_us))) {
+        uint32 i;
+
+        for (i = 0u; i < bus_pending_count; i++) {
+            if (bus_pending[i].relUs < bus_pulled_rel) {
+                closed = bus_pulled_rel - bus_tick_us;
+                break;
+            }
+        }
+    }
+
+    while (bus_pending_count > 0u) {
+        uint64 start = bus_pending[0].relUs;
+        uint32 win = SIL_CAN_PENDING_MAX;
+        uint64 end;
+        uint32 i;
+
+        for (i = 1u; i < bus_pending_count; i++) {
+            if (bus_pending[i].relUs < start) {
+                start = bus_pending[i].relUs;
+            }
+        }
+        if (start > closed) {
+            break;                      /* Their tick is still open */
+        }
+        if (bus_free_us > start) {
+            start = bus_free_us;
+        }
+        if (start >= (closed + bus_tick_us)) {
+            break;                      /* Frames of this tick may join */
+        }
+
+        for (i = 0u; i < bus_pending_count; i++) {
+            const Sil_CanBus_PendingType* f = &bus_pending[i];
+
+            if ((f->relUs <= start) &&
+                ((win == SIL_CAN_PENDING_MAX) ||
+                 (f->id < bus_pending[win].id) ||
+                 ((f->id == bus_pending[win].id) && (f->pos < bus_pending[win].pos)))) {
+                win = i;
+            }
+        }
+
+        end = start + Sil_CanBus_FrameUs(bus_pending[win].id, bus_pending[win].dlc);
+        if (end > now) {
+            break;                      /* Still on the bus */
+        }
+
+        if (bus_pending[win].node == bus_node) {
+            /* Own frame: request to end of transmission, as in the offline
+             * response time analysis (tools/can_timing) */
+            uint64 resp = end - bus_pending[win].txUs;
+
+            if (resp > bus_stats.maxResponseUs) {
+                bus_stats.maxResponseUs = (uint32)resp;
+                bus_stats.maxResponseId = bus_pending[win].id;
+            }
+        } else {
+            Sil_CanBus_RxType* rx;
+
+            if (bus_rxq_count == SIL_CAN_RXQ_SIZE) {
+                break;                  /* Receiver behind: keep the rest */
+            }
+            rx = &bus_rxq[(bus_rxq_head + bus_rxq_count) % SIL_CAN_RXQ_SIZE];
+            rx->id  = bus_pending[win].id;
+            rx->dlc = bus_pending[win].dlc;
+            (void)memcpy(rx->data, bus_pending[win].data, sizeof(rx->data));
+            bus_rxq_count++;
+        }
+        bus_free_us = end;
+
+        /* Contenders are searched, not ordered: fill the hole with the last */
+        bus_pending_count--;
+        bus_pending[win] = bus_pending[bus_pending_count];
+    }
+}
+
+/* ================================================================== */
+
+Std_ReturnType Sil_CanBus_Open(const char* name, uint32 bitrate,
+                               Sil_CanBus_NowFnType nowFn)
+{
+    Sil_CanShmType* shm = NULL;
+
+    if ((name == NULL) || (name[0] == '\0') || (nowFn == NULL)) {
+        return E_NOT_OK;
+    }
+
+    Sil_CanBus_Close();
+    (void)snprintf(bus_path, sizeof(bus_path), "/%s", name);
+
+    if ((Sil_CanBus_Create(bitrate, &shm) == FALSE) && (errno == EEXIST)) {
+        shm = Sil_CanBus_Attach();
+    }
+    if (shm == NULL) {
+        (void)fprintf(stderr, "[Sil_CanBus] ERROR: cannot open %s: %s\n",
+                      bus_path, strerror(errno));
+        return E_NOT_OK;
+    }
+    if ((shm->magic != SIL_CAN_SHM_MAGIC) || (shm->version != SIL_CAN_SHM_VERSION) ||
+        (shm->ringSize != SIL_CAN_RING_SIZE)) {
+        (void)fprintf(stderr, "[Sil_CanBus] ERROR: %s has another layout "
+                      "(stale? remove /dev/shm%s)\n", bus_path, bus_path);
+        (void)munmap(shm, sizeof(Sil_CanShmType));
+        return E_NOT_OK;
+    }
+    if ((shm->bitrate != 0u) && (shm->bitrate != bitrate)) {
+        (void)fprintf(stderr, "[Sil_CanBus] WARNING: %s is timed at %lu bit/s, node at %lu\n",
+                      bus_path, (unsigned long)shm->bitrate, (unsigned long)bitrate);
+    }
+
+    bus_shm     = shm;
+    bus_now     = nowFn;
+    bus_bitrate = shm->bitrate;
+    bus_tick_us = shm->tickUs;
+    bus_node    = (uint16)__atomic_fetch_add(&shm->nodeCount, 1u, __ATOMIC_ACQ_REL);
+    bus_cursor  = __atomic_load_n(&shm->head, __ATOMIC_ACQUIRE);
+    bus_free_us = 0u;
+    bus_pulled_rel = 0u;
+
+    bus_pending_count = 0u;
+    bus_rxq_head  = 0u;
+    bus_rxq_count = 0u;
+    (void)memset(&bus_stats, 0, sizeof(bus_stats));
+
+    if (bus_stats_registered == FALSE) {
+        bus_stats_registered = TRUE;
+        (void)atexit(Sil_CanBus_PrintStats);
+    }
+
+    (void)fprintf(stderr, "[Sil_CanBus] Node %u on %s\n", (unsigned)bus_node, bus_path);
+    return E_OK;
+}
+
+void Sil_CanBus_Close(void)
+{
+    if (bus_shm != NULL) {
+        (void)munmap(bus_shm, sizeof(Sil_CanShmType));
+        bus_shm = NULL;
+    }
+}
+
+Std_ReturnType Sil_CanBus_Transmit(uint32 id, const uint8* data, uint8 dlc)
+{
+    Sil_CanShmFrameType* e;
+    uint64 pos;
+
+    if ((bus_shm == NULL) || (data == NULL)) {
+        return E_NOT_OK;
+    }
+    if (dlc > 8u) {
+        dlc = 8u;
+    }
+
+    pos = __atomic_fetch_add(&bus_shm->head, 1u, __ATOMIC_ACQ_REL);
+    e   = &bus_shm->ring[pos & SIL_CAN_RING_MASK];
+
+    /* Unpublish before the payload changes (seqlock write) */
+    __atomic_store_n(&e->seq, 0u, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    e->txUs = bus_now();
+    e->id   = id;
+    e->node = bus_node;
+    e->dlc  = dlc;
+    (void)memset(e->data, 0, sizeof(e->data));
+    (void)memcpy(e->data, data, dlc);
+
+    __atomic_store_n(&e->seq, pos + 1u, __ATOMIC_RELEASE);
+
+    bus_stats.txFrames++;
+    return E_OK;
+}
+
+boolean Sil_CanBus_Receive(uint32* id, uint8* data, uint8* dlc)
+{
+    const Sil_CanBus_RxType* rx;
+
+    if ((bus_shm == NULL) || (id == NULL) || (data == NULL) || (dlc == NULL)) {
+        return FALSE;
+    }
+
+    if (bus_rxq_count == 0u) {
+        Sil_CanBus_Pull();
+        Sil_CanBus_Arbitrate(bus_now());
+        if (bus_rxq_count == 0u) {
+            return FALSE;
+        }
+    }
+
+    rx = &bus_rxq[bus_rxq_head];
+    *id  = rx->id;
+    *dlc = rx->dlc;
+    (void)memcpy(data, rx->data, rx->dlc);
+    bus_rxq_head = (bus_rxq_head + 1u) % SIL_CAN_RXQ_SIZE;
+    bus_rxq_count--;
+
+    bus_stats.rxFrames++;
+    return TRUE;
+}
+
+void Sil_CanBus_GetStats(Sil_CanBus_StatsType* stats)
+{
+    if (stats != NULL) {
+        *stats = bus_stats;
+    }
+}
+
+#endif /* PLATFORM_POSIX && !PLATFORM_POSIX_TEST */
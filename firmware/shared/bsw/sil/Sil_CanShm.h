@@ -0,0 +1,73 @@
+/**
+ * @file    Sil_CanShm.h
+ * @brief   Shared memory virtual CAN bus — segment layout
+ * @date    2026-03-20
+ *
+ * @details One POSIX shared memory segment per bus, created by the first
+ *          node that opens it (Sil_CanBus.c). It holds a broadcast ring of
+ *          frames: every node writes to it and every node reads all of it
+ *          with its own cursor, so a frame costs no syscall at all.
+ *
+ *          Writers (any number of processes):
+ *          1. Reserve a ring position: pos = atomic head++.
+ *          2. Clear seq of the entry, write the frame, then publish it:
+ *             seq = pos + 1 (release).
+ *
+ *          Readers (any number, lock-free, never block a writer):
+ *          - seq == pos + 1: the frame at pos; seq is read again after the
+ *            copy to detect a writer that lapped the reader meanwhile.
+ *          - seq >  pos + 1: the ring lapped the reader, frames were lost.
+ *          - seq <  pos + 1: the writer of pos has not published yet.
+ *
+ *          A node that opens the bus starts reading at the current head:
+ *          frames sent before it (or by a previous run) are never seen.
+ *
+ *          The layout is fixed (little-endian, no padding), so that other
+ *          tools can map the segment by offset.
+ *
+ * @note    SIL simulation only — not compiled for STM32/TMS570 targets.
+ *
+ * @safety_req N/A — SIL simulation only, not for production
+ * @copyright Taktflow Systems 2026
+ */
+
+#ifndef SIL_CANSHM_H
+#define SIL_CANSHM_H
+
+#include "Platform_Types.h"
+
+#define SIL_CAN_SHM_MAGIC       0x4E414353u     /**< "SCAN" little-endian */
+#define SIL_CAN_SHM_VERSION     1u
+#define SIL_CAN_RING_SIZE       4096u           /**< Entries, power of 2  */
+
+/** One frame of the ring (32 bytes) */
+typedef struct {
+    volatile uint64 seq;        /**<  0: ring position + 1 once published   */
+    uint64          txUs;       /**<  8: bus time of the transmit request   */
+    uint32          id;         /**< 16: CAN identifier                     */
+    uint16          node;       /**< 20: sender (see nodeCount)             */
+    uint8           dlc;        /**< 22: 0..8                               */
+    uint8           reserved;   /**< 23                                     */
+    uint8           data[8];    /**< 24                                     */
+} Sil_CanShmFrameType;
+
+/** Segment header followed by the ring (64 + 4096 * 32 bytes) */
+typedef struct {
+    uint32          magic;      /**<  0: written last by the creator        */
+    uint32          version;    /**<  4                                     */
+    uint32          ringSize;   /**<  8: SIL_CAN_RING_SIZE                  */
+    uint32          bitrate;    /**< 12: bit/s of the timing model, 0 = off */
+    uint32          tickUs;     /**< 16: arbitration round, bus time us     */
+    volatile uint32 nodeCount;  /**< 20: node ids handed out (atomic ++)    */
+    volatile uint64 head;       /**< 24: next ring position (atomic ++)     */
+    uint32          reserved[8];/**< 32                                     */
+    Sil_CanShmFrameType ring[SIL_CAN_RING_SIZE];    /**< 64                 */
+} Sil_CanShmType;
+
+typedef char sil_can_shm_ring_pow2_check[
+    ((SIL_CAN_RING_SIZE & (SIL_CAN_RING_SIZE - 1u)) == 0u) ? 1 : -1];
+typedef char sil_can_shm_frame_size_check[(sizeof(Sil_CanShmFrameType) == 32u) ? 1 : -1];
+typedef char sil_can_shm_size_check[
+    (sizeof(Sil_CanShmType) == (64u + (SIL_CAN_RING_SIZE * 32u))) ? 1 : -1];
+
+#endif /* SIL_CANSHM_H */
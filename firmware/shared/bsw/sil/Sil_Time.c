@@ -1,16 +1,27 @@
 /**
  * @file    Sil_Time.c
- * @brief   SIL time acceleration via Linux timerfd
+ * @brief   SIL time acceleration and periodic main loop timer
  * @date    2026-03-08
  *
- * @details Uses timerfd_create(CLOCK_MONOTONIC) for precise periodic sleep with
- *          sub-millisecond resolution. The SIL_TIME_SCALE environment variable
- *          controls acceleration (default 1 = real-time, 10 = 10× faster).
+ * @details The SIL_TIME_SCALE environment variable controls acceleration
+ *          (default 1 = real-time, 10 = 10× faster).
  *
- *          timerfd advantages over usleep:
- *          - Compensates for execution time drift (absolute timer, not relative)
- *          - Reports missed expirations via read() return value
- *          - Precise at short intervals (usleep has ~100us minimum on Linux)
+ *          Sil_Time_WaitNextPeriod keeps one absolute deadline per process
+ *          and sleeps with clock_nanosleep(TIMER_ABSTIME): no file
+ *          descriptor per sleep, and the deadlines stay on a fixed grid
+ *          whatever the loop body costs. Overruns and skipped periods are
+ *          counted and printed to stderr at exit.
+ *
+ *          Sil_Time_Sleep is a plain relative clock_nanosleep.
+ *
+ *          Lockstep mode (SIL_TIME_MASTER = shared memory name of a running
+ *          sil_time_master, SIL_TIME_SLOT = slot of this process): virtual
+ *          time is the master's clock, not the wall clock. Every wait hands
+ *          the turn back to the master with the virtual wake-up time and
+ *          blocks on a futex until the master grants the next turn; see
+ *          Sil_TimeShm.h for the protocol. SIL_TIME_SCALE is ignored. When
+ *          the master ends the run, the process gets SIGTERM, as from
+ *          docker stop, and later waits return at once.
  *
  * @safety_req N/A — SIL simulation only, not for production
  * @copyright Taktflow Systems 2026
@@ -22,10 +33,24 @@
 
 #include <stdlib.h>
 #include <stdio.h>
-#include <unistd.h>
+#include <errno.h>
 #include <time.h>
 #include <stdint.h>
-#include <sys/timerfd.h>
+#include <limits.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "Sil_TimeShm.h"
+
+#define SIL_NS_PER_SEC  1000000000u
+
+#define SIL_ATTACH_RETRIES      1000u   /* x 10 ms: wait for the master */
+#define SIL_ATTACH_RETRY_NS     10000000u
 
 /* ================================================================== */
 
@@ -33,6 +58,244 @@ static uint32 sil_scale = 1u;
 static int    sil_initialized = 0;
 static struct timespec sil_origin;
 
+/* Periodic timer (Sil_Time_WaitNextPeriod) */
+static uint32             sil_period_us = 0u;   /* 0 = not started */
+static struct timespec    sil_deadline;
+static Sil_Time_StatsType sil_stats;
+
+/* Lockstep mode: attached to a time master when not NULL */
+static Sil_TimeShmType*   sil_shm = NULL;
+static uint32             sil_slot;
+static uint32             sil_go_seen;      /* Last grant taken */
+static int                sil_run_ended = 0;
+static uint64_t           sil_vdeadline;    /* Virtual us */
+
+/* ================================================================== */
+
+/** Virtual microseconds → wall-clock nanoseconds (at least 1) */
+static uint64_t Sil_Time_WallNs(uint32 virtual_us)
+{
+    uint64_t ns = ((uint64_t)virtual_us * 1000u) / sil_scale;
+
+    return (ns > 0u) ? ns : 1u;
+}
+
+static void Sil_Time_AddNs(struct timespec *ts, uint64_t ns)
+{
+    ns += (uint64_t)ts->tv_nsec;
+    ts->tv_sec  += (time_t)(ns / SIL_NS_PER_SEC);
+    ts->tv_nsec  = (long)(ns % SIL_NS_PER_SEC);
+}
+
+/** a - b in nanoseconds */
+static int64_t Sil_Time_DiffNs(const struct timespec *a, const struct timespec *b)
+{
+    return ((int64_t)(a->tv_sec - b->tv_sec) * (int64_t)SIL_NS_PER_SEC) +
+           (int64_t)(a->tv_nsec - b->tv_nsec);
+}
+
+static void Sil_Time_PrintStats(void)
+{
+    if (sil_stats.periods == 0u) {
+        return;
+    }
+
+    (void)fprintf(stderr,
+        "[Sil_Time] %lu periods of %lu us: %lu overruns, %lu missed, max late %lu us\n",
+        (unsigned long)sil_stats.periods, (unsigned long)sil_period_us,
+        (unsigned long)sil_stats.overruns, (unsigned long)sil_stats.missed,
+        (unsigned long)sil_stats.maxLateUs);
+}
+
+/* ---- Lockstep ---- */
+
+static void Sil_Time_FutexWait(volatile uint32 *addr, uint32 val)
+{
+    (void)syscall(SYS_futex, addr, FUTEX_WAIT, val, NULL, NULL, 0);
+}
+
+static void Sil_Time_FutexWake(volatile uint32 *addr)
+{
+    (void)syscall(SYS_futex, addr, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+static void Sil_Time_Nap(void)
+{
+    struct timespec req = { 0, SIL_ATTACH_RETRY_NS };
+
+    (void)clock_nanosleep(CLOCK_MONOTONIC, 0, &req, NULL);
+}
+
+static void Sil_Time_Fail(const char *what, const char *name)
+{
+    (void)fprintf(stderr, "[Sil_Time] ERROR: lockstep %s (%s)\n", what, name);
+    exit(EXIT_FAILURE);
+}
+
+/**
+ * @brief  Block until the master grants this slot the next turn
+ */
+static void Sil_Time_WaitTurn(void)
+{
+    volatile uint32 *go = &sil_shm->slot[sil_slot].go;
+
+    for (;;) {
+        uint32 now_go;
+
+        if (__atomic_load_n(&sil_shm->running, __ATOMIC_ACQUIRE) == 0u) {
+            /* End of the run: shut down like on docker stop */
+            (void)fprintf(stderr, "[Sil_Time] time master ended the run at %llu us\n",
+                          (unsigned long long)sil_shm->nowUs);
+            sil_run_ended = 1;
+            (void)raise(SIGTERM);
+            return;
+        }
+
+        now_go = __atomic_load_n(go, __ATOMIC_ACQUIRE);
+        if (now_go != sil_go_seen) {
+            sil_go_seen = now_go;
+            return;
+        }
+        Sil_Time_FutexWait(go, now_go);
+    }
+}
+
+/**
+ * @brief  Hand the turn back to the master, run again at virtual wake_us
+ */
+static void Sil_Time_Yield(uint64_t wake_us)
+{
+    uint32 expected = sil_slot;
+
+    if (sil_run_ended != 0) {
+        return;
+    }
+
+    sil_shm->slot[sil_slot].wakeUs = wake_us;
+    sil_shm->slot[sil_slot].grants++;
+
+    if (__atomic_compare_exchange_n(&sil_shm->turn, &expected, SIL_TIME_TURN_MASTER,
+                                    0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) == 0) {
+        /* The master gave up on this slot (watchdog) */
+        (void)fprintf(stderr, "[Sil_Time] ERROR: slot %u dropped by the time master\n",
+                      (unsigned)sil_slot);
+        exit(EXIT_FAILURE);
+    }
+    Sil_Time_FutexWake(&sil_shm->turn);
+
+    Sil_Time_WaitTurn();
+}
+
+/**
+ * @brief  Leave the run at exit; hand the turn back if held
+ */
+static void Sil_Time_Detach(void)
+{
+    uint32 expected = sil_slot;
+
+    __atomic_store_n(&sil_shm->slot[sil_slot].state, SIL_TIME_SLOT_DETACHED,
+                     __ATOMIC_RELEASE);
+
+    if (__atomic_compare_exchange_n(&sil_shm->turn, &expected, SIL_TIME_TURN_MASTER,
+                                    0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) != 0) {
+        Sil_Time_FutexWake(&sil_shm->turn);
+    }
+}
+
+/**
+ * @brief  Map the master's segment, take a slot and wait for the first turn
+ */
+static void Sil_Time_Attach(const char *name, const char *slot_env)
+{
+    char path[64];
+    char *end = NULL;
+    unsigned long slot;
+    struct stat st;
+    Sil_TimeShmType *shm;
+    uint32 tries;
+    int fd = -1;
+
+    slot = (slot_env != NULL) ? strtoul(slot_env, &end, 10) : SIL_TIME_MAX_SLOTS;
+    if ((end == slot_env) || (slot >= SIL_TIME_MAX_SLOTS)) {
+        Sil_Time_Fail("needs SIL_TIME_SLOT < 16", name);
+    }
+    (void)snprintf(path, sizeof(path), "/%s", name);
+
+    /* The master may start after this process: wait for a sized segment */
+    for (tries = 0u; tries < SIL_ATTACH_RETRIES; tries++) {
+        if (fd < 0) {
+            fd = shm_open(path, O_RDWR, 0);
+        }
+        if ((fd >= 0) && (fstat(fd, &st) == 0) &&
+            ((size_t)st.st_size >= sizeof(Sil_TimeShmType))) {
+            break;
+        }
+        Sil_Time_Nap();
+    }
+    if (tries == SIL_ATTACH_RETRIES) {
+        Sil_Time_Fail("time master not found", path);
+    }
+
+    shm = (Sil_TimeShmType *)mmap(NULL, sizeof(Sil_TimeShmType),
+                                  PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (shm == (Sil_TimeShmType *)MAP_FAILED) {
+        Sil_Time_Fail("mmap failed", path);
+    }
+
+    for (tries = 0u; (tries < SIL_ATTACH_RETRIES) &&
+         (__atomic_load_n(&shm->magic, __ATOMIC_ACQUIRE) != SIL_TIME_SHM_MAGIC); tries++) {
+        Sil_Time_Nap();
+    }
+    if ((shm->magic != SIL_TIME_SHM_MAGIC) || (shm->version != SIL_TIME_SHM_VERSION)) {
+        Sil_Time_Fail("segment version mismatch", path);
+    }
+
+    sil_shm  = shm;
+    sil_slot = (uint32)slot;
+
+    if (shm->slot[slot].state == SIL_TIME_SLOT_ATTACHED) {
+        (void)fprintf(stderr, "[Sil_Time] WARNING: slot %lu re-attached (restart?)\n", slot);
+    }
+    shm->slot[slot].wakeUs = shm->nowUs;
+    sil_go_seen = __atomic_load_n(&shm->slot[slot].go, __ATOMIC_ACQUIRE);
+    __atomic_store_n(&shm->slot[slot].state, SIL_TIME_SLOT_ATTACHED, __ATOMIC_RELEASE);
+    (void)atexit(Sil_Time_Detach);
+
+    (void)fprintf(stderr, "[Sil_Time] Lockstep: slot %lu of time master %s\n", slot, path);
+    Sil_Time_WaitTurn();
+}
+
+static void Sil_Time_LockstepWaitNextPeriod(uint32 period_us)
+{
+    uint64_t now = sil_shm->nowUs;
+
+    if (period_us != sil_period_us) {
+        sil_period_us = period_us;
+        sil_vdeadline = now;
+    }
+    sil_vdeadline += (period_us > 0u) ? period_us : 1u;
+
+    if (now >= sil_vdeadline) {
+        /* A Sil_Time_Sleep in the loop body passed the deadline */
+        uint64_t skipped = (now - sil_vdeadline) / ((period_us > 0u) ? period_us : 1u);
+
+        sil_stats.overruns++;
+        sil_stats.missed += (uint32)skipped;
+        sil_vdeadline += skipped * period_us;
+    } else {
+        Sil_Time_Yield(sil_vdeadline);
+
+        /* Late only by the master's tick rounding */
+        now = sil_shm->nowUs;
+        if ((now > sil_vdeadline) && ((now - sil_vdeadline) > sil_stats.maxLateUs)) {
+            sil_stats.maxLateUs = (uint32)(now - sil_vdeadline);
+        }
+    }
+
+    sil_stats.periods++;
+}
+
 /* ================================================================== */
 
 void Sil_Time_Init(void)
@@ -56,8 +319,13 @@ void Sil_Time_Init(void)
 
     clock_gettime(CLOCK_MONOTONIC, &sil_origin);
     sil_initialized = 1;
+    (void)atexit(Sil_Time_PrintStats);
 
-    if (sil_scale > 1u) {
+    const char *master = getenv("SIL_TIME_MASTER");
+    if ((master != NULL) && (master[0] != '\0')) {
+        sil_scale = 1u;
+        Sil_Time_Attach(master, getenv("SIL_TIME_SLOT"));
+    } else if (sil_scale > 1u) {
         (void)fprintf(stderr,
             "[Sil_Time] Time acceleration: %ux (wall clock runs %ux slower than virtual)\n",
             (unsigned)sil_scale, (unsigned)sil_scale);
@@ -70,39 +338,75 @@ void Sil_Time_Sleep(uint32 period_us)
         Sil_Time_Init();
     }
 
+    if (sil_shm != NULL) {
+        Sil_Time_Yield(sil_shm->nowUs + period_us);
+        return;
+    }
+
     /* Scale: virtual period → wall-clock duration */
-    uint32 wall_us = period_us / sil_scale;
-
-    /* Floor at 10us to avoid busy-spin (Linux scheduler minimum) */
-    if (wall_us < 10u) {
-        wall_us = 10u;
-    }
-
-    /*
-     * Use timerfd for intervals < 2ms (where usleep precision degrades).
-     * For longer sleeps, usleep is fine and avoids fd overhead.
-     */
-    if (wall_us < 2000u) {
-        int tfd = timerfd_create(CLOCK_MONOTONIC, 0);
-        if (tfd >= 0) {
-            struct itimerspec its;
-            its.it_interval.tv_sec  = 0;
-            its.it_interval.tv_nsec = 0;
-            its.it_value.tv_sec     = 0;
-            its.it_value.tv_nsec    = (long)wall_us * 1000L;
-
-            if (timerfd_settime(tfd, 0, &its, NULL) == 0) {
-                uint64_t expirations;
-                ssize_t n = read(tfd, &expirations, sizeof(expirations));
-                (void)n; /* Block until timer fires; value unused */
-            }
-            close(tfd);
-        } else {
-            /* Fallback if timerfd unavailable */
-            usleep(wall_us);
-        }
+    uint64_t wall_ns = Sil_Time_WallNs(period_us);
+    struct timespec req;
+
+    req.tv_sec  = (time_t)(wall_ns / SIL_NS_PER_SEC);
+    req.tv_nsec = (long)(wall_ns % SIL_NS_PER_SEC);
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, 0, &req, &req) == EINTR) {
+        /* Signal: sleep the remainder */
+    }
+}
+
+void Sil_Time_WaitNextPeriod(uint32 period_us)
+{
+    struct timespec now;
+
+    if (sil_initialized == 0) {
+        Sil_Time_Init();
+    }
+
+    if (sil_shm != NULL) {
+        Sil_Time_LockstepWaitNextPeriod(period_us);
+        return;
+    }
+
+    uint64_t period_ns = Sil_Time_WallNs(period_us);
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    if (period_us != sil_period_us) {
+        /* (Re)start the grid one period from now */
+        sil_period_us = period_us;
+        sil_deadline  = now;
+    }
+    Sil_Time_AddNs(&sil_deadline, period_ns);
+
+    int64_t late_ns = Sil_Time_DiffNs(&now, &sil_deadline);
+
+    if (late_ns >= 0) {
+        /* Body overran: run again at once, skip the periods already past */
+        uint64_t skipped = (uint64_t)late_ns / period_ns;
+
+        sil_stats.overruns++;
+        sil_stats.missed += (uint32)skipped;
+        Sil_Time_AddNs(&sil_deadline, skipped * period_ns);
     } else {
-        usleep(wall_us);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &sil_deadline, NULL) == EINTR) {
+            /* Signal: the deadline is absolute, sleep again */
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        late_ns = Sil_Time_DiffNs(&now, &sil_deadline);
+        if ((late_ns > 0) && ((uint64_t)late_ns / 1000u > sil_stats.maxLateUs)) {
+            sil_stats.maxLateUs = (uint32)((uint64_t)late_ns / 1000u);
+        }
+    }
+
+    sil_stats.periods++;
+}
+
+void Sil_Time_GetStats(Sil_Time_StatsType *stats)
+{
+    if (stats != NULL) {
+        *stats = sil_stats;
     }
 }
 
@@ -112,6 +416,10 @@ uint32 Sil_Time_GetTickUs(void)
         Sil_Time_Init();
     }
 
+    if (sil_shm != NULL) {
+        return (uint32)sil_shm->nowUs;
+    }
+
     struct timespec now;
     clock_gettime(CLOCK_MONOTONIC, &now);
 
@@ -124,9 +432,43 @@ uint32 Sil_Time_GetTickUs(void)
     return wall_us * sil_scale;
 }
 
+uint32 Sil_Time_GetTickMs(void)
+{
+    if (sil_initialized == 0) {
+        Sil_Time_Init();
+    }
+
+    if (sil_shm != NULL) {
+        return (uint32)(sil_shm->nowUs / 1000u);
+    }
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    /* 64-bit: wraps at uint32 milliseconds, not microseconds */
+    return (uint32)(((uint64_t)Sil_Time_DiffNs(&now, &sil_origin) * sil_scale) / 1000000u);
+}
+
+uint64 Sil_Time_GetSharedUs(void)
+{
+    struct timespec now;
+
+    if (sil_initialized == 0) {
+        Sil_Time_Init();
+    }
+
+    if (sil_shm != NULL) {
+        return (uint64)sil_shm->nowUs;
+    }
+
+    /* Absolute, not from sil_origin: the same in every process */
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (((uint64)now.tv_sec * 1000000u) + ((uint64)now.tv_nsec / 1000u)) * sil_scale;
+}
+
 uint32 Sil_Time_GetScale(void)
 {
-    return sil_scale;
+    return (sil_shm != NULL) ? 0u : sil_scale;
 }
 
 #endif /* PLATFORM_POSIX && !PLATFORM_POSIX_TEST */
@@ -0,0 +1,376 @@
+/**
+ * @file    Sil_TimeMaster.c
+ * @brief   Lockstep SIL time master — owns the virtual clock of a SIL run
+ * @date    2026-03-19
+ *
+ * @details Stand-alone tool (build/sil_time_master), not linked into an ECU.
+ *          Creates the shared memory segment of Sil_TimeShm.h, waits until
+ *          the expected number of participants has attached, then advances
+ *          virtual time step by step: each step jumps to the earliest
+ *          wake-up of all participants (on the tick grid) and hands the turn
+ *          to the due participants one at a time, in slot order. With the
+ *          same inputs, every run executes the same loop bodies in the same
+ *          order at the same virtual times.
+ *
+ *          Usage: sil_time_master [-n name] [-s slots] [-t tick_us]
+ *                                 [-d seconds] [-x pace] [-w seconds]
+ *            -n  segment name (default $SIL_TIME_MASTER or taktflow_sil_time)
+ *            -s  participants to wait for before time starts (default 1)
+ *            -t  virtual tick in us; wake-ups are rounded up to it (1000)
+ *            -d  end the run after this much virtual time (0 = never)
+ *            -x  pace: 0 = as fast as possible, N = at most N× real time
+ *            -w  drop a participant that holds one turn longer than this
+ *                many wall seconds (default 10)
+ *
+ *          SIGINT/SIGTERM end the run: every participant gets SIGTERM from
+ *          its own Sil_Time and the segment is removed.
+ *
+ * @note    SIL simulation only — not compiled for STM32/TMS570 targets.
+ *
+ * @safety_req N/A — SIL simulation only, not for production
+ * @copyright Taktflow Systems 2026
+ */
+
+#include "Sil_TimeShm.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#define MASTER_NS_PER_SEC       1000000000u
+#define MASTER_POLL_NS          10000000u   /* Attach polling: 10 ms     */
+#define MASTER_TURN_POLL_NS     100000000u  /* Turn wait slice: 100 ms   */
+#define MASTER_REPORT_SEC       5u
+
+/* ================================================================== */
+
+static volatile sig_atomic_t master_stop = 0;
+
+static Sil_TimeShmType* master_shm = NULL;
+static char             master_path[64];
+
+static uint32   master_tick_us  = 1000u;
+static uint64_t master_end_us   = 0u;       /* 0 = run until stopped */
+static uint32   master_pace     = 0u;
+static uint32   master_wdg_sec  = 10u;
+
+/* ================================================================== */
+
+static void Master_SignalHandler(int sig)
+{
+    (void)sig;
+    master_stop = 1;
+}
+
+static int Master_FutexWait(volatile uint32 *addr, uint32 val, uint32 timeout_ns)
+{
+    struct timespec ts = { 0, (long)timeout_ns };
+
+    return (int)syscall(SYS_futex, addr, FUTEX_WAIT, val, &ts, NULL, 0);
+}
+
+static void Master_FutexWake(volatile uint32 *addr)
+{
+    (void)syscall(SYS_futex, addr, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+static uint64_t Master_WallNs(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * MASTER_NS_PER_SEC) + (uint64_t)ts.tv_nsec;
+}
+
+static void Master_SleepUntilNs(uint64_t wall_ns)
+{
+    struct timespec ts;
+
+    ts.tv_sec  = (time_t)(wall_ns / MASTER_NS_PER_SEC);
+    ts.tv_nsec = (long)(wall_ns % MASTER_NS_PER_SEC);
+    while ((clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) &&
+           (master_stop == 0)) {
+        /* Signal other than a stop request: sleep again */
+    }
+}
+
+static uint32 Master_ParseU32(const char *arg, const char *opt)
+{
+    char *end = NULL;
+    unsigned long v = strtoul(arg, &end, 10);
+
+    if ((end == arg) || (*end != '\0') || (v > UINT32_MAX)) {
+        (void)fprintf(stderr, "sil_time_master: bad value for %s: %s\n", opt, arg);
+        exit(EXIT_FAILURE);
+    }
+    return (uint32)v;
+}
+
+/* ================================================================== */
+
+/**
+ * @brief  Create a fresh segment (a stale one from a crashed run is removed)
+ */
+static void Master_Create(const char *name, uint32 slots)
+{
+    int fd;
+
+    (void)snprintf(master_path, sizeof(master_path), "/%s", name);
+    (void)shm_unlink(master_path);
+
+    fd = shm_open(master_path, O_RDWR | O_CREAT | O_EXCL, 0666);
+    if ((fd < 0) || (ftruncate(fd, (off_t)sizeof(Sil_TimeShmType)) != 0)) {
+        (void)fprintf(stderr, "sil_time_master: cannot create %s: %s\n",
+                      master_path, strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+    (void)fchmod(fd, 0666);     /* Participants may run as other users */
+
+    master_shm = (Sil_TimeShmType *)mmap(NULL, sizeof(Sil_TimeShmType),
+                                         PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (master_shm == (Sil_TimeShmType *)MAP_FAILED) {
+        (void)fprintf(stderr, "sil_time_master: mmap failed: %s\n", strerror(errno));
+        (void)shm_unlink(master_path);
+        exit(EXIT_FAILURE);
+    }
+
+    (void)memset(master_shm, 0, sizeof(Sil_TimeShmType));
+    master_shm->version   = SIL_TIME_SHM_VERSION;
+    master_shm->slotCount = slots;
+    master_shm->tickUs    = master_tick_us;
+    master_shm->nowUs     = 0u;
+    master_shm->turn      = SIL_TIME_TURN_MASTER;
+    master_shm->running   = 1u;
+    __atomic_store_n(&master_shm->magic, SIL_TIME_SHM_MAGIC, __ATOMIC_RELEASE);
+}
+
+static uint32 Master_CountAttached(void)
+{
+    uint32 n = 0u;
+    uint32 i;
+
+    for (i = 0u; i < SIL_TIME_MAX_SLOTS; i++) {
+        if (__atomic_load_n(&master_shm->slot[i].state, __ATOMIC_ACQUIRE) ==
+            SIL_TIME_SLOT_ATTACHED) {
+            n++;
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief  Start barrier: all expected participants attached
+ * @return 0 when complete, -1 when stopped before
+ */
+static int Master_WaitForParticipants(uint32 slots)
+{
+    uint64_t report = Master_WallNs();
+
+    while (Master_CountAttached() < slots) {
+        if (master_stop != 0) {
+            return -1;
+        }
+        if (Master_WallNs() >= report) {
+            (void)fprintf(stderr, "[sil_time_master] %s: %u of %u participants attached\n",
+                          master_path, (unsigned)Master_CountAttached(), (unsigned)slots);
+            report += (uint64_t)MASTER_REPORT_SEC * MASTER_NS_PER_SEC;
+        }
+        Master_SleepUntilNs(Master_WallNs() + MASTER_POLL_NS);
+    }
+    return 0;
+}
+
+/**
+ * @brief  Give one participant the turn and wait until it hands it back
+ */
+static void Master_Grant(uint32 slot)
+{
+    Sil_TimeShmSlotType *s = &master_shm->slot[slot];
+    uint64_t wdg_ns = Master_WallNs() + ((uint64_t)master_wdg_sec * MASTER_NS_PER_SEC);
+
+    __atomic_store_n(&master_shm->turn, slot, __ATOMIC_RELEASE);
+    (void)__atomic_add_fetch(&s->go, 1u, __ATOMIC_ACQ_REL);
+    Master_FutexWake(&s->go);
+
+    while (__atomic_load_n(&master_shm->turn, __ATOMIC_ACQUIRE) == slot) {
+        (void)Master_FutexWait(&master_shm->turn, slot, MASTER_TURN_POLL_NS);
+
+        if (Master_WallNs() >= wdg_ns) {
+            uint32 expected = slot;
+
+            /* Hung or killed without detaching: take the turn back */
+            __atomic_store_n(&s->state, SIL_TIME_SLOT_DETACHED, __ATOMIC_RELEASE);
+            if (__atomic_compare_exchange_n(&master_shm->turn, &expected,
+                                            SIL_TIME_TURN_MASTER, 0,
+                                            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) != 0) {
+                (void)fprintf(stderr,
+                    "[sil_time_master] slot %u held its turn > %u s at %llu us: dropped\n",
+                    (unsigned)slot, (unsigned)master_wdg_sec,
+                    (unsigned long long)master_shm->nowUs);
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Run virtual time until stopped, the end time, or no participant
+ * @return Number of time steps
+ */
+static uint64_t Master_Run(void)
+{
+    uint64_t steps = 0u;
+    uint64_t wall_origin = Master_WallNs();
+
+    while (master_stop == 0) {
+        uint64_t now  = master_shm->nowUs;
+        uint64_t next = UINT64_MAX;
+        uint32 i;
+
+        /* Due participants, one at a time, always in slot order */
+        for (i = 0u; i < SIL_TIME_MAX_SLOTS; i++) {
+            Sil_TimeShmSlotType *s = &master_shm->slot[i];
+
+            if ((__atomic_load_n(&s->state, __ATOMIC_ACQUIRE) == SIL_TIME_SLOT_ATTACHED) &&
+                (s->wakeUs <= now)) {
+                Master_Grant(i);
+            }
+        }
+
+        for (i = 0u; i < SIL_TIME_MAX_SLOTS; i++) {
+            Sil_TimeShmSlotType *s = &master_shm->slot[i];
+
+            if ((__atomic_load_n(&s->state, __ATOMIC_ACQUIRE) == SIL_TIME_SLOT_ATTACHED) &&
+                (s->wakeUs < next)) {
+                next = s->wakeUs;
+            }
+        }
+
+        if (next == UINT64_MAX) {
+            (void)fprintf(stderr, "[sil_time_master] all participants left\n");
+            break;
+        }
+        if (next <= now) {
+            continue;           /* Woken again in this tick (zero sleep) */
+        }
+
+        /* Idle ticks are skipped: jump to the next wake-up on the grid */
+        next = ((next + master_tick_us - 1u) / master_tick_us) * master_tick_us;
+        if ((master_end_us != 0u) && (next > master_end_us)) {
+            break;
+        }
+
+        if (master_pace != 0u) {
+            Master_SleepUntilNs(wall_origin + ((next * 1000u) / master_pace));
+        }
+
+        __atomic_store_n(&master_shm->nowUs, next, __ATOMIC_RELEASE);
+        steps++;
+    }
+
+    return steps;
+}
+
+/**
+ * @brief  Tell every participant the run is over and remove the segment
+ */
+static void Master_End(void)
+{
+    uint32 i;
+
+    __atomic_store_n(&master_shm->running, 0u, __ATOMIC_RELEASE);
+    for (i = 0u; i < SIL_TIME_MAX_SLOTS; i++) {
+        (void)__atomic_add_fetch(&master_shm->slot[i].go, 1u, __ATOMIC_ACQ_REL);
+        Master_FutexWake(&master_shm->slot[i].go);
+    }
+
+    (void)shm_unlink(master_path);
+}
+
+static void Master_PrintStats(uint64_t steps, uint64_t wall_ns)
+{
+    uint64_t now = master_shm->nowUs;
+    uint32 i;
+
+    (void)fprintf(stderr,
+        "[sil_time_master] %llu us virtual in %llu us wall (%.1fx), %llu steps\n",
+        (unsigned long long)now, (unsigned long long)(wall_ns / 1000u),
+        (wall_ns > 0u) ? ((double)now * 1000.0) / (double)wall_ns : 0.0,
+        (unsigned long long)steps);
+
+    for (i = 0u; i < SIL_TIME_MAX_SLOTS; i++) {
+        if (master_shm->slot[i].state != SIL_TIME_SLOT_FREE) {
+            (void)fprintf(stderr, "[sil_time_master]   slot %2u: %lu turns%s\n",
+                          (unsigned)i, (unsigned long)master_shm->slot[i].grants,
+                          (master_shm->slot[i].state == SIL_TIME_SLOT_DETACHED) ?
+                          " (detached)" : "");
+        }
+    }
+}
+
+/* ================================================================== */
+
+int main(int argc, char *argv[])
+{
+    const char *name = getenv("SIL_TIME_MASTER");
+    uint32 slots = 1u;
+    uint64_t wall_start;
+    uint64_t steps;
+    int opt;
+
+    if ((name == NULL) || (name[0] == '\0')) {
+        name = "taktflow_sil_time";
+    }
+
+    while ((opt = getopt(argc, argv, "n:s:t:d:x:w:")) != -1) {
+        switch (opt) {
+        case 'n': name            = optarg;                                  break;
+        case 's': slots           = Master_ParseU32(optarg, "-s");           break;
+        case 't': master_tick_us  = Master_ParseU32(optarg, "-t");           break;
+        case 'd': master_end_us   = (uint64_t)(strtod(optarg, NULL) * 1e6);  break;
+        case 'x': master_pace     = Master_ParseU32(optarg, "-x");           break;
+        case 'w': master_wdg_sec  = Master_ParseU32(optarg, "-w");           break;
+        default:
+            (void)fprintf(stderr, "usage: %s [-n name] [-s slots] [-t tick_us] "
+                                  "[-d seconds] [-x pace] [-w seconds]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((slots == 0u) || (slots > SIL_TIME_MAX_SLOTS) || (master_tick_us == 0u)) {
+        (void)fprintf(stderr, "sil_time_master: need 1..%u slots and a tick > 0\n",
+                      (unsigned)SIL_TIME_MAX_SLOTS);
+        return EXIT_FAILURE;
+    }
+
+    (void)signal(SIGINT, Master_SignalHandler);
+    (void)signal(SIGTERM, Master_SignalHandler);
+
+    Master_Create(name, slots);
+    (void)fprintf(stderr, "[sil_time_master] %s: %u slots, tick %u us, pace %s\n",
+                  master_path, (unsigned)slots, (unsigned)master_tick_us,
+                  (master_pace == 0u) ? "unlimited" : "limited");
+
+    if (Master_WaitForParticipants(slots) != 0) {
+        Master_End();
+        return EXIT_SUCCESS;
+    }
+
+    wall_start = Master_WallNs();
+    steps = Master_Run();
+    Master_PrintStats(steps, Master_WallNs() - wall_start);
+    Master_End();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file    Sil_TimeShm.h
+ * @brief   Lockstep SIL time — shared memory layout of the time master
+ * @date    2026-03-19
+ *
+ * @details The time master (Sil_TimeMaster.c) creates one POSIX shared
+ *          memory segment; every participant (ECU via Sil_Time.c, plant
+ *          simulator via gateway/plant_sim/sil_time.py) maps it and owns
+ *          one slot. The layout is fixed (little-endian, no padding) because
+ *          the Python side reads it by offset.
+ *
+ *          Protocol, one step of virtual time:
+ *          1. The master sets nowUs to the earliest wake-up of all attached
+ *             slots (rounded up to tickUs): idle ticks are skipped.
+ *          2. It grants the turn to every due slot (wakeUs <= nowUs), one
+ *             at a time in slot order: turn = slot, go++ and a futex wake on
+ *             go. Only the holder of the turn runs.
+ *          3. The holder runs its loop body, stores its next wakeUs and hands
+ *             the turn back: turn = SIL_TIME_TURN_MASTER, futex wake on turn.
+ *
+ *          All futexes are shared (not FUTEX_PRIVATE): the segment is mapped
+ *          by several processes, or containers with ipc: host.
+ *
+ * @note    SIL simulation only — not compiled for STM32/TMS570 targets.
+ *
+ * @safety_req N/A — SIL simulation only, not for production
+ * @copyright Taktflow Systems 2026
+ */
+
+#ifndef SIL_TIMESHM_H
+#define SIL_TIMESHM_H
+
+#include "Platform_Types.h"
+
+#define SIL_TIME_SHM_MAGIC      0x54534C53u     /**< "SLST" little-endian */
+#define SIL_TIME_SHM_VERSION    1u
+#define SIL_TIME_MAX_SLOTS      16u
+#define SIL_TIME_TURN_MASTER    0xFFFFFFFFu     /**< Nobody holds the turn */
+
+/* Slot states */
+#define SIL_TIME_SLOT_FREE      0u
+#define SIL_TIME_SLOT_ATTACHED  1u
+#define SIL_TIME_SLOT_DETACHED  2u              /**< Exited or dropped     */
+
+/** One participant (24 bytes) */
+typedef struct {
+    volatile uint64 wakeUs;     /**<  0: next virtual time to run at        */
+    volatile uint32 state;      /**<  8: SIL_TIME_SLOT_*                    */
+    volatile uint32 go;         /**< 12: futex, incremented per grant       */
+    volatile uint32 grants;     /**< 16: turns taken (statistics)           */
+    uint32          reserved;   /**< 20                                     */
+} Sil_TimeShmSlotType;
+
+/** Segment header followed by the slots (40 + 16 * 24 bytes) */
+typedef struct {
+    uint32          magic;      /**<  0: written last by the master         */
+    uint32          version;    /**<  4                                     */
+    uint32          slotCount;  /**<  8: participants awaited before start  */
+    uint32          tickUs;     /**< 12: virtual time granularity           */
+    volatile uint64 nowUs;      /**< 16: virtual time since start           */
+    volatile uint32 turn;       /**< 24: futex, slot holding the turn       */
+    volatile uint32 running;    /**< 28: 0 once the master ends the run     */
+    uint32          reserved[2];/**< 32                                     */
+    Sil_TimeShmSlotType slot[SIL_TIME_MAX_SLOTS];   /**< 40                 */
+} Sil_TimeShmType;
+
+/* The Python participant reads the segment by these offsets */
+typedef char sil_time_shm_slot_size_check[(sizeof(Sil_TimeShmSlotType) == 24u) ? 1 : -1];
+typedef char sil_time_shm_size_check[
+    (sizeof(Sil_TimeShmType) == (40u + (SIL_TIME_MAX_SLOTS * 24u))) ? 1 : -1];
+
+#endif /* SIL_TIMESHM_H */
@@ -0,0 +1,190 @@
+/**
+ * @file    bench_Rte_dispatch.c
+ * @brief   Host benchmark: per-tick Rte_MainFunction dispatch overhead
+ * @date    2026-03-12
+ *
+ * @details Runs the CVC, FZC and RZC runnable tables (linked from the ECU
+ *          cfg directories) with empty runnables and reports the mean cost
+ *          of one 1 ms tick for the schedule-table dispatcher in Rte.c and
+ *          for the previous dispatcher, which selection-sorted the due
+ *          runnables on every tick (kept below as reference).
+ *
+ *          Build and run:  make bench   (from firmware/shared/bsw)
+ *
+ *          Host numbers only show the relative cost; on target the ratio
+ *          is similar, absolute values scale with the core clock.
+ *
+ * @copyright Taktflow Systems 2026
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "Rte.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_TICKS     2000000u
+
+/* ==================================================================
+ * Stubs: runnables of the benchmarked configs, WdgM
+ * ================================================================== */
+
+static volatile uint32 bench_calls;
+
+#define BENCH_RUNNABLE(name)    void name(void); void name(void) { bench_calls++; }
+
+BENCH_RUNNABLE(Can_MainFunction_Read)
+BENCH_RUNNABLE(Can_MainFunction_BusOff)
+BENCH_RUNNABLE(Com_MainFunction_Rx)
+BENCH_RUNNABLE(Com_MainFunction_Tx)
+BENCH_RUNNABLE(Swc_Pedal_MainFunction)
+BENCH_RUNNABLE(Swc_VehicleState_MainFunction)
+BENCH_RUNNABLE(Swc_EStop_MainFunction)
+BENCH_RUNNABLE(Swc_Heartbeat_MainFunction)
+BENCH_RUNNABLE(Swc_Dashboard_MainFunction)
+BENCH_RUNNABLE(Swc_Steering_MainFunction)
+BENCH_RUNNABLE(Swc_Brake_MainFunction)
+BENCH_RUNNABLE(Swc_Lidar_MainFunction)
+BENCH_RUNNABLE(Swc_Buzzer_MainFunction)
+BENCH_RUNNABLE(Swc_FzcCom_Receive)
+BENCH_RUNNABLE(Swc_FzcSensorFeeder_MainFunction)
+BENCH_RUNNABLE(Swc_FzcSafety_MainFunction)
+BENCH_RUNNABLE(Swc_FzcCanMonitor_Check)
+BENCH_RUNNABLE(Swc_FzcCom_TransmitSchedule)
+BENCH_RUNNABLE(Swc_CurrentMonitor_MainFunction)
+BENCH_RUNNABLE(Swc_Motor_MainFunction)
+BENCH_RUNNABLE(Swc_Encoder_MainFunction)
+BENCH_RUNNABLE(Swc_TempMonitor_MainFunction)
+BENCH_RUNNABLE(Swc_Battery_MainFunction)
+BENCH_RUNNABLE(Swc_RzcSafety_MainFunction)
+BENCH_RUNNABLE(Swc_RzcCom_Receive)
+BENCH_RUNNABLE(Swc_RzcCom_TransmitSchedule)
+BENCH_RUNNABLE(Swc_RzcSensorFeeder_MainFunction)
+BENCH_RUNNABLE(IoHwAb_MainFunction)
+
+Std_ReturnType WdgM_CheckpointReached(uint8 SEId)
+{
+    (void)SEId;
+    return E_OK;
+}
+
+Std_ReturnType WdgM_SetEntityActive(uint8 SEId, boolean Active)
+{
+    (void)SEId;
+    (void)Active;
+    return E_OK;
+}
+
+extern const Rte_ConfigType cvc_rte_config;
+extern const Rte_ConfigType fzc_rte_config;
+extern const Rte_ConfigType rzc_rte_config;
+
+/* ==================================================================
+ * Reference: previous dispatcher (selection sort on every tick)
+ * ================================================================== */
+
+static void legacy_dispatch(const Rte_ConfigType* cfg, uint32 tick)
+{
+    uint8 i;
+    boolean visited[RTE_MAX_RUNNABLES];
+    boolean se_checkpointed[RTE_MAX_RUNNABLES];
+
+    for (i = 0u; i < RTE_MAX_RUNNABLES; i++) {
+        visited[i] = FALSE;
+        se_checkpointed[i] = FALSE;
+    }
+
+    for (uint8 pass = 0u; pass < cfg->runnableCount; pass++) {
+        uint8 best_idx = 0xFFu;
+        uint8 best_priority = 0u;
+        boolean found = FALSE;
+
+        for (i = 0u; i < cfg->runnableCount; i++) {
+            if (visited[i] == TRUE) {
+                continue;
+            }
+            const Rte_RunnableConfigType* r = &cfg->runnableConfig[i];
+            if (r->func == NULL_PTR) {
+                visited[i] = TRUE;
+                continue;
+            }
+            if ((r->periodMs == 0u) || ((tick % r->periodMs) != 0u)) {
+                visited[i] = TRUE;
+                continue;
+            }
+            if ((found == FALSE) || (r->priority > best_priority)) {
+                best_idx = i;
+                best_priority = r->priority;
+                found = TRUE;
+            }
+        }
+
+        if (found == FALSE) {
+            break;
+        }
+
+        visited[best_idx] = TRUE;
+        cfg->runnableConfig[best_idx].func();
+
+        uint8 se = cfg->runnableConfig[best_idx].seId;
+        if ((se < RTE_MAX_RUNNABLES) && (se_checkpointed[se] == FALSE)) {
+            (void)WdgM_CheckpointReached(se);
+            se_checkpointed[se] = TRUE;
+        }
+    }
+}
+
+/* ==================================================================
+ * Measurement
+ * ================================================================== */
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+static void bench_config(const char* name, const Rte_ConfigType* cfg)
+{
+    uint32 tick;
+    uint32 calls_table;
+    uint32 calls_legacy;
+    double t0;
+    double ns_table;
+    double ns_legacy;
+
+    Rte_Init(cfg);
+    bench_calls = 0u;
+    t0 = now_ns();
+    for (tick = 1u; tick <= BENCH_TICKS; tick++) {
+        Rte_MainFunction();
+    }
+    ns_table = (now_ns() - t0) / (double)BENCH_TICKS;
+    calls_table = bench_calls;
+
+    bench_calls = 0u;
+    t0 = now_ns();
+    for (tick = 1u; tick <= BENCH_TICKS; tick++) {
+        legacy_dispatch(cfg, tick);
+    }
+    ns_legacy = (now_ns() - t0) / (double)BENCH_TICKS;
+    calls_legacy = bench_calls;
+
+    (void)printf("%-4s %9u %9.2f %10.2f %10.2f %8.1fx%s\n",
+                 name, (unsigned)cfg->runnableCount,
+                 (double)calls_table / (double)BENCH_TICKS,
+                 ns_table, ns_legacy, ns_legacy / ns_table,
+                 (calls_table == calls_legacy) ? "" : "  MISMATCH");
+}
+
+int main(void)
+{
+    (void)printf("Rte dispatch, %u ticks per config (mean per 1 ms tick)\n",
+                 (unsigned)BENCH_TICKS);
+    (void)printf("ECU  runnables  due/tick table [ns] legacy [ns]  speedup\n");
+    bench_config("CVC", &cvc_rte_config);
+    bench_config("FZC", &fzc_rte_config);
+    bench_config("RZC", &rzc_rte_config);
+    return 0;
+}
@@ -0,0 +1,251 @@
+/**
+ * @file    test_Adc_Posix.c
+ * @brief   Unit tests for Adc_Posix — simulated ADC backend
+ * @date    2026-03-25
+ *
+ * @verifies SWR-BSW-007
+ *
+ * Tests the continuous scan stand-in (DMA double buffer filled at
+ * Adc_Posix_Poll, one scan per elapsed scan period) and the oversampling
+ * model: a result is the truncated mean of 2^OversamplingShift
+ * conversions of the injected sample sequence.
+ * Adc_Isr, normally in Adc.c, is mocked here.
+ *
+ * @copyright Taktflow Systems 2026
+ */
+#include "unity.h"
+
+#include "../mcal/posix/Adc_Posix.c"
+
+/* ==================================================================
+ * Mock: Adc_Isr — records the completed halves
+ * ================================================================== */
+
+static uint8  mock_isr_count;
+static uint8  mock_isr_group;
+static uint8  mock_isr_half;
+
+void Adc_Isr(uint8 Group, uint8 Half)
+{
+    mock_isr_count++;
+    mock_isr_group = Group;
+    mock_isr_half  = Half;
+}
+
+static uint16 dma_buf[2u * ADC_MAX_CHANNELS_PER_GROUP];
+
+void setUp(void)
+{
+    uint8 i;
+
+    mock_isr_count = 0u;
+    mock_isr_group = 0xFFu;
+    mock_isr_half  = 0xFFu;
+    for (i = 0u; i < (2u * ADC_MAX_CHANNELS_PER_GROUP); i++) {
+        dma_buf[i] = 0xFFFFu;
+    }
+    (void)Adc_Hw_Init();
+}
+
+void tearDown(void) { }
+
+/* ==================================================================
+ * Continuous scan: double buffer
+ * ================================================================== */
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Posix_start_scans_half0_at_once(void)
+{
+    Adc_Posix_InjectValue(2u, 0u, 1500u);
+    Adc_Posix_InjectValue(2u, 1u, 2500u);
+
+    TEST_ASSERT_EQUAL(E_OK, Adc_Hw_StartContinuous(2u, dma_buf, 2u, 0u, 1000u));
+
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_isr_count);
+    TEST_ASSERT_EQUAL_UINT8(2u, mock_isr_group);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_isr_half);
+    TEST_ASSERT_EQUAL_UINT16(1500u, dma_buf[0]);
+    TEST_ASSERT_EQUAL_UINT16(2500u, dma_buf[1]);
+    TEST_ASSERT_EQUAL_HEX16(0xFFFFu, dma_buf[2]);   /* Half 1 untouched */
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Posix_poll_alternates_halves(void)
+{
+    Adc_Posix_InjectValue(0u, 0u, 100u);
+    (void)Adc_Hw_StartContinuous(0u, dma_buf, 1u, 0u, 1000u);
+
+    Adc_Posix_InjectValue(0u, 0u, 200u);
+    Adc_Posix_Poll();
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_isr_half);
+    TEST_ASSERT_EQUAL_UINT16(100u, dma_buf[0]);
+    TEST_ASSERT_EQUAL_UINT16(200u, dma_buf[1]);
+
+    Adc_Posix_InjectValue(0u, 0u, 300u);
+    Adc_Posix_Poll();
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_isr_half);
+    TEST_ASSERT_EQUAL_UINT16(300u, dma_buf[0]);
+    TEST_ASSERT_EQUAL_UINT8(3u, mock_isr_count);
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Posix_stop_ends_scans(void)
+{
+    (void)Adc_Hw_StartContinuous(0u, dma_buf, 1u, 0u, 1000u);
+    Adc_Hw_StopContinuous(0u);
+
+    Adc_Posix_Poll();
+
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_isr_count);
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Posix_slow_group_scans_once_per_period(void)
+{
+    uint8 i;
+
+    (void)Adc_Hw_StartContinuous(0u, dma_buf, 1u, 0u, 10000u);   /* 10 ms */
+
+    for (i = 0u; i < 9u; i++) {
+        Adc_Posix_Poll();
+    }
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_isr_count);   /* Start scan only */
+
+    Adc_Posix_Poll();
+    TEST_ASSERT_EQUAL_UINT8(2u, mock_isr_count);
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_isr_half);
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Posix_fast_group_scans_every_elapsed_period(void)
+{
+    (void)Adc_Hw_StartContinuous(0u, dma_buf, 1u, 0u, 500u);
+
+    Adc_Posix_Poll();
+
+    TEST_ASSERT_EQUAL_UINT8(3u, mock_isr_count);   /* Start + 2 per ms */
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_isr_half);
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Posix_start_rejects_invalid_params(void)
+{
+    TEST_ASSERT_EQUAL(E_NOT_OK, Adc_Hw_StartContinuous(0u, NULL_PTR, 1u, 0u, 1000u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Adc_Hw_StartContinuous(0u, dma_buf, 0u, 0u, 1000u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Adc_Hw_StartContinuous(0u, dma_buf, 1u,
+                                                       ADC_MAX_OVERSAMPLING_SHIFT + 1u,
+                                                       1000u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Adc_Hw_StartContinuous(0u, dma_buf, 1u, 0u, 0u));
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_isr_count);
+}
+
+/* ==================================================================
+ * Oversampling: mean of 2^shift conversions
+ * ================================================================== */
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Posix_oversampling_averages_2_pow_shift_samples(void)
+{
+    /* 16 noisy samples around 2000, mean 2003.5 -> 2003 (truncated) */
+    static const uint16 noise[16] = {
+        1990u, 2010u, 1995u, 2015u, 2000u, 2008u, 1992u, 2012u,
+        1998u, 2006u, 1994u, 2014u, 2001u, 2009u, 1993u, 2019u
+    };
+
+    Adc_Posix_InjectSamples(0u, 0u, noise, 16u);
+    (void)Adc_Hw_StartContinuous(0u, dma_buf, 1u, 4u, 1000u);
+
+    TEST_ASSERT_EQUAL_UINT16(2003u, dma_buf[0]);
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Posix_oversampling_uses_consecutive_conversions(void)
+{
+    static const uint16 ramp[4] = { 100u, 200u, 300u, 400u };
+
+    Adc_Posix_InjectSamples(0u, 0u, ramp, 4u);
+    (void)Adc_Hw_StartContinuous(0u, dma_buf, 1u, 1u, 1000u);   /* 2 samples */
+
+    TEST_ASSERT_EQUAL_UINT16(150u, dma_buf[0]);          /* (100 + 200) / 2 */
+    Adc_Posix_Poll();
+    TEST_ASSERT_EQUAL_UINT16(350u, dma_buf[1]);          /* (300 + 400) / 2 */
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Posix_no_oversampling_takes_one_sample(void)
+{
+    static const uint16 ramp[4] = { 100u, 200u, 300u, 400u };
+
+    Adc_Posix_InjectSamples(0u, 0u, ramp, 4u);
+    (void)Adc_Hw_StartContinuous(0u, dma_buf, 1u, 0u, 1000u);
+    Adc_Posix_Poll();
+
+    TEST_ASSERT_EQUAL_UINT16(100u, dma_buf[0]);
+    TEST_ASSERT_EQUAL_UINT16(200u, dma_buf[1]);
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Posix_oversampling_full_scale_no_overflow(void)
+{
+    Adc_Posix_InjectValue(0u, 0u, 4095u);
+    (void)Adc_Hw_StartContinuous(0u, dma_buf, 1u, ADC_MAX_OVERSAMPLING_SHIFT,
+                                 1000u);
+
+    TEST_ASSERT_EQUAL_UINT16(4095u, dma_buf[0]);
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Posix_oneshot_read_takes_one_sample(void)
+{
+    static const uint16 ramp[2] = { 100u, 200u };
+    uint16 result = 0u;
+
+    Adc_Posix_InjectSamples(1u, 0u, ramp, 2u);
+    (void)Adc_Hw_StartConversion(1u);
+    (void)Adc_Hw_ReadResult(1u, &result, 1u);
+    TEST_ASSERT_EQUAL_UINT16(100u, result);
+
+    (void)Adc_Hw_StartConversion(1u);
+    (void)Adc_Hw_ReadResult(1u, &result, 1u);
+    TEST_ASSERT_EQUAL_UINT16(200u, result);
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Posix_inject_samples_rejects_bad_count(void)
+{
+    static const uint16 samples[ADC_POSIX_MAX_SAMPLES + 1u] = { 0u };
+
+    Adc_Posix_InjectValue(0u, 0u, 1234u);
+    Adc_Posix_InjectSamples(0u, 0u, samples, 0u);
+    Adc_Posix_InjectSamples(0u, 0u, samples, ADC_POSIX_MAX_SAMPLES + 1u);
+    (void)Adc_Hw_StartContinuous(0u, dma_buf, 1u, 0u, 1000u);
+
+    TEST_ASSERT_EQUAL_UINT16(1234u, dma_buf[0]);
+}
+
+/* ==================================================================
+ * Test runner
+ * ================================================================== */
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    /* Continuous scan: double buffer */
+    RUN_TEST(test_Adc_Posix_start_scans_half0_at_once);
+    RUN_TEST(test_Adc_Posix_poll_alternates_halves);
+    RUN_TEST(test_Adc_Posix_stop_ends_scans);
+    RUN_TEST(test_Adc_Posix_slow_group_scans_once_per_period);
+    RUN_TEST(test_Adc_Posix_fast_group_scans_every_elapsed_period);
+    RUN_TEST(test_Adc_Posix_start_rejects_invalid_params);
+
+    /* Oversampling */
+    RUN_TEST(test_Adc_Posix_oversampling_averages_2_pow_shift_samples);
+    RUN_TEST(test_Adc_Posix_oversampling_uses_consecutive_conversions);
+    RUN_TEST(test_Adc_Posix_no_oversampling_takes_one_sample);
+    RUN_TEST(test_Adc_Posix_oversampling_full_scale_no_overflow);
+    RUN_TEST(test_Adc_Posix_oneshot_read_takes_one_sample);
+    RUN_TEST(test_Adc_Posix_inject_samples_rejects_bad_count);
+
+    return UNITY_END();
+}
@@ -6,8 +6,9 @@
  * @verifies SWR-BSW-007
  *
  * Tests ADC driver initialization, group conversion start, result
- * reading, and defensive error handling. Hardware is mocked via
- * Adc_Hw_* stub functions defined in this file.
+ * reading, the continuous scan with DMA double buffer, and defensive
+ * error handling. Hardware is mocked via Adc_Hw_* stub functions
+ * defined in this file.
  */
 #include "unity.h"
 #include "Adc.h"
@@ -62,6 +63,47 @@ uint8 Adc_Hw_GetStatus(uint8 Group)
     return mock_hw_status;
 }
 
+/* ---- Continuous scan mock: the test plays the DMA ---- */
+
+static uint16*      mock_dma_buf;
+static uint8        mock_dma_channels;
+static uint8        mock_dma_ovs_shift;
+static uint16       mock_dma_period_us;
+static uint8        mock_dma_start_count;
+static uint8        mock_dma_stop_count;
+static boolean      mock_dma_start_fail;
+
+Std_ReturnType Adc_Hw_StartContinuous(uint8 Group, uint16* DmaBuffer,
+                                      uint8 NumChannels, uint8 OversamplingShift,
+                                      uint16 ScanPeriodUs)
+{
+    (void)Group;
+    mock_dma_start_count++;
+    if (mock_dma_start_fail) {
+        return E_NOT_OK;
+    }
+    mock_dma_buf = DmaBuffer;
+    mock_dma_channels = NumChannels;
+    mock_dma_ovs_shift = OversamplingShift;
+    mock_dma_period_us = ScanPeriodUs;
+    return E_OK;
+}
+
+void Adc_Hw_StopContinuous(uint8 Group)
+{
+    (void)Group;
+    mock_dma_stop_count++;
+}
+
+/** Fill one half of the DMA buffer with Value and raise its interrupt */
+static void mock_dma_complete(uint8 Group, uint8 Half, uint16 Value)
+{
+    for (uint8 i = 0u; i < mock_dma_channels; i++) {
+        mock_dma_buf[(Half * mock_dma_channels) + i] = (uint16)(Value + i);
+    }
+    Adc_Isr(Group, Half);
+}
+
 /* ==================================================================
  * Test Fixtures
  * ================================================================== */
@@ -79,6 +121,13 @@ void setUp(void)
     mock_hw_start_group = 0xFFu;
     mock_hw_status = 0u;
     mock_hw_read_fail = FALSE;
+    mock_dma_buf = NULL_PTR;
+    mock_dma_channels = 0u;
+    mock_dma_ovs_shift = 0u;
+    mock_dma_period_us = 0u;
+    mock_dma_start_count = 0u;
+    mock_dma_stop_count = 0u;
+    mock_dma_start_fail = FALSE;
 
     for (uint8 g = 0u; g < ADC_MAX_GROUPS; g++) {
         mock_result_count[g] = 0u;
@@ -89,11 +138,17 @@ void setUp(void)
 
     /* Group 0: current sensing (2 channels) */
     test_groups[0].numChannels = 2u;
-    test_groups[0].triggerSource = 0u; /* Software trigger */
+    test_groups[0].triggerSource = ADC_TRIGGER_SW;
+    test_groups[0].conversionMode = ADC_CONV_MODE_ONESHOT;
+    test_groups[0].oversamplingShift = 0u;
+    test_groups[0].scanPeriodUs = 0u;
 
     /* Group 1: temperature (1 channel) */
     test_groups[1].numChannels = 1u;
-    test_groups[1].triggerSource = 0u;
+    test_groups[1].triggerSource = ADC_TRIGGER_SW;
+    test_groups[1].conversionMode = ADC_CONV_MODE_ONESHOT;
+    test_groups[1].oversamplingShift = 0u;
+    test_groups[1].scanPeriodUs = 0u;
 
     test_config.numGroups = 2u;
     test_config.groups = test_groups;
@@ -402,6 +457,186 @@ void test_Adc_StartGroupConversion_hw_failure_reverts_to_idle(void)
     TEST_ASSERT_EQUAL(ADC_BUSY, Adc_GetStatus());
 }
 
+/* ==================================================================
+ * SWR-BSW-007: Continuous Scan, DMA Double Buffer, Oversampling
+ * ================================================================== */
+
+static void set_continuous_group0(void)
+{
+    test_groups[0].triggerSource = ADC_TRIGGER_TIMER;
+    test_groups[0].conversionMode = ADC_CONV_MODE_CONTINUOUS;
+    test_groups[0].oversamplingShift = 4u;
+    test_groups[0].scanPeriodUs = 1000u;
+}
+
+static void use_continuous_group0(void)
+{
+    set_continuous_group0();
+    Adc_Init(&test_config);
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Continuous_start_passes_buffer_and_oversampling(void)
+{
+    use_continuous_group0();
+
+    TEST_ASSERT_EQUAL(E_OK, Adc_StartGroupConversion(0u));
+
+    TEST_ASSERT_NOT_NULL(mock_dma_buf);
+    TEST_ASSERT_EQUAL_UINT8(2u, mock_dma_channels);
+    TEST_ASSERT_EQUAL_UINT8(4u, mock_dma_ovs_shift);
+    TEST_ASSERT_EQUAL_UINT16(1000u, mock_dma_period_us);
+    TEST_ASSERT_FALSE(mock_hw_start_called);
+    TEST_ASSERT_EQUAL(ADC_IDLE, Adc_GetStatus());
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Continuous_no_result_before_first_scan(void)
+{
+    uint16 buf[ADC_MAX_CHANNELS_PER_GROUP] = {0u};
+
+    use_continuous_group0();
+    (void)Adc_StartGroupConversion(0u);
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Adc_ReadGroup(0u, buf));
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Continuous_read_returns_last_complete_half(void)
+{
+    uint16 buf[ADC_MAX_CHANNELS_PER_GROUP] = {0u};
+
+    use_continuous_group0();
+    (void)Adc_StartGroupConversion(0u);
+
+    mock_dma_complete(0u, 0u, 1000u);
+    TEST_ASSERT_EQUAL(E_OK, Adc_ReadGroup(0u, buf));
+    TEST_ASSERT_EQUAL_UINT16(1000u, buf[0]);
+    TEST_ASSERT_EQUAL_UINT16(1001u, buf[1]);
+
+    mock_dma_complete(0u, 1u, 2000u);
+    TEST_ASSERT_EQUAL(E_OK, Adc_ReadGroup(0u, buf));
+    TEST_ASSERT_EQUAL_UINT16(2000u, buf[0]);
+
+    /* Read again without a new scan: same result, no conversion wait */
+    TEST_ASSERT_EQUAL(E_OK, Adc_ReadGroup(0u, buf));
+    TEST_ASSERT_EQUAL_UINT16(2000u, buf[0]);
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Continuous_restart_is_noop(void)
+{
+    uint16 buf[ADC_MAX_CHANNELS_PER_GROUP] = {0u};
+
+    use_continuous_group0();
+    (void)Adc_StartGroupConversion(0u);
+    mock_dma_complete(0u, 0u, 1234u);
+
+    TEST_ASSERT_EQUAL(E_OK, Adc_StartGroupConversion(0u));
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_dma_start_count);
+    TEST_ASSERT_EQUAL(E_OK, Adc_ReadGroup(0u, buf));
+    TEST_ASSERT_EQUAL_UINT16(1234u, buf[0]);
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Continuous_stop(void)
+{
+    uint16 buf[ADC_MAX_CHANNELS_PER_GROUP] = {0u};
+
+    use_continuous_group0();
+    (void)Adc_StartGroupConversion(0u);
+    mock_dma_complete(0u, 0u, 1234u);
+
+    TEST_ASSERT_EQUAL(E_OK, Adc_StopGroupConversion(0u));
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_dma_stop_count);
+    TEST_ASSERT_EQUAL(E_NOT_OK, Adc_ReadGroup(0u, buf));
+
+    /* Late interrupt after the stop is ignored */
+    Adc_Isr(0u, 1u);
+    TEST_ASSERT_EQUAL(E_NOT_OK, Adc_ReadGroup(0u, buf));
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Continuous_start_failure(void)
+{
+    uint16 buf[ADC_MAX_CHANNELS_PER_GROUP] = {0u};
+
+    use_continuous_group0();
+    mock_dma_start_fail = TRUE;
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Adc_StartGroupConversion(0u));
+    Adc_Isr(0u, 0u);
+    TEST_ASSERT_EQUAL(E_NOT_OK, Adc_ReadGroup(0u, buf));
+
+    /* Next start tries again */
+    mock_dma_start_fail = FALSE;
+    TEST_ASSERT_EQUAL(E_OK, Adc_StartGroupConversion(0u));
+    TEST_ASSERT_EQUAL_UINT8(2u, mock_dma_start_count);
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Stop_oneshot_group_rejected(void)
+{
+    Adc_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Adc_StopGroupConversion(1u));
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Init_oversampling_out_of_range_stays_uninit(void)
+{
+    set_continuous_group0();
+    test_groups[0].oversamplingShift = ADC_MAX_OVERSAMPLING_SHIFT + 1u;
+    Adc_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(ADC_UNINIT, Adc_GetStatus());
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Init_free_running_scan_stays_uninit(void)
+{
+    set_continuous_group0();
+    test_groups[0].triggerSource = ADC_TRIGGER_SW;
+    Adc_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(ADC_UNINIT, Adc_GetStatus());
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Init_scan_period_below_minimum_stays_uninit(void)
+{
+    set_continuous_group0();
+    test_groups[0].scanPeriodUs = ADC_MIN_SCAN_PERIOD_US - 1u;
+    Adc_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(ADC_UNINIT, Adc_GetStatus());
+
+    test_groups[0].scanPeriodUs = ADC_MIN_SCAN_PERIOD_US;
+    Adc_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(ADC_IDLE, Adc_GetStatus());
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_Init_oversampling_on_oneshot_stays_uninit(void)
+{
+    test_groups[1].oversamplingShift = 2u;
+    Adc_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(ADC_UNINIT, Adc_GetStatus());
+}
+
+/** @verifies SWR-BSW-007 */
+void test_Adc_DeInit_stops_running_scan(void)
+{
+    use_continuous_group0();
+    (void)Adc_StartGroupConversion(0u);
+
+    Adc_DeInit();
+
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_dma_stop_count);
+}
+
 /* ==================================================================
  * Test Runner
  * ================================================================== */
@@ -449,5 +684,19 @@ int main(void)
     /* Hardened: HW failure path */
     RUN_TEST(test_Adc_StartGroupConversion_hw_failure_reverts_to_idle);
 
+    /* Continuous scan, DMA double buffer, oversampling */
+    RUN_TEST(test_Adc_Continuous_start_passes_buffer_and_oversampling);
+    RUN_TEST(test_Adc_Continuous_no_result_before_first_scan);
+    RUN_TEST(test_Adc_Continuous_read_returns_last_complete_half);
+    RUN_TEST(test_Adc_Continuous_restart_is_noop);
+    RUN_TEST(test_Adc_Continuous_stop);
+    RUN_TEST(test_Adc_Continuous_start_failure);
+    RUN_TEST(test_Adc_Stop_oneshot_group_rejected);
+    RUN_TEST(test_Adc_Init_oversampling_out_of_range_stays_uninit);
+    RUN_TEST(test_Adc_Init_free_running_scan_stays_uninit);
+    RUN_TEST(test_Adc_Init_scan_period_below_minimum_stays_uninit);
+    RUN_TEST(test_Adc_Init_oversampling_on_oneshot_stays_uninit);
+    RUN_TEST(test_Adc_DeInit_stops_running_scan);
+
     return UNITY_END();
 }
@@ -47,6 +47,30 @@ static void Action_Shutdown(void)
     mock_action_shutdown_count++;
 }
 
+static uint8 mock_switch_count;
+static uint8 mock_switch_mode;
+
+static void Mock_ModeSwitch(uint8 Mode)
+{
+    mock_switch_count++;
+    mock_switch_mode = Mode;
+}
+
+static uint16 mock_runnable_mask;
+static uint8  mock_ipdu_groups;
+static uint8  mock_control_count;
+
+static void Mock_RunnableControl(uint16 RunnableMask)
+{
+    mock_runnable_mask = RunnableMask;
+    mock_control_count++;
+}
+
+static void Mock_IpduGroupControl(uint8 IpduGroups)
+{
+    mock_ipdu_groups = IpduGroups;
+}
+
 /* ==================================================================
  * Test Configuration
  * ================================================================== */
@@ -59,6 +83,14 @@ static const BswM_ModeActionType test_mode_actions[] = {
     { BSWM_SHUTDOWN,  Action_Shutdown  },
 };
 
+static const BswM_ModeControlType test_mode_controls[BSWM_MODE_COUNT] = {
+    [BSWM_STARTUP]   = { 0xFFFFu, 0xFFu },
+    [BSWM_RUN]       = { 0x00FFu, 0x03u },
+    [BSWM_DEGRADED]  = { 0x007Fu, 0x01u },
+    [BSWM_SAFE_STOP] = { 0x000Fu, 0x01u },
+    [BSWM_SHUTDOWN]  = { 0x0001u, 0x00u },
+};
+
 static BswM_ConfigType test_config;
 
 void setUp(void)
@@ -69,8 +101,18 @@ void setUp(void)
     mock_action_safe_stop_count = 0u;
     mock_action_shutdown_count  = 0u;
 
+    mock_switch_count           = 0u;
+    mock_switch_mode            = 0xFFu;
+
     test_config.ModeActions     = test_mode_actions;
     test_config.ActionCount     = 5u;
+    test_config.ModeSwitchNotification = NULL_PTR;
+    test_config.ModeControls    = NULL_PTR;
+    test_config.RunnableControl = NULL_PTR;
+    test_config.IpduGroupControl = NULL_PTR;
+    mock_runnable_mask          = 0u;
+    mock_ipdu_groups            = 0u;
+    mock_control_count          = 0u;
 
     BswM_Init(&test_config);
 }
@@ -389,6 +431,61 @@ void test_BswM_RequestMode_same_mode(void)
     (void)ret;
 }
 
+/** @verifies SWR-BSW-022 */
+void test_BswM_RequestMode_notifies_mode_switch(void)
+{
+    test_config.ModeSwitchNotification = Mock_ModeSwitch;
+    BswM_Init(&test_config);
+
+    (void)BswM_RequestMode(0u, BSWM_RUN);
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_switch_count);
+    TEST_ASSERT_EQUAL_UINT8((uint8)BSWM_RUN, mock_switch_mode);
+
+    /* Same mode and rejected transitions: no notification */
+    (void)BswM_RequestMode(0u, BSWM_RUN);
+    (void)BswM_RequestMode(0u, BSWM_STARTUP);
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_switch_count);
+
+    (void)BswM_RequestMode(0u, BSWM_SAFE_STOP);
+    TEST_ASSERT_EQUAL_UINT8(2u, mock_switch_count);
+    TEST_ASSERT_EQUAL_UINT8((uint8)BSWM_SAFE_STOP, mock_switch_mode);
+}
+
+/** @verifies SWR-BSW-022 — entering a mode applies its runnable set
+ *  and I-PDU groups, only on an actual change of mode */
+void test_BswM_RequestMode_applies_mode_controls(void)
+{
+    test_config.ModeControls     = test_mode_controls;
+    test_config.RunnableControl  = Mock_RunnableControl;
+    test_config.IpduGroupControl = Mock_IpduGroupControl;
+    BswM_Init(&test_config);
+
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_control_count);    /* not at init */
+
+    (void)BswM_RequestMode(0u, BSWM_RUN);
+    TEST_ASSERT_EQUAL_HEX16(0x00FFu, mock_runnable_mask);
+    TEST_ASSERT_EQUAL_HEX8(0x03u, mock_ipdu_groups);
+
+    (void)BswM_RequestMode(0u, BSWM_RUN);
+    (void)BswM_RequestMode(0u, BSWM_STARTUP);           /* rejected */
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_control_count);
+
+    (void)BswM_RequestMode(0u, BSWM_SAFE_STOP);
+    TEST_ASSERT_EQUAL_UINT8(2u, mock_control_count);
+    TEST_ASSERT_EQUAL_HEX16(0x000Fu, mock_runnable_mask);
+    TEST_ASSERT_EQUAL_HEX8(0x01u, mock_ipdu_groups);
+}
+
+/** @verifies SWR-BSW-022 — no control table: mode changes still work */
+void test_BswM_RequestMode_without_mode_controls(void)
+{
+    test_config.RunnableControl = Mock_RunnableControl;
+    BswM_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(E_OK, BswM_RequestMode(0u, BSWM_RUN));
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_control_count);
+}
+
 /* ==================================================================
  * Test runner
  * ================================================================== */
@@ -431,6 +528,9 @@ int main(void)
     RUN_TEST(test_BswM_MainFunction_only_current_mode_action);
     RUN_TEST(test_BswM_ReInit_resets_mode);
     RUN_TEST(test_BswM_RequestMode_same_mode);
+    RUN_TEST(test_BswM_RequestMode_notifies_mode_switch);
+    RUN_TEST(test_BswM_RequestMode_applies_mode_controls);
+    RUN_TEST(test_BswM_RequestMode_without_mode_controls);
 
     return UNITY_END();
 }
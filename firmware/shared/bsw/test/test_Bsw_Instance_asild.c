@@ -0,0 +1,88 @@
+/**
+ * @file    test_Bsw_Instance_asild.c
+ * @brief   Unit tests for the multi-instance BSW instance selection
+ * @date    2026-03-21
+ *
+ * @verifies SWR-BSW-040
+ *
+ * Built with BSW_INSTANCE_COUNT 2 (see Makefile): selection, range check
+ * and the per-instance Det log as an instance-aware module.
+ */
+#include "unity.h"
+#include "Bsw_Instance.h"
+#include "Det.h"
+
+void setUp(void)
+{
+    (void)Bsw_SetInstance(0u);
+    Det_Init();
+}
+
+void tearDown(void)
+{
+    (void)Bsw_SetInstance(0u);
+}
+
+/* ==================================================================
+ * Instance selection
+ * ================================================================== */
+
+/** @verifies SWR-BSW-040 */
+void test_Bsw_Instance_starts_at_zero(void)
+{
+    TEST_ASSERT_EQUAL_UINT8(0u, Bsw_GetInstance());
+}
+
+/** @verifies SWR-BSW-040 */
+void test_Bsw_SetInstance_selects_instance(void)
+{
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(BSW_INSTANCE_COUNT - 1u));
+    TEST_ASSERT_EQUAL_UINT8(BSW_INSTANCE_COUNT - 1u, Bsw_GetInstance());
+}
+
+/** @verifies SWR-BSW-040 */
+void test_Bsw_SetInstance_out_of_range_keeps_instance(void)
+{
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(1u));
+    Det_Init();
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Bsw_SetInstance(BSW_INSTANCE_COUNT));
+    TEST_ASSERT_EQUAL_UINT8(1u, Bsw_GetInstance());
+    TEST_ASSERT_EQUAL_UINT16(1u, Det_GetErrorCount());
+}
+
+/* ==================================================================
+ * Instance-aware module: Det keeps one log per instance
+ * ================================================================== */
+
+/** @verifies SWR-BSW-040 */
+void test_Bsw_Instance_det_logs_are_separate(void)
+{
+    Det_ErrorEntryType entry;
+
+    Det_ReportError(DET_MODULE_COM, 0u, 0x01u, DET_E_UNINIT);
+
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(1u));
+    Det_Init();
+    TEST_ASSERT_EQUAL_UINT16(0u, Det_GetErrorCount());
+    Det_ReportError(DET_MODULE_RTE, 0u, 0x02u, DET_E_PARAM_VALUE);
+    Det_ReportError(DET_MODULE_RTE, 0u, 0x03u, DET_E_PARAM_VALUE);
+    TEST_ASSERT_EQUAL_UINT16(2u, Det_GetErrorCount());
+
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(0u));
+    TEST_ASSERT_EQUAL_UINT16(1u, Det_GetErrorCount());
+    TEST_ASSERT_EQUAL(E_OK, Det_GetLogEntry(0u, &entry));
+    TEST_ASSERT_EQUAL_UINT16(DET_MODULE_COM, entry.ModuleId);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_Bsw_Instance_starts_at_zero);
+    RUN_TEST(test_Bsw_SetInstance_selects_instance);
+    RUN_TEST(test_Bsw_SetInstance_out_of_range_keeps_instance);
+    RUN_TEST(test_Bsw_Instance_det_logs_are_separate);
+
+    return UNITY_END();
+}
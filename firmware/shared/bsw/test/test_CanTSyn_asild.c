@@ -0,0 +1,407 @@
+/**
+ * @file    test_CanTSyn_asild.c
+ * @brief   Unit tests for Time Synchronization over CAN
+ * @date    2026-03-23
+ *
+ * @verifies SWR-BSW-046
+ *
+ * Tests the SYNC/FUP frame layout and timing of the master, the slave's
+ * matching of FUP to SYNC and its timeouts, and a master-to-slave round
+ * trip (master on BSW instance 0, slave on instance 1). StbM and PduR are
+ * mocked in this file.
+ */
+#include "unity.h"
+#include "CanTSyn.h"
+#include "StbM.h"
+#include "PduR.h"
+#include "Det.h"
+#include "Bsw_Instance.h"
+
+/* ==================================================================
+ * Mock StbM
+ * ================================================================== */
+
+static StbM_TimeStampType      mock_global;
+static StbM_TimeBaseStatusType mock_status;
+static uint32                  mock_local;
+
+static uint8                   mock_set_count;
+static StbM_TimeStampType      mock_set_global;
+static uint32                  mock_set_local;
+
+Std_ReturnType StbM_GetCurrentTime(StbM_TimeStampType* TimeStampPtr,
+                                   StbM_TimeBaseStatusType* StatusPtr)
+{
+    *TimeStampPtr = mock_global;
+    *StatusPtr    = mock_status;
+    return E_OK;
+}
+
+uint32 StbM_GetLocalTimeUs(void)
+{
+    return mock_local;
+}
+
+Std_ReturnType StbM_BusSetGlobalTime(StbM_TimeStampType GlobalTime, uint32 LocalTimeUs)
+{
+    mock_set_count++;
+    mock_set_global = GlobalTime;
+    mock_set_local  = LocalTimeUs;
+    return E_OK;
+}
+
+/* ==================================================================
+ * Mock PduR
+ * ================================================================== */
+
+#define MOCK_TX_MAX     8u
+
+static uint8          mock_tx_count;
+static PduIdType      mock_tx_pdu_id;
+static uint8          mock_tx_data[MOCK_TX_MAX][CANTSYN_PDU_LENGTH];
+static Std_ReturnType mock_tx_result;
+static uint32         mock_tx_duration_us;  /* Master time passing in the request */
+
+Std_ReturnType PduR_Transmit(PduIdType TxPduId, const PduInfoType* PduInfoPtr)
+{
+    mock_global += mock_tx_duration_us;
+    if (mock_tx_result != E_OK) {
+        return mock_tx_result;
+    }
+
+    mock_tx_pdu_id = TxPduId;
+    if ((mock_tx_count < MOCK_TX_MAX) && (PduInfoPtr->SduLength == CANTSYN_PDU_LENGTH)) {
+        for (uint8 i = 0u; i < CANTSYN_PDU_LENGTH; i++) {
+            mock_tx_data[mock_tx_count][i] = PduInfoPtr->SduDataPtr[i];
+        }
+    }
+    mock_tx_count++;
+    return E_OK;
+}
+
+/* ==================================================================
+ * Configuration and helpers
+ * ================================================================== */
+
+#define TEST_DOMAIN     3u
+#define TEST_TX_PDU     9u
+
+static CanTSyn_ConfigType master_config;
+static CanTSyn_ConfigType slave_config;
+
+static void rx(const uint8* Data, PduLengthType Length)
+{
+    uint8 copy[CANTSYN_PDU_LENGTH];
+    PduInfoType pdu = { copy, Length };
+
+    for (uint8 i = 0u; i < CANTSYN_PDU_LENGTH; i++) {
+        copy[i] = Data[i];
+    }
+    CanTSyn_RxIndication(0u, &pdu);
+}
+
+static uint32 be32(const uint8* Src)
+{
+    return ((uint32)Src[0] << 24u) | ((uint32)Src[1] << 16u) |
+           ((uint32)Src[2] << 8u)  |  (uint32)Src[3];
+}
+
+void setUp(void)
+{
+    Det_Init();
+
+    mock_global = 0u;
+    mock_status = STBM_STATUS_GLOBAL_TIME_BASE;
+    mock_local  = 0u;
+    mock_set_count  = 0u;
+    mock_set_global = 0u;
+    mock_set_local  = 0u;
+    mock_tx_count   = 0u;
+    mock_tx_pdu_id  = 0xFFu;
+    mock_tx_result  = E_OK;
+    mock_tx_duration_us = 0u;
+
+    master_config.role         = CANTSYN_ROLE_MASTER;
+    master_config.timeDomain   = TEST_DOMAIN;
+    master_config.txPduId      = TEST_TX_PDU;
+    master_config.syncPeriodMs = 100u;
+    master_config.mainPeriodMs = 10u;
+    master_config.fupTimeoutMs = 0u;
+
+    slave_config = master_config;
+    slave_config.role         = CANTSYN_ROLE_SLAVE;
+    slave_config.syncPeriodMs = 0u;
+    slave_config.fupTimeoutMs = 50u;
+
+    CanTSyn_Init(&master_config);
+}
+
+void tearDown(void)
+{
+    (void)Bsw_SetInstance(0u);
+}
+
+/* ==================================================================
+ * SWR-BSW-046: Initialization
+ * ================================================================== */
+
+/** @verifies SWR-BSW-046 */
+void test_CanTSyn_Init_rejects_invalid_config(void)
+{
+    CanTSyn_ConfigType bad;
+
+    CanTSyn_Init(NULL_PTR);
+
+    bad = master_config;
+    bad.timeDomain = CANTSYN_MAX_TIME_DOMAIN + 1u;
+    CanTSyn_Init(&bad);
+
+    bad = master_config;
+    bad.mainPeriodMs = 0u;
+    CanTSyn_Init(&bad);
+
+    bad = master_config;
+    bad.syncPeriodMs = 0u;
+    CanTSyn_Init(&bad);
+
+    bad = slave_config;
+    bad.fupTimeoutMs = 0u;
+    CanTSyn_Init(&bad);
+
+    TEST_ASSERT_EQUAL_UINT16(5u, Det_GetErrorCount());
+}
+
+/** @verifies SWR-BSW-046 */
+void test_CanTSyn_RxIndication_checks_params(void)
+{
+    uint8 data[CANTSYN_PDU_LENGTH] = { 0u };
+    PduInfoType no_data = { NULL_PTR, CANTSYN_PDU_LENGTH };
+
+    CanTSyn_RxIndication(0u, NULL_PTR);
+    CanTSyn_RxIndication(0u, &no_data);
+
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(1u));
+    rx(data, CANTSYN_PDU_LENGTH);                       /* Instance 1 uninit */
+    CanTSyn_MainFunction();
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(0u));
+
+    TEST_ASSERT_EQUAL_UINT16(2u, Det_GetErrorCount());
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_tx_count);
+}
+
+/* ==================================================================
+ * SWR-BSW-046: Time master
+ * ================================================================== */
+
+/** @verifies SWR-BSW-046 */
+void test_CanTSyn_master_sends_sync_then_fup(void)
+{
+    mock_global = 12345678u;            /* 12 s 345678 us */
+    mock_tx_duration_us = 150u;
+
+    CanTSyn_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_tx_count);
+    TEST_ASSERT_EQUAL(TEST_TX_PDU, mock_tx_pdu_id);
+    TEST_ASSERT_EQUAL_HEX8(CANTSYN_TYPE_SYNC, mock_tx_data[0][0]);
+    TEST_ASSERT_EQUAL_HEX8(0x00u, mock_tx_data[0][1]);
+    TEST_ASSERT_EQUAL_HEX8((TEST_DOMAIN << 4u) | 0u, mock_tx_data[0][2]);
+    TEST_ASSERT_EQUAL_UINT32(12u, be32(&mock_tx_data[0][4]));
+
+    CanTSyn_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(2u, mock_tx_count);
+    TEST_ASSERT_EQUAL_HEX8(CANTSYN_TYPE_FUP, mock_tx_data[1][0]);
+    TEST_ASSERT_EQUAL_HEX8((TEST_DOMAIN << 4u) | 0u, mock_tx_data[1][2]);
+    TEST_ASSERT_EQUAL_HEX8(0u, mock_tx_data[1][3]);
+    /* Nanoseconds of T0 plus the 150 us of the transmit request */
+    TEST_ASSERT_EQUAL_UINT32(345828000u, be32(&mock_tx_data[1][4]));
+}
+
+/** @verifies SWR-BSW-046 */
+void test_CanTSyn_master_fup_carries_overflow_seconds(void)
+{
+    mock_global = 1999999u;
+    mock_tx_duration_us = 5u;
+
+    CanTSyn_MainFunction();
+    CanTSyn_MainFunction();
+
+    TEST_ASSERT_EQUAL_UINT32(1u, be32(&mock_tx_data[0][4]));
+    TEST_ASSERT_EQUAL_HEX8(1u, mock_tx_data[1][3]);
+    TEST_ASSERT_EQUAL_UINT32(4000u, be32(&mock_tx_data[1][4]));
+}
+
+/** @verifies SWR-BSW-046 */
+void test_CanTSyn_master_sync_period_and_sequence(void)
+{
+    for (uint8 call = 0u; call < 21u; call++) {
+        CanTSyn_MainFunction();
+    }
+
+    /* SYNC at calls 1, 11, 21 and FUP at 2, 12 */
+    TEST_ASSERT_EQUAL_UINT8(5u, mock_tx_count);
+    TEST_ASSERT_EQUAL_HEX8(CANTSYN_TYPE_SYNC, mock_tx_data[2][0]);
+    TEST_ASSERT_EQUAL_HEX8((TEST_DOMAIN << 4u) | 1u, mock_tx_data[2][2]);
+    TEST_ASSERT_EQUAL_HEX8(CANTSYN_TYPE_FUP, mock_tx_data[3][0]);
+    TEST_ASSERT_EQUAL_HEX8((TEST_DOMAIN << 4u) | 1u, mock_tx_data[3][2]);
+    TEST_ASSERT_EQUAL_HEX8((TEST_DOMAIN << 4u) | 2u, mock_tx_data[4][2]);
+}
+
+/** @verifies SWR-BSW-046 */
+void test_CanTSyn_master_retries_failed_sync(void)
+{
+    mock_tx_result = E_NOT_OK;
+    CanTSyn_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_tx_count);
+
+    mock_tx_result = E_OK;
+    CanTSyn_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_tx_count);
+    TEST_ASSERT_EQUAL_HEX8(CANTSYN_TYPE_SYNC, mock_tx_data[0][0]);
+    TEST_ASSERT_EQUAL_HEX8((TEST_DOMAIN << 4u) | 0u, mock_tx_data[0][2]);
+}
+
+/** @verifies SWR-BSW-046 */
+void test_CanTSyn_master_waits_for_global_time_base(void)
+{
+    mock_status = 0u;
+    CanTSyn_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_tx_count);
+
+    mock_status = STBM_STATUS_GLOBAL_TIME_BASE;
+    CanTSyn_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_tx_count);
+}
+
+/* ==================================================================
+ * SWR-BSW-046: Time slave
+ * ================================================================== */
+
+static const uint8 sync_frame[CANTSYN_PDU_LENGTH] = {
+    CANTSYN_TYPE_SYNC, 0u, (TEST_DOMAIN << 4u) | 5u, 0u, 0x00u, 0x00u, 0x00u, 0x2Au
+};
+static const uint8 fup_frame[CANTSYN_PDU_LENGTH] = {
+    CANTSYN_TYPE_FUP,  0u, (TEST_DOMAIN << 4u) | 5u, 1u, 0x00u, 0x0Fu, 0x42u, 0x40u
+};
+
+/** @verifies SWR-BSW-046 */
+void test_CanTSyn_slave_sets_time_of_sync_ingress(void)
+{
+    CanTSyn_Init(&slave_config);
+
+    mock_local = 777u;
+    rx(sync_frame, CANTSYN_PDU_LENGTH);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_set_count);
+
+    mock_local = 5777u;
+    rx(fup_frame, CANTSYN_PDU_LENGTH);
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_set_count);
+    /* 42 s + 1 overflow second + 1000000 ns */
+    TEST_ASSERT_TRUE(mock_set_global == 43001000u);
+    TEST_ASSERT_EQUAL_UINT32(777u, mock_set_local);
+
+    rx(fup_frame, CANTSYN_PDU_LENGTH);                  /* SYNC used up */
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_set_count);
+}
+
+/** @verifies SWR-BSW-046 */
+void test_CanTSyn_slave_ignores_foreign_and_mismatched_frames(void)
+{
+    uint8 frame[CANTSYN_PDU_LENGTH];
+
+    CanTSyn_Init(&slave_config);
+
+    rx(fup_frame, CANTSYN_PDU_LENGTH);                  /* FUP without SYNC */
+
+    for (uint8 i = 0u; i < CANTSYN_PDU_LENGTH; i++) {
+        frame[i] = sync_frame[i];
+    }
+    frame[2] = (uint8)(((TEST_DOMAIN + 1u) << 4u) | 5u);
+    rx(frame, CANTSYN_PDU_LENGTH);                      /* Other domain */
+    rx(fup_frame, CANTSYN_PDU_LENGTH);
+
+    rx(sync_frame, CANTSYN_PDU_LENGTH - 1u);            /* Too short */
+    rx(fup_frame, CANTSYN_PDU_LENGTH);
+
+    rx(sync_frame, CANTSYN_PDU_LENGTH);
+    for (uint8 i = 0u; i < CANTSYN_PDU_LENGTH; i++) {
+        frame[i] = fup_frame[i];
+    }
+    frame[2] = (uint8)((TEST_DOMAIN << 4u) | 6u);
+    rx(frame, CANTSYN_PDU_LENGTH);                      /* Other sequence */
+
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_set_count);
+    TEST_ASSERT_EQUAL_UINT16(0u, Det_GetErrorCount());
+}
+
+/** @verifies SWR-BSW-046 */
+void test_CanTSyn_slave_drops_sync_after_fup_timeout(void)
+{
+    CanTSyn_Init(&slave_config);
+
+    rx(sync_frame, CANTSYN_PDU_LENGTH);
+    for (uint8 call = 0u; call < 4u; call++) {
+        CanTSyn_MainFunction();                         /* 40 ms */
+    }
+    rx(fup_frame, CANTSYN_PDU_LENGTH);
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_set_count);
+
+    rx(sync_frame, CANTSYN_PDU_LENGTH);
+    for (uint8 call = 0u; call < 5u; call++) {
+        CanTSyn_MainFunction();                         /* 50 ms */
+    }
+    rx(fup_frame, CANTSYN_PDU_LENGTH);
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_set_count);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_tx_count);         /* A slave never sends */
+}
+
+/** @verifies SWR-BSW-046 */
+void test_CanTSyn_master_to_slave_round_trip(void)
+{
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(1u));
+    CanTSyn_Init(&slave_config);
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(0u));
+
+    mock_global = 42000123u;
+    mock_tx_duration_us = 200u;
+    CanTSyn_MainFunction();                             /* SYNC */
+
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(1u));
+    mock_local = 9000u;
+    rx(mock_tx_data[0], CANTSYN_PDU_LENGTH);
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(0u));
+
+    CanTSyn_MainFunction();                             /* FUP */
+
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(1u));
+    rx(mock_tx_data[1], CANTSYN_PDU_LENGTH);
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(0u));
+
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_set_count);
+    TEST_ASSERT_TRUE(mock_set_global == (42000123u + 200u));
+    TEST_ASSERT_EQUAL_UINT32(9000u, mock_set_local);
+}
+
+/* ==================================================================
+ * Test Runner
+ * ================================================================== */
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_CanTSyn_Init_rejects_invalid_config);
+    RUN_TEST(test_CanTSyn_RxIndication_checks_params);
+
+    RUN_TEST(test_CanTSyn_master_sends_sync_then_fup);
+    RUN_TEST(test_CanTSyn_master_fup_carries_overflow_seconds);
+    RUN_TEST(test_CanTSyn_master_sync_period_and_sequence);
+    RUN_TEST(test_CanTSyn_master_retries_failed_sync);
+    RUN_TEST(test_CanTSyn_master_waits_for_global_time_base);
+
+    RUN_TEST(test_CanTSyn_slave_sets_time_of_sync_ingress);
+    RUN_TEST(test_CanTSyn_slave_ignores_foreign_and_mismatched_frames);
+    RUN_TEST(test_CanTSyn_slave_drops_sync_after_fup_timeout);
+    RUN_TEST(test_CanTSyn_master_to_slave_round_trip);
+
+    return UNITY_END();
+}
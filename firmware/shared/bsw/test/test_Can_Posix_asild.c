@@ -22,6 +22,7 @@
 #include <sys/types.h>   /* ssize_t for mock syscall signatures & Can_Posix.c */
 
 #include "Platform_Types.h"  /* uint8, uint16, uint32, boolean, NULL_PTR etc. */
+#include "Std_Types.h"       /* Std_ReturnType for the shared memory bus mock */
 
 /* Forward-declare the struct used by SocketCAN */
 #ifndef AF_CAN
@@ -201,6 +202,58 @@ static const char* mock_getenv(const char* name)
     return mock_env_can_interface;
 }
 
+/* Shared memory bus mock (CAN_INTERFACE=shm:<name>) */
+static Std_ReturnType mock_shm_open_retval = E_OK;
+static int            mock_shm_open_count  = 0;
+static int            mock_shm_close_count = 0;
+static char           mock_shm_name[32];
+static uint32         mock_shm_bitrate     = 0u;
+static int            mock_shm_tx_count    = 0;
+static uint32         mock_shm_tx_id       = 0u;
+static uint8          mock_shm_tx_dlc      = 0u;
+static boolean        mock_shm_rx_available = FALSE;
+
+static uint64 mock_shm_now(void)
+{
+    return 0u;
+}
+
+static Std_ReturnType mock_shm_open(const char* name, uint32 bitrate,
+                                    uint64 (*nowFn)(void))
+{
+    mock_shm_open_count++;
+    (void)strncpy(mock_shm_name, name, sizeof(mock_shm_name) - 1u);
+    mock_shm_bitrate = bitrate;
+    TEST_ASSERT_TRUE(nowFn == mock_shm_now);
+    return mock_shm_open_retval;
+}
+
+static void mock_shm_close(void)
+{
+    mock_shm_close_count++;
+}
+
+static Std_ReturnType mock_shm_transmit(uint32 id, const uint8* data, uint8 dlc)
+{
+    (void)data;
+    mock_shm_tx_count++;
+    mock_shm_tx_id  = id;
+    mock_shm_tx_dlc = dlc;
+    return E_OK;
+}
+
+static boolean mock_shm_receive(uint32* id, uint8* data, uint8* dlc)
+{
+    if (mock_shm_rx_available == FALSE) {
+        return FALSE;
+    }
+    mock_shm_rx_available = FALSE;
+    *id     = 0x301u;
+    data[0] = 0x5Au;
+    *dlc    = 1u;
+    return TRUE;
+}
+
 /* Wire up the function pointers before including source */
 #define CAN_POSIX_SOCKET_FN    mock_socket
 #define CAN_POSIX_BIND_FN      mock_bind
@@ -211,6 +264,11 @@ static const char* mock_getenv(const char* name)
 #define CAN_POSIX_SETSOCKOPT_FN mock_setsockopt
 #define CAN_POSIX_FCNTL_FN     mock_fcntl
 #define CAN_POSIX_GETENV_FN    mock_getenv
+#define CAN_POSIX_SHM_OPEN_FN     mock_shm_open
+#define CAN_POSIX_SHM_CLOSE_FN    mock_shm_close
+#define CAN_POSIX_SHM_TRANSMIT_FN mock_shm_transmit
+#define CAN_POSIX_SHM_RECEIVE_FN  mock_shm_receive
+#define CAN_POSIX_SHM_NOW_FN      mock_shm_now
 
 /* Include the source under test */
 #include "../mcal/posix/Can_Posix.c"
@@ -243,15 +301,27 @@ void setUp(void)
 
     mock_env_can_interface = NULL;
 
+    mock_shm_open_retval  = E_OK;
+    mock_shm_open_count   = 0;
+    mock_shm_close_count  = 0;
+    memset(mock_shm_name, 0, sizeof(mock_shm_name));
+    mock_shm_bitrate      = 0u;
+    mock_shm_tx_count     = 0;
+    mock_shm_tx_id        = 0u;
+    mock_shm_tx_dlc       = 0u;
+    mock_shm_rx_available = FALSE;
+
     /* Reset module state */
     can_posix_fd = -1;
     can_posix_bus_off = FALSE;
+    can_posix_shm = FALSE;
 }
 
 void tearDown(void)
 {
     /* Ensure socket is "closed" for clean state */
     can_posix_fd = -1;
+    can_posix_shm = FALSE;
 }
 
 /* ---- Tests ---- */
@@ -625,6 +695,86 @@ void test_Can_Hw_Receive_clears_busoff_on_success(void)
     TEST_ASSERT_FALSE(Can_Hw_IsBusOff());
 }
 
+/* ---- Shared memory bus (CAN_INTERFACE=shm:<name>) ---- */
+
+/** @verifies SWR-BSW-001 */
+void test_Can_Hw_Init_shm_opens_bus_without_socket(void)
+{
+    mock_env_can_interface = "shm:taktflow_can";
+
+    Std_ReturnType ret = Can_Hw_Init(500000u);
+
+    TEST_ASSERT_EQUAL(E_OK, ret);
+    TEST_ASSERT_EQUAL(1, mock_shm_open_count);
+    TEST_ASSERT_EQUAL_STRING("taktflow_can", mock_shm_name);
+    TEST_ASSERT_EQUAL_UINT32(500000u, mock_shm_bitrate);
+    TEST_ASSERT_EQUAL(0, mock_socket_call_count);
+    TEST_ASSERT_EQUAL(-1, can_posix_fd);
+}
+
+/** @verifies SWR-BSW-001 */
+void test_Can_Hw_Init_shm_open_failure_returns_not_ok(void)
+{
+    mock_env_can_interface = "shm:taktflow_can";
+    mock_shm_open_retval = E_NOT_OK;
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Can_Hw_Init(500000u));
+
+    uint8 data[1] = {0};
+    TEST_ASSERT_EQUAL(E_NOT_OK, Can_Hw_Transmit(0x100u, data, 1u));
+    TEST_ASSERT_EQUAL(0, mock_shm_tx_count);
+}
+
+/** @verifies SWR-BSW-002 */
+void test_Can_Hw_Transmit_shm_goes_to_bus(void)
+{
+    mock_env_can_interface = "shm:taktflow_can";
+    Can_Hw_Init(500000u);
+
+    uint8 data[8] = {0};
+    Std_ReturnType ret = Can_Hw_Transmit(0x100u, data, 12u);
+
+    TEST_ASSERT_EQUAL(E_OK, ret);
+    TEST_ASSERT_EQUAL(1, mock_shm_tx_count);
+    TEST_ASSERT_EQUAL_UINT32(0x100u, mock_shm_tx_id);
+    TEST_ASSERT_EQUAL_UINT8(8u, mock_shm_tx_dlc);
+    TEST_ASSERT_EQUAL(0, mock_tx_count);
+}
+
+/** @verifies SWR-BSW-003 */
+void test_Can_Hw_Receive_shm_reads_bus(void)
+{
+    mock_env_can_interface = "shm:taktflow_can";
+    Can_Hw_Init(500000u);
+
+    Can_IdType id = 0;
+    uint8 data[8] = {0};
+    uint8 dlc = 0;
+
+    TEST_ASSERT_FALSE(Can_Hw_Receive(&id, data, &dlc));
+
+    mock_shm_rx_available = TRUE;
+    TEST_ASSERT_TRUE(Can_Hw_Receive(&id, data, &dlc));
+    TEST_ASSERT_EQUAL_UINT32(0x301u, id);
+    TEST_ASSERT_EQUAL_UINT8(1u, dlc);
+    TEST_ASSERT_EQUAL_HEX8(0x5Au, data[0]);
+}
+
+/** @verifies SWR-BSW-001 */
+void test_Can_Hw_Stop_shm_leaves_bus(void)
+{
+    mock_env_can_interface = "shm:taktflow_can";
+    Can_Hw_Init(500000u);
+
+    Can_Hw_Stop();
+
+    TEST_ASSERT_EQUAL(1, mock_shm_close_count);
+    TEST_ASSERT_EQUAL(0, mock_close_called);
+
+    uint8 data[1] = {0};
+    TEST_ASSERT_EQUAL(E_NOT_OK, Can_Hw_Transmit(0x100u, data, 1u));
+}
+
 /* ---- Main ---- */
 int main(void)
 {
@@ -660,5 +810,12 @@ int main(void)
     RUN_TEST(test_Can_Hw_Stop_not_init_no_close);
     RUN_TEST(test_Can_Hw_Receive_clears_busoff_on_success);
 
+    /* Shared memory bus */
+    RUN_TEST(test_Can_Hw_Init_shm_opens_bus_without_socket);
+    RUN_TEST(test_Can_Hw_Init_shm_open_failure_returns_not_ok);
+    RUN_TEST(test_Can_Hw_Transmit_shm_goes_to_bus);
+    RUN_TEST(test_Can_Hw_Receive_shm_reads_bus);
+    RUN_TEST(test_Can_Hw_Stop_shm_leaves_bus);
+
     return UNITY_END();
 }
@@ -10,6 +10,7 @@
  */
 #include "unity.h"
 #include "Com.h"
+#include "Bsw_Instance.h"
 
 /* ==================================================================
  * Mock: PduR (lower layer)
@@ -57,6 +58,9 @@ static const Com_TxPduConfigType test_tx_pdus[] = {
     { 1u, 8u, 10u },  /* PDU 1, DLC 8, 10ms cycle */
 };
 
+/* I-PDU groups of the TX PDUs: PDU 0 ungrouped, PDU 1 in group 1 */
+static const Com_IpduGroupVector test_tx_groups[] = { 0x00u, 0x02u };
+
 /* RX PDU config */
 static const Com_RxPduConfigType test_rx_pdus[] = {
     { 0u, 8u, 100u },  /* PDU 0, DLC 8, 100ms timeout */
@@ -78,11 +82,16 @@ void setUp(void)
     test_config.txPduCount   = 2u;
     test_config.rxPduConfig  = test_rx_pdus;
     test_config.rxPduCount   = 1u;
+    test_config.txPduGroups  = NULL_PTR;
+    test_config.getRxTimeUs  = NULL_PTR;
 
     Com_Init(&test_config);
 }
 
-void tearDown(void) { }
+void tearDown(void)
+{
+    (void)Bsw_SetInstance(0u);
+}
 
 /* ==================================================================
  * SWR-BSW-015: Signal Send/Receive
@@ -371,10 +380,142 @@ void test_Com_MultipleSignals_same_pdu(void)
     TEST_ASSERT_EQUAL_HEX8(0xAAu, sig_motor_status_buf);
 }
 
+/** @verifies SWR-BSW-015
+ *  Equivalence class: stopped I-PDU group — its PDUs are held back,
+ *  ungrouped PDUs still go out, the held PDU is sent after restart */
+void test_Com_IpduGroupControl_stops_grouped_pdu(void)
+{
+    uint8  torque = 0x11u;
+    sint16 steer  = 0x0102;
+
+    test_config.txPduGroups = test_tx_groups;
+    Com_Init(&test_config);
+
+    Com_IpduGroupControl(0x01u);    /* group 1 stopped */
+    Com_SendSignal(0u, &torque);
+    Com_SendSignal(1u, &steer);
+    Com_MainFunction_Tx();
+
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_pdur_tx_count);
+    TEST_ASSERT_EQUAL(0u, mock_pdur_tx_pdu_id);
+
+    Com_IpduGroupControl(0x03u);    /* group 1 restarted */
+    Com_MainFunction_Tx();
+
+    TEST_ASSERT_EQUAL_UINT8(2u, mock_pdur_tx_count);
+    TEST_ASSERT_EQUAL(1u, mock_pdur_tx_pdu_id);
+}
+
+/** @verifies SWR-BSW-015
+ *  Equivalence class: group state query for directly transmitted PDUs */
+void test_Com_IsTxPduStarted_follows_groups(void)
+{
+    test_config.txPduGroups = test_tx_groups;
+    Com_Init(&test_config);
+
+    Com_IpduGroupControl(0x01u);
+    TEST_ASSERT_TRUE(Com_IsTxPduStarted(0u));       /* ungrouped */
+    TEST_ASSERT_FALSE(Com_IsTxPduStarted(1u));      /* group 1 stopped */
+    TEST_ASSERT_TRUE(Com_IsTxPduStarted(9u));       /* not a TX PDU */
+
+    Com_IpduGroupControl(0x02u);
+    TEST_ASSERT_TRUE(Com_IsTxPduStarted(1u));
+}
+
+/** @verifies SWR-BSW-015
+ *  Equivalence class: Com_Init starts all I-PDU groups */
+void test_Com_Init_starts_all_ipdu_groups(void)
+{
+    sint16 steer = 0x0102;
+
+    test_config.txPduGroups = test_tx_groups;
+    Com_IpduGroupControl(0x00u);
+    Com_Init(&test_config);
+
+    Com_SendSignal(1u, &steer);
+    Com_MainFunction_Tx();
+
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_pdur_tx_count);
+    TEST_ASSERT_EQUAL(1u, mock_pdur_tx_pdu_id);
+}
+
+/* ==================================================================
+ * SWR-BSW-016, SWR-BSW-045: RX PDU receive time
+ * ================================================================== */
+
+static uint32 mock_time_us;
+
+static uint32 mock_get_time_us(void)
+{
+    return mock_time_us;
+}
+
+/** @verifies SWR-BSW-016, SWR-BSW-045 */
+void test_Com_RxIndication_records_receive_time(void)
+{
+    uint8 data[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    PduInfoType pdu = { data, 8u };
+    uint32 time_us = 0u;
+
+    test_config.getRxTimeUs = mock_get_time_us;
+    Com_Init(&test_config);
+    TEST_ASSERT_EQUAL(E_NOT_OK, Com_GetRxPduTime(0u, &time_us));   /* Not received */
+
+    mock_time_us = 123456u;
+    Com_RxIndication(0u, &pdu);
+    mock_time_us = 200000u;
+    TEST_ASSERT_EQUAL(E_OK, Com_GetRxPduTime(0u, &time_us));
+    TEST_ASSERT_EQUAL_UINT32(123456u, time_us);
+
+    Com_RxIndication(0u, &pdu);
+    TEST_ASSERT_EQUAL(E_OK, Com_GetRxPduTime(0u, &time_us));
+    TEST_ASSERT_EQUAL_UINT32(200000u, time_us);
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Com_GetRxPduTime(COM_MAX_PDUS, &time_us));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Com_GetRxPduTime(0u, NULL_PTR));
+}
+
+/** @verifies SWR-BSW-016 */
+void test_Com_GetRxPduTime_needs_time_source(void)
+{
+    uint8 data[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    PduInfoType pdu = { data, 8u };
+    uint32 time_us = 0xFFFFFFFFu;
+
+    Com_RxIndication(0u, &pdu);
+    TEST_ASSERT_EQUAL(E_NOT_OK, Com_GetRxPduTime(0u, &time_us));
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFu, time_us);
+}
+
 /* ==================================================================
  * Test runner
  * ================================================================== */
 
+/* ==================================================================
+ * Multi-instance build (Bsw_Instance.h): one Com state per ECU
+ * ================================================================== */
+
+/** @verifies SWR-BSW-015 */
+void test_Com_instances_keep_separate_state(void)
+{
+    uint8 torque = 200u;
+
+    TEST_ASSERT_EQUAL(E_OK, Com_SendSignal(0u, &torque));   /* Instance 0 */
+
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(1u));
+    Com_MainFunction_Tx();                                  /* Not initialized */
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_pdur_tx_count);
+    Com_Init(&test_config);
+    Com_MainFunction_Tx();                                  /* Nothing pending */
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_pdur_tx_count);
+
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(0u));
+    Com_MainFunction_Tx();
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_pdur_tx_count);
+    TEST_ASSERT_EQUAL(0u, mock_pdur_tx_pdu_id);
+    TEST_ASSERT_EQUAL_UINT8(200u, mock_pdur_tx_data[2]);
+}
+
 int main(void)
 {
     UNITY_BEGIN();
@@ -402,6 +543,14 @@ int main(void)
     RUN_TEST(test_Com_RxTimeout_zeros_shadow_buffers);
     RUN_TEST(test_Com_RxTimeout_reset_by_indication);
     RUN_TEST(test_Com_MultipleSignals_same_pdu);
+    RUN_TEST(test_Com_IpduGroupControl_stops_grouped_pdu);
+    RUN_TEST(test_Com_Init_starts_all_ipdu_groups);
+    RUN_TEST(test_Com_IsTxPduStarted_follows_groups);
+    RUN_TEST(test_Com_RxIndication_records_receive_time);
+    RUN_TEST(test_Com_GetRxPduTime_needs_time_source);
+
+    /* Multi-instance */
+    RUN_TEST(test_Com_instances_keep_separate_state);
 
     return UNITY_END();
 }
@@ -6,11 +6,13 @@
  * @verifies SWR-BSW-017
  *
  * Tests UDS service dispatch (0x10 DiagnosticSessionControl,
- * 0x22 ReadDataByIdentifier, 0x3E TesterPresent), session management,
+ * 0x19 ReadDTCInformation, 0x22 ReadDataByIdentifier, 0x3E TesterPresent),
+ * session management,
  * S3 timer timeout, and NRC generation.
  */
 #include "unity.h"
 #include "Dcm.h"
+#include "Dem.h"
 
 #include <string.h>
 
@@ -65,6 +67,91 @@ Std_ReturnType BswM_RequestMode(BswM_RequesterIdType RequesterId,
     return E_OK;
 }
 
+/* ==================================================================
+ * Mock: Dem event memory (for ReadDTCInformation)
+ *
+ * Two DTCs: 0xC00100 confirmed with a snapshot, 0xC10100 pending only.
+ * ================================================================== */
+
+static const uint32 mock_dem_dtc[2]    = { 0xC00100u, 0xC10100u };
+static const uint8  mock_dem_status[2] = { 0x0Du, 0x04u };
+static uint8        mock_dem_filter;
+static uint8        mock_dem_index;
+
+void Dem_SetDTCFilter(uint8 StatusMask)
+{
+    mock_dem_filter = StatusMask;
+    mock_dem_index  = 0u;
+}
+
+uint16 Dem_GetNumberOfFilteredDTC(void)
+{
+    uint8 i;
+    uint16 n = 0u;
+    for (i = 0u; i < 2u; i++) {
+        if ((mock_dem_status[i] & mock_dem_filter) != 0u) {
+            n++;
+        }
+    }
+    return n;
+}
+
+Std_ReturnType Dem_GetNextFilteredDTC(uint32* DtcPtr, uint8* StatusPtr)
+{
+    while (mock_dem_index < 2u) {
+        uint8 i = mock_dem_index;
+        mock_dem_index++;
+        if ((mock_dem_status[i] & mock_dem_filter) != 0u) {
+            *DtcPtr    = mock_dem_dtc[i];
+            *StatusPtr = mock_dem_status[i];
+            return E_OK;
+        }
+    }
+    return E_NOT_OK;
+}
+
+Std_ReturnType Dem_GetStatusOfDTC(uint32 Dtc, uint8* StatusPtr)
+{
+    uint8 i;
+    for (i = 0u; i < 2u; i++) {
+        if (mock_dem_dtc[i] == Dtc) {
+            *StatusPtr = mock_dem_status[i];
+            return E_OK;
+        }
+    }
+    return E_NOT_OK;
+}
+
+Std_ReturnType Dem_GetFreezeFrameDataByDTC(uint32 Dtc, uint8 RecordNumber,
+                                           uint8* DestBuffer, uint16* BufSize)
+{
+    static const uint8 record[8] = { 0x01u, 0x01u, 0xF0u, 0xFFu,
+                                     0x00u, 0x00u, 0x12u, 0x34u };
+    if ((RecordNumber != 0x01u) && (RecordNumber != 0xFFu)) {
+        return E_NOT_OK;
+    }
+    if (Dtc != mock_dem_dtc[0]) {
+        *BufSize = 0u;      /* no snapshot stored */
+        return E_OK;
+    }
+    (void)memcpy(DestBuffer, record, sizeof(record));
+    *BufSize = sizeof(record);
+    return E_OK;
+}
+
+Std_ReturnType Dem_GetExtendedDataRecordByDTC(uint32 Dtc, uint8 RecordNumber,
+                                              uint8* DestBuffer, uint16* BufSize)
+{
+    (void)Dtc;
+    if ((RecordNumber != 0x01u) && (RecordNumber != 0xFFu)) {
+        return E_NOT_OK;
+    }
+    DestBuffer[0] = 0x01u;
+    DestBuffer[1] = 0x03u;
+    *BufSize = 2u;
+    return E_OK;
+}
+
 /* ==================================================================
  * DID Read Callbacks (test DIDs)
  * ================================================================== */
@@ -270,6 +357,108 @@ void test_Dcm_TesterPresent_suppress(void)
     TEST_ASSERT_EQUAL_UINT8(0u, mock_tx_count);
 }
 
+/* ==================================================================
+ * SWR-BSW-017: ReadDTCInformation (SID 0x19)
+ * ================================================================== */
+
+/** @verifies SWR-BSW-017 — 0x19 01 reportNumberOfDTCByStatusMask */
+void test_Dcm_ReadDtcInfo_count_by_mask(void)
+{
+    uint8 req[] = {0x19u, 0x01u, 0x08u};  /* confirmedDTC */
+    PduInfoType pdu = { req, 3u };
+
+    Dcm_RxIndication(0u, &pdu);
+    Dcm_MainFunction();
+
+    TEST_ASSERT_EQUAL_UINT8(6u, (uint8)mock_tx_dlc);
+    TEST_ASSERT_EQUAL_HEX8(0x59u, mock_tx_data[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x01u, mock_tx_data[1]);
+    TEST_ASSERT_EQUAL_HEX8(DEM_STATUS_AVAILABILITY_MASK, mock_tx_data[2]);
+    TEST_ASSERT_EQUAL_HEX8(0x01u, mock_tx_data[3]);   /* ISO 14229-1 format */
+    TEST_ASSERT_EQUAL_HEX8(0x00u, mock_tx_data[4]);
+    TEST_ASSERT_EQUAL_HEX8(0x01u, mock_tx_data[5]);
+}
+
+/** @verifies SWR-BSW-017 — 0x19 02 reportDTCByStatusMask */
+void test_Dcm_ReadDtcInfo_dtc_by_mask(void)
+{
+    uint8 req[] = {0x19u, 0x02u, 0x04u};  /* pendingDTC */
+    PduInfoType pdu = { req, 3u };
+
+    Dcm_RxIndication(0u, &pdu);
+    Dcm_MainFunction();
+
+    TEST_ASSERT_EQUAL_UINT8(11u, (uint8)mock_tx_dlc);
+    TEST_ASSERT_EQUAL_HEX8(0x59u, mock_tx_data[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xC0u, mock_tx_data[3]);
+    TEST_ASSERT_EQUAL_HEX8(0x0Du, mock_tx_data[6]);
+    TEST_ASSERT_EQUAL_HEX8(0xC1u, mock_tx_data[7]);
+    TEST_ASSERT_EQUAL_HEX8(0x04u, mock_tx_data[10]);
+}
+
+/** @verifies SWR-BSW-017 — 0x19 04 snapshot record, unknown DTC -> NRC 0x31 */
+void test_Dcm_ReadDtcInfo_snapshot(void)
+{
+    uint8 req[] = {0x19u, 0x04u, 0xC0u, 0x01u, 0x00u, 0x01u};
+    uint8 bad[] = {0x19u, 0x04u, 0x12u, 0x34u, 0x56u, 0x01u};
+    PduInfoType pdu = { req, 6u };
+
+    Dcm_RxIndication(0u, &pdu);
+    Dcm_MainFunction();
+
+    TEST_ASSERT_EQUAL_UINT8(14u, (uint8)mock_tx_dlc);
+    TEST_ASSERT_EQUAL_HEX8(0x59u, mock_tx_data[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x04u, mock_tx_data[1]);
+    TEST_ASSERT_EQUAL_HEX8(0xC0u, mock_tx_data[2]);
+    TEST_ASSERT_EQUAL_HEX8(0x0Du, mock_tx_data[5]);
+    TEST_ASSERT_EQUAL_HEX8(0x01u, mock_tx_data[6]);   /* record number */
+    TEST_ASSERT_EQUAL_HEX8(0x34u, mock_tx_data[13]);
+
+    pdu.SduDataPtr = bad;
+    Dcm_RxIndication(0u, &pdu);
+    Dcm_MainFunction();
+
+    TEST_ASSERT_EQUAL_HEX8(0x7Fu, mock_tx_data[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x19u, mock_tx_data[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x31u, mock_tx_data[2]);
+}
+
+/** @verifies SWR-BSW-017 — 0x19 06 extended data record */
+void test_Dcm_ReadDtcInfo_ext_data(void)
+{
+    uint8 req[] = {0x19u, 0x06u, 0xC1u, 0x01u, 0x00u, 0xFFu};
+    PduInfoType pdu = { req, 6u };
+
+    Dcm_RxIndication(0u, &pdu);
+    Dcm_MainFunction();
+
+    TEST_ASSERT_EQUAL_UINT8(8u, (uint8)mock_tx_dlc);
+    TEST_ASSERT_EQUAL_HEX8(0x59u, mock_tx_data[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x06u, mock_tx_data[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x04u, mock_tx_data[5]);
+    TEST_ASSERT_EQUAL_HEX8(0x03u, mock_tx_data[7]);
+}
+
+/** @verifies SWR-BSW-017 — unsupported sub-function / short request */
+void test_Dcm_ReadDtcInfo_invalid(void)
+{
+    uint8 req_sub[] = {0x19u, 0x0Au};
+    uint8 req_len[] = {0x19u, 0x04u, 0xC0u};
+    PduInfoType pdu = { req_sub, 2u };
+
+    Dcm_RxIndication(0u, &pdu);
+    Dcm_MainFunction();
+    TEST_ASSERT_EQUAL_HEX8(0x7Fu, mock_tx_data[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x12u, mock_tx_data[2]);
+
+    pdu.SduDataPtr = req_len;
+    pdu.SduLength  = 3u;
+    Dcm_RxIndication(0u, &pdu);
+    Dcm_MainFunction();
+    TEST_ASSERT_EQUAL_HEX8(0x7Fu, mock_tx_data[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x13u, mock_tx_data[2]);
+}
+
 /* ==================================================================
  * SWR-BSW-017: NRC and Error Handling
  * ================================================================== */
@@ -785,6 +974,13 @@ int main(void)
     RUN_TEST(test_Dcm_TesterPresent);
     RUN_TEST(test_Dcm_TesterPresent_suppress);
 
+    /* ReadDTCInformation */
+    RUN_TEST(test_Dcm_ReadDtcInfo_count_by_mask);
+    RUN_TEST(test_Dcm_ReadDtcInfo_dtc_by_mask);
+    RUN_TEST(test_Dcm_ReadDtcInfo_snapshot);
+    RUN_TEST(test_Dcm_ReadDtcInfo_ext_data);
+    RUN_TEST(test_Dcm_ReadDtcInfo_invalid);
+
     /* NRC / error handling */
     RUN_TEST(test_Dcm_unknown_SID);
     RUN_TEST(test_Dcm_RxIndication_null_pdu);
@@ -5,18 +5,24 @@
  *
  * @verifies SWR-BSW-017, SWR-BSW-018
  *
- * Tests DTC reporting, debouncing, storage, status bits, and clear.
+ * Tests DTC reporting, debouncing, storage, status bits, and clear,
+ * event memory with freeze frames, displacement and NvM write coalescing,
+ * and the per-event debounce classes.
  */
 #include "unity.h"
 #include "Dem.h"
 #include "NvM.h"
+#include "Det.h"
 #include "ComStack_Types.h"
 
+#include <string.h>
+
 /* ---- Mock stubs for Dem_MainFunction dependencies ---- */
 
 static uint8  mock_pdur_called;
 static uint16 mock_pdur_last_id;
 static uint8  mock_pdur_last_data[8];
+static Std_ReturnType mock_pdur_result;
 
 Std_ReturnType PduR_Transmit(PduIdType TxPduId, const PduInfoType* PduInfoPtr)
 {
@@ -28,17 +34,20 @@ Std_ReturnType PduR_Transmit(PduIdType TxPduId, const PduInfoType* PduInfoPtr)
             mock_pdur_last_data[i] = PduInfoPtr->SduDataPtr[i];
         }
     }
-    return E_OK;
+    return mock_pdur_result;
 }
 
-/* NvM mock stubs */
-static uint8 mock_nvm_write_called;
-static uint8 mock_nvm_read_called;
+/* NvM mock stubs — one block of backing store, valid after first write */
+static uint8   mock_nvm_write_called;
+static uint8   mock_nvm_read_called;
+static uint8   mock_nvm_block[DEM_NVM_BLOCK_SIZE];
+static boolean mock_nvm_valid;
 
 Std_ReturnType NvM_WriteBlock(NvM_BlockIdType BlockId, const void* NvM_SrcPtr)
 {
     (void)BlockId;
-    (void)NvM_SrcPtr;
+    (void)memcpy(mock_nvm_block, NvM_SrcPtr, DEM_NVM_BLOCK_SIZE);
+    mock_nvm_valid = TRUE;
     mock_nvm_write_called++;
     return E_OK;
 }
@@ -46,17 +55,100 @@ Std_ReturnType NvM_WriteBlock(NvM_BlockIdType BlockId, const void* NvM_SrcPtr)
 Std_ReturnType NvM_ReadBlock(NvM_BlockIdType BlockId, void* NvM_DstPtr)
 {
     (void)BlockId;
-    (void)NvM_DstPtr;
+    if (mock_nvm_valid == TRUE) {
+        (void)memcpy(NvM_DstPtr, mock_nvm_block, DEM_NVM_BLOCK_SIZE);
+    }
     mock_nvm_read_called++;
     return E_OK;
 }
 
+/* Rte mock stub — freeze-frame signal source */
+static uint32 mock_rte_signals[64];
+
+Std_ReturnType Rte_Read(uint16 SignalId, uint32* DataPtr)
+{
+    if (SignalId >= 64u) {
+        return E_NOT_OK;
+    }
+    *DataPtr = mock_rte_signals[SignalId];
+    return E_OK;
+}
+
+/* Freeze-frame configuration: two signals, test timestamp source */
+static uint32 mock_time_ms;
+
+static uint32 mock_get_time(void)
+{
+    return mock_time_ms;
+}
+
+static const Dem_FreezeFrameSignalType test_ff_signals[] = {
+    { 20u, 0xF010u },   /* e.g. vehicle state */
+    { 25u, 0xF011u }    /* e.g. motor speed   */
+};
+
+/* Debounce table: one event per class, the rest use the default class */
+#define TEST_EV_JUMP       20u      /* counter, 10 consecutive, heal at -5 */
+#define TEST_EV_STEP       21u      /* counter, step 2 up to 4             */
+#define TEST_EV_MONITOR    22u      /* monitor-internal                    */
+#define TEST_EV_TIME       23u      /* time, 300 ms fail / 1000 ms pass    */
+
+static const Dem_DebounceConfigType test_debounce[] = {
+    { TEST_EV_JUMP,    DEM_DEBOUNCE_COUNTER_BASED,    1u, 1u, TRUE,  10, -5, 0u,   0u    },
+    { TEST_EV_STEP,    DEM_DEBOUNCE_COUNTER_BASED,    2u, 1u, FALSE, 4,  0,  0u,   0u    },
+    { TEST_EV_MONITOR, DEM_DEBOUNCE_MONITOR_INTERNAL, 0u, 0u, FALSE, 0,  0,  0u,   0u    },
+    { TEST_EV_TIME,    DEM_DEBOUNCE_TIME_BASED,       0u, 0u, FALSE, 0,  0,  300u, 1000u }
+};
+
+static const Dem_ConfigType test_dem_config = {
+    test_ff_signals,    /* FreezeFrameSignals     */
+    2u,                 /* FreezeFrameSignalCount */
+    mock_get_time,      /* GetTimestampMs         */
+    500u,               /* NvmWriteIntervalMs     */
+    test_debounce,      /* DebounceTable          */
+    4u,                 /* DebounceTableCount     */
+    NULL_PTR            /* GetFreezeFrameTimeMs   */
+};
+
+static void report_n(Dem_EventIdType EventId, Dem_EventStatusType Status, uint8 Count)
+{
+    uint8 i;
+    for (i = 0u; i < Count; i++) {
+        Dem_ReportErrorStatus(EventId, Status);
+    }
+}
+
+static uint8 debouncing_of(Dem_EventIdType EventId)
+{
+    Dem_DebouncingStateType state = 0xFFu;
+    TEST_ASSERT_EQUAL(E_OK, Dem_GetDebouncingOfEvent(EventId, &state));
+    return state;
+}
+
+static void confirm_event(Dem_EventIdType EventId)
+{
+    Dem_ReportErrorStatus(EventId, DEM_EVENT_STATUS_FAILED);
+    Dem_ReportErrorStatus(EventId, DEM_EVENT_STATUS_FAILED);
+    Dem_ReportErrorStatus(EventId, DEM_EVENT_STATUS_FAILED);
+}
+
+static void heal_event(Dem_EventIdType EventId)
+{
+    Dem_ReportErrorStatus(EventId, DEM_EVENT_STATUS_PASSED);
+    Dem_ReportErrorStatus(EventId, DEM_EVENT_STATUS_PASSED);
+    Dem_ReportErrorStatus(EventId, DEM_EVENT_STATUS_PASSED);
+}
+
 void setUp(void)
 {
     mock_pdur_called = 0u;
     mock_pdur_last_id = 0u;
+    mock_pdur_result = E_OK;
     mock_nvm_write_called = 0u;
     mock_nvm_read_called = 0u;
+    mock_nvm_valid = FALSE;
+    mock_time_ms = 0u;
+    (void)memset(mock_rte_signals, 0, sizeof(mock_rte_signals));
     uint8 i;
     for (i = 0u; i < 8u; i++) {
         mock_pdur_last_data[i] = 0u;
@@ -457,6 +549,58 @@ void test_Dem_MainFunction_no_duplicate_broadcast(void)
     TEST_ASSERT_EQUAL(first_count, mock_pdur_called);
 }
 
+/** @verifies SWR-BSW-017 — burst of confirmations sent in one cycle */
+void test_Dem_MainFunction_broadcasts_burst_in_one_cycle(void)
+{
+    uint8 i;
+
+    for (i = 0u; i < 6u; i++) {
+        confirm_event(i);
+    }
+
+    Dem_MainFunction();
+    TEST_ASSERT_EQUAL(6u, mock_pdur_called);
+    TEST_ASSERT_EQUAL_HEX8(0xC1u, mock_pdur_last_data[0]);   /* event 5, last queued */
+    TEST_ASSERT_EQUAL_HEX8(0x02u, mock_pdur_last_data[1]);
+
+    Dem_MainFunction();
+    TEST_ASSERT_EQUAL(6u, mock_pdur_called);
+}
+
+/** @verifies SWR-BSW-017 — refused frame retried next cycle */
+void test_Dem_MainFunction_retries_refused_broadcast(void)
+{
+    confirm_event(0u);
+    confirm_event(1u);
+
+    mock_pdur_result = E_NOT_OK;
+    Dem_MainFunction();
+    TEST_ASSERT_EQUAL(1u, mock_pdur_called);    /* rest waits for next cycle */
+
+    mock_pdur_result = E_OK;
+    mock_pdur_called = 0u;
+    Dem_MainFunction();
+    TEST_ASSERT_EQUAL(2u, mock_pdur_called);
+
+    Dem_MainFunction();
+    TEST_ASSERT_EQUAL(2u, mock_pdur_called);
+}
+
+/** @verifies SWR-BSW-017 — DTC cleared before broadcast is not sent */
+void test_Dem_MainFunction_cleared_while_queued(void)
+{
+    confirm_event(0u);
+    (void)Dem_ClearAllDTCs();
+
+    Dem_MainFunction();
+    TEST_ASSERT_EQUAL(0u, mock_pdur_called);
+
+    /* Queue entry consumed: a new confirmation is broadcast once */
+    confirm_event(0u);
+    Dem_MainFunction();
+    TEST_ASSERT_EQUAL(1u, mock_pdur_called);
+}
+
 /** @verifies SWR-BSW-017 — broadcast guard */
 void test_Dem_MainFunction_no_broadcast_without_pdu_config(void)
 {
@@ -483,6 +627,441 @@ void test_Dem_SetDtcCode_invalid_id(void)
     Dem_SetDtcCode(DEM_MAX_EVENTS, 0xFFFFFFu);
 }
 
+/* ==================================================================
+ * Event memory, freeze frames, NvM coalescing
+ * ================================================================== */
+
+/** @verifies SWR-BSW-018 — freeze frame holds the values at confirmation */
+void test_Dem_FreezeFrame_captured_at_confirmation(void)
+{
+    uint8 buf[32];
+    uint16 len = sizeof(buf);
+
+    Dem_Init(&test_dem_config);
+    mock_rte_signals[20] = 3u;
+    mock_rte_signals[25] = 0x01020304u;
+    mock_time_ms = 0x00001234u;
+
+    confirm_event(7u);
+
+    /* RTE moves on before anybody reads the DTC */
+    mock_rte_signals[20] = 5u;
+    mock_rte_signals[25] = 0u;
+    mock_time_ms = 0x00009999u;
+    confirm_event(7u);
+
+    TEST_ASSERT_EQUAL(E_OK, Dem_GetFreezeFrameDataByDTC(0xC20100u, DEM_FF_RECORD_NUMBER,
+                                                         buf, &len));
+    TEST_ASSERT_EQUAL_UINT16(20u, len);
+    TEST_ASSERT_EQUAL_HEX8(DEM_FF_RECORD_NUMBER, buf[0]);
+    TEST_ASSERT_EQUAL_HEX8(3u, buf[1]);              /* timestamp + 2 signals */
+    TEST_ASSERT_EQUAL_HEX8(0xF0u, buf[2]);
+    TEST_ASSERT_EQUAL_HEX8(0xFFu, buf[3]);
+    TEST_ASSERT_EQUAL_HEX8(0x12u, buf[6]);
+    TEST_ASSERT_EQUAL_HEX8(0x34u, buf[7]);
+    TEST_ASSERT_EQUAL_HEX8(0xF0u, buf[8]);
+    TEST_ASSERT_EQUAL_HEX8(0x10u, buf[9]);
+    TEST_ASSERT_EQUAL_HEX8(3u, buf[13]);
+    TEST_ASSERT_EQUAL_HEX8(0x11u, buf[15]);
+    TEST_ASSERT_EQUAL_HEX8(0x01u, buf[16]);
+    TEST_ASSERT_EQUAL_HEX8(0x04u, buf[19]);
+}
+
+static uint32 mock_ff_time_ms;
+
+static uint32 mock_get_ff_time(void)
+{
+    return mock_ff_time_ms;
+}
+
+/** @verifies SWR-BSW-018, SWR-BSW-045 — freeze frame on the synchronized time */
+void test_Dem_FreezeFrame_timestamp_from_own_clock(void)
+{
+    static const Dem_ConfigType ff_time_config = {
+        test_ff_signals, 2u, mock_get_time, 500u, test_debounce, 4u, mock_get_ff_time
+    };
+    uint8 buf[32];
+    uint16 len = sizeof(buf);
+
+    Dem_Init(&ff_time_config);
+    mock_time_ms    = 0x00001234u;
+    mock_ff_time_ms = 0x00ABCDEFu;
+
+    confirm_event(7u);
+
+    TEST_ASSERT_EQUAL(E_OK, Dem_GetFreezeFrameDataByDTC(0xC20100u, DEM_FF_RECORD_NUMBER,
+                                                         buf, &len));
+    TEST_ASSERT_EQUAL_HEX8(0xF0u, buf[2]);
+    TEST_ASSERT_EQUAL_HEX8(0xFFu, buf[3]);
+    TEST_ASSERT_EQUAL_HEX8(0x00u, buf[4]);
+    TEST_ASSERT_EQUAL_HEX8(0xABu, buf[5]);
+    TEST_ASSERT_EQUAL_HEX8(0xCDu, buf[6]);
+    TEST_ASSERT_EQUAL_HEX8(0xEFu, buf[7]);
+}
+
+/** @verifies SWR-BSW-018 — no entry before confirmation, bad record number */
+void test_Dem_FreezeFrame_not_stored_and_bad_record(void)
+{
+    uint8 buf[32];
+    uint16 len = sizeof(buf);
+
+    Dem_Init(&test_dem_config);
+    Dem_ReportErrorStatus(7u, DEM_EVENT_STATUS_FAILED);
+
+    TEST_ASSERT_EQUAL(E_OK, Dem_GetFreezeFrameDataByDTC(0xC20100u, DEM_RECORD_ALL,
+                                                         buf, &len));
+    TEST_ASSERT_EQUAL_UINT16(0u, len);
+
+    len = sizeof(buf);
+    TEST_ASSERT_EQUAL(E_NOT_OK, Dem_GetFreezeFrameDataByDTC(0xC20100u, 0x02u, buf, &len));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Dem_GetFreezeFrameDataByDTC(0x123456u, 0x01u, buf, &len));
+}
+
+/** @verifies SWR-BSW-018 — full memory displaces the oldest passive entry */
+void test_Dem_EventMemory_displaces_oldest_passive(void)
+{
+    uint8 i;
+    uint8 status = 0u;
+    uint8 buf[32];
+    uint16 len = sizeof(buf);
+
+    for (i = 0u; i < DEM_EVENT_MEMORY_SIZE; i++) {
+        confirm_event(i);
+    }
+    heal_event(2u);     /* oldest passive */
+    heal_event(5u);
+
+    confirm_event(12u);
+
+    TEST_ASSERT_EQUAL(E_OK, Dem_GetFreezeFrameDataByDTC(0xC40100u, 0x01u, buf, &len));
+    TEST_ASSERT_TRUE(len > 0u);
+
+    Dem_GetEventStatus(2u, &status);
+    TEST_ASSERT_EQUAL_HEX8(0u, status & DEM_STATUS_CONFIRMED_DTC);
+    Dem_GetEventStatus(5u, &status);
+    TEST_ASSERT_TRUE((status & DEM_STATUS_CONFIRMED_DTC) != 0u);
+    TEST_ASSERT_TRUE(Dem_GetEventMemoryOverflow());
+}
+
+/** @verifies SWR-BSW-018 — active entries are never displaced */
+void test_Dem_EventMemory_full_of_active_entries(void)
+{
+    uint8 i;
+    uint8 buf[32];
+    uint16 len = sizeof(buf);
+
+    for (i = 0u; i < DEM_EVENT_MEMORY_SIZE; i++) {
+        confirm_event(i);
+    }
+    TEST_ASSERT_FALSE(Dem_GetEventMemoryOverflow());
+
+    confirm_event(12u);
+
+    TEST_ASSERT_TRUE(Dem_GetEventMemoryOverflow());
+    TEST_ASSERT_EQUAL(E_OK, Dem_GetFreezeFrameDataByDTC(0xC40100u, 0x01u, buf, &len));
+    TEST_ASSERT_EQUAL_UINT16(0u, len);
+    len = sizeof(buf);
+    TEST_ASSERT_EQUAL(E_OK, Dem_GetFreezeFrameDataByDTC(0xC00100u, 0x01u, buf, &len));
+    TEST_ASSERT_TRUE(len > 0u);
+}
+
+/** @verifies SWR-BSW-018 — DTC filter by status mask */
+void test_Dem_DTCFilter_by_status_mask(void)
+{
+    uint32 dtc = 0u;
+    uint8 status = 0u;
+
+    confirm_event(4u);
+    Dem_ReportErrorStatus(6u, DEM_EVENT_STATUS_FAILED);     /* pending only */
+
+    Dem_SetDTCFilter(DEM_STATUS_CONFIRMED_DTC);
+    TEST_ASSERT_EQUAL_UINT16(1u, Dem_GetNumberOfFilteredDTC());
+    TEST_ASSERT_EQUAL(E_OK, Dem_GetNextFilteredDTC(&dtc, &status));
+    TEST_ASSERT_EQUAL_HEX32(0xC10100u, dtc);
+    TEST_ASSERT_EQUAL(E_NOT_OK, Dem_GetNextFilteredDTC(&dtc, &status));
+
+    Dem_SetDTCFilter(DEM_STATUS_PENDING_DTC);
+    TEST_ASSERT_EQUAL_UINT16(2u, Dem_GetNumberOfFilteredDTC());
+    TEST_ASSERT_EQUAL(E_OK, Dem_GetNextFilteredDTC(&dtc, &status));
+    TEST_ASSERT_EQUAL(E_OK, Dem_GetNextFilteredDTC(&dtc, &status));
+    TEST_ASSERT_EQUAL_HEX32(0xC10300u, dtc);
+    TEST_ASSERT_EQUAL_HEX8(DEM_STATUS_TEST_FAILED | DEM_STATUS_PENDING_DTC, status);
+}
+
+/** @verifies SWR-BSW-017 — extended data record: occurrence counter */
+void test_Dem_ExtendedData_occurrence(void)
+{
+    uint8 buf[4];
+    uint16 len = sizeof(buf);
+
+    /* One occurrence per qualification, not per FAILED report */
+    confirm_event(0u);
+    Dem_ReportErrorStatus(0u, DEM_EVENT_STATUS_FAILED);
+    report_n(0u, DEM_EVENT_STATUS_PASSED, 6u);     /* healed at -3 */
+    report_n(0u, DEM_EVENT_STATUS_FAILED, 6u);
+
+    TEST_ASSERT_EQUAL(E_OK, Dem_GetExtendedDataRecordByDTC(0xC00100u, DEM_EXT_RECORD_OCCURRENCE,
+                                                            buf, &len));
+    TEST_ASSERT_EQUAL_UINT16(2u, len);
+    TEST_ASSERT_EQUAL_HEX8(0x01u, buf[0]);
+    TEST_ASSERT_EQUAL_HEX8(2u, buf[1]);
+
+    len = sizeof(buf);
+    TEST_ASSERT_EQUAL(E_NOT_OK, Dem_GetExtendedDataRecordByDTC(0xC00100u, 0x10u, buf, &len));
+}
+
+/** @verifies SWR-BSW-018 — at most one NvM write per interval */
+void test_Dem_NvM_writes_coalesced(void)
+{
+    uint8 i;
+
+    Dem_Init(&test_dem_config);     /* 500 ms interval = 5 main cycles */
+
+    confirm_event(0u);
+    Dem_MainFunction();
+    TEST_ASSERT_EQUAL(1u, mock_nvm_write_called);
+
+    /* Burst of confirmations within the interval */
+    for (i = 1u; i < 5u; i++) {
+        confirm_event(i);
+        Dem_MainFunction();
+    }
+    TEST_ASSERT_EQUAL(1u, mock_nvm_write_called);
+
+    Dem_MainFunction();
+    TEST_ASSERT_EQUAL(2u, mock_nvm_write_called);
+
+    /* Nothing changed: no further writes */
+    for (i = 0u; i < 20u; i++) {
+        Dem_MainFunction();
+    }
+    TEST_ASSERT_EQUAL(2u, mock_nvm_write_called);
+}
+
+/** @verifies SWR-BSW-018 — event memory survives a power cycle */
+void test_Dem_NvM_restore_event_memory(void)
+{
+    uint8 status = 0u;
+    uint32 count = 0u;
+    uint8 buf[32];
+    uint16 len = sizeof(buf);
+
+    Dem_Init(&test_dem_config);
+    mock_rte_signals[25] = 777u;
+    confirm_event(9u);
+    Dem_MainFunction();
+    TEST_ASSERT_TRUE(mock_nvm_valid);
+
+    mock_rte_signals[25] = 0u;
+    Dem_Init(&test_dem_config);
+
+    Dem_GetEventStatus(9u, &status);
+    TEST_ASSERT_EQUAL_HEX8(DEM_STATUS_CONFIRMED_DTC, status);
+    Dem_GetOccurrenceCounter(9u, &count);
+    TEST_ASSERT_EQUAL_UINT32(1u, count);
+    TEST_ASSERT_EQUAL(E_OK, Dem_GetFreezeFrameDataByDTC(0xC20300u, 0x01u, buf, &len));
+    TEST_ASSERT_EQUAL_HEX8(0x03u, buf[18]);
+    TEST_ASSERT_EQUAL_HEX8(0x09u, buf[19]);
+
+    /* Restored DTC is not broadcast again */
+    mock_pdur_called = 0u;
+    Dem_SetBroadcastPduId(0x500u);
+    Dem_MainFunction();
+    TEST_ASSERT_EQUAL(0u, mock_pdur_called);
+}
+
+/* ==================================================================
+ * SWR-BSW-017: Debounce classes
+ * ================================================================== */
+
+/** @verifies SWR-BSW-017 — default class: qualified at +3, healed at -3 */
+void test_Dem_Debounce_default_class_states(void)
+{
+    Dem_ReportErrorStatus(0u, DEM_EVENT_STATUS_FAILED);
+    TEST_ASSERT_EQUAL_HEX8(DEM_DEBOUNCE_TEMPORARILY_DEFECTIVE, debouncing_of(0u));
+
+    confirm_event(0u);
+    TEST_ASSERT_EQUAL_HEX8(DEM_DEBOUNCE_FINALLY_DEFECTIVE, debouncing_of(0u));
+
+    heal_event(0u);     /* counter back at 0: testFailed clear, still qualified */
+    TEST_ASSERT_EQUAL_HEX8(DEM_DEBOUNCE_FINALLY_DEFECTIVE | DEM_DEBOUNCE_TEMPORARILY_HEALED,
+                           debouncing_of(0u));
+    heal_event(0u);
+    TEST_ASSERT_EQUAL_HEX8(0u, debouncing_of(0u));
+}
+
+/** @verifies SWR-BSW-017 — jump-to-zero counter needs consecutive reports */
+void test_Dem_Debounce_counter_jump_to_zero(void)
+{
+    uint8 status = 0u;
+
+    Dem_Init(&test_dem_config);
+
+    report_n(TEST_EV_JUMP, DEM_EVENT_STATUS_FAILED, 9u);
+    Dem_ReportErrorStatus(TEST_EV_JUMP, DEM_EVENT_STATUS_PASSED);
+    report_n(TEST_EV_JUMP, DEM_EVENT_STATUS_FAILED, 9u);
+    Dem_GetEventStatus(TEST_EV_JUMP, &status);
+    TEST_ASSERT_EQUAL_HEX8(0u, status & DEM_STATUS_CONFIRMED_DTC);
+
+    Dem_ReportErrorStatus(TEST_EV_JUMP, DEM_EVENT_STATUS_FAILED);
+    Dem_GetEventStatus(TEST_EV_JUMP, &status);
+    TEST_ASSERT_TRUE((status & DEM_STATUS_CONFIRMED_DTC) != 0u);
+    TEST_ASSERT_EQUAL_HEX8(DEM_DEBOUNCE_FINALLY_DEFECTIVE, debouncing_of(TEST_EV_JUMP));
+
+    /* Healing restarts on a FAILED report */
+    report_n(TEST_EV_JUMP, DEM_EVENT_STATUS_PASSED, 4u);
+    Dem_ReportErrorStatus(TEST_EV_JUMP, DEM_EVENT_STATUS_FAILED);
+    report_n(TEST_EV_JUMP, DEM_EVENT_STATUS_PASSED, 4u);
+    TEST_ASSERT_TRUE((debouncing_of(TEST_EV_JUMP) & DEM_DEBOUNCE_FINALLY_DEFECTIVE) != 0u);
+
+    Dem_ReportErrorStatus(TEST_EV_JUMP, DEM_EVENT_STATUS_PASSED);
+    TEST_ASSERT_EQUAL_HEX8(0u, debouncing_of(TEST_EV_JUMP));
+    Dem_GetEventStatus(TEST_EV_JUMP, &status);
+    TEST_ASSERT_EQUAL_HEX8(0u, status & DEM_STATUS_TEST_FAILED);
+}
+
+/** @verifies SWR-BSW-017 — step size and threshold per event */
+void test_Dem_Debounce_counter_step_size(void)
+{
+    uint32 count = 0u;
+
+    Dem_Init(&test_dem_config);
+
+    Dem_ReportErrorStatus(TEST_EV_STEP, DEM_EVENT_STATUS_FAILED);
+    TEST_ASSERT_EQUAL_HEX8(DEM_DEBOUNCE_TEMPORARILY_DEFECTIVE, debouncing_of(TEST_EV_STEP));
+    Dem_ReportErrorStatus(TEST_EV_STEP, DEM_EVENT_STATUS_FAILED);
+    TEST_ASSERT_EQUAL_HEX8(DEM_DEBOUNCE_FINALLY_DEFECTIVE, debouncing_of(TEST_EV_STEP));
+
+    /* Repeated FAILED reports do not count new occurrences */
+    report_n(TEST_EV_STEP, DEM_EVENT_STATUS_FAILED, 5u);
+    Dem_GetOccurrenceCounter(TEST_EV_STEP, &count);
+    TEST_ASSERT_EQUAL_UINT32(1u, count);
+
+    report_n(TEST_EV_STEP, DEM_EVENT_STATUS_PASSED, 4u);
+    TEST_ASSERT_EQUAL_HEX8(0u, debouncing_of(TEST_EV_STEP));
+}
+
+/** @verifies SWR-BSW-017 — monitor-internal: every report is final */
+void test_Dem_Debounce_monitor_internal(void)
+{
+    uint8 status = 0u;
+
+    Dem_Init(&test_dem_config);
+
+    Dem_ReportErrorStatus(TEST_EV_MONITOR, DEM_EVENT_STATUS_FAILED);
+    Dem_GetEventStatus(TEST_EV_MONITOR, &status);
+    TEST_ASSERT_EQUAL_HEX8(DEM_STATUS_TEST_FAILED | DEM_STATUS_PENDING_DTC |
+                           DEM_STATUS_CONFIRMED_DTC, status);
+    TEST_ASSERT_EQUAL_HEX8(DEM_DEBOUNCE_FINALLY_DEFECTIVE, debouncing_of(TEST_EV_MONITOR));
+
+    Dem_ReportErrorStatus(TEST_EV_MONITOR, DEM_EVENT_STATUS_PASSED);
+    Dem_GetEventStatus(TEST_EV_MONITOR, &status);
+    TEST_ASSERT_EQUAL_HEX8(0u, status & DEM_STATUS_TEST_FAILED);
+    TEST_ASSERT_EQUAL_HEX8(0u, debouncing_of(TEST_EV_MONITOR));
+}
+
+/** @verifies SWR-BSW-017 — time-based: qualified by Dem_MainFunction */
+void test_Dem_Debounce_time_based(void)
+{
+    uint8 status = 0u;
+
+    Dem_Init(&test_dem_config);
+    Dem_SetDtcCode(TEST_EV_TIME, 0xC80100u);
+    Dem_SetBroadcastPduId(0x500u);
+
+    mock_time_ms = 1000u;
+    Dem_ReportErrorStatus(TEST_EV_TIME, DEM_EVENT_STATUS_FAILED);
+    mock_time_ms = 1200u;
+    Dem_ReportErrorStatus(TEST_EV_TIME, DEM_EVENT_STATUS_FAILED);
+    TEST_ASSERT_EQUAL_HEX8(DEM_DEBOUNCE_TEMPORARILY_DEFECTIVE, debouncing_of(TEST_EV_TIME));
+
+    /* No further report: the main function qualifies once 300 ms passed */
+    mock_time_ms = 1300u;
+    Dem_MainFunction();
+    TEST_ASSERT_EQUAL_HEX8(DEM_DEBOUNCE_FINALLY_DEFECTIVE, debouncing_of(TEST_EV_TIME));
+    Dem_GetEventStatus(TEST_EV_TIME, &status);
+    TEST_ASSERT_TRUE((status & DEM_STATUS_CONFIRMED_DTC) != 0u);
+    TEST_ASSERT_TRUE(mock_pdur_called > 0u);     /* broadcast in the same cycle */
+
+    /* Healing needs 1000 ms of PASSED; a FAILED report restarts it */
+    mock_time_ms = 1400u;
+    Dem_ReportErrorStatus(TEST_EV_TIME, DEM_EVENT_STATUS_PASSED);
+    mock_time_ms = 2000u;
+    Dem_ReportErrorStatus(TEST_EV_TIME, DEM_EVENT_STATUS_FAILED);
+    Dem_ReportErrorStatus(TEST_EV_TIME, DEM_EVENT_STATUS_PASSED);
+    mock_time_ms = 2999u;
+    Dem_MainFunction();
+    TEST_ASSERT_TRUE((debouncing_of(TEST_EV_TIME) & DEM_DEBOUNCE_FINALLY_DEFECTIVE) != 0u);
+    mock_time_ms = 3000u;
+    Dem_MainFunction();
+    TEST_ASSERT_EQUAL_HEX8(0u, debouncing_of(TEST_EV_TIME));
+}
+
+/** @verifies SWR-BSW-017 — PASSED before the fail time cancels the timer */
+void test_Dem_Debounce_time_based_cancelled(void)
+{
+    uint8 status = 0u;
+
+    Dem_Init(&test_dem_config);
+
+    mock_time_ms = 0u;
+    Dem_ReportErrorStatus(TEST_EV_TIME, DEM_EVENT_STATUS_FAILED);
+    mock_time_ms = 250u;
+    Dem_ReportErrorStatus(TEST_EV_TIME, DEM_EVENT_STATUS_PASSED);
+    mock_time_ms = 400u;
+    Dem_ReportErrorStatus(TEST_EV_TIME, DEM_EVENT_STATUS_FAILED);
+    Dem_MainFunction();
+
+    TEST_ASSERT_EQUAL_HEX8(DEM_DEBOUNCE_TEMPORARILY_DEFECTIVE, debouncing_of(TEST_EV_TIME));
+    Dem_GetEventStatus(TEST_EV_TIME, &status);
+    TEST_ASSERT_EQUAL_HEX8(0u, status & DEM_STATUS_CONFIRMED_DTC);
+}
+
+/** @verifies SWR-BSW-017 — invalid table entry: Det error, default class */
+void test_Dem_Debounce_invalid_entry_uses_default(void)
+{
+    static const Dem_DebounceConfigType bad_debounce[] = {
+        { 3u,  DEM_DEBOUNCE_COUNTER_BASED, 0u, 1u, FALSE, 5, 0, 0u, 0u },  /* IncStep 0 */
+        { 40u, DEM_DEBOUNCE_MONITOR_INTERNAL, 0u, 0u, FALSE, 0, 0, 0u, 0u } /* EventId  */
+    };
+    static const Dem_ConfigType bad_config = {
+        NULL_PTR, 0u, NULL_PTR, 0u, bad_debounce, 2u, NULL_PTR
+    };
+    uint8 status = 0u;
+
+    Det_Init();
+    Dem_Init(&bad_config);
+    TEST_ASSERT_EQUAL_UINT16(2u, Det_GetErrorCount());
+
+    confirm_event(3u);
+    Dem_GetEventStatus(3u, &status);
+    TEST_ASSERT_TRUE((status & DEM_STATUS_CONFIRMED_DTC) != 0u);
+}
+
+/** @verifies SWR-BSW-017 */
+void test_Dem_GetDebouncingOfEvent_invalid(void)
+{
+    Dem_DebouncingStateType state;
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Dem_GetDebouncingOfEvent(DEM_MAX_EVENTS, &state));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Dem_GetDebouncingOfEvent(0u, NULL_PTR));
+}
+
+/** @verifies SWR-BSW-017 — qualification is not restored from NvM */
+void test_Dem_Debounce_state_not_persistent(void)
+{
+    uint8 status = 0u;
+
+    Dem_Init(&test_dem_config);
+    confirm_event(4u);
+    Dem_MainFunction();
+
+    Dem_Init(&test_dem_config);
+    Dem_GetEventStatus(4u, &status);
+    TEST_ASSERT_EQUAL_HEX8(DEM_STATUS_CONFIRMED_DTC, status);
+    TEST_ASSERT_EQUAL_HEX8(0u, debouncing_of(4u));
+}
+
 /* ==================================================================
  * Test runner
  * ================================================================== */
@@ -520,8 +1099,32 @@ int main(void)
     RUN_TEST(test_Dem_MainFunction_broadcasts_confirmed_dtc);
     RUN_TEST(test_Dem_MainFunction_no_broadcast_before_confirm);
     RUN_TEST(test_Dem_MainFunction_no_duplicate_broadcast);
+    RUN_TEST(test_Dem_MainFunction_broadcasts_burst_in_one_cycle);
+    RUN_TEST(test_Dem_MainFunction_retries_refused_broadcast);
+    RUN_TEST(test_Dem_MainFunction_cleared_while_queued);
     RUN_TEST(test_Dem_MainFunction_no_broadcast_without_pdu_config);
     RUN_TEST(test_Dem_SetDtcCode_invalid_id);
 
+    /* Event memory / freeze frame / NvM coalescing tests */
+    RUN_TEST(test_Dem_FreezeFrame_captured_at_confirmation);
+    RUN_TEST(test_Dem_FreezeFrame_timestamp_from_own_clock);
+    RUN_TEST(test_Dem_FreezeFrame_not_stored_and_bad_record);
+    RUN_TEST(test_Dem_EventMemory_displaces_oldest_passive);
+    RUN_TEST(test_Dem_EventMemory_full_of_active_entries);
+    RUN_TEST(test_Dem_DTCFilter_by_status_mask);
+    RUN_TEST(test_Dem_ExtendedData_occurrence);
+    RUN_TEST(test_Dem_NvM_writes_coalesced);
+    RUN_TEST(test_Dem_NvM_restore_event_memory);
+
+    RUN_TEST(test_Dem_Debounce_default_class_states);
+    RUN_TEST(test_Dem_Debounce_counter_jump_to_zero);
+    RUN_TEST(test_Dem_Debounce_counter_step_size);
+    RUN_TEST(test_Dem_Debounce_monitor_internal);
+    RUN_TEST(test_Dem_Debounce_time_based);
+    RUN_TEST(test_Dem_Debounce_time_based_cancelled);
+    RUN_TEST(test_Dem_Debounce_invalid_entry_uses_default);
+    RUN_TEST(test_Dem_GetDebouncingOfEvent_invalid);
+    RUN_TEST(test_Dem_Debounce_state_not_persistent);
+
     return UNITY_END();
 }
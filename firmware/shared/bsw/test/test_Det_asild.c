@@ -6,10 +6,11 @@
  * @verifies SWR-BSW-040
  *
  * Tests DET error reporting, ring buffer behavior, callback hook,
- * and boundary conditions.
+ * exclusive area and boundary conditions.
  */
 #include "unity.h"
 #include "Det.h"
+#include "SchM.h"
 
 /* ==================================================================
  * Mock / Callback tracking
@@ -20,6 +21,7 @@ static uint8  cb_instance_id;
 static uint8  cb_api_id;
 static uint8  cb_error_id;
 static uint8  cb_call_count;
+static boolean cb_irq_disabled;
 
 static void test_det_callback(uint16 ModuleId, uint8 InstanceId,
                                uint8 ApiId, uint8 ErrorId)
@@ -29,6 +31,7 @@ static void test_det_callback(uint16 ModuleId, uint8 InstanceId,
     cb_api_id      = ApiId;
     cb_error_id    = ErrorId;
     cb_call_count++;
+    cb_irq_disabled = SchM_Test_IsIrqDisabled();
 }
 
 /* ==================================================================
@@ -42,6 +45,7 @@ void setUp(void)
     cb_api_id      = 0u;
     cb_error_id    = 0u;
     cb_call_count  = 0u;
+    cb_irq_disabled = FALSE;
 
     Det_Init();
 }
@@ -257,6 +261,29 @@ void test_Det_ReportRuntimeError_stores_and_counts(void)
     TEST_ASSERT_EQUAL_UINT8(E2E_API_CHECK, entry.ApiId);
 }
 
+/* ==================================================================
+ * SWR-BSW-040: Exclusive area (reports from every Os level and ISRs)
+ * ================================================================== */
+
+/** @verifies SWR-BSW-040 */
+void test_Det_ReportError_logs_in_exclusive_area(void)
+{
+    SchM_AreaStatsType stats;
+
+    Det_SetCallback(test_det_callback);
+    SchM_ResetAreaStats();
+
+    Det_ReportError(DET_MODULE_CANIF, 0u, CANIF_API_RX_INDICATION, DET_E_UNINIT);
+
+    TEST_ASSERT_EQUAL(E_OK, SchM_GetAreaStats(SCHM_AREA_DET, &stats));
+    TEST_ASSERT_EQUAL_UINT32(1u, stats.entries);
+    TEST_ASSERT_EQUAL_UINT8(0u, SchM_GetNestingDepth());
+
+    /* Callback runs after the area is left */
+    TEST_ASSERT_EQUAL_UINT8(1u, cb_call_count);
+    TEST_ASSERT_FALSE(cb_irq_disabled);
+}
+
 /* ==================================================================
  * Test runner
  * ================================================================== */
@@ -291,5 +318,8 @@ int main(void)
     RUN_TEST(test_Det_ReportError_before_init_ignored);
     RUN_TEST(test_Det_ReportRuntimeError_stores_and_counts);
 
+    /* Exclusive area */
+    RUN_TEST(test_Det_ReportError_logs_in_exclusive_area);
+
     return UNITY_END();
 }
@@ -0,0 +1,410 @@
+/**
+ * @file    test_Fee_asild.c
+ * @brief   Unit tests for Flash EEPROM Emulation on the host flash simulator
+ * @date    2026-03-10
+ *
+ * @verifies SWR-BSW-031
+ *
+ * Tests record append, persistence across re-init, write coalescing, page
+ * swap / garbage collection, wear leveling over the page ring, recovery
+ * from a reset during a write or a swap, and non-blocking operation with
+ * simulated erase latency. Fls.c and Fls_Posix.c are included directly.
+ */
+#include "unity.h"
+#include "Fee.h"
+
+#include "../mcal/Fls.c"
+#include "../mcal/posix/Fls_Posix.c"
+
+#include <string.h>
+
+#define TEST_PAGES      4u
+#define TEST_PAGE_SIZE  FLS_SIM_PAGE_SIZE
+
+static const Fls_ConfigType test_fls_cfg = {
+    FLS_SIM_BASE_ADDRESS,
+    FLS_SIM_SIZE,
+    FLS_SIM_PAGE_SIZE,
+    2u                      /* Small budget: jobs span several calls */
+};
+
+static const Fls_AddressType test_pages[TEST_PAGES] = {
+    FLS_SIM_BASE_ADDRESS,
+    FLS_SIM_BASE_ADDRESS + (1u * TEST_PAGE_SIZE),
+    FLS_SIM_BASE_ADDRESS + (2u * TEST_PAGE_SIZE),
+    FLS_SIM_BASE_ADDRESS + (3u * TEST_PAGE_SIZE)
+};
+
+static const Fee_BlockConfigType test_blocks[] = {
+    { 0u, 32u  },           /* record 48 bytes  */
+    { 1u, 100u },           /* record 120 bytes */
+    { 2u, 8u   }            /* record 24 bytes  */
+};
+
+static const Fee_ConfigType test_fee_cfg = {
+    test_pages, TEST_PAGES, TEST_PAGE_SIZE, test_blocks, 3u
+};
+
+static uint8 blk0[32];
+static uint8 blk1[100];
+static uint8 rd[100];
+
+static void run_until_idle(uint32 maxCalls)
+{
+    uint32 i;
+    for (i = 0u; i < maxCalls; i++) {
+        if ((Fee_GetStatus() == MEMIF_IDLE) && (Fls_GetStatus() == MEMIF_IDLE)) {
+            return;
+        }
+        Fee_MainFunction();
+        Fls_MainFunction();
+    }
+}
+
+/** Service until no write is queued (a background erase may remain) */
+static void run_until_written(uint32 maxCalls)
+{
+    uint32 i;
+    for (i = 0u; (i < maxCalls) && (Fee_GetStatus() == MEMIF_BUSY); i++) {
+        Fee_MainFunction();
+        Fls_MainFunction();
+    }
+}
+
+/** Re-init both layers over the retained flash content (ECU reset) */
+static void reset_ecu(void)
+{
+    Fls_Init(&test_fls_cfg);
+    Fee_Init(&test_fee_cfg);
+}
+
+void setUp(void)
+{
+    Fls_Sim_Reset();
+    Fls_Sim_SetLatency(0u, 0u);
+    (void)memset(blk0, 0, sizeof(blk0));
+    (void)memset(blk1, 0, sizeof(blk1));
+    (void)memset(rd, 0, sizeof(rd));
+    reset_ecu();
+}
+
+void tearDown(void) { }
+
+/* ==================================================================
+ * SWR-BSW-031: Basic block storage
+ * ================================================================== */
+
+/** @verifies SWR-BSW-031 — blank flash: block reported inconsistent */
+void test_Fee_Read_unwritten_block(void)
+{
+    TEST_ASSERT_EQUAL(MEMIF_IDLE, Fee_GetStatus());
+    TEST_ASSERT_EQUAL(E_NOT_OK, Fee_Read(0u, 0u, rd, 32u));
+    TEST_ASSERT_EQUAL(MEMIF_BLOCK_INCONSISTENT, Fee_GetJobResult());
+}
+
+/** @verifies SWR-BSW-031 */
+void test_Fee_Write_then_read(void)
+{
+    uint8 i;
+    for (i = 0u; i < 32u; i++) {
+        blk0[i] = (uint8)(0xA0u + i);
+    }
+
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(0u, blk0));
+    TEST_ASSERT_EQUAL(MEMIF_BUSY, Fee_GetStatus());
+    run_until_idle(200u);
+
+    TEST_ASSERT_EQUAL(MEMIF_JOB_OK, Fee_GetJobResult());
+    TEST_ASSERT_EQUAL(E_OK, Fee_Read(0u, 0u, rd, 32u));
+    TEST_ASSERT_EQUAL_MEMORY(blk0, rd, 32u);
+
+    /* Partial read with offset */
+    TEST_ASSERT_EQUAL(E_OK, Fee_Read(0u, 30u, rd, 2u));
+    TEST_ASSERT_EQUAL_HEX8(0xBEu, rd[0]);
+}
+
+/** @verifies SWR-BSW-031 — data survives reset */
+void test_Fee_Persists_across_reset(void)
+{
+    (void)memset(blk0, 0x3C, sizeof(blk0));
+    (void)memset(blk1, 0x5A, sizeof(blk1));
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(0u, blk0));
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(1u, blk1));
+    run_until_idle(200u);
+
+    reset_ecu();
+
+    TEST_ASSERT_EQUAL(E_OK, Fee_Read(0u, 0u, rd, 32u));
+    TEST_ASSERT_EQUAL_MEMORY(blk0, rd, 32u);
+    TEST_ASSERT_EQUAL(E_OK, Fee_Read(1u, 0u, rd, 100u));
+    TEST_ASSERT_EQUAL_MEMORY(blk1, rd, 100u);
+    TEST_ASSERT_EQUAL(E_NOT_OK, Fee_Read(2u, 0u, rd, 8u));
+}
+
+/** @verifies SWR-BSW-031 — repeated writes before service -> one record */
+void test_Fee_Write_coalesces(void)
+{
+    Fls_Sim_StatsType before;
+    Fls_Sim_StatsType after;
+
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(0u, blk0));
+    run_until_idle(200u);
+    Fls_Sim_GetStats(&before);
+
+    blk0[0] = 1u;
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(0u, blk0));
+    blk0[0] = 2u;
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(0u, blk0));
+    blk0[0] = 3u;
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(0u, blk0));
+    run_until_idle(200u);
+    Fls_Sim_GetStats(&after);
+
+    TEST_ASSERT_EQUAL_UINT32(48u / FLS_DWORD_SIZE,
+                             after.programCount - before.programCount);
+    TEST_ASSERT_EQUAL(E_OK, Fee_Read(0u, 0u, rd, 1u));
+    TEST_ASSERT_EQUAL_HEX8(3u, rd[0]);
+}
+
+/* ==================================================================
+ * SWR-BSW-031: Page swap, garbage collection, wear leveling
+ * ================================================================== */
+
+/** @verifies SWR-BSW-031 — many writes: GC keeps latest data of all blocks */
+void test_Fee_Swap_keeps_all_blocks(void)
+{
+    uint16 n;
+
+    (void)memset(blk0, 0x77, sizeof(blk0));
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(0u, blk0));
+    run_until_idle(200u);
+
+    /* ~16 records of block 1 fit a 2 KB page: force several swaps */
+    for (n = 0u; n < 100u; n++) {
+        blk1[0] = (uint8)n;
+        blk1[99] = (uint8)(n ^ 0xFFu);
+        TEST_ASSERT_EQUAL(E_OK, Fee_Write(1u, blk1));
+        run_until_idle(400u);
+        TEST_ASSERT_EQUAL(MEMIF_JOB_OK, Fee_GetJobResult());
+    }
+
+    TEST_ASSERT_EQUAL(E_OK, Fee_Read(0u, 0u, rd, 32u));
+    TEST_ASSERT_EQUAL_MEMORY(blk0, rd, 32u);
+    TEST_ASSERT_EQUAL(E_OK, Fee_Read(1u, 0u, rd, 100u));
+    TEST_ASSERT_EQUAL_MEMORY(blk1, rd, 100u);
+
+    reset_ecu();
+    TEST_ASSERT_EQUAL(E_OK, Fee_Read(1u, 0u, rd, 100u));
+    TEST_ASSERT_EQUAL_MEMORY(blk1, rd, 100u);
+    TEST_ASSERT_EQUAL(E_OK, Fee_Read(0u, 0u, rd, 32u));
+    TEST_ASSERT_EQUAL_MEMORY(blk0, rd, 32u);
+}
+
+/** @verifies SWR-BSW-031 — swaps rotate through the ring evenly */
+void test_Fee_Wear_leveling(void)
+{
+    Fls_Sim_StatsType st;
+    uint32 minErase = 0xFFFFFFFFu;
+    uint32 maxErase = 0u;
+    uint16 n;
+    uint8  p;
+
+    for (n = 0u; n < 400u; n++) {
+        blk1[0] = (uint8)n;
+        TEST_ASSERT_EQUAL(E_OK, Fee_Write(1u, blk1));
+        run_until_idle(400u);
+    }
+
+    Fls_Sim_GetStats(&st);
+    for (p = 0u; p < TEST_PAGES; p++) {
+        if (st.pageEraseCount[p] < minErase) { minErase = st.pageEraseCount[p]; }
+        if (st.pageEraseCount[p] > maxErase) { maxErase = st.pageEraseCount[p]; }
+    }
+
+    TEST_ASSERT_TRUE(minErase >= 4u);
+    TEST_ASSERT_TRUE((maxErase - minErase) <= 1u);
+    TEST_ASSERT_EQUAL_UINT32(0u, st.programErrors);
+}
+
+/* ==================================================================
+ * SWR-BSW-031: Power-fail robustness
+ * ================================================================== */
+
+/** @verifies SWR-BSW-031 — reset in the middle of a record write */
+void test_Fee_Torn_write_falls_back_to_previous(void)
+{
+    (void)memset(blk0, 0x11, sizeof(blk0));
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(0u, blk0));
+    run_until_idle(200u);
+
+    (void)memset(blk0, 0x22, sizeof(blk0));
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(0u, blk0));
+    Fee_MainFunction();     /* Starts the 6-dword Fls job   */
+    Fls_MainFunction();     /* Programs 2 dwords, then reset */
+
+    reset_ecu();
+    TEST_ASSERT_EQUAL(E_OK, Fee_Read(0u, 0u, rd, 32u));
+    TEST_ASSERT_EQUAL_HEX8(0x11u, rd[0]);
+
+    /* The torn record is skipped; new writes still land */
+    (void)memset(blk0, 0x33, sizeof(blk0));
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(0u, blk0));
+    run_until_idle(200u);
+    reset_ecu();
+    TEST_ASSERT_EQUAL(E_OK, Fee_Read(0u, 0u, rd, 32u));
+    TEST_ASSERT_EQUAL_HEX8(0x33u, rd[0]);
+}
+
+/** @verifies SWR-BSW-031 — corrupt commit (bit rot) is not trusted */
+void test_Fee_Corrupt_record_rejected(void)
+{
+    (void)memset(blk0, 0x44, sizeof(blk0));
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(0u, blk0));
+    run_until_idle(200u);
+
+    /* First record of page 0: data starts at offset 16 + 8 */
+    Fls_Sim_PokeByte(FLS_SIM_BASE_ADDRESS + 24u, 0x45u);
+
+    reset_ecu();
+    TEST_ASSERT_EQUAL(E_NOT_OK, Fee_Read(0u, 0u, rd, 32u));
+}
+
+/** @verifies SWR-BSW-031 — reset during swap: old page stays authoritative */
+void test_Fee_Reset_during_swap(void)
+{
+    uint16 n;
+    uint16 calls;
+
+    (void)memset(blk0, 0x66, sizeof(blk0));
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(0u, blk0));
+    run_until_idle(200u);
+
+    /* Fill the first page without triggering the swap yet */
+    for (n = 0u; n < 16u; n++) {
+        blk1[0] = (uint8)n;
+        TEST_ASSERT_EQUAL(E_OK, Fee_Write(1u, blk1));
+        run_until_idle(400u);
+    }
+
+    /* Keep writing until the write needs a swap, then cut it short */
+    blk1[0] = 0xEEu;
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(1u, blk1));
+    for (calls = 0u; calls < 4u; calls++) {
+        Fee_MainFunction();
+        Fls_MainFunction();
+    }
+
+    reset_ecu();
+    TEST_ASSERT_EQUAL(E_OK, Fee_Read(0u, 0u, rd, 32u));
+    TEST_ASSERT_EQUAL_MEMORY(blk0, rd, 32u);
+    TEST_ASSERT_EQUAL(E_OK, Fee_Read(1u, 0u, rd, 100u));
+    TEST_ASSERT_TRUE((rd[0] == 15u) || (rd[0] == 0xEEu));
+
+    /* Continue normally after the reset */
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(1u, blk1));
+    run_until_idle(400u);
+    TEST_ASSERT_EQUAL(E_OK, Fee_Read(1u, 0u, rd, 100u));
+    TEST_ASSERT_EQUAL_HEX8(0xEEu, rd[0]);
+    TEST_ASSERT_EQUAL(MEMIF_IDLE, Fee_GetStatus());
+}
+
+/* ==================================================================
+ * SWR-BSW-031: Non-blocking operation
+ * ================================================================== */
+
+/** @verifies SWR-BSW-031 — reads served during background erase; write
+ *  queued behind it completes afterwards */
+void test_Fee_Background_erase_nonblocking(void)
+{
+    uint16 n;
+    uint16 guard;
+
+    Fls_Sim_SetLatency(50u, 2u);
+
+    (void)memset(blk0, 0x12, sizeof(blk0));
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(0u, blk0));
+    for (n = 0u; n < 20u; n++) {
+        blk1[0] = (uint8)n;
+        TEST_ASSERT_EQUAL(E_OK, Fee_Write(1u, blk1));
+        run_until_written(2000u);
+        if (Fee_GetStatus() == MEMIF_BUSY_INTERNAL) {
+            break;
+        }
+    }
+
+    /* Wait for the erase to actually start */
+    for (guard = 0u; (guard < 10u) && (Fls_GetStatus() != MEMIF_BUSY); guard++) {
+        Fee_MainFunction();
+        Fls_MainFunction();
+    }
+    TEST_ASSERT_EQUAL(MEMIF_BUSY_INTERNAL, Fee_GetStatus());
+    TEST_ASSERT_EQUAL(MEMIF_BUSY, Fls_GetStatus());
+
+    TEST_ASSERT_EQUAL(E_OK, Fee_Read(0u, 0u, rd, 32u));
+    TEST_ASSERT_EQUAL_MEMORY(blk0, rd, 32u);
+
+    blk1[0] = 0xC3u;
+    TEST_ASSERT_EQUAL(E_OK, Fee_Write(1u, blk1));
+    run_until_idle(2000u);
+
+    TEST_ASSERT_EQUAL(MEMIF_IDLE, Fee_GetStatus());
+    TEST_ASSERT_EQUAL(E_OK, Fee_Read(1u, 0u, rd, 1u));
+    TEST_ASSERT_EQUAL_HEX8(0xC3u, rd[0]);
+}
+
+/* ==================================================================
+ * Parameter validation
+ * ================================================================== */
+
+/** @verifies SWR-BSW-031 */
+void test_Fee_Invalid_params(void)
+{
+    TEST_ASSERT_EQUAL(E_NOT_OK, Fee_Write(9u, blk0));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Fee_Write(0u, NULL_PTR));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Fee_Read(0u, 30u, rd, 4u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Fee_Read(0u, 0u, NULL_PTR, 4u));
+    TEST_ASSERT_EQUAL_UINT16(100u, Fee_GetBlockSize(1u));
+    TEST_ASSERT_EQUAL_UINT16(0u, Fee_GetBlockSize(9u));
+}
+
+/** @verifies SWR-BSW-031 — blocks that cannot all fit one page rejected */
+void test_Fee_Init_rejects_oversized_config(void)
+{
+    static const Fee_BlockConfigType big[] = {
+        { 0u, 512u }, { 1u, 512u }, { 2u, 512u }, { 3u, 512u }
+    };
+    static const Fee_ConfigType bad = {
+        test_pages, TEST_PAGES, TEST_PAGE_SIZE, big, 4u
+    };
+
+    Fee_Init(&bad);
+    TEST_ASSERT_EQUAL(MEMIF_UNINIT, Fee_GetStatus());
+}
+
+/* ==================================================================
+ * Test runner
+ * ================================================================== */
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_Fee_Read_unwritten_block);
+    RUN_TEST(test_Fee_Write_then_read);
+    RUN_TEST(test_Fee_Persists_across_reset);
+    RUN_TEST(test_Fee_Write_coalesces);
+
+    RUN_TEST(test_Fee_Swap_keeps_all_blocks);
+    RUN_TEST(test_Fee_Wear_leveling);
+
+    RUN_TEST(test_Fee_Torn_write_falls_back_to_previous);
+    RUN_TEST(test_Fee_Corrupt_record_rejected);
+    RUN_TEST(test_Fee_Reset_during_swap);
+
+    RUN_TEST(test_Fee_Background_erase_nonblocking);
+
+    RUN_TEST(test_Fee_Invalid_params);
+    RUN_TEST(test_Fee_Init_rejects_oversized_config);
+
+    return UNITY_END();
+}
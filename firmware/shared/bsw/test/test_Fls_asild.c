@@ -0,0 +1,228 @@
+/**
+ * @file    test_Fls_asild.c
+ * @brief   Unit tests for the Flash MCAL driver on the host flash simulator
+ * @date    2026-03-10
+ *
+ * @verifies SWR-BSW-031
+ *
+ * Tests non-blocking erase/write jobs, double-word padding, NOR program
+ * rules, the per-call write budget and refusal of reads from the page
+ * under erase. Fls_Posix.c is included directly as the Fls_Hw_* backend.
+ */
+#include "unity.h"
+#include "Fls.h"
+
+#include "../mcal/posix/Fls_Posix.c"
+
+static const Fls_ConfigType test_cfg = {
+    FLS_SIM_BASE_ADDRESS,   /* baseAddress    */
+    FLS_SIM_SIZE,           /* totalSize      */
+    FLS_SIM_PAGE_SIZE,      /* pageSize       */
+    4u                      /* maxWriteDwords */
+};
+
+static void run_until_idle(uint32 maxCalls)
+{
+    uint32 i;
+    for (i = 0u; (i < maxCalls) && (Fls_GetStatus() == MEMIF_BUSY); i++) {
+        Fls_MainFunction();
+    }
+}
+
+void setUp(void)
+{
+    Fls_Sim_Reset();
+    Fls_Sim_SetLatency(0u, 0u);
+    Fls_Init(&test_cfg);
+}
+
+void tearDown(void) { }
+
+/* ==================================================================
+ * SWR-BSW-031: Jobs
+ * ================================================================== */
+
+/** @verifies SWR-BSW-031 */
+void test_Fls_Init_idle(void)
+{
+    TEST_ASSERT_EQUAL(MEMIF_IDLE, Fls_GetStatus());
+    TEST_ASSERT_EQUAL(MEMIF_JOB_OK, Fls_GetJobResult());
+}
+
+/** @verifies SWR-BSW-031 — write is queued, not executed in the API call */
+void test_Fls_Write_is_asynchronous(void)
+{
+    static const uint8 data[8] = { 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u };
+    uint8 rd[8];
+    Fls_Sim_StatsType st;
+
+    TEST_ASSERT_EQUAL(E_OK, Fls_Write(FLS_SIM_BASE_ADDRESS, data, 8u));
+    TEST_ASSERT_EQUAL(MEMIF_BUSY, Fls_GetStatus());
+    TEST_ASSERT_EQUAL(MEMIF_JOB_PENDING, Fls_GetJobResult());
+    Fls_Sim_GetStats(&st);
+    TEST_ASSERT_EQUAL_UINT32(0u, st.programCount);
+
+    run_until_idle(10u);
+
+    TEST_ASSERT_EQUAL(MEMIF_JOB_OK, Fls_GetJobResult());
+    TEST_ASSERT_EQUAL(E_OK, Fls_Read(FLS_SIM_BASE_ADDRESS, rd, 8u));
+    TEST_ASSERT_EQUAL_MEMORY(data, rd, 8u);
+}
+
+/** @verifies SWR-BSW-031 — partial last double-word padded with 0xFF */
+void test_Fls_Write_pads_last_dword(void)
+{
+    static const uint8 data[3] = { 0x11u, 0x22u, 0x33u };
+    uint8 rd[8];
+    Fls_Sim_StatsType st;
+
+    TEST_ASSERT_EQUAL(E_OK, Fls_Write(FLS_SIM_BASE_ADDRESS + 8u, data, 3u));
+    run_until_idle(10u);
+
+    TEST_ASSERT_EQUAL(E_OK, Fls_Read(FLS_SIM_BASE_ADDRESS + 8u, rd, 8u));
+    TEST_ASSERT_EQUAL_HEX8(0x33u, rd[2]);
+    TEST_ASSERT_EQUAL_HEX8(0xFFu, rd[3]);
+    TEST_ASSERT_EQUAL_HEX8(0xFFu, rd[7]);
+    Fls_Sim_GetStats(&st);
+    TEST_ASSERT_EQUAL_UINT32(1u, st.programCount);
+}
+
+/** @verifies SWR-BSW-031 — at most maxWriteDwords per main function */
+void test_Fls_Write_budget_per_call(void)
+{
+    static uint8 data[80];
+    Fls_Sim_StatsType st;
+
+    TEST_ASSERT_EQUAL(E_OK, Fls_Write(FLS_SIM_BASE_ADDRESS, data, sizeof(data)));
+
+    Fls_MainFunction();
+    Fls_Sim_GetStats(&st);
+    TEST_ASSERT_TRUE(st.programCount <= 4u);
+    TEST_ASSERT_EQUAL(MEMIF_BUSY, Fls_GetStatus());
+
+    run_until_idle(10u);
+    Fls_Sim_GetStats(&st);
+    TEST_ASSERT_EQUAL_UINT32(10u, st.programCount);
+    TEST_ASSERT_EQUAL(MEMIF_JOB_OK, Fls_GetJobResult());
+}
+
+/** @verifies SWR-BSW-031 — NOR: programming over data fails */
+void test_Fls_Write_over_programmed_fails(void)
+{
+    static const uint8 a[8] = { 0x0Fu, 0u, 0u, 0u, 0u, 0u, 0u, 1u };
+    Fls_Sim_StatsType st;
+
+    TEST_ASSERT_EQUAL(E_OK, Fls_Write(FLS_SIM_BASE_ADDRESS, a, 8u));
+    run_until_idle(10u);
+    TEST_ASSERT_EQUAL(E_OK, Fls_Write(FLS_SIM_BASE_ADDRESS, a, 8u));
+    run_until_idle(10u);
+
+    TEST_ASSERT_EQUAL(MEMIF_JOB_FAILED, Fls_GetJobResult());
+    Fls_Sim_GetStats(&st);
+    TEST_ASSERT_EQUAL_UINT32(1u, st.programErrors);
+}
+
+/** @verifies SWR-BSW-031 — erase restores 0xFF and counts wear */
+void test_Fls_Erase_page(void)
+{
+    static const uint8 data[8] = { 0u };
+    uint8 rd[8];
+    Fls_Sim_StatsType st;
+
+    TEST_ASSERT_EQUAL(E_OK, Fls_Write(FLS_SIM_BASE_ADDRESS + FLS_SIM_PAGE_SIZE, data, 8u));
+    run_until_idle(10u);
+
+    TEST_ASSERT_EQUAL(E_OK, Fls_Erase(FLS_SIM_BASE_ADDRESS + FLS_SIM_PAGE_SIZE,
+                                      2u * FLS_SIM_PAGE_SIZE));
+    run_until_idle(10u);
+
+    TEST_ASSERT_EQUAL(MEMIF_JOB_OK, Fls_GetJobResult());
+    TEST_ASSERT_EQUAL(E_OK, Fls_Read(FLS_SIM_BASE_ADDRESS + FLS_SIM_PAGE_SIZE, rd, 8u));
+    TEST_ASSERT_EQUAL_HEX8(0xFFu, rd[0]);
+
+    Fls_Sim_GetStats(&st);
+    TEST_ASSERT_EQUAL_UINT32(2u, st.eraseCount);
+    TEST_ASSERT_EQUAL_UINT32(0u, st.pageEraseCount[0]);
+    TEST_ASSERT_EQUAL_UINT32(1u, st.pageEraseCount[1]);
+    TEST_ASSERT_EQUAL_UINT32(1u, st.pageEraseCount[2]);
+}
+
+/** @verifies SWR-BSW-031 — erase is polled, reads of that page refused */
+void test_Fls_Erase_nonblocking_and_read_guard(void)
+{
+    uint8 rd[8];
+    Fls_Sim_StatsType st;
+
+    Fls_Sim_SetLatency(5u, 0u);
+    TEST_ASSERT_EQUAL(E_OK, Fls_Erase(FLS_SIM_BASE_ADDRESS, FLS_SIM_PAGE_SIZE));
+
+    Fls_MainFunction();
+    TEST_ASSERT_EQUAL(MEMIF_BUSY, Fls_GetStatus());
+    TEST_ASSERT_EQUAL(E_NOT_OK, Fls_Read(FLS_SIM_BASE_ADDRESS + 16u, rd, 8u));
+    TEST_ASSERT_EQUAL(E_OK, Fls_Read(FLS_SIM_BASE_ADDRESS + FLS_SIM_PAGE_SIZE, rd, 8u));
+
+    run_until_idle(20u);
+    TEST_ASSERT_EQUAL(MEMIF_IDLE, Fls_GetStatus());
+    Fls_Sim_GetStats(&st);
+    TEST_ASSERT_TRUE(st.busyCycles >= 5u);
+}
+
+/** @verifies SWR-BSW-031 — second job refused while busy */
+void test_Fls_Busy_rejects_new_job(void)
+{
+    static const uint8 data[8] = { 0u };
+
+    TEST_ASSERT_EQUAL(E_OK, Fls_Erase(FLS_SIM_BASE_ADDRESS, FLS_SIM_PAGE_SIZE));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Fls_Write(FLS_SIM_BASE_ADDRESS, data, 8u));
+}
+
+/* ==================================================================
+ * Parameter validation
+ * ================================================================== */
+
+/** @verifies SWR-BSW-031 */
+void test_Fls_Misaligned_and_out_of_range(void)
+{
+    static const uint8 data[8] = { 0u };
+    uint8 rd[8];
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Fls_Write(FLS_SIM_BASE_ADDRESS + 4u, data, 8u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Fls_Erase(FLS_SIM_BASE_ADDRESS + 8u, FLS_SIM_PAGE_SIZE));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Fls_Erase(FLS_SIM_BASE_ADDRESS, 100u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Fls_Read(FLS_SIM_BASE_ADDRESS + FLS_SIM_SIZE - 4u, rd, 8u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Fls_Write(FLS_SIM_BASE_ADDRESS, NULL_PTR, 8u));
+    TEST_ASSERT_EQUAL(MEMIF_IDLE, Fls_GetStatus());
+}
+
+/** @verifies SWR-BSW-031 */
+void test_Fls_Init_null_config(void)
+{
+    uint8 rd[8];
+
+    Fls_Init(NULL_PTR);
+    TEST_ASSERT_EQUAL(MEMIF_UNINIT, Fls_GetStatus());
+    TEST_ASSERT_EQUAL(E_NOT_OK, Fls_Read(FLS_SIM_BASE_ADDRESS, rd, 8u));
+}
+
+/* ==================================================================
+ * Test runner
+ * ================================================================== */
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_Fls_Init_idle);
+    RUN_TEST(test_Fls_Write_is_asynchronous);
+    RUN_TEST(test_Fls_Write_pads_last_dword);
+    RUN_TEST(test_Fls_Write_budget_per_call);
+    RUN_TEST(test_Fls_Write_over_programmed_fails);
+    RUN_TEST(test_Fls_Erase_page);
+    RUN_TEST(test_Fls_Erase_nonblocking_and_read_guard);
+    RUN_TEST(test_Fls_Busy_rejects_new_job);
+
+    RUN_TEST(test_Fls_Misaligned_and_out_of_range);
+    RUN_TEST(test_Fls_Init_null_config);
+
+    return UNITY_END();
+}
@@ -0,0 +1,135 @@
+/**
+ * @file    test_Gpt_Posix.c
+ * @brief   Unit tests for Gpt_Posix — polled timer backend
+ * @date    2026-03-25
+ *
+ * @verifies SWR-BSW-010
+ *
+ * Tests that Gpt_Posix_Poll reports one expiry per elapsed period, so a
+ * late poll catches up instead of falling behind the monotonic clock.
+ * Runs on CLOCK_MONOTONIC: the tests sleep for a few periods and only
+ * assert lower bounds or the absence of early expiries. Gpt_Isr,
+ * normally in Gpt.c, is mocked here.
+ *
+ * @copyright Taktflow Systems 2026
+ */
+#define _POSIX_C_SOURCE 199309L  /* clock_gettime, nanosleep */
+
+#include "unity.h"
+
+#include "../mcal/posix/Gpt_Posix.c"
+
+/* ==================================================================
+ * Mock: Gpt_Isr — counts expiries, may stop the channel (one-shot)
+ * ================================================================== */
+
+static uint32  mock_isr_count;
+static uint8   mock_isr_channel;
+static boolean mock_isr_stop;
+
+void Gpt_Isr(uint8 Channel)
+{
+    mock_isr_count++;
+    mock_isr_channel = Channel;
+    if (mock_isr_stop == TRUE) {
+        (void)Gpt_Hw_StopTimer(Channel);
+    }
+}
+
+static void sleep_us(uint32 Us)
+{
+    struct timespec ts;
+
+    ts.tv_sec  = (time_t)(Us / 1000000u);
+    ts.tv_nsec = (long)(Us % 1000000u) * 1000L;
+    (void)nanosleep(&ts, NULL);
+}
+
+void setUp(void)
+{
+    mock_isr_count   = 0u;
+    mock_isr_channel = 0xFFu;
+    mock_isr_stop    = FALSE;
+    (void)Gpt_Hw_Init();
+}
+
+void tearDown(void) { }
+
+/* ==================================================================
+ * Gpt_Posix_Poll
+ * ================================================================== */
+
+/** @verifies SWR-BSW-010 */
+void test_Gpt_Posix_poll_before_target_reports_nothing(void)
+{
+    (void)Gpt_Hw_StartTimer(1u, 1000000u);   /* 1 s */
+
+    Gpt_Posix_Poll();
+
+    TEST_ASSERT_EQUAL_UINT32(0u, mock_isr_count);
+}
+
+/** @verifies SWR-BSW-010 */
+void test_Gpt_Posix_late_poll_reports_every_elapsed_period(void)
+{
+    (void)Gpt_Hw_StartTimer(2u, 1000u);      /* 1 ms */
+    sleep_us(3500u);
+
+    Gpt_Posix_Poll();
+
+    TEST_ASSERT_TRUE(mock_isr_count >= 3u);
+    TEST_ASSERT_EQUAL_UINT8(2u, mock_isr_channel);
+}
+
+/** @verifies SWR-BSW-010 */
+void test_Gpt_Posix_late_poll_keeps_phase(void)
+{
+    (void)Gpt_Hw_StartTimer(0u, 1000u);
+    sleep_us(3500u);
+    Gpt_Posix_Poll();
+
+    /* Caught up: the next expiry is less than one period away */
+    TEST_ASSERT_TRUE(Gpt_Hw_GetCounter(0u) < 1000u);
+}
+
+/** @verifies SWR-BSW-010 */
+void test_Gpt_Posix_stopped_channel_ends_catch_up(void)
+{
+    mock_isr_stop = TRUE;                    /* As Gpt_Isr in one-shot mode */
+    (void)Gpt_Hw_StartTimer(0u, 1000u);
+    sleep_us(3500u);
+
+    Gpt_Posix_Poll();
+    Gpt_Posix_Poll();
+
+    TEST_ASSERT_EQUAL_UINT32(1u, mock_isr_count);
+}
+
+/** @verifies SWR-BSW-010 */
+void test_Gpt_Posix_stopped_timer_not_polled(void)
+{
+    (void)Gpt_Hw_StartTimer(3u, 1000u);
+    (void)Gpt_Hw_StopTimer(3u);
+    sleep_us(1500u);
+
+    Gpt_Posix_Poll();
+
+    TEST_ASSERT_EQUAL_UINT32(0u, mock_isr_count);
+}
+
+/* ==================================================================
+ * Test runner
+ * ================================================================== */
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_Gpt_Posix_poll_before_target_reports_nothing);
+    RUN_TEST(test_Gpt_Posix_late_poll_reports_every_elapsed_period);
+    RUN_TEST(test_Gpt_Posix_late_poll_keeps_phase);
+    RUN_TEST(test_Gpt_Posix_stopped_channel_ends_catch_up);
+    RUN_TEST(test_Gpt_Posix_stopped_timer_not_polled);
+
+    return UNITY_END();
+}
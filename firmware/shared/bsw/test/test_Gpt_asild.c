@@ -23,6 +23,11 @@ static boolean      mock_hw_stop_called[GPT_MAX_CHANNELS];
 static uint32       mock_hw_start_value[GPT_MAX_CHANNELS];
 static uint32       mock_hw_counter[GPT_MAX_CHANNELS];
 
+static uint8        notify_count[2];
+
+static void test_notify_ch0(void) { notify_count[0]++; }
+static void test_notify_ch1(void) { notify_count[1]++; }
+
 /* ---- Hardware mock implementations ---- */
 
 Std_ReturnType Gpt_Hw_Init(void)
@@ -87,11 +92,16 @@ void setUp(void)
     test_ch_configs[0].prescaler = 169u;  /* 170 MHz / 170 = 1 MHz */
     test_ch_configs[0].period = 0xFFFFFFFFu;
     test_ch_configs[0].mode = GPT_MODE_CONTINUOUS;
+    test_ch_configs[0].notification = test_notify_ch0;
 
     /* Channel 1: one-shot timeout timer */
     test_ch_configs[1].prescaler = 169u;
     test_ch_configs[1].period = 500u;     /* 500 us timeout */
     test_ch_configs[1].mode = GPT_MODE_ONESHOT;
+    test_ch_configs[1].notification = test_notify_ch1;
+
+    notify_count[0] = 0u;
+    notify_count[1] = 0u;
 
     test_config.numChannels = 2u;
     test_config.channels = test_ch_configs;
@@ -425,6 +435,81 @@ void test_Gpt_StopTimer_before_init_fails(void)
     TEST_ASSERT_EQUAL(E_NOT_OK, ret);
 }
 
+/* ==================================================================
+ * SWR-BSW-010: Channel notifications
+ * ================================================================== */
+
+/** @verifies SWR-BSW-010 */
+void test_Gpt_Isr_notification_only_when_enabled(void)
+{
+    Gpt_Init(&test_config);
+    (void)Gpt_StartTimer(0u, 100u);
+
+    Gpt_Isr(0u);
+    TEST_ASSERT_EQUAL_UINT8(0u, notify_count[0]);
+
+    TEST_ASSERT_EQUAL(E_OK, Gpt_EnableNotification(0u));
+    Gpt_Isr(0u);
+    Gpt_Isr(0u);
+    TEST_ASSERT_EQUAL_UINT8(2u, notify_count[0]);
+
+    TEST_ASSERT_EQUAL(E_OK, Gpt_DisableNotification(0u));
+    Gpt_Isr(0u);
+    TEST_ASSERT_EQUAL_UINT8(2u, notify_count[0]);
+}
+
+/** @verifies SWR-BSW-010 */
+void test_Gpt_Isr_oneshot_stops_channel(void)
+{
+    Gpt_Init(&test_config);
+    (void)Gpt_EnableNotification(1u);
+    (void)Gpt_StartTimer(1u, 500u);
+
+    Gpt_Isr(1u);
+    TEST_ASSERT_EQUAL_UINT8(1u, notify_count[1]);
+    TEST_ASSERT_TRUE(mock_hw_stop_called[1]);
+
+    /* Late interrupt of the stopped channel is ignored */
+    Gpt_Isr(1u);
+    TEST_ASSERT_EQUAL_UINT8(1u, notify_count[1]);
+}
+
+/** @verifies SWR-BSW-010 */
+void test_Gpt_Isr_continuous_keeps_running(void)
+{
+    Gpt_Init(&test_config);
+    (void)Gpt_EnableNotification(0u);
+    (void)Gpt_StartTimer(0u, 100u);
+
+    Gpt_Isr(0u);
+    Gpt_Isr(0u);
+    TEST_ASSERT_EQUAL_UINT8(2u, notify_count[0]);
+    TEST_ASSERT_FALSE(mock_hw_stop_called[0]);
+}
+
+/** @verifies SWR-BSW-010 */
+void test_Gpt_Isr_stopped_or_invalid_channel_ignored(void)
+{
+    Gpt_Init(&test_config);
+    (void)Gpt_EnableNotification(0u);
+
+    Gpt_Isr(0u);                    /* Not started */
+    Gpt_Isr(GPT_MAX_CHANNELS);
+    TEST_ASSERT_EQUAL_UINT8(0u, notify_count[0]);
+}
+
+/** @verifies SWR-BSW-010 */
+void test_Gpt_EnableNotification_rejects_invalid(void)
+{
+    TEST_ASSERT_EQUAL(E_NOT_OK, Gpt_EnableNotification(0u));    /* Uninit */
+
+    test_ch_configs[1].notification = NULL_PTR;
+    Gpt_Init(&test_config);
+    TEST_ASSERT_EQUAL(E_NOT_OK, Gpt_EnableNotification(1u));    /* None */
+    TEST_ASSERT_EQUAL(E_NOT_OK, Gpt_EnableNotification(2u));    /* Range */
+    TEST_ASSERT_EQUAL(E_NOT_OK, Gpt_DisableNotification(2u));
+}
+
 /* ==================================================================
  * Test Runner
  * ================================================================== */
@@ -481,5 +566,12 @@ int main(void)
     RUN_TEST(test_Gpt_GetTimeElapsed_channel_not_started_returns_hw_counter);
     RUN_TEST(test_Gpt_StopTimer_before_init_fails);
 
+    /* Channel notifications */
+    RUN_TEST(test_Gpt_Isr_notification_only_when_enabled);
+    RUN_TEST(test_Gpt_Isr_oneshot_stops_channel);
+    RUN_TEST(test_Gpt_Isr_continuous_keeps_running);
+    RUN_TEST(test_Gpt_Isr_stopped_or_invalid_channel_ignored);
+    RUN_TEST(test_Gpt_EnableNotification_rejects_invalid);
+
     return UNITY_END();
 }
@@ -7,10 +7,12 @@
  *
  * Tests sensor read functions (pedal, steering, motor current, motor temp,
  * battery voltage, e-stop) and actuator write functions (motor PWM,
- * steering servo, brake servo) via mocked MCAL calls.
+ * steering servo, brake servo) via mocked MCAL calls, and the cached
+ * asynchronous angle read.
  */
 #include "unity.h"
 #include "IoHwAb.h"
+#include "Spi.h"
 
 /* ==================================================================
  * Mock: SPI (used by pedal angle, steering angle sensors)
@@ -20,6 +22,9 @@ static uint16         mock_spi_tx_buf[4];
 static uint16         mock_spi_rx_buf[4];
 static Std_ReturnType mock_spi_result;
 static uint8          mock_spi_sync_count;
+static uint16         mock_spi_channel_rx[4];   /* Per channel, 0: rx_buf */
+static uint8          mock_spi_async_count;
+static Spi_SeqResultType mock_spi_seq_result;
 
 Std_ReturnType Spi_WriteIB(uint8 Channel, const uint16* DataBufferPtr)
 {
@@ -32,9 +37,11 @@ Std_ReturnType Spi_WriteIB(uint8 Channel, const uint16* DataBufferPtr)
 
 Std_ReturnType Spi_ReadIB(uint8 Channel, uint16* DataBufferPtr)
 {
-    (void)Channel;
     if (DataBufferPtr != NULL_PTR) {
         DataBufferPtr[0] = mock_spi_rx_buf[0];
+        if ((Channel < 4u) && (mock_spi_channel_rx[Channel] != 0u)) {
+            DataBufferPtr[0] = mock_spi_channel_rx[Channel];
+        }
         DataBufferPtr[1] = mock_spi_rx_buf[1];
         DataBufferPtr[2] = mock_spi_rx_buf[2];
         DataBufferPtr[3] = mock_spi_rx_buf[3];
@@ -49,6 +56,30 @@ Std_ReturnType Spi_SyncTransmit(uint8 Sequence)
     return mock_spi_result;
 }
 
+Std_ReturnType Spi_AsyncTransmit(uint8 Sequence)
+{
+    (void)Sequence;
+    mock_spi_async_count++;
+    return E_OK;
+}
+
+Spi_SeqResultType Spi_GetSequenceResult(uint8 Sequence)
+{
+    (void)Sequence;
+    return mock_spi_seq_result;
+}
+
+/* ==================================================================
+ * Mock: Timestamp (asynchronous angle read)
+ * ================================================================== */
+
+static uint32 mock_time_us;
+
+static uint32 mock_get_time_us(void)
+{
+    return mock_time_us;
+}
+
 /* ==================================================================
  * Mock: ADC (used by motor current, motor temp, battery voltage)
  * ================================================================== */
@@ -129,6 +160,9 @@ void setUp(void)
 
     mock_spi_result      = E_OK;
     mock_spi_sync_count  = 0u;
+    mock_spi_async_count = 0u;
+    mock_spi_seq_result  = SPI_SEQ_OK;
+    mock_time_us         = 100000u;
     mock_adc_result      = E_OK;
     mock_adc_start_count = 0u;
     mock_pwm_set_count   = 0u;
@@ -138,6 +172,7 @@ void setUp(void)
     for (i = 0u; i < 4u; i++) {
         mock_spi_tx_buf[i]  = 0u;
         mock_spi_rx_buf[i]  = 0u;
+        mock_spi_channel_rx[i] = 0u;
     }
     for (i = 0u; i < 8u; i++) {
         mock_adc_values[i]  = 0u;
@@ -164,6 +199,11 @@ void setUp(void)
     test_config.MotorDirAChannel     = 3u;
     test_config.MotorDirBChannel     = 4u;
     test_config.EStopDioChannel      = 5u;
+    test_config.AngleAsyncSensors    = 0u;
+    test_config.AngleSpiSequence     = 0u;
+    test_config.PedalSpiChannel1     = 2u;
+    test_config.AngleMaxAgeUs        = 15000u;
+    test_config.GetTimestampUs       = mock_get_time_us;
 
     IoHwAb_Init(&test_config);
 }
@@ -517,6 +557,122 @@ void test_IoHwAb_ReadBatteryVoltage_adc_max(void)
     TEST_ASSERT_TRUE(voltage_mV > 0u);
 }
 
+/* ==================================================================
+ * SWR-BSW-014: Asynchronous Angle Read (cached samples)
+ * ================================================================== */
+
+static void init_async(uint8 Sensors)
+{
+    test_config.AngleAsyncSensors = Sensors;
+    IoHwAb_Init(&test_config);
+}
+
+/** @verifies SWR-BSW-014 — MainFunction starts the sequence */
+void test_IoHwAb_MainFunction_starts_sequence(void)
+{
+    IoHwAb_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_spi_async_count);   /* Sync config */
+
+    init_async(IOHWAB_ANGLE_PEDAL_0 | IOHWAB_ANGLE_PEDAL_1);
+    IoHwAb_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_spi_async_count);
+}
+
+/** @verifies SWR-BSW-014 — cached pedal angles, no synchronous transfer */
+void test_IoHwAb_ReadPedalAngle_async_cached(void)
+{
+    uint16 angle0 = 0u;
+    uint16 angle1 = 0u;
+
+    init_async(IOHWAB_ANGLE_PEDAL_0 | IOHWAB_ANGLE_PEDAL_1);
+    mock_spi_channel_rx[0] = 0xC100u;  /* Flag bits set: masked */
+    mock_spi_channel_rx[2] = 0x0200u;
+    IoHwAb_AngleReadNotification();
+
+    TEST_ASSERT_EQUAL(E_OK, IoHwAb_ReadPedalAngle(0u, &angle0));
+    TEST_ASSERT_EQUAL(E_OK, IoHwAb_ReadPedalAngle(1u, &angle1));
+    TEST_ASSERT_EQUAL_UINT16(0x0100u, angle0);
+    TEST_ASSERT_EQUAL_UINT16(0x0200u, angle1);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_spi_sync_count);
+}
+
+/** @verifies SWR-BSW-014 — no sample before the first sequence */
+void test_IoHwAb_ReadPedalAngle_async_no_sample(void)
+{
+    uint16 angle = 0u;
+
+    init_async(IOHWAB_ANGLE_PEDAL_0);
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, IoHwAb_ReadPedalAngle(0u, &angle));
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_spi_sync_count);
+}
+
+/** @verifies SWR-BSW-014 — stale sample is a read failure */
+void test_IoHwAb_ReadPedalAngle_async_stale(void)
+{
+    uint16 angle = 0u;
+
+    init_async(IOHWAB_ANGLE_PEDAL_0);
+    IoHwAb_AngleReadNotification();
+
+    mock_time_us += 15000u;
+    TEST_ASSERT_EQUAL(E_OK, IoHwAb_ReadPedalAngle(0u, &angle));
+    mock_time_us += 1u;
+    TEST_ASSERT_EQUAL(E_NOT_OK, IoHwAb_ReadPedalAngle(0u, &angle));
+}
+
+/** @verifies SWR-BSW-014 — failed sequence invalidates the cache */
+void test_IoHwAb_ReadPedalAngle_async_sequence_failed(void)
+{
+    uint16 angle = 0u;
+
+    init_async(IOHWAB_ANGLE_PEDAL_0);
+    IoHwAb_AngleReadNotification();
+    TEST_ASSERT_EQUAL(E_OK, IoHwAb_ReadPedalAngle(0u, &angle));
+
+    mock_spi_seq_result = SPI_SEQ_FAILED;
+    IoHwAb_AngleReadNotification();
+    TEST_ASSERT_EQUAL(E_NOT_OK, IoHwAb_ReadPedalAngle(0u, &angle));
+}
+
+/** @verifies SWR-BSW-014 — sensor not in the sequence still read synchronously */
+void test_IoHwAb_ReadPedalAngle_async_other_sensor_sync(void)
+{
+    uint16 angle = 0u;
+
+    init_async(IOHWAB_ANGLE_PEDAL_0);
+    mock_spi_rx_buf[0] = 0x0123u;
+
+    TEST_ASSERT_EQUAL(E_OK, IoHwAb_ReadPedalAngle(1u, &angle));
+    TEST_ASSERT_EQUAL_UINT16(0x0123u, angle);
+    TEST_ASSERT_TRUE(mock_spi_sync_count > 0u);
+}
+
+/** @verifies SWR-BSW-014 — cached steering angle */
+void test_IoHwAb_ReadSteeringAngle_async_cached(void)
+{
+    uint16 angle = 0u;
+
+    init_async(IOHWAB_ANGLE_STEERING);
+    mock_spi_channel_rx[1] = 0x1ABCu;
+    IoHwAb_AngleReadNotification();
+
+    TEST_ASSERT_EQUAL(E_OK, IoHwAb_ReadSteeringAngle(&angle));
+    TEST_ASSERT_EQUAL_UINT16(0x1ABCu, angle);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_spi_sync_count);
+}
+
+/** @verifies SWR-BSW-014 — async read needs a timestamp source */
+void test_IoHwAb_Init_async_without_timestamp_fails(void)
+{
+    uint16 angle = 0u;
+
+    test_config.GetTimestampUs = NULL_PTR;
+    init_async(IOHWAB_ANGLE_PEDAL_0);
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, IoHwAb_ReadPedalAngle(0u, &angle));
+}
+
 /* ==================================================================
  * Test runner
  * ================================================================== */
@@ -566,5 +722,15 @@ int main(void)
     RUN_TEST(test_IoHwAb_ReadBatteryVoltage_adc_min);
     RUN_TEST(test_IoHwAb_ReadBatteryVoltage_adc_max);
 
+    /* Asynchronous angle read */
+    RUN_TEST(test_IoHwAb_MainFunction_starts_sequence);
+    RUN_TEST(test_IoHwAb_ReadPedalAngle_async_cached);
+    RUN_TEST(test_IoHwAb_ReadPedalAngle_async_no_sample);
+    RUN_TEST(test_IoHwAb_ReadPedalAngle_async_stale);
+    RUN_TEST(test_IoHwAb_ReadPedalAngle_async_sequence_failed);
+    RUN_TEST(test_IoHwAb_ReadPedalAngle_async_other_sensor_sync);
+    RUN_TEST(test_IoHwAb_ReadSteeringAngle_async_cached);
+    RUN_TEST(test_IoHwAb_Init_async_without_timestamp_fails);
+
     return UNITY_END();
 }
@@ -0,0 +1,186 @@
+/**
+ * @file    test_NvM_asild.c
+ * @brief   Unit tests for NVRAM Manager (POSIX memory-mapped image backend)
+ * @date    2026-02-25
+ *
+ * @verifies SWR-BSW-031
+ *
+ * Tests block read/write through the mapped image, first-boot behaviour,
+ * persistence across re-init, header validation and parameter checks.
+ * Uses a private image file under /tmp selected via NVM_IMAGE_PATH.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include "unity.h"
+#include "NvM.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#define TEST_NVM_IMAGE  "/tmp/test_nvm_unit.img"
+
+static uint8 wr_buf[NVM_BLOCK_SIZE];
+static uint8 rd_buf[NVM_BLOCK_SIZE];
+
+void setUp(void)
+{
+    (void)unlink(TEST_NVM_IMAGE);
+    (void)setenv("NVM_IMAGE_PATH", TEST_NVM_IMAGE, 1);
+    (void)memset(wr_buf, 0, sizeof(wr_buf));
+    (void)memset(rd_buf, 0, sizeof(rd_buf));
+    NvM_Init();
+}
+
+void tearDown(void)
+{
+    (void)unlink(TEST_NVM_IMAGE);
+}
+
+/* ==================================================================
+ * SWR-BSW-031: Block read/write
+ * ================================================================== */
+
+/** @verifies SWR-BSW-031 — first boot leaves RAM mirror untouched */
+void test_NvM_Read_unwritten_block_keeps_defaults(void)
+{
+    (void)memset(rd_buf, 0xA5, sizeof(rd_buf));
+
+    TEST_ASSERT_EQUAL(E_OK, NvM_ReadBlock(0u, rd_buf));
+    TEST_ASSERT_EQUAL_HEX8(0xA5u, rd_buf[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xA5u, rd_buf[NVM_BLOCK_SIZE - 1u]);
+}
+
+/** @verifies SWR-BSW-031 */
+void test_NvM_Write_then_read_roundtrip(void)
+{
+    uint16 i;
+    for (i = 0u; i < NVM_BLOCK_SIZE; i++) {
+        wr_buf[i] = (uint8)(i & 0xFFu);
+    }
+
+    TEST_ASSERT_EQUAL(E_OK, NvM_WriteBlock(1u, wr_buf));
+    TEST_ASSERT_EQUAL(E_OK, NvM_ReadBlock(1u, rd_buf));
+    TEST_ASSERT_EQUAL_MEMORY(wr_buf, rd_buf, NVM_BLOCK_SIZE);
+}
+
+/** @verifies SWR-BSW-031 — blocks do not overlap in the image */
+void test_NvM_Blocks_independent(void)
+{
+    (void)memset(wr_buf, 0x11, sizeof(wr_buf));
+    TEST_ASSERT_EQUAL(E_OK, NvM_WriteBlock(0u, wr_buf));
+    (void)memset(wr_buf, 0x22, sizeof(wr_buf));
+    TEST_ASSERT_EQUAL(E_OK, NvM_WriteBlock(1u, wr_buf));
+
+    TEST_ASSERT_EQUAL(E_OK, NvM_ReadBlock(0u, rd_buf));
+    TEST_ASSERT_EQUAL_HEX8(0x11u, rd_buf[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x11u, rd_buf[NVM_BLOCK_SIZE - 1u]);
+
+    TEST_ASSERT_EQUAL(E_OK, NvM_ReadBlock(1u, rd_buf));
+    TEST_ASSERT_EQUAL_HEX8(0x22u, rd_buf[0]);
+}
+
+/** @verifies SWR-BSW-031 — data survives re-mapping (process restart) */
+void test_NvM_Persists_across_reinit(void)
+{
+    (void)memset(wr_buf, 0x5A, sizeof(wr_buf));
+    TEST_ASSERT_EQUAL(E_OK, NvM_WriteBlock(2u, wr_buf));
+    NvM_MainFunction();
+
+    NvM_Init();
+
+    TEST_ASSERT_EQUAL(E_OK, NvM_ReadBlock(2u, rd_buf));
+    TEST_ASSERT_EQUAL_MEMORY(wr_buf, rd_buf, NVM_BLOCK_SIZE);
+}
+
+/** @verifies SWR-BSW-031 — image preallocated to header + all blocks */
+void test_NvM_Image_preallocated(void)
+{
+    FILE* f = fopen(TEST_NVM_IMAGE, "rb");
+    long size;
+
+    TEST_ASSERT_NOT_NULL(f);
+    (void)fseek(f, 0L, SEEK_END);
+    size = ftell(f);
+    (void)fclose(f);
+
+    TEST_ASSERT_TRUE(size >= (long)(NVM_MAX_BLOCKS * NVM_BLOCK_SIZE));
+}
+
+/** @verifies SWR-BSW-031 — foreign/corrupt header is reformatted */
+void test_NvM_Corrupt_header_reformats(void)
+{
+    FILE* f;
+
+    (void)memset(wr_buf, 0x77, sizeof(wr_buf));
+    TEST_ASSERT_EQUAL(E_OK, NvM_WriteBlock(0u, wr_buf));
+    NvM_MainFunction();
+
+    /* Clobber the magic number on disk */
+    f = fopen(TEST_NVM_IMAGE, "r+b");
+    TEST_ASSERT_NOT_NULL(f);
+    (void)fputc(0x00, f);
+    (void)fclose(f);
+
+    NvM_Init();
+
+    (void)memset(rd_buf, 0xEE, sizeof(rd_buf));
+    TEST_ASSERT_EQUAL(E_OK, NvM_ReadBlock(0u, rd_buf));
+    TEST_ASSERT_EQUAL_HEX8(0xEEu, rd_buf[0]);
+}
+
+/** @verifies SWR-BSW-031 — flush with nothing dirty is a no-op */
+void test_NvM_MainFunction_idle(void)
+{
+    NvM_MainFunction();
+    NvM_MainFunction();
+
+    TEST_ASSERT_EQUAL(E_OK, NvM_ReadBlock(0u, rd_buf));
+}
+
+/* ==================================================================
+ * Parameter validation
+ * ================================================================== */
+
+/** @verifies SWR-BSW-031 */
+void test_NvM_Read_null_ptr(void)
+{
+    TEST_ASSERT_EQUAL(E_NOT_OK, NvM_ReadBlock(0u, NULL_PTR));
+}
+
+/** @verifies SWR-BSW-031 */
+void test_NvM_Write_null_ptr(void)
+{
+    TEST_ASSERT_EQUAL(E_NOT_OK, NvM_WriteBlock(0u, NULL_PTR));
+}
+
+/** @verifies SWR-BSW-031 */
+void test_NvM_Invalid_block_id(void)
+{
+    TEST_ASSERT_EQUAL(E_NOT_OK, NvM_ReadBlock((NvM_BlockIdType)NVM_MAX_BLOCKS, rd_buf));
+    TEST_ASSERT_EQUAL(E_NOT_OK, NvM_WriteBlock((NvM_BlockIdType)NVM_MAX_BLOCKS, wr_buf));
+}
+
+/* ==================================================================
+ * Test runner
+ * ================================================================== */
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_NvM_Read_unwritten_block_keeps_defaults);
+    RUN_TEST(test_NvM_Write_then_read_roundtrip);
+    RUN_TEST(test_NvM_Blocks_independent);
+    RUN_TEST(test_NvM_Persists_across_reinit);
+    RUN_TEST(test_NvM_Image_preallocated);
+    RUN_TEST(test_NvM_Corrupt_header_reformats);
+    RUN_TEST(test_NvM_MainFunction_idle);
+
+    RUN_TEST(test_NvM_Read_null_ptr);
+    RUN_TEST(test_NvM_Write_null_ptr);
+    RUN_TEST(test_NvM_Invalid_block_id);
+
+    return UNITY_END();
+}
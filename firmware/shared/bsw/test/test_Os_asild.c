@@ -0,0 +1,482 @@
+/**
+ * @file    test_Os_asild.c
+ * @brief   Unit tests for Os — preemptive basic tasks
+ * @date    2026-03-14
+ *
+ * @verifies SWR-BSW-043
+ *
+ * Tests task table validation, tick-driven activation, preemption between
+ * levels, in-level order, overrun detection, latency measurement and the
+ * level stack high-water mark. The interrupt controller is mocked: a
+ * triggered level is pended and run by mock_nvic_run() when it is above
+ * the level currently executing.
+ */
+#include "unity.h"
+#include "Os.h"
+
+/* ==================================================================
+ * Mock Hardware Layer
+ * ================================================================== */
+
+static uint8   mock_pending;            /**< Bit per pended level         */
+static sint8   mock_active_level;       /**< -1: background               */
+static uint32  mock_cycles;
+static uint8   mock_trigger_count;
+static boolean mock_hw_init_called;
+static boolean mock_hw_start_called;
+
+void Os_Hw_Init(const Os_LevelConfigType* Levels, uint8 LevelCount)
+{
+    (void)Levels;
+    (void)LevelCount;
+    mock_hw_init_called = TRUE;
+}
+
+void Os_Hw_Start(void)
+{
+    mock_hw_start_called = TRUE;
+}
+
+void Os_Hw_TriggerLevel(uint8 Level)
+{
+    mock_pending |= (uint8)(1u << Level);
+    mock_trigger_count++;
+}
+
+uint32 Os_Hw_GetCycles(void)
+{
+    return mock_cycles;
+}
+
+/** Run pended levels above the active one, highest first (NVIC) */
+static void mock_nvic_run(void)
+{
+    sint8 lvl;
+
+    for (lvl = (sint8)(OS_MAX_LEVELS - 1u); lvl > mock_active_level; lvl--) {
+        if ((mock_pending & (1u << (uint8)lvl)) != 0u) {
+            sint8 prev = mock_active_level;
+
+            mock_pending &= (uint8)~(1u << (uint8)lvl);
+            mock_active_level = lvl;
+            Os_DispatchLevel((uint8)lvl);
+            mock_active_level = prev;
+            lvl = (sint8)OS_MAX_LEVELS; /* rescan from the top */
+        }
+    }
+}
+
+/* ==================================================================
+ * Test Tasks
+ * ================================================================== */
+
+#define TRACE_MAX 32u
+
+static char  trace_log[TRACE_MAX];
+static uint8 trace_count;
+static Os_TaskType running_seen;
+
+static void trace(char c)
+{
+    if (trace_count < TRACE_MAX) {
+        trace_log[trace_count] = c;
+        trace_count++;
+    }
+}
+
+static void Task_Fast(void)   { trace('F'); }
+static void Task_Mid(void)    { trace('M'); }
+static void Task_Slow(void)   { trace('S'); }
+
+/** Low-level task that activates the high-level task halfway */
+static void Task_LowPreempted(void)
+{
+    trace('l');
+    (void)Os_ActivateTask(1u);
+    mock_nvic_run();            /* pended higher level runs now */
+    running_seen = Os_GetRunningTask();
+    trace('L');
+}
+
+static void Task_High(void)
+{
+    running_seen = Os_GetRunningTask();
+    trace('H');
+}
+
+/* ==================================================================
+ * Test Fixtures
+ * ================================================================== */
+
+#define TEST_STACK_WORDS 16u
+
+static uint32 test_stack[3][TEST_STACK_WORDS];
+
+static const Os_LevelConfigType test_levels[3] = {
+    { test_stack[0], TEST_STACK_WORDS },
+    { test_stack[1], TEST_STACK_WORDS },
+    { test_stack[2], TEST_STACK_WORDS },
+};
+
+/* 1 ms task on the top level, 10 ms on the middle, 100 ms at the bottom */
+static const Os_TaskConfigType test_tasks[3] = {
+    { Task_Fast,   1u, 0u, 2u },
+    { Task_Mid,   10u, 0u, 1u },
+    { Task_Slow, 100u, 5u, 0u },
+};
+
+static Os_TaskConfigType mut_tasks[3];
+static Os_ConfigType     test_config;
+
+void setUp(void)
+{
+    mock_pending         = 0u;
+    mock_active_level    = -1;
+    mock_cycles          = 0u;
+    mock_trigger_count   = 0u;
+    mock_hw_init_called  = FALSE;
+    mock_hw_start_called = FALSE;
+    trace_count          = 0u;
+    running_seen         = OS_TASK_NONE;
+
+    for (uint8 i = 0u; i < 3u; i++) {
+        mut_tasks[i] = test_tasks[i];
+    }
+
+    test_config.tasks      = mut_tasks;
+    test_config.taskCount  = 3u;
+    test_config.levels     = test_levels;
+    test_config.levelCount = 3u;
+}
+
+void tearDown(void) { }
+
+static void run_ticks(uint16 n)
+{
+    for (uint16 i = 0u; i < n; i++) {
+        Os_Tick();
+        mock_nvic_run();
+    }
+}
+
+static uint32 activations(Os_TaskType id)
+{
+    Os_TaskStatsType stats;
+
+    TEST_ASSERT_EQUAL(E_OK, Os_GetTaskStats(id, &stats));
+    return stats.activations;
+}
+
+/* ==================================================================
+ * SWR-BSW-043: Initialization
+ * ================================================================== */
+
+/** @verifies SWR-BSW-043 */
+void test_Os_Init_null_config_not_initialized(void)
+{
+    Os_Init(NULL_PTR);
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Os_ActivateTask(0u));
+    TEST_ASSERT_FALSE(mock_hw_init_called);
+}
+
+/** @verifies SWR-BSW-043 */
+void test_Os_Init_task_level_out_of_range_not_initialized(void)
+{
+    mut_tasks[1].level = 3u;
+
+    Os_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Os_ActivateTask(0u));
+}
+
+/** @verifies SWR-BSW-043 */
+void test_Os_Init_offset_not_below_period_not_initialized(void)
+{
+    mut_tasks[2].offsetMs = 100u;
+
+    Os_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Os_ActivateTask(0u));
+}
+
+/** @verifies SWR-BSW-043 */
+void test_Os_Init_fills_level_stacks(void)
+{
+    test_stack[1][3] = 0u;
+
+    Os_Init(&test_config);
+
+    TEST_ASSERT_TRUE(mock_hw_init_called);
+    TEST_ASSERT_EQUAL_HEX32(OS_STACK_FILL, test_stack[1][3]);
+    TEST_ASSERT_EQUAL_UINT16(0u, Os_GetStackUsage(1u));
+}
+
+/* ==================================================================
+ * SWR-BSW-043: Tick-driven activation
+ * ================================================================== */
+
+/** @verifies SWR-BSW-043 */
+void test_Os_Tick_before_start_activates_nothing(void)
+{
+    Os_Init(&test_config);
+
+    run_ticks(20u);
+
+    TEST_ASSERT_EQUAL_UINT8(0u, trace_count);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_trigger_count);
+}
+
+/** @verifies SWR-BSW-043 */
+void test_Os_Tick_activates_by_period_and_offset(void)
+{
+    Os_Init(&test_config);
+    Os_Start();
+
+    run_ticks(200u);
+
+    TEST_ASSERT_TRUE(mock_hw_start_called);
+    TEST_ASSERT_EQUAL_UINT32(200u, activations(0u));
+    TEST_ASSERT_EQUAL_UINT32(20u, activations(1u));
+    TEST_ASSERT_EQUAL_UINT32(2u, activations(2u));
+}
+
+/** @verifies SWR-BSW-043 */
+void test_Os_Tick_offset_delays_first_activation(void)
+{
+    Os_Init(&test_config);
+    Os_Start();
+
+    run_ticks(5u);
+    TEST_ASSERT_EQUAL_UINT32(0u, activations(2u));
+
+    run_ticks(1u);
+    TEST_ASSERT_EQUAL_UINT32(1u, activations(2u));
+
+    run_ticks(100u);
+    TEST_ASSERT_EQUAL_UINT32(2u, activations(2u));
+}
+
+/* ==================================================================
+ * SWR-BSW-043: Preemption and ordering
+ * ================================================================== */
+
+/** @verifies SWR-BSW-043 */
+void test_Os_levels_run_highest_first(void)
+{
+    Os_Init(&test_config);
+    Os_Start();
+
+    /* Tick 0: 1 ms and 10 ms due; tick 5: 1 ms and 100 ms due */
+    run_ticks(6u);
+
+    TEST_ASSERT_EQUAL_UINT8(8u, trace_count);
+    TEST_ASSERT_EQUAL_MEMORY("FMFFFFFS", trace_log, 8u);
+}
+
+/** @verifies SWR-BSW-043 */
+void test_Os_higher_level_preempts_running_task(void)
+{
+    mut_tasks[0].func     = Task_LowPreempted;
+    mut_tasks[0].periodMs = 0u;
+    mut_tasks[0].level    = 0u;
+    mut_tasks[1].func     = Task_High;
+    mut_tasks[1].periodMs = 0u;
+    mut_tasks[1].level    = 2u;
+    test_config.taskCount = 2u;
+    Os_Init(&test_config);
+    Os_Start();
+
+    TEST_ASSERT_EQUAL(E_OK, Os_ActivateTask(0u));
+    mock_nvic_run();
+
+    TEST_ASSERT_EQUAL_UINT8(3u, trace_count);
+    TEST_ASSERT_EQUAL_MEMORY("lHL", trace_log, 3u);
+    TEST_ASSERT_EQUAL_UINT8(0u, running_seen);
+    TEST_ASSERT_EQUAL_UINT8(OS_TASK_NONE, Os_GetRunningTask());
+}
+
+/** @verifies SWR-BSW-043 */
+void test_Os_running_task_reported_inside_task(void)
+{
+    mut_tasks[2].func = Task_High;
+    Os_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(E_OK, Os_ActivateTask(2u));
+    mock_nvic_run();
+
+    TEST_ASSERT_EQUAL_UINT8(2u, running_seen);
+}
+
+/** @verifies SWR-BSW-043 */
+void test_Os_same_level_runs_in_config_order(void)
+{
+    mut_tasks[0].level = 1u;
+    mut_tasks[1].level = 1u;
+    mut_tasks[2].level = 1u;
+    Os_Init(&test_config);
+
+    /* Activated in reverse order, both pend the same level */
+    TEST_ASSERT_EQUAL(E_OK, Os_ActivateTask(2u));
+    TEST_ASSERT_EQUAL(E_OK, Os_ActivateTask(0u));
+    mock_nvic_run();
+
+    TEST_ASSERT_EQUAL_UINT8(2u, trace_count);
+    TEST_ASSERT_EQUAL_MEMORY("FS", trace_log, 2u);
+}
+
+/* ==================================================================
+ * SWR-BSW-043: Overrun
+ * ================================================================== */
+
+/** @verifies SWR-BSW-043 */
+void test_Os_ActivateTask_pending_task_counts_overrun(void)
+{
+    Os_TaskStatsType stats;
+
+    Os_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(E_OK, Os_ActivateTask(1u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Os_ActivateTask(1u));
+    mock_nvic_run();
+
+    TEST_ASSERT_EQUAL_UINT8(1u, trace_count);
+    TEST_ASSERT_EQUAL(E_OK, Os_GetTaskStats(1u, &stats));
+    TEST_ASSERT_EQUAL_UINT32(1u, stats.activations);
+    TEST_ASSERT_EQUAL_UINT32(1u, stats.overruns);
+
+    /* Suspended again after it ran */
+    TEST_ASSERT_EQUAL(E_OK, Os_ActivateTask(1u));
+}
+
+/** @verifies SWR-BSW-043 */
+void test_Os_ActivateTask_invalid_id_rejected(void)
+{
+    Os_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Os_ActivateTask(3u));
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_trigger_count);
+}
+
+/* ==================================================================
+ * SWR-BSW-043: Latency measurement
+ * ================================================================== */
+
+/** @verifies SWR-BSW-043 */
+void test_Os_latency_measured_from_activation_to_start(void)
+{
+    Os_TaskStatsType stats;
+
+    Os_Init(&test_config);
+    Os_SetLatencyMeasurement(TRUE);
+
+    mock_cycles = 1000u;
+    (void)Os_ActivateTask(1u);
+    mock_cycles = 1250u;
+    mock_nvic_run();
+
+    mock_cycles = 5000u;
+    (void)Os_ActivateTask(1u);
+    mock_cycles = 5100u;
+    mock_nvic_run();
+
+    TEST_ASSERT_EQUAL(E_OK, Os_GetTaskStats(1u, &stats));
+    TEST_ASSERT_EQUAL_UINT32(100u, stats.latencyLast);
+    TEST_ASSERT_EQUAL_UINT32(250u, stats.latencyMax);
+}
+
+/** @verifies SWR-BSW-043 */
+void test_Os_latency_not_recorded_when_disabled(void)
+{
+    Os_TaskStatsType stats;
+
+    Os_Init(&test_config);
+
+    mock_cycles = 1000u;
+    (void)Os_ActivateTask(1u);
+    mock_cycles = 1250u;
+    mock_nvic_run();
+
+    TEST_ASSERT_EQUAL(E_OK, Os_GetTaskStats(1u, &stats));
+    TEST_ASSERT_EQUAL_UINT32(0u, stats.latencyMax);
+}
+
+/** @verifies SWR-BSW-043 */
+void test_Os_latency_enable_clears_previous_max(void)
+{
+    Os_TaskStatsType stats;
+
+    Os_Init(&test_config);
+    Os_SetLatencyMeasurement(TRUE);
+    mock_cycles = 0u;
+    (void)Os_ActivateTask(1u);
+    mock_cycles = 900u;
+    mock_nvic_run();
+
+    Os_SetLatencyMeasurement(FALSE);
+    Os_SetLatencyMeasurement(TRUE);
+
+    TEST_ASSERT_EQUAL(E_OK, Os_GetTaskStats(1u, &stats));
+    TEST_ASSERT_EQUAL_UINT32(0u, stats.latencyMax);
+}
+
+/** @verifies SWR-BSW-043 */
+void test_Os_GetTaskStats_null_pointer_rejected(void)
+{
+    Os_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Os_GetTaskStats(0u, NULL_PTR));
+}
+
+/* ==================================================================
+ * SWR-BSW-043: Level stack high-water mark
+ * ================================================================== */
+
+/** @verifies SWR-BSW-043 */
+void test_Os_GetStackUsage_counts_from_deepest_written_word(void)
+{
+    Os_Init(&test_config);
+
+    /* Stack grows down from test_stack[1][15]: 6 words used */
+    test_stack[1][10] = 0x12345678u;
+    test_stack[1][15] = 0u;
+
+    TEST_ASSERT_EQUAL_UINT16(24u, Os_GetStackUsage(1u));
+    TEST_ASSERT_EQUAL_UINT16(0u, Os_GetStackUsage(0u));
+    TEST_ASSERT_EQUAL_UINT16(0u, Os_GetStackUsage(3u));
+}
+
+/* ==================================================================
+ * Test runner
+ * ================================================================== */
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_Os_Init_null_config_not_initialized);
+    RUN_TEST(test_Os_Init_task_level_out_of_range_not_initialized);
+    RUN_TEST(test_Os_Init_offset_not_below_period_not_initialized);
+    RUN_TEST(test_Os_Init_fills_level_stacks);
+
+    RUN_TEST(test_Os_Tick_before_start_activates_nothing);
+    RUN_TEST(test_Os_Tick_activates_by_period_and_offset);
+    RUN_TEST(test_Os_Tick_offset_delays_first_activation);
+
+    RUN_TEST(test_Os_levels_run_highest_first);
+    RUN_TEST(test_Os_higher_level_preempts_running_task);
+    RUN_TEST(test_Os_running_task_reported_inside_task);
+    RUN_TEST(test_Os_same_level_runs_in_config_order);
+
+    RUN_TEST(test_Os_ActivateTask_pending_task_counts_overrun);
+    RUN_TEST(test_Os_ActivateTask_invalid_id_rejected);
+
+    RUN_TEST(test_Os_latency_measured_from_activation_to_start);
+    RUN_TEST(test_Os_latency_not_recorded_when_disabled);
+    RUN_TEST(test_Os_latency_enable_clears_previous_max);
+    RUN_TEST(test_Os_GetTaskStats_null_pointer_rejected);
+
+    RUN_TEST(test_Os_GetStackUsage_counts_from_deepest_written_word);
+
+    return UNITY_END();
+}
@@ -5,7 +5,7 @@
  *
  * @verifies SWR-BSW-013
  *
- * Tests PDU routing between CanIf and upper layers (Com, Dcm).
+ * Tests PDU routing between CanIf and upper layers (Com, Dcm, CanTSyn).
  * Both lower and upper layer calls are mocked.
  */
 #include "unity.h"
@@ -20,6 +20,7 @@ static const PduR_RoutingTableType test_routing[] = {
     { 1u, PDUR_DEST_COM, 1u },   /* RxPdu 1 -> Com PDU 1 */
     { 2u, PDUR_DEST_COM, 2u },   /* RxPdu 2 -> Com PDU 2 */
     { 3u, PDUR_DEST_DCM, 0u },   /* RxPdu 3 -> Dcm PDU 0 */
+    { 4u, PDUR_DEST_CANTSYN, 0u }, /* RxPdu 4 -> CanTSyn PDU 0 */
 };
 
 /* ==================================================================
@@ -94,6 +95,20 @@ void CanTp_RxIndication(PduIdType RxPduId, const PduInfoType* PduInfoPtr)
     mock_cantp_rx_count++;
 }
 
+/* ==================================================================
+ * Mock: CanTSyn (time synchronization RX path)
+ * ================================================================== */
+
+static PduIdType  mock_cantsyn_rx_pdu_id;
+static uint8      mock_cantsyn_rx_count;
+
+void CanTSyn_RxIndication(PduIdType RxPduId, const PduInfoType* PduInfoPtr)
+{
+    (void)PduInfoPtr;
+    mock_cantsyn_rx_pdu_id = RxPduId;
+    mock_cantsyn_rx_count++;
+}
+
 /* ==================================================================
  * Test fixtures
  * ================================================================== */
@@ -110,9 +125,11 @@ void setUp(void)
     mock_dcm_rx_pdu_id = 0xFFu;
     mock_cantp_rx_count = 0u;
     mock_cantp_rx_pdu_id = 0xFFu;
+    mock_cantsyn_rx_count = 0u;
+    mock_cantsyn_rx_pdu_id = 0xFFu;
 
     pdur_cfg.routingTable = test_routing;
-    pdur_cfg.routingCount = 4u;
+    pdur_cfg.routingCount = 5u;
 
     PduR_Init(&pdur_cfg);
 }
@@ -149,6 +166,20 @@ void test_PduR_RxIndication_routes_to_dcm(void)
     TEST_ASSERT_EQUAL_UINT8(0u, mock_com_rx_count);
 }
 
+/** @verifies SWR-BSW-013, SWR-BSW-046 */
+void test_PduR_RxIndication_routes_to_cantsyn(void)
+{
+    uint8 data[] = {0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05};
+    PduInfoType pdu = { data, 8u };
+
+    PduR_CanIfRxIndication(4u, &pdu);
+
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_cantsyn_rx_count);
+    TEST_ASSERT_EQUAL(0u, mock_cantsyn_rx_pdu_id);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_com_rx_count);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_dcm_rx_count);
+}
+
 /** @verifies SWR-BSW-013 */
 void test_PduR_RxIndication_unknown_pdu_ignored(void)
 {
@@ -318,6 +349,7 @@ int main(void)
 
     RUN_TEST(test_PduR_RxIndication_routes_to_com);
     RUN_TEST(test_PduR_RxIndication_routes_to_dcm);
+    RUN_TEST(test_PduR_RxIndication_routes_to_cantsyn);
     RUN_TEST(test_PduR_RxIndication_unknown_pdu_ignored);
     RUN_TEST(test_PduR_Transmit_routes_to_canif);
     RUN_TEST(test_PduR_Transmit_null_pdu);
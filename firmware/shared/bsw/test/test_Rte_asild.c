@@ -10,6 +10,8 @@
  */
 #include "unity.h"
 #include "Rte.h"
+#include "SchM.h"
+#include "Bsw_Instance.h"
 
 /* ==================================================================
  * Mock: WdgM (checkpoint reached after runnable cycle)
@@ -25,6 +27,40 @@ Std_ReturnType WdgM_CheckpointReached(uint8 SEId)
     return E_OK;
 }
 
+/* Last WdgM_SetEntityActive state per SE: 0 off, 1 on, 0xFF not called */
+static uint8  mock_wdgm_active[8];
+
+Std_ReturnType WdgM_SetEntityActive(uint8 SEId, boolean Active)
+{
+    if (SEId < sizeof(mock_wdgm_active)) {
+        mock_wdgm_active[SEId] = (Active == TRUE) ? 1u : 0u;
+    }
+    return E_OK;
+}
+
+/* ==================================================================
+ * Mock: profiling cycle counter (advanced by ProfRunnable only)
+ * ================================================================== */
+
+static uint32 mock_cycles;
+static uint32 mock_exec_cycles;
+static uint8  mock_prof_start_count;
+
+void Rte_Hw_ProfileStart(void)
+{
+    mock_prof_start_count++;
+}
+
+uint32 Rte_Hw_GetCycles(void)
+{
+    return mock_cycles;
+}
+
+static void ProfRunnable(void)
+{
+    mock_cycles += mock_exec_cycles;
+}
+
 /* ==================================================================
  * Test runnables (set flags when called)
  * ================================================================== */
@@ -48,6 +84,31 @@ static void TestRunnable_10ms_B(void)
     runnable_10ms_b_call_count++;
 }
 
+/* Execution order trace for schedule-table tests */
+static uint8  trace_log[16];
+static uint8  trace_count;
+
+static void trace(uint8 Id)
+{
+    if (trace_count < sizeof(trace_log)) {
+        trace_log[trace_count] = Id;
+    }
+    trace_count++;
+}
+
+static void TraceRunnable_A(void) { trace(1u); }
+static void TraceRunnable_B(void) { trace(2u); }
+static void TraceRunnable_C(void) { trace(3u); }
+
+/* Writes a new value of RTE_SIG_VEHICLE_SPEED on every call */
+static uint32 writer_value;
+static void TraceRunnable_Writer(void)
+{
+    trace(4u);
+    writer_value++;
+    (void)Rte_Write(RTE_SIG_VEHICLE_SPEED, writer_value);
+}
+
 /* ==================================================================
  * Test Configuration
  * ================================================================== */
@@ -61,9 +122,9 @@ static const Rte_SignalConfigType test_signals[] = {
 
 /* Runnable config: 3 runnables */
 static const Rte_RunnableConfigType test_runnables[] = {
-    { TestRunnable_10ms,   10u, 2u, 0u },  /* 10ms, priority 2, SE 0 */
-    { TestRunnable_10ms_B, 10u, 1u, 0u },  /* 10ms, priority 1, SE 0 */
-    { TestRunnable_100ms, 100u, 1u, 1u },  /* 100ms, priority 1, SE 1 */
+    { TestRunnable_10ms,   10u, 2u, 0u, 0u },  /* 10ms, priority 2, SE 0 */
+    { TestRunnable_10ms_B, 10u, 1u, 0u, 0u },  /* 10ms, priority 1, SE 0 */
+    { TestRunnable_100ms, 100u, 1u, 1u, 0u },  /* 100ms, priority 1, SE 1 */
 };
 
 static Rte_ConfigType test_config;
@@ -72,19 +133,31 @@ void setUp(void)
 {
     mock_wdgm_call_count     = 0u;
     mock_wdgm_se_id          = 0xFFu;
+    for (uint8 i = 0u; i < sizeof(mock_wdgm_active); i++) {
+        mock_wdgm_active[i] = 0xFFu;
+    }
     runnable_10ms_call_count  = 0u;
     runnable_100ms_call_count = 0u;
     runnable_10ms_b_call_count = 0u;
+    trace_count = 0u;
+    mock_cycles = 0u;
+    mock_exec_cycles = 0u;
+    mock_prof_start_count = 0u;
 
     test_config.signalConfig   = test_signals;
     test_config.signalCount    = 3u;
     test_config.runnableConfig = test_runnables;
     test_config.runnableCount  = 3u;
+    test_config.eventConfig    = NULL_PTR;
+    test_config.eventCount     = 0u;
 
     Rte_Init(&test_config);
 }
 
-void tearDown(void) { }
+void tearDown(void)
+{
+    (void)Bsw_SetInstance(0u);
+}
 
 /* ==================================================================
  * SWR-BSW-026: Rte Port-Based Communication
@@ -363,6 +436,8 @@ void test_Rte_Init_signal_count_exceeds_max_not_initialized(void)
     overflow_cfg.signalCount    = RTE_MAX_SIGNALS + 1u;
     overflow_cfg.runnableConfig = test_runnables;
     overflow_cfg.runnableCount  = 3u;
+    overflow_cfg.eventConfig    = NULL_PTR;
+    overflow_cfg.eventCount     = 0u;
 
     Rte_Init(&overflow_cfg);
 
@@ -391,13 +466,15 @@ void test_Rte_MainFunction_period_1_fires_every_tick(void)
 {
     /* Reconfigure with a period-1 runnable */
     static const Rte_RunnableConfigType fast_runnables[] = {
-        { TestRunnable_10ms, 1u, 1u, 0u },  /* period=1, fires every tick */
+        { TestRunnable_10ms, 1u, 1u, 0u, 0u },  /* period=1, fires every tick */
     };
     Rte_ConfigType fast_cfg;
     fast_cfg.signalConfig   = test_signals;
     fast_cfg.signalCount    = 3u;
     fast_cfg.runnableConfig = fast_runnables;
     fast_cfg.runnableCount  = 1u;
+    fast_cfg.eventConfig    = NULL_PTR;
+    fast_cfg.eventCount     = 0u;
 
     Rte_Init(&fast_cfg);
 
@@ -427,13 +504,15 @@ void test_Rte_MainFunction_null_func_ptr_skipped(void)
 {
     /* Configure a runnable with NULL function pointer */
     static const Rte_RunnableConfigType null_runnables[] = {
-        { NULL_PTR, 1u, 1u, 0u },  /* NULL func — should be skipped */
+        { NULL_PTR, 1u, 1u, 0u, 0u },  /* NULL func — should be skipped */
     };
     Rte_ConfigType null_cfg;
     null_cfg.signalConfig   = test_signals;
     null_cfg.signalCount    = 3u;
     null_cfg.runnableConfig = null_runnables;
     null_cfg.runnableCount  = 1u;
+    null_cfg.eventConfig    = NULL_PTR;
+    null_cfg.eventCount     = 0u;
 
     Rte_Init(&null_cfg);
 
@@ -446,10 +525,684 @@ void test_Rte_MainFunction_null_func_ptr_skipped(void)
     TEST_ASSERT_TRUE(1);
 }
 
+/** @verifies SWR-BSW-027 — mixed periods, priority order in the same tick */
+void test_Rte_MainFunction_mixed_periods_priority_order(void)
+{
+    static const Rte_RunnableConfigType mixed_runnables[] = {
+        { TraceRunnable_A,  1u, 1u, 0u, 0u },
+        { TraceRunnable_B, 10u, 3u, 1u, 0u },
+        { TraceRunnable_C,  5u, 2u, 0u, 0u },
+    };
+    Rte_ConfigType mixed_cfg;
+    mixed_cfg.signalConfig   = test_signals;
+    mixed_cfg.signalCount    = 3u;
+    mixed_cfg.runnableConfig = mixed_runnables;
+    mixed_cfg.runnableCount  = 3u;
+    mixed_cfg.eventConfig    = NULL_PTR;
+    mixed_cfg.eventCount     = 0u;
+
+    Rte_Init(&mixed_cfg);
+
+    for (uint32 i = 0u; i < 9u; i++) {
+        Rte_MainFunction();
+    }
+    TEST_ASSERT_EQUAL_UINT8(10u, trace_count);   /* 9x A + C at tick 5 */
+
+    trace_count = 0u;
+    mock_wdgm_call_count = 0u;
+    Rte_MainFunction();                          /* tick 10: B, C, A */
+    TEST_ASSERT_EQUAL_UINT8(3u, trace_count);
+    TEST_ASSERT_EQUAL_UINT8(2u, trace_log[0]);
+    TEST_ASSERT_EQUAL_UINT8(3u, trace_log[1]);
+    TEST_ASSERT_EQUAL_UINT8(1u, trace_log[2]);
+    TEST_ASSERT_EQUAL_UINT8(2u, mock_wdgm_call_count);  /* SE 1 and SE 0 once */
+}
+
+/** @verifies SWR-BSW-027 — schedule repeats after the hyperperiod */
+void test_Rte_MainFunction_hyperperiod_wraps(void)
+{
+    static const Rte_RunnableConfigType wrap_runnables[] = {
+        { TestRunnable_10ms,   4u, 1u, 0u, 0u },
+        { TestRunnable_10ms_B, 6u, 1u, 0u, 0u },
+    };
+    Rte_ConfigType wrap_cfg;
+    wrap_cfg.signalConfig   = test_signals;
+    wrap_cfg.signalCount    = 3u;
+    wrap_cfg.runnableConfig = wrap_runnables;
+    wrap_cfg.runnableCount  = 2u;
+    wrap_cfg.eventConfig    = NULL_PTR;
+    wrap_cfg.eventCount     = 0u;
+
+    Rte_Init(&wrap_cfg);
+
+    for (uint32 i = 0u; i < 36u; i++) {         /* three hyperperiods (12) */
+        Rte_MainFunction();
+    }
+    TEST_ASSERT_EQUAL_UINT8(9u, runnable_10ms_call_count);
+    TEST_ASSERT_EQUAL_UINT8(6u, runnable_10ms_b_call_count);
+}
+
+/** @verifies SWR-BSW-027 — hyperperiod beyond the table runs per tick */
+void test_Rte_MainFunction_hyperperiod_beyond_table_runs_per_tick(void)
+{
+    static const Rte_RunnableConfigType long_runnables[] = {
+        { TestRunnable_10ms,    7u, 1u, 0u, 0u },
+        { TestRunnable_100ms, 1000u, 1u, 0u, 0u },
+    };
+    Rte_ConfigType long_cfg;
+    long_cfg.signalConfig   = test_signals;
+    long_cfg.signalCount    = 3u;
+    long_cfg.runnableConfig = long_runnables;
+    long_cfg.runnableCount  = 2u;
+    long_cfg.eventConfig    = NULL_PTR;
+    long_cfg.eventCount     = 0u;
+
+    Rte_Init(&long_cfg);                         /* hyperperiod 7000 ms */
+
+    uint32 val = 0u;
+    TEST_ASSERT_EQUAL(E_OK, Rte_Read(0u, &val));
+    for (uint32 i = 0u; i < 1000u; i++) {
+        Rte_MainFunction();
+    }
+    TEST_ASSERT_EQUAL_UINT8(142u, runnable_10ms_call_count);
+    TEST_ASSERT_EQUAL_UINT8(1u, runnable_100ms_call_count);
+}
+
+/** @verifies SWR-BSW-027 — too many distinct due sets run per tick */
+void test_Rte_MainFunction_patterns_beyond_table_run_per_tick(void)
+{
+    static const Rte_RunnableConfigType many_runnables[] = {
+        { TestRunnable_10ms,   2u, 5u, 0u, 0u },
+        { TraceRunnable_A,     3u, 4u, 0u, 0u },
+        { TestRunnable_10ms_B, 5u, 3u, 0u, 0u },
+        { TraceRunnable_B,     7u, 2u, 0u, 0u },
+        { TestRunnable_100ms,  9u, 1u, 0u, 0u },
+    };
+    Rte_ConfigType many_cfg;
+    many_cfg.signalConfig   = test_signals;
+    many_cfg.signalCount    = 3u;
+    many_cfg.runnableConfig = many_runnables;
+    many_cfg.runnableCount  = 5u;
+    many_cfg.eventConfig    = NULL_PTR;
+    many_cfg.eventCount     = 0u;
+
+    Rte_Init(&many_cfg);                         /* 630 ms, 24 due sets */
+
+    for (uint32 i = 0u; i < 125u; i++) {
+        Rte_MainFunction();
+    }
+    TEST_ASSERT_EQUAL_UINT8(62u, runnable_10ms_call_count);
+    TEST_ASSERT_EQUAL_UINT8(25u, runnable_10ms_b_call_count);
+    TEST_ASSERT_EQUAL_UINT8(13u, runnable_100ms_call_count);
+    TEST_ASSERT_EQUAL_UINT8(58u, trace_count);  /* 41x A + 17x B */
+
+    trace_count = 0u;
+    Rte_MainFunction();                          /* tick 126: 2, 3, 7, 9 */
+    TEST_ASSERT_EQUAL_UINT8(2u, trace_count);
+    TEST_ASSERT_EQUAL_UINT8(1u, trace_log[0]);   /* A before B (priority) */
+    TEST_ASSERT_EQUAL_UINT8(2u, trace_log[1]);
+    TEST_ASSERT_EQUAL_UINT8(63u, runnable_10ms_call_count);
+    TEST_ASSERT_EQUAL_UINT8(14u, runnable_100ms_call_count);
+}
+
+/** @verifies SWR-BSW-027 — phase offset moves the firing tick */
+void test_Rte_MainFunction_offset_shifts_firing_tick(void)
+{
+    static const Rte_RunnableConfigType offset_runnables[] = {
+        { TraceRunnable_A, 10u, 3u, 0u, 0u },
+        { TraceRunnable_B, 10u, 2u, 0u, 3u },
+        { TraceRunnable_C, 10u, 1u, 0u, 3u },
+    };
+    Rte_ConfigType offset_cfg;
+    offset_cfg.signalConfig   = test_signals;
+    offset_cfg.signalCount    = 3u;
+    offset_cfg.runnableConfig = offset_runnables;
+    offset_cfg.runnableCount  = 3u;
+    offset_cfg.eventConfig    = NULL_PTR;
+    offset_cfg.eventCount     = 0u;
+
+    Rte_Init(&offset_cfg);
+
+    for (uint32 i = 0u; i < 3u; i++) {
+        Rte_MainFunction();
+    }
+    TEST_ASSERT_EQUAL_UINT8(2u, trace_count);   /* tick 3: B, C */
+    TEST_ASSERT_EQUAL_UINT8(2u, trace_log[0]);
+    TEST_ASSERT_EQUAL_UINT8(3u, trace_log[1]);
+
+    for (uint32 i = 3u; i < 13u; i++) {
+        Rte_MainFunction();
+    }
+    TEST_ASSERT_EQUAL_UINT8(5u, trace_count);   /* tick 10: A; tick 13: B, C */
+    TEST_ASSERT_EQUAL_UINT8(1u, trace_log[2]);
+}
+
+/** @verifies SWR-BSW-027 — offset must be below the period */
+void test_Rte_Init_offset_not_below_period_not_initialized(void)
+{
+    static const Rte_RunnableConfigType bad_runnables[] = {
+        { TestRunnable_10ms, 10u, 1u, 0u, 10u },
+    };
+    Rte_ConfigType bad_cfg;
+    bad_cfg.signalConfig   = test_signals;
+    bad_cfg.signalCount    = 3u;
+    bad_cfg.runnableConfig = bad_runnables;
+    bad_cfg.runnableCount  = 1u;
+    bad_cfg.eventConfig    = NULL_PTR;
+    bad_cfg.eventCount     = 0u;
+
+    Rte_Init(&bad_cfg);
+
+    uint32 val = 0u;
+    TEST_ASSERT_EQUAL(E_NOT_OK, Rte_Read(0u, &val));
+}
+
+/* ==================================================================
+ * SWR-BSW-026: Lock-Free Reads and Signal Groups
+ * ================================================================== */
+
+static const Rte_SignalIdType test_group[3] = {
+    RTE_SIG_TORQUE_REQUEST, RTE_SIG_STEERING_ANGLE, RTE_SIG_VEHICLE_SPEED
+};
+
+/* Preempting writer: rewrites the whole group the first N times */
+static uint8 hook_writes_left;
+static uint8 hook_call_count;
+
+static void Hook_WriteGroup(void)
+{
+    static const uint32 newer[3] = { 11u, 22u, 33u };
+
+    hook_call_count++;
+    if (hook_writes_left > 0u) {
+        hook_writes_left--;
+        (void)Rte_WriteGroup(test_group, newer, 3u);
+    }
+}
+
+/** @verifies SWR-BSW-026 */
+void test_Rte_Read_does_not_mask_interrupts(void)
+{
+    SchM_IrqOffStatsType stats;
+    uint32 val = 0u;
+
+    SchM_ResetIrqOffStats();
+    (void)Rte_Read(RTE_SIG_TORQUE_REQUEST, &val);
+    SchM_GetIrqOffStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0u, stats.sections);
+
+    (void)Rte_Write(RTE_SIG_TORQUE_REQUEST, 5u);
+    SchM_GetIrqOffStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1u, stats.sections);
+}
+
+/** @verifies SWR-BSW-026 */
+void test_Rte_WriteGroup_ReadGroup_roundtrip(void)
+{
+    const uint32 data[3] = { 100u, 200u, 300u };
+    uint32 out[3] = { 0u, 0u, 0u };
+    SchM_IrqOffStatsType stats;
+
+    TEST_ASSERT_EQUAL(E_OK, Rte_WriteGroup(test_group, data, 3u));
+
+    SchM_ResetIrqOffStats();
+    TEST_ASSERT_EQUAL(E_OK, Rte_ReadGroup(test_group, out, 3u));
+    SchM_GetIrqOffStats(&stats);
+
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(data, out, 3u);
+    TEST_ASSERT_EQUAL_UINT32(0u, stats.sections);   /* lock-free */
+}
+
+/** @verifies SWR-BSW-026 */
+void test_Rte_ReadGroup_retries_when_written_during_copy(void)
+{
+    const uint32 older[3] = { 1u, 2u, 3u };
+    const uint32 newer[3] = { 11u, 22u, 33u };
+    uint32 out[3] = { 0u, 0u, 0u };
+
+    (void)Rte_WriteGroup(test_group, older, 3u);
+
+    hook_writes_left = 1u;
+    hook_call_count  = 0u;
+    Rte_Test_SetReadGroupHook(Hook_WriteGroup);
+
+    TEST_ASSERT_EQUAL(E_OK, Rte_ReadGroup(test_group, out, 3u));
+    Rte_Test_SetReadGroupHook(NULL_PTR);
+
+    /* First copy (old values) discarded, second one is the new group */
+    TEST_ASSERT_EQUAL_UINT8(2u, hook_call_count);
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(newer, out, 3u);
+}
+
+/** @verifies SWR-BSW-026 */
+void test_Rte_ReadGroup_locked_fallback_after_max_retries(void)
+{
+    const uint32 newer[3] = { 11u, 22u, 33u };
+    uint32 out[3] = { 0u, 0u, 0u };
+    SchM_IrqOffStatsType stats;
+
+    hook_writes_left = 0xFFu;
+    hook_call_count  = 0u;
+    Rte_Test_SetReadGroupHook(Hook_WriteGroup);
+
+    SchM_ResetIrqOffStats();
+    TEST_ASSERT_EQUAL(E_OK, Rte_ReadGroup(test_group, out, 3u));
+    SchM_GetIrqOffStats(&stats);
+    Rte_Test_SetReadGroupHook(NULL_PTR);
+
+    TEST_ASSERT_EQUAL_UINT8(RTE_SEQ_MAX_RETRIES, hook_call_count);
+    /* RTE_SEQ_MAX_RETRIES hook writes plus the locked copy */
+    TEST_ASSERT_EQUAL_UINT32(RTE_SEQ_MAX_RETRIES + 1u, stats.sections);
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(newer, out, 3u);
+}
+
+/** @verifies SWR-BSW-026 */
+void test_Rte_Group_invalid_arguments(void)
+{
+    const Rte_SignalIdType bad_group[2] = { RTE_SIG_TORQUE_REQUEST, 3u };
+    const uint32 data[2] = { 7u, 8u };
+    uint32 out[2] = { 0u, 0u };
+    uint32 val = 0u;
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Rte_ReadGroup(NULL_PTR, out, 2u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Rte_ReadGroup(test_group, NULL_PTR, 2u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Rte_ReadGroup(test_group, out, 0u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Rte_ReadGroup(bad_group, out, 2u));
+
+    /* Invalid member: nothing written */
+    TEST_ASSERT_EQUAL(E_NOT_OK, Rte_WriteGroup(bad_group, data, 2u));
+    (void)Rte_Read(RTE_SIG_TORQUE_REQUEST, &val);
+    TEST_ASSERT_EQUAL_UINT32(0u, val);
+
+    Rte_Init(NULL_PTR);
+    TEST_ASSERT_EQUAL(E_NOT_OK, Rte_WriteGroup(test_group, data, 2u));
+}
+
+/* ==================================================================
+ * SWR-BSW-027: Event-Triggered Runnables
+ * ================================================================== */
+
+static void init_event_config(Rte_ConfigType* Cfg,
+                              const Rte_RunnableConfigType* Runnables, uint8 RunnableCount,
+                              const Rte_EventConfigType* Events, uint8 EventCount)
+{
+    Cfg->signalConfig   = test_signals;
+    Cfg->signalCount    = 3u;
+    Cfg->runnableConfig = Runnables;
+    Cfg->runnableCount  = RunnableCount;
+    Cfg->eventConfig    = Events;
+    Cfg->eventCount     = EventCount;
+    Rte_Init(Cfg);
+}
+
+/** @verifies SWR-BSW-027 — data-received event runs at the next tick */
+void test_Rte_Event_data_received_runs_at_next_dispatch(void)
+{
+    static const Rte_RunnableConfigType ev_runnables[] = {
+        { TraceRunnable_A, 0u, 1u, 0xFFu, 0u },     /* event only */
+    };
+    static const Rte_EventConfigType ev_events[] = {
+        { 0u, RTE_EVENT_DATA_RECEIVED, RTE_SIG_STEERING_ANGLE },
+    };
+    Rte_ConfigType ev_cfg;
+
+    init_event_config(&ev_cfg, ev_runnables, 1u, ev_events, 1u);
+
+    Rte_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(0u, trace_count);
+
+    /* Same value twice: one activation, runs once */
+    (void)Rte_Write(RTE_SIG_STEERING_ANGLE, 0u);
+    (void)Rte_Write(RTE_SIG_STEERING_ANGLE, 0u);
+    TEST_ASSERT_EQUAL_UINT8(0u, trace_count);
+
+    Rte_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(1u, trace_count);
+    Rte_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(1u, trace_count);
+}
+
+/** @verifies SWR-BSW-027 — data-changed event ignores unchanged writes */
+void test_Rte_Event_data_changed_only_on_new_value(void)
+{
+    static const Rte_RunnableConfigType ev_runnables[] = {
+        { TraceRunnable_A, 0u, 1u, 0xFFu, 0u },
+    };
+    static const Rte_EventConfigType ev_events[] = {
+        { 0u, RTE_EVENT_DATA_CHANGED, RTE_SIG_STEERING_ANGLE },
+    };
+    static const Rte_SignalIdType grp[1] = { RTE_SIG_STEERING_ANGLE };
+    const uint32 seven = 7u;
+    Rte_ConfigType ev_cfg;
+
+    init_event_config(&ev_cfg, ev_runnables, 1u, ev_events, 1u);
+
+    (void)Rte_Write(RTE_SIG_STEERING_ANGLE, 0u);     /* initial value */
+    Rte_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(0u, trace_count);
+
+    (void)Rte_WriteGroup(grp, &seven, 1u);
+    Rte_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(1u, trace_count);
+
+    (void)Rte_Write(RTE_SIG_STEERING_ANGLE, 7u);
+    Rte_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(1u, trace_count);
+}
+
+/** @verifies SWR-BSW-027 — events merge into the priority order of the tick */
+void test_Rte_Event_raised_during_dispatch_keeps_priority_order(void)
+{
+    static const Rte_RunnableConfigType ev_runnables[] = {
+        { TraceRunnable_A,      0u, 9u, 0xFFu, 0u },  /* above the writer */
+        { TraceRunnable_Writer, 1u, 5u, 0xFFu, 0u },
+        { TraceRunnable_B,      0u, 3u, 0xFFu, 0u },  /* below the writer */
+        { TraceRunnable_C,      1u, 1u, 0xFFu, 0u },
+    };
+    static const Rte_EventConfigType ev_events[] = {
+        { 0u, RTE_EVENT_DATA_CHANGED, RTE_SIG_VEHICLE_SPEED },
+        { 2u, RTE_EVENT_DATA_CHANGED, RTE_SIG_VEHICLE_SPEED },
+    };
+    Rte_ConfigType ev_cfg;
+
+    writer_value = 0u;
+    init_event_config(&ev_cfg, ev_runnables, 4u, ev_events, 2u);
+
+    /* Tick 1: Writer, B (same tick, after the writer), C */
+    Rte_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(3u, trace_count);
+    TEST_ASSERT_EQUAL_UINT8(4u, trace_log[0]);
+    TEST_ASSERT_EQUAL_UINT8(2u, trace_log[1]);
+    TEST_ASSERT_EQUAL_UINT8(3u, trace_log[2]);
+
+    /* Tick 2: A (pending from tick 1) first, then Writer, B, C */
+    Rte_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(7u, trace_count);
+    TEST_ASSERT_EQUAL_UINT8(1u, trace_log[3]);
+    TEST_ASSERT_EQUAL_UINT8(4u, trace_log[4]);
+    TEST_ASSERT_EQUAL_UINT8(2u, trace_log[5]);
+    TEST_ASSERT_EQUAL_UINT8(3u, trace_log[6]);
+}
+
+/** @verifies SWR-BSW-027 — a runnable due and activated runs once */
+void test_Rte_Event_due_and_pending_runs_once(void)
+{
+    static const Rte_RunnableConfigType ev_runnables[] = {
+        { TestRunnable_10ms, 10u, 1u, 0u, 0u },
+    };
+    static const Rte_EventConfigType ev_events[] = {
+        { 0u, RTE_EVENT_DATA_RECEIVED, RTE_SIG_TORQUE_REQUEST },
+    };
+    Rte_ConfigType ev_cfg;
+
+    init_event_config(&ev_cfg, ev_runnables, 1u, ev_events, 1u);
+
+    for (uint32 i = 0u; i < 9u; i++) {
+        Rte_MainFunction();
+    }
+    (void)Rte_Write(RTE_SIG_TORQUE_REQUEST, 1u);
+    Rte_MainFunction();                         /* tick 10: due + pending */
+
+    TEST_ASSERT_EQUAL_UINT8(1u, runnable_10ms_call_count);
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_wdgm_call_count);
+}
+
+/** @verifies SWR-BSW-027 — mode switch activates the mode runnables */
+void test_Rte_Event_mode_switch(void)
+{
+    static const Rte_RunnableConfigType ev_runnables[] = {
+        { TraceRunnable_A, 0u, 2u, 0xFFu, 0u },
+        { TraceRunnable_B, 0u, 1u, 0xFFu, 0u },
+    };
+    static const Rte_EventConfigType ev_events[] = {
+        { 0u, RTE_EVENT_MODE_SWITCH, 3u },
+        { 1u, RTE_EVENT_MODE_SWITCH, RTE_EVENT_ANY_MODE },
+    };
+    Rte_ConfigType ev_cfg;
+
+    init_event_config(&ev_cfg, ev_runnables, 2u, ev_events, 2u);
+
+    Rte_SwitchMode(1u);
+    Rte_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(1u, trace_count);
+    TEST_ASSERT_EQUAL_UINT8(2u, trace_log[0]);
+
+    Rte_SwitchMode(3u);
+    Rte_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(3u, trace_count);
+    TEST_ASSERT_EQUAL_UINT8(1u, trace_log[1]);
+    TEST_ASSERT_EQUAL_UINT8(2u, trace_log[2]);
+
+    Rte_SwitchMode(RTE_MAX_MODES);              /* rejected */
+    Rte_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(3u, trace_count);
+}
+
+/** @verifies SWR-BSW-027 — invalid event triggers reject the config */
+void test_Rte_Init_invalid_event_not_initialized(void)
+{
+    static const Rte_RunnableConfigType ev_runnables[] = {
+        { TraceRunnable_A, 0u, 1u, 0xFFu, 0u },
+    };
+    static const Rte_EventConfigType bad_runnable[] = {
+        { 1u, RTE_EVENT_DATA_RECEIVED, RTE_SIG_TORQUE_REQUEST },
+    };
+    static const Rte_EventConfigType bad_signal[] = {
+        { 0u, RTE_EVENT_DATA_RECEIVED, 3u },
+    };
+    static const Rte_EventConfigType bad_mode[] = {
+        { 0u, RTE_EVENT_MODE_SWITCH, RTE_MAX_MODES },
+    };
+    Rte_ConfigType ev_cfg;
+    uint32 val = 0u;
+
+    init_event_config(&ev_cfg, ev_runnables, 1u, bad_runnable, 1u);
+    TEST_ASSERT_EQUAL(E_NOT_OK, Rte_Read(0u, &val));
+
+    init_event_config(&ev_cfg, ev_runnables, 1u, bad_signal, 1u);
+    TEST_ASSERT_EQUAL(E_NOT_OK, Rte_Read(0u, &val));
+
+    init_event_config(&ev_cfg, ev_runnables, 1u, bad_mode, 1u);
+    TEST_ASSERT_EQUAL(E_NOT_OK, Rte_Read(0u, &val));
+
+    init_event_config(&ev_cfg, ev_runnables, 1u, NULL_PTR, 1u);
+    TEST_ASSERT_EQUAL(E_NOT_OK, Rte_Read(0u, &val));
+}
+
+/** @verifies SWR-BSW-027 — disabled runnables are skipped, WdgM
+ *  supervision follows the enabled runnables of each entity */
+void test_Rte_SetRunnableMask_skips_disabled(void)
+{
+    uint8 i;
+
+    Rte_SetRunnableMask(0x05u);                 /* runnable 1 off */
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_wdgm_active[0]);   /* runnable 0 */
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_wdgm_active[1]);
+    TEST_ASSERT_EQUAL_UINT8(0xFFu, mock_wdgm_active[2]);
+
+    for (i = 0u; i < 10u; i++) {
+        Rte_MainFunction();
+    }
+    TEST_ASSERT_EQUAL_UINT8(1u, runnable_10ms_call_count);
+    TEST_ASSERT_EQUAL_UINT8(0u, runnable_10ms_b_call_count);
+
+    Rte_SetRunnableMask(0x01u);                 /* runnables 1, 2 off */
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_wdgm_active[0]);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_wdgm_active[1]);
+
+    for (i = 0u; i < 90u; i++) {
+        Rte_MainFunction();
+    }
+    TEST_ASSERT_EQUAL_UINT8(10u, runnable_10ms_call_count);
+    TEST_ASSERT_EQUAL_UINT8(0u, runnable_100ms_call_count);
+
+    Rte_SetRunnableMask(0xFFFFu);               /* all on again */
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_wdgm_active[1]);
+    for (i = 0u; i < 10u; i++) {
+        Rte_MainFunction();
+    }
+    TEST_ASSERT_EQUAL_UINT8(11u, runnable_10ms_call_count);
+    TEST_ASSERT_EQUAL_UINT8(1u, runnable_10ms_b_call_count);
+}
+
+/** @verifies SWR-BSW-027 — a disabled runnable drops its pending
+ *  activation and ignores its event triggers */
+void test_Rte_SetRunnableMask_drops_events(void)
+{
+    static const Rte_RunnableConfigType ev_runnables[] = {
+        { TraceRunnable_A, 0u, 1u, 0xFFu, 0u },
+    };
+    static const Rte_EventConfigType ev_events[] = {
+        { 0u, RTE_EVENT_DATA_RECEIVED, RTE_SIG_STEERING_ANGLE },
+        { 0u, RTE_EVENT_MODE_SWITCH, RTE_EVENT_ANY_MODE },
+    };
+    Rte_ConfigType ev_cfg;
+
+    init_event_config(&ev_cfg, ev_runnables, 1u, ev_events, 2u);
+
+    (void)Rte_Write(RTE_SIG_STEERING_ANGLE, 1u);
+    Rte_SetRunnableMask(0x00u);
+    Rte_MainFunction();
+    (void)Rte_Write(RTE_SIG_STEERING_ANGLE, 2u);
+    Rte_SwitchMode(2u);
+    Rte_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(0u, trace_count);
+
+    Rte_SetRunnableMask(0x01u);
+    Rte_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(0u, trace_count);
+
+    (void)Rte_Write(RTE_SIG_STEERING_ANGLE, 3u);
+    Rte_MainFunction();
+    TEST_ASSERT_EQUAL_UINT8(1u, trace_count);
+}
+
+/* ==================================================================
+ * Execution-time profiling (RTE_PROFILING)
+ * ================================================================== */
+
+static const Rte_RunnableConfigType prof_runnables[] = {
+    { ProfRunnable, 1u, 1u, 0xFFu, 0u },
+};
+
+/* Three ticks of 1.5 us, 3 us and 200 us (cycles = ns in test builds) */
+static void prof_run_three_ticks(void)
+{
+    test_config.runnableConfig = prof_runnables;
+    test_config.runnableCount  = 1u;
+    Rte_Init(&test_config);
+
+    mock_exec_cycles = 1500u;
+    Rte_MainFunction();
+    mock_exec_cycles = 3000u;
+    Rte_MainFunction();
+    mock_exec_cycles = 200000u;
+    Rte_MainFunction();
+}
+
+/** @verifies SWR-BSW-027 -- min, max, sum and log-scale histogram */
+void test_Rte_Profile_records_runnable_times(void)
+{
+    Rte_ProfileType     prof;
+    Rte_TickProfileType tick;
+
+    prof_run_three_ticks();
+
+    TEST_ASSERT_EQUAL(E_OK, Rte_GetRunnableProfile(0u, &prof));
+    TEST_ASSERT_EQUAL_UINT32(3u, prof.count);
+    TEST_ASSERT_EQUAL_UINT32(1500u, prof.minCycles);
+    TEST_ASSERT_EQUAL_UINT32(200000u, prof.maxCycles);
+    TEST_ASSERT_TRUE(prof.totalCycles == 204500u);
+    TEST_ASSERT_EQUAL_UINT32(1u, prof.hist[0]);     /* < 2 us    */
+    TEST_ASSERT_EQUAL_UINT32(1u, prof.hist[1]);     /* < 4 us    */
+    TEST_ASSERT_EQUAL_UINT32(0u, prof.hist[6]);
+    TEST_ASSERT_EQUAL_UINT32(1u, prof.hist[RTE_PROF_HIST_BINS - 1u]); /* >= 128 us */
+
+    /* The mock clock only moves inside the runnable */
+    TEST_ASSERT_EQUAL(E_OK, Rte_GetTickProfile(&tick));
+    TEST_ASSERT_EQUAL_UINT32(3u, tick.ticks);
+    TEST_ASSERT_EQUAL_UINT32(200000u, tick.lastCycles);
+    TEST_ASSERT_EQUAL_UINT32(200000u, tick.maxCycles);
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Rte_GetRunnableProfile(1u, &prof));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Rte_GetRunnableProfile(0u, NULL_PTR));
+    TEST_ASSERT_EQUAL_UINT8(2u, mock_prof_start_count);  /* setUp + here */
+
+    Rte_ResetProfile();
+    TEST_ASSERT_EQUAL(E_OK, Rte_GetRunnableProfile(0u, &prof));
+    TEST_ASSERT_EQUAL_UINT32(0u, prof.count);
+    TEST_ASSERT_EQUAL_UINT32(0u, prof.hist[0]);
+}
+
+/** @verifies SWR-BSW-027 -- UDS DID records (big-endian us, percent) */
+void test_Rte_ReadProfile_did_records(void)
+{
+    uint8 summary[RTE_PROF_SUMMARY_LENGTH(1u) + 2u];
+    uint8 hist[RTE_PROF_HISTOGRAM_LENGTH(1u)];
+
+    prof_run_three_ticks();
+
+    TEST_ASSERT_EQUAL(E_NOT_OK,
+                      Rte_ReadProfileSummary(summary, RTE_PROF_SUMMARY_LENGTH(1u) - 1u));
+    summary[sizeof(summary) - 1u] = 0xAAu;
+    TEST_ASSERT_EQUAL(E_OK, Rte_ReadProfileSummary(summary, (uint8)sizeof(summary)));
+
+    TEST_ASSERT_EQUAL_UINT8(0u,   summary[0]);      /* tick mean 68 us */
+    TEST_ASSERT_EQUAL_UINT8(68u,  summary[1]);
+    TEST_ASSERT_EQUAL_UINT8(0u,   summary[2]);      /* tick max 200 us */
+    TEST_ASSERT_EQUAL_UINT8(200u, summary[3]);
+    TEST_ASSERT_EQUAL_UINT8(1u,   summary[5]);      /* min 1 us        */
+    TEST_ASSERT_EQUAL_UINT8(68u,  summary[7]);      /* mean 68 us      */
+    TEST_ASSERT_EQUAL_UINT8(200u, summary[9]);      /* max 200 us      */
+    TEST_ASSERT_EQUAL_UINT8(0u,   summary[sizeof(summary) - 1u]);
+
+    TEST_ASSERT_EQUAL(E_OK, Rte_ReadProfileHistogram(hist, (uint8)sizeof(hist)));
+    TEST_ASSERT_EQUAL_UINT8(33u, hist[0]);
+    TEST_ASSERT_EQUAL_UINT8(33u, hist[1]);
+    TEST_ASSERT_EQUAL_UINT8(0u,  hist[2]);
+    TEST_ASSERT_EQUAL_UINT8(33u, hist[RTE_PROF_HIST_BINS - 1u]);
+    TEST_ASSERT_EQUAL(E_NOT_OK, Rte_ReadProfileHistogram(hist, 1u));
+}
+
 /* ==================================================================
  * Test runner
  * ================================================================== */
 
+/* ==================================================================
+ * Multi-instance build (Bsw_Instance.h): one Rte state per ECU
+ * ================================================================== */
+
+/** @verifies SWR-BSW-026, SWR-BSW-027 */
+void test_Rte_instances_keep_separate_signals_and_schedule(void)
+{
+    uint32 val = 0u;
+    uint32 i;
+
+    TEST_ASSERT_EQUAL(E_OK, Rte_Write(RTE_SIG_TORQUE_REQUEST, 42u));
+    for (i = 0u; i < 5u; i++) {
+        Rte_MainFunction();                     /* Instance 0: tick 5 */
+    }
+
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(1u));
+    Rte_Init(&test_config);
+    TEST_ASSERT_EQUAL(E_OK, Rte_Read(RTE_SIG_TORQUE_REQUEST, &val));
+    TEST_ASSERT_EQUAL_UINT32(0u, val);          /* Initial value */
+    for (i = 0u; i < 10u; i++) {
+        Rte_MainFunction();                     /* Instance 1: tick 10 */
+    }
+    TEST_ASSERT_EQUAL_UINT8(1u, runnable_10ms_call_count);
+
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(0u));
+    for (i = 0u; i < 4u; i++) {
+        Rte_MainFunction();                     /* Instance 0: tick 9 */
+    }
+    TEST_ASSERT_EQUAL_UINT8(1u, runnable_10ms_call_count);
+    Rte_MainFunction();                         /* Instance 0: tick 10 */
+    TEST_ASSERT_EQUAL_UINT8(2u, runnable_10ms_call_count);
+    TEST_ASSERT_EQUAL(E_OK, Rte_Read(RTE_SIG_TORQUE_REQUEST, &val));
+    TEST_ASSERT_EQUAL_UINT32(42u, val);
+}
+
 int main(void)
 {
     UNITY_BEGIN();
@@ -487,6 +1240,36 @@ int main(void)
     RUN_TEST(test_Rte_MainFunction_period_1_fires_every_tick);
     RUN_TEST(test_Rte_MainFunction_period_10_fires_at_10th_tick);
     RUN_TEST(test_Rte_MainFunction_null_func_ptr_skipped);
+    RUN_TEST(test_Rte_MainFunction_mixed_periods_priority_order);
+    RUN_TEST(test_Rte_MainFunction_hyperperiod_wraps);
+    RUN_TEST(test_Rte_MainFunction_hyperperiod_beyond_table_runs_per_tick);
+    RUN_TEST(test_Rte_MainFunction_patterns_beyond_table_run_per_tick);
+    RUN_TEST(test_Rte_MainFunction_offset_shifts_firing_tick);
+    RUN_TEST(test_Rte_Init_offset_not_below_period_not_initialized);
+
+    /* Lock-free reads and signal groups */
+    RUN_TEST(test_Rte_Read_does_not_mask_interrupts);
+    RUN_TEST(test_Rte_WriteGroup_ReadGroup_roundtrip);
+    RUN_TEST(test_Rte_ReadGroup_retries_when_written_during_copy);
+    RUN_TEST(test_Rte_ReadGroup_locked_fallback_after_max_retries);
+    RUN_TEST(test_Rte_Group_invalid_arguments);
+
+    /* Event-triggered runnables */
+    RUN_TEST(test_Rte_Event_data_received_runs_at_next_dispatch);
+    RUN_TEST(test_Rte_Event_data_changed_only_on_new_value);
+    RUN_TEST(test_Rte_Event_raised_during_dispatch_keeps_priority_order);
+    RUN_TEST(test_Rte_Event_due_and_pending_runs_once);
+    RUN_TEST(test_Rte_Event_mode_switch);
+    RUN_TEST(test_Rte_Init_invalid_event_not_initialized);
+    RUN_TEST(test_Rte_SetRunnableMask_skips_disabled);
+    RUN_TEST(test_Rte_SetRunnableMask_drops_events);
+
+    /* Execution-time profiling */
+    RUN_TEST(test_Rte_Profile_records_runnable_times);
+    RUN_TEST(test_Rte_ReadProfile_did_records);
+
+    /* Multi-instance */
+    RUN_TEST(test_Rte_instances_keep_separate_signals_and_schedule);
 
     return UNITY_END();
 }
@@ -6,10 +6,12 @@
  * @verifies SWR-BSW-041
  *
  * Tests critical section nesting counter behavior and IRQ state tracking.
- * In UNIT_TEST mode, SchM uses a boolean flag instead of __disable_irq().
+ * In UNIT_TEST mode, SchM uses a boolean flag instead of __disable_irq(),
+ * a priority value instead of BASEPRI and a test cycle counter.
  */
 #include "unity.h"
 #include "SchM.h"
+#include "Det.h"
 
 /* Access the test-only IRQ state query */
 extern boolean SchM_Test_IsIrqDisabled(void);
@@ -24,8 +26,28 @@ void setUp(void)
     while (SchM_GetNestingDepth() > 0u) {
         SchM_Exit_Exclusive();
     }
+    SchM_Init(NULL_PTR);
+    SchM_ResetAreaStats();
+    Det_Init();
 }
 
+/* Task areas mask the Os levels (NVIC 15..13), Os also SysTick (4) */
+static const SchM_AreaConfigType test_areas[SCHM_AREA_COUNT] = {
+    { SCHM_LOCK_BASEPRI, 13u },     /* Com  */
+    { SCHM_LOCK_BASEPRI, 13u },     /* Rte  */
+    { SCHM_LOCK_FLAG,     0u },     /* Dem  */
+    { SCHM_LOCK_BASEPRI, 13u },     /* WdgM */
+    { SCHM_LOCK_GLOBAL,   0u },     /* Can  */
+    { SCHM_LOCK_BASEPRI,  4u },     /* Os   */
+    { SCHM_LOCK_GLOBAL,   0u },     /* Tmr  */
+    { SCHM_LOCK_BASEPRI, 13u },     /* StbM */
+    { SCHM_LOCK_GLOBAL,   0u },     /* Spi  */
+    { SCHM_LOCK_GLOBAL,   0u },     /* Adc  */
+    { SCHM_LOCK_GLOBAL,   0u },     /* Det  */
+};
+
+static const SchM_ConfigType test_config = { test_areas, SCHM_AREA_COUNT };
+
 void tearDown(void) { }
 
 /* ==================================================================
@@ -180,6 +202,186 @@ void test_SchM_cross_module_nesting(void)
     TEST_ASSERT_EQUAL(FALSE, SchM_Test_IsIrqDisabled());
 }
 
+/* ==================================================================
+ * SWR-BSW-041: Interrupt-Masked Time Statistics
+ * ================================================================== */
+
+/** @verifies SWR-BSW-041 */
+void test_SchM_IrqOffStats_counts_outermost_sections(void)
+{
+    SchM_IrqOffStatsType stats;
+
+    SchM_ResetIrqOffStats();
+
+    SchM_Enter_Exclusive();
+    SchM_Enter_Exclusive();     /* nested: same section */
+    SchM_Exit_Exclusive();
+    SchM_Exit_Exclusive();
+
+    SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0();
+    SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0();
+
+    SchM_GetIrqOffStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2u, stats.sections);
+    TEST_ASSERT_EQUAL_UINT32(0u, stats.cycles);     /* no cycle counter */
+
+    SchM_ResetIrqOffStats();
+    SchM_GetIrqOffStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0u, stats.sections);
+
+    SchM_GetIrqOffStats(NULL_PTR);                  /* must not crash */
+}
+
+/* ==================================================================
+ * SWR-BSW-041: Per-Area Locks
+ * ================================================================== */
+
+/** @verifies SWR-BSW-041 */
+void test_SchM_basepri_area_masks_up_to_ceiling(void)
+{
+    SchM_Init(&test_config);
+
+    SchM_Enter_Com_COM_EXCLUSIVE_AREA_0();
+    TEST_ASSERT_EQUAL_UINT8(13u, SchM_Test_GetBasePri());
+    TEST_ASSERT_EQUAL(FALSE, SchM_Test_IsIrqDisabled());
+    TEST_ASSERT_EQUAL_UINT8(1u, SchM_GetNestingDepth());
+
+    /* Nested area with a higher ceiling raises BASEPRI ... */
+    SchM_Enter_Os_OS_EXCLUSIVE_AREA_0();
+    TEST_ASSERT_EQUAL_UINT8(4u, SchM_Test_GetBasePri());
+
+    /* ... a lower one leaves it */
+    SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0();
+    TEST_ASSERT_EQUAL_UINT8(4u, SchM_Test_GetBasePri());
+    SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0();
+    TEST_ASSERT_EQUAL_UINT8(4u, SchM_Test_GetBasePri());
+
+    SchM_Exit_Os_OS_EXCLUSIVE_AREA_0();
+    TEST_ASSERT_EQUAL_UINT8(13u, SchM_Test_GetBasePri());
+
+    SchM_Exit_Com_COM_EXCLUSIVE_AREA_0();
+    TEST_ASSERT_EQUAL_UINT8(0u, SchM_Test_GetBasePri());
+    TEST_ASSERT_EQUAL_UINT8(0u, SchM_GetNestingDepth());
+}
+
+/** @verifies SWR-BSW-041 */
+void test_SchM_basepri_area_nested_restores_on_outermost_exit(void)
+{
+    SchM_Init(&test_config);
+
+    SchM_Enter_WdgM_WDGM_EXCLUSIVE_AREA_0();
+    SchM_Enter_WdgM_WDGM_EXCLUSIVE_AREA_0();
+    SchM_Exit_WdgM_WDGM_EXCLUSIVE_AREA_0();
+    TEST_ASSERT_EQUAL_UINT8(13u, SchM_Test_GetBasePri());
+
+    SchM_Exit_WdgM_WDGM_EXCLUSIVE_AREA_0();
+    TEST_ASSERT_EQUAL_UINT8(0u, SchM_Test_GetBasePri());
+
+    /* Exit without enter: ignored */
+    SchM_Exit_WdgM_WDGM_EXCLUSIVE_AREA_0();
+    TEST_ASSERT_EQUAL_UINT8(0u, SchM_Test_GetBasePri());
+    TEST_ASSERT_EQUAL_UINT8(0u, SchM_GetNestingDepth());
+}
+
+/** @verifies SWR-BSW-041 */
+void test_SchM_flag_area_masks_nothing(void)
+{
+    SchM_AreaStatsType stats;
+
+    SchM_Init(&test_config);
+
+    SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0();
+    TEST_ASSERT_EQUAL_UINT8(0u, SchM_Test_GetBasePri());
+    TEST_ASSERT_EQUAL(FALSE, SchM_Test_IsIrqDisabled());
+    TEST_ASSERT_EQUAL_UINT8(0u, SchM_GetNestingDepth());
+    SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
+
+    TEST_ASSERT_EQUAL(E_OK, SchM_GetAreaStats(SCHM_AREA_DEM, &stats));
+    TEST_ASSERT_EQUAL_UINT32(1u, stats.entries);
+}
+
+/** @verifies SWR-BSW-041 */
+void test_SchM_global_area_disables_irq(void)
+{
+    SchM_Init(&test_config);
+
+    SchM_Enter_Can_CAN_EXCLUSIVE_AREA_0();
+    TEST_ASSERT_EQUAL(TRUE, SchM_Test_IsIrqDisabled());
+    TEST_ASSERT_EQUAL_UINT8(0u, SchM_Test_GetBasePri());
+
+    SchM_Exit_Can_CAN_EXCLUSIVE_AREA_0();
+    TEST_ASSERT_EQUAL(FALSE, SchM_Test_IsIrqDisabled());
+}
+
+/** @verifies SWR-BSW-041 */
+void test_SchM_Init_rejects_invalid_config(void)
+{
+    static const SchM_AreaConfigType bad_areas[SCHM_AREA_COUNT] = {
+        { SCHM_LOCK_BASEPRI, 0u },  /* 0 would not mask anything */
+        { SCHM_LOCK_FLAG, 0u }, { SCHM_LOCK_FLAG, 0u },
+        { SCHM_LOCK_FLAG, 0u }, { SCHM_LOCK_FLAG, 0u },
+        { SCHM_LOCK_FLAG, 0u }, { SCHM_LOCK_FLAG, 0u },
+    };
+    const SchM_ConfigType bad_value = { bad_areas, SCHM_AREA_COUNT };
+    const SchM_ConfigType bad_count = { test_areas, SCHM_AREA_COUNT - 1u };
+
+    SchM_Init(&bad_value);
+    SchM_Init(&bad_count);
+    TEST_ASSERT_EQUAL_UINT16(2u, Det_GetErrorCount());
+
+    /* Previous configuration (all global) kept */
+    SchM_Enter_Dem_DEM_EXCLUSIVE_AREA_0();
+    TEST_ASSERT_EQUAL(TRUE, SchM_Test_IsIrqDisabled());
+    SchM_Exit_Dem_DEM_EXCLUSIVE_AREA_0();
+}
+
+/* ==================================================================
+ * SWR-BSW-041: Lock Hold Time
+ * ================================================================== */
+
+/** @verifies SWR-BSW-041 */
+void test_SchM_AreaStats_longest_hold(void)
+{
+    SchM_AreaStatsType stats;
+    SchM_IrqOffStatsType irq_off;
+
+    SchM_Init(&test_config);
+    SchM_ResetIrqOffStats();
+
+    SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0();
+    SchM_Test_AdvanceCycles(100u);
+    SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0();
+
+    SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0();
+    SchM_Test_AdvanceCycles(40u);
+    SchM_Enter_Rte_RTE_EXCLUSIVE_AREA_0();  /* nested: same hold */
+    SchM_Test_AdvanceCycles(80u);
+    SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0();
+    SchM_Exit_Rte_RTE_EXCLUSIVE_AREA_0();
+
+    TEST_ASSERT_EQUAL(E_OK, SchM_GetAreaStats(SCHM_AREA_RTE, &stats));
+    TEST_ASSERT_EQUAL_UINT32(2u, stats.entries);
+    TEST_ASSERT_EQUAL_UINT32(120u, stats.maxCycles);
+
+    /* BASEPRI sections count as interrupt-masked time */
+    SchM_GetIrqOffStats(&irq_off);
+    TEST_ASSERT_EQUAL_UINT32(2u, irq_off.sections);
+    TEST_ASSERT_EQUAL_UINT32(220u, irq_off.cycles);
+    TEST_ASSERT_EQUAL_UINT32(120u, irq_off.maxCycles);
+
+    /* Other areas untouched */
+    TEST_ASSERT_EQUAL(E_OK, SchM_GetAreaStats(SCHM_AREA_COM, &stats));
+    TEST_ASSERT_EQUAL_UINT32(0u, stats.entries);
+
+    SchM_ResetAreaStats();
+    TEST_ASSERT_EQUAL(E_OK, SchM_GetAreaStats(SCHM_AREA_RTE, &stats));
+    TEST_ASSERT_EQUAL_UINT32(0u, stats.entries);
+    TEST_ASSERT_EQUAL_UINT32(0u, stats.maxCycles);
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, SchM_GetAreaStats(SCHM_AREA_COUNT, &stats));
+    TEST_ASSERT_EQUAL(E_NOT_OK, SchM_GetAreaStats(SCHM_AREA_RTE, NULL_PTR));
+}
+
 /* ==================================================================
  * Test runner
  * ================================================================== */
@@ -207,5 +409,18 @@ int main(void)
     /* Cross-module */
     RUN_TEST(test_SchM_cross_module_nesting);
 
+    /* Statistics */
+    RUN_TEST(test_SchM_IrqOffStats_counts_outermost_sections);
+
+    /* Per-area locks */
+    RUN_TEST(test_SchM_basepri_area_masks_up_to_ceiling);
+    RUN_TEST(test_SchM_basepri_area_nested_restores_on_outermost_exit);
+    RUN_TEST(test_SchM_flag_area_masks_nothing);
+    RUN_TEST(test_SchM_global_area_disables_irq);
+    RUN_TEST(test_SchM_Init_rejects_invalid_config);
+
+    /* Hold time */
+    RUN_TEST(test_SchM_AreaStats_longest_hold);
+
     return UNITY_END();
 }
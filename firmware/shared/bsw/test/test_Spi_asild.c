@@ -6,8 +6,9 @@
  * @verifies SWR-BSW-006
  *
  * Tests SPI driver initialization, write/read internal buffers,
- * synchronous transmit, and defensive error handling. Hardware is
- * mocked via Spi_Hw_* stub functions defined in this file.
+ * synchronous transmit, the asynchronous job/sequence queue, and
+ * defensive error handling. Hardware is mocked via Spi_Hw_* and
+ * Dio_WriteChannel stub functions defined in this file.
  */
 #include "unity.h"
 #include "Spi.h"
@@ -63,12 +64,90 @@ uint8 Spi_Hw_GetStatus(void)
     return mock_hw_status;
 }
 
+/* ---- Asynchronous transfer mock ---- */
+
+static uint8        mock_async_channels[16];  /* Started transfers, in order */
+static uint8        mock_async_count;
+static boolean      mock_async_start_fail;
+static boolean      mock_async_immediate;     /* Complete within the call */
+
+Std_ReturnType Spi_Hw_AsyncTransmit(uint8 Channel, const uint16* TxBuf, uint16* RxBuf, uint8 Length)
+{
+    if (mock_async_start_fail) {
+        return E_NOT_OK;
+    }
+    if (mock_async_count < 16u) {
+        mock_async_channels[mock_async_count] = Channel;
+    }
+    mock_async_count++;
+    for (uint8 i = 0u; i < Length; i++) {
+        mock_tx_data[Channel][i] = TxBuf[i];
+        RxBuf[i] = mock_rx_data[Channel][i];
+    }
+    if (mock_async_immediate) {
+        Spi_Isr(E_OK);
+    }
+    return E_OK;
+}
+
+/* ---- Chip select mock ---- */
+
+static uint8        mock_cs_level[16];
+static uint8        mock_cs_low_count;
+
+void Dio_WriteChannel(uint8 ChannelId, uint8 Level)
+{
+    if (ChannelId < 16u) {
+        mock_cs_level[ChannelId] = Level;
+    }
+    if (Level == STD_LOW) {
+        mock_cs_low_count++;
+    }
+}
+
+/* ---- Sequence notifications ---- */
+
+static uint8        mock_notify_a_count;
+static uint8        mock_notify_b_count;
+static Spi_SeqResultType mock_notify_a_result;
+
+static void mock_notify_a(void)
+{
+    mock_notify_a_count++;
+    mock_notify_a_result = Spi_GetSequenceResult(0u);
+}
+
+static void mock_notify_b(void)
+{
+    mock_notify_b_count++;
+}
+
 /* ==================================================================
  * Test Fixtures
  * ================================================================== */
 
 static Spi_ConfigType test_config;
 
+/* Jobs: 0 = channel 0 (CS 5), 1 = channel 1 (CS 6), 2 = channel 1 (CS 7)
+ * Sequences: 0 = jobs {0, 1}, 1 = job {2} */
+static const Spi_JobConfigType test_jobs[] = {
+    { 0u, 5u }, { 1u, 6u }, { 1u, 7u }
+};
+static const uint8 test_seq0_jobs[] = { 0u, 1u };
+static const uint8 test_seq1_jobs[] = { 2u };
+static Spi_SequenceConfigType test_sequences[] = {
+    { test_seq0_jobs, 2u, mock_notify_a },
+    { test_seq1_jobs, 1u, mock_notify_b }
+};
+
+static void use_async_config(void)
+{
+    test_config.jobs = test_jobs;
+    test_config.numJobs = 3u;
+    test_config.sequences = test_sequences;
+    test_config.numSequences = 2u;
+}
+
 void setUp(void)
 {
     Spi_DeInit();
@@ -78,6 +157,18 @@ void setUp(void)
     mock_hw_status = 0u;
     mock_hw_transmit_called = FALSE;
     mock_hw_transmit_fail = FALSE;
+    mock_async_count = 0u;
+    mock_async_start_fail = FALSE;
+    mock_async_immediate = FALSE;
+    mock_cs_low_count = 0u;
+    mock_notify_a_count = 0u;
+    mock_notify_b_count = 0u;
+    mock_notify_a_result = SPI_SEQ_PENDING;
+
+    for (uint8 i = 0u; i < 16u; i++) {
+        mock_cs_level[i] = STD_HIGH;
+        mock_async_channels[i] = 0xFFu;
+    }
 
     for (uint8 ch = 0u; ch < SPI_MAX_CHANNELS; ch++) {
         mock_tx_len[ch] = 0u;
@@ -93,6 +184,11 @@ void setUp(void)
     test_config.cpha = 1u;
     test_config.dataWidth = 16u;
     test_config.numChannels = 2u;
+    test_config.jobs = NULL_PTR;
+    test_config.numJobs = 0u;
+    test_config.sequences = NULL_PTR;
+    test_config.numSequences = 0u;
+    test_sequences[0].jobs = test_seq0_jobs;
 }
 
 void tearDown(void) { }
@@ -398,6 +494,196 @@ void test_Spi_SyncTransmit_hw_failure_status_returns_to_idle(void)
     TEST_ASSERT_EQUAL(SPI_IDLE, Spi_GetStatus());
 }
 
+/* ==================================================================
+ * SWR-BSW-006: Asynchronous Job/Sequence Queue
+ * ================================================================== */
+
+/** @verifies SWR-BSW-006 */
+void test_Spi_AsyncTransmit_runs_jobs_in_order(void)
+{
+    use_async_config();
+    Spi_Init(&test_config);
+    mock_rx_data[0u][0] = 0x1111u;
+    mock_rx_data[1u][0] = 0x2222u;
+
+    TEST_ASSERT_EQUAL(E_OK, Spi_AsyncTransmit(0u));
+
+    /* First job on the bus, chip selected; second job queued */
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_async_count);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_async_channels[0]);
+    TEST_ASSERT_EQUAL_UINT8(STD_LOW, mock_cs_level[5]);
+    TEST_ASSERT_EQUAL(SPI_BUSY, Spi_GetStatus());
+    TEST_ASSERT_EQUAL(SPI_JOB_PENDING, Spi_GetJobResult(0u));
+    TEST_ASSERT_EQUAL(SPI_JOB_QUEUED, Spi_GetJobResult(1u));
+    TEST_ASSERT_EQUAL(SPI_SEQ_PENDING, Spi_GetSequenceResult(0u));
+
+    Spi_Isr(E_OK);
+    TEST_ASSERT_EQUAL_UINT8(STD_HIGH, mock_cs_level[5]);
+    TEST_ASSERT_EQUAL_UINT8(STD_LOW, mock_cs_level[6]);
+    TEST_ASSERT_EQUAL_UINT8(2u, mock_async_count);
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_async_channels[1]);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_notify_a_count);
+
+    Spi_Isr(E_OK);
+    TEST_ASSERT_EQUAL_UINT8(STD_HIGH, mock_cs_level[6]);
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_notify_a_count);
+    TEST_ASSERT_EQUAL(SPI_SEQ_OK, mock_notify_a_result);
+    TEST_ASSERT_EQUAL(SPI_JOB_OK, Spi_GetJobResult(0u));
+    TEST_ASSERT_EQUAL(SPI_JOB_OK, Spi_GetJobResult(1u));
+    TEST_ASSERT_EQUAL(SPI_IDLE, Spi_GetStatus());
+
+    uint16 rx_buf[SPI_IB_SIZE] = {0u};
+    TEST_ASSERT_EQUAL(E_OK, Spi_ReadIB(1u, rx_buf));
+    TEST_ASSERT_EQUAL_HEX16(0x2222u, rx_buf[0]);
+}
+
+/** @verifies SWR-BSW-006 */
+void test_Spi_AsyncTransmit_queues_sequences_fifo(void)
+{
+    use_async_config();
+    Spi_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(E_OK, Spi_AsyncTransmit(1u));
+    TEST_ASSERT_EQUAL(E_OK, Spi_AsyncTransmit(0u));
+    TEST_ASSERT_EQUAL(SPI_JOB_QUEUED, Spi_GetJobResult(0u));
+
+    Spi_Isr(E_OK);      /* Sequence 1 ends, sequence 0 starts */
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_notify_b_count);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_notify_a_count);
+    Spi_Isr(E_OK);
+    Spi_Isr(E_OK);
+
+    TEST_ASSERT_EQUAL_UINT8(3u, mock_async_count);
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_async_channels[0]);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_async_channels[1]);
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_async_channels[2]);
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_notify_a_count);
+    TEST_ASSERT_EQUAL(SPI_IDLE, Spi_GetStatus());
+}
+
+/** @verifies SWR-BSW-006 */
+void test_Spi_AsyncTransmit_pending_sequence_rejected(void)
+{
+    use_async_config();
+    Spi_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(E_OK, Spi_AsyncTransmit(0u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Spi_AsyncTransmit(0u));
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_async_count);
+}
+
+/** @verifies SWR-BSW-006 */
+void test_Spi_AsyncTransmit_failed_job_skips_rest(void)
+{
+    use_async_config();
+    Spi_Init(&test_config);
+
+    (void)Spi_AsyncTransmit(0u);
+    Spi_Isr(E_NOT_OK);
+
+    /* Second job never started, its chip never selected */
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_async_count);
+    TEST_ASSERT_EQUAL_UINT8(STD_HIGH, mock_cs_level[5]);
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_cs_low_count);
+    TEST_ASSERT_EQUAL(SPI_JOB_FAILED, Spi_GetJobResult(0u));
+    TEST_ASSERT_EQUAL(SPI_JOB_FAILED, Spi_GetJobResult(1u));
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_notify_a_count);
+    TEST_ASSERT_EQUAL(SPI_SEQ_FAILED, mock_notify_a_result);
+    TEST_ASSERT_EQUAL(SPI_IDLE, Spi_GetStatus());
+}
+
+/** @verifies SWR-BSW-006 */
+void test_Spi_AsyncTransmit_start_failure_ends_sequence(void)
+{
+    use_async_config();
+    Spi_Init(&test_config);
+    mock_async_start_fail = TRUE;
+
+    TEST_ASSERT_EQUAL(E_OK, Spi_AsyncTransmit(0u));
+
+    TEST_ASSERT_EQUAL_UINT8(STD_HIGH, mock_cs_level[5]);
+    TEST_ASSERT_EQUAL(SPI_SEQ_FAILED, Spi_GetSequenceResult(0u));
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_notify_a_count);
+    TEST_ASSERT_EQUAL(SPI_IDLE, Spi_GetStatus());
+
+    /* Not pending any more: can be restarted */
+    mock_async_start_fail = FALSE;
+    TEST_ASSERT_EQUAL(E_OK, Spi_AsyncTransmit(0u));
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_async_count);
+}
+
+/** @verifies SWR-BSW-006 */
+void test_Spi_AsyncTransmit_immediate_completion(void)
+{
+    /* Backend without DMA: Spi_Isr from within Spi_Hw_AsyncTransmit */
+    use_async_config();
+    Spi_Init(&test_config);
+    mock_async_immediate = TRUE;
+
+    TEST_ASSERT_EQUAL(E_OK, Spi_AsyncTransmit(0u));
+
+    TEST_ASSERT_EQUAL_UINT8(2u, mock_async_count);
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_notify_a_count);
+    TEST_ASSERT_EQUAL(SPI_SEQ_OK, Spi_GetSequenceResult(0u));
+    TEST_ASSERT_EQUAL_UINT8(STD_HIGH, mock_cs_level[6]);
+    TEST_ASSERT_EQUAL(SPI_IDLE, Spi_GetStatus());
+}
+
+/** @verifies SWR-BSW-006 */
+void test_Spi_SyncTransmit_rejected_while_async_busy(void)
+{
+    use_async_config();
+    Spi_Init(&test_config);
+
+    (void)Spi_AsyncTransmit(0u);
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Spi_SyncTransmit(0u));
+    TEST_ASSERT_FALSE(mock_hw_transmit_called);
+}
+
+/** @verifies SWR-BSW-006 */
+void test_Spi_Isr_spurious_ignored(void)
+{
+    use_async_config();
+    Spi_Init(&test_config);
+
+    Spi_Isr(E_OK);
+
+    TEST_ASSERT_EQUAL(SPI_IDLE, Spi_GetStatus());
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_notify_a_count);
+    TEST_ASSERT_EQUAL(SPI_SEQ_OK, Spi_GetSequenceResult(0u));
+}
+
+/** @verifies SWR-BSW-006 */
+void test_Spi_AsyncTransmit_invalid_sequence(void)
+{
+    use_async_config();
+    Spi_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Spi_AsyncTransmit(2u));
+    TEST_ASSERT_EQUAL(SPI_SEQ_FAILED, Spi_GetSequenceResult(2u));
+    TEST_ASSERT_EQUAL(SPI_JOB_FAILED, Spi_GetJobResult(3u));
+}
+
+/** @verifies SWR-BSW-006 */
+void test_Spi_AsyncTransmit_before_init(void)
+{
+    TEST_ASSERT_EQUAL(E_NOT_OK, Spi_AsyncTransmit(0u));
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_async_count);
+}
+
+/** @verifies SWR-BSW-006 */
+void test_Spi_Init_invalid_sequence_table_stays_uninit(void)
+{
+    static const uint8 bad_jobs[] = { 3u };   /* Job 3 not configured */
+
+    use_async_config();
+    test_sequences[0].jobs = bad_jobs;
+    Spi_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(SPI_UNINIT, Spi_GetStatus());
+}
+
 /* ==================================================================
  * Test Runner
  * ================================================================== */
@@ -445,5 +731,18 @@ int main(void)
     RUN_TEST(test_Spi_SyncTransmit_status_returns_to_idle);
     RUN_TEST(test_Spi_SyncTransmit_hw_failure_status_returns_to_idle);
 
+    /* Asynchronous job/sequence queue */
+    RUN_TEST(test_Spi_AsyncTransmit_runs_jobs_in_order);
+    RUN_TEST(test_Spi_AsyncTransmit_queues_sequences_fifo);
+    RUN_TEST(test_Spi_AsyncTransmit_pending_sequence_rejected);
+    RUN_TEST(test_Spi_AsyncTransmit_failed_job_skips_rest);
+    RUN_TEST(test_Spi_AsyncTransmit_start_failure_ends_sequence);
+    RUN_TEST(test_Spi_AsyncTransmit_immediate_completion);
+    RUN_TEST(test_Spi_SyncTransmit_rejected_while_async_busy);
+    RUN_TEST(test_Spi_Isr_spurious_ignored);
+    RUN_TEST(test_Spi_AsyncTransmit_invalid_sequence);
+    RUN_TEST(test_Spi_AsyncTransmit_before_init);
+    RUN_TEST(test_Spi_Init_invalid_sequence_table_stays_uninit);
+
     return UNITY_END();
 }
@@ -0,0 +1,380 @@
+/**
+ * @file    test_StbM_asild.c
+ * @brief   Unit tests for the Synchronized Time-Base Manager
+ * @date    2026-03-23
+ *
+ * @verifies SWR-BSW-045
+ *
+ * Tests the master and slave time base: first sync, offset slew and time
+ * leaps, rate correction and its limit, sync loss timeout, local clock wrap
+ * and rebase. The local clock is a variable of this file, advanced by the
+ * tests in microseconds.
+ */
+#include "unity.h"
+#include "StbM.h"
+#include "Det.h"
+#include "Bsw_Instance.h"
+
+/* ==================================================================
+ * Mock local clock
+ * ================================================================== */
+
+static uint32 mock_local;
+
+static uint32 mock_get_local(void)
+{
+    return mock_local;
+}
+
+/* ==================================================================
+ * Configuration and helpers
+ * ================================================================== */
+
+#define TEST_JUMP_US        1000u
+#define TEST_SLEW_US        10000u
+#define TEST_RATE_WIN_US    1000000u
+#define TEST_MAX_PPM        200u
+#define TEST_TIMEOUT_US     500000u
+
+static StbM_ConfigType test_config;
+
+static StbM_TimeStampType now_global(void)
+{
+    StbM_TimeStampType ts = 0u;
+    StbM_TimeBaseStatusType status;
+
+    TEST_ASSERT_EQUAL(E_OK, StbM_GetCurrentTime(&ts, &status));
+    return ts;
+}
+
+/** Sync the slave to master time Global, valid now */
+static void sync_now(StbM_TimeStampType Global)
+{
+    TEST_ASSERT_EQUAL(E_OK, StbM_BusSetGlobalTime(Global, mock_local));
+}
+
+void setUp(void)
+{
+    Det_Init();
+
+    mock_local = 1000u;
+
+    test_config.role                = STBM_ROLE_SLAVE;
+    test_config.getLocalTimeUs      = mock_get_local;
+    test_config.syncLossTimeoutUs   = TEST_TIMEOUT_US;
+    test_config.jumpThresholdUs     = TEST_JUMP_US;
+    test_config.offsetCorrectionUs  = TEST_SLEW_US;
+    test_config.rateMeasureUs       = TEST_RATE_WIN_US;
+    test_config.maxRateDeviationPpm = TEST_MAX_PPM;
+
+    StbM_Init(&test_config);
+}
+
+void tearDown(void) { }
+
+/* ==================================================================
+ * SWR-BSW-045: Initialization
+ * ================================================================== */
+
+/** @verifies SWR-BSW-045 */
+void test_StbM_Init_rejects_invalid_config(void)
+{
+    StbM_ConfigType bad = test_config;
+
+    StbM_Init(NULL_PTR);
+
+    bad.getLocalTimeUs = NULL_PTR;
+    StbM_Init(&bad);
+
+    bad = test_config;
+    bad.offsetCorrectionUs = (2u * TEST_JUMP_US) - 1u;   /* could run backwards */
+    StbM_Init(&bad);
+
+    bad = test_config;
+    bad.maxRateDeviationPpm = STBM_MAX_RATE_DEVIATION_PPM + 1u;
+    StbM_Init(&bad);
+
+    TEST_ASSERT_EQUAL_UINT16(4u, Det_GetErrorCount());
+}
+
+/** @verifies SWR-BSW-045 */
+void test_StbM_uninitialized_instance_has_no_time(void)
+{
+    StbM_TimeStampType ts;
+    StbM_TimeBaseStatusType status;
+
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(1u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, StbM_GetCurrentTime(&ts, &status));
+    TEST_ASSERT_EQUAL(E_NOT_OK, StbM_BusSetGlobalTime(1000u, mock_local));
+    TEST_ASSERT_EQUAL_UINT32(0u, StbM_GetTimeUs());
+    TEST_ASSERT_EQUAL_HEX8(0u, StbM_GetTimeBaseStatus());
+    TEST_ASSERT_EQUAL(E_OK, Bsw_SetInstance(0u));
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, StbM_GetCurrentTime(NULL_PTR, &status));
+    TEST_ASSERT_EQUAL_UINT16(1u, Det_GetErrorCount());
+}
+
+/** @verifies SWR-BSW-045 */
+void test_StbM_master_is_synchronized_to_its_local_clock(void)
+{
+    test_config.role = STBM_ROLE_MASTER;
+    mock_local = 7000u;
+    StbM_Init(&test_config);
+
+    mock_local += 2500u;
+    TEST_ASSERT_EQUAL_UINT32(2500u, (uint32)now_global());
+    TEST_ASSERT_EQUAL_UINT32(2500u, StbM_GetTimeUs());
+    TEST_ASSERT_EQUAL_UINT32(2u, StbM_GetTimeMs());
+    TEST_ASSERT_EQUAL_HEX8(STBM_STATUS_GLOBAL_TIME_BASE, StbM_GetTimeBaseStatus());
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, StbM_BusSetGlobalTime(1000u, mock_local));
+    TEST_ASSERT_EQUAL_UINT16(1u, Det_GetErrorCount());
+}
+
+/* ==================================================================
+ * SWR-BSW-045: Offset correction
+ * ================================================================== */
+
+/** @verifies SWR-BSW-045 */
+void test_StbM_slave_runs_on_local_time_until_first_sync(void)
+{
+    StbM_SyncStatsType stats;
+
+    mock_local += 3000u;
+    TEST_ASSERT_EQUAL_UINT32(3000u, (uint32)now_global());
+    TEST_ASSERT_EQUAL_HEX8(0u, StbM_GetTimeBaseStatus());
+
+    /* Master time valid 300 us ago (ingress time of the SYNC) */
+    TEST_ASSERT_EQUAL(E_OK, StbM_BusSetGlobalTime(5000000u, mock_local - 300u));
+    TEST_ASSERT_EQUAL_UINT32(5000300u, (uint32)now_global());
+    TEST_ASSERT_EQUAL_HEX8(STBM_STATUS_GLOBAL_TIME_BASE, StbM_GetTimeBaseStatus());
+
+    StbM_GetSyncStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1u, stats.syncs);
+    TEST_ASSERT_EQUAL_UINT32(1u, stats.jumps);
+    TEST_ASSERT_EQUAL_UINT32(0u, stats.maxAbsOffsetUs);     /* First sync not counted */
+}
+
+/** @verifies SWR-BSW-045 */
+void test_StbM_small_offset_is_slewed(void)
+{
+    StbM_SyncStatsType stats;
+
+    sync_now(5000000u);
+    mock_local += 100000u;
+    TEST_ASSERT_EQUAL_UINT32(5100000u, (uint32)now_global());
+
+    sync_now(5100100u);                                     /* Master 100 us ahead */
+    TEST_ASSERT_EQUAL_UINT32(5100000u, (uint32)now_global()); /* Continuous      */
+
+    mock_local += TEST_SLEW_US / 2u;
+    TEST_ASSERT_EQUAL_UINT32(5105050u, (uint32)now_global());
+    mock_local += TEST_SLEW_US / 2u;
+    TEST_ASSERT_EQUAL_UINT32(5110100u, (uint32)now_global());
+    mock_local += TEST_SLEW_US;
+    TEST_ASSERT_EQUAL_UINT32(5120100u, (uint32)now_global());
+
+    StbM_GetSyncStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2u, stats.syncs);
+    TEST_ASSERT_EQUAL_UINT32(1u, stats.jumps);
+    TEST_ASSERT_EQUAL_INT32(100, stats.lastOffsetUs);
+    TEST_ASSERT_EQUAL_UINT32(100u, stats.maxAbsOffsetUs);
+    TEST_ASSERT_EQUAL_HEX8(STBM_STATUS_GLOBAL_TIME_BASE, StbM_GetTimeBaseStatus());
+}
+
+/** @verifies SWR-BSW-045 */
+void test_StbM_negative_slew_never_runs_backwards(void)
+{
+    StbM_TimeStampType last;
+    StbM_TimeStampType t;
+
+    sync_now(5000000u);
+    mock_local += 100000u;
+    sync_now(5100000u - (TEST_JUMP_US - 1u));               /* Just below a leap */
+
+    last = now_global();
+    for (uint32 i = 0u; i < (TEST_SLEW_US / 100u); i++) {
+        mock_local += 100u;
+        t = now_global();
+        TEST_ASSERT_TRUE(t > last);
+        last = t;
+    }
+    TEST_ASSERT_EQUAL_UINT32(5100000u - (TEST_JUMP_US - 1u) + TEST_SLEW_US, (uint32)last);
+}
+
+/** @verifies SWR-BSW-045 */
+void test_StbM_large_offset_is_a_time_leap(void)
+{
+    StbM_SyncStatsType stats;
+
+    sync_now(5000000u);
+    mock_local += 1000u;
+
+    sync_now(5001000u + TEST_JUMP_US);
+    TEST_ASSERT_EQUAL_UINT32(5001000u + TEST_JUMP_US, (uint32)now_global());
+    TEST_ASSERT_EQUAL_HEX8(STBM_STATUS_GLOBAL_TIME_BASE | STBM_STATUS_TIMELEAP_FUTURE,
+                           StbM_GetTimeBaseStatus());
+
+    sync_now(5000000u);
+    TEST_ASSERT_EQUAL_UINT32(5000000u, (uint32)now_global());
+    TEST_ASSERT_EQUAL_HEX8(STBM_STATUS_GLOBAL_TIME_BASE | STBM_STATUS_TIMELEAP_PAST,
+                           StbM_GetTimeBaseStatus());
+
+    sync_now(5000010u);                                     /* Small: bits cleared */
+    TEST_ASSERT_EQUAL_HEX8(STBM_STATUS_GLOBAL_TIME_BASE, StbM_GetTimeBaseStatus());
+
+    StbM_GetSyncStats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(4u, stats.syncs);
+    TEST_ASSERT_EQUAL_UINT32(3u, stats.jumps);
+    TEST_ASSERT_EQUAL_UINT32(2u * TEST_JUMP_US, stats.maxAbsOffsetUs);
+}
+
+/* ==================================================================
+ * SWR-BSW-045: Rate correction
+ * ================================================================== */
+
+/**
+ * @brief  Sync every 100 ms of local time for one rate window, the master's
+ *         clock running DriftPpm slower than the local one
+ */
+static void sync_window(uint32 DriftPpm)
+{
+    StbM_TimeStampType master = 10000000u;
+
+    sync_now(master);
+    for (uint8 k = 0u; k < 10u; k++) {
+        mock_local += 100000u;
+        master     += 100000u - (DriftPpm / 10u);
+        sync_now(master);
+    }
+}
+
+/** @verifies SWR-BSW-045 */
+void test_StbM_rate_is_corrected(void)
+{
+    StbM_SyncStatsType stats;
+    StbM_TimeStampType t0;
+
+    sync_window(100u);
+
+    StbM_GetSyncStats(&stats);
+    TEST_ASSERT_EQUAL_INT32(-100000, stats.rateCorrectionPpb);
+    TEST_ASSERT_EQUAL_UINT32(10u, stats.maxAbsOffsetUs);
+
+    /* One second later: 100 us less, and the last offset (-10 us) slewed */
+    t0 = now_global();
+    mock_local += 1000000u;
+    TEST_ASSERT_EQUAL_UINT32(999890u, (uint32)(now_global() - t0));
+
+    /* The next sync finds no offset */
+    sync_now(now_global());
+    StbM_GetSyncStats(&stats);
+    TEST_ASSERT_EQUAL_INT32(0, stats.lastOffsetUs);
+}
+
+/** @verifies SWR-BSW-045 */
+void test_StbM_rate_correction_is_limited(void)
+{
+    StbM_SyncStatsType stats;
+
+    sync_window(500u);
+
+    StbM_GetSyncStats(&stats);
+    TEST_ASSERT_EQUAL_INT32(-(sint32)TEST_MAX_PPM * 1000, stats.rateCorrectionPpb);
+}
+
+/** @verifies SWR-BSW-045 */
+void test_StbM_no_rate_correction_when_disabled(void)
+{
+    StbM_SyncStatsType stats;
+
+    test_config.rateMeasureUs = 0u;
+    StbM_Init(&test_config);
+
+    sync_window(100u);
+
+    StbM_GetSyncStats(&stats);
+    TEST_ASSERT_EQUAL_INT32(0, stats.rateCorrectionPpb);
+}
+
+/* ==================================================================
+ * SWR-BSW-045: Sync loss and clock wrap
+ * ================================================================== */
+
+/** @verifies SWR-BSW-045 */
+void test_StbM_sync_loss_sets_timeout(void)
+{
+    sync_now(5000000u);
+
+    mock_local += TEST_TIMEOUT_US;
+    StbM_MainFunction();
+    TEST_ASSERT_EQUAL_HEX8(STBM_STATUS_GLOBAL_TIME_BASE, StbM_GetTimeBaseStatus());
+
+    mock_local += 1u;
+    StbM_MainFunction();
+    TEST_ASSERT_EQUAL_HEX8(STBM_STATUS_GLOBAL_TIME_BASE | STBM_STATUS_TIMEOUT,
+                           StbM_GetTimeBaseStatus());
+    TEST_ASSERT_EQUAL_UINT32(5000000u + TEST_TIMEOUT_US + 1u, (uint32)now_global());
+
+    sync_now(now_global());
+    TEST_ASSERT_EQUAL_HEX8(STBM_STATUS_GLOBAL_TIME_BASE, StbM_GetTimeBaseStatus());
+}
+
+/** @verifies SWR-BSW-045 */
+void test_StbM_no_timeout_before_first_sync(void)
+{
+    mock_local += 2u * TEST_TIMEOUT_US;
+    StbM_MainFunction();
+    TEST_ASSERT_EQUAL_HEX8(0u, StbM_GetTimeBaseStatus());
+}
+
+/** @verifies SWR-BSW-045 */
+void test_StbM_local_clock_wrap_and_rebase(void)
+{
+    StbM_TimeStampType expected = 1000000u + 0x2000u;
+
+    mock_local = 0xFFFFF000u;
+    StbM_Init(&test_config);
+    sync_now(1000000u);
+
+    mock_local += 0x2000u;                                  /* Wraps */
+    TEST_ASSERT_TRUE(now_global() == expected);
+
+    /* 5 * 2^30 us of local time, more than the clock's range */
+    for (uint8 i = 0u; i < 20u; i++) {
+        mock_local += 0x10000000u;
+        expected   += 0x10000000u;
+        StbM_MainFunction();
+        TEST_ASSERT_TRUE(now_global() == expected);
+    }
+    TEST_ASSERT_EQUAL_HEX8(STBM_STATUS_GLOBAL_TIME_BASE | STBM_STATUS_TIMEOUT,
+                           StbM_GetTimeBaseStatus());
+}
+
+/* ==================================================================
+ * Test Runner
+ * ================================================================== */
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_StbM_Init_rejects_invalid_config);
+    RUN_TEST(test_StbM_uninitialized_instance_has_no_time);
+    RUN_TEST(test_StbM_master_is_synchronized_to_its_local_clock);
+
+    RUN_TEST(test_StbM_slave_runs_on_local_time_until_first_sync);
+    RUN_TEST(test_StbM_small_offset_is_slewed);
+    RUN_TEST(test_StbM_negative_slew_never_runs_backwards);
+    RUN_TEST(test_StbM_large_offset_is_a_time_leap);
+
+    RUN_TEST(test_StbM_rate_is_corrected);
+    RUN_TEST(test_StbM_rate_correction_is_limited);
+    RUN_TEST(test_StbM_no_rate_correction_when_disabled);
+
+    RUN_TEST(test_StbM_sync_loss_sets_timeout);
+    RUN_TEST(test_StbM_no_timeout_before_first_sync);
+    RUN_TEST(test_StbM_local_clock_wrap_and_rebase);
+
+    return UNITY_END();
+}
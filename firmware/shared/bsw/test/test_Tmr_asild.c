@@ -0,0 +1,413 @@
+/**
+ * @file    test_Tmr_asild.c
+ * @brief   Unit tests for the timer service (hierarchical timer wheel)
+ * @date    2026-03-22
+ *
+ * @verifies SWR-BSW-044
+ *
+ * Tests expiry timing in ticks, periodic timers, cancel and restart from
+ * callbacks, cascading over all wheel levels, task dispatch and the Gpt
+ * channel start/stop. The Gpt driver is mocked in this file; a tick is
+ * one call of Tmr_Tick (the channel notification).
+ */
+#include "unity.h"
+#include "Tmr.h"
+#include "Gpt.h"
+#include "Det.h"
+
+/* ==================================================================
+ * Mock Gpt
+ * ================================================================== */
+
+static boolean mock_gpt_running;
+static uint32  mock_gpt_value;
+static uint8   mock_gpt_starts;
+static uint8   mock_gpt_notify_channel;
+static Std_ReturnType mock_gpt_notify_ret;
+
+Std_ReturnType Gpt_StartTimer(uint8 Channel, uint32 Value)
+{
+    (void)Channel;
+    mock_gpt_running = TRUE;
+    mock_gpt_value   = Value;
+    mock_gpt_starts++;
+    return E_OK;
+}
+
+Std_ReturnType Gpt_StopTimer(uint8 Channel)
+{
+    (void)Channel;
+    mock_gpt_running = FALSE;
+    return E_OK;
+}
+
+Std_ReturnType Gpt_EnableNotification(uint8 Channel)
+{
+    mock_gpt_notify_channel = Channel;
+    return mock_gpt_notify_ret;
+}
+
+/* ==================================================================
+ * Callbacks and configuration
+ * ================================================================== */
+
+#define TEST_TICK_US    100u
+#define TEST_TIMERS     TMR_MAX_TIMERS
+
+static uint32 tick_count;                   /* Ticks given so far       */
+static uint32 fire_count[TEST_TIMERS];
+static uint32 fire_tick[TEST_TIMERS];       /* Tick of the last expiry  */
+
+static Tmr_TimerIdType cb_cancel_target;
+static boolean         cb_restart_self;
+
+static void test_cb(Tmr_TimerIdType TimerId)
+{
+    fire_count[TimerId]++;
+    fire_tick[TimerId] = tick_count;
+}
+
+static void test_cb_cancel(Tmr_TimerIdType TimerId)
+{
+    test_cb(TimerId);
+    (void)Tmr_Cancel(cb_cancel_target);
+}
+
+static void test_cb_restart(Tmr_TimerIdType TimerId)
+{
+    test_cb(TimerId);
+    if (cb_restart_self == TRUE) {
+        (void)Tmr_Start(TimerId, 3u * TEST_TICK_US, 0u);
+    }
+}
+
+static Tmr_TimerConfigType test_timers[TEST_TIMERS];
+static Tmr_ConfigType      test_config;
+
+static void tick(uint32 Count)
+{
+    for (uint32 i = 0u; i < Count; i++) {
+        tick_count++;
+        Tmr_Tick();
+    }
+}
+
+void setUp(void)
+{
+    Det_Init();
+
+    mock_gpt_running = FALSE;
+    mock_gpt_value   = 0u;
+    mock_gpt_starts  = 0u;
+    mock_gpt_notify_channel = 0xFFu;
+    mock_gpt_notify_ret = E_OK;
+
+    tick_count = 0u;
+    for (uint8 i = 0u; i < TEST_TIMERS; i++) {
+        test_timers[i].callback = test_cb;
+        fire_count[i] = 0u;
+        fire_tick[i]  = 0u;
+    }
+    test_timers[1].callback = test_cb_cancel;
+    test_timers[3].callback = test_cb_restart;
+    cb_cancel_target = 2u;
+    cb_restart_self  = FALSE;
+
+    test_config.gptChannel = 2u;
+    test_config.tickUs     = TEST_TICK_US;
+    test_config.dispatch   = TMR_DISPATCH_ISR;
+    test_config.timerCount = TEST_TIMERS;
+    test_config.timers     = test_timers;
+
+    Tmr_Init(&test_config);
+}
+
+void tearDown(void) { }
+
+/* ==================================================================
+ * SWR-BSW-044: Initialization
+ * ================================================================== */
+
+/** @verifies SWR-BSW-044 */
+void test_Tmr_Init_enables_gpt_notification(void)
+{
+    TEST_ASSERT_EQUAL_UINT8(2u, mock_gpt_notify_channel);
+    TEST_ASSERT_FALSE(mock_gpt_running);
+    TEST_ASSERT_EQUAL_UINT16(0u, Det_GetErrorCount());
+}
+
+/** @verifies SWR-BSW-044 */
+void test_Tmr_Init_rejects_invalid_config(void)
+{
+    Tmr_Init(NULL_PTR);
+
+    test_config.tickUs = 0u;
+    Tmr_Init(&test_config);
+    test_config.tickUs = TEST_TICK_US;
+
+    test_config.timerCount = TMR_MAX_TIMERS + 1u;
+    Tmr_Init(&test_config);
+    test_config.timerCount = TEST_TIMERS;
+
+    test_timers[5].callback = NULL_PTR;
+    Tmr_Init(&test_config);
+
+    TEST_ASSERT_EQUAL_UINT16(4u, Det_GetErrorCount());
+}
+
+/** @verifies SWR-BSW-044 */
+void test_Tmr_Init_fails_without_gpt_notification(void)
+{
+    mock_gpt_notify_ret = E_NOT_OK;
+    Tmr_Init(&test_config);
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, Tmr_Start(0u, 1000u, 0u));
+    TEST_ASSERT_EQUAL_UINT16(2u, Det_GetErrorCount());
+}
+
+/* ==================================================================
+ * SWR-BSW-044: Start and expiry
+ * ================================================================== */
+
+/** @verifies SWR-BSW-044 */
+void test_Tmr_Start_rejects_invalid_params(void)
+{
+    TEST_ASSERT_EQUAL(E_NOT_OK, Tmr_Start(TEST_TIMERS, 1000u, 0u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Tmr_Start(0u, 0u, 0u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Tmr_Start(0u, (TMR_MAX_TICKS + 1u) * TEST_TICK_US, 0u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Tmr_Start(0u, 1000u, (TMR_MAX_TICKS + 1u) * TEST_TICK_US));
+    TEST_ASSERT_EQUAL(E_NOT_OK, Tmr_Cancel(TEST_TIMERS));
+    TEST_ASSERT_FALSE(Tmr_IsRunning(0u));
+    TEST_ASSERT_FALSE(mock_gpt_running);
+    TEST_ASSERT_EQUAL_UINT16(5u, Det_GetErrorCount());
+}
+
+/** @verifies SWR-BSW-044 */
+void test_Tmr_first_timer_starts_gpt_and_expires_in_phase(void)
+{
+    TEST_ASSERT_EQUAL(E_OK, Tmr_Start(0u, 1000u, 0u));
+    TEST_ASSERT_TRUE(mock_gpt_running);
+    TEST_ASSERT_EQUAL_UINT32(TEST_TICK_US, mock_gpt_value);
+    TEST_ASSERT_TRUE(Tmr_IsRunning(0u));
+
+    tick(9u);
+    TEST_ASSERT_EQUAL_UINT32(0u, fire_count[0]);
+    tick(1u);
+    TEST_ASSERT_EQUAL_UINT32(1u, fire_count[0]);
+    TEST_ASSERT_FALSE(Tmr_IsRunning(0u));
+}
+
+/** @verifies SWR-BSW-044 */
+void test_Tmr_delay_rounds_up_and_counts_partial_tick(void)
+{
+    (void)Tmr_Start(0u, 1000u, 0u);     /* Gpt started: 10 ticks     */
+    (void)Tmr_Start(4u, 250u, 0u);      /* Running: 3 ticks + 1      */
+
+    tick(3u);
+    TEST_ASSERT_EQUAL_UINT32(0u, fire_count[4]);
+    tick(1u);
+    TEST_ASSERT_EQUAL_UINT32(1u, fire_count[4]);
+    TEST_ASSERT_EQUAL_UINT32(4u, fire_tick[4]);
+}
+
+/** @verifies SWR-BSW-044 */
+void test_Tmr_periodic_timer_has_no_drift(void)
+{
+    (void)Tmr_Start(0u, 500u, 2000u);   /* Ticks 5, 25, 45, ... */
+
+    tick(5u);
+    TEST_ASSERT_EQUAL_UINT32(1u, fire_count[0]);
+    tick(19u);
+    TEST_ASSERT_EQUAL_UINT32(1u, fire_count[0]);
+    tick(1u);
+    TEST_ASSERT_EQUAL_UINT32(2u, fire_count[0]);
+    tick(2000u);
+    TEST_ASSERT_EQUAL_UINT32(102u, fire_count[0]);
+    TEST_ASSERT_EQUAL_UINT32(2025u, fire_tick[0]);
+    TEST_ASSERT_EQUAL_UINT32(2000u, Tmr_GetRemainingUs(0u));
+}
+
+/** @verifies SWR-BSW-044 */
+void test_Tmr_expiry_exact_across_all_levels(void)
+{
+    uint32 seed = 12345u;
+    uint32 expect[TEST_TIMERS];
+    uint32 last = 0u;
+
+    /* Start times and delays spread over 1 .. 2^21 ticks: every timer
+     * cascades through the levels it was filed on */
+    for (uint8 i = 0u; i < TEST_TIMERS; i++) {
+        uint32 delay;
+        uint32 partial;
+
+        test_timers[i].callback = test_cb;
+        seed  = (seed * 1103515245u) + 12345u;
+        delay = 1u + ((seed >> 8) % (1uL << ((2u * i / 3u) + 1u)));
+        tick(seed % 97u);
+        partial = (mock_gpt_running == TRUE) ? 1u : 0u;
+        (void)Tmr_Start(i, delay * TEST_TICK_US, 0u);
+        expect[i] = tick_count + delay + partial;
+        if (expect[i] > last) {
+            last = expect[i];
+        }
+    }
+
+    while (tick_count < last) {
+        tick(1u);
+    }
+
+    for (uint8 i = 0u; i < TEST_TIMERS; i++) {
+        TEST_ASSERT_EQUAL_UINT32(1u, fire_count[i]);
+        TEST_ASSERT_EQUAL_UINT32(expect[i], fire_tick[i]);
+    }
+}
+
+/** @verifies SWR-BSW-044 */
+void test_Tmr_longest_delay(void)
+{
+    (void)Tmr_Start(0u, TMR_MAX_TICKS * TEST_TICK_US, 0u);
+
+    tick(TMR_MAX_TICKS - 1u);
+    TEST_ASSERT_EQUAL_UINT32(0u, fire_count[0]);
+    TEST_ASSERT_EQUAL_UINT32(TEST_TICK_US, Tmr_GetRemainingUs(0u));
+    tick(1u);
+    TEST_ASSERT_EQUAL_UINT32(1u, fire_count[0]);
+}
+
+/* ==================================================================
+ * SWR-BSW-044: Cancel and restart
+ * ================================================================== */
+
+/** @verifies SWR-BSW-044 */
+void test_Tmr_cancel_prevents_expiry_and_stops_gpt(void)
+{
+    (void)Tmr_Start(0u, 1000u, 0u);
+    TEST_ASSERT_EQUAL(E_OK, Tmr_Cancel(0u));
+    TEST_ASSERT_EQUAL(E_OK, Tmr_Cancel(0u));    /* Not running: no effect */
+    TEST_ASSERT_FALSE(Tmr_IsRunning(0u));
+    TEST_ASSERT_EQUAL_UINT32(0u, Tmr_GetRemainingUs(0u));
+
+    tick(1u);                                   /* Finds no timer */
+    TEST_ASSERT_FALSE(mock_gpt_running);
+    tick(20u);
+    TEST_ASSERT_EQUAL_UINT32(0u, fire_count[0]);
+
+    (void)Tmr_Start(0u, 200u, 0u);
+    TEST_ASSERT_EQUAL_UINT8(2u, mock_gpt_starts);
+}
+
+/** @verifies SWR-BSW-044 */
+void test_Tmr_restart_replaces_expiry(void)
+{
+    (void)Tmr_Start(0u, 1000u, 0u);
+    tick(5u);
+    (void)Tmr_Start(0u, 1000u, 0u);             /* 10 + 1 from now */
+
+    tick(10u);
+    TEST_ASSERT_EQUAL_UINT32(0u, fire_count[0]);
+    tick(1u);
+    TEST_ASSERT_EQUAL_UINT32(1u, fire_count[0]);
+    TEST_ASSERT_EQUAL_UINT32(16u, fire_tick[0]);
+}
+
+/** @verifies SWR-BSW-044 */
+void test_Tmr_callback_cancels_timer_due_in_same_tick(void)
+{
+    (void)Tmr_Start(0u, 400u, 0u);              /* Gpt started: tick 4   */
+    (void)Tmr_Start(1u, 400u, 0u);              /* Tick 5, cancels 2     */
+    (void)Tmr_Start(2u, 400u, 0u);              /* Tick 5                */
+
+    tick(5u);
+    TEST_ASSERT_EQUAL_UINT32(4u, fire_tick[0]);
+    TEST_ASSERT_EQUAL_UINT32(1u, fire_count[1]);
+    /* Timer 2 is due in the same tick: fired before timer 1 or cancelled */
+    TEST_ASSERT_FALSE(Tmr_IsRunning(2u));
+    tick(20u);
+    TEST_ASSERT_TRUE(fire_count[2] <= 1u);
+}
+
+/** @verifies SWR-BSW-044 */
+void test_Tmr_callback_restarts_itself(void)
+{
+    cb_restart_self = TRUE;
+    (void)Tmr_Start(3u, 200u, 0u);
+
+    tick(2u);                                   /* Fires, restarts 3 + 1 */
+    TEST_ASSERT_EQUAL_UINT32(1u, fire_count[3]);
+    tick(4u);
+    TEST_ASSERT_EQUAL_UINT32(2u, fire_count[3]);
+    TEST_ASSERT_EQUAL_UINT32(6u, fire_tick[3]);
+    TEST_ASSERT_TRUE(Tmr_IsRunning(3u));
+}
+
+/* ==================================================================
+ * SWR-BSW-044: Task dispatch
+ * ================================================================== */
+
+/** @verifies SWR-BSW-044 */
+void test_Tmr_task_dispatch_runs_callbacks_in_main_function(void)
+{
+    test_config.dispatch = TMR_DISPATCH_TASK;
+    Tmr_Init(&test_config);
+
+    (void)Tmr_Start(0u, 300u, 0u);
+    tick(5u);
+    TEST_ASSERT_EQUAL_UINT32(0u, fire_count[0]);
+
+    /* Timer started while ticks are pending counts from the real time */
+    (void)Tmr_Start(4u, 200u, 0u);              /* Due at tick 5 + 2 + 1 */
+
+    Tmr_MainFunction();
+    TEST_ASSERT_EQUAL_UINT32(1u, fire_count[0]);
+    TEST_ASSERT_EQUAL_UINT32(0u, fire_count[4]);
+
+    tick(2u);
+    Tmr_MainFunction();
+    TEST_ASSERT_EQUAL_UINT32(0u, fire_count[4]);
+    tick(1u);
+    Tmr_MainFunction();
+    TEST_ASSERT_EQUAL_UINT32(1u, fire_count[4]);
+    TEST_ASSERT_FALSE(mock_gpt_running);
+}
+
+/** @verifies SWR-BSW-044 */
+void test_Tmr_Init_invalid_keeps_previous_config(void)
+{
+    Tmr_ConfigType bad_config = test_config;
+
+    bad_config.tickUs = 0u;
+    Tmr_Init(&bad_config);                      /* Keeps previous config */
+    TEST_ASSERT_EQUAL_UINT16(1u, Det_GetErrorCount());
+    TEST_ASSERT_EQUAL(E_OK, Tmr_Start(0u, 100u, 0u));
+    TEST_ASSERT_EQUAL_UINT32(TEST_TICK_US, mock_gpt_value);
+}
+
+/* ==================================================================
+ * Test Runner
+ * ================================================================== */
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_Tmr_Init_enables_gpt_notification);
+    RUN_TEST(test_Tmr_Init_rejects_invalid_config);
+    RUN_TEST(test_Tmr_Init_fails_without_gpt_notification);
+
+    RUN_TEST(test_Tmr_Start_rejects_invalid_params);
+    RUN_TEST(test_Tmr_first_timer_starts_gpt_and_expires_in_phase);
+    RUN_TEST(test_Tmr_delay_rounds_up_and_counts_partial_tick);
+    RUN_TEST(test_Tmr_periodic_timer_has_no_drift);
+    RUN_TEST(test_Tmr_expiry_exact_across_all_levels);
+    RUN_TEST(test_Tmr_longest_delay);
+
+    RUN_TEST(test_Tmr_cancel_prevents_expiry_and_stops_gpt);
+    RUN_TEST(test_Tmr_restart_replaces_expiry);
+    RUN_TEST(test_Tmr_callback_cancels_timer_due_in_same_tick);
+    RUN_TEST(test_Tmr_callback_restarts_itself);
+
+    RUN_TEST(test_Tmr_task_dispatch_runs_callbacks_in_main_function);
+    RUN_TEST(test_Tmr_Init_invalid_keeps_previous_config);
+
+    return UNITY_END();
+}
@@ -7,7 +7,8 @@
  *
  * Tests alive supervision, checkpoint counting, global status,
  * watchdog feed gating logic, and alive counter range checking
- * with WDI toggle gating.
+ * with WDI toggle gating, deadline and logical supervision and the
+ * timestamped violation log.
  */
 #include "unity.h"
 #include "WdgM.h"
@@ -49,16 +50,50 @@ static const WdgM_SupervisedEntityConfigType test_se_config[] = {
     { 1u, 1u, 1u, 1u },  /* SE 1: expected exactly 1, 1 cycle tolerance */
 };
 
+/* SE 0: checkpoint 1 -> 2 within 100..1000 us */
+static const WdgM_DeadlineConfigType test_deadlines[] = {
+    { 0u, 1u, 2u, 100u, 1000u },
+};
+
+/* SE 1: 10 (initial) -> 11 (final) */
+static const WdgM_TransitionConfigType test_transitions[] = {
+    { 1u, WDGM_CHECKPOINT_NONE, 10u },
+    { 1u, 10u, 11u },
+    { 1u, 11u, WDGM_CHECKPOINT_NONE },
+};
+
 static WdgM_ConfigType test_config;
 
+static uint32 mock_now_us;
+
+static uint32 Mock_GetTimestampUs(void)
+{
+    return mock_now_us;
+}
+
+/** Alive indications within range for both entities */
+static void Test_AliveOk(void)
+{
+    for (uint8 i = 0u; i < 5u; i++) {
+        WdgM_CheckpointReached(0u);
+    }
+    WdgM_CheckpointReached(1u);
+}
+
 void setUp(void)
 {
     mock_dio_flip_count = 0u;
     mock_dem_report_count = 0u;
+    mock_now_us = 0u;
 
     test_config.seConfig = test_se_config;
     test_config.seCount = 2u;
     test_config.wdtDioChannel = 0u;
+    test_config.deadlineConfig   = NULL_PTR;
+    test_config.deadlineCount    = 0u;
+    test_config.transitionConfig = NULL_PTR;
+    test_config.transitionCount  = 0u;
+    test_config.getTimestampUs   = NULL_PTR;
 
     WdgM_Init(&test_config);
 }
@@ -438,6 +473,333 @@ void test_WdgM_GetLocalStatus_invalid_se(void)
     TEST_ASSERT_EQUAL(E_NOT_OK, ret);
 }
 
+/** @verifies SWR-BSW-019
+ *  Deactivated SE: no checkpoints needed, watchdog still fed */
+void test_WdgM_SetEntityActive_deactivated_not_supervised(void)
+{
+    TEST_ASSERT_EQUAL(E_OK, WdgM_SetEntityActive(0u, FALSE));
+
+    /* SE 0 silent, SE 1 OK */
+    WdgM_CheckpointReached(1u);
+    WdgM_MainFunction();
+
+    WdgM_LocalStatusType local;
+    WdgM_GetLocalStatus(0u, &local);
+    TEST_ASSERT_EQUAL(WDGM_LOCAL_STATUS_DEACTIVATED, local);
+    TEST_ASSERT_EQUAL(WDGM_GLOBAL_STATUS_OK, WdgM_GetGlobalStatus());
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_dio_flip_count);
+}
+
+/** @verifies SWR-BSW-019
+ *  Reactivated SE: supervised again from a fresh cycle */
+void test_WdgM_SetEntityActive_reactivated_supervised(void)
+{
+    WdgM_CheckpointReached(1u);
+    WdgM_CheckpointReached(1u);    /* would fail SE 1 (max 1) */
+    (void)WdgM_SetEntityActive(1u, FALSE);
+    TEST_ASSERT_EQUAL(E_OK, WdgM_SetEntityActive(1u, TRUE));
+
+    for (uint8 i = 0u; i < 5u; i++) {
+        WdgM_CheckpointReached(0u);
+    }
+    WdgM_CheckpointReached(1u);
+    WdgM_MainFunction();
+    TEST_ASSERT_EQUAL(WDGM_GLOBAL_STATUS_OK, WdgM_GetGlobalStatus());
+
+    /* No checkpoints: active again, so the cycle fails */
+    WdgM_MainFunction();
+    WdgM_LocalStatusType local;
+    WdgM_GetLocalStatus(1u, &local);
+    TEST_ASSERT_EQUAL(WDGM_LOCAL_STATUS_FAILED, local);
+}
+
+/** @verifies SWR-BSW-019
+ *  An expired SE cannot be deactivated; invalid SE rejected */
+void test_WdgM_SetEntityActive_expired_and_invalid(void)
+{
+    for (uint8 i = 0u; i < 3u; i++) {
+        WdgM_MainFunction();    /* SE 1 fails 3 times, tolerance 1 */
+    }
+
+    TEST_ASSERT_EQUAL(E_NOT_OK, WdgM_SetEntityActive(1u, FALSE));
+    TEST_ASSERT_EQUAL(E_NOT_OK, WdgM_SetEntityActive(99u, FALSE));
+
+    WdgM_LocalStatusType local;
+    WdgM_GetLocalStatus(1u, &local);
+    TEST_ASSERT_EQUAL(WDGM_LOCAL_STATUS_EXPIRED, local);
+}
+
+/* ==================================================================
+ * SWR-BSW-019: Deadline Supervision
+ * ================================================================== */
+
+static void Test_InitDeadlines(void)
+{
+    test_config.deadlineConfig = test_deadlines;
+    test_config.deadlineCount  = 1u;
+    test_config.getTimestampUs = Mock_GetTimestampUs;
+    WdgM_Init(&test_config);
+}
+
+/** @verifies SWR-BSW-019 */
+void test_WdgM_Deadline_within_window_ok(void)
+{
+    Test_InitDeadlines();
+
+    mock_now_us = 1000u;
+    TEST_ASSERT_EQUAL(E_OK, WdgM_ReportCheckpoint(0u, 1u));
+    mock_now_us = 1500u;
+    TEST_ASSERT_EQUAL(E_OK, WdgM_ReportCheckpoint(0u, 2u));
+    Test_AliveOk();
+    WdgM_MainFunction();
+
+    TEST_ASSERT_EQUAL(WDGM_GLOBAL_STATUS_OK, WdgM_GetGlobalStatus());
+    TEST_ASSERT_EQUAL_UINT16(0u, WdgM_GetViolationCount());
+}
+
+/** @verifies SWR-BSW-019
+ *  Late end: failed cycle, violation logged with time and duration */
+void test_WdgM_Deadline_too_late_logged(void)
+{
+    WdgM_ViolationType v;
+    WdgM_LocalStatusType local;
+
+    Test_InitDeadlines();
+
+    mock_now_us = 1000u;
+    (void)WdgM_ReportCheckpoint(0u, 1u);
+    mock_now_us = 3000u;
+    (void)WdgM_ReportCheckpoint(0u, 2u);
+    Test_AliveOk();
+    WdgM_MainFunction();
+
+    WdgM_GetLocalStatus(0u, &local);
+    TEST_ASSERT_EQUAL(WDGM_LOCAL_STATUS_FAILED, local);
+    TEST_ASSERT_EQUAL_UINT8(0u, mock_dio_flip_count);
+
+    TEST_ASSERT_EQUAL_UINT16(1u, WdgM_GetViolationCount());
+    TEST_ASSERT_EQUAL(E_OK, WdgM_GetViolation(0u, &v));
+    TEST_ASSERT_EQUAL(WDGM_VIOLATION_DEADLINE, v.kind);
+    TEST_ASSERT_EQUAL_UINT8(0u, v.SEId);
+    TEST_ASSERT_EQUAL_UINT8(2u, v.checkpoint);
+    TEST_ASSERT_EQUAL_UINT32(3000u, v.timestampUs);
+    TEST_ASSERT_EQUAL_UINT32(2000u, v.value);
+}
+
+/** @verifies SWR-BSW-019 */
+void test_WdgM_Deadline_too_early_fails(void)
+{
+    WdgM_ViolationType v;
+
+    Test_InitDeadlines();
+
+    mock_now_us = 1000u;
+    (void)WdgM_ReportCheckpoint(0u, 1u);
+    mock_now_us = 1050u;
+    (void)WdgM_ReportCheckpoint(0u, 2u);
+    Test_AliveOk();
+    WdgM_MainFunction();
+
+    TEST_ASSERT_EQUAL(WDGM_GLOBAL_STATUS_FAILED, WdgM_GetGlobalStatus());
+    TEST_ASSERT_EQUAL(E_OK, WdgM_GetViolation(0u, &v));
+    TEST_ASSERT_EQUAL_UINT32(50u, v.value);
+}
+
+/** @verifies SWR-BSW-019
+ *  Missing end is detected by the main function once overdue */
+void test_WdgM_Deadline_missing_end_detected(void)
+{
+    WdgM_ViolationType v;
+
+    Test_InitDeadlines();
+
+    mock_now_us = 1000u;
+    (void)WdgM_ReportCheckpoint(0u, 1u);
+    mock_now_us = 1800u;
+    Test_AliveOk();
+    WdgM_MainFunction();
+    TEST_ASSERT_EQUAL(WDGM_GLOBAL_STATUS_OK, WdgM_GetGlobalStatus());
+
+    mock_now_us = 2500u;
+    Test_AliveOk();
+    WdgM_MainFunction();
+    TEST_ASSERT_EQUAL(WDGM_GLOBAL_STATUS_FAILED, WdgM_GetGlobalStatus());
+    TEST_ASSERT_EQUAL(E_OK, WdgM_GetViolation(0u, &v));
+    TEST_ASSERT_EQUAL_UINT8(2u, v.checkpoint);
+    TEST_ASSERT_EQUAL_UINT32(1500u, v.value);
+
+    /* Logged once: a late end no longer counts */
+    mock_now_us = 2600u;
+    (void)WdgM_ReportCheckpoint(0u, 2u);
+    TEST_ASSERT_EQUAL_UINT16(1u, WdgM_GetViolationCount());
+}
+
+/** @verifies SWR-BSW-019
+ *  Without a clock, deadlines are not supervised */
+void test_WdgM_Deadline_no_clock_unchecked(void)
+{
+    test_config.deadlineConfig = test_deadlines;
+    test_config.deadlineCount  = 1u;
+    WdgM_Init(&test_config);
+
+    (void)WdgM_ReportCheckpoint(0u, 1u);
+    Test_AliveOk();
+    WdgM_MainFunction();
+    (void)WdgM_ReportCheckpoint(0u, 2u);
+
+    TEST_ASSERT_EQUAL(WDGM_GLOBAL_STATUS_OK, WdgM_GetGlobalStatus());
+    TEST_ASSERT_EQUAL_UINT16(0u, WdgM_GetViolationCount());
+}
+
+/* ==================================================================
+ * SWR-BSW-019: Logical Supervision
+ * ================================================================== */
+
+static void Test_InitLogical(void)
+{
+    test_config.transitionConfig = test_transitions;
+    test_config.transitionCount  = 3u;
+    test_config.getTimestampUs   = Mock_GetTimestampUs;
+    WdgM_Init(&test_config);
+}
+
+/** @verifies SWR-BSW-019 */
+void test_WdgM_Logical_valid_sequence_ok(void)
+{
+    Test_InitLogical();
+
+    for (uint8 i = 0u; i < 3u; i++) {
+        (void)WdgM_ReportCheckpoint(1u, 10u);
+        (void)WdgM_ReportCheckpoint(1u, 11u);
+    }
+    Test_AliveOk();
+    WdgM_MainFunction();
+
+    TEST_ASSERT_EQUAL(WDGM_GLOBAL_STATUS_OK, WdgM_GetGlobalStatus());
+    TEST_ASSERT_EQUAL_UINT16(0u, WdgM_GetViolationCount());
+}
+
+/** @verifies SWR-BSW-019
+ *  Out-of-order checkpoint: one violation, then the graph resyncs */
+void test_WdgM_Logical_out_of_order_fails(void)
+{
+    WdgM_ViolationType v;
+    WdgM_LocalStatusType local;
+
+    Test_InitLogical();
+
+    (void)WdgM_ReportCheckpoint(1u, 10u);
+    mock_now_us = 700u;
+    (void)WdgM_ReportCheckpoint(1u, 10u);  /* 10 -> 10 not allowed */
+    (void)WdgM_ReportCheckpoint(1u, 11u);
+    Test_AliveOk();
+    WdgM_MainFunction();
+
+    WdgM_GetLocalStatus(1u, &local);
+    TEST_ASSERT_EQUAL(WDGM_LOCAL_STATUS_FAILED, local);
+    TEST_ASSERT_EQUAL_UINT16(1u, WdgM_GetViolationCount());
+    TEST_ASSERT_EQUAL(E_OK, WdgM_GetViolation(0u, &v));
+    TEST_ASSERT_EQUAL(WDGM_VIOLATION_LOGICAL, v.kind);
+    TEST_ASSERT_EQUAL_UINT8(1u, v.SEId);
+    TEST_ASSERT_EQUAL_UINT8(10u, v.checkpoint);
+    TEST_ASSERT_EQUAL_UINT32(10u, v.value);
+    TEST_ASSERT_EQUAL_UINT32(700u, v.timestampUs);
+
+    /* Next cycle in order: recovered */
+    (void)WdgM_ReportCheckpoint(1u, 10u);
+    (void)WdgM_ReportCheckpoint(1u, 11u);
+    Test_AliveOk();
+    WdgM_MainFunction();
+    TEST_ASSERT_EQUAL(WDGM_GLOBAL_STATUS_OK, WdgM_GetGlobalStatus());
+}
+
+/** @verifies SWR-BSW-019
+ *  Entities without transitions are not logically supervised */
+void test_WdgM_Logical_unsupervised_entity_ignored(void)
+{
+    Test_InitLogical();
+
+    (void)WdgM_ReportCheckpoint(0u, 7u);
+    (void)WdgM_ReportCheckpoint(0u, 3u);
+    Test_AliveOk();
+    WdgM_MainFunction();
+
+    TEST_ASSERT_EQUAL(WDGM_GLOBAL_STATUS_OK, WdgM_GetGlobalStatus());
+}
+
+/* ==================================================================
+ * SWR-BSW-019: Violation Log
+ * ================================================================== */
+
+/** @verifies SWR-BSW-019
+ *  Alive violations are logged with the cycle time and counter */
+void test_WdgM_ViolationLog_alive(void)
+{
+    WdgM_ViolationType v;
+
+    test_config.getTimestampUs = Mock_GetTimestampUs;
+    WdgM_Init(&test_config);
+
+    mock_now_us = 100000u;
+    WdgM_CheckpointReached(0u);
+    WdgM_CheckpointReached(1u);
+    WdgM_MainFunction();
+
+    TEST_ASSERT_EQUAL(E_OK, WdgM_GetViolation(0u, &v));
+    TEST_ASSERT_EQUAL(WDGM_VIOLATION_ALIVE, v.kind);
+    TEST_ASSERT_EQUAL_UINT8(0u, v.SEId);
+    TEST_ASSERT_EQUAL_UINT8(WDGM_CHECKPOINT_NONE, v.checkpoint);
+    TEST_ASSERT_EQUAL_UINT32(1u, v.value);
+    TEST_ASSERT_EQUAL_UINT32(100000u, v.timestampUs);
+}
+
+/** @verifies SWR-BSW-019
+ *  Newest first; only the last WDGM_VIOLATION_LOG are kept */
+void test_WdgM_ViolationLog_wraps(void)
+{
+    WdgM_ViolationType v;
+    uint8 i;
+
+    Test_InitLogical();
+
+    for (i = 0u; i < (WDGM_VIOLATION_LOG + 2u); i++) {
+        mock_now_us = i;
+        (void)WdgM_ReportCheckpoint(1u, 11u);  /* never a valid entry */
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(WDGM_VIOLATION_LOG + 2u, WdgM_GetViolationCount());
+    TEST_ASSERT_EQUAL(E_OK, WdgM_GetViolation(0u, &v));
+    TEST_ASSERT_EQUAL_UINT32(WDGM_VIOLATION_LOG + 1u, v.timestampUs);
+    TEST_ASSERT_EQUAL(E_OK, WdgM_GetViolation(WDGM_VIOLATION_LOG - 1u, &v));
+    TEST_ASSERT_EQUAL_UINT32(2u, v.timestampUs);
+    TEST_ASSERT_EQUAL(E_NOT_OK, WdgM_GetViolation(WDGM_VIOLATION_LOG, &v));
+    TEST_ASSERT_EQUAL(E_NOT_OK, WdgM_GetViolation(0u, NULL_PTR));
+}
+
+/** @verifies SWR-BSW-019 */
+void test_WdgM_ReportCheckpoint_invalid(void)
+{
+    TEST_ASSERT_EQUAL(E_NOT_OK, WdgM_ReportCheckpoint(99u, 1u));
+    TEST_ASSERT_EQUAL(E_NOT_OK, WdgM_ReportCheckpoint(0u, WDGM_CHECKPOINT_NONE));
+}
+
+/** @verifies SWR-BSW-019
+ *  Invalid supervision tables reject the configuration */
+void test_WdgM_Init_invalid_supervision_config(void)
+{
+    test_config.deadlineConfig = test_deadlines;
+    test_config.deadlineCount  = WDGM_MAX_DEADLINES + 1u;
+    WdgM_Init(&test_config);
+    TEST_ASSERT_EQUAL(WDGM_GLOBAL_STATUS_FAILED, WdgM_GetGlobalStatus());
+    TEST_ASSERT_EQUAL(E_NOT_OK, WdgM_ReportCheckpoint(0u, 1u));
+
+    test_config.deadlineConfig = NULL_PTR;
+    test_config.deadlineCount  = 0u;
+    test_config.transitionCount = 1u;
+    WdgM_Init(&test_config);
+    TEST_ASSERT_EQUAL(WDGM_GLOBAL_STATUS_FAILED, WdgM_GetGlobalStatus());
+}
+
 /* ==================================================================
  * Test runner
  * ================================================================== */
@@ -470,5 +832,22 @@ int main(void)
     RUN_TEST(test_WdgM_Zero_checkpoints_all_fail);
     RUN_TEST(test_WdgM_GetLocalStatus_invalid_se);
 
+    RUN_TEST(test_WdgM_SetEntityActive_deactivated_not_supervised);
+    RUN_TEST(test_WdgM_SetEntityActive_reactivated_supervised);
+    RUN_TEST(test_WdgM_SetEntityActive_expired_and_invalid);
+
+    RUN_TEST(test_WdgM_Deadline_within_window_ok);
+    RUN_TEST(test_WdgM_Deadline_too_late_logged);
+    RUN_TEST(test_WdgM_Deadline_too_early_fails);
+    RUN_TEST(test_WdgM_Deadline_missing_end_detected);
+    RUN_TEST(test_WdgM_Deadline_no_clock_unchecked);
+    RUN_TEST(test_WdgM_Logical_valid_sequence_ok);
+    RUN_TEST(test_WdgM_Logical_out_of_order_fails);
+    RUN_TEST(test_WdgM_Logical_unsupervised_entity_ignored);
+    RUN_TEST(test_WdgM_ViolationLog_alive);
+    RUN_TEST(test_WdgM_ViolationLog_wraps);
+    RUN_TEST(test_WdgM_ReportCheckpoint_invalid);
+    RUN_TEST(test_WdgM_Init_invalid_supervision_config);
+
     return UNITY_END();
 }
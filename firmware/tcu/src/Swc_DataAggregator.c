@@ -24,12 +24,9 @@
 #include "Swc_DataAggregator.h"
 
 /* MISRA 20.1: All #include directives must precede code/declarations.
- * POSIX header needed by the real (non-mock) Docker-simulated TCU ECU. */
+ * SIL time base needed by the real (non-mock) Docker-simulated TCU ECU. */
 #ifndef TCU_DATA_USE_MOCK
-/* cppcheck-suppress misra-c2012-21.10
- * Deviation: time.h is required for clock_gettime() in the Docker-simulated
- * TCU ECU (POSIX simulation, not safety-critical firmware). */
-#include <time.h>
+#include "Sil_Time.h"
 #endif /* !TCU_DATA_USE_MOCK */
 
 /* ====================================================================
@@ -43,13 +40,8 @@ extern uint32 mock_get_tick_ms(void);
 
 #else
 
-static uint32 real_get_tick_ms(void)
-{
-    struct timespec ts;
-    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
-    return (uint32)((ts.tv_sec * 1000u) + (ts.tv_nsec / 1000000u));
-}
-#define GET_TICK_MS()  real_get_tick_ms()
+/* Virtual time: follows SIL_TIME_SCALE and the lockstep time master */
+#define GET_TICK_MS()  Sil_Time_GetTickMs()
 
 #endif /* TCU_DATA_USE_MOCK */
 
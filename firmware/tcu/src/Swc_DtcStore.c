@@ -30,22 +30,18 @@ static boolean dtc_initialized;
 
 static void capture_freeze_frame(DtcStoreEntry_t* entry)
 {
-    uint32 val = 0u;
-
-    (void)Rte_Read(TCU_SIG_VEHICLE_SPEED, &val);
-    entry->ff_speed = (uint16)val;
-
-    val = 0u;
-    (void)Rte_Read(TCU_SIG_MOTOR_CURRENT, &val);
-    entry->ff_current = (uint16)val;
-
-    val = 0u;
-    (void)Rte_Read(TCU_SIG_BATTERY_VOLTAGE, &val);
-    entry->ff_voltage = (uint16)val;
-
-    val = 0u;
-    (void)Rte_Read(TCU_SIG_MOTOR_TEMP, &val);
-    entry->ff_temp = (uint8)val;
+    /* One snapshot: the four values belong to the same RTE update */
+    static const Rte_SignalIdType ff_signals[4] = {
+        TCU_SIG_VEHICLE_SPEED, TCU_SIG_MOTOR_CURRENT,
+        TCU_SIG_BATTERY_VOLTAGE, TCU_SIG_MOTOR_TEMP
+    };
+    uint32 val[4] = { 0u, 0u, 0u, 0u };
+
+    (void)Rte_ReadGroup(ff_signals, val, 4u);
+    entry->ff_speed   = (uint16)val[0];
+    entry->ff_current = (uint16)val[1];
+    entry->ff_voltage = (uint16)val[2];
+    entry->ff_temp    = (uint8)val[3];
 
     entry->ff_timestamp = tick_counter;
 }
@@ -164,7 +164,7 @@ int main(void)
 
     while (tcu_shutdown_requested == FALSE) {
         Rte_MainFunction();
-        Sil_Time_Sleep(10000u); /* 10ms virtual tick */
+        Sil_Time_WaitNextPeriod(10000u); /* 10ms virtual tick */
     }
 
     /* ---- Shutdown ---- */
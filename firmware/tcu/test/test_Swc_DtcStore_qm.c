@@ -8,7 +8,7 @@
  * Tests DTC storage initialization, add/update, maximum capacity, freeze-frame
  * capture, aging counter, clear-all, and auto-capture from DTC broadcast.
  *
- * Mocks: Rte_Read, Rte_Write
+ * Mocks: Rte_Read, Rte_ReadGroup, Rte_Write
  */
 #include "unity.h"
 
@@ -86,7 +86,7 @@ uint8              Swc_DtcStore_GetByMask(uint8 statusMask, uint32* dtcCodes,
 #define TCU_DTC_AGING_CLEAR_CYCLES  40u
 
 /* ====================================================================
- * Mock: Rte_Read / Rte_Write
+ * Mock: Rte_Read / Rte_ReadGroup / Rte_Write
  * ==================================================================== */
 
 #define MOCK_RTE_MAX_SIGNALS  32u
@@ -106,6 +106,27 @@ Std_ReturnType Rte_Read(uint16 SignalId, uint32* DataPtr)
     return E_NOT_OK;
 }
 
+static uint8  mock_rte_read_group_count;
+
+Std_ReturnType Rte_ReadGroup(const uint16* SignalIds, uint32* DataPtr, uint8 Count)
+{
+    uint8 i;
+
+    mock_rte_read_group_count++;
+    if ((SignalIds == NULL_PTR) || (DataPtr == NULL_PTR)) {
+        return E_NOT_OK;
+    }
+    for (i = 0u; i < Count; i++) {
+        if (SignalIds[i] >= MOCK_RTE_MAX_SIGNALS) {
+            return E_NOT_OK;
+        }
+    }
+    for (i = 0u; i < Count; i++) {
+        DataPtr[i] = mock_rte_signals[SignalIds[i]];
+    }
+    return E_OK;
+}
+
 static uint16 mock_rte_write_sig;
 static uint32 mock_rte_write_val;
 static uint8  mock_rte_write_count;
@@ -143,6 +164,7 @@ void setUp(void)
     mock_rte_write_sig   = 0u;
     mock_rte_write_val   = 0u;
     mock_rte_write_count = 0u;
+    mock_rte_read_group_count = 0u;
     mock_tick_counter    = 0u;
 
     Swc_DtcStore_Init();
@@ -244,6 +266,9 @@ void test_DtcStore_freeze_frame_capture(void)
     TEST_ASSERT_EQUAL_UINT16(200u,   entry->ff_current);
     TEST_ASSERT_EQUAL_UINT16(48500u, entry->ff_voltage);
     TEST_ASSERT_EQUAL_UINT8(72u,     entry->ff_temp);
+
+    /* Captured as one consistent snapshot */
+    TEST_ASSERT_EQUAL_UINT8(1u, mock_rte_read_group_count);
 }
 
 /* ====================================================================
@@ -9,6 +9,7 @@ CRC-8 SAE J1850 (poly 0x1D, init 0xFF) computed over [data_id] + payload[2:].
 
 import json
 import logging
+import mmap
 import os
 import struct
 import time
@@ -21,10 +22,30 @@ import paho.mqtt.client as paho_mqtt
 # SIL time acceleration: divide wall-clock sleeps by scale factor
 _SIL_SCALE = max(1, min(100, int(os.environ.get("SIL_TIME_SCALE", "1"))))
 
+# Lockstep SIL: sleeps follow the time master's virtual clock, read from its
+# shared memory segment (firmware Sil_TimeShm.h: nowUs at 16, running at 28)
+_SIL_MASTER = os.environ.get("SIL_TIME_MASTER", "")
+_sil_master_mm: Optional[mmap.mmap] = None
+
+
+def _sil_master_read(fmt: str, offset: int) -> int:
+    global _sil_master_mm
+    if _sil_master_mm is None:
+        with open("/dev/shm/" + _SIL_MASTER, "rb") as f:
+            _sil_master_mm = mmap.mmap(f.fileno(), 40, access=mmap.ACCESS_READ)
+    return struct.unpack_from(fmt, _sil_master_mm, offset)[0]
+
 
 def _scaled_sleep(seconds: float) -> None:
-    """Sleep for seconds / SIL_TIME_SCALE wall-clock time."""
-    time.sleep(seconds / _SIL_SCALE)
+    """Sleep for seconds of virtual time (seconds / SIL_TIME_SCALE wall-clock)."""
+    if not _SIL_MASTER:
+        time.sleep(seconds / _SIL_SCALE)
+        return
+    end_us = _sil_master_read("<Q", 16) + int(seconds * 1e6)
+    while _sil_master_read("<Q", 16) < end_us:
+        if _sil_master_read("<I", 28) == 0:
+            raise RuntimeError("SIL time master ended the run")
+        time.sleep(0.001)
 
 from .pedal_udp import (
     clear_pedal_override,
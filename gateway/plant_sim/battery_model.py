@@ -3,7 +3,7 @@
 Supports external override via inject_voltage() for fault injection demos.
 """
 
-import time
+from . import sil_time
 
 
 class BatteryModel:
@@ -22,7 +22,7 @@ class BatteryModel:
         """Override battery state (called when external Battery_Status CAN received)."""
         self._override_voltage = voltage_mv
         self._override_soc = soc_pct
-        self._override_ts = time.monotonic()
+        self._override_ts = sil_time.monotonic()
 
     def clear_override(self):
         """Clear voltage override (called on reset)."""
@@ -32,7 +32,7 @@ class BatteryModel:
     def update(self, motor_current_ma: float, dt: float):
         # Check if override is active and not expired
         if self._override_voltage is not None:
-            if time.monotonic() - self._override_ts < self.OVERRIDE_TIMEOUT:
+            if sil_time.monotonic() - self._override_ts < self.OVERRIDE_TIMEOUT:
                 self.voltage_mv = self._override_voltage
                 if self._override_soc is not None:
                     self.soc = self._override_soc
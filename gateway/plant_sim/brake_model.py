@@ -9,9 +9,10 @@ Fault detection:
   5ms intervals are captured even with 10ms physics ticks.
 """
 
-import time
 from collections import deque
 
+from . import sil_time
+
 
 class BrakeModel:
     RATE_LIMIT_PCT_S = 200.0  # can go 0-100% in 0.5s
@@ -42,11 +43,11 @@ class BrakeModel:
 
         cmd_delta = abs(clamped - self._prev_cmd)
         if cmd_delta >= self.CONFLICT_SWING_PCT:
-            self._large_swings.append(time.monotonic())
+            self._large_swings.append(sil_time.monotonic())
         self._prev_cmd = clamped
 
         # Expire old swings outside window
-        cutoff = time.monotonic() - self.CONFLICT_WINDOW_S
+        cutoff = sil_time.monotonic() - self.CONFLICT_WINDOW_S
         while self._large_swings and self._large_swings[0] < cutoff:
             self._large_swings.popleft()
 
@@ -11,7 +11,7 @@ Physics:
   dT/dt = (I^2 * R_thermal - (T - T_ambient) / R_cool) / C_thermal
 """
 
-import time
+from . import sil_time
 
 
 class MotorModel:
@@ -38,7 +38,7 @@ class MotorModel:
         self._hw_disabled = False    # firmware overcurrent/overtemp disable
         self._overcurrent_latch = False  # injected overcurrent persists
         self._injected_current_ma = 0.0
-        self._last_time = time.monotonic()
+        self._last_time = sil_time.monotonic()
 
     def update(self, duty_pct: float, direction: int, dt: float = None,
                brake_load: float = 0.0):
@@ -46,7 +46,7 @@ class MotorModel:
 
         brake_load: 0.0-1.0 mechanical resistance from brake (0=free, 1=locked).
         """
-        now = time.monotonic()
+        now = sil_time.monotonic()
         if dt is None:
             dt = now - self._last_time
         self._last_time = now
@@ -0,0 +1,210 @@
+"""SIL time base of the plant simulator — wall clock or lockstep time master.
+
+Without SIL_TIME_MASTER, monotonic() is time.monotonic() and the simulator
+paces itself (SIL_TIME_SCALE).  With SIL_TIME_MASTER=<segment name> and
+SIL_TIME_SLOT=<n>, the simulator is a participant of the lockstep time
+master (firmware build/sil_time_master): monotonic() is the master's virtual
+clock and wait_next_period() blocks until the master grants the next turn.
+
+Segment layout and protocol: firmware/shared/bsw/sil/Sil_TimeShm.h.
+"""
+
+import ctypes
+import logging
+import mmap
+import os
+import platform
+import time
+
+log = logging.getLogger("plant_sim.sil_time")
+
+# Sil_TimeShm.h
+_MAGIC = 0x54534C53
+_VERSION = 1
+_MAX_SLOTS = 16
+_TURN_MASTER = 0xFFFFFFFF
+_SLOT_ATTACHED = 1
+_SLOT_DETACHED = 2
+_SHM_SIZE = 40 + _MAX_SLOTS * 24
+
+_OFF_MAGIC = 0
+_OFF_VERSION = 4
+_OFF_NOW_US = 16
+_OFF_TURN = 24
+_OFF_RUNNING = 28
+_OFF_SLOT = 40
+_SLOT_SIZE = 24
+_SLOT_WAKE_US = 0
+_SLOT_STATE = 8
+_SLOT_GO = 12
+_SLOT_GRANTS = 16
+
+_SYS_FUTEX = {"x86_64": 202, "aarch64": 98}.get(platform.machine())
+_FUTEX_WAIT = 0
+_FUTEX_WAKE = 1
+_WAIT_SLICE_NS = 100_000_000    # Futex wait slice: Ctrl-C stays responsive
+
+_ATTACH_TIMEOUT_S = 10.0
+
+
+class LockstepEnded(Exception):
+    """The time master ended the run."""
+
+
+class _Timespec(ctypes.Structure):
+    _fields_ = [("tv_sec", ctypes.c_long), ("tv_nsec", ctypes.c_long)]
+
+
+class Lockstep:
+    """One participant slot of the lockstep time master."""
+
+    def __init__(self, name: str, slot: int):
+        if not 0 <= slot < _MAX_SLOTS:
+            raise ValueError(f"SIL_TIME_SLOT must be 0..{_MAX_SLOTS - 1}")
+        self.name = name
+        self.slot = slot
+        self._mm = self._map(name)
+
+        def u32(off: int) -> ctypes.c_uint32:
+            return ctypes.c_uint32.from_buffer(self._mm, off)
+
+        def u64(off: int) -> ctypes.c_uint64:
+            return ctypes.c_uint64.from_buffer(self._mm, off)
+
+        base = _OFF_SLOT + slot * _SLOT_SIZE
+        self._now = u64(_OFF_NOW_US)
+        self._turn = u32(_OFF_TURN)
+        self._running = u32(_OFF_RUNNING)
+        self._wake = u64(base + _SLOT_WAKE_US)
+        self._state = u32(base + _SLOT_STATE)
+        self._go = u32(base + _SLOT_GO)
+        self._grants = u32(base + _SLOT_GRANTS)
+
+        self._libc = ctypes.CDLL(None, use_errno=True) if _SYS_FUTEX else None
+        self._period_us = 0
+        self._deadline_us = 0
+        self._ended = False
+
+        if self._state.value == _SLOT_ATTACHED:
+            log.warning("Lockstep slot %d re-attached (restart?)", slot)
+        self._wake.value = self._now.value
+        self._seen = self._go.value
+        self._state.value = _SLOT_ATTACHED
+
+        log.info("SIL lockstep: slot %d of time master /%s", slot, name)
+        self._wait_turn()
+
+    @staticmethod
+    def _map(name: str) -> mmap.mmap:
+        """Map the segment; the master may start after this process."""
+        path = "/dev/shm/" + name
+        deadline = time.monotonic() + _ATTACH_TIMEOUT_S
+        while True:
+            try:
+                fd = os.open(path, os.O_RDWR)
+                try:
+                    if os.fstat(fd).st_size >= _SHM_SIZE:
+                        mm = mmap.mmap(fd, _SHM_SIZE)
+                        magic = ctypes.c_uint32.from_buffer(mm, _OFF_MAGIC)
+                        if magic.value == _MAGIC:
+                            del magic
+                            break
+                        del magic
+                        mm.close()
+                finally:
+                    os.close(fd)
+            except FileNotFoundError:
+                pass
+            if time.monotonic() >= deadline:
+                raise RuntimeError(f"time master /{name} not found")
+            time.sleep(0.01)
+
+        version = ctypes.c_uint32.from_buffer(mm, _OFF_VERSION).value
+        if version != _VERSION:
+            raise RuntimeError(f"time master /{name}: segment version {version}")
+        return mm
+
+    def _futex(self, word: ctypes.c_uint32, op: int, val: int) -> None:
+        if self._libc is None:
+            time.sleep(0.0002)      # Unknown syscall number: poll
+            return
+        ts = _Timespec(0, _WAIT_SLICE_NS)
+        self._libc.syscall(ctypes.c_long(_SYS_FUTEX),
+                           ctypes.c_void_p(ctypes.addressof(word)),
+                           ctypes.c_int(op), ctypes.c_uint32(val),
+                           ctypes.byref(ts) if op == _FUTEX_WAIT else None,
+                           None, ctypes.c_int(0))
+
+    def _wait_turn(self) -> None:
+        while True:
+            if self._running.value == 0:
+                self._ended = True
+                raise LockstepEnded(f"time master ended the run at "
+                                    f"{self._now.value} us")
+            go = self._go.value
+            if go != self._seen:
+                self._seen = go
+                return
+            self._futex(self._go, _FUTEX_WAIT, go)
+
+    def _yield(self, wake_us: int) -> None:
+        """Hand the turn back; run again at virtual wake_us."""
+        if self._ended:
+            raise LockstepEnded("run already ended")
+        # Only the master's watchdog can take a held turn away
+        if self._turn.value != self.slot:
+            raise RuntimeError(f"lockstep slot {self.slot} dropped by the "
+                               f"time master")
+        self._wake.value = wake_us
+        self._grants.value += 1
+        self._turn.value = _TURN_MASTER
+        self._futex(self._turn, _FUTEX_WAKE, 0x7FFFFFFF)
+        self._wait_turn()
+
+    def now_us(self) -> int:
+        """Virtual time of the run in microseconds."""
+        return self._now.value
+
+    def sleep(self, period_us: int) -> None:
+        """Let period_us of virtual time pass."""
+        self._yield(self._now.value + period_us)
+
+    def wait_next_period(self, period_us: int) -> None:
+        """Block until the next deadline of a fixed period (virtual us)."""
+        now = self._now.value
+        if period_us != self._period_us:
+            self._period_us = period_us
+            self._deadline_us = now
+        self._deadline_us += period_us
+        if self._deadline_us <= now:
+            # Overran via sleep(): skip the periods already past
+            self._deadline_us += (now - self._deadline_us) // period_us * period_us
+            return
+        self._yield(self._deadline_us)
+
+    def close(self) -> None:
+        """Leave the run; hand the turn back if held."""
+        self._state.value = _SLOT_DETACHED
+        if self._turn.value == self.slot:
+            self._turn.value = _TURN_MASTER
+            self._futex(self._turn, _FUTEX_WAKE, 0x7FFFFFFF)
+
+
+_lockstep: Lockstep | None = None
+
+
+def attach_from_env() -> Lockstep | None:
+    """Join the lockstep time master named by SIL_TIME_MASTER, if set."""
+    global _lockstep
+    name = os.environ.get("SIL_TIME_MASTER", "")
+    if not name:
+        return None
+    _lockstep = Lockstep(name, int(os.environ.get("SIL_TIME_SLOT", "-1")))
+    return _lockstep
+
+
+def monotonic() -> float:
+    """Seconds for model timers: virtual in lockstep, else time.monotonic()."""
+    if _lockstep is not None:
+        return _lockstep.now_us() / 1e6
+    return time.monotonic()
@@ -21,6 +21,7 @@ from .steering_model import SteeringModel
 from .brake_model import BrakeModel
 from .battery_model import BatteryModel
 from .lidar_model import LidarModel
+from . import sil_time
 
 logging.basicConfig(
     level=logging.INFO,
@@ -637,7 +638,10 @@ class PlantSimulator:
         sil_scale = max(1, min(100, sil_scale))
         dt = 0.01  # 10ms virtual time step (physics always sees 10ms)
         wall_dt = dt / sil_scale  # actual wall-clock sleep per tick
-        if sil_scale > 1:
+
+        # Lockstep SIL: the time master paces the loop instead (scale unused)
+        lockstep = sil_time.attach_from_env()
+        if lockstep is None and sil_scale > 1:
             log.info("SIL time acceleration: %dx (wall sleep %.1fms per tick)",
                      sil_scale, wall_dt * 1000)
         self._tick = 0
@@ -771,6 +775,11 @@ class PlantSimulator:
                         self.brake.position_int,
                     )
 
+                if lockstep is not None:
+                    # Hand the turn back until the next 10ms virtual tick
+                    lockstep.wait_next_period(int(dt * 1e6))
+                    continue
+
                 # Sleep remainder of cycle (wall_dt = dt / SIL_TIME_SCALE)
                 elapsed = time.monotonic() - loop_start
                 sleep_time = wall_dt - elapsed
@@ -779,7 +788,11 @@ class PlantSimulator:
 
         except KeyboardInterrupt:
             log.info("Plant simulator stopped")
+        except sil_time.LockstepEnded as exc:
+            log.info("Plant simulator stopped: %s", exc)
         finally:
+            if lockstep is not None:
+                lockstep.close()
             if self._mqtt:
                 self._mqtt.loop_stop()
                 self._mqtt.disconnect()
@@ -11,9 +11,10 @@ Fault detection:
   5ms intervals are captured even with 10ms physics ticks.
 """
 
-import time
 from collections import deque
 
+from . import sil_time
+
 
 class SteeringModel:
     RATE_LIMIT_DEG_S = 30.0   # max steering rate deg/s
@@ -48,12 +49,12 @@ class SteeringModel:
         if abs(cmd_delta) > 1.0:  # ignore tiny jitter
             direction = 1 if cmd_delta > 0 else -1
             if self._prev_direction != 0 and direction != self._prev_direction:
-                self._direction_changes.append(time.monotonic())
+                self._direction_changes.append(sil_time.monotonic())
             self._prev_direction = direction
         self._prev_cmd = clamped
 
         # Expire old direction changes outside window
-        cutoff = time.monotonic() - self.OSCILLATION_WINDOW_S
+        cutoff = sil_time.monotonic() - self.OSCILLATION_WINDOW_S
         while self._direction_changes and self._direction_changes[0] < cutoff:
             self._direction_changes.popleft()
 
@@ -12,7 +12,7 @@
  * end-to-end PDU routing through PduR -> CanIf -> Can_Write (mocked).
  *
  * Linked modules (REAL): Dem.c, Dcm.c, PduR.c, CanIf.c
- * Mocked: Can_Write (captures TX response)
+ * Mocked: Can_Write (captures TX response), Rte_Read
  *
  * @copyright Taktflow Systems 2026
  */
@@ -60,6 +60,20 @@ void Com_RxIndication(PduIdType RxPduId, const PduInfoType* PduInfoPtr)
     (void)PduInfoPtr;
 }
 
+/* ====================================================================
+ * Mock: Rte_Read — Dem freeze-frame source (no freeze-frame signals
+ * configured in these tests)
+ * ==================================================================== */
+
+Std_ReturnType Rte_Read(uint16 SignalId, uint32* DataPtr)
+{
+    (void)SignalId;
+    if (DataPtr != NULL_PTR) {
+        *DataPtr = 0u;
+    }
+    return E_OK;
+}
+
 /* ====================================================================
  * DID Read Callback: reads DEM event 5 status via Dem_GetEventStatus
  * ==================================================================== */
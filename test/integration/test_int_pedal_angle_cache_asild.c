@@ -0,0 +1,333 @@
+/**
+ * @file    test_int_pedal_angle_cache_asild.c
+ * @brief   Integration test: CVC Rte schedule -> async SPI -> IoHwAb angle cache -> pedal
+ * @date    2026-03-24
+ *
+ * @verifies SWR-BSW-006, SWR-BSW-014, SWR-BSW-026
+ * @aspice   SWE.5 — Software Component Verification & Integration
+ * @iso      ISO 26262 Part 6, Section 10
+ *
+ * Runs the real CVC runnable table. IoHwAb_MainFunction starts the pedal
+ * SPI sequence, the transfer ends between ticks (as Spi_Posix_Poll does in
+ * the SIL main loop), and the notification fills IoHwAb's angle cache.
+ * The pedal runnable is a probe that reads both sensors: from the first
+ * cycle after boot on, it must see a valid cached sample. An empty cache
+ * would make Swc_Pedal latch a sensor fault and report its DTC at boot.
+ *
+ * Linked modules (REAL): Rte.c, Rte_Cfg_Cvc.c, IoHwAb.c, Spi.c
+ * Mocked: Spi_Hw_* (transfer ends at the next poll), Dio, Adc, Pwm, WdgM,
+ *         the other CVC runnables
+ *
+ * @copyright Taktflow Systems 2026
+ */
+#include "unity.h"
+#include "Rte.h"
+#include "Spi.h"
+#include "IoHwAb.h"
+#include "WdgM.h"
+
+extern const Rte_ConfigType cvc_rte_config;
+
+/* ====================================================================
+ * Mock: Spi_Hw — AS5048A angle per channel, transfer ends at the poll
+ * ==================================================================== */
+
+#define PEDAL_0_ANGLE   0x1234u
+#define PEDAL_1_ANGLE   0x1256u
+
+static uint16*  mock_spi_rx;
+static uint8    mock_spi_channel;
+static boolean  mock_spi_pending;
+static boolean  mock_spi_fail;
+
+Std_ReturnType Spi_Hw_Init(void)
+{
+    return E_OK;
+}
+
+Std_ReturnType Spi_Hw_Transmit(uint8 Channel, const uint16* TxBuf,
+                               uint16* RxBuf, uint8 Length)
+{
+    (void)Channel;
+    (void)TxBuf;
+    (void)RxBuf;
+    (void)Length;
+    return E_NOT_OK;    /* CVC reads its pedal sensors asynchronously only */
+}
+
+Std_ReturnType Spi_Hw_AsyncTransmit(uint8 Channel, const uint16* TxBuf,
+                                    uint16* RxBuf, uint8 Length)
+{
+    (void)TxBuf;
+    (void)Length;
+    mock_spi_rx      = RxBuf;
+    mock_spi_channel = Channel;
+    mock_spi_pending = TRUE;
+    return E_OK;
+}
+
+/** End the running transfer (and the jobs it chains), like Spi_Posix_Poll */
+static void mock_spi_poll(void)
+{
+    while (mock_spi_pending == TRUE) {
+        mock_spi_pending = FALSE;
+        mock_spi_rx[0] = (mock_spi_channel == 0u) ? PEDAL_0_ANGLE : PEDAL_1_ANGLE;
+        Spi_Isr((mock_spi_fail == TRUE) ? E_NOT_OK : E_OK);
+    }
+}
+
+/* ====================================================================
+ * Mock: Dio / Adc / Pwm — not used by the pedal path
+ * ==================================================================== */
+
+void Dio_WriteChannel(uint8 ChannelId, uint8 Level)
+{
+    (void)ChannelId;
+    (void)Level;
+}
+
+uint8 Dio_ReadChannel(uint8 ChannelId)
+{
+    (void)ChannelId;
+    return STD_LOW;
+}
+
+Std_ReturnType Adc_StartGroupConversion(uint8 Group)
+{
+    (void)Group;
+    return E_OK;
+}
+
+Std_ReturnType Adc_ReadGroup(uint8 Group, uint16* DataBufferPtr)
+{
+    (void)Group;
+    (void)DataBufferPtr;
+    return E_NOT_OK;
+}
+
+void Pwm_SetDutyCycle(uint8 ChannelNumber, uint16 DutyCycle)
+{
+    (void)ChannelNumber;
+    (void)DutyCycle;
+}
+
+void Pwm_SetOutputToIdle(uint8 ChannelNumber)
+{
+    (void)ChannelNumber;
+}
+
+/* Stubs: WdgM alive indications of the dispatched runnables */
+Std_ReturnType WdgM_CheckpointReached(WdgM_SupervisedEntityIdType SEId)
+{
+    (void)SEId;
+    return E_OK;
+}
+
+Std_ReturnType WdgM_SetEntityActive(WdgM_SupervisedEntityIdType SEId, boolean Active)
+{
+    (void)SEId;
+    (void)Active;
+    return E_OK;
+}
+
+/* ====================================================================
+ * Time base for the angle max age (1 ms per Rte tick)
+ * ==================================================================== */
+
+static uint32 sim_time_us;
+
+static uint32 sim_get_time_us(void)
+{
+    return sim_time_us;
+}
+
+/* ====================================================================
+ * CVC runnables — stubs, the pedal runnable probes IoHwAb
+ * ==================================================================== */
+
+static uint32          pedal_cycles;
+static Std_ReturnType  pedal_first_result[2];
+static uint16          pedal_first_angle[2];
+static uint32          pedal_failed_reads;
+
+void Swc_Pedal_MainFunction(void)
+{
+    uint16 angle = 0u;
+    uint8  s;
+
+    for (s = 0u; s < 2u; s++) {
+        Std_ReturnType ret = IoHwAb_ReadPedalAngle(s, &angle);
+        if (pedal_cycles == 0u) {
+            pedal_first_result[s] = ret;
+            pedal_first_angle[s]  = angle;
+        }
+        if (ret != E_OK) {
+            pedal_failed_reads++;
+        }
+    }
+    pedal_cycles++;
+}
+
+void Swc_VehicleState_MainFunction(void) { }
+void Swc_EStop_MainFunction(void)        { }
+void Swc_Heartbeat_MainFunction(void)    { }
+void Swc_Dashboard_MainFunction(void)    { }
+void Com_MainFunction_Tx(void)           { }
+void Com_MainFunction_Rx(void)           { }
+void Can_MainFunction_Read(void)         { }
+void Can_MainFunction_BusOff(void)       { }
+
+/* ====================================================================
+ * Configuration — CVC pedal sensors (as in cvc/src/main.c)
+ * ==================================================================== */
+
+static const Spi_JobConfigType spi_jobs[] = {
+    { .channel = 0u, .csChannel = 0u },  /* Job 0: pedal sensor 0 */
+    { .channel = 2u, .csChannel = 1u },  /* Job 1: pedal sensor 1 */
+};
+
+static const uint8 spi_seq_pedal_jobs[] = { 0u, 1u };
+
+static const Spi_SequenceConfigType spi_sequences[] = {
+    { .jobs = spi_seq_pedal_jobs, .numJobs = 2u,
+      .notification = IoHwAb_AngleReadNotification },
+};
+
+static const Spi_ConfigType spi_config = {
+    .clockSpeed   = 1000000u,
+    .cpol         = 0u,
+    .cpha         = 1u,
+    .dataWidth    = 16u,
+    .numChannels  = 3u,
+    .jobs         = spi_jobs,
+    .numJobs      = 2u,
+    .sequences    = spi_sequences,
+    .numSequences = 1u,
+};
+
+static const IoHwAb_ConfigType iohwab_config = {
+    .PedalSpiChannel     = 0u,
+    .PedalCsChannel0     = 0u,
+    .PedalCsChannel1     = 1u,
+    .PedalSpiSequence    = 0u,
+    .SteeringSpiChannel  = 1u,
+    .SteeringCsChannel   = 2u,
+    .SteeringSpiSequence = 1u,
+    .MotorCurrentAdcGroup = 0u,
+    .MotorTempAdcGroup    = 1u,
+    .BatteryVoltAdcGroup  = 2u,
+    .MotorPwmChannel      = 0u,
+    .SteeringServoPwmCh   = 1u,
+    .BrakeServoPwmCh      = 2u,
+    .MotorDirAChannel     = 3u,
+    .MotorDirBChannel     = 4u,
+    .EStopDioChannel      = 5u,
+    .AngleAsyncSensors    = IOHWAB_ANGLE_PEDAL_0 | IOHWAB_ANGLE_PEDAL_1,
+    .AngleSpiSequence     = 0u,
+    .PedalSpiChannel1     = 2u,
+    .AngleMaxAgeUs        = 15000u,
+    .GetTimestampUs       = sim_get_time_us,
+};
+
+/* ====================================================================
+ * Helpers
+ * ==================================================================== */
+
+/** One 1 ms main loop iteration: Rte tick, then the SPI poll of the Wfi */
+static void run_tick(void)
+{
+    sim_time_us += 1000u;
+    Rte_MainFunction();
+    mock_spi_poll();
+}
+
+static void run_until_first_pedal_cycle(void)
+{
+    uint32 t;
+
+    for (t = 0u; (t < 20u) && (pedal_cycles == 0u); t++) {
+        run_tick();
+    }
+}
+
+/* ====================================================================
+ * setUp / tearDown
+ * ==================================================================== */
+
+void setUp(void)
+{
+    mock_spi_rx      = NULL_PTR;
+    mock_spi_channel = 0u;
+    mock_spi_pending = FALSE;
+    mock_spi_fail    = FALSE;
+    sim_time_us      = 0u;
+
+    pedal_cycles          = 0u;
+    pedal_first_result[0] = E_NOT_OK;
+    pedal_first_result[1] = E_NOT_OK;
+    pedal_first_angle[0]  = 0u;
+    pedal_first_angle[1]  = 0u;
+    pedal_failed_reads    = 0u;
+
+    Spi_Init(&spi_config);
+    IoHwAb_Init(&iohwab_config);
+    Rte_Init(&cvc_rte_config);
+}
+
+void tearDown(void) { }
+
+/* ====================================================================
+ * INT-016: First pedal cycle after boot reads a valid cached angle
+ * ==================================================================== */
+
+/** @verifies SWR-BSW-014 */
+void test_int_first_pedal_cycle_sees_cached_angle(void)
+{
+    run_until_first_pedal_cycle();
+
+    TEST_ASSERT_EQUAL_UINT32(1u, pedal_cycles);
+    TEST_ASSERT_EQUAL(E_OK, pedal_first_result[0]);
+    TEST_ASSERT_EQUAL(E_OK, pedal_first_result[1]);
+    TEST_ASSERT_EQUAL_HEX16(PEDAL_0_ANGLE & 0x3FFFu, pedal_first_angle[0]);
+    TEST_ASSERT_EQUAL_HEX16(PEDAL_1_ANGLE & 0x3FFFu, pedal_first_angle[1]);
+}
+
+/** @verifies SWR-BSW-014, SWR-BSW-026 */
+void test_int_every_pedal_cycle_sees_fresh_angle(void)
+{
+    uint32 t;
+
+    for (t = 0u; t < 1000u; t++) {
+        run_tick();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(100u, pedal_cycles);
+    TEST_ASSERT_EQUAL_UINT32(0u, pedal_failed_reads);
+}
+
+/** @verifies SWR-BSW-006 */
+void test_int_failed_transfer_leaves_cache_empty(void)
+{
+    mock_spi_fail = TRUE;
+
+    run_until_first_pedal_cycle();
+
+    TEST_ASSERT_EQUAL_UINT32(1u, pedal_cycles);
+    TEST_ASSERT_EQUAL(E_NOT_OK, pedal_first_result[0]);
+    TEST_ASSERT_EQUAL(E_NOT_OK, pedal_first_result[1]);
+}
+
+/* ====================================================================
+ * Test runner
+ * ==================================================================== */
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_int_first_pedal_cycle_sees_cached_angle);
+    RUN_TEST(test_int_every_pedal_cycle_sees_fresh_angle);
+    RUN_TEST(test_int_failed_transfer_leaves_cache_empty);
+
+    return UNITY_END();
+}
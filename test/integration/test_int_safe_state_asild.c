@@ -138,7 +138,7 @@ static const Rte_SignalConfigType sig_config[] = {
 
 /** RTE runnable configuration: safety runnable at highest priority */
 static const Rte_RunnableConfigType run_config[] = {
-    { SafetyRunnable, 1u, 10u, 0u }  /* period=1ms, priority=10, SE=0 */
+    { SafetyRunnable, 1u, 10u, 0u, 0u }  /* period=1ms, priority=10, SE=0 */
 };
 
 static Rte_ConfigType rte_config;
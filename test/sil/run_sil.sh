@@ -12,6 +12,8 @@
 #   ./run_sil.sh --scenario=overcurrent  Run a single scenario
 #   ./run_sil.sh --keep               Keep containers running after tests
 #   ./run_sil.sh --timeout=120        Override default scenario timeout (sec)
+#   ./run_sil.sh --lockstep           Deterministic lockstep virtual time
+#                                     (docker-compose.lockstep.yml)
 #
 # Exit codes:
 #   0 — All verdicts PASS
@@ -42,6 +44,7 @@ header(){ echo -e "\n${BOLD}=== $* ===${NC}"; }
 SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
 REPO_ROOT="$(cd "$SCRIPT_DIR/../.." && pwd)"
 COMPOSE_FILE="$REPO_ROOT/docker/docker-compose.yml"
+LOCKSTEP_FILE="$REPO_ROOT/docker/docker-compose.lockstep.yml"
 SCENARIOS_DIR="$SCRIPT_DIR/scenarios"
 RESULTS_DIR="$SCRIPT_DIR/results"
 VERDICT_CHECKER="$SCRIPT_DIR/verdict_checker.py"
@@ -63,6 +66,7 @@ HEALTH_POLL_INTERVAL=3  # Seconds between health checks
 FAULT_API_URL="http://localhost:8091"
 MQTT_PORT=1883
 SIL_SCALE="${SIL_TIME_SCALE:-1}"
+LOCKSTEP=false
 
 # ---------------------------------------------------------------------------
 # Parse command-line arguments
@@ -81,6 +85,9 @@ for arg in "$@"; do
         --timeout=*)
             DEFAULT_TIMEOUT="${arg#*=}"
             ;;
+        --lockstep)
+            LOCKSTEP=true
+            ;;
         --help|-h)
             echo "Usage: $0 [OPTIONS]"
             echo ""
@@ -88,6 +95,8 @@ for arg in "$@"; do
             echo "  --scenario=NAME   Run a single scenario YAML file by name"
             echo "  --keep            Keep Docker containers running after tests"
             echo "  --timeout=N       Override default per-scenario timeout (seconds)"
+            echo "  --lockstep        Run on the lockstep SIL time master (virtual time,"
+            echo "                    reproducible, as fast as the host allows)"
             echo "  --help, -h        Show this help message"
             echo ""
             echo "Scenarios are YAML files in: $SCENARIOS_DIR/"
@@ -102,6 +111,15 @@ for arg in "$@"; do
     esac
 done
 
+# Compose files: lockstep adds the time master and its participants
+COMPOSE_ARGS=(-f "$COMPOSE_FILE")
+if [ "$LOCKSTEP" = true ]; then
+    COMPOSE_ARGS+=(-f "$LOCKSTEP_FILE")
+    # The verdict checker waits on the master's virtual clock
+    export SIL_TIME_MASTER=taktflow_sil_time
+    SIL_SCALE=1
+fi
+
 # ---------------------------------------------------------------------------
 # Prerequisite checks
 # ---------------------------------------------------------------------------
@@ -212,8 +230,8 @@ info "Results will be saved to: $RUN_RESULTS_DIR"
 # ---------------------------------------------------------------------------
 header "Starting SIL Platform"
 
-info "Bringing up Docker services from $COMPOSE_FILE"
-docker compose -f "$COMPOSE_FILE" up --build -d 2>&1 | tee "$RUN_RESULTS_DIR/docker_startup.log"
+info "Bringing up Docker services from ${COMPOSE_ARGS[*]}"
+docker compose "${COMPOSE_ARGS[@]}" up --build -d 2>&1 | tee "$RUN_RESULTS_DIR/docker_startup.log"
 
 if [ $? -ne 0 ]; then
     fail "Docker compose up failed. Check $RUN_RESULTS_DIR/docker_startup.log"
@@ -278,10 +296,10 @@ fi
 if [ "$HEALTH_OK" = false ]; then
     fail "One or more services failed health checks"
     info "Saving container logs before exit..."
-    docker compose -f "$COMPOSE_FILE" logs --no-color > "$RUN_RESULTS_DIR/docker_logs.txt" 2>&1
+    docker compose "${COMPOSE_ARGS[@]}" logs --no-color > "$RUN_RESULTS_DIR/docker_logs.txt" 2>&1
     if [ "$KEEP_CONTAINERS" = false ]; then
         info "Tearing down containers..."
-        docker compose -f "$COMPOSE_FILE" down 2>/dev/null
+        docker compose "${COMPOSE_ARGS[@]}" down 2>/dev/null
     fi
     exit 1
 fi
@@ -325,12 +343,12 @@ echo ""
 header "Collecting Logs"
 
 info "Saving Docker container logs..."
-docker compose -f "$COMPOSE_FILE" logs --no-color > "$RUN_RESULTS_DIR/docker_logs.txt" 2>&1
+docker compose "${COMPOSE_ARGS[@]}" logs --no-color > "$RUN_RESULTS_DIR/docker_logs.txt" 2>&1
 ok "Container logs saved to $RUN_RESULTS_DIR/docker_logs.txt"
 
 # Save individual container logs
-for container in cvc fzc rzc sc bcm icu tcu plant-sim can-gateway fault-inject mqtt-broker; do
-    docker compose -f "$COMPOSE_FILE" logs --no-color "$container" \
+for container in cvc fzc rzc sc bcm icu tcu plant-sim can-gateway fault-inject mqtt-broker sil-time-master; do
+    docker compose "${COMPOSE_ARGS[@]}" logs --no-color "$container" \
         > "$RUN_RESULTS_DIR/${container}.log" 2>/dev/null || true
 done
 ok "Individual container logs saved"
@@ -340,10 +358,10 @@ ok "Individual container logs saved"
 # ---------------------------------------------------------------------------
 if [ "$KEEP_CONTAINERS" = true ]; then
     warn "Containers kept running (--keep flag). Tear down manually:"
-    warn "  docker compose -f $COMPOSE_FILE down"
+    warn "  docker compose ${COMPOSE_ARGS[*]} down"
 else
     header "Tearing Down SIL Platform"
-    docker compose -f "$COMPOSE_FILE" down 2>&1 | tee -a "$RUN_RESULTS_DIR/docker_teardown.log"
+    docker compose "${COMPOSE_ARGS[@]}" down 2>&1 | tee -a "$RUN_RESULTS_DIR/docker_teardown.log"
     ok "All containers stopped and removed"
 fi
 
@@ -27,7 +27,9 @@ from __future__ import annotations
 import argparse
 import json
 import logging
+import mmap
 import os
+import struct
 import subprocess
 import sys
 import threading
@@ -104,6 +106,56 @@ DEFAULT_CAN_CHANNEL = "vcan0"
 # SIL time acceleration — scale all wall-clock waits and timeouts
 _SIL_SCALE = max(1, min(100, int(os.environ.get("SIL_TIME_SCALE", "1"))))
 
+# Lockstep SIL (SIL_TIME_MASTER = time master segment name): every wait,
+# timeout and timestamp below follows the master's virtual clock instead of
+# the wall clock, and SIL_TIME_SCALE does not apply.
+_SIL_MASTER = os.environ.get("SIL_TIME_MASTER", "")
+if _SIL_MASTER:
+    _SIL_SCALE = 1
+
+
+class _SilMasterClock:
+    """Read-only view of the time master's clock (firmware Sil_TimeShm.h)."""
+
+    _OFF_NOW_US = 16
+    _OFF_RUNNING = 28
+
+    def __init__(self, name: str) -> None:
+        self._name = name
+        self._mm: Optional[mmap.mmap] = None
+
+    def now(self) -> float:
+        if self._mm is None:
+            with open("/dev/shm/" + self._name, "rb") as f:
+                self._mm = mmap.mmap(f.fileno(), 40, access=mmap.ACCESS_READ)
+        return struct.unpack_from("<Q", self._mm, self._OFF_NOW_US)[0] / 1e6
+
+    def running(self) -> bool:
+        return (self._mm is not None and
+                struct.unpack_from("<I", self._mm, self._OFF_RUNNING)[0] != 0)
+
+
+_SIL_CLOCK = _SilMasterClock(_SIL_MASTER) if _SIL_MASTER else None
+
+
+def _sil_now() -> float:
+    """Scenario clock in seconds: wall clock, or lockstep virtual time."""
+    if _SIL_CLOCK is not None:
+        return _SIL_CLOCK.now()
+    return _sil_now()
+
+
+def _sil_sleep(seconds: float) -> None:
+    """Let seconds of scenario time pass (see _sil_now)."""
+    if _SIL_CLOCK is None:
+        time.sleep(seconds)
+        return
+    end = _SIL_CLOCK.now() + seconds
+    while _SIL_CLOCK.now() < end:
+        if not _SIL_CLOCK.running():
+            raise RuntimeError("SIL time master ended the run")
+        time.sleep(0.001)
+
 # Default timeouts (virtual seconds — divided by SIL_TIME_SCALE for wall clock)
 DEFAULT_SCENARIO_TIMEOUT_SEC = 60
 DEFAULT_STATE_WAIT_TIMEOUT_SEC = 10
@@ -260,8 +312,8 @@ class CANBusMonitor:
         Returns:
             True if target state was reached, False on timeout.
         """
-        deadline = time.monotonic() + timeout_sec
-        while time.monotonic() < deadline:
+        deadline = _sil_now() + timeout_sec
+        while _sil_now() < deadline:
             if self.vehicle_state == target_state:
                 return True
             # Also check state transition history (catches transient states)
@@ -289,8 +341,8 @@ class CANBusMonitor:
         with self._lock:
             initial_count = len(self._message_history.get(can_id, []))
 
-        deadline = time.monotonic() + timeout_sec
-        while time.monotonic() < deadline:
+        deadline = _sil_now() + timeout_sec
+        while _sil_now() < deadline:
             with self._lock:
                 history = self._message_history.get(can_id, [])
                 if len(history) > initial_count:
@@ -307,8 +359,8 @@ class CANBusMonitor:
         Returns:
             True if RPM reached 0, False on timeout.
         """
-        deadline = time.monotonic() + timeout_sec
-        while time.monotonic() < deadline:
+        deadline = _sil_now() + timeout_sec
+        while _sil_now() < deadline:
             if self.motor_rpm == 0:
                 return True
             time.sleep(0.05)
@@ -325,7 +377,7 @@ class CANBusMonitor:
             if msg is None:
                 continue
 
-            ts = time.monotonic()
+            ts = _sil_now()
             arb_id = msg.arbitration_id
 
             with self._lock:
@@ -432,8 +484,8 @@ class MQTTMonitor:
         Returns:
             Parsed JSON dict or None on timeout.
         """
-        deadline = time.monotonic() + timeout_sec
-        while time.monotonic() < deadline:
+        deadline = _sil_now() + timeout_sec
+        while _sil_now() < deadline:
             with self._lock:
                 entry = self._messages.get(topic)
                 if entry is not None:
@@ -475,7 +527,7 @@ class MQTTMonitor:
             payload = {"raw": msg.payload.hex()}
 
         with self._lock:
-            self._messages[msg.topic] = (time.monotonic(), payload)
+            self._messages[msg.topic] = (_sil_now(), payload)
 
 
 # ---------------------------------------------------------------------------
@@ -649,7 +701,7 @@ class ScenarioExecutor:
         self._can.wait_for_can_message(0x100, timeout_sec=3.0)
 
         # Record the observation start time
-        observation_start = time.monotonic()
+        observation_start = _sil_now()
 
         # Execute scenario steps
         try:
@@ -763,7 +815,7 @@ class ScenarioExecutor:
             wall_sec = seconds / _SIL_SCALE
             log.info("  [STEP] Waiting %.1fs virtual (%.1fs wall)...",
                      seconds, wall_sec)
-            time.sleep(wall_sec)
+            _sil_sleep(wall_sec)
 
         elif action == "wait_state":
             state_name = step.get("state", "RUN")
@@ -1232,7 +1284,7 @@ class ScenarioExecutor:
                 expected="N/A",
                 observed="N/A",
                 passed=False,
-                timestamp=time.monotonic(),
+                timestamp=_sil_now(),
                 details=f"Verdict type '{vtype}' is not supported",
             )
 
@@ -1269,7 +1321,7 @@ class ScenarioExecutor:
             expected=expected_name,
             observed=current_name,
             passed=passed,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
             details=(
                 f"Transitions observed: "
                 f"{[_state_name(s) for _, s in transitions]}"
@@ -1317,7 +1369,7 @@ class ScenarioExecutor:
                 expected=f"CAN 0x{can_id:03X} within {within_ms:.0f}ms",
                 observed="No message received",
                 passed=False,
-                timestamp=time.monotonic(),
+                timestamp=_sil_now(),
             )
 
         ts, msg = result
@@ -1359,7 +1411,7 @@ class ScenarioExecutor:
             expected=f"CAN 0x{can_id:03X} with matching fields",
             observed=f"CAN 0x{can_id:03X} data={data.hex()}",
             passed=all_checks_pass,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
             details="; ".join(check_details),
         )
 
@@ -1381,7 +1433,7 @@ class ScenarioExecutor:
             expected="RPM = 0",
             observed=f"RPM = {current_rpm}",
             passed=reached_zero,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
             details=f"Waited up to {within_ms:.0f}ms for motor shutdown",
         )
 
@@ -1406,7 +1458,7 @@ class ScenarioExecutor:
                 expected=f"{field_name}={expected_raw}",
                 observed="No MQTT message received",
                 passed=False,
-                timestamp=time.monotonic(),
+                timestamp=_sil_now(),
             )
 
         # Navigate nested fields (e.g., "motor.overcurrent")
@@ -1435,7 +1487,7 @@ class ScenarioExecutor:
             expected=f"{field_name}={expected_raw}",
             observed=f"{field_name}={actual}",
             passed=passed,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
             details=f"Topic: {topic}, Full message keys: {list(msg.keys()) if isinstance(msg, dict) else 'N/A'}",
         )
 
@@ -1501,7 +1553,7 @@ class ScenarioExecutor:
                             f"source={source}"
                         ),
                         passed=True,
-                        timestamp=time.monotonic(),
+                        timestamp=_sil_now(),
                         details=f"Found in {len(history)} DTC messages",
                     )
 
@@ -1518,7 +1570,7 @@ class ScenarioExecutor:
             expected=f"DTC=0x{expected_dtc:06X}",
             observed=f"DTCs seen: {dtcs_seen}" if dtcs_seen else "No DTC messages",
             passed=False,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
             details=f"Searched {len(history)} DTC frames on 0x{can_id:03X}",
         )
 
@@ -1544,7 +1596,7 @@ class ScenarioExecutor:
         initial_count = len(initial_history)
 
         # Wait the specified period
-        time.sleep(wait_sec)
+        _sil_sleep(wait_sec)
 
         # Check if any NEW messages arrived
         current_history = self._can.get_message_history(can_id)
@@ -1559,7 +1611,7 @@ class ScenarioExecutor:
             expected=f"0 new messages on 0x{can_id:03X} in {within_ms:.0f}ms",
             observed=f"{new_count} new messages on 0x{can_id:03X}",
             passed=passed,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
             details=(
                 f"Initial count={initial_count}, "
                 f"after wait={len(current_history)}"
@@ -1579,7 +1631,7 @@ class ScenarioExecutor:
         """
         rpm_before = self._can.motor_rpm
         wait_sec = within_ms / 1000.0 / _SIL_SCALE
-        time.sleep(wait_sec)
+        _sil_sleep(wait_sec)
         rpm_after = self._can.motor_rpm
 
         # Allow small jitter (1 RPM) from physics simulation noise
@@ -1591,7 +1643,7 @@ class ScenarioExecutor:
             expected=f"RPM change <= {tolerance}",
             observed=f"RPM: {rpm_before} -> {rpm_after} (delta={abs(rpm_after - rpm_before)})",
             passed=passed,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
         )
 
     def _verdict_motor_tracking(
@@ -1626,9 +1678,9 @@ class ScenarioExecutor:
 
         # Fall back to live polling
         wait_sec = within_ms / 1000.0 / _SIL_SCALE
-        deadline = time.monotonic() + wait_sec
+        deadline = _sil_now() + wait_sec
 
-        while time.monotonic() < deadline:
+        while _sil_now() < deadline:
             rpm = self._can.motor_rpm
             if rpm > 0:
                 return VerdictEvidence(
@@ -1636,7 +1688,7 @@ class ScenarioExecutor:
                     expected="RPM > 0",
                     observed=f"RPM = {rpm}",
                     passed=True,
-                    timestamp=time.monotonic(),
+                    timestamp=_sil_now(),
                 )
             time.sleep(0.05)
 
@@ -1645,7 +1697,7 @@ class ScenarioExecutor:
             expected="RPM > 0",
             observed=f"RPM = {self._can.motor_rpm}",
             passed=False,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
             details=f"Motor did not show non-zero RPM within {within_ms:.0f}ms",
         )
 
@@ -1673,7 +1725,7 @@ class ScenarioExecutor:
                 expected=f"{field_name} >= {min_errors}",
                 observed="No MQTT message received",
                 passed=False,
-                timestamp=time.monotonic(),
+                timestamp=_sil_now(),
                 details=f"Topic: {topic}",
             )
 
@@ -1685,7 +1737,7 @@ class ScenarioExecutor:
             expected=f"{field_name} >= {min_errors}",
             observed=f"{field_name} = {actual}",
             passed=passed,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
             details=f"Topic: {topic}",
         )
 
@@ -1711,7 +1763,7 @@ class ScenarioExecutor:
                 expected="Steering fault flag set",
                 observed="No Steering_Status message",
                 passed=False,
-                timestamp=time.monotonic(),
+                timestamp=_sil_now(),
             )
 
         _, msg = result
@@ -1725,7 +1777,7 @@ class ScenarioExecutor:
             expected="Steering fault flag != 0",
             observed=f"Fault byte = 0x{fault_byte:02X}",
             passed=has_fault,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
             details=f"Steering_Status data: {msg.data.hex()}",
         )
 
@@ -1741,7 +1793,7 @@ class ScenarioExecutor:
         DTC_Status == 0x01 (active). If none found, the verdict passes.
         """
         wait_sec = within_ms / 1000.0 / _SIL_SCALE
-        time.sleep(min(wait_sec, 1.0))  # Brief observation window
+        _sil_sleep(min(wait_sec, 1.0))  # Brief observation window
 
         history = self._can.get_message_history(CAN_DTC_BROADCAST)
         active_dtcs: list[str] = []
@@ -1759,7 +1811,7 @@ class ScenarioExecutor:
             expected="0 active DTCs",
             observed=f"{len(active_dtcs)} active DTCs: {active_dtcs}",
             passed=passed,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
             details=f"Checked {len(history)} DTC frames",
         )
 
@@ -1779,7 +1831,7 @@ class ScenarioExecutor:
         wait_sec = within_ms / 1000.0 / _SIL_SCALE
 
         # Wait for any DTC messages
-        time.sleep(min(wait_sec, 2.0))
+        _sil_sleep(min(wait_sec, 2.0))
         history = self._can.get_message_history(CAN_DTC_BROADCAST)
 
         for _, msg in history:
@@ -1792,7 +1844,7 @@ class ScenarioExecutor:
                         expected=f"DTC 0x{expected_dtc:06X} in history",
                         observed=f"Found DTC 0x{dtc_num:06X}",
                         passed=True,
-                        timestamp=time.monotonic(),
+                        timestamp=_sil_now(),
                     )
 
         return VerdictEvidence(
@@ -1801,7 +1853,7 @@ class ScenarioExecutor:
             expected=f"DTC 0x{expected_dtc:06X} in history",
             observed=f"Not found in {len(history)} DTC messages",
             passed=False,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
         )
 
     def _verdict_fault_priority(
@@ -1834,7 +1886,7 @@ class ScenarioExecutor:
             expected=f"State >= {expected_name} ({expected_val})",
             observed=f"State = {current_name} ({current_state})",
             passed=passed,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
             details=(
                 f"Transitions: "
                 f"{[_state_name(s) for _, s in self._can.state_transitions]}"
@@ -1854,7 +1906,7 @@ class ScenarioExecutor:
         maximum observed RPM in the history.
         """
         wait_sec = within_ms / 1000.0 / _SIL_SCALE
-        time.sleep(min(wait_sec, 2.0))
+        _sil_sleep(min(wait_sec, 2.0))
 
         history = self._can.get_message_history(CAN_MOTOR_STATUS)
         if not history:
@@ -1863,7 +1915,7 @@ class ScenarioExecutor:
                 expected="RPM decreased (derating)",
                 observed="No Motor_Status messages",
                 passed=False,
-                timestamp=time.monotonic(),
+                timestamp=_sil_now(),
             )
 
         # Extract RPM values from history
@@ -1882,7 +1934,7 @@ class ScenarioExecutor:
                 expected="RPM decreased (derating)",
                 observed="No valid RPM data",
                 passed=False,
-                timestamp=time.monotonic(),
+                timestamp=_sil_now(),
             )
 
         max_rpm = max(rpms)
@@ -1895,7 +1947,7 @@ class ScenarioExecutor:
             expected=f"Current RPM < peak RPM (derating)",
             observed=f"Peak RPM={max_rpm}, current RPM={current_rpm}",
             passed=passed,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
             details=f"RPM samples: {len(rpms)}, range: {min(rpms)}-{max_rpm}",
         )
 
@@ -1914,7 +1966,7 @@ class ScenarioExecutor:
         wait_sec = within_ms / 1000.0 / _SIL_SCALE
 
         # Wait the observation period
-        time.sleep(wait_sec)
+        _sil_sleep(wait_sec)
 
         # Check if the message was seen
         seen = self._can.has_seen_can_id(can_id)
@@ -1929,7 +1981,7 @@ class ScenarioExecutor:
                 else f"CAN 0x{can_id:03X} correctly absent"
             ),
             passed=not seen,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
         )
 
     def _verdict_alive_counter_wrap(
@@ -1987,7 +2039,7 @@ class ScenarioExecutor:
             expected=f">= {expected_wraps_min} wraps per CAN ID",
             observed="; ".join(results),
             passed=all_passed,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
         )
 
     def _verdict_all_heartbeats_active(
@@ -2005,7 +2057,7 @@ class ScenarioExecutor:
         wait_sec = within_ms / 1000.0 / _SIL_SCALE
 
         # Wait briefly to collect messages
-        time.sleep(min(wait_sec, 1.0))
+        _sil_sleep(min(wait_sec, 1.0))
 
         results: list[str] = []
         all_active = True
@@ -2024,7 +2076,7 @@ class ScenarioExecutor:
             expected=f"All {len(can_ids)} heartbeats present",
             observed="; ".join(results),
             passed=all_active,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
         )
 
     def _verdict_battery_soc_monotonic(
@@ -2048,7 +2100,7 @@ class ScenarioExecutor:
                 expected=f"SOC monotonically {direction}",
                 observed="No Battery_Status messages",
                 passed=False,
-                timestamp=time.monotonic(),
+                timestamp=_sil_now(),
             )
 
         # Extract SOC values from Battery_Status (0x303).
@@ -2067,7 +2119,7 @@ class ScenarioExecutor:
                 expected=f"SOC monotonically {direction}",
                 observed=f"Only {len(soc_values)} SOC sample(s)",
                 passed=False,
-                timestamp=time.monotonic(),
+                timestamp=_sil_now(),
             )
 
         # Check monotonicity
@@ -2090,7 +2142,7 @@ class ScenarioExecutor:
                 f"{violations} violations in {len(soc_values)} samples"
             ),
             passed=passed,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
         )
 
     def _verdict_can_timing_jitter(
@@ -2148,7 +2200,7 @@ class ScenarioExecutor:
             expected=f"Jitter <= {max_jitter_ms}ms from {nominal_ms}ms nominal",
             observed="; ".join(results),
             passed=all_passed,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
         )
 
     def _verdict_motor_temp_stable(
@@ -2173,7 +2225,7 @@ class ScenarioExecutor:
                 expected=f"Temp < {max_temp_c}C",
                 observed="No Motor_Temp messages",
                 passed=False,
-                timestamp=time.monotonic(),
+                timestamp=_sil_now(),
             )
 
         # Extract temperature values (bytes 2-3, 16-bit LE, scale 0.1C)
@@ -2190,7 +2242,7 @@ class ScenarioExecutor:
                 expected=f"Temp < {max_temp_c}C",
                 observed="No valid temperature data",
                 passed=False,
-                timestamp=time.monotonic(),
+                timestamp=_sil_now(),
             )
 
         peak_temp = max(temps)
@@ -2201,7 +2253,7 @@ class ScenarioExecutor:
             expected=f"Temp < {max_temp_c}C",
             observed=f"Peak={peak_temp:.1f}C, latest={temps[-1]:.1f}C",
             passed=passed,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
             details=f"{len(temps)} samples, range: {min(temps):.1f}-{peak_temp:.1f}C",
         )
 
@@ -2253,7 +2305,7 @@ class ScenarioExecutor:
             expected=f"Max consecutive identical <= {max_identical}",
             observed="; ".join(results),
             passed=all_passed,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
         )
 
     def _verdict_mqtt_payload_field(
@@ -2282,7 +2334,7 @@ class ScenarioExecutor:
                 expected=f"{field_name} {operator} {expected_raw}",
                 observed="No MQTT message received",
                 passed=False,
-                timestamp=time.monotonic(),
+                timestamp=_sil_now(),
                 details=f"Topic: {topic}",
             )
 
@@ -2332,7 +2384,7 @@ class ScenarioExecutor:
             expected=f"{field_name} {operator} {expected_raw}",
             observed=f"{field_name} = {actual}",
             passed=passed,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
             details=f"Topic: {topic}",
         )
 
@@ -2398,7 +2450,7 @@ class ScenarioExecutor:
                 ),
                 observed=observed,
                 passed=passed,
-                timestamp=time.monotonic(),
+                timestamp=_sil_now(),
             )
         except requests.RequestException as exc:
             return VerdictEvidence(
@@ -2407,7 +2459,7 @@ class ScenarioExecutor:
                 expected=f"HTTP {expected_status}",
                 observed=f"Request failed: {exc}",
                 passed=False,
-                timestamp=time.monotonic(),
+                timestamp=_sil_now(),
             )
 
     def _verdict_file_exists(
@@ -2439,7 +2491,7 @@ class ScenarioExecutor:
             expected=f"File at {file_path}",
             observed=observed,
             passed=found,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
         )
 
     def _verdict_analysis_result(
@@ -2467,7 +2519,7 @@ class ScenarioExecutor:
                 expected=f"exit_code={expected_exit}",
                 observed=f"No result for tool '{tool}'",
                 passed=False,
-                timestamp=time.monotonic(),
+                timestamp=_sil_now(),
                 details="Step action may not have been executed",
             )
 
@@ -2496,7 +2548,7 @@ class ScenarioExecutor:
             ),
             observed=f"exit_code={exit_code}, output_len={len(output)}",
             passed=passed,
-            timestamp=time.monotonic(),
+            timestamp=_sil_now(),
             details=output[:500] if not passed else "",
         )
 
@@ -2775,7 +2827,7 @@ def main() -> int:
     mqtt_monitor.start()
 
     # Brief pause for monitors to connect
-    time.sleep(1.0 / _SIL_SCALE)
+    _sil_sleep(1.0 / _SIL_SCALE)
 
     executor = ScenarioExecutor(
         can_monitor=can_monitor,
@@ -0,0 +1 @@
+"""CAN timing analysis — worst-case response times and bus load of the CAN matrix."""
@@ -0,0 +1,7 @@
+"""Entry point: python -m tools.can_timing --dbc gateway/taktflow.dbc ..."""
+import sys
+
+from tools.can_timing.cli import main
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,186 @@
+"""CLI: load the message set, run the response time analysis, report.
+
+Exit status: 0 all deadlines met, 1 a deadline is missed (or the bus is
+overloaded), 2 bad input.
+"""
+from __future__ import annotations
+
+import argparse
+import json
+import sys
+from fractions import Fraction
+from pathlib import Path
+from typing import Sequence
+
+from tools.can_timing.rta import CanMessage, Result, analyze, utilization
+from tools.can_timing.sources import DEFAULT_EVENT_INTERVAL_MS, load_dbc, load_firmware, merge
+
+
+def _build_parser() -> argparse.ArgumentParser:
+    parser = argparse.ArgumentParser(
+        prog="tools.can_timing",
+        description="Worst-case CAN response times and bus load from the DBC "
+                    "and/or the firmware CanIf/Com tables",
+    )
+    parser.add_argument("--dbc", help="DBC with GenMsgCycleTime/GenMsgSendType")
+    parser.add_argument("--firmware", help="Firmware root: reads <ecu>/src canif_tx_config[] "
+                                           "and <ecu>/cfg/Com_Cfg_*.c")
+    parser.add_argument("--bitrate", type=int, default=500_000, help="bit/s (default 500000)")
+    parser.add_argument("--event-interval-ms", type=Fraction, default=DEFAULT_EVENT_INTERVAL_MS,
+                        help="Minimum inter-arrival of event messages without a repeat "
+                             "time (default 10)")
+    parser.add_argument("--uds-interval-ms", type=Fraction, default=None,
+                        help="Minimum inter-arrival of UDS frames, e.g. 0.27 for a tester "
+                             "sending consecutive frames with STmin 0")
+    parser.add_argument("--jitter-ms", type=Fraction, default=Fraction(0),
+                        help="Queuing jitter of every message, e.g. the Com main period")
+    parser.add_argument("--period", action="append", default=[], metavar="ID=MS",
+                        help="Override period / minimum inter-arrival (repeatable)")
+    parser.add_argument("--deadline", action="append", default=[], metavar="ID=MS",
+                        help="Deadline of a message, default its period (repeatable)")
+    parser.add_argument("--jitter", action="append", default=[], metavar="ID=MS",
+                        help="Queuing jitter of a message (repeatable)")
+    parser.add_argument("--add", action="append", default=[], metavar="ID:DLC:MS[:NAME]",
+                        help="Extra load, e.g. 0x7E0:8:1:tester (repeatable)")
+    parser.add_argument("--json", action="store_true", help="Print JSON instead of a table")
+    return parser
+
+
+def main(argv: Sequence[str] | None = None) -> int:
+    parser = _build_parser()
+    args = parser.parse_args(argv)
+
+    if not args.dbc and not args.firmware:
+        parser.print_help()
+        return 2
+
+    try:
+        messages = _load(args)
+        _apply_overrides(messages, args)
+    except (OSError, ValueError) as exc:
+        print(f"ERROR: {exc}", file=sys.stderr)
+        return 2
+
+    if not messages:
+        print("ERROR: no messages found", file=sys.stderr)
+        return 2
+
+    results = analyze(messages, args.bitrate)
+    load = utilization(messages, args.bitrate)
+
+    if args.json:
+        _print_json(results, load, args.bitrate)
+    else:
+        _print_table(results, load, args.bitrate)
+
+    return 0 if all(r.ok for r in results) and load < 1 else 1
+
+
+def _load(args: argparse.Namespace) -> list[CanMessage]:
+    dbc = load_dbc(args.dbc, args.event_interval_ms, args.uds_interval_ms) if args.dbc else []
+    if not args.firmware:
+        return dbc
+    fw_dir = Path(args.firmware)
+    if not fw_dir.is_dir():
+        raise FileNotFoundError(f"firmware directory not found: {fw_dir}")
+    return merge(dbc, load_firmware(fw_dir, args.event_interval_ms, args.uds_interval_ms))
+
+
+def _apply_overrides(messages: list[CanMessage], args: argparse.Namespace) -> None:
+    for spec in args.add:
+        parts = spec.split(":")
+        if len(parts) < 3:
+            raise ValueError(f"--add {spec}: expected ID:DLC:MS[:NAME]")
+        can_id = int(parts[0], 0)
+        messages.append(CanMessage(
+            name=parts[3] if len(parts) > 3 else f"extra_{can_id:03X}",
+            can_id=can_id, dlc=int(parts[1]), period_ms=Fraction(parts[2]),
+            extended=can_id > 0x7FF, event=True, source="--add"))
+
+    for m in messages:
+        m.jitter_ms = args.jitter_ms
+
+    for option, attr in (("period", "period_ms"), ("deadline", "deadline_ms"),
+                         ("jitter", "jitter_ms")):
+        for spec in getattr(args, option):
+            key, sep, value = spec.partition("=")
+            if not sep:
+                raise ValueError(f"--{option} {spec}: expected ID=MS")
+            matched = [m for m in messages if _matches(m, key)]
+            if not matched:
+                raise ValueError(f"--{option} {spec}: no message {key}")
+            for m in matched:
+                setattr(m, attr, Fraction(value))
+
+    for m in messages:
+        if m.period_ms <= 0:
+            raise ValueError(f"{m.name} (0x{m.can_id:03X}): period must be > 0")
+
+
+def _matches(msg: CanMessage, key: str) -> bool:
+    try:
+        return msg.can_id == int(key, 0)
+    except ValueError:
+        return msg.name == key
+
+
+def _us(value: Fraction | None) -> str:
+    return "inf" if value is None else f"{float(value):.0f}"
+
+
+def _ms(value: Fraction) -> str:
+    return f"{float(value):g}"
+
+
+def _print_table(results: list[Result], load: Fraction, bitrate: int) -> None:
+    print(f"CAN {bitrate} bit/s, {len(results)} messages, worst-case stuffed frames\n")
+    print(f"{'ID':>8}  {'Message':<22} {'Tx':<5} {'ASIL':<4} {'DLC':>3} {'T ms':>7} "
+          f"{'D ms':>7} {'C us':>5} {'B us':>5} {'R us':>7}  Result")
+    for r in results:
+        m = r.msg
+        can_id = f"0x{m.can_id:08X}" if m.extended else f"0x{m.can_id:03X}"
+        kind = "e" if m.event else ""
+        print(f"{can_id:>8}  {m.name[:22]:<22} {m.sender[:5]:<5} {m.asil:<4} {m.dlc:>3} "
+              f"{_ms(m.period_ms) + kind:>7} {_ms(m.deadline):>7} {_us(r.tx_us):>5} "
+              f"{_us(r.blocking_us):>5} {_us(r.response_us):>7}  "
+              f"{'ok' if r.ok else 'DEADLINE MISS'}")
+        for note in m.notes:
+            print(f"{'':>10}note: {note}")
+
+    missed = [r for r in results if not r.ok]
+    print(f"\nBus utilization: {float(load) * 100:.1f} % (e: event, at its minimum inter-arrival)")
+    if load >= 1:
+        print("FAIL: bus overloaded")
+    if missed:
+        print(f"FAIL: {len(missed)} deadline(s) missed: "
+              + ", ".join(f"0x{r.msg.can_id:03X} {r.msg.name}" for r in missed))
+    elif load < 1:
+        print("PASS: all deadlines met")
+
+
+def _print_json(results: list[Result], load: Fraction, bitrate: int) -> None:
+    out = {
+        "bitrate": bitrate,
+        "utilization": float(load),
+        "messages": [
+            {
+                "id": r.msg.can_id,
+                "extended": r.msg.extended,
+                "name": r.msg.name,
+                "sender": r.msg.sender,
+                "asil": r.msg.asil,
+                "dlc": r.msg.dlc,
+                "event": r.msg.event,
+                "period_ms": float(r.msg.period_ms),
+                "deadline_ms": float(r.msg.deadline),
+                "jitter_ms": float(r.msg.jitter_ms),
+                "tx_us": float(r.tx_us),
+                "blocking_us": float(r.blocking_us),
+                "response_us": None if r.response_us is None else float(r.response_us),
+                "ok": r.ok,
+                "notes": r.msg.notes,
+            }
+            for r in results
+        ],
+    }
+    print(json.dumps(out, indent=2))
@@ -0,0 +1,149 @@
+"""Worst-case response time analysis of classic CAN (non-preemptive fixed priority).
+
+Follows the revised analysis of Davis, Burns, Bril and Lukkien, "Controller
+Area Network (CAN) schedulability analysis: Refuted, revisited and revised"
+(Real-Time Systems 35, 2007):
+
+    C_m    = (g + 8 s_m + 13 + floor((g + 8 s_m - 1) / 4)) * tau_bit
+             g = 34 (11-bit ID) or 54 (29-bit ID), worst-case bit stuffing
+    B_m    = max C_k over the lower priority messages k
+    t_m    = B_m + sum over hp(m) + m of ceil((t_m + J_k) / T_k) * C_k
+    Q_m    = ceil((t_m + J_m) / T_m)
+    w_m(q) = B_m + q C_m + sum over hp(m) of ceil((w_m(q) + J_k + tau_bit) / T_k) * C_k
+    R_m    = max over q < Q_m of J_m + w_m(q) - q T_m + C_m
+
+All times are exact fractions of a microsecond.
+"""
+from __future__ import annotations
+
+import math
+from dataclasses import dataclass, field
+from fractions import Fraction
+
+# Busy periods longer than this are taken as unbounded (bus overloaded)
+_BUSY_LIMIT_US = Fraction(10_000_000)
+
+
+@dataclass
+class CanMessage:
+    """One stream of frames on the bus."""
+    name: str
+    can_id: int
+    dlc: int
+    period_ms: Fraction            # period, or minimum inter-arrival if event
+    sender: str = ""
+    extended: bool = False
+    event: bool = False
+    deadline_ms: Fraction | None = None    # None: implicit (= period)
+    jitter_ms: Fraction = Fraction(0)      # queuing jitter
+    asil: str = ""
+    source: str = ""                       # where the entry came from
+    notes: list[str] = field(default_factory=list)
+
+    @property
+    def deadline(self) -> Fraction:
+        return self.period_ms if self.deadline_ms is None else self.deadline_ms
+
+
+@dataclass(frozen=True)
+class Result:
+    """Analysis outcome for one message."""
+    msg: CanMessage
+    tx_us: Fraction               # C: worst-case transmission time
+    blocking_us: Fraction         # B: longest lower priority frame
+    response_us: Fraction | None  # R: worst-case response time, None: unbounded
+    instances: int                # Q: instances in the level-m busy period
+
+    @property
+    def deadline_us(self) -> Fraction:
+        return self.msg.deadline * 1000
+
+    @property
+    def ok(self) -> bool:
+        return (self.response_us is not None) and (self.response_us <= self.deadline_us)
+
+
+def frame_bits(dlc: int, extended: bool = False) -> int:
+    """Worst-case stuffed length of a data frame in bits, incl. 3-bit interframe space."""
+    dlc = max(0, min(dlc, 8))
+    g = 54 if extended else 34
+    return g + 8 * dlc + 13 + (g + 8 * dlc - 1) // 4
+
+
+def tx_time_us(dlc: int, extended: bool, bitrate: int) -> Fraction:
+    return Fraction(frame_bits(dlc, extended) * 1_000_000, bitrate)
+
+
+def _prio(msg: CanMessage) -> tuple[int, int]:
+    """Arbitration order: 11-bit IDs compare on their 11 bits against the
+    top 11 bits of 29-bit IDs, and win a tie (SRR/IDE recessive)."""
+    if msg.extended:
+        return ((msg.can_id >> 18) & 0x7FF, 1 + (msg.can_id & 0x3FFFF))
+    return (msg.can_id & 0x7FF, 0)
+
+
+def utilization(messages: list[CanMessage], bitrate: int) -> Fraction:
+    """Worst-case bus load (stuffed frames at their shortest period)."""
+    return sum((tx_time_us(m.dlc, m.extended, bitrate) / (m.period_ms * 1000)
+                for m in messages), Fraction(0))
+
+
+def analyze(messages: list[CanMessage], bitrate: int = 500_000) -> list[Result]:
+    """Worst-case response time of every message, in priority order.
+
+    Messages with the same identifier (e.g. a broadcast any ECU may send)
+    are counted as higher priority for each other: pessimistic, and the
+    only safe choice since real CAN does not allow it.
+    """
+    tau = Fraction(1_000_000, bitrate)
+    ordered = sorted(messages, key=_prio)
+    c = {id(m): tx_time_us(m.dlc, m.extended, bitrate) for m in ordered}
+    t = {id(m): m.period_ms * 1000 for m in ordered}
+    j = {id(m): m.jitter_ms * 1000 for m in ordered}
+
+    results = []
+    for m in ordered:
+        pm = _prio(m)
+        hp = [k for k in ordered if k is not m and _prio(k) <= pm]
+        lp = [k for k in ordered if _prio(k) > pm]
+        b = max((c[id(k)] for k in lp), default=Fraction(0))
+
+        busy = _busy_period(m, hp, b, c, t, j)
+        if busy is None:
+            results.append(Result(m, c[id(m)], b, None, 0))
+            continue
+
+        q_max = math.ceil((busy + j[id(m)]) / t[id(m)])
+        worst = Fraction(0)
+        for q in range(q_max):
+            w = _queuing_delay(m, hp, b, q, c, t, j, tau)
+            if w is None:
+                worst = None
+                break
+            worst = max(worst, j[id(m)] + w - q * t[id(m)] + c[id(m)])
+        results.append(Result(m, c[id(m)], b, worst, q_max))
+    return results
+
+
+def _busy_period(m, hp, b, c, t, j) -> Fraction | None:
+    level = hp + [m]
+    busy = b + sum(c[id(k)] for k in level)
+    while True:
+        nxt = b + sum(math.ceil((busy + j[id(k)]) / t[id(k)]) * c[id(k)] for k in level)
+        if nxt == busy:
+            return busy
+        if nxt > _BUSY_LIMIT_US:
+            return None
+        busy = nxt
+
+
+def _queuing_delay(m, hp, b, q, c, t, j, tau) -> Fraction | None:
+    w = b + q * c[id(m)]
+    while True:
+        nxt = b + q * c[id(m)] + sum(
+            math.ceil((w + j[id(k)] + tau) / t[id(k)]) * c[id(k)] for k in hp)
+        if nxt == w:
+            return w
+        if nxt > _BUSY_LIMIT_US:
+            return None
+        w = nxt
@@ -0,0 +1,190 @@
+"""Message sets for the analysis: the DBC and the firmware CanIf/Com tables.
+
+The DBC reader only needs the frame list and three message attributes
+(GenMsgCycleTime, GenMsgSendType, ASIL), so it parses those lines itself
+instead of depending on cantools.
+
+The firmware reader takes per ECU the CanIf TX table in src/*.c
+(canif_tx_config[]: canId, upperPduId, dlc, hth) and the Com TX table in
+cfg/Com_Cfg_*.c (pduId, dlc, cycleMs — positional or designated), joined
+on the Com TX PDU macro. These are the values the ECUs actually run.
+"""
+from __future__ import annotations
+
+import re
+from fractions import Fraction
+from pathlib import Path
+
+from tools.can_timing.rta import CanMessage
+
+_DBC_BO = re.compile(r"^BO_\s+(\d+)\s+(\w+)\s*:\s*(\d+)\s+(\w+)", re.M)
+_DBC_BA = re.compile(r'^BA_\s+"(\w+)"\s+BO_\s+(\d+)\s+("?)([^";]*)\3\s*;', re.M)
+
+_C_COMMENT = re.compile(r"/\*.*?\*/|//[^\n]*", re.S)
+_CANIF_TX = re.compile(r"CanIf_TxPduConfigType\s+canif_tx_config\s*\[\s*\]\s*=\s*\{(.*?)\};", re.S)
+_COM_TX = re.compile(r"Com_TxPduConfigType\s+\w+\s*\[\s*\]\s*=\s*\{(.*?)\};", re.S)
+_ROW = re.compile(r"\{([^{}]*)\}")
+
+# Event messages without a repeat time: minimum inter-arrival assumed
+DEFAULT_EVENT_INTERVAL_MS = Fraction(10)
+
+
+def _is_uds(msg: CanMessage) -> bool:
+    return msg.name.upper().startswith("UDS") or "_UDS_" in msg.name.upper()
+
+
+def load_dbc(path: str | Path, event_interval_ms: Fraction = DEFAULT_EVENT_INTERVAL_MS,
+             uds_interval_ms: Fraction | None = None) -> list[CanMessage]:
+    """Messages of a DBC; cycle 0 (event, or no attribute) uses the event interval."""
+    path = Path(path)
+    if not path.exists():
+        raise FileNotFoundError(f"DBC file not found: {path}")
+    text = path.read_text(encoding="utf-8", errors="replace")
+
+    attrs: dict[int, dict[str, str]] = {}
+    for name, raw_id, _, value in _DBC_BA.findall(text):
+        attrs.setdefault(int(raw_id), {})[name] = value.strip()
+
+    messages = []
+    for raw_id, name, dlc, sender in _DBC_BO.findall(text):
+        raw = int(raw_id)
+        a = attrs.get(raw, {})
+        cycle = Fraction(a.get("GenMsgCycleTime", "0") or "0")
+        msg = CanMessage(
+            name=name,
+            can_id=raw & 0x1FFFFFFF,
+            dlc=int(dlc),
+            period_ms=cycle,
+            sender=sender,
+            extended=bool(raw & 0x80000000),
+            event=(a.get("GenMsgSendType", "") == "event") or (cycle == 0),
+            asil=a.get("ASIL", ""),
+            source="dbc",
+        )
+        _set_event_interval(msg, event_interval_ms, uds_interval_ms)
+        messages.append(msg)
+    return messages
+
+
+def load_firmware(firmware_dir: str | Path,
+                  event_interval_ms: Fraction = DEFAULT_EVENT_INTERVAL_MS,
+                  uds_interval_ms: Fraction | None = None) -> list[CanMessage]:
+    """Messages the ECUs transmit according to their CanIf and Com TX tables."""
+    firmware_dir = Path(firmware_dir)
+    messages = []
+    for ecu_dir in sorted(p for p in firmware_dir.iterdir() if (p / "cfg").is_dir()):
+        canif = _read_canif_tx(ecu_dir)
+        com = _read_com_tx(ecu_dir)
+        sender = ecu_dir.name.upper()
+        for pdu, (can_id, dlc) in canif.items():
+            cycle = com.get(pdu)
+            msg = CanMessage(
+                name=pdu,
+                can_id=can_id & 0x1FFFFFFF,
+                dlc=dlc,
+                period_ms=Fraction(cycle or 0),
+                sender=sender,
+                extended=can_id > 0x7FF,
+                event=not cycle,
+                source="firmware",
+            )
+            if cycle is None:
+                msg.notes.append(f"{pdu} has no Com TX entry")
+            _set_event_interval(msg, event_interval_ms, uds_interval_ms)
+            messages.append(msg)
+    return messages
+
+
+def merge(dbc: list[CanMessage], firmware: list[CanMessage]) -> list[CanMessage]:
+    """Firmware entries replace the DBC entry of the same ID and sender.
+
+    The DBC keeps the name, ASIL and event repeat time; a DBC entry no ECU
+    table covers (e.g. SC, tester) is kept as it is. Differences are
+    recorded in the notes of the firmware entry.
+    """
+    def key(m: CanMessage) -> tuple[int, bool, str]:
+        return (m.can_id, m.extended, m.sender)
+
+    by_key = {key(m): m for m in dbc}
+    by_id: dict[tuple[int, bool], CanMessage] = {}
+    for m in dbc:
+        by_id.setdefault((m.can_id, m.extended), m)
+
+    for fw in firmware:
+        ref = by_key.get(key(fw)) or by_id.get((fw.can_id, fw.extended))
+        if ref is None:
+            continue
+        pdu = fw.name
+        fw.name = ref.name
+        fw.asil = ref.asil
+        if ref.sender != fw.sender:
+            fw.notes.append(f"sent by {fw.sender} ({pdu}), DBC sender is {ref.sender}")
+        if fw.dlc != ref.dlc:
+            fw.notes.append(f"DLC {fw.dlc} in {fw.sender} tables, {ref.dlc} in DBC")
+        if fw.event and not ref.event:
+            fw.notes.append(f"event in {fw.sender} tables, "
+                            f"{_fmt(ref.period_ms)} ms cyclic in DBC")
+            fw.period_ms = ref.period_ms
+        elif fw.event and ref.event:
+            fw.period_ms = ref.period_ms            # DBC repeat time of the event
+        elif fw.period_ms != ref.period_ms:
+            fw.notes.append(f"cycle {_fmt(fw.period_ms)} ms in {fw.sender} tables, "
+                            f"{_fmt(ref.period_ms)} ms in DBC")
+
+    covered = {key(f) for f in firmware}
+    return list(firmware) + [m for m in dbc if key(m) not in covered]
+
+
+def _set_event_interval(msg: CanMessage, event_interval_ms: Fraction,
+                        uds_interval_ms: Fraction | None) -> None:
+    if _is_uds(msg) and uds_interval_ms is not None:
+        msg.event = True
+        msg.period_ms = uds_interval_ms
+    elif msg.period_ms == 0:
+        msg.period_ms = event_interval_ms
+
+
+def _read_canif_tx(ecu_dir: Path) -> dict[str, tuple[int, int]]:
+    rows = {}
+    for src in sorted((ecu_dir / "src").glob("*.c")):
+        body = _table(src, _CANIF_TX)
+        if body is None:
+            continue
+        for row in _ROW.findall(body):
+            fields = [f.strip() for f in row.split(",") if f.strip()]
+            if len(fields) < 3:
+                continue
+            # Row order is { canId, upperPduId, dlc, hth }
+            rows[fields[1]] = (_c_int(fields[0]), _c_int(fields[2]))
+    return rows
+
+
+def _read_com_tx(ecu_dir: Path) -> dict[str, int]:
+    rows = {}
+    for src in sorted((ecu_dir / "cfg").glob("Com_Cfg_*.c")):
+        body = _table(src, _COM_TX)
+        if body is None:
+            continue
+        for row in _ROW.findall(body):
+            named = dict(re.findall(r"\.(\w+)\s*=\s*([^,]+)", row))
+            if named:
+                rows[named["PduId"].strip()] = _c_int(named["CycleTimeMs"])
+                continue
+            fields = [f.strip() for f in row.split(",") if f.strip()]
+            if len(fields) >= 3:
+                rows[fields[0]] = _c_int(fields[2])
+    return rows
+
+
+def _table(src: Path, pattern: re.Pattern) -> str | None:
+    text = _C_COMMENT.sub("", src.read_text(encoding="utf-8", errors="replace"))
+    found = pattern.search(text)
+    return found.group(1) if found else None
+
+
+def _c_int(token: str) -> int:
+    return int(token.strip().rstrip("uUlL"), 0)
+
+
+def _fmt(value: Fraction) -> str:
+    return str(int(value)) if value.denominator == 1 else f"{float(value):g}"
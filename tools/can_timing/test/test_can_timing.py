@@ -0,0 +1,175 @@
+"""Unit tests for the CAN response time analysis and its message sources.
+
+@aspice  SWE.4 — Software Unit Verification
+@scope   tools.can_timing: frame length, RTA, DBC/firmware readers, CLI
+
+Run from the repo root: python -m pytest tools/can_timing/test
+"""
+from fractions import Fraction
+
+import pytest
+
+from tools.can_timing import cli
+from tools.can_timing.rta import CanMessage, analyze, frame_bits, tx_time_us, utilization
+from tools.can_timing.sources import load_dbc, load_firmware, merge
+
+
+def _msg(can_id, period_ms, dlc=8, name=None, **kw):
+    return CanMessage(name=name or f"m{can_id:03X}", can_id=can_id, dlc=dlc,
+                      period_ms=Fraction(period_ms), **kw)
+
+
+def _by_id(results):
+    return {r.msg.can_id: r for r in results}
+
+
+class TestFrameLength:
+    def test_standard_8_bytes_is_135_bits(self):
+        assert frame_bits(8) == 135
+        assert tx_time_us(8, False, 500_000) == 270
+
+    def test_standard_0_bytes(self):
+        assert frame_bits(0) == 55
+
+    def test_extended_8_bytes_is_160_bits(self):
+        assert frame_bits(8, extended=True) == 160
+
+    def test_dlc_above_8_counts_as_8(self):
+        assert frame_bits(15) == frame_bits(8)
+
+
+class TestResponseTime:
+    def test_three_equal_frames(self):
+        res = _by_id(analyze([_msg(1, 10), _msg(2, 10), _msg(3, 10)]))
+        assert res[1].response_us == 540      # blocked by one frame + own
+        assert res[2].response_us == 810
+        assert res[3].blocking_us == 0
+        assert res[3].response_us == 810
+        assert all(r.ok for r in res.values())
+
+    def test_estop_bounded_by_one_frame_behind_uds_flood(self):
+        uds = [_msg(0x7E0 + i, Fraction(27, 100), event=True) for i in range(3)]
+        res = _by_id(analyze([_msg(0x001, 10, event=True)] + uds))
+        assert res[0x001].response_us == 540
+        assert res[0x001].ok
+        assert not res[0x7E2].ok
+
+    def test_low_priority_misses_deadline_under_load(self):
+        msgs = [_msg(i, 1) for i in range(1, 4)] + [_msg(0x100, 1)]
+        res = _by_id(analyze(msgs))
+        assert utilization(msgs, 500_000) == Fraction(108, 100)
+        assert res[0x100].response_us is None
+        assert not res[0x100].ok
+
+    def test_deadline_and_jitter(self):
+        m = _msg(2, 10, deadline_ms=Fraction(1, 2), jitter_ms=Fraction(1))
+        res = _by_id(analyze([_msg(1, 10), m]))
+        assert res[2].response_us == 1000 + 540
+        assert not res[2].ok
+
+    def test_standard_id_wins_against_extended_with_same_base(self):
+        std = _msg(0x100, 10)
+        ext = _msg(0x100 << 18, 10, extended=True)
+        res = analyze([ext, std])
+        assert res[0].msg is std
+
+    def test_same_id_senders_interfere(self):
+        res = analyze([_msg(0x500, 10, sender="A"), _msg(0x500, 10, sender="B")])
+        assert [r.response_us for r in res] == [540, 540]
+
+
+DBC = """\
+BU_: A B Tester
+
+BO_ 1 EStop: 4 A
+ SG_ Cmd : 0|8@1+ (1,0) [0|255] "" B
+
+BO_ 256 State: 8 A
+
+BO_ 528 Fault: 4 B
+
+BO_ 2016 UDS_Req_A: 8 Tester
+
+BA_DEF_ BO_ "GenMsgCycleTime" INT 0 10000;
+BA_ "GenMsgCycleTime" BO_ 1 10;
+BA_ "GenMsgCycleTime" BO_ 256 20;
+BA_ "GenMsgCycleTime" BO_ 528 0;
+BA_ "GenMsgSendType" BO_ 1 "event";
+BA_ "GenMsgSendType" BO_ 256 "cyclic";
+BA_ "ASIL" BO_ 256 "D";
+"""
+
+
+@pytest.fixture
+def dbc_file(tmp_path):
+    path = tmp_path / "test.dbc"
+    path.write_text(DBC)
+    return path
+
+
+@pytest.fixture
+def firmware_dir(tmp_path):
+    ecu = tmp_path / "a"
+    (ecu / "src").mkdir(parents=True)
+    (ecu / "cfg").mkdir()
+    (ecu / "src" / "main.c").write_text("""
+static const CanIf_TxPduConfigType canif_tx_config[] = {
+    /* canId,  upperPduId,        dlc, hth */
+    { 0x001u, A_COM_TX_ESTOP,     8u, 0u },  /* E-stop */
+    { 0x100u, A_COM_TX_STATE,     8u, 0u },  /* State  */
+};
+""")
+    (ecu / "cfg" / "Com_Cfg_A.c").write_text("""
+static const Com_TxPduConfigType a_tx_pdu_config[] = {
+    { A_COM_TX_ESTOP,  8u,  0u },   /* Event */
+    {
+        .PduId       = A_COM_TX_STATE,
+        .Dlc         = 8u,
+        .CycleTimeMs = 50u,
+    },
+};
+""")
+    return tmp_path
+
+
+class TestSources:
+    def test_dbc_cycle_send_type_asil(self, dbc_file):
+        msgs = {m.can_id: m for m in load_dbc(dbc_file)}
+        assert msgs[1].event and msgs[1].period_ms == 10
+        assert msgs[256].period_ms == 20 and msgs[256].asil == "D"
+        assert msgs[256].sender == "A"
+        assert msgs[528].event and msgs[528].period_ms == 10     # event interval
+
+    def test_dbc_uds_interval(self, dbc_file):
+        msgs = {m.can_id: m for m in load_dbc(dbc_file, uds_interval_ms=Fraction(1))}
+        assert msgs[2016].period_ms == 1
+
+    def test_firmware_tables(self, firmware_dir):
+        msgs = {m.can_id: m for m in load_firmware(firmware_dir)}
+        assert msgs[0x001].event and msgs[0x001].sender == "A"
+        assert msgs[0x100].period_ms == 50 and msgs[0x100].dlc == 8
+
+    def test_merge_notes_differences(self, dbc_file, firmware_dir):
+        msgs = merge(load_dbc(dbc_file), load_firmware(firmware_dir))
+        by_id = {m.can_id: m for m in msgs}
+        assert len(msgs) == 4
+        assert by_id[0x100].name == "State"
+        assert by_id[0x100].period_ms == 50
+        assert any("cycle 50 ms" in n for n in by_id[0x100].notes)
+        assert any("DLC 8" in n for n in by_id[0x001].notes)
+
+
+class TestCli:
+    def test_pass(self, dbc_file, capsys):
+        assert cli.main(["--dbc", str(dbc_file)]) == 0
+        assert "PASS" in capsys.readouterr().out
+
+    def test_deadline_miss_fails(self, dbc_file, capsys):
+        assert cli.main(["--dbc", str(dbc_file), "--deadline", "State=0.3"]) == 1
+        assert "DEADLINE MISS" in capsys.readouterr().out
+
+    def test_bad_override(self, dbc_file):
+        assert cli.main(["--dbc", str(dbc_file), "--period", "0x999=1"]) == 2
+
+    def test_no_input(self):
+        assert cli.main([]) == 2
@@ -9,7 +9,7 @@ from typing import Sequence
 from tools.onboard.manifest_loader import ManifestError, load_manifest
 from tools.onboard.dbc_parser import parse_dbc
 from tools.onboard.resolver import resolve
-from tools.onboard.generator import cfg_h, com_cfg, rte_cfg, swc_com, main_c, hw_posix
+from tools.onboard.generator import cfg_h, com_cfg, rte_cfg, rte_ports, swc_com, main_c, hw_posix
 from tools.onboard.generator import makefile, dockerfile, compose, fault_scenarios
 
 
@@ -34,7 +34,7 @@ def _collect_files(model) -> list[tuple[str, str]]:
     """Run all generators, return list of (relative_path, content)."""
     files: list[tuple[str, str]] = []
     generators = [
-        cfg_h, com_cfg, rte_cfg, swc_com, main_c, hw_posix,
+        cfg_h, com_cfg, rte_cfg, rte_ports, swc_com, main_c, hw_posix,
         makefile, dockerfile, compose, fault_scenarios,
     ]
     for gen in generators:
@@ -11,6 +11,7 @@ class RteSignalEntry:
     """One RTE signal (id >= 16)."""
     id: int
     macro_name: str          # e.g. ABS_SIG_WHEEL_SPEED_FL
+    port_name: str           # e.g. Wheel_Speed_Fl (Rte_Read_Wheel_Speed_Fl)
     c_type: str              # uint8, uint16, sint16, uint32
     initial_value: int
 
@@ -26,6 +27,7 @@ class ComSignalEntry:
     shadow_name: str         # C variable name for shadow buffer
     is_tx: bool
     rte_signal_macro: str    # corresponding RTE signal macro (for bridge)
+    rte_port_name: str       # typed accessor suffix of that RTE signal
 
 
 @dataclass
@@ -55,6 +57,8 @@ class RunnableEntry:
     period_ms: int
     priority: int
     init_func: str | None    # init function (called once at startup)
+    exec_us: int | None = None    # measured execution time (load balancing)
+    offset_ms: int | None = None  # fixed phase offset, None = assign
 
 
 @dataclass
@@ -90,6 +94,7 @@ class EcuModel:
 
     # Runnables
     runnables: list[RunnableEntry] = field(default_factory=list)
+    bsw_exec_us: dict[str, int] = field(default_factory=dict)  # BSW runnable -> us
 
     # Fault injection
     fault_scenarios: list[FaultScenarioEntry] = field(default_factory=list)
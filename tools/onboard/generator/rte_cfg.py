@@ -1,11 +1,193 @@
-"""Generate Rte_Cfg_<Ecu>.c — BSW signals 0-15, app signals, runnable table."""
+"""Generate Rte_Cfg_<Ecu>.c — BSW signals 0-15, app signals, runnable table.
+
+BSW signals are the generic Rte_Read / Rte_Write table; app signals are the
+typed struct of Rte_<Ecu>.h (see rte_ports), defined here with their
+initial values.
+
+Runnable phase offsets: runnables without a fixed ``offset_ms`` are spread
+over the ticks of their period so that the 10 ms (or slower) boundaries do
+not carry the whole chain. Offsets are assigned per period class, fastest
+first, on the measured ``exec_us`` (DEFAULT_EXEC_US when not measured):
+
+- the class keeps its dispatch order (priority descending, table order for
+  ties) and is cut into contiguous groups, group k running at offset k, so
+  RX -> SWCs -> TX still run in sequence within one period;
+- the cut minimizes the peak tick load (load already placed on the ticks
+  by faster classes and pinned runnables included), then the sum of the
+  squared tick loads.
+
+The resulting tick loads are summarized in a comment block in the config.
+"""
 from __future__ import annotations
 
+from dataclasses import dataclass
+from math import gcd
+
 from tools.onboard.generator._render import render_template
+from tools.onboard.generator.rte_ports import ports, struct_size
 from tools.onboard.data_model import EcuModel
 
+DEFAULT_EXEC_US = 50    # Execution time assumed for unmeasured runnables
+BSW_PERIOD_MS = 10      # Period of the always-present BSW runnables
+
+
+@dataclass
+class RunnableRow:
+    """One row of the generated runnable table."""
+    func: str
+    period_ms: int
+    priority: int
+    se_id: str          # "0xFFu" (not supervised) or "<n>u"
+    comment: str
+    exec_us: int
+    measured: bool
+    offset_ms: int | None
+
+
+def _bsw_row(model: EcuModel, func: str, priority: int, comment: str) -> RunnableRow:
+    exec_us = model.bsw_exec_us.get(func)
+    return RunnableRow(
+        func=func, period_ms=BSW_PERIOD_MS, priority=priority, se_id="0xFFu",
+        comment=comment,
+        exec_us=exec_us if exec_us is not None else DEFAULT_EXEC_US,
+        measured=exec_us is not None, offset_ms=None,
+    )
+
+
+def build_rows(model: EcuModel) -> list[RunnableRow]:
+    """Runnable table in config order: BSW RX, application, BSW TX."""
+    pascal = model.name_pascal
+    rows = [
+        _bsw_row(model, "Can_MainFunction_Read", 15, "CAN RX first"),
+        _bsw_row(model, "Com_MainFunction_Rx", 14, "Com RX timeout"),
+        _bsw_row(model, f"Swc_{pascal}Com_BridgeRxToRte", 13, "Bridge RX->RTE"),
+    ]
+    for idx, r in enumerate(model.runnables):
+        rows.append(RunnableRow(
+            func=r.func, period_ms=r.period_ms, priority=r.priority,
+            se_id=f"{idx}u", comment="",
+            exec_us=r.exec_us if r.exec_us is not None else DEFAULT_EXEC_US,
+            measured=r.exec_us is not None,
+            offset_ms=r.offset_ms,
+        ))
+    rows += [
+        _bsw_row(model, f"Swc_{pascal}Com_TransmitSchedule", 2, "Bridge RTE->TX"),
+        _bsw_row(model, "Com_MainFunction_Tx", 1, "COM TX"),
+        _bsw_row(model, "Can_MainFunction_BusOff", 0, "Bus-off check"),
+    ]
+    return rows
+
+
+def hyperperiod(rows: list[RunnableRow]) -> int:
+    h = 1
+    for r in rows:
+        h = h * r.period_ms // gcd(h, r.period_ms)
+    return h
+
+
+def tick_loads(rows: list[RunnableRow], period: int) -> list[int]:
+    """Load (us) per tick of the hyperperiod of `rows` with offsets set.
+
+    Only rows whose offset is known contribute.
+    """
+    placed = [r for r in rows if r.offset_ms is not None]
+    h = hyperperiod(placed) if placed else 1
+    h = h * period // gcd(h, period)
+    loads = [0] * h
+    for r in placed:
+        for t in range(r.offset_ms, h, r.period_ms):
+            loads[t] += r.exec_us
+    return loads
+
+
+def _partition(weights: list[int], base: list[int]) -> list[int]:
+    """Cut `weights` (in order) into len(base) contiguous groups.
+
+    Returns the group index of each weight, minimizing the peak of
+    base[k] + group load k, then the sum of squares.
+    """
+    n, m = len(weights), len(base)
+    prefix = [0]
+    for w in weights:
+        prefix.append(prefix[-1] + w)
+    inf = (float("inf"), float("inf"))
+    # best[k][i]: first i weights in groups 0..k-1 -> (peak, sum of squares)
+    best = [[inf] * (n + 1) for _ in range(m + 1)]
+    cut = [[0] * (n + 1) for _ in range(m + 1)]
+    best[0][0] = (0, 0)
+    for k in range(1, m + 1):
+        for i in range(n + 1):
+            for j in range(i + 1):
+                prev = best[k - 1][j]
+                if prev == inf:
+                    continue
+                load = base[k - 1] + prefix[i] - prefix[j]
+                cand = (max(prev[0], load), prev[1] + load * load)
+                if cand < best[k][i]:
+                    best[k][i] = cand
+                    cut[k][i] = j
+    groups = [0] * n
+    i = n
+    for k in range(m, 0, -1):
+        j = cut[k][i]
+        for idx in range(j, i):
+            groups[idx] = k - 1
+        i = j
+    return groups
+
+
+def assign_offsets(rows: list[RunnableRow]) -> None:
+    """Fill offset_ms of every row that has no fixed offset."""
+    for period in sorted({r.period_ms for r in rows}):
+        free = [r for r in rows if r.period_ms == period and r.offset_ms is None]
+        if not free:
+            continue
+        # Stable sort: dispatch order of Rte_BuildPattern
+        free.sort(key=lambda r: -r.priority)
+        loads = tick_loads(rows, period)
+        base = [max(loads[t] for t in range(o, len(loads), period))
+                for o in range(period)]
+        for r, o in zip(free, _partition([r.exec_us for r in free], base)):
+            r.offset_ms = o
+
+
+def load_report(rows: list[RunnableRow]) -> dict:
+    """Tick load over the hyperperiod, one line per distinct runnable set.
+
+    Lines are sorted by load, heaviest first, so the first line is the
+    peak; the peak with all offsets 0 is given for comparison.
+    """
+    loads = tick_loads(rows, 1)
+    groups: dict[tuple[str, ...], dict] = {}
+    for t, load in enumerate(loads):
+        due = [r for r in rows if t % r.period_ms == r.offset_ms]
+        due.sort(key=lambda r: -r.priority)
+        key = tuple(r.func for r in due)
+        if key not in groups:
+            groups[key] = {
+                "load_us": load,
+                "estimated": any(not r.measured for r in due),
+                "first": t,
+                "count": 0,
+                "funcs": list(key),
+            }
+        groups[key]["count"] += 1
+    lines = sorted(groups.values(), key=lambda g: (-g["load_us"], g["first"]))
+    return {
+        "hyperperiod": len(loads),
+        "lines": lines,
+        "peak_us": max(loads),
+        "peak_no_offset_us": sum(r.exec_us for r in rows),
+    }
+
 
 def generate(model: EcuModel) -> list[tuple[str, str]]:
-    content = render_template("rte_cfg_c.j2", ecu=model)
+    rows = build_rows(model)
+    assign_offsets(rows)
+    content = render_template(
+        "rte_cfg_c.j2", ecu=model, runnables=rows, load=load_report(rows),
+        default_exec_us=DEFAULT_EXEC_US,
+        ports=ports(model), ports_size=struct_size(model),
+    )
     path = f"{model.name}/cfg/Rte_Cfg_{model.name_pascal}.c"
     return [(path, content)]
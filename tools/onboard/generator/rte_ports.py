@@ -0,0 +1,36 @@
+"""Generate Rte_<Ecu>.h — typed application signal struct + port accessors.
+
+Application signals (id >= 16) are not stored in the generic uint32 Rte
+buffer: each one is a member of its manifest type in one struct, and
+customer SWCs and the Com bridge access it through generated static inline
+``Rte_Read_<Port>`` / ``Rte_Write_<Port>`` functions. The port is resolved
+at compile time, so the accessors have no ID check, no lock and no cast.
+
+Members are ordered by size, largest first, so the struct has no padding
+without compiler-specific packing; Rte_Cfg_<Ecu>.c checks that at compile
+time and holds the struct instance with the initial values.
+"""
+from __future__ import annotations
+
+from tools.onboard.generator._render import render_template
+from tools.onboard.data_model import EcuModel, RteSignalEntry
+
+_C_TYPE_SIZE = {"uint8": 1, "uint16": 2, "sint16": 2, "uint32": 4}
+
+
+def ports(model: EcuModel) -> list[RteSignalEntry]:
+    """Application signals in struct member order (size descending, id)."""
+    return sorted(model.rte_signals, key=lambda s: (-_C_TYPE_SIZE[s.c_type], s.id))
+
+
+def struct_size(model: EcuModel) -> int:
+    """sizeof the signal struct: members, then tail padding to the largest."""
+    size = sum(_C_TYPE_SIZE[s.c_type] for s in model.rte_signals)
+    align = max(_C_TYPE_SIZE[s.c_type] for s in model.rte_signals)
+    return (size + align - 1) // align * align
+
+
+def generate(model: EcuModel) -> list[tuple[str, str]]:
+    content = render_template("rte_ports_h.j2", ecu=model, ports=ports(model))
+    path = f"{model.name}/cfg/Rte_{model.name_pascal}.h"
+    return [(path, content)]
@@ -1,6 +1,7 @@
 """Cross-reference manifest YAML + DBC → EcuModel for generators."""
 from __future__ import annotations
 
+from math import gcd
 from typing import Any
 
 from tools.onboard.data_model import (
@@ -9,6 +10,11 @@ from tools.onboard.data_model import (
 )
 from tools.onboard.dbc_parser import DbcDatabase
 
+# Rte schedule table limit (RTE_SCHED_MAX_HYPERPERIOD in Rte.h); BSW
+# runnables run every 10 ms
+_RTE_MAX_HYPERPERIOD_MS = 1000
+_BSW_PERIOD_MS = 10
+
 # Type mapping: manifest type → (C Com type macro, bit size, C shadow type)
 _TYPE_MAP = {
     "UINT8":  ("COM_UINT8",  8,  "uint8"),
@@ -28,6 +34,11 @@ def _to_pascal(name: str) -> str:
     return "".join(part.capitalize() for part in name.split("_"))
 
 
+def _to_port(name: str) -> str:
+    """'PEDAL_POSITION' → 'Pedal_Position' (Rte_Read_Pedal_Position)."""
+    return "_".join(part.capitalize() for part in name.split("_"))
+
+
 def resolve(manifest: dict[str, Any], dbc: DbcDatabase) -> EcuModel:
     """Build an EcuModel from a validated manifest + parsed DBC."""
     ecu_cfg = manifest["ecu"]
@@ -42,6 +53,7 @@ def resolve(manifest: dict[str, Any], dbc: DbcDatabase) -> EcuModel:
         entry = RteSignalEntry(
             id=sig_def["id"],
             macro_name=f"{ecu_upper}_SIG_{sig_def['name']}",
+            port_name=_to_port(sig_def["name"]),
             c_type=_TYPE_MAP[sig_def["type"]][2],
             initial_value=sig_def.get("initial_value", 0),
         )
@@ -101,6 +113,7 @@ def resolve(manifest: dict[str, Any], dbc: DbcDatabase) -> EcuModel:
                 shadow_name=shadow_name,
                 is_tx=True,
                 rte_signal_macro=rte_sig.macro_name,
+                rte_port_name=rte_sig.port_name,
             ))
             com_sig_id += 1
 
@@ -152,6 +165,7 @@ def resolve(manifest: dict[str, Any], dbc: DbcDatabase) -> EcuModel:
                 shadow_name=shadow_name,
                 is_tx=False,
                 rte_signal_macro=rte_sig.macro_name,
+                rte_port_name=rte_sig.port_name,
             ))
             com_sig_id += 1
 
@@ -162,9 +176,25 @@ def resolve(manifest: dict[str, Any], dbc: DbcDatabase) -> EcuModel:
             period_ms=r["period_ms"],
             priority=r["priority"],
             init_func=r.get("init_func"),
+            exec_us=r.get("exec_us"),
+            offset_ms=r.get("offset_ms"),
         )
         for r in manifest["runnables"]
     ]
+    for r in runnables:
+        if r.offset_ms is not None and r.offset_ms >= r.period_ms:
+            raise ResolveError(
+                f"Runnable '{r.func}' offset_ms {r.offset_ms} must be "
+                f"below its period_ms {r.period_ms}"
+            )
+    hyperperiod = _BSW_PERIOD_MS
+    for r in runnables:
+        hyperperiod = hyperperiod * r.period_ms // gcd(hyperperiod, r.period_ms)
+    if hyperperiod > _RTE_MAX_HYPERPERIOD_MS:
+        raise ResolveError(
+            f"Runnable periods give a {hyperperiod} ms hyperperiod, the Rte "
+            f"schedule table holds at most {_RTE_MAX_HYPERPERIOD_MS} ms"
+        )
 
     # ── Fault scenarios ──────────────────────────────────────────
     fault_scenarios = [
@@ -195,5 +225,6 @@ def resolve(manifest: dict[str, Any], dbc: DbcDatabase) -> EcuModel:
         tx_pdus=tx_pdus,
         rx_pdus=rx_pdus,
         runnables=runnables,
+        bsw_exec_us=dict(manifest.get("bsw_exec_us", {})),
         fault_scenarios=fault_scenarios,
     )